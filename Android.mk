@@ -111,10 +111,21 @@ LOCAL_SRC_FILES := \
     src/agent/agent_instance.cpp \
     src/agent/instance_params.cpp \
     src/agent/border_agent.cpp \
+    src/agent/churn_log.cpp \
     src/agent/main.cpp \
     src/agent/ncp_openthread.cpp \
+    src/agent/rcp_stats.cpp \
+    src/agent/srp_state_store.cpp \
     src/agent/thread_helper.cpp \
+    src/common/ip6_address_set.cpp \
     src/common/logging.cpp \
+    src/common/mainloop_poller.cpp \
+    src/common/mainloop_stats.cpp \
+    src/common/mainloop_watchdog.cpp \
+    src/common/memory_stats.cpp \
+    src/common/startup_timeline.cpp \
+    src/common/task_queue.cpp \
+    src/common/timer_wheel.cpp \
     src/dbus/common/dbus_message_dump.cpp \
     src/dbus/common/dbus_message_helper.cpp \
     src/dbus/common/dbus_message_helper_openthread.cpp \
@@ -39,15 +39,36 @@
 #error "The Advertising Proxy requires OTBR_ENABLE_MDNS_AVAHI, OTBR_ENABLE_MDNS_MDNSSD or OTBR_ENABLE_MDNS_MOJO"
 #endif
 
+#include <algorithm>
+#include <chrono>
+#include <functional>
 #include <string>
 
 #include <assert.h>
 
+#include "agent/instance_params.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/memory_stats.hpp"
+#include "common/metrics.hpp"
+#include "common/trace.hpp"
+#include "common/usdt.hpp"
 
 namespace otbr {
 
+// The SRP server does not expose the lease of a host, assume the default lease of the SRP client.
+static constexpr std::chrono::seconds kSrpLease(7200);
+
+// The time given to republishing a restored host.
+static constexpr std::chrono::seconds kRestoreTimeout(10);
+
+static uint64_t GetWallClockSeconds(void)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::seconds>(
+                                     std::chrono::system_clock::now().time_since_epoch())
+                                     .count());
+}
+
 // TODO: better to have SRP server provide separated service name labels.
 static otbrError SplitFullServiceName(const std::string &aFullName,
                                       std::string &      aInstanceName,
@@ -95,6 +116,9 @@ exit:
 AdvertisingProxy::AdvertisingProxy(Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher)
     : mNcp(aNcp)
     , mPublisher(aPublisher)
+    , mNextUpdateId(0)
+    , mInFlightCount(0)
+    , mProcessingPending(false)
 {
 }
 
@@ -105,6 +129,8 @@ otbrError AdvertisingProxy::Start(void)
     mPublisher.SetPublishServiceHandler(PublishServiceHandler, this);
     mPublisher.SetPublishHostHandler(PublishHostHandler, this);
 
+    RestorePublications();
+
     otbrLog(OTBR_LOG_INFO, "[adproxy] Started");
 
     return OTBR_ERROR_NONE;
@@ -117,6 +143,20 @@ void AdvertisingProxy::Stop()
 
     // Outstanding updates will fail on the SRP server because of timeout.
     // TODO: handle this case gracefully.
+    for (auto &update : mOutstandingUpdates)
+    {
+        update.second.mTimeoutTimer.Cancel();
+    }
+    mOutstandingUpdates.clear();
+    mUpdateIds.clear();
+    mPublishedHosts.clear();
+    mPendingNewHosts.clear();
+    mPendingRenewals.clear();
+    mQueuedUpdateIds.clear();
+    mInFlightCount = 0;
+    mRestoredHosts.clear();
+    mRestoreExpiryTimer.Cancel();
+    mStateStore.Close();
 
     // Stop receiving SRP server events.
     if (GetInstance() != nullptr)
@@ -127,6 +167,13 @@ void AdvertisingProxy::Stop()
     otbrLog(OTBR_LOG_INFO, "[adproxy] Stopped");
 }
 
+void AdvertisingProxy::HandleSoftReset(void)
+{
+    // The publications are kept, the new SRP server ignores the results of the outstanding updates and the SRP
+    // clients send them again.
+    otSrpServerSetServiceUpdateHandler(GetInstance(), AdvertisingHandler, this);
+}
+
 void AdvertisingProxy::AdvertisingHandler(const otSrpServerHost *aHost, uint32_t aTimeout, void *aContext)
 {
     static_cast<AdvertisingProxy *>(aContext)->AdvertisingHandler(aHost, aTimeout);
@@ -134,174 +181,762 @@ void AdvertisingProxy::AdvertisingHandler(const otSrpServerHost *aHost, uint32_t
 
 void AdvertisingProxy::AdvertisingHandler(const otSrpServerHost *aHost, uint32_t aTimeout)
 {
-    // TODO: There are corner cases that the `aHost` is freed by SRP server because
-    // of timeout, but this `aHost` is passed back to SRP server and matches a newly
-    // allocated otSrpServerHost object which has the same pointer value as this
-    // `aHost`. This results in mismatching of the outstanding SRP updates. Solutions
-    // are cleaning up the outstanding update entries before timing out or using
-    // incremental ID to match oustanding SRP updates.
-    OTBR_UNUSED_VARIABLE(aTimeout);
-
-    otbrError                 error = OTBR_ERROR_NONE;
-    const char *              fullHostName;
-    std::string               hostName;
-    std::string               hostDomain;
-    const otIp6Address *      hostAddress;
-    uint8_t                   hostAddressNum;
-    bool                      hostDeleted;
-    const otSrpServerService *service;
-    OutstandingUpdate *       update;
-
-    mOutstandingUpdates.resize(mOutstandingUpdates.size() + 1);
-    update = &mOutstandingUpdates.back();
-
-    fullHostName = otSrpServerHostGetFullName(aHost);
+    MemoryStats::Scope memoryScope(MemoryStats::kSubsystemAdvertisingProxy);
+
+    // Outstanding updates are matched by an incremental id instead of `aHost`, the SRP server may free
+    // `aHost` on timeout and allocate a new host object at the same address.
+    otbrError          error;
+    const char *       fullHostName = otSrpServerHostGetFullName(aHost);
+    std::string        hostName;
+    std::string        hostDomain;
+    UpdateId           updateId    = mNextUpdateId++;
+    OutstandingUpdate &update      = mOutstandingUpdates[updateId];
+    auto               timeoutTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(aTimeout);
+
+    Metrics::Get().Increment(Metrics::kCounterSrpUpdates);
+    Trace::Get().Log(Trace::kEventSrpUpdate, updateId, aTimeout);
+    OTBR_USDT2(srp_update_start, updateId, aTimeout);
+
+    otbrLog(OTBR_LOG_INFO, "[adproxy] queue SRP service updates: host=%s", fullHostName);
+
+    update.mHost = aHost;
+
+    // The SRP server gives up on the update after `aTimeout`, including the time spent in the queue.
+    update.mTimeoutTimer = mNcp.PostTimerTask(timeoutTime, [this, updateId]() { HandleUpdateTimeout(updateId); });
+
+    error = SplitFullHostName(fullHostName, hostName, hostDomain);
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_INFO, "[adproxy] failed to advertise SRP service updates %p", aHost);
+        CompleteUpdate(updateId, OtbrErrorToOtError(error));
+        ExitNow();
+    }
+
+    update.mHostName = hostName;
+
+    // The SRP client is back, its host no longer expires with the restored lease.
+    mRestoredHosts.erase(hostName);
+
+    {
+        auto queued = mQueuedUpdateIds.find(hostName);
+
+        if (queued != mQueuedUpdateIds.end())
+        {
+            // The queued update has not reached the publisher yet, this update carries the latest state of the
+            // host, so the queued one is completed along with it.
+            OutstandingUpdate &superseded = mOutstandingUpdates[queued->second];
+
+            update.mMergedIds = std::move(superseded.mMergedIds);
+            update.mMergedIds.push_back(queued->second);
+            superseded.mMergedIds.clear();
+            superseded.mQueued = false;
+        }
+    }
+
+    // New hosts are published before renewals of known hosts, they are not discoverable at all yet.
+    update.mQueued             = true;
+    mQueuedUpdateIds[hostName] = updateId;
+
+    if (mPublishedHosts.find(hostName) == mPublishedHosts.end())
+    {
+        mPendingNewHosts.push_back(updateId);
+    }
+    else
+    {
+        mPendingRenewals.push_back(updateId);
+    }
+
+    ProcessPendingUpdates();
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::ProcessPendingUpdates(void)
+{
+    uint32_t limit = InstanceParams::Get().GetSrpPublishLimit();
+
+    // Completing an update may be reported synchronously while starting another one.
+    VerifyOrExit(!mProcessingPending);
+    mProcessingPending = true;
+
+    while (limit == 0 || mInFlightCount < limit)
+    {
+        std::deque<UpdateId> &pending = !mPendingNewHosts.empty() ? mPendingNewHosts : mPendingRenewals;
+        UpdateId              updateId;
+
+        VerifyOrExit(!pending.empty(), mProcessingPending = false);
+
+        updateId = pending.front();
+        pending.pop_front();
+
+        auto update = mOutstandingUpdates.find(updateId);
+
+        // Skip updates which timed out or were superseded while queued.
+        if (update == mOutstandingUpdates.end() || !update->second.mQueued)
+        {
+            continue;
+        }
+
+        update->second.mQueued = false;
+        mQueuedUpdateIds.erase(update->second.mHostName);
+        StartUpdate(updateId);
+    }
+
+    mProcessingPending = false;
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::StartUpdate(UpdateId aId)
+{
+    otbrError                               error = OTBR_ERROR_NONE;
+    const char *                            fullHostName;
+    std::string                             hostName;
+    std::string                             hostDomain;
+    const otIp6Address *                    hostAddress;
+    uint8_t                                 hostAddressNum;
+    Mdns::Publisher::AddressList            hostAddresses;
+    bool                                    hostDeleted;
+    bool                                    hostKnown;
+    bool                                    publishHost = false;
+    const otSrpServerService *              service;
+    std::vector<const otSrpServerService *> publishServices;
+    std::vector<const otSrpServerService *> updateTxtServices;
+    std::vector<PublishedService>           unpublishServices;
+    OutstandingUpdate &                     update  = mOutstandingUpdates[aId];
+    const otSrpServerHost *                 host    = update.mHost;
+    bool                                    inBatch = false;
+
+    if (host == nullptr)
+    {
+        StartRestoredUpdate(aId);
+        ExitNow();
+    }
+
+    fullHostName = otSrpServerHostGetFullName(host);
 
     otbrLog(OTBR_LOG_INFO, "[adproxy] advertise SRP service updates: host=%s", fullHostName);
 
     SuccessOrExit(error = SplitFullHostName(fullHostName, hostName, hostDomain));
-    hostAddress = otSrpServerHostGetAddresses(aHost, &hostAddressNum);
-    hostDeleted = otSrpServerHostIsDeleted(aHost);
+    hostAddress = otSrpServerHostGetAddresses(host, &hostAddressNum);
+    hostDeleted = otSrpServerHostIsDeleted(host);
 
-    update->mHost = aHost;
-    update->mCount += !hostDeleted;
-    update->mHostName = hostName;
+    // Compare the update with what has been published for the host, a lease refresh yields an empty diff.
+    // Removals are forwarded unless the service is known to be unpublished.
+    hostKnown = (mPublishedHosts.find(hostName) != mPublishedHosts.end());
 
-    service = nullptr;
-    while ((service = otSrpServerHostGetNextService(aHost, service)) != nullptr)
     {
-        update->mCount += !otSrpServerServiceIsDeleted(service);
+        PublishedHost &published = mPublishedHosts[hostName];
+
+        if (!hostDeleted)
+        {
+            Mdns::Publisher::AddressList removedAddresses;
+            Mdns::Publisher::AddressList addedAddresses;
+
+            for (uint8_t i = 0; i < hostAddressNum; i++)
+            {
+                hostAddresses.emplace_back(hostAddress[i].mFields.m8);
+            }
+
+            // Advertise all addresses from the SRP client, the host is republished only if its address set changes.
+            Mdns::Publisher::DiffAddresses(published.mAddresses, hostAddresses, removedAddresses, addedAddresses);
+            publishHost          = !hostKnown || !removedAddresses.empty() || !addedAddresses.empty();
+            published.mAddresses = hostAddresses;
+        }
+
+        service = nullptr;
+        while ((service = otSrpServerHostGetNextService(host, service)) != nullptr)
+        {
+            const char *fullServiceName = otSrpServerServiceGetFullName(service);
+            std::string serviceName;
+            std::string serviceType;
+            std::string serviceDomain;
+            std::string serviceKey;
+
+            SuccessOrExit(error = SplitFullServiceName(fullServiceName, serviceName, serviceType, serviceDomain));
+            serviceKey = Mdns::Publisher::MakeServiceKey(serviceName.c_str(), serviceType.c_str());
+
+            auto publishedService = published.mServices.find(serviceKey);
+
+            if (!hostDeleted && !otSrpServerServiceIsDeleted(service))
+            {
+                uint16_t             port    = otSrpServerServiceGetPort(service);
+                std::vector<uint8_t> txtData = MakeTxtData(MakeTxtList(service));
+
+                if (publishedService == published.mServices.end() || publishedService->second.mPort != port)
+                {
+                    publishServices.push_back(service);
+                }
+                else if (publishedService->second.mTxtData != txtData)
+                {
+                    updateTxtServices.push_back(service);
+                }
+
+                published.mServices[serviceKey] = PublishedService{serviceName, serviceType, port, std::move(txtData)};
+            }
+            else if (!hostKnown || publishedService != published.mServices.end())
+            {
+                unpublishServices.push_back(PublishedService{serviceName, serviceType, 0, {}});
+
+                if (publishedService != published.mServices.end())
+                {
+                    published.mServices.erase(publishedService);
+                }
+            }
+        }
+
+        if (hostDeleted)
+        {
+            // Services which are no longer listed by the SRP server go away with the host.
+            for (auto &publishedService : published.mServices)
+            {
+                unpublishServices.push_back(std::move(publishedService.second));
+            }
+
+            mPublishedHosts.erase(hostName);
+        }
     }
 
-    if (!hostDeleted)
+    if (hostDeleted)
     {
-        // TODO: select a preferred address or advertise all addresses from SRP client.
-        otbrLog(OTBR_LOG_INFO, "[adproxy] publish SRP host: %s", fullHostName);
-        SuccessOrExit(error =
-                          mPublisher.PublishHost(hostName.c_str(), hostAddress[0].mFields.m8, sizeof(hostAddress[0])));
+        RemoveSavedHost(hostName);
     }
     else
+    {
+        SaveHost(hostName);
+    }
+
+    // Count the expected results before publishing, a publisher may report a result synchronously.
+    update.mCount = (publishHost ? 1 : 0) + static_cast<uint32_t>(publishServices.size());
+
+    otbrLog(OTBR_LOG_INFO, "[adproxy] SRP host %s diff: host=%d published=%zu txt-updated=%zu unpublished=%zu",
+            fullHostName, publishHost, publishServices.size(), updateTxtServices.size(), unpublishServices.size());
+
+    // Publish the host and its services in one batch so that they are probed and announced together.
+    mPublisher.BeginBatch();
+    inBatch = true;
+
+    if (publishHost)
+    {
+        otbrLog(OTBR_LOG_INFO, "[adproxy] publish SRP host: %s", fullHostName);
+        IndexUpdate(aId, hostName);
+        SuccessOrExit(error = mPublisher.PublishHost(hostName.c_str(), hostAddresses));
+    }
+    else if (hostDeleted)
     {
         otbrLog(OTBR_LOG_INFO, "[adproxy] unpublish SRP host: %s", fullHostName);
         SuccessOrExit(error = mPublisher.UnpublishHost(hostName.c_str()));
     }
 
-    service = nullptr;
-    while ((service = otSrpServerHostGetNextService(aHost, service)) != nullptr)
+    for (const otSrpServerService *publishService : publishServices)
     {
-        const char *fullServiceName = otSrpServerServiceGetFullName(service);
-        std::string serviceName;
-        std::string serviceType;
-        std::string serviceDomain;
+        const char *             fullServiceName = otSrpServerServiceGetFullName(publishService);
+        Mdns::Publisher::TxtList txtList         = MakeTxtList(publishService);
+        std::string              serviceName;
+        std::string              serviceType;
+        std::string              serviceDomain;
 
         SuccessOrExit(error = SplitFullServiceName(fullServiceName, serviceName, serviceType, serviceDomain));
 
-        update->mServiceNames.emplace_back(serviceName, serviceType);
+        otbrLog(OTBR_LOG_INFO, "[adproxy] publish SRP service: %s", fullServiceName);
+        IndexUpdate(aId, Mdns::Publisher::MakeServiceKey(serviceName.c_str(), serviceType.c_str()));
+        SuccessOrExit(error = mPublisher.PublishService(hostName.c_str(), otSrpServerServiceGetPort(publishService),
+                                                        serviceName.c_str(), serviceType.c_str(), txtList));
+    }
+
+    for (const otSrpServerService *updateTxtService : updateTxtServices)
+    {
+        const char *             fullServiceName = otSrpServerServiceGetFullName(updateTxtService);
+        Mdns::Publisher::TxtList txtList         = MakeTxtList(updateTxtService);
+        std::string              serviceName;
+        std::string              serviceType;
+        std::string              serviceDomain;
+
+        SuccessOrExit(error = SplitFullServiceName(fullServiceName, serviceName, serviceType, serviceDomain));
+
+        otbrLog(OTBR_LOG_INFO, "[adproxy] update TXT of SRP service: %s", fullServiceName);
+        SuccessOrExit(error = mPublisher.UpdateServiceTxt(serviceName.c_str(), serviceType.c_str(), txtList));
+    }
+
+    for (const PublishedService &unpublishService : unpublishServices)
+    {
+        otbrLog(OTBR_LOG_INFO, "[adproxy] unpublish SRP service: %s.%s", unpublishService.mName.c_str(),
+                unpublishService.mType.c_str());
+        SuccessOrExit(error = mPublisher.UnpublishService(unpublishService.mName.c_str(),
+                                                          unpublishService.mType.c_str()));
+    }
+
+exit:
+    if (inBatch)
+    {
+        otbrError commitError = mPublisher.CommitBatch();
+
+        error = (error != OTBR_ERROR_NONE) ? error : commitError;
+    }
+
+    if (host != nullptr)
+    {
+        HandleUpdateStarted(aId, error);
+    }
+}
+
+void AdvertisingProxy::StartRestoredUpdate(UpdateId aId)
+{
+    otbrError          error    = OTBR_ERROR_NONE;
+    OutstandingUpdate &update   = mOutstandingUpdates[aId];
+    std::string        hostName = update.mHostName;
+    auto               stored   = mStateStore.GetHosts().find(hostName);
+    bool               inBatch  = false;
+
+    VerifyOrExit(stored != mStateStore.GetHosts().end(), error = OTBR_ERROR_NOT_FOUND);
+
+    otbrLog(OTBR_LOG_INFO, "[adproxy] restore SRP host: %s", hostName.c_str());
+
+    {
+        PublishedHost &published = mPublishedHosts[hostName];
+
+        published.mAddresses = {stored->second.mAddress};
+        published.mServices.clear();
 
-        if (!hostDeleted && !otSrpServerServiceIsDeleted(service))
+        for (const PublishedService &service : stored->second.mServices)
         {
-            Mdns::Publisher::TxtList txtList = MakeTxtList(service);
+            published.mServices[Mdns::Publisher::MakeServiceKey(service.mName.c_str(), service.mType.c_str())] =
+                service;
+        }
+    }
+
+    update.mCount = 1 + static_cast<uint32_t>(stored->second.mServices.size());
+
+    mPublisher.BeginBatch();
+    inBatch = true;
 
-            otbrLog(OTBR_LOG_INFO, "[adproxy] publish SRP service: %s", fullServiceName);
-            SuccessOrExit(error = mPublisher.PublishService(hostName.c_str(), otSrpServerServiceGetPort(service),
-                                                            serviceName.c_str(), serviceType.c_str(), txtList));
+    IndexUpdate(aId, hostName);
+    SuccessOrExit(error = mPublisher.PublishHost(hostName.c_str(), {stored->second.mAddress}));
+
+    for (const PublishedService &service : stored->second.mServices)
+    {
+        Mdns::Publisher::TxtList txtList = MakeTxtList(service.mTxtData);
+
+        IndexUpdate(aId, Mdns::Publisher::MakeServiceKey(service.mName.c_str(), service.mType.c_str()));
+        SuccessOrExit(error = mPublisher.PublishService(hostName.c_str(), service.mPort, service.mName.c_str(),
+                                                        service.mType.c_str(), txtList));
+    }
+
+exit:
+    if (inBatch)
+    {
+        otbrError commitError = mPublisher.CommitBatch();
+
+        error = (error != OTBR_ERROR_NONE) ? error : commitError;
+    }
+
+    HandleUpdateStarted(aId, error);
+}
+
+void AdvertisingProxy::HandleUpdateStarted(UpdateId aId, otbrError aError)
+{
+    auto update = mOutstandingUpdates.find(aId);
+
+    // A publisher may have reported all results synchronously, which completed the update already.
+    VerifyOrExit(update != mOutstandingUpdates.end());
+
+    if (aError != OTBR_ERROR_NONE || update->second.mCount == 0)
+    {
+        if (aError != OTBR_ERROR_NONE)
+        {
+            otbrLog(OTBR_LOG_INFO, "[adproxy] failed to advertise SRP service updates of host %s",
+                    update->second.mHostName.c_str());
         }
-        else
+
+        CompleteUpdate(aId, OtbrErrorToOtError(aError));
+    }
+    else
+    {
+        update->second.mInFlight = true;
+        ++mInFlightCount;
+    }
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::RestorePublications(void)
+{
+    const char *             path = InstanceParams::Get().GetSrpStateFile();
+    std::vector<std::string> hostNames;
+
+    VerifyOrExit(path != nullptr && path[0] != '\0');
+    VerifyOrExit(mStateStore.Open(path, GetWallClockSeconds()) == OTBR_ERROR_NONE);
+
+    for (const auto &host : mStateStore.GetHosts())
+    {
+        hostNames.push_back(host.first);
+
+        if (mHostHandler != nullptr)
         {
-            otbrLog(OTBR_LOG_INFO, "[adproxy] unpublish SRP service: %s", fullServiceName);
-            SuccessOrExit(error = mPublisher.UnpublishService(serviceName.c_str(), serviceType.c_str()));
+            mHostHandler(host.first, &host.second);
         }
     }
 
+    QueueRestoredHosts(hostNames);
+
 exit:
-    if (error != OTBR_ERROR_NONE || update->mCount == 0)
+    return;
+}
+
+void AdvertisingProxy::RestoreHosts(const SrpStateStore::Hosts &aHosts)
+{
+    uint64_t                 now = GetWallClockSeconds();
+    std::vector<std::string> hostNames;
+
+    for (const auto &host : aHosts)
     {
-        if (error != OTBR_ERROR_NONE)
+        auto stored = mStateStore.GetHosts().find(host.first);
+
+        if (host.second.mExpireTime <= now || mPublishedHosts.count(host.first) != 0 ||
+            (stored != mStateStore.GetHosts().end() && stored->second.mExpireTime >= host.second.mExpireTime))
+        {
+            continue;
+        }
+
+        mStateStore.SaveHost(host.first, host.second);
+
+        if (mHostHandler != nullptr)
         {
-            otbrLog(OTBR_LOG_INFO, "[adproxy] failed to advertise SRP service updates %p", aHost);
+            mHostHandler(host.first, &host.second);
         }
 
-        mOutstandingUpdates.pop_back();
-        otSrpServerHandleServiceUpdateResult(GetInstance(), aHost, OtbrErrorToOtError(error));
+        // A restored update already queued for the host publishes the host just saved.
+        if (mQueuedUpdateIds.count(host.first) == 0)
+        {
+            hostNames.push_back(host.first);
+        }
     }
+
+    QueueRestoredHosts(hostNames);
 }
 
-void AdvertisingProxy::PublishServiceHandler(const char *aName, const char *aType, otbrError aError, void *aContext)
+void AdvertisingProxy::QueueRestoredHosts(const std::vector<std::string> &aHostNames)
 {
-    static_cast<AdvertisingProxy *>(aContext)->PublishServiceHandler(aName, aType, aError);
+    std::vector<std::pair<uint64_t, std::string>> hosts;
+
+    for (const std::string &hostName : aHostNames)
+    {
+        hosts.emplace_back(mStateStore.GetHosts().at(hostName).mExpireTime, hostName);
+    }
+
+    // Hosts which were refreshed most recently are the most likely to be alive, they are republished first.
+    std::sort(hosts.begin(), hosts.end(), std::greater<std::pair<uint64_t, std::string>>());
+
+    // Restored hosts are paced through the publish queue like renewals, and each is given up after
+    // `kRestoreTimeout` instead of an SRP update timeout.
+    for (const auto &host : hosts)
+    {
+        UpdateId           updateId    = mNextUpdateId++;
+        OutstandingUpdate &update      = mOutstandingUpdates[updateId];
+        auto               timeoutTime = std::chrono::steady_clock::now() + kRestoreTimeout;
+
+        update.mHostName     = host.second;
+        update.mQueued       = true;
+        update.mTimeoutTimer = mNcp.PostTimerTask(timeoutTime, [this, updateId]() { HandleUpdateTimeout(updateId); });
+
+        mQueuedUpdateIds[host.second] = updateId;
+        mPendingRenewals.push_back(updateId);
+        mRestoredHosts.insert(host.second);
+    }
+
+    otbrLog(OTBR_LOG_INFO, "[adproxy] restoring %zu SRP hosts", hosts.size());
+
+    ScheduleRestoreExpiry();
+    ProcessPendingUpdates();
 }
 
-void AdvertisingProxy::PublishServiceHandler(const char *aName, const char *aType, otbrError aError)
+void AdvertisingProxy::ScheduleRestoreExpiry(void)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    uint64_t expireTime = UINT64_MAX;
+    uint64_t now        = GetWallClockSeconds();
 
-    otbrLog(OTBR_LOG_INFO, "[adproxy] handle publish service '%s.%s' result: %d", aName, aType, aError);
+    mRestoreExpiryTimer.Cancel();
 
-    // TODO: there may be same names between two SRP updates.
-    for (auto update = mOutstandingUpdates.begin(); update != mOutstandingUpdates.end(); ++update)
+    for (const std::string &hostName : mRestoredHosts)
     {
-        for (const auto &nameAndType : update->mServiceNames)
+        auto stored = mStateStore.GetHosts().find(hostName);
+
+        if (stored != mStateStore.GetHosts().end())
         {
-            if (aName != nameAndType.first || !Mdns::Publisher::IsServiceTypeEqual(aType, nameAndType.second.c_str()))
-            {
-                continue;
-            }
+            expireTime = std::min(expireTime, stored->second.mExpireTime);
+        }
+    }
 
-            if (aError != OTBR_ERROR_NONE || update->mCount == 1)
-            {
-                otSrpServerHandleServiceUpdateResult(GetInstance(), update->mHost, OtbrErrorToOtError(aError));
-                mOutstandingUpdates.erase(update);
-            }
-            else
+    VerifyOrExit(expireTime != UINT64_MAX);
+
+    mRestoreExpiryTimer = mNcp.PostTimerTask(
+        std::chrono::steady_clock::now() + std::chrono::seconds(expireTime > now ? expireTime - now : 0),
+        [this]() { HandleRestoreExpiry(); });
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::HandleRestoreExpiry(void)
+{
+    MemoryStats::Scope memoryScope(MemoryStats::kSubsystemAdvertisingProxy);
+
+    uint64_t now = GetWallClockSeconds();
+
+    mPublisher.BeginBatch();
+
+    // The SRP clients of these hosts did not come back within their lease, take their records off the LAN.
+    for (auto hostName = mRestoredHosts.begin(); hostName != mRestoredHosts.end();)
+    {
+        auto stored = mStateStore.GetHosts().find(*hostName);
+
+        if (stored != mStateStore.GetHosts().end() && stored->second.mExpireTime > now)
+        {
+            ++hostName;
+            continue;
+        }
+
+        otbrLog(OTBR_LOG_INFO, "[adproxy] lease of restored SRP host %s expired", hostName->c_str());
+
+        if (stored != mStateStore.GetHosts().end())
+        {
+            for (const PublishedService &service : stored->second.mServices)
             {
-                --update->mCount;
+                mPublisher.UnpublishService(service.mName.c_str(), service.mType.c_str());
             }
-            ExitNow();
         }
+
+        mPublisher.UnpublishHost(hostName->c_str());
+        mPublishedHosts.erase(*hostName);
+        RemoveSavedHost(*hostName);
+        hostName = mRestoredHosts.erase(hostName);
+    }
+
+    mPublisher.CommitBatch();
+
+    ScheduleRestoreExpiry();
+}
+
+void AdvertisingProxy::SaveHost(const std::string &aHostName)
+{
+    auto                published = mPublishedHosts.find(aHostName);
+    SrpStateStore::Host host;
+
+    VerifyOrExit(published != mPublishedHosts.end() && !published->second.mAddresses.empty());
+
+    // Only the first address is kept, a restored host is published with it until its SRP client refreshes.
+    host.mAddress    = published->second.mAddresses.front();
+    host.mExpireTime = GetWallClockSeconds() + static_cast<uint64_t>(kSrpLease.count());
+
+    for (const auto &service : published->second.mServices)
+    {
+        host.mServices.push_back(service.second);
+    }
+
+    mStateStore.SaveHost(aHostName, host);
+
+    if (mHostHandler != nullptr)
+    {
+        mHostHandler(aHostName, &host);
     }
 
 exit:
-    if (error != OTBR_ERROR_NONE)
+    return;
+}
+
+void AdvertisingProxy::RemoveSavedHost(const std::string &aHostName)
+{
+    mStateStore.RemoveHost(aHostName);
+
+    if (mHostHandler != nullptr)
     {
-        otbrLog(OTBR_LOG_WARNING, "[adproxy] failed to handle result of service %s", aName);
+        mHostHandler(aHostName, nullptr);
     }
 }
 
-void AdvertisingProxy::PublishHostHandler(const char *aName, otbrError aError, void *aContext)
+void AdvertisingProxy::HandleUpdateFailure(const std::string &aHostName)
 {
-    static_cast<AdvertisingProxy *>(aContext)->PublishHostHandler(aName, aError);
+    // The mDNS state of the host is unknown after a failure, the next update republishes everything.
+    mPublishedHosts.erase(aHostName);
 }
 
-void AdvertisingProxy::PublishHostHandler(const char *aName, otbrError aError)
+void AdvertisingProxy::IndexUpdate(UpdateId aId, const std::string &aKey)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    // When an earlier update is still publishing the same key, the result is credited to the latest update
+    // and the earlier one is left to time out, the SRP client has already replaced it.
+    mUpdateIds[aKey] = aId;
+    mOutstandingUpdates[aId].mKeys.push_back(aKey);
+}
 
-    otbrLog(OTBR_LOG_INFO, "[adproxy] handle publish host '%s' result: %d", aName, aError);
+void AdvertisingProxy::RemoveUpdate(UpdateId aId)
+{
+    auto update = mOutstandingUpdates.find(aId);
+
+    VerifyOrExit(update != mOutstandingUpdates.end());
 
-    for (auto update = mOutstandingUpdates.begin(); update != mOutstandingUpdates.end(); ++update)
+    for (const std::string &key : update->second.mKeys)
     {
-        if (aName != update->mHostName)
+        auto indexed = mUpdateIds.find(key);
+
+        if (indexed != mUpdateIds.end() && indexed->second == aId)
         {
-            continue;
+            mUpdateIds.erase(indexed);
         }
+    }
+
+    if (update->second.mQueued)
+    {
+        mQueuedUpdateIds.erase(update->second.mHostName);
+    }
+
+    if (update->second.mInFlight)
+    {
+        --mInFlightCount;
+    }
+
+    update->second.mTimeoutTimer.Cancel();
+    mOutstandingUpdates.erase(update);
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::HandleUpdateTimeout(UpdateId aId)
+{
+    MemoryStats::Scope memoryScope(MemoryStats::kSubsystemAdvertisingProxy);
+
+    auto update = mOutstandingUpdates.find(aId);
+
+    VerifyOrExit(update != mOutstandingUpdates.end());
+
+    otbrLog(OTBR_LOG_WARNING, "[adproxy] SRP service updates of host %s timed out%s",
+            update->second.mHostName.c_str(), update->second.mQueued ? " in the queue" : "");
+    CompleteUpdate(aId, OT_ERROR_RESPONSE_TIMEOUT);
+
+exit:
+    return;
+}
 
-        if (aError != OTBR_ERROR_NONE || update->mCount == 1)
+void AdvertisingProxy::CompleteUpdate(UpdateId aId, otError aError)
+{
+    auto                  update = mOutstandingUpdates.find(aId);
+    std::vector<UpdateId> ids;
+
+    VerifyOrExit(update != mOutstandingUpdates.end());
+
+    if (aError != OT_ERROR_NONE)
+    {
+        HandleUpdateFailure(update->second.mHostName);
+    }
+
+    // The superseded updates of the host share the result of this update, they are reported first and in order,
+    // so the SRP server commits the latest host state last.
+    ids = std::move(update->second.mMergedIds);
+    ids.push_back(aId);
+
+    for (UpdateId id : ids)
+    {
+        auto                   completed = mOutstandingUpdates.find(id);
+        const otSrpServerHost *host;
+
+        if (completed == mOutstandingUpdates.end())
         {
-            otSrpServerHandleServiceUpdateResult(GetInstance(), update->mHost, OtbrErrorToOtError(aError));
-            mOutstandingUpdates.erase(update);
+            continue;
         }
-        else
+
+        host = completed->second.mHost;
+        RemoveUpdate(id);
+        Trace::Get().Log(Trace::kEventSrpUpdateResult, id, static_cast<uint32_t>(aError));
+        OTBR_USDT2(srp_update_done, id, aError);
+
+        // Restored hosts have no SRP update to report.
+        if (host != nullptr)
         {
-            --update->mCount;
+            HandleUpdateResult(host, aError);
         }
-        ExitNow();
     }
 
+    ProcessPendingUpdates();
+
 exit:
-    if (error != OTBR_ERROR_NONE)
+    return;
+}
+
+void AdvertisingProxy::HandlePublishResult(const std::string &aKey, otbrError aError)
+{
+    auto               indexed = mUpdateIds.find(aKey);
+    UpdateId           updateId;
+    OutstandingUpdate *update;
+
+    VerifyOrExit(indexed != mUpdateIds.end());
+
+    updateId = indexed->second;
+    mUpdateIds.erase(indexed);
+    update = &mOutstandingUpdates[updateId];
+
+    if (aError != OTBR_ERROR_NONE || update->mCount == 1)
+    {
+        CompleteUpdate(updateId, OtbrErrorToOtError(aError));
+    }
+    else
     {
-        otbrLog(OTBR_LOG_WARNING, "[adproxy] failed to handle result of host %s", aName);
+        --update->mCount;
+    }
+
+exit:
+    return;
+}
+
+void AdvertisingProxy::HandleUpdateResult(const otSrpServerHost *aHost, otError aError)
+{
+    switch (aError)
+    {
+    case OT_ERROR_NONE:
+        Metrics::Get().Increment(Metrics::kCounterSrpUpdateSuccess);
+        break;
+
+    case OT_ERROR_RESPONSE_TIMEOUT:
+        Metrics::Get().Increment(Metrics::kCounterSrpUpdateTimeout);
+        break;
+
+    default:
+        Metrics::Get().Increment(Metrics::kCounterSrpUpdateFailure);
+        break;
     }
+
+    otSrpServerHandleServiceUpdateResult(GetInstance(), aHost, aError);
+}
+
+void AdvertisingProxy::PublishServiceHandler(const char *aName, const char *aType, otbrError aError, void *aContext)
+{
+    static_cast<AdvertisingProxy *>(aContext)->PublishServiceHandler(aName, aType, aError);
+}
+
+void AdvertisingProxy::PublishServiceHandler(const char *aName, const char *aType, otbrError aError)
+{
+    MemoryStats::Scope memoryScope(MemoryStats::kSubsystemAdvertisingProxy);
+
+    otbrLog(OTBR_LOG_INFO, "[adproxy] handle publish service '%s.%s' result: %d", aName, aType, aError);
+
+    HandlePublishResult(Mdns::Publisher::MakeServiceKey(aName, aType), aError);
+}
+
+void AdvertisingProxy::PublishHostHandler(const char *aName, otbrError aError, void *aContext)
+{
+    static_cast<AdvertisingProxy *>(aContext)->PublishHostHandler(aName, aError);
+}
+
+void AdvertisingProxy::PublishHostHandler(const char *aName, otbrError aError)
+{
+    MemoryStats::Scope memoryScope(MemoryStats::kSubsystemAdvertisingProxy);
+
+    otbrLog(OTBR_LOG_INFO, "[adproxy] handle publish host '%s' result: %d", aName, aError);
+
+    HandlePublishResult(aName, aError);
 }
 
 Mdns::Publisher::TxtList AdvertisingProxy::MakeTxtList(const otSrpServerService *aSrpService)
@@ -318,6 +953,62 @@ Mdns::Publisher::TxtList AdvertisingProxy::MakeTxtList(const otSrpServerService
     return txtList;
 }
 
+Mdns::Publisher::TxtList AdvertisingProxy::MakeTxtList(const std::vector<uint8_t> &aTxtData)
+{
+    Mdns::Publisher::TxtList txtList;
+    size_t                   offset = 0;
+
+    // The entries point into @p aTxtData, see `MakeTxtData()` for the format.
+    while (offset < aTxtData.size())
+    {
+        size_t         length = aTxtData[offset++];
+        const uint8_t *entry  = &aTxtData[offset];
+        size_t         nameLength;
+
+        VerifyOrExit(length <= aTxtData.size() - offset);
+        offset += length;
+
+        for (nameLength = 0; nameLength < length && entry[nameLength] != '='; ++nameLength)
+        {
+        }
+
+        VerifyOrExit(nameLength > 0 && nameLength < length);
+        txtList.emplace_back(reinterpret_cast<const char *>(entry), nameLength, entry + nameLength + 1,
+                             length - nameLength - 1);
+    }
+
+exit:
+    return txtList;
+}
+
+std::vector<uint8_t> AdvertisingProxy::MakeTxtData(const Mdns::Publisher::TxtList &aTxtList)
+{
+    std::vector<uint8_t> txtData;
+    size_t               length = 0;
+    uint16_t             txtLength;
+
+    for (const auto &txtEntry : aTxtList)
+    {
+        // One length byte, the name, '=' and the value.
+        length += 1 + txtEntry.mNameLength + 1 + txtEntry.mValueLength;
+    }
+
+    txtData.resize(length);
+    txtLength = static_cast<uint16_t>(length);
+
+    // An entry which cannot be encoded leaves the TXT data empty, it is then compared as an empty TXT record.
+    if (Mdns::Publisher::EncodeTxtData(aTxtList, txtData.data(), txtLength) == OTBR_ERROR_NONE)
+    {
+        txtData.resize(txtLength);
+    }
+    else
+    {
+        txtData.clear();
+    }
+
+    return txtData;
+}
+
 } // namespace otbr
 
 #endif // OTBR_ENABLE_SRP_ADVERTISING_PROXY
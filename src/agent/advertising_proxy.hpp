@@ -38,10 +38,20 @@
 
 #include <stdint.h>
 
+#include <deque>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 #include <openthread/instance.h>
 #include <openthread/srp_server.h>
 
 #include "agent/ncp_openthread.hpp"
+#include "agent/srp_state_store.hpp"
+#include "common/timer_wheel.hpp"
+#include "common/types.hpp"
 #include "mdns/mdns.hpp"
 
 namespace otbr {
@@ -77,27 +87,95 @@ public:
      */
     void Stop();
 
+    /**
+     * This method registers the SRP server handler again after the NCP is soft reset.
+     *
+     */
+    void HandleSoftReset(void);
+
+    /**
+     * This function is called when a published SRP host is saved or removed.
+     *
+     * @param[in]   aHostName   The host name.
+     * @param[in]   aHost       The saved host, or nullptr if the host was removed.
+     *
+     */
+    typedef std::function<void(const std::string &aHostName, const SrpStateStore::Host *aHost)> HostHandler;
+
+    /**
+     * This method sets the handler called when a published SRP host is saved or removed.
+     *
+     * The hosts republished from the SRP state file are reported when the Advertising Proxy starts.
+     *
+     * @param[in]   aHandler    The handler, nullptr to not report SRP hosts.
+     *
+     */
+    void SetHostHandler(HostHandler aHandler) { mHostHandler = std::move(aHandler); }
+
+    /**
+     * This method republishes the SRP hosts another agent published, until their SRP clients update them here.
+     *
+     * Hosts whose lease expired, which are already published or which are saved with a later lease are skipped.
+     *
+     * @param[in]   aHosts  The SRP hosts by host name.
+     *
+     */
+    void RestoreHosts(const SrpStateStore::Hosts &aHosts);
+
 private:
+    typedef uint64_t UpdateId;
+
     struct OutstandingUpdate
     {
-        typedef std::vector<std::pair<std::string, std::string>> ServiceNameList;
+        const otSrpServerHost *  mHost = nullptr;   // The SRP host being published, null if restored.
+        std::string              mHostName;         // The host name.
+        std::vector<std::string> mKeys;             // The publication keys still indexed in `mUpdateIds`.
+        std::vector<UpdateId>    mMergedIds;        // The superseded updates of the host completed with this one.
+        uint32_t                 mCount    = 0;     // The number of outstanding updates.
+        bool                     mQueued   = false; // Whether the update waits in the publish queue.
+        bool                     mInFlight = false; // Whether the update waits for publish results.
+        TimerWheel::Handle       mTimeoutTimer;     // The timer to give up the update.
+    };
+
+    typedef SrpStateStore::Service PublishedService;
 
-        const otSrpServerHost *mHost = nullptr; // The SRP host which being published.
-        std::string            mHostName;       // The host name.
-        ServiceNameList        mServiceNames;   // The list of service instance and name pair.
-        uint32_t               mCount = 0;      // The number of outstanding updates.
+    struct PublishedHost
+    {
+        Mdns::Publisher::AddressList                      mAddresses; // The published host addresses.
+        std::unordered_map<std::string, PublishedService> mServices;  // The published services by service key.
     };
 
     static void AdvertisingHandler(const otSrpServerHost *aHost, uint32_t aTimeout, void *aContext);
     void        AdvertisingHandler(const otSrpServerHost *aHost, uint32_t aTimeout);
 
     static Mdns::Publisher::TxtList MakeTxtList(const otSrpServerService *aSrpService);
+    static Mdns::Publisher::TxtList MakeTxtList(const std::vector<uint8_t> &aTxtData);
+    static std::vector<uint8_t>     MakeTxtData(const Mdns::Publisher::TxtList &aTxtList);
 
     static void PublishServiceHandler(const char *aName, const char *aType, otbrError aError, void *aContext);
     void        PublishServiceHandler(const char *aName, const char *aType, otbrError aError);
     static void PublishHostHandler(const char *aName, otbrError aError, void *aContext);
     void        PublishHostHandler(const char *aName, otbrError aError);
 
+    void ProcessPendingUpdates(void);
+    void StartUpdate(UpdateId aId);
+    void StartRestoredUpdate(UpdateId aId);
+    void HandleUpdateStarted(UpdateId aId, otbrError aError);
+    void CompleteUpdate(UpdateId aId, otError aError);
+    void IndexUpdate(UpdateId aId, const std::string &aKey);
+    void HandlePublishResult(const std::string &aKey, otbrError aError);
+    void RemoveUpdate(UpdateId aId);
+    void HandleUpdateTimeout(UpdateId aId);
+    void HandleUpdateResult(const otSrpServerHost *aHost, otError aError);
+    void HandleUpdateFailure(const std::string &aHostName);
+
+    void RestorePublications(void);
+    void QueueRestoredHosts(const std::vector<std::string> &aHostNames);
+    void ScheduleRestoreExpiry(void);
+    void HandleRestoreExpiry(void);
+    void SaveHost(const std::string &aHostName);
+    void RemoveSavedHost(const std::string &aHostName);
+
     otInstance *GetInstance(void) { return mNcp.GetInstance(); }
 
     // A reference to the NCP controller, has no ownership.
@@ -106,8 +184,34 @@ private:
     // A reference to the mDNS publisher, has no ownership.
     Mdns::Publisher &mPublisher;
 
-    // A vector that tracks outstanding updates.
-    std::vector<OutstandingUpdate> mOutstandingUpdates;
+    // The outstanding updates by their ids, the ids are never reused so a stale timer cannot match a newer update.
+    std::unordered_map<UpdateId, OutstandingUpdate> mOutstandingUpdates;
+
+    // The outstanding update of each publication key, see `Mdns::Publisher::MakeServiceKey()`.
+    std::unordered_map<std::string, UpdateId> mUpdateIds;
+
+    // What has been published for each SRP host, so that an update only passes its diff to the mDNS publisher.
+    std::unordered_map<std::string, PublishedHost> mPublishedHosts;
+
+    // The updates waiting for a free publish slot, new hosts are started before renewals of published hosts.
+    std::deque<UpdateId> mPendingNewHosts;
+    std::deque<UpdateId> mPendingRenewals;
+
+    // The queued update of each host name, a newer update of the host supersedes it.
+    std::unordered_map<std::string, UpdateId> mQueuedUpdateIds;
+
+    // The published hosts and services saved across restarts of the agent.
+    SrpStateStore mStateStore;
+
+    // The hosts republished from `mStateStore` whose SRP client has not updated them since.
+    std::unordered_set<std::string> mRestoredHosts;
+    TimerWheel::Handle              mRestoreExpiryTimer;
+
+    HostHandler mHostHandler;
+
+    UpdateId mNextUpdateId;
+    uint32_t mInFlightCount;
+    bool     mProcessingPending;
 };
 
 } // namespace otbr
@@ -37,6 +37,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "utils/system_utils.hpp"
 
 namespace otbr {
 
@@ -64,12 +65,14 @@ void AgentInstance::UpdateFdSet(otSysMainloopContext &aMainloop)
     mNcp->UpdateFdSet(aMainloop);
     mBorderAgent.UpdateFdSet(aMainloop.mReadFdSet, aMainloop.mWriteFdSet, aMainloop.mErrorFdSet, aMainloop.mMaxFd,
                              aMainloop.mTimeout);
+    SystemUtils::CommandRunner::Get().UpdateFdSet(aMainloop);
 }
 
 void AgentInstance::Process(const otSysMainloopContext &aMainloop)
 {
     mNcp->Process(aMainloop);
     mBorderAgent.Process(aMainloop.mReadFdSet, aMainloop.mWriteFdSet, aMainloop.mErrorFdSet);
+    SystemUtils::CommandRunner::Get().Process(aMainloop);
 }
 
 AgentInstance::~AgentInstance(void)
@@ -89,6 +89,12 @@ public:
      */
     void Process(const otSysMainloopContext &aMainloop);
 
+    /**
+     * This method moves the services bound to the backbone interface to the one in `InstanceParams`.
+     *
+     */
+    void HandleBackboneInterfaceChanged(void) { mBorderAgent.HandleBackboneInterfaceChanged(); }
+
     /**
      * This method return mNcp pointer.
      *
@@ -62,6 +62,8 @@ static const uint16_t kThreadVersion12 = 3; ///< Thread Version 1.2
 
 static const char kBorderAgentServiceType[] = "_meshcop._udp."; ///< Border agent service type of mDNS
 
+static constexpr std::chrono::milliseconds kPublishServiceDelay(200); ///< Window to collect dataset changes in.
+
 /**
  * Locators
  *
@@ -88,12 +90,17 @@ BorderAgent::BorderAgent(Ncp::Controller *aNcp)
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
     , mAdvertisingProxy(*reinterpret_cast<Ncp::ControllerOpenThread *>(aNcp), *mPublisher)
 #endif
+#if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+    , mDiscoveryProxy(*reinterpret_cast<Ncp::ControllerOpenThread *>(aNcp), *mPublisher)
+#endif
 #else
     , mPublisher(nullptr)
 #endif
 #if OTBR_ENABLE_BACKBONE_ROUTER
     , mBackboneAgent(*reinterpret_cast<Ncp::ControllerOpenThread *>(aNcp))
 #endif
+    , mStateSync(*reinterpret_cast<Ncp::ControllerOpenThread *>(aNcp))
+    , mFrameCapture(*reinterpret_cast<Ncp::ControllerOpenThread *>(aNcp))
     , mThreadStarted(false)
 {
 }
@@ -106,17 +113,26 @@ void BorderAgent::Init(void)
     mThreadVersion       = 0;
 
 #if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
-    mNcp->On(Ncp::kEventExtPanId, HandleExtPanId, this);
-    mNcp->On(Ncp::kEventNetworkName, HandleNetworkName, this);
-    mNcp->On(Ncp::kEventThreadVersion, HandleThreadVersion, this);
+    mNcp->On<Ncp::kEventExtPanId>(HandleExtPanId, this);
+    mNcp->On<Ncp::kEventNetworkName>(HandleNetworkName, this);
+    mNcp->On<Ncp::kEventThreadVersion>(HandleThreadVersion, this);
 #endif
-    mNcp->On(Ncp::kEventThreadState, HandleThreadState, this);
-    mNcp->On(Ncp::kEventPSKc, HandlePSKc, this);
+    mNcp->On<Ncp::kEventThreadState>(HandleThreadState, this);
+    mNcp->On<Ncp::kEventPSKc>(HandlePSKc, this);
+    static_cast<Ncp::ControllerOpenThread *>(mNcp)->RegisterSoftResetHandler([this]() { HandleNcpSoftReset(); });
 
 #if OTBR_ENABLE_BACKBONE_ROUTER
     mBackboneAgent.Init();
 #endif
 
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    mAdvertisingProxy.SetHostHandler([this](const std::string &aHostName, const SrpStateStore::Host *aHost) {
+        mStateSync.HandleHostChanged(aHostName, aHost);
+    });
+#endif
+    mStateSync.Init([this](const SyncJournal::State &aState) { HandleStandbyPromoted(aState); });
+    mFrameCapture.Init();
+
     otbrLogResult(mNcp->RequestEvent(Ncp::kEventThreadState), "Check if Thread is up");
     otbrLogResult(mNcp->RequestEvent(Ncp::kEventPSKc), "Check if PSKc is initialized");
 }
@@ -137,9 +153,13 @@ otbrError BorderAgent::Start(void)
 
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
     mAdvertisingProxy.Start();
+    RestoreSyncedHosts();
+#endif
+#if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+    mDiscoveryProxy.Start();
 #endif
 
-    StartPublishService();
+    SchedulePublishService();
 #endif // OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
 
     // Suppress unused warning of label exit
@@ -153,10 +173,14 @@ exit:
 void BorderAgent::Stop(void)
 {
 #if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
+    mPublishTimer.Cancel();
     StopPublishService();
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
     mAdvertisingProxy.Stop();
 #endif
+#if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+    mDiscoveryProxy.Stop();
+#endif
 #endif
 }
 
@@ -176,6 +200,8 @@ void BorderAgent::HandleMdnsState(Mdns::Publisher::State aState)
     switch (aState)
     {
     case Mdns::Publisher::State::kReady:
+        // The registrations do not survive a restart of the publisher, so the service is published even if unchanged.
+        mPublishedTxt.clear();
         PublishService();
         break;
     default:
@@ -200,11 +226,21 @@ void BorderAgent::UpdateFdSet(fd_set & aReadFdSet,
     }
 }
 
+void BorderAgent::HandleBackboneInterfaceChanged(void)
+{
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    mBackboneAgent.HandleBackboneInterfaceChanged();
+#endif
+}
+
 void BorderAgent::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
 {
 #if OTBR_ENABLE_BACKBONE_ROUTER
     mBackboneAgent.Process(aReadFdSet, aWriteFdSet, aErrorFdSet);
 #endif
+    mStateSync.Process();
+    mFrameCapture.Process();
+
     if (mPublisher != nullptr)
     {
         mPublisher->Process(aReadFdSet, aWriteFdSet, aErrorFdSet);
@@ -232,10 +268,60 @@ void BorderAgent::PublishService(void)
     assert(mThreadVersion != 0);
 
     const char *             versionString = ThreadVersionToString(mThreadVersion);
-    Mdns::Publisher::TxtList txtList{{"nn", mNetworkName}, {"xp", mExtPanId, sizeof(mExtPanId)}, {"tv", versionString}};
+    Mdns::Publisher::TxtList txtList;
+    std::string              txtData;
+
+    for (const std::string &entry : mTxtEntries)
+    {
+        txtData += entry;
+    }
 
-    mPublisher->PublishService(/* aHostName */ nullptr, kBorderAgentUdpPort, mNetworkName, kBorderAgentServiceType,
-                               txtList);
+    // Most dataset changes leave the network name, extended PAN ID and Thread version as they were.
+    if (mPublishedName == mNetworkName && mPublishedTxt == txtData)
+    {
+        otbrLog(OTBR_LOG_DEBUG, "MeshCoP service is up to date");
+        ExitNow();
+    }
+
+    // The service instance is named after the network, a new name replaces the instance published with the old one.
+    if (!mPublishedName.empty() && mPublishedName != mNetworkName)
+    {
+        mPublisher->UnpublishService(mPublishedName.c_str(), kBorderAgentServiceType);
+        mPublishedName.clear();
+    }
+
+    txtList = {{"nn", mNetworkName}, {"xp", mExtPanId, sizeof(mExtPanId)}, {"tv", versionString}};
+
+    // Only the TXT record changes while the network name stays the same, update it in place to avoid
+    // re-registering the service.
+    if (mPublishedName.empty() ||
+        mPublisher->UpdateServiceTxt(mNetworkName, kBorderAgentServiceType, txtList) != OTBR_ERROR_NONE)
+    {
+        mPublisher->PublishService(/* aHostName */ nullptr, kBorderAgentUdpPort, mNetworkName, kBorderAgentServiceType,
+                                   txtList);
+    }
+
+    mPublishedName = mNetworkName;
+    mPublishedTxt  = std::move(txtData);
+
+exit:
+    return;
+}
+
+void BorderAgent::SchedulePublishService(void)
+{
+    auto publishTime = std::chrono::steady_clock::now() + kPublishServiceDelay;
+
+    // A dataset change emits several events back-to-back, so the service is published once they settle, from the
+    // final network name, extended PAN ID and Thread version.
+    VerifyOrExit(mThreadStarted);
+    VerifyOrExit(!mPublishTimer.Reschedule(publishTime));
+
+    mPublishTimer = static_cast<Ncp::ControllerOpenThread *>(mNcp)->PostTimerTask(
+        publishTime, [this]() { StartPublishService(); });
+
+exit:
+    return;
 }
 
 void BorderAgent::StartPublishService(void)
@@ -266,54 +352,74 @@ void BorderAgent::StopPublishService(void)
         mPublisher->Stop();
     }
 
+    mPublishedName.clear();
+    mPublishedTxt.clear();
+
 exit:
     otbrLog(OTBR_LOG_INFO, "Stop publishing service");
 }
 
+void BorderAgent::SetTxtEntry(uint8_t aIndex, const char *aKey, const void *aValue, size_t aValueLength)
+{
+    std::string &entry = mTxtEntries[aIndex];
+
+    // The entry is encoded once here, as Mdns::Publisher::EncodeTxtData() would, rather than at each publication.
+    entry.assign(1, static_cast<char>(strlen(aKey) + 1 + aValueLength));
+    entry.append(aKey);
+    entry.push_back('=');
+    entry.append(static_cast<const char *>(aValue), aValueLength);
+}
+
 void BorderAgent::SetNetworkName(const char *aNetworkName)
 {
-    strcpy_safe(mNetworkName, sizeof(mNetworkName), aNetworkName);
+    VerifyOrExit(strcmp(mNetworkName, aNetworkName) != 0);
 
+    strcpy_safe(mNetworkName, sizeof(mNetworkName), aNetworkName);
 #if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
-    if (mThreadStarted)
-    {
-        // Restart publisher to publish new service name.
-        mPublisher->Stop();
-        StartPublishService();
-    }
+    SetTxtEntry(kTxtNetworkName, "nn", mNetworkName, strlen(mNetworkName));
+    SchedulePublishService();
 #endif
+
+exit:
+    return;
 }
 
 void BorderAgent::SetExtPanId(const uint8_t *aExtPanId)
 {
+    VerifyOrExit(!mExtPanIdInitialized || memcmp(mExtPanId, aExtPanId, sizeof(mExtPanId)) != 0);
+
     memcpy(mExtPanId, aExtPanId, sizeof(mExtPanId));
     mExtPanIdInitialized = true;
 #if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
-    if (mThreadStarted)
-    {
-        StartPublishService();
-    }
+    SetTxtEntry(kTxtExtPanId, "xp", mExtPanId, sizeof(mExtPanId));
+    SchedulePublishService();
 #endif
+
+exit:
+    return;
 }
 
 void BorderAgent::SetThreadVersion(uint16_t aThreadVersion)
 {
+    VerifyOrExit(mThreadVersion != aThreadVersion);
+
     mThreadVersion = aThreadVersion;
 #if OTBR_ENABLE_MDNS_AVAHI || OTBR_ENABLE_MDNS_MDNSSD || OTBR_ENABLE_MDNS_MOJO
-    if (mThreadStarted)
     {
-        StartPublishService();
+        const char *versionString = ThreadVersionToString(mThreadVersion);
+
+        SetTxtEntry(kTxtThreadVersion, "tv", versionString, strlen(versionString));
     }
+    SchedulePublishService();
 #endif
+
+exit:
+    return;
 }
 
-void BorderAgent::HandlePSKc(void *aContext, int aEvent, va_list aArguments)
+void BorderAgent::HandlePSKc(void *aContext, const uint8_t *aPSKc)
 {
-    OT_UNUSED_VARIABLE(aEvent);
-
-    assert(aEvent == Ncp::kEventPSKc);
-
-    static_cast<BorderAgent *>(aContext)->HandlePSKc(va_arg(aArguments, const uint8_t *));
+    static_cast<BorderAgent *>(aContext)->HandlePSKc(aPSKc);
 }
 
 void BorderAgent::HandlePSKc(const uint8_t *aPSKc)
@@ -361,45 +467,71 @@ exit:
     otbrLog(OTBR_LOG_INFO, "Thread is %s", (aStarted ? "up" : "down"));
 }
 
-void BorderAgent::HandleThreadState(void *aContext, int aEvent, va_list aArguments)
+void BorderAgent::HandleStandbyPromoted(const SyncJournal::State &aState)
 {
-    OT_UNUSED_VARIABLE(aEvent);
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    mSyncedHosts = aState.mHosts;
 
-    assert(aEvent == Ncp::kEventThreadState);
+    // Otherwise the hosts are restored when the Advertising Proxy starts.
+    if (mThreadStarted && mPSKcInitialized)
+    {
+        RestoreSyncedHosts();
+    }
+#endif
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    mBackboneAgent.RestoreDuas(aState.mDuas);
+#endif
 
-    int started = va_arg(aArguments, int);
-    static_cast<BorderAgent *>(aContext)->HandleThreadState(started);
+    OT_UNUSED_VARIABLE(aState);
 }
 
-void BorderAgent::HandleNetworkName(void *aContext, int aEvent, va_list aArguments)
+void BorderAgent::RestoreSyncedHosts(void)
 {
-    OT_UNUSED_VARIABLE(aEvent);
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    VerifyOrExit(!mSyncedHosts.empty());
 
-    assert(aEvent == Ncp::kEventNetworkName);
+    mAdvertisingProxy.RestoreHosts(mSyncedHosts);
+    mSyncedHosts.clear();
 
-    const char *networkName = va_arg(aArguments, const char *);
-    static_cast<BorderAgent *>(aContext)->SetNetworkName(networkName);
+exit:
+    return;
+#endif
 }
 
-void BorderAgent::HandleExtPanId(void *aContext, int aEvent, va_list aArguments)
+void BorderAgent::HandleNcpSoftReset(void)
 {
-    OT_UNUSED_VARIABLE(aEvent);
+    // The Thread state is kept across a soft reset, only the OpenThread callbacks are registered again.
+    VerifyOrExit(mThreadStarted && mPSKcInitialized);
 
-    assert(aEvent == Ncp::kEventExtPanId);
+#if OTBR_ENABLE_SRP_ADVERTISING_PROXY
+    mAdvertisingProxy.HandleSoftReset();
+#endif
+#if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+    mDiscoveryProxy.HandleSoftReset();
+#endif
 
-    const uint8_t *xpanid = va_arg(aArguments, const uint8_t *);
-    static_cast<BorderAgent *>(aContext)->SetExtPanId(xpanid);
+exit:
+    return;
 }
 
-void BorderAgent::HandleThreadVersion(void *aContext, int aEvent, va_list aArguments)
+void BorderAgent::HandleThreadState(void *aContext, bool aStarted)
 {
-    OT_UNUSED_VARIABLE(aEvent);
+    static_cast<BorderAgent *>(aContext)->HandleThreadState(aStarted);
+}
 
-    assert(aEvent == Ncp::kEventThreadVersion);
+void BorderAgent::HandleNetworkName(void *aContext, const char *aNetworkName)
+{
+    static_cast<BorderAgent *>(aContext)->SetNetworkName(aNetworkName);
+}
 
-    // `uint16_t` has been promoted to `int`.
-    uint16_t threadVersion = static_cast<uint16_t>(va_arg(aArguments, int));
-    static_cast<BorderAgent *>(aContext)->SetThreadVersion(threadVersion);
+void BorderAgent::HandleExtPanId(void *aContext, const uint8_t *aExtPanId)
+{
+    static_cast<BorderAgent *>(aContext)->SetExtPanId(aExtPanId);
+}
+
+void BorderAgent::HandleThreadVersion(void *aContext, uint16_t aThreadVersion)
+{
+    static_cast<BorderAgent *>(aContext)->SetThreadVersion(aThreadVersion);
 }
 
 } // namespace otbr
@@ -36,9 +36,15 @@
 
 #include <stdint.h>
 
+#include <string>
+
 #include "agent/advertising_proxy.hpp"
+#include "agent/discovery_proxy.hpp"
+#include "agent/frame_capture.hpp"
 #include "agent/instance_params.hpp"
 #include "agent/ncp.hpp"
+#include "agent/state_sync.hpp"
+#include "common/timer_wheel.hpp"
 #include "mdns/mdns.hpp"
 
 #if OTBR_ENABLE_BACKBONE_ROUTER
@@ -101,6 +107,12 @@ public:
      */
     void Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet);
 
+    /**
+     * This method moves the services bound to the backbone interface to the one in `InstanceParams`.
+     *
+     */
+    void HandleBackboneInterfaceChanged(void);
+
 private:
     /**
      * This method starts border agent service.
@@ -123,20 +135,25 @@ private:
     }
     void HandleMdnsState(Mdns::Publisher::State aState);
     void PublishService(void);
+    void SchedulePublishService(void);
     void StartPublishService(void);
     void StopPublishService(void);
+    void SetTxtEntry(uint8_t aIndex, const char *aKey, const void *aValue, size_t aValueLength);
 
     void SetNetworkName(const char *aNetworkName);
     void SetExtPanId(const uint8_t *aExtPanId);
     void SetThreadVersion(uint16_t aThreadVersion);
     void HandleThreadState(bool aStarted);
     void HandlePSKc(const uint8_t *aPSKc);
+    void HandleNcpSoftReset(void);
+    void HandleStandbyPromoted(const SyncJournal::State &aState);
+    void RestoreSyncedHosts(void);
 
-    static void HandlePSKc(void *aContext, int aEvent, va_list aArguments);
-    static void HandleThreadState(void *aContext, int aEvent, va_list aArguments);
-    static void HandleNetworkName(void *aContext, int aEvent, va_list aArguments);
-    static void HandleExtPanId(void *aContext, int aEvent, va_list aArguments);
-    static void HandleThreadVersion(void *aContext, int aEvent, va_list aArguments);
+    static void HandlePSKc(void *aContext, const uint8_t *aPSKc);
+    static void HandleThreadState(void *aContext, bool aStarted);
+    static void HandleNetworkName(void *aContext, const char *aNetworkName);
+    static void HandleExtPanId(void *aContext, const uint8_t *aExtPanId);
+    static void HandleThreadVersion(void *aContext, uint16_t aThreadVersion);
 
     Ncp::Controller *mNcp;
     Mdns::Publisher *mPublisher;
@@ -144,16 +161,35 @@ private:
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
     AdvertisingProxy mAdvertisingProxy;
 #endif
+#if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+    DiscoveryProxy mDiscoveryProxy;
+#endif
 #if OTBR_ENABLE_BACKBONE_ROUTER
     BackboneRouter::BackboneAgent mBackboneAgent;
 #endif
-
-    uint8_t  mExtPanId[kSizeExtPanId];
-    bool     mExtPanIdInitialized;
-    uint16_t mThreadVersion;
-    char     mNetworkName[kSizeNetworkName + 1];
-    bool     mThreadStarted;
-    bool     mPSKcInitialized;
+    StateSync            mStateSync;
+    SrpStateStore::Hosts mSyncedHosts; ///< The SRP hosts taken over from the active agent, until they are restored.
+    FrameCapture         mFrameCapture;
+
+    uint8_t            mExtPanId[kSizeExtPanId];
+    bool               mExtPanIdInitialized;
+    uint16_t           mThreadVersion;
+    char               mNetworkName[kSizeNetworkName + 1];
+    bool               mThreadStarted;
+    bool               mPSKcInitialized;
+    TimerWheel::Handle mPublishTimer;
+    std::string        mPublishedName; ///< The instance name the MeshCoP service is published with.
+
+    enum : uint8_t
+    {
+        kTxtNetworkName,
+        kTxtExtPanId,
+        kTxtThreadVersion,
+        kTxtEntryCount,
+    };
+
+    std::string mTxtEntries[kTxtEntryCount]; ///< The TXT entries of the MeshCoP service, in DNS-SD TXT format.
+    std::string mPublishedTxt;               ///< The TXT data the MeshCoP service is published with.
 };
 
 /**
@@ -0,0 +1,103 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the log of the parent and child changes of the Thread node.
+ */
+
+#include "agent/churn_log.hpp"
+
+#include <string.h>
+
+namespace otbr {
+namespace Ncp {
+
+static_assert(sizeof(ChurnLog::Event) == 24, "ChurnLog::Event should stay compact");
+
+ChurnLog::ChurnLog(void)
+    : mOldest(0)
+    , mCount(0)
+    , mDropped(0)
+{
+}
+
+void ChurnLog::Add(Type aType, uint64_t aTimestamp, const otExtAddress *aExtAddress, uint16_t aRloc16, uint32_t aValue)
+{
+    Event *event;
+
+    if (mCount == kCapacity)
+    {
+        event   = &mEvents[mOldest];
+        mOldest = (mOldest + 1) % kCapacity;
+        ++mDropped;
+    }
+    else
+    {
+        event = &mEvents[(mOldest + mCount) % kCapacity];
+        ++mCount;
+    }
+
+    memset(event, 0, sizeof(*event));
+    event->mTimestamp = aTimestamp;
+    event->mValue     = aValue;
+    event->mRloc16    = aRloc16;
+    event->mType      = aType;
+
+    if (aExtAddress != nullptr)
+    {
+        event->mExtAddress = *aExtAddress;
+    }
+}
+
+void ChurnLog::GetEvents(uint64_t aSince, uint64_t aUntil, std::vector<Event> &aEvents) const
+{
+    aEvents.clear();
+
+    for (size_t i = 0; i < mCount; ++i)
+    {
+        const Event &event = mEvents[(mOldest + i) % kCapacity];
+
+        if (event.mTimestamp >= aSince && event.mTimestamp < aUntil)
+        {
+            aEvents.push_back(event);
+        }
+    }
+}
+
+const char *ChurnLog::TypeToString(uint8_t aType)
+{
+    static const char *const kTypeNames[] = {
+        "ChildAdded", "ChildRemoved", "ParentChanged", "RoleChanged", "PartitionChanged",
+    };
+
+    return aType < sizeof(kTypeNames) / sizeof(kTypeNames[0]) ? kTypeNames[aType] : "Unknown";
+}
+
+} // namespace Ncp
+} // namespace otbr
@@ -0,0 +1,142 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the log of the parent and child changes of the Thread node.
+ */
+
+#ifndef OTBR_AGENT_CHURN_LOG_HPP_
+#define OTBR_AGENT_CHURN_LOG_HPP_
+
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <openthread/thread.h>
+
+namespace otbr {
+namespace Ncp {
+
+/**
+ * This class implements a bounded log of the attach and detach events around the Thread node.
+ *
+ * The log records the children attaching and detaching, the changes of parent, of role and of partition, as they
+ * are reported by OpenThread. The events are kept in a ring of `kCapacity` fixed-size entries, so recording does
+ * not allocate and the oldest events are dropped when the ring is full.
+ *
+ */
+class ChurnLog
+{
+public:
+    static const size_t kCapacity = 256; ///< The number of events kept.
+
+    /**
+     * This enumeration represents the types of events.
+     *
+     */
+    enum Type : uint8_t
+    {
+        kTypeChildAdded       = 0, ///< A child attached, with its extended address and RLOC16.
+        kTypeChildRemoved     = 1, ///< A child detached, with its extended address and RLOC16.
+        kTypeParentChanged    = 2, ///< The node attached to a new parent, with the parent address and RLOC16.
+        kTypeRoleChanged      = 3, ///< The role changed, the value is the new `otDeviceRole`.
+        kTypePartitionChanged = 4, ///< The partition changed, the value is the new partition id.
+    };
+
+    /**
+     * This structure represents an event.
+     *
+     */
+    struct Event
+    {
+        uint64_t     mTimestamp;  ///< The time of the event, in milliseconds since the Unix epoch.
+        otExtAddress mExtAddress; ///< The extended address of the child or of the parent, zero otherwise.
+        uint32_t     mValue;      ///< The role or the partition id, zero otherwise.
+        uint16_t     mRloc16;     ///< The RLOC16 of the child or of the parent, or of the node itself.
+        uint8_t      mType;       ///< The type of the event, one of `Type`.
+    };
+
+    /**
+     * This constructor initializes an empty log.
+     *
+     */
+    ChurnLog(void);
+
+    /**
+     * This method records an event, dropping the oldest one if the log is full.
+     *
+     * @param[in]   aType           The type of the event.
+     * @param[in]   aTimestamp      The time of the event, in milliseconds since the Unix epoch.
+     * @param[in]   aExtAddress     A pointer to the extended address of the child or of the parent, may be nullptr.
+     * @param[in]   aRloc16         The RLOC16 of the child, of the parent or of the node itself.
+     * @param[in]   aValue          The role or the partition id.
+     *
+     */
+    void Add(Type aType, uint64_t aTimestamp, const otExtAddress *aExtAddress, uint16_t aRloc16, uint32_t aValue);
+
+    /**
+     * This method lists the events recorded in a time range, oldest first.
+     *
+     * @param[in]   aSince      The start of the range, in milliseconds since the Unix epoch, included.
+     * @param[in]   aUntil      The end of the range, in milliseconds since the Unix epoch, excluded.
+     * @param[out]  aEvents     The events.
+     *
+     */
+    void GetEvents(uint64_t aSince, uint64_t aUntil, std::vector<Event> &aEvents) const;
+
+    /**
+     * This method returns the number of events dropped because the log was full.
+     *
+     * @returns The number of events dropped.
+     *
+     */
+    uint32_t GetDroppedCount(void) const { return mDropped; }
+
+    /**
+     * This method returns the name of a type of event.
+     *
+     * @param[in]   aType   The type of event.
+     *
+     * @returns The name of the type, or "Unknown".
+     *
+     */
+    static const char *TypeToString(uint8_t aType);
+
+private:
+    Event    mEvents[kCapacity];
+    size_t   mOldest;
+    size_t   mCount;
+    uint32_t mDropped;
+};
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_AGENT_CHURN_LOG_HPP_
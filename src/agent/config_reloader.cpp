@@ -0,0 +1,225 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements reloading the agent configuration file at runtime.
+ */
+
+#include "agent/config_reloader.hpp"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "agent/instance_params.hpp"
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+static const char kDebugLevel[]               = "debug-level";
+static const char kLogRateLimit[]             = "log-rate-limit";
+static const char kRestListenPort[]           = "rest-listen-port";
+static const char kRestListenPath[]           = "rest-listen-path";
+static const char kRestMaxConnections[]       = "rest-max-connections";
+static const char kRestMaxClientConnections[] = "rest-max-client-connections";
+static const char kBackboneIfName[]           = "backbone-ifname";
+
+static bool IsReloadable(const std::string &aKey)
+{
+    static const char *const kKeys[] = {
+        kDebugLevel,         kLogRateLimit,
+        kRestListenPort,     kRestListenPath,
+        kRestMaxConnections, kRestMaxClientConnections,
+        kBackboneIfName,
+    };
+
+    bool reloadable = false;
+
+    for (const char *key : kKeys)
+    {
+        if (aKey == key)
+        {
+            reloadable = true;
+            break;
+        }
+    }
+
+    return reloadable;
+}
+
+/**
+ * This function reads an unsigned number between @p aMin and @p aMax, @p aValue is kept if @p aKey is not present.
+ *
+ */
+static otbrError ReadNumber(const ConfigFile &aConfig,
+                            const char *      aKey,
+                            unsigned long     aMin,
+                            unsigned long     aMax,
+                            unsigned long &   aValue)
+{
+    otbrError     error = OTBR_ERROR_NONE;
+    const char *  text  = aConfig.Get(aKey);
+    char *        end;
+    unsigned long value;
+
+    VerifyOrExit(text != nullptr);
+
+    errno = 0;
+    value = strtoul(text, &end, 0);
+    VerifyOrExit(*text != '\0' && *end == '\0' && errno == 0 && value >= aMin && value <= aMax,
+                 error = OTBR_ERROR_INVALID_ARGS);
+
+    aValue = value;
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_ERR, "Invalid %s: %s", aKey, text);
+    }
+
+    return error;
+}
+
+static bool IsSamePath(const char *aPath, const std::string &aOtherPath)
+{
+    return (aPath == nullptr) ? aOtherPath.empty() : (aOtherPath == aPath);
+}
+
+ConfigReloader &ConfigReloader::Get(void)
+{
+    static ConfigReloader sConfigReloader;
+
+    return sConfigReloader;
+}
+
+otbrError ConfigReloader::Reload(void)
+{
+    otbrError  error   = OTBR_ERROR_NONE;
+    uint32_t   changes = 0;
+    ConfigFile config;
+
+    VerifyOrExit(!mPath.empty(), error = OTBR_ERROR_NOT_FOUND);
+
+    error = config.Load(mPath.c_str());
+
+    if (error == OTBR_ERROR_PARSE)
+    {
+        otbrLog(OTBR_LOG_ERR, "Line %zu is not a key = value pair", config.GetErrorLine());
+    }
+
+    SuccessOrExit(error);
+    SuccessOrExit(error = Apply(config, changes));
+
+    if (changes != 0 && mChangeHandler != nullptr)
+    {
+        mChangeHandler(changes);
+    }
+
+exit:
+    otbrLogResult(error, "Load configuration file %s", mPath.c_str());
+    return error;
+}
+
+void ConfigReloader::ProcessReloadRequest(void)
+{
+    VerifyOrExit(mReloadRequested);
+
+    mReloadRequested = 0;
+    Reload();
+
+exit:
+    return;
+}
+
+otbrError ConfigReloader::Apply(const ConfigFile &aConfig, uint32_t &aChanges)
+{
+    otbrError       error          = OTBR_ERROR_NONE;
+    InstanceParams &params         = InstanceParams::Get();
+    unsigned long   logLevel       = static_cast<unsigned long>(otbrLogGetLevel());
+    unsigned long   logRateLimit   = otbrLogGetRateLimit();
+    unsigned long   restPort       = params.GetRestListenPort();
+    unsigned long   maxConnections = params.GetRestMaxConnections();
+    unsigned long   maxPerClient   = params.GetRestMaxClientConnections();
+    const char *    restPath       = aConfig.Get(kRestListenPath);
+    const char *    backboneIfName = aConfig.Get(kBackboneIfName);
+
+    aChanges = 0;
+
+    for (const auto &entry : aConfig.GetEntries())
+    {
+        if (!IsReloadable(entry.first))
+        {
+            otbrLog(OTBR_LOG_WARNING, "Ignoring %s, which cannot be changed without a restart", entry.first.c_str());
+        }
+    }
+
+    // Every value is checked before any is applied, so an invalid file leaves the agent as it was.
+    SuccessOrExit(error = ReadNumber(aConfig, kDebugLevel, OTBR_LOG_EMERG, OTBR_LOG_DEBUG, logLevel));
+    SuccessOrExit(error = ReadNumber(aConfig, kLogRateLimit, 0, UINT32_MAX, logRateLimit));
+    SuccessOrExit(error = ReadNumber(aConfig, kRestListenPort, 0, UINT16_MAX, restPort));
+    SuccessOrExit(error = ReadNumber(aConfig, kRestMaxConnections, 1, UINT32_MAX, maxConnections));
+    SuccessOrExit(error = ReadNumber(aConfig, kRestMaxClientConnections, 0, UINT32_MAX, maxPerClient));
+
+    if (static_cast<int>(logLevel) != otbrLogGetLevel())
+    {
+        otbrLogSetLevel(static_cast<int>(logLevel));
+        aChanges |= kChangeLogLevel;
+    }
+
+    otbrLogSetRateLimit(static_cast<uint32_t>(logRateLimit));
+    params.SetRestMaxConnections(static_cast<uint32_t>(maxConnections));
+    params.SetRestMaxClientConnections(static_cast<uint32_t>(maxPerClient));
+
+    if (restPort != params.GetRestListenPort())
+    {
+        params.SetRestListenPort(static_cast<uint16_t>(restPort));
+        aChanges |= kChangeRestListen;
+    }
+
+    // An empty path stops listening on the Unix domain socket.
+    if (restPath != nullptr && !IsSamePath(params.GetRestListenPath(), restPath))
+    {
+        mRestListenPath = restPath;
+        params.SetRestListenPath(mRestListenPath.empty() ? nullptr : mRestListenPath.c_str());
+        aChanges |= kChangeRestListen;
+    }
+
+    if (backboneIfName != nullptr && strcmp(backboneIfName, params.GetBackboneIfName()) != 0)
+    {
+        mBackboneIfName = backboneIfName;
+        params.SetBackboneIfName(mBackboneIfName.c_str());
+        aChanges |= kChangeBackboneInterface;
+    }
+
+exit:
+    return error;
+}
+
+} // namespace otbr
@@ -0,0 +1,164 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for reloading the agent configuration file at runtime.
+ */
+
+#ifndef OTBR_AGENT_CONFIG_RELOADER_HPP_
+#define OTBR_AGENT_CONFIG_RELOADER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <functional>
+#include <string>
+
+#include <signal.h>
+#include <stdint.h>
+
+#include "common/config_file.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class applies the agent configuration file given with `--config`, and applies it again on request.
+ *
+ * The file holds `key = value` lines named after the long command line options, and its settings take precedence
+ * over the command line. The following settings can be changed at runtime:
+ *
+ *   debug-level, log-rate-limit, rest-listen-port, rest-listen-path, rest-max-connections,
+ *   rest-max-client-connections and backbone-ifname.
+ *
+ * A reload compares the file with the settings in effect and only reconfigures the subsystems whose settings changed,
+ * so the Thread network, SRP registrations and published services are kept. Settings removed from the file keep their
+ * current value. Other keys are ignored with a warning, as they need a restart.
+ *
+ */
+class ConfigReloader
+{
+public:
+    /**
+     * The subsystems whose settings changed in a reload.
+     *
+     */
+    enum Change : uint32_t
+    {
+        kChangeLogLevel          = 1 << 0, ///< The log level changed.
+        kChangeRestListen        = 1 << 1, ///< The REST listen port or path changed.
+        kChangeBackboneInterface = 1 << 2, ///< The backbone interface changed.
+    };
+
+    /**
+     * This type represents the handler reconfiguring the subsystems after a reload.
+     *
+     * @param[in]   aChanges    The bitmask of `Change` values.
+     *
+     */
+    typedef std::function<void(uint32_t aChanges)> ChangeHandler;
+
+    /**
+     * This method gets the single `ConfigReloader` instance.
+     *
+     * @returns  The single `ConfigReloader` instance.
+     *
+     */
+    static ConfigReloader &Get(void);
+
+    /**
+     * This method sets the path of the configuration file.
+     *
+     * @param[in]   aPath   The path of the configuration file.
+     *
+     */
+    void SetPath(const char *aPath) { mPath = aPath; }
+
+    /**
+     * This method sets the handler reconfiguring the subsystems after a reload.
+     *
+     * Without a handler, settings are only stored in `InstanceParams` and the logging module, which is how they are
+     * applied at startup before the subsystems are started.
+     *
+     * @param[in]   aHandler    The handler.
+     *
+     */
+    void SetChangeHandler(ChangeHandler aHandler) { mChangeHandler = std::move(aHandler); }
+
+    /**
+     * This method reads the configuration file and applies the settings that changed.
+     *
+     * Nothing is applied if the file cannot be read or any value is invalid.
+     *
+     * @retval  OTBR_ERROR_NONE             Successfully applied the configuration file.
+     * @retval  OTBR_ERROR_NOT_FOUND        No configuration file was given.
+     * @retval  OTBR_ERROR_ERRNO            Failed to read the configuration file.
+     * @retval  OTBR_ERROR_PARSE            The configuration file is malformed.
+     * @retval  OTBR_ERROR_INVALID_ARGS     A value in the configuration file is invalid.
+     *
+     */
+    otbrError Reload(void);
+
+    /**
+     * This method requests a reload from a signal handler.
+     *
+     * This method is async-signal-safe, the reload is done by `ProcessReloadRequest()` from the mainloop.
+     *
+     */
+    void RequestReload(void) { mReloadRequested = 1; }
+
+    /**
+     * This method returns whether a reload is requested and not yet processed.
+     *
+     */
+    bool IsReloadRequested(void) const { return mReloadRequested != 0; }
+
+    /**
+     * This method reloads the configuration file if requested by `RequestReload()`.
+     *
+     */
+    void ProcessReloadRequest(void);
+
+private:
+    ConfigReloader(void)
+        : mReloadRequested(0)
+    {
+    }
+
+    otbrError Apply(const ConfigFile &aConfig, uint32_t &aChanges);
+
+    std::string           mPath;
+    std::string           mBackboneIfName;
+    std::string           mRestListenPath;
+    volatile sig_atomic_t mReloadRequested;
+    ChangeHandler         mChangeHandler;
+};
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_CONFIG_RELOADER_HPP_
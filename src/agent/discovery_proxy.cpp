@@ -0,0 +1,383 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the DNS-SD Discovery Proxy.
+ */
+
+#include "agent/discovery_proxy.hpp"
+
+#if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+
+#if !OTBR_ENABLE_MDNS_AVAHI && !OTBR_ENABLE_MDNS_MDNSSD && !OTBR_ENABLE_MDNS_MOJO
+#error "The Discovery Proxy requires OTBR_ENABLE_MDNS_AVAHI, OTBR_ENABLE_MDNS_MDNSSD or OTBR_ENABLE_MDNS_MOJO"
+#endif
+
+#include <vector>
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+static const char kDomain[]     = "default.service.arpa.";
+static const char kMdnsDomain[] = "local.";
+
+static bool EndsWith(const std::string &aString, const std::string &aSuffix)
+{
+    return aString.size() >= aSuffix.size() &&
+           aString.compare(aString.size() - aSuffix.size(), aSuffix.size(), aSuffix) == 0;
+}
+
+DiscoveryProxy::DiscoveryProxy(Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher)
+    : mNcp(aNcp)
+    , mPublisher(aPublisher)
+{
+}
+
+void DiscoveryProxy::Start(void)
+{
+    mPublisher.SetSubscriptionHandlers(&DiscoveryProxy::OnServiceDiscovered, &DiscoveryProxy::OnHostDiscovered, this);
+    otDnssdQuerySetCallbacks(GetInstance(), &DiscoveryProxy::OnDiscoveryProxySubscribe,
+                             &DiscoveryProxy::OnDiscoveryProxyUnsubscribe, this);
+
+    otbrLog(OTBR_LOG_INFO, "[discovery-proxy] started");
+}
+
+void DiscoveryProxy::HandleSoftReset(void)
+{
+    otDnssdQuerySetCallbacks(GetInstance(), &DiscoveryProxy::OnDiscoveryProxySubscribe,
+                             &DiscoveryProxy::OnDiscoveryProxyUnsubscribe, this);
+}
+
+void DiscoveryProxy::Stop(void)
+{
+    otDnssdQuerySetCallbacks(GetInstance(), nullptr, nullptr, nullptr);
+    mPublisher.SetSubscriptionHandlers(nullptr, nullptr, nullptr);
+
+    for (const auto &subscription : mSubscriptions)
+    {
+        std::string instanceName, type, hostName;
+
+        SuccessOrDie(SplitFullName(subscription.first, instanceName, type, hostName), "Invalid subscription name");
+
+        if (hostName.empty())
+        {
+            mPublisher.UnsubscribeService(type, instanceName);
+        }
+        else
+        {
+            mPublisher.UnsubscribeHost(hostName);
+        }
+    }
+
+    mSubscriptions.clear();
+    mCache.Clear();
+
+    otbrLog(OTBR_LOG_INFO, "[discovery-proxy] stopped");
+}
+
+void DiscoveryProxy::OnDiscoveryProxySubscribe(void *aContext, const char *aFullName)
+{
+    static_cast<DiscoveryProxy *>(aContext)->OnDiscoveryProxySubscribe(aFullName);
+}
+
+void DiscoveryProxy::OnDiscoveryProxySubscribe(const char *aFullName)
+{
+    std::string fullName(aFullName);
+    std::string instanceName, type, hostName;
+    otbrError   error;
+
+    SuccessOrExit(error = SplitFullName(fullName, instanceName, type, hostName));
+
+    // Only the first query of a name subscribes to mDNS, the others share the subscription and the cache.
+    if (++mSubscriptions[fullName] == 1)
+    {
+        if (hostName.empty())
+        {
+            mPublisher.SubscribeService(type, instanceName);
+        }
+        else
+        {
+            mPublisher.SubscribeHost(hostName);
+        }
+    }
+
+    otbrLog(OTBR_LOG_INFO, "[discovery-proxy] subscribe %s (%u queries)", aFullName, mSubscriptions[fullName]);
+
+    // The OpenThread DNS-SD server may unsubscribe synchronously when a query is answered, nothing about the
+    // subscription should be used after this.
+    if (hostName.empty())
+    {
+        AnswerFromCache(type, instanceName);
+    }
+    else
+    {
+        AnswerFromCache(hostName);
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[discovery-proxy] failed to subscribe %s: %s", aFullName, otbrErrorString(error));
+    }
+}
+
+void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFullName)
+{
+    static_cast<DiscoveryProxy *>(aContext)->OnDiscoveryProxyUnsubscribe(aFullName);
+}
+
+void DiscoveryProxy::OnDiscoveryProxyUnsubscribe(const char *aFullName)
+{
+    std::string                               fullName(aFullName);
+    std::string                               instanceName, type, hostName;
+    std::map<std::string, uint32_t>::iterator it;
+    otbrError                                 error;
+
+    SuccessOrExit(error = SplitFullName(fullName, instanceName, type, hostName));
+
+    it = mSubscriptions.find(fullName);
+    VerifyOrExit(it != mSubscriptions.end(), error = OTBR_ERROR_NOT_FOUND);
+
+    otbrLog(OTBR_LOG_INFO, "[discovery-proxy] unsubscribe %s (%u queries)", aFullName, it->second - 1);
+    VerifyOrExit(--it->second == 0);
+
+    mSubscriptions.erase(it);
+
+    // The cache is kept, so that following queries are answered right away until the entries expire.
+    if (hostName.empty())
+    {
+        mPublisher.UnsubscribeService(type, instanceName);
+    }
+    else
+    {
+        mPublisher.UnsubscribeHost(hostName);
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[discovery-proxy] failed to unsubscribe %s: %s", aFullName,
+                otbrErrorString(error));
+    }
+}
+
+void DiscoveryProxy::OnServiceDiscovered(const char *                  aType,
+                                         const DiscoveredInstanceInfo &aInstanceInfo,
+                                         void *                        aContext)
+{
+    static_cast<DiscoveryProxy *>(aContext)->OnServiceDiscovered(std::string(aType), aInstanceInfo);
+}
+
+void DiscoveryProxy::OnServiceDiscovered(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo)
+{
+    std::string serviceFullName = aType + "." + kDomain;
+
+    mCache.UpdateInstance(aType, aInstanceInfo, Mdns::DiscoveryCache::Clock::now());
+
+    VerifyOrExit(!aInstanceInfo.mRemoved);
+    VerifyOrExit(IsSubscribed(serviceFullName) || IsSubscribed(aInstanceInfo.mName + "." + serviceFullName));
+
+    AnswerServiceInstance(aType, aInstanceInfo);
+
+exit:
+    return;
+}
+
+void DiscoveryProxy::OnHostDiscovered(const char *aHostName, const DiscoveredHostInfo &aHostInfo, void *aContext)
+{
+    static_cast<DiscoveryProxy *>(aContext)->OnHostDiscovered(std::string(aHostName), aHostInfo);
+}
+
+void DiscoveryProxy::OnHostDiscovered(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo)
+{
+    mCache.UpdateHost(aHostName, aHostInfo, Mdns::DiscoveryCache::Clock::now());
+
+    VerifyOrExit(IsSubscribed(aHostName + "." + kDomain));
+
+    AnswerHost(aHostName, aHostInfo);
+
+exit:
+    return;
+}
+
+void DiscoveryProxy::AnswerFromCache(const std::string &aType, const std::string &aInstanceName)
+{
+    std::vector<DiscoveredInstanceInfo> instances;
+
+    mCache.FindInstances(aType, aInstanceName, Mdns::DiscoveryCache::Clock::now(), instances);
+
+    for (const DiscoveredInstanceInfo &instance : instances)
+    {
+        AnswerServiceInstance(aType, instance);
+    }
+}
+
+void DiscoveryProxy::AnswerFromCache(const std::string &aHostName)
+{
+    DiscoveredHostInfo host;
+
+    if (mCache.FindHost(aHostName, Mdns::DiscoveryCache::Clock::now(), host))
+    {
+        AnswerHost(aHostName, host);
+    }
+}
+
+void DiscoveryProxy::AnswerServiceInstance(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo)
+{
+    otIp6Address               addresses[kMaxAddresses];
+    otDnssdServiceInstanceInfo instanceInfo;
+    std::string                serviceFullName  = aType + "." + kDomain;
+    std::string                instanceFullName = aInstanceInfo.mName + "." + serviceFullName;
+    std::string                hostFullName     = TranslateDomain(aInstanceInfo.mHostName);
+
+    instanceInfo.mAddressNum = CopyAddresses(aInstanceInfo.mAddresses, addresses);
+    VerifyOrExit(instanceInfo.mAddressNum > 0);
+
+    instanceInfo.mFullName  = instanceFullName.c_str();
+    instanceInfo.mHostName  = hostFullName.c_str();
+    instanceInfo.mAddresses = addresses;
+    instanceInfo.mPort      = aInstanceInfo.mPort;
+    instanceInfo.mPriority  = aInstanceInfo.mPriority;
+    instanceInfo.mWeight    = aInstanceInfo.mWeight;
+    instanceInfo.mTxtLength = static_cast<uint16_t>(aInstanceInfo.mTxtData.size());
+    instanceInfo.mTxtData   = aInstanceInfo.mTxtData.data();
+    instanceInfo.mTtl       = aInstanceInfo.mTtl;
+
+    otbrLog(OTBR_LOG_INFO, "[discovery-proxy] answer %s, host %s, %u addresses, ttl %u", instanceFullName.c_str(),
+            hostFullName.c_str(), instanceInfo.mAddressNum, instanceInfo.mTtl);
+
+    otDnssdQueryHandleDiscoveredServiceInstance(GetInstance(), serviceFullName.c_str(), &instanceInfo);
+
+exit:
+    return;
+}
+
+void DiscoveryProxy::AnswerHost(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo)
+{
+    otIp6Address    addresses[kMaxAddresses];
+    otDnssdHostInfo hostInfo;
+    std::string     hostFullName = aHostName + "." + kDomain;
+
+    hostInfo.mAddressNum = CopyAddresses(aHostInfo.mAddresses, addresses);
+    VerifyOrExit(hostInfo.mAddressNum > 0);
+
+    hostInfo.mAddresses = addresses;
+    hostInfo.mTtl       = aHostInfo.mTtl;
+
+    otbrLog(OTBR_LOG_INFO, "[discovery-proxy] answer %s, %u addresses, ttl %u", hostFullName.c_str(),
+            hostInfo.mAddressNum, hostInfo.mTtl);
+
+    otDnssdQueryHandleDiscoveredHost(GetInstance(), hostFullName.c_str(), &hostInfo);
+
+exit:
+    return;
+}
+
+otbrError DiscoveryProxy::SplitFullName(const std::string &aFullName,
+                                        std::string &      aInstanceName,
+                                        std::string &      aType,
+                                        std::string &      aHostName)
+{
+    otbrError   error = OTBR_ERROR_NONE;
+    std::string name;
+    size_t      dotPos;
+
+    // A full name is "<instance>.<service>.<protocol>.<domain>", "<service>.<protocol>.<domain>" or
+    // "<host>.<domain>". The instance name may contain dots.
+    VerifyOrExit(aFullName.size() > sizeof(kDomain) && EndsWith(aFullName, std::string(".") + kDomain),
+                 error = OTBR_ERROR_NOT_FOUND);
+
+    name = aFullName.substr(0, aFullName.size() - sizeof(kDomain));
+
+    if (!EndsWith(name, "._udp") && !EndsWith(name, "._tcp"))
+    {
+        VerifyOrExit(name.find('.') == std::string::npos, error = OTBR_ERROR_INVALID_ARGS);
+        aHostName = name;
+        ExitNow();
+    }
+
+    dotPos = name.rfind('.', name.size() - sizeof("._udp"));
+
+    if (dotPos == std::string::npos)
+    {
+        aType = name;
+    }
+    else
+    {
+        aInstanceName = name.substr(0, dotPos);
+        aType         = name.substr(dotPos + 1);
+    }
+
+    VerifyOrExit(aType[0] == '_' && aType.size() > sizeof("._udp"), error = OTBR_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+std::string DiscoveryProxy::TranslateDomain(const std::string &aName)
+{
+    std::string name = aName;
+
+    if (EndsWith(name, std::string(".") + kMdnsDomain))
+    {
+        name.replace(name.size() - (sizeof(kMdnsDomain) - 1), sizeof(kMdnsDomain) - 1, kDomain);
+    }
+
+    return name;
+}
+
+uint8_t DiscoveryProxy::CopyAddresses(const std::vector<Ip6Address> &aAddresses, otIp6Address *aBuffer)
+{
+    uint8_t count = 0;
+
+    static_assert(sizeof(Ip6Address) == sizeof(otIp6Address), "Ip6Address and otIp6Address must be the same size");
+
+    for (const Ip6Address &address : aAddresses)
+    {
+        // Link-local and loopback addresses of the infrastructure link are useless to Thread devices.
+        if (address.IsLinkLocal() || address.IsLoopback() || address.IsMulticast())
+        {
+            continue;
+        }
+
+        VerifyOrExit(count < kMaxAddresses);
+        memcpy(&aBuffer[count++], &address, sizeof(otIp6Address));
+    }
+
+exit:
+    return count;
+}
+
+} // namespace otbr
+
+#endif // OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
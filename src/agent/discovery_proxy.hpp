@@ -0,0 +1,142 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the DNS-SD Discovery Proxy.
+ */
+
+#ifndef OTBR_AGENT_DISCOVERY_PROXY_HPP_
+#define OTBR_AGENT_DISCOVERY_PROXY_HPP_
+
+#if OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+
+#include <stdint.h>
+
+#include <map>
+#include <string>
+
+#include <openthread/dnssd_server.h>
+#include <openthread/instance.h>
+
+#include "agent/ncp_openthread.hpp"
+#include "mdns/discovery_cache.hpp"
+#include "mdns/mdns.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements the DNS-SD Discovery Proxy.
+ *
+ * DNS-SD queries from the Thread network which the OpenThread DNS-SD server cannot answer are forwarded to
+ * mDNS. Discovered services and hosts are kept in a cache shared by all queries, so that concurrent and repeated
+ * queries for the same name are answered from the cache and cause a single mDNS subscription.
+ *
+ */
+class DiscoveryProxy
+{
+public:
+    /**
+     * This constructor initializes the Discovery Proxy object.
+     *
+     * @param[in]  aNcp        A reference to the NCP controller.
+     * @param[in]  aPublisher  A reference to the mDNS publisher.
+     *
+     */
+    explicit DiscoveryProxy(Ncp::ControllerOpenThread &aNcp, Mdns::Publisher &aPublisher);
+
+    /**
+     * This method starts the Discovery Proxy.
+     *
+     */
+    void Start(void);
+
+    /**
+     * This method stops the Discovery Proxy.
+     *
+     */
+    void Stop(void);
+
+    /**
+     * This method registers the DNS-SD query callbacks again after the NCP is soft reset.
+     *
+     */
+    void HandleSoftReset(void);
+
+private:
+    typedef Mdns::Publisher::DiscoveredInstanceInfo DiscoveredInstanceInfo;
+    typedef Mdns::Publisher::DiscoveredHostInfo     DiscoveredHostInfo;
+
+    enum : uint8_t
+    {
+        kMaxAddresses = 16, ///< The max number of addresses in one answer.
+    };
+
+    static void OnDiscoveryProxySubscribe(void *aContext, const char *aFullName);
+    void        OnDiscoveryProxySubscribe(const char *aFullName);
+    static void OnDiscoveryProxyUnsubscribe(void *aContext, const char *aFullName);
+    void        OnDiscoveryProxyUnsubscribe(const char *aFullName);
+
+    static void OnServiceDiscovered(const char *aType, const DiscoveredInstanceInfo &aInstanceInfo, void *aContext);
+    void        OnServiceDiscovered(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo);
+    static void OnHostDiscovered(const char *aHostName, const DiscoveredHostInfo &aHostInfo, void *aContext);
+    void        OnHostDiscovered(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo);
+
+    void      AnswerFromCache(const std::string &aType, const std::string &aInstanceName);
+    void      AnswerFromCache(const std::string &aHostName);
+    void      AnswerServiceInstance(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo);
+    void      AnswerHost(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo);
+    bool      IsSubscribed(const std::string &aFullName) const { return mSubscriptions.count(aFullName) > 0; }
+
+    static otbrError   SplitFullName(const std::string &aFullName,
+                                     std::string &      aInstanceName,
+                                     std::string &      aType,
+                                     std::string &      aHostName);
+    static std::string TranslateDomain(const std::string &aName);
+    static uint8_t     CopyAddresses(const std::vector<Ip6Address> &aAddresses, otIp6Address *aBuffer);
+
+    otInstance *GetInstance(void) { return mNcp.GetInstance(); }
+
+    // A reference to the NCP controller, has no ownership.
+    Ncp::ControllerOpenThread &mNcp;
+
+    // A reference to the mDNS publisher, has no ownership.
+    Mdns::Publisher &mPublisher;
+
+    // The discovered services and hosts, shared by all queries.
+    Mdns::DiscoveryCache mCache;
+
+    // The number of queries of each subscribed full name.
+    std::map<std::string, uint32_t> mSubscriptions;
+};
+
+} // namespace otbr
+
+#endif // OTBR_ENABLE_DNSSD_DISCOVERY_PROXY
+
+#endif // OTBR_AGENT_DISCOVERY_PROXY_HPP_
@@ -0,0 +1,460 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements capturing Thread frames to pcapng streams.
+ */
+
+#include "agent/frame_capture.hpp"
+
+#include <errno.h>
+#include <inttypes.h>
+#include <poll.h>
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "agent/instance_params.hpp"
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "utils/pcapng_writer.hpp"
+
+namespace otbr {
+
+static constexpr int kWriterPollTimeout = 100; // Milliseconds, in case a wakeup is missed.
+
+FrameCapture::FrameCapture(Ncp::ControllerOpenThread &aNcp)
+    : mNcp(aNcp)
+    , mPromiscuous(false)
+    , mStopFd(-1)
+    , mWakeupFd(-1)
+    , mListenFd(-1)
+    , mCapturing(false)
+    , mWriterWaiting(false)
+    , mRingDropCount(0)
+{
+}
+
+FrameCapture::~FrameCapture(void)
+{
+    // The OpenThread instance is already finalized, and its pcap callback with it.
+    StopWriterThread();
+
+    for (Reader &reader : mReaders)
+    {
+        close(reader.mFd);
+    }
+
+    if (mListenFd >= 0)
+    {
+        close(mListenFd);
+        unlink(mListenPath.c_str());
+    }
+
+    if (mWakeupFd >= 0)
+    {
+        close(mWakeupFd);
+    }
+}
+
+void FrameCapture::Init(void)
+{
+    otbrError   error = OTBR_ERROR_NONE;
+    const char *path  = InstanceParams::Get().GetCaptureSocket();
+
+    VerifyOrExit(path != nullptr && path[0] != '\0');
+
+    mPromiscuous = InstanceParams::Get().GetCapturePromiscuous();
+
+    error = mFilter.Parse(InstanceParams::Get().GetCaptureFilter());
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_ERR, "FrameCapture: invalid filter \"%s\"", InstanceParams::Get().GetCaptureFilter());
+        ExitNow();
+    }
+
+    SuccessOrExit(error = mRing.Init(kRingSize));
+    SuccessOrExit(error = mTasks.Init());
+    mWakeupFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    VerifyOrExit(mWakeupFd >= 0, error = OTBR_ERROR_ERRNO);
+    SuccessOrExit(error = Listen(path));
+    SuccessOrExit(error = StartWriterThread());
+
+    otLinkSetPcapCallback(mNcp.GetInstance(), &FrameCapture::HandlePcap, this);
+
+exit:
+    otbrLogResult(error, "FrameCapture: %s", __FUNCTION__);
+}
+
+otbrError FrameCapture::Listen(const char *aPath)
+{
+    otbrError   error = OTBR_ERROR_NONE;
+    sockaddr_un address;
+    struct stat status;
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    VerifyOrExit(strlen(aPath) < sizeof(address.sun_path), errno = ENAMETOOLONG, error = OTBR_ERROR_ERRNO);
+    strcpy(address.sun_path, aPath);
+
+    // The socket file of a previous agent is removed, any other file is left to fail the bind.
+    if (lstat(aPath, &status) == 0 && S_ISSOCK(status.st_mode))
+    {
+        unlink(aPath);
+    }
+
+    mListenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    VerifyOrExit(mListenFd >= 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(bind(mListenFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+    mListenPath = aPath;
+    VerifyOrExit(listen(mListenFd, kMaxReaders) == 0, error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_ERR, "FrameCapture: failed to listen on %s: %s", aPath, strerror(errno));
+    }
+
+    return error;
+}
+
+otbrError FrameCapture::StartWriterThread(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    sigset_t  allSignals;
+    sigset_t  oldSignals;
+
+    mStopFd = eventfd(0, EFD_CLOEXEC);
+    VerifyOrExit(mStopFd >= 0, error = OTBR_ERROR_ERRNO);
+
+    // Signals are left to the mainloop thread, whose poll they interrupt.
+    sigfillset(&allSignals);
+    pthread_sigmask(SIG_SETMASK, &allSignals, &oldSignals);
+    mWriterThread = std::thread(&FrameCapture::RunWriterThread, this);
+    pthread_sigmask(SIG_SETMASK, &oldSignals, nullptr);
+
+    pthread_setname_np(mWriterThread.native_handle(), "otbr-capture");
+
+exit:
+    return error;
+}
+
+void FrameCapture::StopWriterThread(void)
+{
+    uint64_t stop = 1;
+
+    if (mWriterThread.joinable())
+    {
+        VerifyOrDie(write(mStopFd, &stop, sizeof(stop)) == sizeof(stop), strerror(errno));
+        mWriterThread.join();
+    }
+
+    if (mStopFd >= 0)
+    {
+        close(mStopFd);
+        mStopFd = -1;
+    }
+}
+
+void FrameCapture::SetPromiscuous(bool aPromiscuous)
+{
+    otError error = otLinkSetPromiscuous(mNcp.GetInstance(), aPromiscuous);
+
+    // OpenThread only allows promiscuous mode while Thread is disabled.
+    if (error != OT_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "FrameCapture: failed to %s promiscuous mode: %s",
+                aPromiscuous ? "enable" : "disable", otThreadErrorToString(error));
+    }
+}
+
+void FrameCapture::HandlePcap(const otRadioFrame *aFrame, bool aIsTx, void *aContext)
+{
+    static_cast<FrameCapture *>(aContext)->HandlePcap(aFrame, aIsTx);
+}
+
+void FrameCapture::HandlePcap(const otRadioFrame *aFrame, bool aIsTx)
+{
+    int8_t          rssi = aIsTx ? Utils::PcapngWriter::kInvalidRssi : aFrame->mInfo.mRxInfo.mRssi;
+    uint8_t *       record;
+    RecordHeader *  header;
+    struct timespec now;
+    uint64_t        wakeup = 1;
+
+    VerifyOrExit(mCapturing.load(std::memory_order_relaxed));
+    VerifyOrExit(mFilter.Match(aFrame->mPsdu, aFrame->mLength, rssi, aIsTx));
+
+    // The frame is copied once, the pcapng block is built by the writer thread.
+    record = mRing.BeginWrite(sizeof(RecordHeader) + aFrame->mLength);
+    VerifyOrExit(record != nullptr);
+
+    clock_gettime(CLOCK_REALTIME, &now);
+
+    header             = reinterpret_cast<RecordHeader *>(record);
+    header->mTimestamp = static_cast<uint64_t>(now.tv_sec) * 1000000 + static_cast<uint64_t>(now.tv_nsec) / 1000;
+    header->mLength    = aFrame->mLength;
+    header->mChannel   = aFrame->mChannel;
+    header->mRssi      = rssi;
+    header->mLqi       = aIsTx ? 0 : aFrame->mInfo.mRxInfo.mLqi;
+    header->mIsTx      = aIsTx;
+    memcpy(record + sizeof(RecordHeader), aFrame->mPsdu, aFrame->mLength);
+    mRing.CommitWrite();
+
+    // Pairs with the fence of the writer thread, either it sees the frame or it is woken up.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (mWriterWaiting.load(std::memory_order_relaxed))
+    {
+        mWriterWaiting.store(false, std::memory_order_relaxed);
+        VerifyOrExit(write(mWakeupFd, &wakeup, sizeof(wakeup)) == sizeof(wakeup),
+                     otbrLog(OTBR_LOG_ERR, "FrameCapture: failed to wake up writer: %s", strerror(errno)));
+    }
+
+exit:
+    return;
+}
+
+void FrameCapture::RunWriterThread(void)
+{
+    enum
+    {
+        kStopFd,
+        kWakeupFd,
+        kListenFd,
+        kFirstReaderFd,
+    };
+
+    struct pollfd fds[kFirstReaderFd + kMaxReaders];
+
+    memset(fds, 0, sizeof(fds));
+    fds[kStopFd].fd       = mStopFd;
+    fds[kStopFd].events   = POLLIN;
+    fds[kWakeupFd].fd     = mWakeupFd;
+    fds[kWakeupFd].events = POLLIN;
+    fds[kListenFd].fd     = mListenFd;
+    fds[kListenFd].events = POLLIN;
+
+    while (true)
+    {
+        size_t count = kFirstReaderFd + mReaders.size();
+        int    timeout;
+
+        DrainRing();
+
+        for (size_t i = 0; i < mReaders.size(); i++)
+        {
+            fds[kFirstReaderFd + i].fd      = mReaders[i].mFd;
+            fds[kFirstReaderFd + i].events  = mReaders[i].mOutput.empty() ? 0 : POLLOUT;
+            fds[kFirstReaderFd + i].revents = 0;
+        }
+
+        mWriterWaiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        timeout = mRing.IsEmpty() ? kWriterPollTimeout : 0;
+
+        if (poll(fds, count, timeout) < 0)
+        {
+            VerifyOrDie(errno == EINTR, strerror(errno));
+            continue;
+        }
+
+        mWriterWaiting.store(false, std::memory_order_relaxed);
+
+        if (fds[kStopFd].revents & POLLIN)
+        {
+            break;
+        }
+
+        if (fds[kWakeupFd].revents & POLLIN)
+        {
+            uint64_t wakeup;
+
+            // The counter is non-blocking and known to be readable.
+            if (read(mWakeupFd, &wakeup, sizeof(wakeup)) < 0)
+            {
+                otbrLog(OTBR_LOG_WARNING, "FrameCapture: failed to clear wakeup: %s", strerror(errno));
+            }
+        }
+
+        // Backwards, so closing a reader does not move the readers still to be processed.
+        for (size_t i = mReaders.size(); i-- > 0;)
+        {
+            short events = fds[kFirstReaderFd + i].revents;
+
+            if (events & (POLLERR | POLLHUP | POLLNVAL))
+            {
+                CloseReader(i);
+            }
+            else if (events & POLLOUT)
+            {
+                FlushReader(mReaders[i]);
+            }
+        }
+
+        if (fds[kListenFd].revents & POLLIN)
+        {
+            AcceptReader();
+        }
+    }
+}
+
+void FrameCapture::AcceptReader(void)
+{
+    int    fd = accept4(mListenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    Reader reader;
+
+    VerifyOrExit(fd >= 0);
+
+    if (mReaders.size() >= kMaxReaders)
+    {
+        otbrLog(OTBR_LOG_WARNING, "FrameCapture: rejected a reader, %zu are connected", mReaders.size());
+        close(fd);
+        ExitNow();
+    }
+
+    reader.mFd        = fd;
+    reader.mDropCount = 0;
+    Utils::PcapngWriter(reader.mOutput).WriteHeader(InstanceParams::Get().GetThreadIfName());
+    mReaders.push_back(std::move(reader));
+    FlushReader(mReaders.back());
+
+    if (mReaders.size() == 1)
+    {
+        mCapturing.store(true, std::memory_order_relaxed);
+
+        if (mPromiscuous)
+        {
+            mTasks.Post([this]() { SetPromiscuous(true); });
+        }
+    }
+
+    otbrLog(OTBR_LOG_INFO, "FrameCapture: reader connected, %zu connected", mReaders.size());
+
+exit:
+    return;
+}
+
+void FrameCapture::CloseReader(size_t aIndex)
+{
+    if (mReaders[aIndex].mDropCount > 0)
+    {
+        otbrLog(OTBR_LOG_WARNING, "FrameCapture: %" PRIu64 " frames were dropped for a slow reader",
+                mReaders[aIndex].mDropCount);
+    }
+
+    close(mReaders[aIndex].mFd);
+    mReaders.erase(mReaders.begin() + static_cast<long>(aIndex));
+
+    if (mReaders.empty())
+    {
+        mCapturing.store(false, std::memory_order_relaxed);
+
+        if (mPromiscuous)
+        {
+            mTasks.Post([this]() { SetPromiscuous(false); });
+        }
+    }
+
+    otbrLog(OTBR_LOG_INFO, "FrameCapture: reader disconnected, %zu connected", mReaders.size());
+}
+
+void FrameCapture::DrainRing(void)
+{
+    const uint8_t *record;
+    size_t         length;
+
+    while (!mRing.IsEmpty())
+    {
+        Utils::PcapngWriter writer(mBatch);
+        size_t              count = 0;
+
+        mBatch.clear();
+
+        while (count < kMaxBatchFrames && (record = mRing.Peek(length)) != nullptr)
+        {
+            const RecordHeader &           header = *reinterpret_cast<const RecordHeader *>(record);
+            Utils::PcapngWriter::FrameInfo info;
+
+            info.mTimestamp = header.mTimestamp;
+            info.mChannel   = header.mChannel;
+            info.mRssi      = header.mRssi;
+            info.mLqi       = header.mLqi;
+            info.mIsTx      = header.mIsTx;
+            writer.WriteFrame(info, record + sizeof(RecordHeader), header.mLength);
+
+            mRing.Consume();
+            count++;
+        }
+
+        // The batch is built once and shared by all readers.
+        for (Reader &reader : mReaders)
+        {
+            if (reader.mOutput.size() < kMaxReaderBacklog)
+            {
+                reader.mOutput.append(mBatch);
+                FlushReader(reader);
+            }
+            else
+            {
+                reader.mDropCount += count;
+            }
+        }
+    }
+
+    if (mRing.GetDropCount() != mRingDropCount)
+    {
+        otbrLog(OTBR_LOG_WARNING, "FrameCapture: %" PRIu64 " frames were dropped, the ring is full",
+                mRing.GetDropCount() - mRingDropCount);
+        mRingDropCount = mRing.GetDropCount();
+    }
+}
+
+void FrameCapture::FlushReader(Reader &aReader)
+{
+    ssize_t sent;
+
+    VerifyOrExit(!aReader.mOutput.empty());
+
+    sent = send(aReader.mFd, aReader.mOutput.data(), aReader.mOutput.size(), MSG_NOSIGNAL);
+
+    // A failed reader is closed when poll reports the error.
+    VerifyOrExit(sent > 0);
+    aReader.mOutput.erase(0, static_cast<size_t>(sent));
+
+exit:
+    return;
+}
+
+} // namespace otbr
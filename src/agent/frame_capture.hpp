@@ -0,0 +1,149 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for capturing Thread frames to pcapng streams.
+ */
+
+#ifndef OTBR_AGENT_FRAME_CAPTURE_HPP_
+#define OTBR_AGENT_FRAME_CAPTURE_HPP_
+
+#include <stdint.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <openthread/link.h>
+
+#include "agent/ncp_openthread.hpp"
+#include "common/task_queue.hpp"
+#include "utils/frame_filter.hpp"
+#include "utils/frame_ring.hpp"
+
+namespace otbr {
+
+/**
+ * This class streams the IEEE 802.15.4 frames sent and received by the radio to pcapng readers.
+ *
+ * An agent started with a capture socket taps the frames with the OpenThread pcap callback while a reader is
+ * connected to the Unix socket, for example `socat UNIX-CONNECT:PATH - | wireshark -k -i -`. The callback runs in
+ * the mainloop, it only matches the frame against the capture filter and copies it once into a `Utils::FrameRing`.
+ * The pcapng blocks are built and written to the readers by a writer thread, so slow readers never hold up the
+ * mainloop: the frames are dropped for a reader which falls too far behind, and for all readers when the ring is
+ * full.
+ *
+ */
+class FrameCapture
+{
+public:
+    /**
+     * The constructor initializes the frame capture.
+     *
+     * @param[in]   aNcp    A reference to the NCP controller.
+     *
+     */
+    explicit FrameCapture(Ncp::ControllerOpenThread &aNcp);
+
+    ~FrameCapture(void);
+
+    /**
+     * This method starts serving the capture socket set in `InstanceParams`, if any.
+     *
+     */
+    void Init(void);
+
+    /**
+     * This method processes the requests of the writer thread, it is called in each mainloop iteration.
+     *
+     */
+    void Process(void) { mTasks.Process(); }
+
+private:
+    static constexpr size_t kRingSize         = 1024 * 1024; // About 7000 frames of the maximum length.
+    static constexpr size_t kMaxReaders       = 4;
+    static constexpr size_t kMaxReaderBacklog = 256 * 1024; // Frames are dropped for a reader this far behind.
+    static constexpr size_t kMaxBatchFrames   = 64;
+
+    struct RecordHeader
+    {
+        uint64_t mTimestamp; // Microseconds since the epoch.
+        uint16_t mLength;
+        uint8_t  mChannel;
+        int8_t   mRssi;
+        uint8_t  mLqi;
+        bool     mIsTx;
+    };
+
+    struct Reader
+    {
+        int         mFd;
+        std::string mOutput;
+        uint64_t    mDropCount;
+    };
+
+    static void HandlePcap(const otRadioFrame *aFrame, bool aIsTx, void *aContext);
+    void        HandlePcap(const otRadioFrame *aFrame, bool aIsTx);
+
+    otbrError Listen(const char *aPath);
+    otbrError StartWriterThread(void);
+    void      StopWriterThread(void);
+    void      SetPromiscuous(bool aPromiscuous);
+
+    // The writer thread.
+    void RunWriterThread(void);
+    void AcceptReader(void);
+    void CloseReader(size_t aIndex);
+    void DrainRing(void);
+    void FlushReader(Reader &aReader);
+
+    Ncp::ControllerOpenThread &mNcp;
+    Utils::FrameRing           mRing;
+    Utils::FrameFilter         mFilter;
+    TaskQueue                  mTasks; // Runs the requests of the writer thread in the mainloop.
+    bool                       mPromiscuous;
+
+    std::thread       mWriterThread;
+    int               mStopFd;
+    int               mWakeupFd; // Signaled by the mainloop when the writer thread sleeps with frames in the ring.
+    int               mListenFd;
+    std::string       mListenPath;
+    std::atomic<bool> mCapturing;     // Whether a reader is connected, set by the writer thread.
+    std::atomic<bool> mWriterWaiting; // Whether the writer thread sleeps until the next frame.
+
+    // Only accessed by the writer thread.
+    std::vector<Reader> mReaders;
+    std::string         mBatch;
+    uint64_t            mRingDropCount;
+};
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_FRAME_CAPTURE_HPP_
@@ -34,6 +34,8 @@
 #ifndef OTBR_AGENT_INSATNCE_PARAMS_HPP_
 #define OTBR_AGENT_INSATNCE_PARAMS_HPP_
 
+#include <stdint.h>
+
 namespace otbr {
 
 /**
@@ -43,6 +45,21 @@ namespace otbr {
 class InstanceParams
 {
 public:
+    static const uint16_t kDefaultRestListenPort    = 8081; ///< The default port the REST server listens on.
+    static const uint32_t kDefaultRestDiagFreshness     = 1000; ///< The default REST diagnostics freshness in ms.
+    static const uint32_t kDefaultRestDiagCrawlInterval = 0;    ///< The REST diagnostics crawler is disabled.
+    static const uint32_t kDefaultRestDiagHistorySize   = 256;  ///< The default REST diagnostic history size in KiB.
+    static const uint32_t kDefaultRestMaxConnections    = 500;  ///< The default REST connection limit.
+    static const uint32_t kDefaultRestClientConnections = 32;   ///< The default REST connection limit per client.
+    static const uint32_t kDefaultRestDiagSweepWindow   = 0;    ///< The REST diagnostics are queried by multicast.
+    static const uint32_t kDefaultRestDiagSweepRetries  = 2;    ///< The default retries of a unicast query.
+    static const uint32_t kDefaultDBusSignalWindow      = 20;   ///< The default D-Bus signal coalescing window in ms.
+    static const uint32_t kDefaultDBusDumpSampling      = 0;    ///< D-Bus messages are only dumped at debug level.
+    static const uint32_t kDefaultSrpPublishLimit       = 16;   ///< The default limit of SRP updates being published.
+    static const uint32_t kDefaultSyncFailoverTimeout   = 5000; ///< The default standby failover timeout in ms.
+    static const int      kBackboneThreadNone           = -2;   ///< Backbone packets are processed by the mainloop.
+    static const int      kBackboneThreadAnyCpu         = -1;   ///< The backbone thread is not pinned to a CPU.
+
     /**
      * This method gets the single `InstanceParams` instance.
      *
@@ -83,15 +100,425 @@ public:
      */
     const char *GetBackboneIfName(void) const { return mBackboneIfName; }
 
+    /**
+     * This method sets the port the REST server listens on.
+     *
+     * Each agent process serves one radio, so agents running side by side MUST use different ports.
+     *
+     * @param[in] aPort  The TCP port number, zero to only listen on the Unix domain socket.
+     *
+     */
+    void SetRestListenPort(uint16_t aPort) { mRestListenPort = aPort; }
+
+    /**
+     * This method gets the port the REST server listens on.
+     *
+     * @returns The TCP port number.
+     *
+     */
+    uint16_t GetRestListenPort(void) const { return mRestListenPort; }
+
+    /**
+     * This method sets the path of a Unix domain socket the REST server listens on, besides the TCP port.
+     *
+     * @param[in] aPath  The socket path, or nullptr to only listen on the TCP port.
+     *
+     */
+    void SetRestListenPath(const char *aPath) { mRestListenPath = aPath; }
+
+    /**
+     * This method gets the path of the Unix domain socket the REST server listens on.
+     *
+     * @returns The socket path, or nullptr if the REST server only listens on the TCP port.
+     *
+     */
+    const char *GetRestListenPath(void) const { return mRestListenPath; }
+
+    /**
+     * This method sets how long the REST server answers /diagnostics with the last collection after it
+     * completed, instead of querying the mesh again.
+     *
+     * @param[in] aFreshness  The freshness window in milliseconds, zero to query the mesh for every request.
+     *
+     */
+    void SetRestDiagFreshness(uint32_t aFreshness) { mRestDiagFreshness = aFreshness; }
+
+    /**
+     * This method gets how long the REST server answers /diagnostics with the last collection.
+     *
+     * @returns The freshness window in milliseconds.
+     *
+     */
+    uint32_t GetRestDiagFreshness(void) const { return mRestDiagFreshness; }
+
+    /**
+     * This method sets the interval the REST server queries the diagnostics of the next router in the background,
+     * so /diagnostics is answered from the snapshot at once.
+     *
+     * @param[in] aInterval  The interval in milliseconds, zero to disable the background queries.
+     *
+     */
+    void SetRestDiagCrawlInterval(uint32_t aInterval) { mRestDiagCrawlInterval = aInterval; }
+
+    /**
+     * This method gets the interval the REST server queries the diagnostics of the next router in the background.
+     *
+     * @returns The interval in milliseconds, zero if the background queries are disabled.
+     *
+     */
+    uint32_t GetRestDiagCrawlInterval(void) const { return mRestDiagCrawlInterval; }
+
+    /**
+     * This method sets the memory the REST server keeps the history of diagnostic values in.
+     *
+     * @param[in] aSize  The size in KiB, zero to disable the history.
+     *
+     */
+    void SetRestDiagHistorySize(uint32_t aSize) { mRestDiagHistorySize = aSize; }
+
+    /**
+     * This method gets the memory the REST server keeps the history of diagnostic values in.
+     *
+     * @returns The size in KiB.
+     *
+     */
+    uint32_t GetRestDiagHistorySize(void) const { return mRestDiagHistorySize; }
+
+    /**
+     * This method sets the maximum number of connections the REST server serves at the same time.
+     *
+     * @param[in] aMaxConnections  The maximum number of connections.
+     *
+     */
+    void SetRestMaxConnections(uint32_t aMaxConnections) { mRestMaxConnections = aMaxConnections; }
+
+    /**
+     * This method gets the maximum number of connections the REST server serves at the same time.
+     *
+     * @returns The maximum number of connections.
+     *
+     */
+    uint32_t GetRestMaxConnections(void) const { return mRestMaxConnections; }
+
+    /**
+     * This method sets the maximum number of connections the REST server serves at the same time for one client
+     * address.
+     *
+     * @param[in] aMaxConnections  The maximum number of connections, zero for no limit per client.
+     *
+     */
+    void SetRestMaxClientConnections(uint32_t aMaxConnections) { mRestMaxClientConnections = aMaxConnections; }
+
+    /**
+     * This method gets the maximum number of connections the REST server serves at the same time for one client
+     * address.
+     *
+     * @returns The maximum number of connections, zero for no limit per client.
+     *
+     */
+    uint32_t GetRestMaxClientConnections(void) const { return mRestMaxClientConnections; }
+
+    /**
+     * This method sets the number of routers the REST server queries the diagnostics of at the same time, when it
+     * queries them one by one instead of by multicast.
+     *
+     * @param[in] aWindow  The number of unicast queries in flight, zero to query by multicast.
+     *
+     */
+    void SetRestDiagSweepWindow(uint32_t aWindow) { mRestDiagSweepWindow = aWindow; }
+
+    /**
+     * This method gets the number of routers the REST server queries the diagnostics of at the same time.
+     *
+     * @returns The number of unicast queries in flight, zero if the diagnostics are queried by multicast.
+     *
+     */
+    uint32_t GetRestDiagSweepWindow(void) const { return mRestDiagSweepWindow; }
+
+    /**
+     * This method sets how many times the REST server queries a router again when it does not answer a unicast
+     * diagnostic query.
+     *
+     * @param[in] aRetries  The number of retries.
+     *
+     */
+    void SetRestDiagSweepRetries(uint32_t aRetries) { mRestDiagSweepRetries = aRetries; }
+
+    /**
+     * This method gets how many times the REST server queries a router again when it does not answer a unicast
+     * diagnostic query.
+     *
+     * @returns The number of retries.
+     *
+     */
+    uint32_t GetRestDiagSweepRetries(void) const { return mRestDiagSweepRetries; }
+
+    /**
+     * This method sets whether the REST server runs on its own thread.
+     *
+     * @param[in] aEnabled  Whether the REST server runs on its own thread, instead of in the mainloop.
+     *
+     */
+    void SetRestThreadEnabled(bool aEnabled) { mRestThreadEnabled = aEnabled; }
+
+    /**
+     * This method gets whether the REST server runs on its own thread.
+     *
+     * @returns Whether the REST server runs on its own thread, instead of in the mainloop.
+     *
+     */
+    bool GetRestThreadEnabled(void) const { return mRestThreadEnabled; }
+
+    /**
+     * This method sets the file the REST server saves its node, diagnostics and topology resources in, to serve them
+     * right after a restart.
+     *
+     * @param[in] aPath  The file path, nullptr or empty to not save the resources.
+     *
+     */
+    void SetRestSnapshotFile(const char *aPath) { mRestSnapshotFile = aPath; }
+
+    /**
+     * This method gets the file the REST server saves its node, diagnostics and topology resources in, to serve them
+     * right after a restart.
+     *
+     * @returns The file path, nullptr or empty if the resources are not saved.
+     *
+     */
+    const char *GetRestSnapshotFile(void) const { return mRestSnapshotFile; }
+
+    /**
+     * This method sets the window the D-Bus server gathers changed properties in, before signaling them at once.
+     *
+     * @param[in] aWindow  The window in milliseconds, zero to signal each change at once.
+     *
+     */
+    void SetDBusSignalWindow(uint32_t aWindow) { mDBusSignalWindow = aWindow; }
+
+    /**
+     * This method gets the window the D-Bus server gathers changed properties in, before signaling them at once.
+     *
+     * @returns The window in milliseconds, zero if each change is signaled at once.
+     *
+     */
+    uint32_t GetDBusSignalWindow(void) const { return mDBusSignalWindow; }
+
+    /**
+     * This method sets the interval D-Bus messages are sampled at to be dumped when debug logging is off.
+     *
+     * @param[in] aInterval  One of every @p aInterval messages is dumped at info level, zero to disable sampling.
+     *
+     */
+    void SetDBusDumpSampling(uint32_t aInterval) { mDBusDumpSampling = aInterval; }
+
+    /**
+     * This method gets the interval D-Bus messages are sampled at to be dumped when debug logging is off.
+     *
+     * @returns The sampling interval, zero if sampling is disabled.
+     *
+     */
+    uint32_t GetDBusDumpSampling(void) const { return mDBusDumpSampling; }
+
+    /**
+     * This method sets how many SRP updates the advertising proxy publishes at once, later updates are queued.
+     *
+     * @param[in] aLimit  The number of SRP updates being published at once, zero for no limit.
+     *
+     */
+    void SetSrpPublishLimit(uint32_t aLimit) { mSrpPublishLimit = aLimit; }
+
+    /**
+     * This method gets how many SRP updates the advertising proxy publishes at once, later updates are queued.
+     *
+     * @returns The number of SRP updates being published at once, zero if there is no limit.
+     *
+     */
+    uint32_t GetSrpPublishLimit(void) const { return mSrpPublishLimit; }
+
+    /**
+     * This method sets the file the advertising proxy saves published SRP hosts in, to republish them on restart.
+     *
+     * @param[in] aPath  The file path, nullptr or empty to not save SRP hosts.
+     *
+     */
+    void SetSrpStateFile(const char *aPath) { mSrpStateFile = aPath; }
+
+    /**
+     * This method gets the file the advertising proxy saves published SRP hosts in, to republish them on restart.
+     *
+     * @returns The file path, nullptr or empty if SRP hosts are not saved.
+     *
+     */
+    const char *GetSrpStateFile(void) const { return mSrpStateFile; }
+
+    /**
+     * This method sets whether backbone packets are processed by a dedicated thread, and the CPU it runs on.
+     *
+     * @param[in] aCpu  The CPU the thread is pinned to, `kBackboneThreadAnyCpu` to not pin the thread, or
+     *                  `kBackboneThreadNone` to process backbone packets in the mainloop.
+     *
+     */
+    void SetBackboneThreadCpu(int aCpu) { mBackboneThreadCpu = aCpu; }
+
+    /**
+     * This method gets whether backbone packets are processed by a dedicated thread, and the CPU it runs on.
+     *
+     * @returns The CPU the thread is pinned to, `kBackboneThreadAnyCpu` if the thread is not pinned, or
+     *          `kBackboneThreadNone` if backbone packets are processed in the mainloop.
+     *
+     */
+    int GetBackboneThreadCpu(void) const { return mBackboneThreadCpu; }
+
+    /**
+     * This method sets the TCP port the agent serves its state to a standby agent on.
+     *
+     * @param[in] aPort  The TCP port, zero to not serve a standby agent.
+     *
+     */
+    void SetSyncListenPort(uint16_t aPort) { mSyncListenPort = aPort; }
+
+    /**
+     * This method gets the TCP port the agent serves its state to a standby agent on.
+     *
+     * @returns The TCP port, zero if no standby agent is served.
+     *
+     */
+    uint16_t GetSyncListenPort(void) const { return mSyncListenPort; }
+
+    /**
+     * This method sets the active agent this agent is the standby of.
+     *
+     * @param[in] aPeer  The address and TCP port of the active agent, as `ADDRESS:PORT` or `[IPV6-ADDRESS]:PORT`,
+     *                   nullptr or empty if this agent is not a standby.
+     *
+     */
+    void SetSyncPeer(const char *aPeer) { mSyncPeer = aPeer; }
+
+    /**
+     * This method gets the active agent this agent is the standby of.
+     *
+     * @returns The address and TCP port of the active agent, nullptr or empty if this agent is not a standby.
+     *
+     */
+    const char *GetSyncPeer(void) const { return mSyncPeer; }
+
+    /**
+     * This method sets how long a standby agent waits for a silent active agent before taking over its state.
+     *
+     * @param[in] aTimeout  The timeout in milliseconds.
+     *
+     */
+    void SetSyncFailoverTimeout(uint32_t aTimeout) { mSyncFailoverTimeout = aTimeout; }
+
+    /**
+     * This method gets how long a standby agent waits for a silent active agent before taking over its state.
+     *
+     * @returns The timeout in milliseconds.
+     *
+     */
+    uint32_t GetSyncFailoverTimeout(void) const { return mSyncFailoverTimeout; }
+
+    /**
+     * This method sets the Unix socket the agent streams the captured Thread frames to.
+     *
+     * @param[in] aPath  The path of the socket, nullptr or empty to not capture frames.
+     *
+     */
+    void SetCaptureSocket(const char *aPath) { mCaptureSocket = aPath; }
+
+    /**
+     * This method gets the Unix socket the agent streams the captured Thread frames to.
+     *
+     * @returns The path of the socket, nullptr or empty if frames are not captured.
+     *
+     */
+    const char *GetCaptureSocket(void) const { return mCaptureSocket; }
+
+    /**
+     * This method sets the filter of the captured Thread frames.
+     *
+     * @param[in] aFilter  The filter expression, as accepted by `Utils::FrameFilter`, nullptr to capture all frames.
+     *
+     */
+    void SetCaptureFilter(const char *aFilter) { mCaptureFilter = aFilter; }
+
+    /**
+     * This method gets the filter of the captured Thread frames.
+     *
+     * @returns The filter expression, nullptr if all frames are captured.
+     *
+     */
+    const char *GetCaptureFilter(void) const { return mCaptureFilter; }
+
+    /**
+     * This method sets whether the radio is put in promiscuous mode while frames are captured.
+     *
+     * @param[in] aPromiscuous  Whether to capture the frames of other PANs and other destinations.
+     *
+     */
+    void SetCapturePromiscuous(bool aPromiscuous) { mCapturePromiscuous = aPromiscuous; }
+
+    /**
+     * This method gets whether the radio is put in promiscuous mode while frames are captured.
+     *
+     * @returns Whether the frames of other PANs and other destinations are captured.
+     *
+     */
+    bool GetCapturePromiscuous(void) const { return mCapturePromiscuous; }
+
 private:
     InstanceParams()
         : mThreadIfName(nullptr)
         , mBackboneIfName(nullptr)
+        , mRestListenPort(kDefaultRestListenPort)
+        , mRestListenPath(nullptr)
+        , mRestDiagFreshness(kDefaultRestDiagFreshness)
+        , mRestDiagCrawlInterval(kDefaultRestDiagCrawlInterval)
+        , mRestDiagHistorySize(kDefaultRestDiagHistorySize)
+        , mRestMaxConnections(kDefaultRestMaxConnections)
+        , mRestMaxClientConnections(kDefaultRestClientConnections)
+        , mRestDiagSweepWindow(kDefaultRestDiagSweepWindow)
+        , mRestDiagSweepRetries(kDefaultRestDiagSweepRetries)
+        , mRestThreadEnabled(false)
+        , mRestSnapshotFile(nullptr)
+        , mDBusSignalWindow(kDefaultDBusSignalWindow)
+        , mDBusDumpSampling(kDefaultDBusDumpSampling)
+        , mSrpPublishLimit(kDefaultSrpPublishLimit)
+        , mSrpStateFile(nullptr)
+        , mBackboneThreadCpu(kBackboneThreadNone)
+        , mSyncListenPort(0)
+        , mSyncPeer(nullptr)
+        , mSyncFailoverTimeout(kDefaultSyncFailoverTimeout)
+        , mCaptureSocket(nullptr)
+        , mCaptureFilter(nullptr)
+        , mCapturePromiscuous(false)
     {
     }
 
     const char *mThreadIfName;
     const char *mBackboneIfName;
+    uint16_t    mRestListenPort;
+    const char *mRestListenPath;
+    uint32_t    mRestDiagFreshness;
+    uint32_t    mRestDiagCrawlInterval;
+    uint32_t    mRestDiagHistorySize;
+    uint32_t    mRestMaxConnections;
+    uint32_t    mRestMaxClientConnections;
+    uint32_t    mRestDiagSweepWindow;
+    uint32_t    mRestDiagSweepRetries;
+    bool        mRestThreadEnabled;
+    const char *mRestSnapshotFile;
+    uint32_t    mDBusSignalWindow;
+    uint32_t    mDBusDumpSampling;
+    uint32_t    mSrpPublishLimit;
+    const char *mSrpStateFile;
+    int         mBackboneThreadCpu;
+    uint16_t    mSyncListenPort;
+    const char *mSyncPeer;
+    uint32_t    mSyncFailoverTimeout;
+    const char *mCaptureSocket;
+    const char *mCaptureFilter;
+    bool        mCapturePromiscuous;
 };
 
 } // namespace otbr
@@ -29,7 +29,7 @@
 #include <openthread-br/config.h>
 
 #include <fstream>
-#include <mutex>
+#include <future>
 #include <sstream>
 #include <thread>
 
@@ -45,11 +45,19 @@
 #include <openthread/platform/radio.h>
 
 #include "agent/agent_instance.hpp"
+#include "agent/config_reloader.hpp"
 #include "agent/ncp.hpp"
 #include "agent/ncp_openthread.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_poller.hpp"
+#include "common/mainloop_stats.hpp"
+#include "common/mainloop_watchdog.hpp"
+#include "common/memory_stats.hpp"
+#include "common/startup_timeline.hpp"
+#include "common/trace.hpp"
 #include "common/types.hpp"
+#include "common/usdt.hpp"
 #if OTBR_ENABLE_REST_SERVER
 #include "rest/rest_web_server.hpp"
 using otbr::rest::RestWebServer;
@@ -58,18 +66,32 @@ using otbr::rest::RestWebServer;
 #include "dbus/server/dbus_agent.hpp"
 using otbr::DBus::DBusAgent;
 #endif
+using otbr::ConfigReloader;
+using otbr::MainloopStats;
+using otbr::MainloopWatchdog;
+using otbr::MemoryStats;
+using otbr::StartupTimeline;
 using otbr::Ncp::ControllerOpenThread;
 
 #if OTBR_ENABLE_OPENWRT
-extern void       UbusUpdateFdSet(fd_set &aReadFdSet, int &aMaxFd);
-extern void       UbusProcess(const fd_set &aReadFdSet);
-extern void       UbusServerRun(void);
-extern void       UbusServerInit(otbr::Ncp::ControllerOpenThread *aController, std::mutex *aNcpThreadMutex);
-static std::mutex sThreadMutex;
+extern void UbusProcess(void);
+extern void UbusServerRun(void);
+extern void UbusServerInit(otbr::Ncp::ControllerOpenThread *aController);
 #endif
 
 static const char kSyslogIdent[]          = "otbr-agent";
 static const char kDefaultInterfaceName[] = "wpan0";
+static const char kDefaultSrpStateFile[]  = "/var/lib/thread/otbr-srp-state";
+static const char kDefaultRestSnapshot[]  = "/var/lib/thread/otbr-rest-snapshot";
+
+// The number of log lines buffered for the background log writer.
+static const uint32_t kDefaultLogQueueSize = 512;
+
+// The number of lines per second each logging call site may log.
+static const uint32_t kDefaultLogRateLimit = 20;
+
+// The number of trace entries kept for each thread, about 100 KiB.
+static const uint32_t kDefaultTraceRingSize = 4096;
 
 enum
 {
@@ -81,10 +103,38 @@ enum
     OTBR_OPT_VERSION                 = 'V',
     OTBR_OPT_SHORTMAX                = 128,
     OTBR_OPT_RADIO_VERSION,
+    OTBR_OPT_WATCHDOG_BUDGET,
+    OTBR_OPT_TIMER_SLACK,
+    OTBR_OPT_REST_LISTEN_PORT,
+    OTBR_OPT_REST_LISTEN_PATH,
+    OTBR_OPT_REST_DIAG_FRESHNESS,
+    OTBR_OPT_REST_DIAG_CRAWL_INTERVAL,
+    OTBR_OPT_REST_DIAG_HISTORY_SIZE,
+    OTBR_OPT_REST_MAX_CONNECTIONS,
+    OTBR_OPT_REST_MAX_CLIENT_CONNECTIONS,
+    OTBR_OPT_REST_DIAG_SWEEP_WINDOW,
+    OTBR_OPT_REST_DIAG_SWEEP_RETRIES,
+    OTBR_OPT_REST_SNAPSHOT_FILE,
+    OTBR_OPT_DBUS_SIGNAL_WINDOW,
+    OTBR_OPT_DBUS_DUMP_SAMPLING,
+    OTBR_OPT_SRP_PUBLISH_LIMIT,
+    OTBR_OPT_SRP_STATE_FILE,
+    OTBR_OPT_LOG_QUEUE_SIZE,
+    OTBR_OPT_LOG_RATE_LIMIT,
+    OTBR_OPT_TRACE_RING_SIZE,
+    OTBR_OPT_CONFIG,
+    OTBR_OPT_BACKBONE_THREAD,
+    OTBR_OPT_REST_THREAD,
+    OTBR_OPT_SYNC_LISTEN_PORT,
+    OTBR_OPT_SYNC_PEER,
+    OTBR_OPT_SYNC_FAILOVER_TIMEOUT,
+    OTBR_OPT_CAPTURE_SOCKET,
+    OTBR_OPT_CAPTURE_FILTER,
+    OTBR_OPT_CAPTURE_PROMISCUOUS,
 };
 
-// Default poll timeout.
-static const struct timeval kPollTimeout = {10, 0};
+// The components lower the poll timeout to their next deadline, this only bounds a sleep when none has one.
+static const struct timeval kPollTimeout = {3600, 0};
 static const struct option  kOptions[]   = {
     {"backbone-ifname", required_argument, nullptr, OTBR_OPT_BACKBONE_INTERFACE_NAME},
     {"debug-level", required_argument, nullptr, OTBR_OPT_DEBUG_LEVEL},
@@ -93,37 +143,154 @@ static const struct option  kOptions[]   = {
     {"verbose", no_argument, nullptr, OTBR_OPT_VERBOSE},
     {"version", no_argument, nullptr, OTBR_OPT_VERSION},
     {"radio-version", no_argument, nullptr, OTBR_OPT_RADIO_VERSION},
+    {"watchdog-budget", required_argument, nullptr, OTBR_OPT_WATCHDOG_BUDGET},
+    {"timer-slack", required_argument, nullptr, OTBR_OPT_TIMER_SLACK},
+    {"rest-listen-port", required_argument, nullptr, OTBR_OPT_REST_LISTEN_PORT},
+    {"rest-listen-path", required_argument, nullptr, OTBR_OPT_REST_LISTEN_PATH},
+    {"rest-diag-freshness", required_argument, nullptr, OTBR_OPT_REST_DIAG_FRESHNESS},
+    {"rest-diag-crawl-interval", required_argument, nullptr, OTBR_OPT_REST_DIAG_CRAWL_INTERVAL},
+    {"rest-diag-history-size", required_argument, nullptr, OTBR_OPT_REST_DIAG_HISTORY_SIZE},
+    {"rest-max-connections", required_argument, nullptr, OTBR_OPT_REST_MAX_CONNECTIONS},
+    {"rest-max-client-connections", required_argument, nullptr, OTBR_OPT_REST_MAX_CLIENT_CONNECTIONS},
+    {"rest-diag-sweep-window", required_argument, nullptr, OTBR_OPT_REST_DIAG_SWEEP_WINDOW},
+    {"rest-diag-sweep-retries", required_argument, nullptr, OTBR_OPT_REST_DIAG_SWEEP_RETRIES},
+    {"rest-snapshot-file", required_argument, nullptr, OTBR_OPT_REST_SNAPSHOT_FILE},
+    {"dbus-signal-window", required_argument, nullptr, OTBR_OPT_DBUS_SIGNAL_WINDOW},
+    {"dbus-dump-sampling", required_argument, nullptr, OTBR_OPT_DBUS_DUMP_SAMPLING},
+    {"srp-publish-limit", required_argument, nullptr, OTBR_OPT_SRP_PUBLISH_LIMIT},
+    {"srp-state-file", required_argument, nullptr, OTBR_OPT_SRP_STATE_FILE},
+    {"log-queue-size", required_argument, nullptr, OTBR_OPT_LOG_QUEUE_SIZE},
+    {"log-rate-limit", required_argument, nullptr, OTBR_OPT_LOG_RATE_LIMIT},
+    {"trace-ring-size", required_argument, nullptr, OTBR_OPT_TRACE_RING_SIZE},
+    {"config", required_argument, nullptr, OTBR_OPT_CONFIG},
+    {"backbone-thread", optional_argument, nullptr, OTBR_OPT_BACKBONE_THREAD},
+    {"rest-thread", no_argument, nullptr, OTBR_OPT_REST_THREAD},
+    {"sync-listen-port", required_argument, nullptr, OTBR_OPT_SYNC_LISTEN_PORT},
+    {"sync-peer", required_argument, nullptr, OTBR_OPT_SYNC_PEER},
+    {"sync-failover-timeout", required_argument, nullptr, OTBR_OPT_SYNC_FAILOVER_TIMEOUT},
+    {"capture-socket", required_argument, nullptr, OTBR_OPT_CAPTURE_SOCKET},
+    {"capture-filter", required_argument, nullptr, OTBR_OPT_CAPTURE_FILTER},
+    {"capture-promiscuous", no_argument, nullptr, OTBR_OPT_CAPTURE_PROMISCUOUS},
     {0, 0, 0, 0}};
 
+#if OTBR_ENABLE_DBUS_SERVER
+static std::unique_ptr<DBusAgent> sDBusAgent;
+static std::future<otbrError>     sDBusConnected;
+
+/**
+ * This function starts connecting to the system bus, which does not depend on the NCP, in the background.
+ *
+ */
+static void StartDBusConnect(const char *aInterfaceName, ControllerOpenThread *aNcp)
+{
+    sDBusAgent     = std::unique_ptr<DBusAgent>(new DBusAgent(aInterfaceName, aNcp));
+    sDBusConnected = std::async(std::launch::async, []() {
+        StartupTimeline::Phase phase("dbus-connect");
+
+        return sDBusAgent->Connect();
+    });
+}
+#endif
+
 static void HandleSignal(int aSignal)
 {
     signal(aSignal, SIG_DFL);
 }
 
-static int Mainloop(otbr::AgentInstance &aInstance, const char *aInterfaceName)
+static void HandleReloadSignal(int aSignal)
+{
+    OTBR_UNUSED_VARIABLE(aSignal);
+
+    ConfigReloader::Get().RequestReload();
+}
+
+/**
+ * This function reconfigures the subsystems whose settings changed in a configuration reload.
+ *
+ */
+static void HandleConfigChanged(otbr::AgentInstance &aInstance, uint32_t aChanges)
 {
-    int                   error         = EXIT_FAILURE;
     ControllerOpenThread &ncpOpenThread = static_cast<ControllerOpenThread &>(aInstance.GetNcp());
 
+    if (aChanges & ConfigReloader::kChangeLogLevel)
+    {
+        otbrLogResult(ncpOpenThread.UpdateLogLevel(), "Set OpenThread log level");
+    }
+
+#if OTBR_ENABLE_REST_SERVER
+    if (aChanges & ConfigReloader::kChangeRestListen)
+    {
+        RestWebServer::GetRestWebServer(&ncpOpenThread)->ReopenListenFds();
+    }
+#endif
+
+    if (aChanges & ConfigReloader::kChangeBackboneInterface)
+    {
+        aInstance.HandleBackboneInterfaceChanged();
+    }
+}
+
+/**
+ * This function starts the services in front of the NCP.
+ *
+ * The services are started after the first mainloop iteration, so the NCP starts attaching without waiting for them.
+ *
+ */
+static void StartServices(ControllerOpenThread &aNcp)
+{
+#if OTBR_ENABLE_DBUS_SERVER
+    {
+        StartupTimeline::Phase phase("dbus");
+
+        // Init() connects again if connecting in the background failed.
+        sDBusConnected.wait();
+        otbrLogResult(sDBusAgent->Init(), "Initialize D-Bus agent");
+    }
+#endif
+#if OTBR_ENABLE_REST_SERVER
+    {
+        StartupTimeline::Phase phase("rest");
+
+        RestWebServer::GetRestWebServer(&aNcp)->Init();
+    }
+#endif
+    OTBR_UNUSED_VARIABLE(aNcp);
+
+    StartupTimeline::Get().Report();
+}
+
+static int Mainloop(otbr::AgentInstance &aInstance, uint32_t aWatchdogBudgetMs)
+{
+    int                   error           = EXIT_FAILURE;
+    ControllerOpenThread &ncpOpenThread   = static_cast<ControllerOpenThread &>(aInstance.GetNcp());
+    bool                  servicesStarted = false;
+
 #if OTBR_ENABLE_DBUS_SERVER
-    std::unique_ptr<DBusAgent> dbusAgent = std::unique_ptr<DBusAgent>(new DBusAgent(aInterfaceName, &ncpOpenThread));
-    dbusAgent->Init();
-#else
-    (void)aInterfaceName;
+    DBusAgent *dbusAgent = sDBusAgent.get();
 #endif
 #if OTBR_ENABLE_REST_SERVER
     RestWebServer *restServer = RestWebServer::GetRestWebServer(&ncpOpenThread);
-    restServer->Init();
 #endif
-    otbrLog(OTBR_LOG_INFO, "Border router agent started.");
+    otbrLog(OTBR_LOG_INFO, "Border router agent started, polling with %s.",
+            otbr::MainloopPoller::Get().IsEpollEnabled() ? "epoll" : "select");
     // allow quitting elegantly
     signal(SIGTERM, HandleSignal);
+    signal(SIGHUP, HandleReloadSignal);
+    ConfigReloader::Get().SetChangeHandler(
+        [&aInstance](uint32_t aChanges) { HandleConfigChanged(aInstance, aChanges); });
+
+    if (aWatchdogBudgetMs > 0)
+    {
+        otbrLogResult(MainloopWatchdog::Get().Start(aWatchdogBudgetMs), "Start mainloop watchdog");
+    }
 
     while (true)
     {
         otSysMainloopContext mainloop;
         int                  rval;
 
+        ConfigReloader::Get().ProcessReloadRequest();
+
         mainloop.mMaxFd   = -1;
         mainloop.mTimeout = kPollTimeout;
 
@@ -131,65 +298,137 @@ static int Mainloop(otbr::AgentInstance &aInstance, const char *aInterfaceName)
         FD_ZERO(&mainloop.mWriteFdSet);
         FD_ZERO(&mainloop.mErrorFdSet);
 
-        aInstance.UpdateFdSet(mainloop);
+        {
+            MainloopStats::Probe probe(MainloopStats::kComponentAgent, MainloopStats::kPhaseUpdateFdSet);
+
+            aInstance.UpdateFdSet(mainloop);
+        }
 
 #if OTBR_ENABLE_DBUS_SERVER
-        dbusAgent->UpdateFdSet(mainloop.mReadFdSet, mainloop.mWriteFdSet, mainloop.mErrorFdSet, mainloop.mMaxFd,
-                               mainloop.mTimeout);
+        if (servicesStarted)
+        {
+            MainloopStats::Probe probe(MainloopStats::kComponentDBus, MainloopStats::kPhaseUpdateFdSet);
+            MemoryStats::Scope   memoryScope(MemoryStats::kSubsystemDBus);
+
+            dbusAgent->UpdateFdSet(mainloop.mReadFdSet, mainloop.mWriteFdSet, mainloop.mErrorFdSet, mainloop.mMaxFd,
+                                   mainloop.mTimeout);
+        }
 #endif
 
 #if OTBR_ENABLE_REST_SERVER
-        restServer->UpdateFdSet(mainloop);
-#endif
+        if (servicesStarted)
+        {
+            MainloopStats::Probe probe(MainloopStats::kComponentRest, MainloopStats::kPhaseUpdateFdSet);
+            MemoryStats::Scope   memoryScope(MemoryStats::kSubsystemRest);
 
-#if OTBR_ENABLE_OPENWRT
-        UbusUpdateFdSet(mainloop.mReadFdSet, mainloop.mMaxFd);
-        sThreadMutex.unlock();
+            restServer->UpdateFdSet(mainloop);
+        }
 #endif
 
-        rval = select(mainloop.mMaxFd + 1, &mainloop.mReadFdSet, &mainloop.mWriteFdSet, &mainloop.mErrorFdSet,
-                      &mainloop.mTimeout);
+        // A reload requested after the last check would otherwise wait for the next wakeup.
+        if (ConfigReloader::Get().IsReloadRequested())
+        {
+            mainloop.mTimeout = {0, 0};
+        }
+
+        rval = otbr::MainloopPoller::Get().Poll(mainloop);
+
+        // SIGHUP interrupts the poll to reload the configuration, other signals end the mainloop.
+        if (rval < 0 && errno == EINTR && ConfigReloader::Get().IsReloadRequested())
+        {
+            continue;
+        }
 
         if (ncpOpenThread.IsResetRequested())
         {
-            ncpOpenThread.Reset();
+            ncpOpenThread.SoftReset();
             continue;
         }
 
         if (rval >= 0)
         {
+            OTBR_USDT1(mainloop_start, rval);
+
 #if OTBR_ENABLE_OPENWRT
-            sThreadMutex.lock();
-            UbusProcess(mainloop.mReadFdSet);
+            {
+                MainloopStats::Probe probe(MainloopStats::kComponentUbus, MainloopStats::kPhaseProcess);
+
+                UbusProcess();
+            }
 #endif
 
 #if OTBR_ENABLE_REST_SERVER
-            restServer->Process(mainloop);
+            if (servicesStarted)
+            {
+                MainloopStats::Probe probe(MainloopStats::kComponentRest, MainloopStats::kPhaseProcess);
+                MemoryStats::Scope   memoryScope(MemoryStats::kSubsystemRest);
+
+                restServer->Process(mainloop);
+            }
 #endif
 
-            aInstance.Process(mainloop);
+            {
+                MainloopStats::Probe probe(MainloopStats::kComponentAgent, MainloopStats::kPhaseProcess);
+
+                aInstance.Process(mainloop);
+            }
 
 #if OTBR_ENABLE_DBUS_SERVER
-            dbusAgent->Process(mainloop.mReadFdSet, mainloop.mWriteFdSet, mainloop.mErrorFdSet);
+            if (servicesStarted)
+            {
+                MainloopStats::Probe probe(MainloopStats::kComponentDBus, MainloopStats::kPhaseProcess);
+                MemoryStats::Scope   memoryScope(MemoryStats::kSubsystemDBus);
+
+                dbusAgent->Process(mainloop.mReadFdSet, mainloop.mWriteFdSet, mainloop.mErrorFdSet);
+            }
 #endif
+
+            if (!servicesStarted)
+            {
+                StartServices(ncpOpenThread);
+                servicesStarted = true;
+            }
+
+            OTBR_USDT0(mainloop_done);
         }
         else
         {
-#if OTBR_ENABLE_OPENWRT
-            sThreadMutex.lock();
-#endif
             error = OTBR_ERROR_ERRNO;
-            otbrLog(OTBR_LOG_ERR, "select() failed", strerror(errno));
+            otbrLog(OTBR_LOG_ERR, "Mainloop poll failed: %s", strerror(errno));
             break;
         }
     }
 
+    MainloopWatchdog::Get().Stop();
+    ConfigReloader::Get().SetChangeHandler(nullptr);
+
+#if OTBR_ENABLE_REST_SERVER
+    // The REST thread calls into OpenThread through the mainloop, which no longer runs.
+    restServer->StopThread();
+#endif
+
+#if OTBR_ENABLE_DBUS_SERVER
+    // The D-Bus agent refers to the NCP, release it before the NCP.
+    sDBusAgent.reset();
+#endif
+
     return error;
 }
 
 static void PrintHelp(const char *aProgramName)
 {
-    fprintf(stderr, "Usage: %s [-I interfaceName] [-d DEBUG_LEVEL] [-v] RADIO_URL\n", aProgramName);
+    fprintf(stderr,
+            "Usage: %s [-I interfaceName] [-d DEBUG_LEVEL] [-v] [--watchdog-budget MS] [--timer-slack MS] "
+            "[--rest-listen-port PORT] [--rest-listen-path PATH] "
+            "[--rest-diag-freshness MS] [--rest-diag-crawl-interval MS] [--rest-diag-history-size KB] "
+            "[--rest-max-connections N] [--rest-max-client-connections N] [--rest-diag-sweep-window N] "
+            "[--rest-diag-sweep-retries N] [--rest-snapshot-file PATH] [--dbus-signal-window MS] "
+            "[--dbus-dump-sampling N] [--srp-publish-limit N] "
+            "[--srp-state-file PATH] [--log-queue-size N] [--log-rate-limit N] [--trace-ring-size N] [--config FILE] "
+            "[--backbone-thread[=CPU]] [--rest-thread] [--sync-listen-port PORT] [--sync-peer ADDRESS:PORT] "
+            "[--sync-failover-timeout MS] [--capture-socket PATH] [--capture-filter EXPRESSION] "
+            "[--capture-promiscuous] RADIO_URL\n",
+            aProgramName);
     fprintf(stderr, "%s", otSysGetRadioUrlHelpString());
 }
 
@@ -219,9 +458,38 @@ int main(int argc, char *argv[])
     otbr::Ncp::Controller *          ncp                   = nullptr;
     otbr::Ncp::ControllerOpenThread *ncpOpenThread         = nullptr;
     otbr::Ncp::PowerMap              powerMap;
-    bool                             verbose           = false;
-    bool                             printRadioVersion = false;
-
+    bool                             verbose               = false;
+    bool                             printRadioVersion     = false;
+    uint32_t                         watchdogBudgetMs      = MainloopWatchdog::kDefaultBudgetMs;
+    uint32_t                         timerSlackMs          = otbr::MainloopPoller::kDefaultTimerSlackMs;
+    unsigned long                    restListenPort        = otbr::InstanceParams::kDefaultRestListenPort;
+    const char *                     restListenPath        = nullptr;
+    uint32_t                         restDiagFreshness     = otbr::InstanceParams::kDefaultRestDiagFreshness;
+    uint32_t                         restDiagCrawlInterval = otbr::InstanceParams::kDefaultRestDiagCrawlInterval;
+    uint32_t                         restDiagHistorySize   = otbr::InstanceParams::kDefaultRestDiagHistorySize;
+    uint32_t                         restMaxConnections    = otbr::InstanceParams::kDefaultRestMaxConnections;
+    uint32_t                         restMaxPerClient      = otbr::InstanceParams::kDefaultRestClientConnections;
+    uint32_t                         restDiagSweepWindow   = otbr::InstanceParams::kDefaultRestDiagSweepWindow;
+    uint32_t                         restDiagSweepRetries  = otbr::InstanceParams::kDefaultRestDiagSweepRetries;
+    const char *                     restSnapshotFile      = kDefaultRestSnapshot;
+    uint32_t                         dbusSignalWindow      = otbr::InstanceParams::kDefaultDBusSignalWindow;
+    uint32_t                         dbusDumpSampling      = otbr::InstanceParams::kDefaultDBusDumpSampling;
+    uint32_t                         srpPublishLimit       = otbr::InstanceParams::kDefaultSrpPublishLimit;
+    const char *                     srpStateFile          = kDefaultSrpStateFile;
+    uint32_t                         logQueueSize          = kDefaultLogQueueSize;
+    uint32_t                         logRateLimit          = kDefaultLogRateLimit;
+    uint32_t                         traceRingSize         = kDefaultTraceRingSize;
+    const char *                     configFile            = nullptr;
+    long                             backboneThreadCpu     = otbr::InstanceParams::kBackboneThreadNone;
+    bool                             restThread            = false;
+    unsigned long                    syncListenPort        = 0;
+    const char *                     syncPeer              = nullptr;
+    uint32_t                         syncFailoverTimeout   = otbr::InstanceParams::kDefaultSyncFailoverTimeout;
+    const char *                     captureSocket         = nullptr;
+    const char *                     captureFilter         = nullptr;
+    bool                             capturePromiscuous    = false;
+
+    StartupTimeline::Get().Start();
     std::set_new_handler(OnAllocateFailed);
 
     while ((opt = getopt_long(argc, argv, "B:d:hI:Vv", kOptions, nullptr)) != -1)
@@ -259,6 +527,140 @@ int main(int argc, char *argv[])
             printRadioVersion = true;
             break;
 
+        case OTBR_OPT_WATCHDOG_BUDGET:
+            // Zero disables the watchdog.
+            watchdogBudgetMs = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+
+        case OTBR_OPT_TIMER_SLACK:
+            // Zero wakes the mainloop exactly at each deadline.
+            timerSlackMs = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+
+        case OTBR_OPT_REST_LISTEN_PORT:
+            // Zero only listens on the Unix domain socket.
+            restListenPort = strtoul(optarg, nullptr, 0);
+            VerifyOrExit(restListenPort <= UINT16_MAX, ret = EXIT_FAILURE);
+            break;
+
+        case OTBR_OPT_REST_LISTEN_PATH:
+            restListenPath = optarg;
+            break;
+
+        case OTBR_OPT_REST_DIAG_FRESHNESS:
+            // Zero queries the mesh for every request.
+            restDiagFreshness = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+
+        case OTBR_OPT_REST_DIAG_CRAWL_INTERVAL:
+            // Zero only queries the mesh when a request asks for diagnostics.
+            restDiagCrawlInterval = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+
+        case OTBR_OPT_REST_DIAG_HISTORY_SIZE:
+            // Zero disables the diagnostic history.
+            restDiagHistorySize = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+
+        case OTBR_OPT_REST_MAX_CONNECTIONS:
+            restMaxConnections = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            VerifyOrExit(restMaxConnections > 0, ret = EXIT_FAILURE);
+            break;
+
+        case OTBR_OPT_REST_MAX_CLIENT_CONNECTIONS:
+            // Zero only applies the total limit.
+            restMaxPerClient = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+
+        case OTBR_OPT_REST_DIAG_SWEEP_WINDOW:
+            // Zero queries the routers by multicast.
+            restDiagSweepWindow = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+
+        case OTBR_OPT_REST_DIAG_SWEEP_RETRIES:
+            restDiagSweepRetries = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+
+        case OTBR_OPT_REST_SNAPSHOT_FILE:
+            // An empty path does not save the REST resources across restarts.
+            restSnapshotFile = optarg;
+            break;
+
+        case OTBR_OPT_DBUS_SIGNAL_WINDOW:
+            // Zero signals each property change at once.
+            dbusSignalWindow = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+
+        case OTBR_OPT_DBUS_DUMP_SAMPLING:
+            // Dump one of every N D-Bus messages at info level.
+            dbusDumpSampling = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+
+        case OTBR_OPT_SRP_PUBLISH_LIMIT:
+            // Zero publishes every SRP update at once.
+            srpPublishLimit = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+
+        case OTBR_OPT_SRP_STATE_FILE:
+            // An empty path does not save SRP hosts across restarts.
+            srpStateFile = optarg;
+            break;
+
+        case OTBR_OPT_LOG_QUEUE_SIZE:
+            // Zero writes each log line to syslog on the calling thread.
+            logQueueSize = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+
+        case OTBR_OPT_LOG_RATE_LIMIT:
+            // Zero never suppresses log lines.
+            logRateLimit = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+
+        case OTBR_OPT_TRACE_RING_SIZE:
+            // Zero disables the binary trace.
+            traceRingSize = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+
+        case OTBR_OPT_CONFIG:
+            configFile = optarg;
+            break;
+
+        case OTBR_OPT_BACKBONE_THREAD:
+            // Without a CPU the thread is not pinned.
+            backboneThreadCpu =
+                (optarg == nullptr) ? otbr::InstanceParams::kBackboneThreadAnyCpu : strtol(optarg, nullptr, 0);
+            VerifyOrExit(backboneThreadCpu >= otbr::InstanceParams::kBackboneThreadAnyCpu, ret = EXIT_FAILURE);
+            break;
+
+        case OTBR_OPT_REST_THREAD:
+            restThread = true;
+            break;
+
+        case OTBR_OPT_SYNC_LISTEN_PORT:
+            syncListenPort = strtoul(optarg, nullptr, 0);
+            VerifyOrExit(syncListenPort <= UINT16_MAX, ret = EXIT_FAILURE);
+            break;
+
+        case OTBR_OPT_SYNC_PEER:
+            syncPeer = optarg;
+            break;
+
+        case OTBR_OPT_SYNC_FAILOVER_TIMEOUT:
+            syncFailoverTimeout = static_cast<uint32_t>(strtoul(optarg, nullptr, 0));
+            break;
+
+        case OTBR_OPT_CAPTURE_SOCKET:
+            captureSocket = optarg;
+            break;
+
+        case OTBR_OPT_CAPTURE_FILTER:
+            captureFilter = optarg;
+            break;
+
+        case OTBR_OPT_CAPTURE_PROMISCUOUS:
+            capturePromiscuous = true;
+            break;
+
         default:
             PrintHelp(argv[0]);
             ExitNow(ret = EXIT_FAILURE);
@@ -267,9 +669,45 @@ int main(int argc, char *argv[])
     }
 
     otbrLogInit(kSyslogIdent, logLevel, verbose);
+    otbrLogStartAsync(logQueueSize);
+    otbrLogSetRateLimit(logRateLimit);
+    otbr::Trace::Get().Start(traceRingSize);
     otbrLog(OTBR_LOG_INFO, "Running %s", OTBR_PACKAGE_VERSION);
     VerifyOrExit(optind < argc, ret = EXIT_FAILURE);
 
+    otbr::InstanceParams::Get().SetThreadIfName(interfaceName);
+    otbr::InstanceParams::Get().SetBackboneIfName(backboneInterfaceName);
+    otbr::InstanceParams::Get().SetRestListenPort(static_cast<uint16_t>(restListenPort));
+    otbr::InstanceParams::Get().SetRestListenPath(restListenPath);
+    otbr::InstanceParams::Get().SetRestDiagFreshness(restDiagFreshness);
+    otbr::InstanceParams::Get().SetRestDiagCrawlInterval(restDiagCrawlInterval);
+    otbr::InstanceParams::Get().SetRestDiagHistorySize(restDiagHistorySize);
+    otbr::InstanceParams::Get().SetRestMaxConnections(restMaxConnections);
+    otbr::InstanceParams::Get().SetRestMaxClientConnections(restMaxPerClient);
+    otbr::InstanceParams::Get().SetRestDiagSweepWindow(restDiagSweepWindow);
+    otbr::InstanceParams::Get().SetRestDiagSweepRetries(restDiagSweepRetries);
+    otbr::InstanceParams::Get().SetRestThreadEnabled(restThread);
+    otbr::InstanceParams::Get().SetRestSnapshotFile(restSnapshotFile);
+    otbr::InstanceParams::Get().SetDBusSignalWindow(dbusSignalWindow);
+    otbr::InstanceParams::Get().SetDBusDumpSampling(dbusDumpSampling);
+    otbr::InstanceParams::Get().SetSrpPublishLimit(srpPublishLimit);
+    otbr::InstanceParams::Get().SetSrpStateFile(srpStateFile);
+    otbr::InstanceParams::Get().SetBackboneThreadCpu(static_cast<int>(backboneThreadCpu));
+    otbr::InstanceParams::Get().SetSyncListenPort(static_cast<uint16_t>(syncListenPort));
+    otbr::InstanceParams::Get().SetSyncPeer(syncPeer);
+    otbr::InstanceParams::Get().SetSyncFailoverTimeout(syncFailoverTimeout);
+    otbr::InstanceParams::Get().SetCaptureSocket(captureSocket);
+    otbr::InstanceParams::Get().SetCaptureFilter(captureFilter);
+    otbr::InstanceParams::Get().SetCapturePromiscuous(capturePromiscuous);
+
+    if (configFile != nullptr)
+    {
+        // Settings in the configuration file take precedence over the command line.
+        ConfigReloader::Get().SetPath(configFile);
+        VerifyOrExit(ConfigReloader::Get().Reload() == OTBR_ERROR_NONE, ret = EXIT_FAILURE);
+        backboneInterfaceName = otbr::InstanceParams::Get().GetBackboneIfName();
+    }
+
     ncp           = otbr::Ncp::Controller::Create(interfaceName, argv[optind], backboneInterfaceName);
     ncpOpenThread = static_cast<ControllerOpenThread *>(ncp);
     VerifyOrExit(ncp != nullptr, ret = EXIT_FAILURE);
@@ -280,10 +718,18 @@ int main(int argc, char *argv[])
     {
         otbr::AgentInstance instance(ncp);
 
-        otbr::InstanceParams::Get().SetThreadIfName(interfaceName);
-        otbr::InstanceParams::Get().SetBackboneIfName(backboneInterfaceName);
+#if OTBR_ENABLE_DBUS_SERVER
+        if (!printRadioVersion)
+        {
+            StartDBusConnect(interfaceName, ncpOpenThread);
+        }
+#endif
 
-        SuccessOrExit(ret = instance.Init());
+        {
+            StartupTimeline::Phase phase("agent");
+
+            SuccessOrExit(ret = instance.Init());
+        }
 
         if (printRadioVersion)
         {
@@ -292,10 +738,15 @@ int main(int argc, char *argv[])
         }
 
 #if OTBR_ENABLE_OPENWRT
-        UbusServerInit(ncpOpenThread, &sThreadMutex);
-        std::thread(UbusServerRun).detach();
+        {
+            StartupTimeline::Phase phase("ubus");
+
+            UbusServerInit(ncpOpenThread);
+            std::thread(UbusServerRun).detach();
+        }
 #endif
-        SuccessOrExit(ret = Mainloop(instance, interfaceName));
+        otbr::MainloopPoller::Get().SetTimerSlack(std::chrono::milliseconds(timerSlackMs));
+        SuccessOrExit(ret = Mainloop(instance, watchdogBudgetMs));
     }
 
     otbrLogDeinit();
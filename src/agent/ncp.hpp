@@ -36,12 +36,18 @@
 
 #include "openthread-br/config.h"
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include <netinet/in.h>
 #include <stddef.h>
 
+#include <openthread/backbone_router_ftd.h>
+
 #include "common/mainloop.h"
 #include "common/types.hpp"
-#include "utils/event_emitter.hpp"
+#include "utils/event_bus.hpp"
 
 namespace otbr {
 
@@ -62,24 +68,45 @@ namespace Ncp {
  */
 enum
 {
-    kEventExtPanId,                        ///< Extended PAN ID arrived.
-    kEventNetworkName,                     ///< Network name arrived.
-    kEventPSKc,                            ///< PSKc arrived.
-    kEventThreadState,                     ///< Thread State.
-    kEventThreadVersion,                   ///< Thread Version.
-    kEventUdpForwardStream,                ///< UDP forward stream arrived.
-    kEventBackboneRouterState,             ///< Backbone Router State.
-    kEventBackboneRouterDomainPrefixEvent, ///< Backbone Router Domain Prefix event.
-    kEventBackboneRouterNdProxyEvent,      ///< Backbone Router ND Proxy event arrived.
+    kEventExtPanId,                             ///< Extended PAN ID arrived.
+    kEventNetworkName,                          ///< Network name arrived.
+    kEventPSKc,                                 ///< PSKc arrived.
+    kEventThreadState,                          ///< Thread State.
+    kEventThreadVersion,                        ///< Thread Version.
+    kEventUdpForwardStream,                     ///< UDP forward stream arrived.
+    kEventBackboneRouterState,                  ///< Backbone Router State.
+    kEventBackboneRouterDomainPrefixEvent,      ///< Backbone Router Domain Prefix event.
+    kEventBackboneRouterNdProxyEvent,           ///< Backbone Router ND Proxy event arrived.
+    kEventBackboneRouterMulticastListenerEvent, ///< Backbone Router Multicast Listener event arrived.
 };
 
+/**
+ * The events of the NCP Controller, indexed by the NCP event ids.
+ *
+ */
+typedef EventBus<
+    Event<const uint8_t *>,                                              // kEventExtPanId
+    Event<const char *>,                                                 // kEventNetworkName
+    Event<const uint8_t *>,                                              // kEventPSKc
+    Event<bool>,                                                         // kEventThreadState
+    Event<uint16_t>,                                                     // kEventThreadVersion
+    Event<>,                                                             // kEventUdpForwardStream
+    Event<>,                                                             // kEventBackboneRouterState
+    Event<otBackboneRouterDomainPrefixEvent, const otIp6Prefix *>,       // kEventBackboneRouterDomainPrefixEvent
+    Event<otBackboneRouterNdProxyEvent, const otIp6Address *>,           // kEventBackboneRouterNdProxyEvent
+    Event<otBackboneRouterMulticastListenerEvent, const otIp6Address *>> // kEventBackboneRouterMulticastListenerEvent
+    ControllerEvents;
+
+static_assert(ControllerEvents::kNumEvents == kEventBackboneRouterMulticastListenerEvent + 1,
+              "Each NCP event must have an Event type");
+
 using PowerMap = std::map<std::string, std::vector<int8_t>>;
 
 /**
  * This interface defines NCP Controller functionality.
  *
  */
-class Controller : public EventEmitter
+class Controller : public ControllerEvents
 {
 public:
     /**
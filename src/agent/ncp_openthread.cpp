@@ -47,6 +47,7 @@
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/startup_timeline.hpp"
 #include "common/types.hpp"
 
 #if OTBR_ENABLE_LEGACY
@@ -54,11 +55,29 @@
 #endif
 
 static bool sReset;
+
+// OpenThread passes no context to the neighbor table callback, there is a single controller per process.
+static otbr::Ncp::ControllerOpenThread *sNeighborTableController;
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
 using std::chrono::seconds;
 using std::chrono::steady_clock;
 
+// How often the RCP link statistics are sampled, each sample waits for one spinel property get.
+static const seconds kRcpStatsInterval(10);
+
+// The state changes after which the role, the partition and the parent are compared with the logged ones.
+static constexpr otChangedFlags kChurnFlags = OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID |
+                                              OT_CHANGED_THREAD_RLOC_ADDED | OT_CHANGED_PARENT_LINK_QUALITY;
+
+// How long a soft reset waits for Thread to attach again before reporting it down.
+static const seconds kSoftResetGracePeriod(10);
+
+// The state changes reported when the active dataset differs after a soft reset.
+static constexpr otChangedFlags kDatasetChangedFlags =
+    OT_CHANGED_ACTIVE_DATASET | OT_CHANGED_THREAD_NETWORK_NAME | OT_CHANGED_THREAD_EXT_PANID |
+    OT_CHANGED_THREAD_PANID | OT_CHANGED_THREAD_CHANNEL | OT_CHANGED_PSKC;
+
 namespace otbr {
 namespace Ncp {
 
@@ -67,8 +86,12 @@ ControllerOpenThread::ControllerOpenThread(const char *aInterfaceName,
                                            const char *aBackboneInterfaceName)
     : mInstance(nullptr)
     , mTriedAttach(false)
+    , mPendingStateChanges(0)
+    , mChurnRole(OT_DEVICE_ROLE_DISABLED)
+    , mChurnPartitionId(0)
 {
     memset(&mConfig, 0, sizeof(mConfig));
+    memset(&mChurnParent, 0, sizeof(mChurnParent));
 
     mConfig.mInterfaceName         = aInterfaceName;
     mConfig.mBackboneInterfaceName = aBackboneInterfaceName;
@@ -78,11 +101,30 @@ ControllerOpenThread::ControllerOpenThread(const char *aInterfaceName,
 
 ControllerOpenThread::~ControllerOpenThread(void)
 {
+    sNeighborTableController = nullptr;
     otInstanceFinalize(mInstance);
     otSysDeinit();
 }
 
 otbrError ControllerOpenThread::Init(void)
+{
+    otbrError error;
+
+    SuccessOrExit(error = InitInstance());
+    mThreadHelper = std::unique_ptr<otbr::agent::ThreadHelper>(new otbr::agent::ThreadHelper(mInstance, this));
+
+    // The sampling keeps running across resets.
+    if (!mRcpStatsTimer.IsPending())
+    {
+        mRcpStats.Init(mConfig.mRadioUrl);
+        HandleRcpStatsTimer();
+    }
+
+exit:
+    return error;
+}
+
+otbrError ControllerOpenThread::UpdateLogLevel(void)
 {
     otbrError  error = OTBR_ERROR_NONE;
     otLogLevel level = OT_LOG_LEVEL_NONE;
@@ -113,6 +155,16 @@ otbrError ControllerOpenThread::Init(void)
     }
     VerifyOrExit(otLoggingSetLevel(level) == OT_ERROR_NONE, error = OTBR_ERROR_OPENTHREAD);
 
+exit:
+    return error;
+}
+
+otbrError ControllerOpenThread::InitInstance(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = UpdateLogLevel());
+
     mInstance = otSysInit(&mConfig);
     otCliUartInit(mInstance);
 #if OTBR_ENABLE_LEGACY
@@ -126,35 +178,62 @@ otbrError ControllerOpenThread::Init(void)
         VerifyOrExit(result == OT_ERROR_NONE, error = OTBR_ERROR_OPENTHREAD);
     }
 
+    sNeighborTableController = this;
+    otThreadRegisterNeighborTableCallback(mInstance, &ControllerOpenThread::HandleNeighborTableEvent);
+
 #if OTBR_ENABLE_BACKBONE_ROUTER
     otBackboneRouterSetDomainPrefixCallback(mInstance, &ControllerOpenThread::HandleBackboneRouterDomainPrefixEvent,
                                             this);
     otBackboneRouterSetNdProxyCallback(mInstance, &ControllerOpenThread::HandleBackboneRouterNdProxyEvent, this);
+    otBackboneRouterSetMulticastListenerCallback(
+        mInstance, &ControllerOpenThread::HandleBackboneRouterMulticastListenerEvent, this);
 #endif
 
 #if OTBR_ENABLE_SRP_ADVERTISING_PROXY
     otSrpServerSetEnabled(mInstance, /* aEnabled */ true);
 #endif
 
-    mThreadHelper = std::unique_ptr<otbr::agent::ThreadHelper>(new otbr::agent::ThreadHelper(mInstance, this));
-
 exit:
     return error;
 }
 
+void ControllerOpenThread::HandleRcpStatsTimer(void)
+{
+    mRcpStats.Sample(mInstance);
+    mRcpStatsTimer = PostTimerTask(steady_clock::now() + kRcpStatsInterval, [this]() { HandleRcpStatsTimer(); });
+}
+
 void ControllerOpenThread::HandleStateChanged(otChangedFlags aFlags)
 {
-    if (aFlags & OT_CHANGED_THREAD_NETWORK_NAME)
+    // Only collect the flags, the subscribers are called from `Process()` once the OpenThread callbacks returned.
+    mPendingStateChanges |= aFlags;
+}
+
+void ControllerOpenThread::DispatchStateChanged(void)
+{
+    otChangedFlags flags = mPendingStateChanges;
+
+    VerifyOrExit(flags != 0);
+
+    // Handlers may change the state again, these changes are dispatched in the next mainloop iteration.
+    mPendingStateChanges = 0;
+
+    if (flags & kChurnFlags)
     {
-        EventEmitter::Emit(kEventNetworkName, otThreadGetNetworkName(mInstance));
+        RecordChurn();
     }
 
-    if (aFlags & OT_CHANGED_THREAD_EXT_PANID)
+    if (flags & OT_CHANGED_THREAD_NETWORK_NAME)
     {
-        EventEmitter::Emit(kEventExtPanId, otThreadGetExtendedPanId(mInstance));
+        Emit<kEventNetworkName>(otThreadGetNetworkName(mInstance));
     }
 
-    if (aFlags & OT_CHANGED_THREAD_ROLE)
+    if (flags & OT_CHANGED_THREAD_EXT_PANID)
+    {
+        Emit<kEventExtPanId>(otThreadGetExtendedPanId(mInstance)->m8);
+    }
+
+    if (flags & OT_CHANGED_THREAD_ROLE)
     {
         bool attached = false;
 
@@ -177,17 +256,92 @@ void ControllerOpenThread::HandleStateChanged(otChangedFlags aFlags)
             break;
         }
 
-        EventEmitter::Emit(kEventThreadState, attached);
+        if (attached)
+        {
+            mSoftResetTimer.Cancel();
+            StartupTimeline::Get().MarkAttached();
+        }
+
+        // After a soft reset, detached is reported when the grace period ends without attaching.
+        if (attached || !mSoftResetTimer.IsPending())
+        {
+            Emit<kEventThreadState>(attached);
+        }
     }
 
 #if OTBR_ENABLE_BACKBONE_ROUTER
-    if (aFlags & OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE)
+    if (flags & OT_CHANGED_THREAD_BACKBONE_ROUTER_STATE)
     {
-        EventEmitter::Emit(kEventBackboneRouterState);
+        Emit<kEventBackboneRouterState>();
     }
 #endif
 
-    mThreadHelper->StateChangedCallback(aFlags);
+    mThreadHelper->StateChangedCallback(flags);
+
+    for (auto &handler : mStateChangedHandlers)
+    {
+        if (flags & handler.mMask)
+        {
+            handler.mHandler(flags & handler.mMask);
+        }
+    }
+
+exit:
+    return;
+}
+
+static uint64_t GetUnixTimeMs(void)
+{
+    using std::chrono::milliseconds;
+    using std::chrono::system_clock;
+
+    return static_cast<uint64_t>(duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count());
+}
+
+void ControllerOpenThread::RecordChurn(void)
+{
+    otDeviceRole role      = otThreadGetDeviceRole(mInstance);
+    uint16_t     rloc16    = otThreadGetRloc16(mInstance);
+    uint64_t     timestamp = GetUnixTimeMs();
+
+    if (role != mChurnRole)
+    {
+        mChurnRole = role;
+        mChurnLog.Add(ChurnLog::kTypeRoleChanged, timestamp, nullptr, rloc16, role);
+    }
+
+    if (role == OT_DEVICE_ROLE_DISABLED || role == OT_DEVICE_ROLE_DETACHED)
+    {
+        // Attaching again to the same parent or partition after a detach is logged as a change.
+        mChurnPartitionId = 0;
+        memset(&mChurnParent, 0, sizeof(mChurnParent));
+        ExitNow();
+    }
+
+    if (otThreadGetPartitionId(mInstance) != mChurnPartitionId)
+    {
+        mChurnPartitionId = otThreadGetPartitionId(mInstance);
+        mChurnLog.Add(ChurnLog::kTypePartitionChanged, timestamp, nullptr, rloc16, mChurnPartitionId);
+    }
+
+    if (role == OT_DEVICE_ROLE_CHILD)
+    {
+        otRouterInfo parent;
+
+        if (otThreadGetParentInfo(mInstance, &parent) == OT_ERROR_NONE &&
+            memcmp(&parent.mExtAddress, &mChurnParent, sizeof(mChurnParent)) != 0)
+        {
+            mChurnParent = parent.mExtAddress;
+            mChurnLog.Add(ChurnLog::kTypeParentChanged, timestamp, &parent.mExtAddress, parent.mRloc16, 0);
+        }
+    }
+    else
+    {
+        memset(&mChurnParent, 0, sizeof(mChurnParent));
+    }
+
+exit:
+    return;
 }
 
 static struct timeval ToTimeVal(const microseconds &aTime)
@@ -206,19 +360,22 @@ void ControllerOpenThread::UpdateFdSet(otSysMainloopContext &aMainloop)
     microseconds timeout = microseconds(aMainloop.mTimeout.tv_usec) + seconds(aMainloop.mTimeout.tv_sec);
     auto         now     = steady_clock::now();
 
-    if (otTaskletsArePending(mInstance))
+    // A reset requested by OpenThread is done by the mainloop once the poll returns.
+    if (otTaskletsArePending(mInstance) || mPendingStateChanges != 0 || sReset)
     {
         timeout = microseconds::zero();
     }
-    else if (!mTimers.empty())
+    else if (mTimerWheel.GetSize() > 0)
     {
-        if (mTimers.begin()->first < now)
+        auto fireTime = mTimerWheel.GetNextFireTime();
+
+        if (fireTime < now)
         {
             timeout = microseconds::zero();
         }
         else
         {
-            timeout = std::min(timeout, duration_cast<microseconds>(mTimers.begin()->first - now));
+            timeout = std::min(timeout, duration_cast<microseconds>(fireTime - now));
         }
     }
 
@@ -235,16 +392,14 @@ void ControllerOpenThread::Process(const otSysMainloopContext &aMainloop)
 
     otSysMainloopProcess(mInstance, &aMainloop);
 
-    while (!mTimers.empty() && mTimers.begin()->first <= now)
-    {
-        mTimers.begin()->second();
-        mTimers.erase(mTimers.begin());
-    }
+    mTimerWheel.Process(now);
 
     if (!mTriedAttach && mThreadHelper->TryResumeNetwork() == OT_ERROR_NONE)
     {
         mTriedAttach = true;
     }
+
+    DispatchStateChanged();
 }
 
 void ControllerOpenThread::Reset(void)
@@ -254,6 +409,11 @@ void ControllerOpenThread::Reset(void)
     otInstanceFinalize(mInstance);
     otSysDeinit();
     Init();
+    mSoftResetTimer.Cancel();
+    for (auto &handler : mSoftResetHandlers)
+    {
+        handler();
+    }
     for (auto &handler : mResetHandlers)
     {
         handler();
@@ -262,6 +422,53 @@ void ControllerOpenThread::Reset(void)
     sReset       = false;
 }
 
+void ControllerOpenThread::SoftReset(void)
+{
+    otOperationalDatasetTlvs datasetTlvs;
+    otOperationalDatasetTlvs newDatasetTlvs;
+    otDeviceRole             role = otThreadGetDeviceRole(mInstance);
+
+    gPlatResetReason = OT_PLAT_RESET_REASON_SOFTWARE;
+
+    if (otDatasetGetActiveTlvs(mInstance, &datasetTlvs) != OT_ERROR_NONE)
+    {
+        datasetTlvs.mLength = 0;
+    }
+
+    otInstanceFinalize(mInstance);
+    otSysDeinit();
+    otbrLogResult(InitInstance(), "Re-initialize OpenThread");
+    mThreadHelper->HandleSoftReset(mInstance);
+
+    if (otDatasetGetActiveTlvs(mInstance, &newDatasetTlvs) != OT_ERROR_NONE)
+    {
+        newDatasetTlvs.mLength = 0;
+    }
+
+    // The new instance starts disabled without any neighbor, the other state is only reported if it changed.
+    mPendingStateChanges |= OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_CHILD_REMOVED;
+
+    if (newDatasetTlvs.mLength != datasetTlvs.mLength ||
+        memcmp(newDatasetTlvs.mTlvs, datasetTlvs.mTlvs, datasetTlvs.mLength) != 0)
+    {
+        mPendingStateChanges |= kDatasetChangedFlags;
+    }
+
+    if (role == OT_DEVICE_ROLE_CHILD || role == OT_DEVICE_ROLE_ROUTER || role == OT_DEVICE_ROLE_LEADER)
+    {
+        mSoftResetTimer.Cancel();
+        mSoftResetTimer = PostTimerTask(steady_clock::now() + kSoftResetGracePeriod,
+                                        [this]() { (void)RequestEvent(kEventThreadState); });
+    }
+
+    for (auto &handler : mSoftResetHandlers)
+    {
+        handler();
+    }
+    mTriedAttach = false;
+    sReset       = false;
+}
+
 bool ControllerOpenThread::IsResetRequested(void)
 {
     return sReset;
@@ -275,7 +482,7 @@ otbrError ControllerOpenThread::RequestEvent(int aEvent)
     {
     case kEventExtPanId:
     {
-        EventEmitter::Emit(kEventExtPanId, otThreadGetExtendedPanId(mInstance));
+        Emit<kEventExtPanId>(otThreadGetExtendedPanId(mInstance)->m8);
         break;
     }
     case kEventThreadState:
@@ -293,22 +500,27 @@ otbrError ControllerOpenThread::RequestEvent(int aEvent)
             break;
         }
 
-        EventEmitter::Emit(kEventThreadState, attached);
+        if (attached)
+        {
+            StartupTimeline::Get().MarkAttached();
+        }
+
+        Emit<kEventThreadState>(attached);
         break;
     }
     case kEventNetworkName:
     {
-        EventEmitter::Emit(kEventNetworkName, otThreadGetNetworkName(mInstance));
+        Emit<kEventNetworkName>(otThreadGetNetworkName(mInstance));
         break;
     }
     case kEventPSKc:
     {
-        EventEmitter::Emit(kEventPSKc, otThreadGetPskc(mInstance));
+        Emit<kEventPSKc>(otThreadGetPskc(mInstance)->m8);
         break;
     }
     case kEventThreadVersion:
     {
-        EventEmitter::Emit(kEventThreadVersion, otThreadGetVersion());
+        Emit<kEventThreadVersion>(otThreadGetVersion());
         break;
     }
     default:
@@ -319,10 +531,10 @@ otbrError ControllerOpenThread::RequestEvent(int aEvent)
     return ret;
 }
 
-void ControllerOpenThread::PostTimerTask(std::chrono::steady_clock::time_point aTimePoint,
-                                         const std::function<void(void)> &     aTask)
+TimerWheel::Handle ControllerOpenThread::PostTimerTask(std::chrono::steady_clock::time_point aTimePoint,
+                                                       TimerWheel::Task                      aTask)
 {
-    mTimers.insert({aTimePoint, aTask});
+    return TimerWheel::Handle(mTimerWheel, mTimerWheel.Add(aTimePoint, std::move(aTask)));
 }
 
 void ControllerOpenThread::RegisterResetHandler(std::function<void(void)> aHandler)
@@ -330,6 +542,50 @@ void ControllerOpenThread::RegisterResetHandler(std::function<void(void)> aHandl
     mResetHandlers.emplace_back(std::move(aHandler));
 }
 
+void ControllerOpenThread::RegisterSoftResetHandler(std::function<void(void)> aHandler)
+{
+    mSoftResetHandlers.emplace_back(std::move(aHandler));
+}
+
+void ControllerOpenThread::RegisterStateChangedHandler(otChangedFlags                      aMask,
+                                                       std::function<void(otChangedFlags)> aHandler)
+{
+    mStateChangedHandlers.push_back({aMask, std::move(aHandler)});
+}
+
+void ControllerOpenThread::RegisterNeighborTableHandler(NeighborTableHandler aHandler)
+{
+    mNeighborTableHandlers.emplace_back(std::move(aHandler));
+}
+
+void ControllerOpenThread::HandleNeighborTableEvent(otNeighborTableEvent            aEvent,
+                                                    const otNeighborTableEntryInfo *aEntryInfo)
+{
+    VerifyOrExit(sNeighborTableController != nullptr && aEntryInfo != nullptr);
+    sNeighborTableController->HandleNeighborTableEvent(aEvent, *aEntryInfo);
+
+exit:
+    return;
+}
+
+void ControllerOpenThread::HandleNeighborTableEvent(otNeighborTableEvent            aEvent,
+                                                    const otNeighborTableEntryInfo &aEntryInfo)
+{
+    if (aEvent == OT_NEIGHBOR_TABLE_EVENT_CHILD_ADDED || aEvent == OT_NEIGHBOR_TABLE_EVENT_CHILD_REMOVED)
+    {
+        const otChildInfo &child = aEntryInfo.mInfo.mChild;
+
+        mChurnLog.Add(aEvent == OT_NEIGHBOR_TABLE_EVENT_CHILD_ADDED ? ChurnLog::kTypeChildAdded
+                                                                    : ChurnLog::kTypeChildRemoved,
+                      GetUnixTimeMs(), &child.mExtAddress, child.mRloc16, 0);
+    }
+
+    for (auto &handler : mNeighborTableHandlers)
+    {
+        handler(aEvent, aEntryInfo);
+    }
+}
+
 #if OTBR_ENABLE_BACKBONE_ROUTER
 void ControllerOpenThread::HandleBackboneRouterDomainPrefixEvent(void *                            aContext,
                                                                  otBackboneRouterDomainPrefixEvent aEvent,
@@ -341,7 +597,7 @@ void ControllerOpenThread::HandleBackboneRouterDomainPrefixEvent(void *
 void ControllerOpenThread::HandleBackboneRouterDomainPrefixEvent(otBackboneRouterDomainPrefixEvent aEvent,
                                                                  const otIp6Prefix *               aDomainPrefix)
 {
-    EventEmitter::Emit(kEventBackboneRouterDomainPrefixEvent, aEvent, aDomainPrefix);
+    Emit<kEventBackboneRouterDomainPrefixEvent>(aEvent, aDomainPrefix);
 }
 
 void ControllerOpenThread::HandleBackboneRouterNdProxyEvent(void *                       aContext,
@@ -354,7 +610,20 @@ void ControllerOpenThread::HandleBackboneRouterNdProxyEvent(void *
 void ControllerOpenThread::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent,
                                                             const otIp6Address *         aAddress)
 {
-    EventEmitter::Emit(kEventBackboneRouterNdProxyEvent, aEvent, aAddress);
+    Emit<kEventBackboneRouterNdProxyEvent>(aEvent, aAddress);
+}
+
+void ControllerOpenThread::HandleBackboneRouterMulticastListenerEvent(void *                                 aContext,
+                                                                      otBackboneRouterMulticastListenerEvent aEvent,
+                                                                      const otIp6Address *                   aAddress)
+{
+    static_cast<ControllerOpenThread *>(aContext)->HandleBackboneRouterMulticastListenerEvent(aEvent, aAddress);
+}
+
+void ControllerOpenThread::HandleBackboneRouterMulticastListenerEvent(otBackboneRouterMulticastListenerEvent aEvent,
+                                                                      const otIp6Address *                   aAddress)
+{
+    Emit<kEventBackboneRouterMulticastListenerEvent>(aEvent, aAddress);
 }
 #endif
 
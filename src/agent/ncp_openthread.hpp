@@ -41,9 +41,13 @@
 #include <openthread/cli.h>
 #include <openthread/instance.h>
 #include <openthread/openthread-system.h>
+#include <openthread/thread_ftd.h>
 
 #include "ncp.hpp"
+#include "agent/churn_log.hpp"
+#include "agent/rcp_stats.hpp"
 #include "agent/thread_helper.hpp"
+#include "common/timer_wheel.hpp"
 
 namespace otbr {
 namespace Ncp {
@@ -55,6 +59,8 @@ namespace Ncp {
 class ControllerOpenThread : public Controller
 {
 public:
+    using NeighborTableHandler = std::function<void(otNeighborTableEvent, const otNeighborTableEntryInfo &)>;
+
     /**
      * This constructor initializes this object.
      *
@@ -89,6 +95,23 @@ public:
      */
     otbr::agent::ThreadHelper *GetThreadHelper(void) { return mThreadHelper.get(); }
 
+    /**
+     * This method returns the statistics of the link to the RCP.
+     *
+     * @returns The RCP link statistics, sampled every few seconds.
+     *
+     */
+    const RcpStats &GetRcpStats(void) const { return mRcpStats; }
+
+    /**
+     * This method returns the log of the children attaching and detaching and of the parent, role and partition
+     * changes.
+     *
+     * @returns The churn log.
+     *
+     */
+    const ChurnLog &GetChurnLog(void) const { return mChurnLog; }
+
     /**
      * This method updates the fd_set to poll.
      *
@@ -108,9 +131,23 @@ public:
     /**
      * This method reset the NCP controller.
      *
+     * The thread helper is created again, so the operations in progress are dropped, and the handlers registered
+     * with `RegisterSoftResetHandler()` and `RegisterResetHandler()` are called.
+     *
      */
     void Reset(void) override;
 
+    /**
+     * This method re-initializes the OpenThread instance and keeps the rest of the agent running.
+     *
+     * The thread helper is kept, the operations in progress are ended and the unsecure ports still open are opened
+     * again. Only the state changes caused by the reset are dispatched, and if Thread was attached, the detached state
+     * is reported after a grace period so that a quick re-attach keeps the published services. Only the handlers
+     * registered with `RegisterSoftResetHandler()` are called.
+     *
+     */
+    void SoftReset(void);
+
     /**
      * This method return whether reset is requested.
      *
@@ -134,11 +171,16 @@ public:
     /**
      * This method posts a task to the timer
      *
+     * Tasks due within the same `TimerWheel::kTick` are run together. The task is stored inline without
+     * allocating memory, see `TimerWheel::Task`.
+     *
      * @param[in]   aTimePoint  The timepoint to trigger the task.
      * @param[in]   aTask       The task function.
      *
+     * @returns The handle to cancel or reschedule the task.
+     *
      */
-    void PostTimerTask(std::chrono::steady_clock::time_point aTimePoint, const std::function<void(void)> &aTask);
+    TimerWheel::Handle PostTimerTask(std::chrono::steady_clock::time_point aTimePoint, TimerWheel::Task aTask);
 
     /**
      * This method registers a reset handler.
@@ -148,14 +190,64 @@ public:
      */
     void RegisterResetHandler(std::function<void(void)> aHandler);
 
+    /**
+     * This method registers a handler called after the OpenThread instance is re-initialized.
+     *
+     * The handler is called on both `SoftReset()` and `Reset()`, it restores the OpenThread callbacks and drops the
+     * state the new instance no longer has.
+     *
+     * @param[in]   aHandler  The handler function.
+     *
+     */
+    void RegisterSoftResetHandler(std::function<void(void)> aHandler);
+
+    /**
+     * This method registers a handler called with the OpenThread state changes matching @p aMask.
+     *
+     * State changes are collected while OpenThread runs and dispatched once per mainloop iteration at the end of
+     * `Process()`, so the handler sees the union of the flags changed since the previous dispatch.
+     *
+     * @param[in]   aMask     The flags the handler is interested in.
+     * @param[in]   aHandler  The handler function.
+     *
+     */
+    void RegisterStateChangedHandler(otChangedFlags aMask, std::function<void(otChangedFlags)> aHandler);
+
+    /**
+     * This method registers a handler called when a child or a router neighbor is added or removed.
+     *
+     * OpenThread only takes a single neighbor table callback, which this controller fans out to the handlers.
+     *
+     * @param[in]   aHandler  The handler function.
+     *
+     */
+    void RegisterNeighborTableHandler(NeighborTableHandler aHandler);
+
+    /**
+     * This method sets the OpenThread log level to match the agent log level.
+     *
+     * @retval  OTBR_ERROR_NONE         Successfully set the log level.
+     * @retval  OTBR_ERROR_OPENTHREAD   Failed to set the log level.
+     *
+     */
+    otbrError UpdateLogLevel(void);
+
     ~ControllerOpenThread(void) override;
 
 private:
+    otbrError InitInstance(void);
+    void      HandleRcpStatsTimer(void);
+
     static void HandleStateChanged(otChangedFlags aFlags, void *aContext)
     {
         static_cast<ControllerOpenThread *>(aContext)->HandleStateChanged(aFlags);
     }
     void HandleStateChanged(otChangedFlags aFlags);
+    void DispatchStateChanged(void);
+    void RecordChurn(void);
+
+    static void HandleNeighborTableEvent(otNeighborTableEvent aEvent, const otNeighborTableEntryInfo *aEntryInfo);
+    void        HandleNeighborTableEvent(otNeighborTableEvent aEvent, const otNeighborTableEntryInfo &aEntryInfo);
 
     static void HandleBackboneRouterDomainPrefixEvent(void *                            aContext,
                                                       otBackboneRouterDomainPrefixEvent aEvent,
@@ -174,13 +266,30 @@ private:
     void        HandleBackboneRouterMulticastListenerEvent(otBackboneRouterMulticastListenerEvent aEvent,
                                                            const otIp6Address *                   aAddress);
 
+    struct StateChangedHandler
+    {
+        otChangedFlags                      mMask;
+        std::function<void(otChangedFlags)> mHandler;
+    };
+
     otInstance *mInstance;
 
-    otPlatformConfig                                                                mConfig;
-    std::unique_ptr<otbr::agent::ThreadHelper>                                      mThreadHelper;
-    std::multimap<std::chrono::steady_clock::time_point, std::function<void(void)>> mTimers;
-    bool                                                                            mTriedAttach;
-    std::vector<std::function<void(void)>>                                          mResetHandlers;
+    otPlatformConfig                           mConfig;
+    std::unique_ptr<otbr::agent::ThreadHelper> mThreadHelper;
+    TimerWheel                                 mTimerWheel;
+    bool                                       mTriedAttach;
+    otChangedFlags                             mPendingStateChanges;
+    std::vector<std::function<void(void)>>     mResetHandlers;
+    std::vector<std::function<void(void)>>     mSoftResetHandlers;
+    TimerWheel::Handle                         mSoftResetTimer;
+    RcpStats                                   mRcpStats;
+    TimerWheel::Handle                         mRcpStatsTimer;
+    ChurnLog                                   mChurnLog;
+    otDeviceRole                               mChurnRole;
+    uint32_t                                   mChurnPartitionId;
+    otExtAddress                               mChurnParent;
+    std::vector<StateChangedHandler>           mStateChangedHandlers;
+    std::vector<NeighborTableHandler>          mNeighborTableHandlers;
 };
 
 } // namespace Ncp
@@ -0,0 +1,235 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the statistics of the link to the RCP.
+ */
+
+#include "agent/rcp_stats.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <string>
+
+#if __linux__
+#include <linux/serial.h>
+#include <sys/ioctl.h>
+#endif
+
+#include <openthread/link.h>
+#include <openthread/platform/radio.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+// Counters read from OpenThread are 32 bits and restart from 0 when the instance is re-initialized.
+static uint32_t GetDelta(uint32_t aLast, uint32_t aCurrent)
+{
+    return aCurrent >= aLast ? aCurrent - aLast : aCurrent;
+}
+
+static uint32_t GetRate(uint64_t aDelta, uint32_t aIntervalMs)
+{
+    return aIntervalMs == 0 ? 0 : static_cast<uint32_t>(aDelta * 1000 / aIntervalMs);
+}
+
+RcpStats::RcpStats(void)
+    : mLastTxTotal(0)
+    , mLastRxTotal(0)
+    , mLastTxRetry(0)
+    , mLastUartTx(0)
+    , mLastUartRx(0)
+    , mUartFd(-1)
+    , mLatencySupported(true)
+{
+    memset(&mCounters, 0, sizeof(mCounters));
+    memset(&mLatency, 0, sizeof(mLatency));
+}
+
+RcpStats::~RcpStats(void)
+{
+    if (mUartFd >= 0)
+    {
+        close(mUartFd);
+    }
+}
+
+void RcpStats::Init(const char *aRadioUrl)
+{
+#if __linux__ && defined(TIOCGICOUNT)
+    std::string                  url = aRadioUrl;
+    std::string                  path;
+    size_t                       schemeEnd;
+    struct serial_icounter_struct icount;
+
+    // e.g. "spinel+hdlc+uart:///dev/ttyUSB0?uart-baudrate=460800"
+    schemeEnd = url.find("://");
+    VerifyOrExit(schemeEnd != std::string::npos && url.rfind("uart", schemeEnd) != std::string::npos);
+    path = url.substr(schemeEnd + sizeof("://") - 1);
+    path = path.substr(0, path.find('?'));
+
+    // Opened only to query the driver, the RCP is read and written by OpenThread.
+    mUartFd = open(path.c_str(), O_RDONLY | O_NOCTTY | O_NONBLOCK | O_CLOEXEC);
+    VerifyOrExit(mUartFd >= 0, otbrLog(OTBR_LOG_WARNING, "Failed to open %s for counters: %s", path.c_str(),
+                                       strerror(errno)));
+
+    if (ioctl(mUartFd, TIOCGICOUNT, &icount) != 0)
+    {
+        otbrLog(OTBR_LOG_INFO, "UART %s has no counters: %s", path.c_str(), strerror(errno));
+        close(mUartFd);
+        mUartFd = -1;
+        ExitNow();
+    }
+
+    // Only the bytes since the agent started are counted.
+    mLastUartTx = static_cast<uint32_t>(icount.tx);
+    mLastUartRx = static_cast<uint32_t>(icount.rx);
+
+exit:
+    return;
+#else
+    OTBR_UNUSED_VARIABLE(aRadioUrl);
+#endif
+}
+
+void RcpStats::Sample(otInstance *aInstance)
+{
+    auto     now        = std::chrono::steady_clock::now();
+    uint32_t intervalMs = 0;
+
+    if (mLastSampleTime != std::chrono::steady_clock::time_point())
+    {
+        intervalMs = static_cast<uint32_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(now - mLastSampleTime).count());
+    }
+
+    mLastSampleTime = now;
+
+    SampleMacCounters(aInstance, intervalMs);
+    SampleUartCounters(intervalMs);
+    MeasureLatency(aInstance);
+}
+
+void RcpStats::SampleMacCounters(otInstance *aInstance, uint32_t aIntervalMs)
+{
+    const otMacCounters *macCounters = otLinkGetCounters(aInstance);
+    uint32_t             txFrames    = GetDelta(mLastTxTotal, macCounters->mTxTotal);
+    uint32_t             rxFrames    = GetDelta(mLastRxTotal, macCounters->mRxTotal);
+
+    mCounters.mTxFrames += txFrames;
+    mCounters.mRxFrames += rxFrames;
+    mCounters.mTxRetries += GetDelta(mLastTxRetry, macCounters->mTxRetry);
+    mCounters.mTxFrameRate = GetRate(txFrames, aIntervalMs);
+    mCounters.mRxFrameRate = GetRate(rxFrames, aIntervalMs);
+
+    mLastTxTotal = macCounters->mTxTotal;
+    mLastRxTotal = macCounters->mRxTotal;
+    mLastTxRetry = macCounters->mTxRetry;
+}
+
+void RcpStats::SampleUartCounters(uint32_t aIntervalMs)
+{
+#if __linux__ && defined(TIOCGICOUNT)
+    struct serial_icounter_struct icount;
+    uint32_t                      txBytes;
+    uint32_t                      rxBytes;
+
+    VerifyOrExit(mUartFd >= 0);
+    VerifyOrExit(ioctl(mUartFd, TIOCGICOUNT, &icount) == 0);
+
+    // The driver counters are never reset but wrap around.
+    txBytes = static_cast<uint32_t>(icount.tx) - mLastUartTx;
+    rxBytes = static_cast<uint32_t>(icount.rx) - mLastUartRx;
+
+    mCounters.mTxBytes += txBytes;
+    mCounters.mRxBytes += rxBytes;
+    mCounters.mTxByteRate      = GetRate(txBytes, aIntervalMs);
+    mCounters.mRxByteRate      = GetRate(rxBytes, aIntervalMs);
+    mCounters.mUartOverruns    = static_cast<uint32_t>(icount.overrun) + static_cast<uint32_t>(icount.buf_overrun);
+    mCounters.mUartFrameErrors = static_cast<uint32_t>(icount.frame);
+
+    mLastUartTx = static_cast<uint32_t>(icount.tx);
+    mLastUartRx = static_cast<uint32_t>(icount.rx);
+
+exit:
+    return;
+#else
+    OTBR_UNUSED_VARIABLE(aIntervalMs);
+#endif
+}
+
+void RcpStats::MeasureLatency(otInstance *aInstance)
+{
+    int8_t   txPower;
+    otError  error;
+    uint64_t durationUs;
+    auto     start = std::chrono::steady_clock::now();
+
+    VerifyOrExit(mLatencySupported);
+
+    // With an RCP, the transmit power is not cached by the host and every read is a spinel property get.
+    error      = otPlatRadioGetTransmitPower(aInstance, &txPower);
+    durationUs = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+
+    switch (error)
+    {
+    case OT_ERROR_NONE:
+        mLatency.mCount++;
+        mLatency.mTotalUs += durationUs;
+        mLatency.mBuckets[MainloopStats::GetBucket(durationUs)]++;
+
+        if (durationUs > mLatency.mMaxUs)
+        {
+            mLatency.mMaxUs = durationUs;
+        }
+        break;
+    case OT_ERROR_RESPONSE_TIMEOUT:
+        mCounters.mTimeouts++;
+        break;
+    case OT_ERROR_NOT_IMPLEMENTED:
+        otbrLog(OTBR_LOG_INFO, "The radio does not support reading the transmit power, RCP latency is not measured");
+        mLatencySupported = false;
+        break;
+    default:
+        break;
+    }
+
+exit:
+    return;
+}
+
+} // namespace Ncp
+} // namespace otbr
@@ -0,0 +1,157 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the statistics of the link to the RCP.
+ */
+
+#ifndef OTBR_AGENT_RCP_STATS_HPP_
+#define OTBR_AGENT_RCP_STATS_HPP_
+
+#include <chrono>
+
+#include <stdint.h>
+
+#include <openthread/instance.h>
+
+#include "common/mainloop_stats.hpp"
+
+namespace otbr {
+namespace Ncp {
+
+/**
+ * This class collects the statistics of the spinel link between the agent and the RCP.
+ *
+ * The statistics are sampled periodically with `Sample()`:
+ * - the 802.15.4 frames and retransmissions, from the MAC counters, as every frame crosses the spinel link;
+ * - the bytes and errors of the UART, from the serial driver counters, when the RCP is connected to a UART;
+ * - the round-trip latency of a spinel property get, by reading the transmit power of the RCP.
+ *
+ */
+class RcpStats
+{
+public:
+    /**
+     * This structure represents the counters of the RCP link.
+     *
+     */
+    struct Counters
+    {
+        uint64_t mTxFrames;        ///< 802.15.4 frames sent by the RCP.
+        uint64_t mRxFrames;        ///< 802.15.4 frames received by the RCP.
+        uint64_t mTxRetries;       ///< MAC retransmissions done by the RCP.
+        uint64_t mTxBytes;         ///< Bytes sent to the RCP UART since the agent started.
+        uint64_t mRxBytes;         ///< Bytes received from the RCP UART since the agent started.
+        uint64_t mUartOverruns;    ///< UART receive overruns, in the driver or in the hardware.
+        uint64_t mUartFrameErrors; ///< UART framing errors.
+        uint64_t mTimeouts;        ///< Spinel property gets the RCP did not answer in time.
+        uint32_t mTxFrameRate;     ///< Frames sent per second over the last sample interval.
+        uint32_t mRxFrameRate;     ///< Frames received per second over the last sample interval.
+        uint32_t mTxByteRate;      ///< UART bytes sent per second over the last sample interval.
+        uint32_t mRxByteRate;      ///< UART bytes received per second over the last sample interval.
+    };
+
+    /**
+     * This constructor initializes the statistics.
+     *
+     */
+    RcpStats(void);
+
+    /**
+     * This destructor closes the UART opened for its counters.
+     *
+     */
+    ~RcpStats(void);
+
+    /**
+     * This method opens the UART of the RCP to read its driver counters.
+     *
+     * The UART counters are left at 0 if the radio URL is not a UART or the driver does not count.
+     *
+     * @param[in]   aRadioUrl   The URL of the RCP.
+     *
+     */
+    void Init(const char *aRadioUrl);
+
+    /**
+     * This method samples the counters and measures the latency of the RCP once.
+     *
+     * The property get blocks until the RCP answers, so this method should be called every few seconds at most.
+     *
+     * @param[in]   aInstance   The OpenThread instance.
+     *
+     */
+    void Sample(otInstance *aInstance);
+
+    /**
+     * This method returns the counters of the RCP link.
+     *
+     * @returns The counters.
+     *
+     */
+    const Counters &GetCounters(void) const { return mCounters; }
+
+    /**
+     * This method returns the latency histogram of spinel property gets.
+     *
+     * @returns The histogram, with the same buckets as `MainloopStats`.
+     *
+     */
+    const MainloopStats::Histogram &GetLatency(void) const { return mLatency; }
+
+    /**
+     * This method indicates whether the UART counters are available.
+     *
+     * @retval  TRUE   The byte and UART error counters are read from the serial driver.
+     * @retval  FALSE  The byte and UART error counters are always 0.
+     *
+     */
+    bool HasUartCounters(void) const { return mUartFd >= 0; }
+
+private:
+    void SampleMacCounters(otInstance *aInstance, uint32_t aIntervalMs);
+    void SampleUartCounters(uint32_t aIntervalMs);
+    void MeasureLatency(otInstance *aInstance);
+
+    Counters                              mCounters;
+    MainloopStats::Histogram              mLatency;
+    std::chrono::steady_clock::time_point mLastSampleTime;
+    uint32_t                              mLastTxTotal;
+    uint32_t                              mLastRxTotal;
+    uint32_t                              mLastTxRetry;
+    uint32_t                              mLastUartTx;
+    uint32_t                              mLastUartRx;
+    int                                   mUartFd;
+    bool                                  mLatencySupported;
+};
+
+} // namespace Ncp
+} // namespace otbr
+
+#endif // OTBR_AGENT_RCP_STATS_HPP_
@@ -0,0 +1,389 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the persistent state of the SRP Advertising Proxy.
+ */
+
+#include "agent/srp_state_store.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+// A record is a 16-bit big-endian length followed by the payload:
+//   type (1), host name length (1), host name,
+//   and for a host record: expire time (8), address (16), service count (1), then for each service:
+//   name length (1), name, type length (1), type, port (2), TXT data length (2), TXT data.
+static constexpr size_t kMaxRecordLength = UINT16_MAX;
+
+static void AppendUint(std::vector<uint8_t> &aRecord, uint64_t aValue, size_t aLength)
+{
+    for (size_t i = aLength; i > 0; --i)
+    {
+        aRecord.push_back(static_cast<uint8_t>(aValue >> (8 * (i - 1))));
+    }
+}
+
+static otbrError AppendString(std::vector<uint8_t> &aRecord, const std::string &aString)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(aString.size() <= UINT8_MAX, error = OTBR_ERROR_INVALID_ARGS);
+    aRecord.push_back(static_cast<uint8_t>(aString.size()));
+    aRecord.insert(aRecord.end(), aString.begin(), aString.end());
+
+exit:
+    return error;
+}
+
+static otbrError ReadUint(const uint8_t *&aCur, const uint8_t *aEnd, size_t aLength, uint64_t &aValue)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(static_cast<size_t>(aEnd - aCur) >= aLength, error = OTBR_ERROR_PARSE);
+
+    aValue = 0;
+    for (size_t i = 0; i < aLength; ++i)
+    {
+        aValue = (aValue << 8) | *aCur++;
+    }
+
+exit:
+    return error;
+}
+
+static otbrError ReadBytes(const uint8_t *&aCur, const uint8_t *aEnd, size_t aLength, const uint8_t *&aBytes)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(static_cast<size_t>(aEnd - aCur) >= aLength, error = OTBR_ERROR_PARSE);
+    aBytes = aCur;
+    aCur += aLength;
+
+exit:
+    return error;
+}
+
+static otbrError ReadString(const uint8_t *&aCur, const uint8_t *aEnd, std::string &aString)
+{
+    otbrError      error;
+    uint64_t       length;
+    const uint8_t *bytes;
+
+    SuccessOrExit(error = ReadUint(aCur, aEnd, 1, length));
+    SuccessOrExit(error = ReadBytes(aCur, aEnd, length, bytes));
+    aString.assign(reinterpret_cast<const char *>(bytes), length);
+
+exit:
+    return error;
+}
+
+SrpStateStore::SrpStateStore(void)
+    : mFd(-1)
+    , mRecordCount(0)
+{
+}
+
+SrpStateStore::~SrpStateStore(void)
+{
+    Close();
+}
+
+otbrError SrpStateStore::Open(const char *aPath, uint64_t aNow)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    Close();
+    mPath = aPath;
+    mHosts.clear();
+
+    SuccessOrExit(error = Load(aNow));
+
+    // Start from a compact log, which also drops expired hosts and anything after a corrupted record.
+    SuccessOrExit(error = Compact());
+
+    otbrLog(OTBR_LOG_INFO, "[srpstate] loaded %zu SRP hosts from %s", mHosts.size(), aPath);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[srpstate] failed to open %s: %s", aPath, strerror(errno));
+        Close();
+    }
+
+    return error;
+}
+
+void SrpStateStore::Close(void)
+{
+    if (mFd >= 0)
+    {
+        close(mFd);
+        mFd = -1;
+    }
+}
+
+otbrError SrpStateStore::SaveHost(const std::string &aName, const Host &aHost)
+{
+    otbrError            error;
+    std::vector<uint8_t> record;
+
+    SuccessOrExit(error = EncodeRecord(aName, &aHost, record));
+    mHosts[aName] = aHost;
+    error         = Append(record);
+
+exit:
+    return error;
+}
+
+otbrError SrpStateStore::RemoveHost(const std::string &aName)
+{
+    otbrError            error = OTBR_ERROR_NONE;
+    std::vector<uint8_t> record;
+
+    VerifyOrExit(mHosts.erase(aName) != 0);
+    SuccessOrExit(error = EncodeRecord(aName, nullptr, record));
+    error = Append(record);
+
+exit:
+    return error;
+}
+
+otbrError SrpStateStore::EncodeRecord(const std::string &aName, const Host *aHost, std::vector<uint8_t> &aRecord)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    aRecord.clear();
+    AppendUint(aRecord, 0, sizeof(uint16_t)); // The record length, written last.
+    aRecord.push_back(aHost != nullptr ? kRecordHost : kRecordRemoved);
+    SuccessOrExit(error = AppendString(aRecord, aName));
+
+    if (aHost != nullptr)
+    {
+        VerifyOrExit(aHost->mServices.size() <= UINT8_MAX, error = OTBR_ERROR_INVALID_ARGS);
+
+        AppendUint(aRecord, aHost->mExpireTime, sizeof(uint64_t));
+        aRecord.insert(aRecord.end(), aHost->mAddress.m8, aHost->mAddress.m8 + sizeof(aHost->mAddress.m8));
+        aRecord.push_back(static_cast<uint8_t>(aHost->mServices.size()));
+
+        for (const Service &service : aHost->mServices)
+        {
+            VerifyOrExit(service.mTxtData.size() <= UINT16_MAX, error = OTBR_ERROR_INVALID_ARGS);
+
+            SuccessOrExit(error = AppendString(aRecord, service.mName));
+            SuccessOrExit(error = AppendString(aRecord, service.mType));
+            AppendUint(aRecord, service.mPort, sizeof(uint16_t));
+            AppendUint(aRecord, service.mTxtData.size(), sizeof(uint16_t));
+            aRecord.insert(aRecord.end(), service.mTxtData.begin(), service.mTxtData.end());
+        }
+    }
+
+    VerifyOrExit(aRecord.size() - sizeof(uint16_t) <= kMaxRecordLength, error = OTBR_ERROR_INVALID_ARGS);
+    aRecord[0] = static_cast<uint8_t>((aRecord.size() - sizeof(uint16_t)) >> 8);
+    aRecord[1] = static_cast<uint8_t>(aRecord.size() - sizeof(uint16_t));
+
+exit:
+    return error;
+}
+
+otbrError SrpStateStore::DecodeRecord(const uint8_t *&aCur,
+                                      const uint8_t * aEnd,
+                                      std::string &   aName,
+                                      Host &          aHost,
+                                      bool &          aRemoved)
+{
+    otbrError      error;
+    uint64_t       value;
+    const uint8_t *end;
+    const uint8_t *bytes;
+
+    SuccessOrExit(error = ReadUint(aCur, aEnd, sizeof(uint16_t), value));
+    SuccessOrExit(error = ReadBytes(aCur, aEnd, value, bytes));
+    end  = aCur;
+    aCur = bytes;
+
+    SuccessOrExit(error = ReadUint(aCur, end, 1, value));
+    VerifyOrExit(value == kRecordHost || value == kRecordRemoved, error = OTBR_ERROR_PARSE);
+    aRemoved = (value == kRecordRemoved);
+    SuccessOrExit(error = ReadString(aCur, end, aName));
+
+    if (!aRemoved)
+    {
+        uint64_t serviceCount;
+
+        SuccessOrExit(error = ReadUint(aCur, end, sizeof(uint64_t), aHost.mExpireTime));
+        SuccessOrExit(error = ReadBytes(aCur, end, sizeof(aHost.mAddress.m8), bytes));
+        memcpy(aHost.mAddress.m8, bytes, sizeof(aHost.mAddress.m8));
+        SuccessOrExit(error = ReadUint(aCur, end, 1, serviceCount));
+
+        aHost.mServices.resize(serviceCount);
+
+        for (Service &service : aHost.mServices)
+        {
+            SuccessOrExit(error = ReadString(aCur, end, service.mName));
+            SuccessOrExit(error = ReadString(aCur, end, service.mType));
+            SuccessOrExit(error = ReadUint(aCur, end, sizeof(uint16_t), value));
+            service.mPort = static_cast<uint16_t>(value);
+            SuccessOrExit(error = ReadUint(aCur, end, sizeof(uint16_t), value));
+            SuccessOrExit(error = ReadBytes(aCur, end, value, bytes));
+            service.mTxtData.assign(bytes, bytes + value);
+        }
+    }
+
+    VerifyOrExit(aCur == end, error = OTBR_ERROR_PARSE);
+
+exit:
+    return error;
+}
+
+otbrError SrpStateStore::Load(uint64_t aNow)
+{
+    otbrError            error = OTBR_ERROR_NONE;
+    int                  fd    = open(mPath.c_str(), O_RDONLY | O_CLOEXEC);
+    std::vector<uint8_t> data;
+    uint8_t              buffer[4096];
+    ssize_t              count;
+    const uint8_t *      cur;
+
+    if (fd < 0)
+    {
+        VerifyOrExit(errno == ENOENT, error = OTBR_ERROR_ERRNO);
+        ExitNow();
+    }
+
+    while ((count = read(fd, buffer, sizeof(buffer))) > 0)
+    {
+        data.insert(data.end(), buffer, buffer + count);
+    }
+    VerifyOrExit(count == 0, error = OTBR_ERROR_ERRNO);
+
+    cur = data.data();
+    while (cur < data.data() + data.size())
+    {
+        std::string name;
+        Host        host;
+        bool        removed;
+
+        if (DecodeRecord(cur, data.data() + data.size(), name, host, removed) != OTBR_ERROR_NONE)
+        {
+            otbrLog(OTBR_LOG_WARNING, "[srpstate] dropped corrupted records at offset %zu of %s",
+                    static_cast<size_t>(cur - data.data()), mPath.c_str());
+            break;
+        }
+
+        if (removed || host.mExpireTime <= aNow)
+        {
+            mHosts.erase(name);
+        }
+        else
+        {
+            mHosts[name] = std::move(host);
+        }
+    }
+
+exit:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    return error;
+}
+
+otbrError SrpStateStore::Append(const std::vector<uint8_t> &aRecord)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(IsOpen());
+
+    // A short write leaves a truncated record, which is dropped with anything after it when the file is loaded.
+    VerifyOrExit(write(mFd, aRecord.data(), aRecord.size()) == static_cast<ssize_t>(aRecord.size()),
+                 error = OTBR_ERROR_ERRNO);
+    ++mRecordCount;
+
+    if (mRecordCount >= kMinRecords && mRecordCount >= kCompactRatio * mHosts.size())
+    {
+        error = Compact();
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[srpstate] failed to write %s: %s", mPath.c_str(), strerror(errno));
+    }
+
+    return error;
+}
+
+otbrError SrpStateStore::Compact(void)
+{
+    otbrError            error   = OTBR_ERROR_NONE;
+    std::string          tmpPath = mPath + ".tmp";
+    int                  fd      = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    std::vector<uint8_t> data;
+    std::vector<uint8_t> record;
+
+    VerifyOrExit(fd >= 0, error = OTBR_ERROR_ERRNO);
+
+    for (const auto &host : mHosts)
+    {
+        if (EncodeRecord(host.first, &host.second, record) == OTBR_ERROR_NONE)
+        {
+            data.insert(data.end(), record.begin(), record.end());
+        }
+    }
+
+    // The new log replaces the old one atomically, a crash leaves either of them complete.
+    VerifyOrExit(write(fd, data.data(), data.size()) == static_cast<ssize_t>(data.size()), error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(fsync(fd) == 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(rename(tmpPath.c_str(), mPath.c_str()) == 0, error = OTBR_ERROR_ERRNO);
+
+    Close();
+    mFd = open(mPath.c_str(), O_WRONLY | O_APPEND | O_CLOEXEC);
+    VerifyOrExit(mFd >= 0, error = OTBR_ERROR_ERRNO);
+    mRecordCount = mHosts.size();
+
+exit:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    return error;
+}
+
+} // namespace otbr
@@ -0,0 +1,205 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the persistent state of the SRP Advertising Proxy.
+ */
+
+#ifndef OTBR_AGENT_SRP_STATE_STORE_HPP_
+#define OTBR_AGENT_SRP_STATE_STORE_HPP_
+
+#include <stdint.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class stores the SRP hosts and services published by the Advertising Proxy in a file.
+ *
+ * The file is an append-only log of host records, the latest record of a host wins. Each change appends a single
+ * record, and the log is compacted into one record per live host when it holds several times more records than
+ * live hosts. Hosts whose lease expired are dropped when the file is loaded.
+ *
+ */
+class SrpStateStore
+{
+public:
+    /**
+     * This structure represents a stored service.
+     *
+     */
+    struct Service
+    {
+        std::string          mName;    ///< The service instance name.
+        std::string          mType;    ///< The service type.
+        uint16_t             mPort;    ///< The service port.
+        std::vector<uint8_t> mTxtData; ///< The TXT data in DNS-SD format.
+    };
+
+    /**
+     * This structure represents a stored host.
+     *
+     */
+    struct Host
+    {
+        Ip6Address           mAddress;    ///< The published host address.
+        uint64_t             mExpireTime; ///< The lease expiry in seconds since the Unix epoch.
+        std::vector<Service> mServices;   ///< The published services of the host.
+    };
+
+    typedef std::unordered_map<std::string, Host> Hosts;
+
+    /**
+     * The constructor initializes a closed store.
+     *
+     */
+    SrpStateStore(void);
+
+    ~SrpStateStore(void);
+
+    /**
+     * This method opens the store file and loads the hosts whose lease has not expired at @p aNow.
+     *
+     * A missing file is an empty store. Records after a truncated or corrupted record are dropped.
+     *
+     * @param[in]   aPath   The path of the store file.
+     * @param[in]   aNow    The current time in seconds since the Unix epoch.
+     *
+     * @retval  OTBR_ERROR_NONE   Successfully opened the store.
+     * @retval  OTBR_ERROR_ERRNO  Failed to open or compact the store file.
+     *
+     */
+    otbrError Open(const char *aPath, uint64_t aNow);
+
+    /**
+     * This method closes the store file, the loaded hosts are kept.
+     *
+     */
+    void Close(void);
+
+    /**
+     * This method returns whether the store file is open.
+     *
+     * @returns Whether the store file is open.
+     *
+     */
+    bool IsOpen(void) const { return mFd >= 0; }
+
+    /**
+     * This method returns the stored hosts.
+     *
+     * @returns The stored hosts by host name.
+     *
+     */
+    const Hosts &GetHosts(void) const { return mHosts; }
+
+    /**
+     * This method adds or replaces a host.
+     *
+     * @param[in]   aName   The host name.
+     * @param[in]   aHost   The host.
+     *
+     * @retval  OTBR_ERROR_NONE          Successfully stored the host.
+     * @retval  OTBR_ERROR_INVALID_ARGS  The host does not fit in a record.
+     * @retval  OTBR_ERROR_ERRNO         Failed to write the store file.
+     *
+     */
+    otbrError SaveHost(const std::string &aName, const Host &aHost);
+
+    /**
+     * This method removes a host.
+     *
+     * @param[in]   aName   The host name.
+     *
+     * @retval  OTBR_ERROR_NONE   Successfully removed the host, or the host was not stored.
+     * @retval  OTBR_ERROR_ERRNO  Failed to write the store file.
+     *
+     */
+    otbrError RemoveHost(const std::string &aName);
+
+    /**
+     * This method encodes a host record, the same record is used by the store file and by the state sync.
+     *
+     * @param[in]   aName     The host name.
+     * @param[in]   aHost     The host, or nullptr for a removed host.
+     * @param[out]  aRecord   The record.
+     *
+     * @retval  OTBR_ERROR_NONE          Successfully encoded the record.
+     * @retval  OTBR_ERROR_INVALID_ARGS  The host does not fit in a record.
+     *
+     */
+    static otbrError EncodeRecord(const std::string &aName, const Host *aHost, std::vector<uint8_t> &aRecord);
+
+    /**
+     * This method decodes a host record.
+     *
+     * @param[inout]    aCur      The start of the record, moved past the record on success.
+     * @param[in]       aEnd      The end of the data.
+     * @param[out]      aName     The host name.
+     * @param[out]      aHost     The host, only set if @p aRemoved is false.
+     * @param[out]      aRemoved  Whether the record is a removed host.
+     *
+     * @retval  OTBR_ERROR_NONE   Successfully decoded the record.
+     * @retval  OTBR_ERROR_PARSE  The record is truncated or corrupted.
+     *
+     */
+    static otbrError DecodeRecord(const uint8_t *&aCur,
+                                  const uint8_t * aEnd,
+                                  std::string &   aName,
+                                  Host &          aHost,
+                                  bool &          aRemoved);
+
+private:
+    enum : uint8_t
+    {
+        kRecordHost    = 1, // A host and its services.
+        kRecordRemoved = 2, // A removed host.
+    };
+
+    static constexpr size_t kCompactRatio = 4;  // Compact when the log holds this many records per live host.
+    static constexpr size_t kMinRecords   = 64; // Never compact a log with fewer records.
+
+    otbrError Load(uint64_t aNow);
+    otbrError Append(const std::vector<uint8_t> &aRecord);
+    otbrError Compact(void);
+
+    std::string mPath;
+    int         mFd;
+    size_t      mRecordCount;
+    Hosts       mHosts;
+};
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_SRP_STATE_STORE_HPP_
@@ -0,0 +1,612 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements replicating the agent state to a standby agent.
+ */
+
+#include "agent/state_sync.hpp"
+
+#include <errno.h>
+#include <inttypes.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <random>
+
+#include <openthread/dataset.h>
+#include <openthread/ip6.h>
+#include <openthread/thread.h>
+
+#include "agent/instance_params.hpp"
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/mainloop_poller.hpp"
+
+namespace otbr {
+
+static constexpr std::chrono::seconds kHeartbeatInterval(1); // The active agent is never silent for longer.
+static constexpr std::chrono::seconds kReconnectInterval(1);
+
+StateSync::StateSync(Ncp::ControllerOpenThread &aNcp)
+    : mNcp(aNcp)
+    , mJournal(MakeEpoch())
+    , mListenFd(-1)
+    , mStandbySynced(false)
+    , mSentSequence(0)
+    , mActiveAddressLength(0)
+    , mConnecting(false)
+    , mPromoted(false)
+{
+    memset(&mActiveAddress, 0, sizeof(mActiveAddress));
+}
+
+StateSync::~StateSync(void)
+{
+    mHeartbeatTimer.Cancel();
+    mReconnectTimer.Cancel();
+    mFailoverTimer.Cancel();
+
+    Close(mStandby);
+    Close(mActive);
+
+    if (mListenFd >= 0)
+    {
+        MainloopPoller::Get().Unregister(mListenFd);
+        close(mListenFd);
+        mListenFd = -1;
+    }
+}
+
+void StateSync::Init(PromoteHandler aHandler)
+{
+    uint16_t    port = InstanceParams::Get().GetSyncListenPort();
+    const char *peer = InstanceParams::Get().GetSyncPeer();
+
+    mPromoteHandler = std::move(aHandler);
+
+    if (port != 0 && StartListening(port) == OTBR_ERROR_NONE)
+    {
+        mNcp.RegisterStateChangedHandler(OT_CHANGED_ACTIVE_DATASET, [this](otChangedFlags) { UpdateDataset(); });
+#if OTBR_ENABLE_BACKBONE_ROUTER
+        mNcp.On<Ncp::kEventBackboneRouterNdProxyEvent>(HandleNdProxyEvent, this);
+#endif
+        UpdateDataset();
+        SendHeartbeat();
+    }
+
+    if (peer != nullptr && peer[0] != '\0' && ParsePeer(peer) == OTBR_ERROR_NONE)
+    {
+        ConnectActive();
+    }
+}
+
+void StateSync::Process(void)
+{
+    const MainloopPoller &poller = MainloopPoller::Get();
+
+    if (mListenFd >= 0 && poller.IsReadable(mListenFd))
+    {
+        AcceptStandby();
+    }
+
+    if (mStandby.mFd >= 0 && poller.GetReadyEvents(mStandby.mFd) != 0)
+    {
+        ProcessStandby();
+    }
+
+    if (mActive.mFd >= 0 && poller.GetReadyEvents(mActive.mFd) != 0)
+    {
+        ProcessActive();
+    }
+}
+
+void StateSync::HandleHostChanged(const std::string &aName, const SrpStateStore::Host *aHost)
+{
+    VerifyOrExit(mListenFd >= 0);
+    SuccessOrExit(mJournal.SetHost(aName, aHost));
+    SendChanges();
+
+exit:
+    return;
+}
+
+uint64_t StateSync::MakeEpoch(void)
+{
+    std::random_device random;
+
+    // Zero is the epoch of a standby journal which has not been reset.
+    return ((static_cast<uint64_t>(random()) << 32) | random()) | 1;
+}
+
+otbrError StateSync::Receive(Channel &aChannel)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint8_t   buffer[4096];
+    ssize_t   count;
+
+    while ((count = read(aChannel.mFd, buffer, sizeof(buffer))) > 0)
+    {
+        aChannel.mInput.insert(aChannel.mInput.end(), buffer, buffer + count);
+    }
+
+    // The peer closed the connection.
+    VerifyOrExit(count != 0, errno = ECONNRESET, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR, error = OTBR_ERROR_ERRNO);
+
+exit:
+    return error;
+}
+
+otbrError StateSync::Flush(Channel &aChannel)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint8_t   events;
+
+    if (!aChannel.mOutput.empty())
+    {
+        ssize_t sent = send(aChannel.mFd, aChannel.mOutput.data(), aChannel.mOutput.size(), MSG_NOSIGNAL);
+
+        if (sent < 0)
+        {
+            VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR, error = OTBR_ERROR_ERRNO);
+        }
+        else
+        {
+            aChannel.mOutput.erase(aChannel.mOutput.begin(), aChannel.mOutput.begin() + sent);
+        }
+    }
+
+    VerifyOrExit(aChannel.mOutput.size() <= kMaxPendingBytes, errno = ENOBUFS, error = OTBR_ERROR_ERRNO);
+
+    events = MainloopPoller::kEventRead | (aChannel.mOutput.empty() ? 0 : MainloopPoller::kEventWrite);
+    error  = MainloopPoller::Get().Register(aChannel.mFd, events);
+
+exit:
+    return error;
+}
+
+void StateSync::Close(Channel &aChannel)
+{
+    if (aChannel.mFd >= 0)
+    {
+        MainloopPoller::Get().Unregister(aChannel.mFd);
+        close(aChannel.mFd);
+        aChannel.mFd = -1;
+    }
+
+    aChannel.mInput.clear();
+    aChannel.mOutput.clear();
+}
+
+otbrError StateSync::StartListening(uint16_t aPort)
+{
+    otbrError    error = OTBR_ERROR_NONE;
+    sockaddr_in6 address;
+    int          optval = 1;
+
+    mListenFd = socket(AF_INET6, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    VerifyOrExit(mListenFd >= 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(setsockopt(mListenFd, SOL_SOCKET, SO_REUSEADDR, &optval, sizeof(optval)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    // The standby agent may connect over IPv4 too.
+    optval = 0;
+    VerifyOrExit(setsockopt(mListenFd, IPPROTO_IPV6, IPV6_V6ONLY, &optval, sizeof(optval)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    memset(&address, 0, sizeof(address));
+    address.sin6_family = AF_INET6;
+    address.sin6_addr   = in6addr_any;
+    address.sin6_port   = htons(aPort);
+    VerifyOrExit(bind(mListenFd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(listen(mListenFd, 1) == 0, error = OTBR_ERROR_ERRNO);
+    SuccessOrExit(error = MainloopPoller::Get().Register(mListenFd, MainloopPoller::kEventRead));
+
+    otbrLog(OTBR_LOG_INFO, "[sync] serving a standby agent on port %u, epoch %016" PRIx64, aPort,
+            mJournal.GetEpoch());
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[sync] failed to listen on port %u: %s", aPort, strerror(errno));
+
+        if (mListenFd >= 0)
+        {
+            close(mListenFd);
+            mListenFd = -1;
+        }
+    }
+
+    return error;
+}
+
+void StateSync::AcceptStandby(void)
+{
+    int fd = accept4(mListenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+    VerifyOrExit(fd >= 0);
+
+    // A reconnecting standby agent replaces its previous connection, which may not have timed out yet.
+    CloseStandby();
+    mStandby.mFd = fd;
+
+    if (Flush(mStandby) != OTBR_ERROR_NONE)
+    {
+        CloseStandby();
+    }
+
+    otbrLog(OTBR_LOG_INFO, "[sync] standby agent connected");
+
+exit:
+    return;
+}
+
+void StateSync::ProcessStandby(void)
+{
+    otbrError          error = OTBR_ERROR_NONE;
+    const uint8_t *    cur;
+    SyncJournal::Frame frame;
+
+    if (MainloopPoller::Get().IsReadable(mStandby.mFd))
+    {
+        SuccessOrExit(error = Receive(mStandby));
+    }
+
+    cur = mStandby.mInput.data();
+
+    while ((error = SyncJournal::DecodeFrame(cur, mStandby.mInput.data() + mStandby.mInput.size(), frame)) ==
+           OTBR_ERROR_NONE)
+    {
+        uint64_t epoch;
+        uint64_t sequence;
+
+        SuccessOrExit(error = SyncJournal::DecodeHello(frame, epoch, sequence));
+
+        // Only the missed changes are sent again, or a snapshot if they are no longer kept.
+        mJournal.AppendFramesSince(epoch, sequence, mStandby.mOutput);
+        mSentSequence  = mJournal.GetSequence();
+        mStandbySynced = true;
+
+        otbrLog(OTBR_LOG_INFO, "[sync] standby agent is at %016" PRIx64 ":%" PRIu64 ", latest is %016" PRIx64
+                ":%" PRIu64, epoch, sequence, mJournal.GetEpoch(), mJournal.GetSequence());
+    }
+
+    VerifyOrExit(error == OTBR_ERROR_NOT_FOUND);
+    mStandby.mInput.erase(mStandby.mInput.begin(), mStandby.mInput.begin() + (cur - mStandby.mInput.data()));
+    error = Flush(mStandby);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_INFO, "[sync] standby agent disconnected: %s", otbrErrorString(error));
+        CloseStandby();
+    }
+}
+
+void StateSync::CloseStandby(void)
+{
+    Close(mStandby);
+    mStandbySynced = false;
+}
+
+void StateSync::SendChanges(void)
+{
+    VerifyOrExit(mStandby.mFd >= 0 && mStandbySynced);
+
+    mJournal.AppendFramesSince(mJournal.GetEpoch(), mSentSequence, mStandby.mOutput);
+    mSentSequence = mJournal.GetSequence();
+
+    if (Flush(mStandby) != OTBR_ERROR_NONE)
+    {
+        // The standby agent catches up when it connects again.
+        otbrLog(OTBR_LOG_WARNING, "[sync] dropped the standby agent: %s", strerror(errno));
+        CloseStandby();
+    }
+
+exit:
+    return;
+}
+
+void StateSync::SendHeartbeat(void)
+{
+    if (mStandby.mFd >= 0 && mStandbySynced)
+    {
+        mJournal.AppendHeartbeat(mStandby.mOutput);
+
+        if (Flush(mStandby) != OTBR_ERROR_NONE)
+        {
+            otbrLog(OTBR_LOG_WARNING, "[sync] dropped the standby agent: %s", strerror(errno));
+            CloseStandby();
+        }
+    }
+
+    mHeartbeatTimer =
+        mNcp.PostTimerTask(std::chrono::steady_clock::now() + kHeartbeatInterval, [this]() { SendHeartbeat(); });
+}
+
+void StateSync::UpdateDataset(void)
+{
+    otOperationalDatasetTlvs datasetTlvs;
+
+    VerifyOrExit(otDatasetGetActiveTlvs(mNcp.GetInstance(), &datasetTlvs) == OT_ERROR_NONE);
+    mJournal.SetDataset(std::vector<uint8_t>(datasetTlvs.mTlvs, datasetTlvs.mTlvs + datasetTlvs.mLength));
+    SendChanges();
+
+exit:
+    return;
+}
+
+#if OTBR_ENABLE_BACKBONE_ROUTER
+void StateSync::HandleNdProxyEvent(void *aContext, otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua)
+{
+    static_cast<StateSync *>(aContext)->HandleNdProxyEvent(aEvent, aDua);
+}
+
+void StateSync::HandleNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua)
+{
+    switch (aEvent)
+    {
+    case OT_BACKBONE_ROUTER_NDPROXY_ADDED:
+    case OT_BACKBONE_ROUTER_NDPROXY_RENEWED:
+        mJournal.AddDua(Ip6Address(aDua->mFields.m8));
+        break;
+    case OT_BACKBONE_ROUTER_NDPROXY_REMOVED:
+        mJournal.RemoveDua(Ip6Address(aDua->mFields.m8));
+        break;
+    case OT_BACKBONE_ROUTER_NDPROXY_CLEARED:
+        mJournal.ClearDuas();
+        break;
+    }
+
+    SendChanges();
+}
+#endif // OTBR_ENABLE_BACKBONE_ROUTER
+
+otbrError StateSync::ParsePeer(const char *aPeer)
+{
+    otbrError   error = OTBR_ERROR_NONE;
+    std::string peer(aPeer);
+    size_t      colon = peer.rfind(':');
+    std::string host;
+    std::string port;
+    addrinfo    hints;
+    addrinfo *  result = nullptr;
+
+    VerifyOrExit(colon != std::string::npos && colon + 1 < peer.size(), error = OTBR_ERROR_INVALID_ARGS);
+    host = peer.substr(0, colon);
+    port = peer.substr(colon + 1);
+
+    if (host.size() >= 2 && host.front() == '[' && host.back() == ']')
+    {
+        host = host.substr(1, host.size() - 2);
+    }
+
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family   = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_flags    = AI_NUMERICHOST | AI_NUMERICSERV;
+
+    VerifyOrExit(getaddrinfo(host.c_str(), port.c_str(), &hints, &result) == 0 && result != nullptr,
+                 error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(result->ai_addrlen <= sizeof(mActiveAddress), error = OTBR_ERROR_INVALID_ARGS);
+
+    memcpy(&mActiveAddress, result->ai_addr, result->ai_addrlen);
+    mActiveAddressLength = result->ai_addrlen;
+
+    otbrLog(OTBR_LOG_INFO, "[sync] standby of the active agent at %s", aPeer);
+
+exit:
+    if (result != nullptr)
+    {
+        freeaddrinfo(result);
+    }
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[sync] invalid active agent address %s, expected ADDRESS:PORT", aPeer);
+    }
+
+    return error;
+}
+
+void StateSync::ConnectActive(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(!mPromoted && mActive.mFd < 0);
+
+    mActive.mFd = socket(mActiveAddress.ss_family, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    VerifyOrExit(mActive.mFd >= 0, error = OTBR_ERROR_ERRNO);
+
+    if (connect(mActive.mFd, reinterpret_cast<sockaddr *>(&mActiveAddress), mActiveAddressLength) != 0)
+    {
+        VerifyOrExit(errno == EINPROGRESS, error = OTBR_ERROR_ERRNO);
+    }
+
+    mConnecting = true;
+    error       = MainloopPoller::Get().Register(mActive.mFd, MainloopPoller::kEventWrite);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_DEBUG, "[sync] failed to connect to the active agent: %s", strerror(errno));
+        Close(mActive);
+        ScheduleReconnect();
+    }
+}
+
+void StateSync::ProcessActive(void)
+{
+    otbrError          error    = OTBR_ERROR_NONE;
+    bool               received = false;
+    const uint8_t *    cur;
+    SyncJournal::Frame frame;
+
+    if (mConnecting)
+    {
+        int       sockError = 0;
+        socklen_t length    = sizeof(sockError);
+
+        VerifyOrExit(getsockopt(mActive.mFd, SOL_SOCKET, SO_ERROR, &sockError, &length) == 0,
+                     error = OTBR_ERROR_ERRNO);
+        VerifyOrExit(sockError == 0, errno = sockError, error = OTBR_ERROR_ERRNO);
+
+        // Tell the active agent which changes this standby agent already has.
+        mConnecting = false;
+        mActiveJournal.AppendHello(mActive.mOutput);
+
+        otbrLog(OTBR_LOG_INFO, "[sync] connected to the active agent at %016" PRIx64 ":%" PRIu64,
+                mActiveJournal.GetEpoch(), mActiveJournal.GetSequence());
+
+        ExitNow(error = Flush(mActive));
+    }
+
+    if (MainloopPoller::Get().IsReadable(mActive.mFd))
+    {
+        SuccessOrExit(error = Receive(mActive));
+    }
+
+    cur = mActive.mInput.data();
+
+    while ((error = SyncJournal::DecodeFrame(cur, mActive.mInput.data() + mActive.mInput.size(), frame)) ==
+           OTBR_ERROR_NONE)
+    {
+        // An out of sequence frame is recovered by connecting again, the active agent resends what is missing.
+        SuccessOrExit(error = mActiveJournal.Apply(frame));
+        received = true;
+    }
+
+    VerifyOrExit(error == OTBR_ERROR_NOT_FOUND);
+    mActive.mInput.erase(mActive.mInput.begin(), mActive.mInput.begin() + (cur - mActive.mInput.data()));
+
+    if (received)
+    {
+        ScheduleFailover();
+    }
+
+    error = Flush(mActive);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_INFO, "[sync] lost the active agent: %s", otbrErrorString(error));
+        Close(mActive);
+        mConnecting = false;
+        ScheduleReconnect();
+    }
+}
+
+void StateSync::ScheduleReconnect(void)
+{
+    VerifyOrExit(!mPromoted);
+
+    mReconnectTimer =
+        mNcp.PostTimerTask(std::chrono::steady_clock::now() + kReconnectInterval, [this]() { ConnectActive(); });
+
+exit:
+    return;
+}
+
+void StateSync::ScheduleFailover(void)
+{
+    auto failoverTime = std::chrono::steady_clock::now() +
+                        std::chrono::milliseconds(InstanceParams::Get().GetSyncFailoverTimeout());
+
+    // A standby agent which never received the state of the active agent has nothing to take over.
+    VerifyOrExit(!mPromoted && mActiveJournal.GetEpoch() != 0);
+
+    if (!mFailoverTimer.Reschedule(failoverTime))
+    {
+        mFailoverTimer = mNcp.PostTimerTask(failoverTime, [this]() { Promote(); });
+    }
+
+exit:
+    return;
+}
+
+void StateSync::Promote(void)
+{
+    const SyncJournal::State &state = mActiveJournal.GetState();
+
+    otbrLog(OTBR_LOG_NOTICE,
+            "[sync] active agent silent for %" PRIu32 " ms, taking over %zu SRP hosts and %zu DUAs at %016" PRIx64
+            ":%" PRIu64,
+            InstanceParams::Get().GetSyncFailoverTimeout(), state.mHosts.size(), state.mDuas.size(),
+            mActiveJournal.GetEpoch(), mActiveJournal.GetSequence());
+
+    mPromoted = true;
+    mReconnectTimer.Cancel();
+    Close(mActive);
+    mConnecting = false;
+
+    RestoreDataset(state.mDataset);
+
+    if (mPromoteHandler != nullptr)
+    {
+        mPromoteHandler(state);
+    }
+}
+
+void StateSync::RestoreDataset(const std::vector<uint8_t> &aDataset)
+{
+    otError                  error    = OT_ERROR_NONE;
+    otInstance *             instance = mNcp.GetInstance();
+    otOperationalDatasetTlvs datasetTlvs;
+
+    VerifyOrExit(!aDataset.empty() && aDataset.size() <= sizeof(datasetTlvs.mTlvs));
+
+    // A commissioned standby agent follows the dataset of its own Thread network.
+    VerifyOrExit(!otDatasetIsCommissioned(instance));
+
+    memcpy(datasetTlvs.mTlvs, aDataset.data(), aDataset.size());
+    datasetTlvs.mLength = static_cast<uint8_t>(aDataset.size());
+
+    SuccessOrExit(error = otDatasetSetActiveTlvs(instance, &datasetTlvs));
+
+    if (!otIp6IsEnabled(instance))
+    {
+        SuccessOrExit(error = otIp6SetEnabled(instance, true));
+    }
+    SuccessOrExit(error = otThreadSetEnabled(instance, true));
+
+    otbrLog(OTBR_LOG_INFO, "[sync] attaching with the active dataset of the active agent");
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[sync] failed to attach with the active dataset of the active agent: %s",
+                otThreadErrorToString(error));
+    }
+}
+
+} // namespace otbr
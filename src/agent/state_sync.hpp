@@ -0,0 +1,168 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for replicating the agent state to a standby agent.
+ */
+
+#ifndef OTBR_AGENT_STATE_SYNC_HPP_
+#define OTBR_AGENT_STATE_SYNC_HPP_
+
+#include <stdint.h>
+#include <sys/socket.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "agent/ncp_openthread.hpp"
+#include "agent/srp_state_store.hpp"
+#include "agent/sync_journal.hpp"
+#include "common/timer_wheel.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class replicates the state of an active agent to a hot-standby agent over TCP.
+ *
+ * An active agent started with a sync listen port records the active dataset, the SRP hosts published by the
+ * Advertising Proxy and the DUAs proxied by the Backbone Router in a `SyncJournal`, and streams the changes to the
+ * standby agent connected to the port. A standby agent started with a sync peer keeps a copy of the state, and
+ * takes it over when the active agent has been silent for the failover timeout: the SRP hosts are republished and
+ * the DUAs are proxied at once, instead of waiting for every SRP client and Thread device to register again.
+ *
+ * The channel is neither authenticated nor encrypted and carries the network key, it must only be used on a trusted
+ * link between the two agents.
+ *
+ */
+class StateSync
+{
+public:
+    /**
+     * This function is called when a standby agent takes over the state of the active agent.
+     *
+     * @param[in]   aState  The state of the active agent.
+     *
+     */
+    typedef std::function<void(const SyncJournal::State &aState)> PromoteHandler;
+
+    /**
+     * The constructor initializes the state sync.
+     *
+     * @param[in]   aNcp    A reference to the NCP controller.
+     *
+     */
+    explicit StateSync(Ncp::ControllerOpenThread &aNcp);
+
+    ~StateSync(void);
+
+    /**
+     * This method starts serving a standby agent and following an active agent, as set in `InstanceParams`.
+     *
+     * @param[in]   aHandler    The handler called when this standby agent takes over the state.
+     *
+     */
+    void Init(PromoteHandler aHandler);
+
+    /**
+     * This method processes the sync connections, it is called in each mainloop iteration.
+     *
+     */
+    void Process(void);
+
+    /**
+     * This method records a change of an SRP host published by the Advertising Proxy.
+     *
+     * @param[in]   aName   The host name.
+     * @param[in]   aHost   The published host, or nullptr if the host was removed.
+     *
+     */
+    void HandleHostChanged(const std::string &aName, const SrpStateStore::Host *aHost);
+
+private:
+    static constexpr size_t kMaxPendingBytes = 1024 * 1024; // Drop a standby which falls this far behind.
+
+    struct Channel
+    {
+        int                  mFd = -1;
+        std::vector<uint8_t> mInput;
+        std::vector<uint8_t> mOutput;
+    };
+
+    static uint64_t  MakeEpoch(void);
+    static otbrError Receive(Channel &aChannel);
+    static otbrError Flush(Channel &aChannel);
+    static void      Close(Channel &aChannel);
+
+    // The active role.
+    otbrError StartListening(uint16_t aPort);
+    void      AcceptStandby(void);
+    void      ProcessStandby(void);
+    void      CloseStandby(void);
+    void      SendChanges(void);
+    void      SendHeartbeat(void);
+    void      UpdateDataset(void);
+#if OTBR_ENABLE_BACKBONE_ROUTER
+    static void HandleNdProxyEvent(void *aContext, otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua);
+    void        HandleNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua);
+#endif
+
+    // The standby role.
+    otbrError ParsePeer(const char *aPeer);
+    void      ConnectActive(void);
+    void      ProcessActive(void);
+    void      ScheduleReconnect(void);
+    void      ScheduleFailover(void);
+    void      Promote(void);
+    void      RestoreDataset(const std::vector<uint8_t> &aDataset);
+
+    Ncp::ControllerOpenThread &mNcp;
+    PromoteHandler             mPromoteHandler;
+
+    SyncJournal        mJournal;       // The state of this agent served to the standby agent.
+    int                mListenFd;      // The socket accepting the standby agent.
+    Channel            mStandby;       // The connection of the standby agent.
+    bool               mStandbySynced; // Whether the standby agent told which changes it has.
+    uint64_t           mSentSequence;  // The sequence number of the latest change sent to the standby agent.
+    TimerWheel::Handle mHeartbeatTimer;
+
+    SyncJournal        mActiveJournal; // The state of the active agent followed by this standby agent.
+    sockaddr_storage   mActiveAddress;
+    socklen_t          mActiveAddressLength;
+    Channel            mActive; // The connection to the active agent.
+    bool               mConnecting;
+    bool               mPromoted;
+    TimerWheel::Handle mReconnectTimer;
+    TimerWheel::Handle mFailoverTimer;
+};
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_STATE_SYNC_HPP_
@@ -0,0 +1,337 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the journal of the state replicated to a standby agent.
+ */
+
+#include "agent/sync_journal.hpp"
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+static constexpr size_t kFrameHeaderSize = 1 + sizeof(uint64_t) + sizeof(uint32_t);
+
+static void AppendUint(std::vector<uint8_t> &aData, uint64_t aValue, size_t aLength)
+{
+    for (size_t i = aLength; i > 0; --i)
+    {
+        aData.push_back(static_cast<uint8_t>(aValue >> (8 * (i - 1))));
+    }
+}
+
+static uint64_t ReadUint(const uint8_t *aData, size_t aLength)
+{
+    uint64_t value = 0;
+
+    for (size_t i = 0; i < aLength; ++i)
+    {
+        value = (value << 8) | aData[i];
+    }
+
+    return value;
+}
+
+static std::vector<uint8_t> MakeDuaPayload(const Ip6Address &aDua)
+{
+    return std::vector<uint8_t>(aDua.m8, aDua.m8 + sizeof(aDua.m8));
+}
+
+SyncJournal::SyncJournal(uint64_t aEpoch)
+    : mEpoch(aEpoch)
+    , mSequence(0)
+    , mInSnapshot(false)
+    , mLogBytes(0)
+{
+}
+
+void SyncJournal::SetDataset(const std::vector<uint8_t> &aDataset)
+{
+    VerifyOrExit(aDataset != mState.mDataset);
+
+    mState.mDataset = aDataset;
+    Record(kFrameDataset, aDataset);
+
+exit:
+    return;
+}
+
+otbrError SyncJournal::SetHost(const std::string &aName, const SrpStateStore::Host *aHost)
+{
+    otbrError            error;
+    std::vector<uint8_t> record;
+
+    SuccessOrExit(error = SrpStateStore::EncodeRecord(aName, aHost, record));
+
+    if (aHost != nullptr)
+    {
+        mState.mHosts[aName] = *aHost;
+    }
+    else
+    {
+        VerifyOrExit(mState.mHosts.erase(aName) != 0);
+    }
+
+    Record(kFrameHost, record);
+
+exit:
+    return error;
+}
+
+void SyncJournal::AddDua(const Ip6Address &aDua)
+{
+    VerifyOrExit(mState.mDuas.insert(aDua).second);
+    Record(kFrameDuaAdded, MakeDuaPayload(aDua));
+
+exit:
+    return;
+}
+
+void SyncJournal::RemoveDua(const Ip6Address &aDua)
+{
+    VerifyOrExit(mState.mDuas.erase(aDua) != 0);
+    Record(kFrameDuaRemoved, MakeDuaPayload(aDua));
+
+exit:
+    return;
+}
+
+void SyncJournal::ClearDuas(void)
+{
+    while (!mState.mDuas.empty())
+    {
+        RemoveDua(*mState.mDuas.begin());
+    }
+}
+
+void SyncJournal::AppendFramesSince(uint64_t aEpoch, uint64_t aSequence, std::vector<uint8_t> &aFrames) const
+{
+    uint64_t firstSequence = mSequence + 1 - mLog.size();
+
+    if (aEpoch == mEpoch && aSequence <= mSequence && aSequence + 1 >= firstSequence)
+    {
+        for (size_t i = aSequence + 1 - firstSequence; i < mLog.size(); ++i)
+        {
+            aFrames.insert(aFrames.end(), mLog[i].begin(), mLog[i].end());
+        }
+    }
+    else
+    {
+        AppendSnapshot(aFrames);
+    }
+}
+
+void SyncJournal::AppendHeartbeat(std::vector<uint8_t> &aFrames) const
+{
+    AppendFrame(kFrameHeartbeat, mSequence, std::vector<uint8_t>(), aFrames);
+}
+
+void SyncJournal::AppendHello(std::vector<uint8_t> &aFrames) const
+{
+    std::vector<uint8_t> payload;
+
+    AppendUint(payload, mEpoch, sizeof(uint64_t));
+    AppendUint(payload, mSequence, sizeof(uint64_t));
+    AppendFrame(kFrameHello, 0, payload, aFrames);
+}
+
+otbrError SyncJournal::Apply(const Frame &aFrame)
+{
+    otbrError           error   = OTBR_ERROR_NONE;
+    const uint8_t *     cur     = aFrame.mPayload.data();
+    const uint8_t *     end     = cur + aFrame.mPayload.size();
+    bool                isDelta = (aFrame.mSequence == mSequence + 1);
+    bool                removed = false;
+    std::string         hostName;
+    SrpStateStore::Host host;
+    Ip6Address          dua;
+
+    switch (aFrame.mType)
+    {
+    case kFrameReset:
+        VerifyOrExit(aFrame.mPayload.size() == sizeof(uint64_t), error = OTBR_ERROR_PARSE);
+        mEpoch      = ReadUint(cur, sizeof(uint64_t));
+        mSequence   = aFrame.mSequence;
+        mInSnapshot = true;
+        mState      = State();
+        ExitNow();
+
+    case kFrameHeartbeat:
+        VerifyOrExit(mEpoch != 0 && aFrame.mSequence == mSequence, error = OTBR_ERROR_INVALID_ARGS);
+        mInSnapshot = false;
+        ExitNow();
+
+    case kFrameDataset:
+        break;
+
+    case kFrameHost:
+        SuccessOrExit(error = SrpStateStore::DecodeRecord(cur, end, hostName, host, removed));
+        VerifyOrExit(cur == end, error = OTBR_ERROR_PARSE);
+        break;
+
+    case kFrameDuaAdded:
+    case kFrameDuaRemoved:
+        VerifyOrExit(aFrame.mPayload.size() == sizeof(dua.m8), error = OTBR_ERROR_PARSE);
+        memcpy(dua.m8, cur, sizeof(dua.m8));
+        break;
+
+    default:
+        ExitNow(error = OTBR_ERROR_PARSE);
+    }
+
+    // A change follows the latest applied one, only the frames of a snapshot share its sequence number.
+    VerifyOrExit(mEpoch != 0 && (isDelta || (mInSnapshot && aFrame.mSequence == mSequence)),
+                 error = OTBR_ERROR_INVALID_ARGS);
+
+    if (isDelta)
+    {
+        mSequence   = aFrame.mSequence;
+        mInSnapshot = false;
+    }
+
+    switch (aFrame.mType)
+    {
+    case kFrameDataset:
+        mState.mDataset = aFrame.mPayload;
+        break;
+    case kFrameHost:
+        if (removed)
+        {
+            mState.mHosts.erase(hostName);
+        }
+        else
+        {
+            mState.mHosts[hostName] = std::move(host);
+        }
+        break;
+    case kFrameDuaAdded:
+        mState.mDuas.insert(dua);
+        break;
+    case kFrameDuaRemoved:
+        mState.mDuas.erase(dua);
+        break;
+    default:
+        break;
+    }
+
+exit:
+    return error;
+}
+
+otbrError SyncJournal::DecodeFrame(const uint8_t *&aCur, const uint8_t *aEnd, Frame &aFrame)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint64_t  length;
+
+    VerifyOrExit(static_cast<size_t>(aEnd - aCur) >= kFrameHeaderSize, error = OTBR_ERROR_NOT_FOUND);
+
+    length = ReadUint(aCur + 1 + sizeof(uint64_t), sizeof(uint32_t));
+    VerifyOrExit(length <= kMaxPayloadSize, error = OTBR_ERROR_PARSE);
+    VerifyOrExit(static_cast<size_t>(aEnd - aCur) - kFrameHeaderSize >= length, error = OTBR_ERROR_NOT_FOUND);
+
+    aFrame.mType     = aCur[0];
+    aFrame.mSequence = ReadUint(aCur + 1, sizeof(uint64_t));
+    aFrame.mPayload.assign(aCur + kFrameHeaderSize, aCur + kFrameHeaderSize + length);
+    aCur += kFrameHeaderSize + length;
+
+exit:
+    return error;
+}
+
+otbrError SyncJournal::DecodeHello(const Frame &aFrame, uint64_t &aEpoch, uint64_t &aSequence)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(aFrame.mType == kFrameHello && aFrame.mPayload.size() == 2 * sizeof(uint64_t),
+                 error = OTBR_ERROR_PARSE);
+
+    aEpoch    = ReadUint(aFrame.mPayload.data(), sizeof(uint64_t));
+    aSequence = ReadUint(aFrame.mPayload.data() + sizeof(uint64_t), sizeof(uint64_t));
+
+exit:
+    return error;
+}
+
+void SyncJournal::AppendFrame(uint8_t                     aType,
+                              uint64_t                    aSequence,
+                              const std::vector<uint8_t> &aPayload,
+                              std::vector<uint8_t> &      aFrames)
+{
+    aFrames.push_back(aType);
+    AppendUint(aFrames, aSequence, sizeof(uint64_t));
+    AppendUint(aFrames, aPayload.size(), sizeof(uint32_t));
+    aFrames.insert(aFrames.end(), aPayload.begin(), aPayload.end());
+}
+
+void SyncJournal::Record(uint8_t aType, const std::vector<uint8_t> &aPayload)
+{
+    std::vector<uint8_t> frame;
+
+    AppendFrame(aType, ++mSequence, aPayload, frame);
+    mLogBytes += frame.size();
+    mLog.push_back(std::move(frame));
+
+    // A standby further behind than the kept changes is sent a snapshot instead.
+    while (mLog.size() > kMaxLogFrames || (mLog.size() > 1 && mLogBytes > kMaxLogBytes))
+    {
+        mLogBytes -= mLog.front().size();
+        mLog.pop_front();
+    }
+}
+
+void SyncJournal::AppendSnapshot(std::vector<uint8_t> &aFrames) const
+{
+    std::vector<uint8_t> payload;
+
+    AppendUint(payload, mEpoch, sizeof(uint64_t));
+    AppendFrame(kFrameReset, mSequence, payload, aFrames);
+
+    if (!mState.mDataset.empty())
+    {
+        AppendFrame(kFrameDataset, mSequence, mState.mDataset, aFrames);
+    }
+
+    for (const auto &host : mState.mHosts)
+    {
+        if (SrpStateStore::EncodeRecord(host.first, &host.second, payload) == OTBR_ERROR_NONE)
+        {
+            AppendFrame(kFrameHost, mSequence, payload, aFrames);
+        }
+    }
+
+    for (const Ip6Address &dua : mState.mDuas)
+    {
+        AppendFrame(kFrameDuaAdded, mSequence, MakeDuaPayload(dua), aFrames);
+    }
+}
+
+} // namespace otbr
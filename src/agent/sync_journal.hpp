@@ -0,0 +1,265 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the journal of the state replicated to a standby agent.
+ */
+
+#ifndef OTBR_AGENT_SYNC_JOURNAL_HPP_
+#define OTBR_AGENT_SYNC_JOURNAL_HPP_
+
+#include <stdint.h>
+
+#include <deque>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "agent/srp_state_store.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements the journal of the state an active agent replicates to a standby agent.
+ *
+ * The replicated state is the active dataset, the SRP hosts published by the Advertising Proxy and the DUAs proxied
+ * by the Backbone Router. Every change of the state is a frame with the next sequence number, and the latest frames
+ * are kept so that a standby which reconnects only receives the frames it missed. A standby which is too far behind,
+ * or which followed an earlier run of the active agent, receives a reset frame followed by a snapshot of the state.
+ *
+ * A frame is the type (1), the sequence number (8), the payload length (4) and the payload, in network byte order.
+ *
+ */
+class SyncJournal
+{
+public:
+    /**
+     * The frame types.
+     *
+     */
+    enum FrameType : uint8_t
+    {
+        kFrameHello      = 1, ///< Standby to active: the epoch (8) and the last applied sequence number (8).
+        kFrameReset      = 2, ///< The epoch (8), the snapshot frames follow with the same sequence number.
+        kFrameDataset    = 3, ///< The active dataset TLVs.
+        kFrameHost       = 4, ///< An SRP host record, see `SrpStateStore::EncodeRecord()`.
+        kFrameDuaAdded   = 5, ///< The added DUA (16).
+        kFrameDuaRemoved = 6, ///< The removed DUA (16).
+        kFrameHeartbeat  = 7, ///< No payload, carries the latest sequence number.
+    };
+
+    /**
+     * This structure represents a decoded frame.
+     *
+     */
+    struct Frame
+    {
+        uint8_t              mType;     ///< The frame type.
+        uint64_t             mSequence; ///< The sequence number.
+        std::vector<uint8_t> mPayload;  ///< The payload.
+    };
+
+    /**
+     * This structure represents the replicated state.
+     *
+     */
+    struct State
+    {
+        std::vector<uint8_t> mDataset; ///< The active dataset TLVs, empty if unknown.
+        SrpStateStore::Hosts mHosts;   ///< The SRP hosts by host name.
+        std::set<Ip6Address> mDuas;    ///< The proxied DUAs.
+    };
+
+    /**
+     * The constructor initializes an empty journal.
+     *
+     * @param[in]   aEpoch  The epoch of the journal, which identifies a run of the active agent.
+     *
+     */
+    explicit SyncJournal(uint64_t aEpoch = 0);
+
+    /**
+     * This method returns the epoch of the journal.
+     *
+     * @returns The epoch, zero if a standby journal has not been reset yet.
+     *
+     */
+    uint64_t GetEpoch(void) const { return mEpoch; }
+
+    /**
+     * This method returns the sequence number of the latest change.
+     *
+     * @returns The sequence number.
+     *
+     */
+    uint64_t GetSequence(void) const { return mSequence; }
+
+    /**
+     * This method returns the replicated state.
+     *
+     * @returns The state.
+     *
+     */
+    const State &GetState(void) const { return mState; }
+
+    /**
+     * This method sets the active dataset, nothing is recorded if it did not change.
+     *
+     * @param[in]   aDataset    The active dataset TLVs.
+     *
+     */
+    void SetDataset(const std::vector<uint8_t> &aDataset);
+
+    /**
+     * This method adds, replaces or removes an SRP host.
+     *
+     * @param[in]   aName   The host name.
+     * @param[in]   aHost   The host, or nullptr to remove it.
+     *
+     * @retval  OTBR_ERROR_NONE          Successfully recorded the change.
+     * @retval  OTBR_ERROR_INVALID_ARGS  The host does not fit in a record.
+     *
+     */
+    otbrError SetHost(const std::string &aName, const SrpStateStore::Host *aHost);
+
+    /**
+     * This method adds a DUA, nothing is recorded if it is already present.
+     *
+     * @param[in]   aDua    The DUA.
+     *
+     */
+    void AddDua(const Ip6Address &aDua);
+
+    /**
+     * This method removes a DUA, nothing is recorded if it is not present.
+     *
+     * @param[in]   aDua    The DUA.
+     *
+     */
+    void RemoveDua(const Ip6Address &aDua);
+
+    /**
+     * This method removes all DUAs.
+     *
+     */
+    void ClearDuas(void);
+
+    /**
+     * This method appends the frames a standby needs to catch up with the journal.
+     *
+     * When the frames after @p aSequence of @p aEpoch are still kept, only they are appended. Otherwise a reset frame
+     * and a snapshot of the state are appended.
+     *
+     * @param[in]   aEpoch      The epoch the standby follows.
+     * @param[in]   aSequence   The last sequence number the standby applied.
+     * @param[out]  aFrames     The buffer to append the frames to.
+     *
+     */
+    void AppendFramesSince(uint64_t aEpoch, uint64_t aSequence, std::vector<uint8_t> &aFrames) const;
+
+    /**
+     * This method appends a heartbeat frame with the latest sequence number.
+     *
+     * @param[out]  aFrames     The buffer to append the frame to.
+     *
+     */
+    void AppendHeartbeat(std::vector<uint8_t> &aFrames) const;
+
+    /**
+     * This method appends a hello frame with the position of this standby journal.
+     *
+     * @param[out]  aFrames     The buffer to append the frame to.
+     *
+     */
+    void AppendHello(std::vector<uint8_t> &aFrames) const;
+
+    /**
+     * This method applies a frame received from the active agent to this standby journal.
+     *
+     * @param[in]   aFrame  The frame.
+     *
+     * @retval  OTBR_ERROR_NONE          Successfully applied the frame.
+     * @retval  OTBR_ERROR_INVALID_ARGS  The frame is out of sequence, the standby has to resynchronize.
+     * @retval  OTBR_ERROR_PARSE         The frame is malformed.
+     *
+     */
+    otbrError Apply(const Frame &aFrame);
+
+    /**
+     * This method decodes a frame.
+     *
+     * @param[inout]    aCur    The start of the frame, moved past the frame on success.
+     * @param[in]       aEnd    The end of the received data.
+     * @param[out]      aFrame  The decoded frame.
+     *
+     * @retval  OTBR_ERROR_NONE       Successfully decoded a frame.
+     * @retval  OTBR_ERROR_NOT_FOUND  The data does not hold a complete frame yet.
+     * @retval  OTBR_ERROR_PARSE      The frame is too large.
+     *
+     */
+    static otbrError DecodeFrame(const uint8_t *&aCur, const uint8_t *aEnd, Frame &aFrame);
+
+    /**
+     * This method decodes the payload of a hello frame.
+     *
+     * @param[in]   aFrame      The hello frame.
+     * @param[out]  aEpoch      The epoch the standby follows.
+     * @param[out]  aSequence   The last sequence number the standby applied.
+     *
+     * @retval  OTBR_ERROR_NONE   Successfully decoded the hello frame.
+     * @retval  OTBR_ERROR_PARSE  The frame is not a valid hello frame.
+     *
+     */
+    static otbrError DecodeHello(const Frame &aFrame, uint64_t &aEpoch, uint64_t &aSequence);
+
+private:
+    static constexpr size_t   kMaxLogFrames   = 1024;       // The most changes kept for catching up.
+    static constexpr size_t   kMaxLogBytes    = 256 * 1024; // The most bytes of changes kept for catching up.
+    static constexpr uint32_t kMaxPayloadSize = 128 * 1024; // The largest frame payload accepted.
+
+    static void AppendFrame(uint8_t                     aType,
+                            uint64_t                    aSequence,
+                            const std::vector<uint8_t> &aPayload,
+                            std::vector<uint8_t> &      aFrames);
+
+    void Record(uint8_t aType, const std::vector<uint8_t> &aPayload);
+    void AppendSnapshot(std::vector<uint8_t> &aFrames) const;
+
+    uint64_t                         mEpoch;
+    uint64_t                         mSequence;
+    bool                             mInSnapshot; // Whether a standby journal is receiving a snapshot.
+    State                            mState;
+    std::deque<std::vector<uint8_t>> mLog; // The frames of the latest changes, the last one has `mSequence`.
+    size_t                           mLogBytes;
+};
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_SYNC_JOURNAL_HPP_
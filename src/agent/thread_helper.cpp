@@ -32,10 +32,14 @@
 #include <limits.h>
 #include <string.h>
 
+#include <algorithm>
+#include <memory>
 #include <string>
 
 #include <openthread/border_router.h>
 #include <openthread/channel_manager.h>
+#include <openthread/channel_monitor.h>
+#include <openthread/dataset.h>
 #include <openthread/jam_detection.h>
 #include <openthread/joiner.h>
 #include <openthread/thread_ftd.h>
@@ -45,13 +49,30 @@
 #include "common/byteswap.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/tlv.hpp"
 
 namespace otbr {
 namespace agent {
 
+// The dataset TLVs without which the device cannot attach.
+static constexpr uint32_t kAttachDatasetTlvs =
+    Meshcop::TlvTypeBit(Meshcop::kActiveTimestamp) | Meshcop::TlvTypeBit(Meshcop::kChannel) |
+    Meshcop::TlvTypeBit(Meshcop::kPanId) | Meshcop::TlvTypeBit(Meshcop::kExtendedPanId) |
+    Meshcop::TlvTypeBit(Meshcop::kNetworkKey) | Meshcop::TlvTypeBit(Meshcop::kMeshLocalPrefix);
+
+static uint64_t GetUnixTimeMs(void)
+{
+    using std::chrono::duration_cast;
+    using std::chrono::milliseconds;
+    using std::chrono::system_clock;
+
+    return static_cast<uint64_t>(duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count());
+}
+
 ThreadHelper::ThreadHelper(otInstance *aInstance, otbr::Ncp::ControllerOpenThread *aNcp)
     : mInstance(aInstance)
     , mNcp(aNcp)
+    , mChannelSurvey()
 {
 }
 
@@ -82,6 +103,48 @@ void ThreadHelper::StateChangedCallback(otChangedFlags aFlags)
     }
 }
 
+void ThreadHelper::HandleSoftReset(otInstance *aInstance)
+{
+    ResultHandler     attachHandler     = std::move(mAttachHandler);
+    ResultHandler     joinerHandler     = std::move(mJoinerHandler);
+    AddJoinersHandler addJoinersHandler = std::move(mAddJoinersHandler);
+
+    mInstance          = aInstance;
+    mAttachHandler     = nullptr;
+    mJoinerHandler     = nullptr;
+    mAddJoinersHandler = nullptr;
+    mPendingJoiners.clear();
+
+    // The old instance will not report the end of its scans.
+    ActiveScanHandler(nullptr);
+    EnergyScanHandler(nullptr);
+
+    if (attachHandler != nullptr)
+    {
+        attachHandler(OT_ERROR_ABORT);
+    }
+
+    if (joinerHandler != nullptr)
+    {
+        joinerHandler(OT_ERROR_ABORT);
+    }
+
+    if (addJoinersHandler != nullptr)
+    {
+        addJoinersHandler(OT_ERROR_ABORT, {});
+    }
+
+#if OTBR_ENABLE_UNSECURE_JOIN
+    for (const auto &port : mUnsecurePortDeadlines)
+    {
+        (void)otIp6AddUnsecurePort(mInstance, port.first);
+    }
+
+    // Closes the ports expired meanwhile and sets the steering data again.
+    HandleUnsecurePortTimer();
+#endif
+}
+
 void ThreadHelper::AddDeviceRoleHandler(DeviceRoleHandler aHandler)
 {
     mDeviceRoleHandlers.emplace_back(aHandler);
@@ -89,24 +152,181 @@ void ThreadHelper::AddDeviceRoleHandler(DeviceRoleHandler aHandler)
 
 void ThreadHelper::Scan(ScanHandler aHandler)
 {
-    otError error = OT_ERROR_NONE;
+    auto    results = std::make_shared<std::vector<otActiveScanResult>>();
+    otError error   = OT_ERROR_NONE;
 
     VerifyOrExit(aHandler != nullptr);
+
+    error = StreamScan([aHandler, results](const otActiveScanResult *aResult) {
+        if (aResult != nullptr)
+        {
+            results->push_back(*aResult);
+        }
+        else
+        {
+            aHandler(OT_ERROR_NONE, *results);
+        }
+    });
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        aHandler(error, {});
+    }
+}
+
+otError ThreadHelper::StreamScan(ScanResultHandler aHandler)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(aHandler != nullptr, error = OT_ERROR_INVALID_ARGS);
+    // Do not take over the handler of a scan in progress, it would never be called.
+    VerifyOrExit(mScanHandler == nullptr, error = OT_ERROR_BUSY);
     mScanHandler = aHandler;
-    mScanResults.clear();
 
     error =
         otLinkActiveScan(mInstance, /*scanChannels =*/0, /*scanDuration=*/0, &ThreadHelper::sActiveScanHandler, this);
+    if (error != OT_ERROR_NONE)
+    {
+        mScanHandler = nullptr;
+    }
+
+exit:
+    return error;
+}
+
+void ThreadHelper::EnergyScan(uint32_t aScanChannels, uint16_t aScanDuration, EnergyScanHandler aHandler)
+{
+    auto    results = std::make_shared<std::vector<otEnergyScanResult>>();
+    otError error   = OT_ERROR_NONE;
+
+    VerifyOrExit(aHandler != nullptr);
+
+    error = StreamEnergyScan(aScanChannels, aScanDuration, [aHandler, results](const otEnergyScanResult *aResult) {
+        if (aResult != nullptr)
+        {
+            results->push_back(*aResult);
+        }
+        else
+        {
+            aHandler(OT_ERROR_NONE, *results);
+        }
+    });
 
 exit:
     if (error != OT_ERROR_NONE)
     {
-        if (aHandler)
+        aHandler(error, {});
+    }
+}
+
+otError ThreadHelper::StreamEnergyScan(uint32_t aScanChannels, uint16_t aScanDuration, EnergyScanResultHandler aHandler)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(aHandler != nullptr, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(mEnergyScanHandler == nullptr, error = OT_ERROR_BUSY);
+    mEnergyScanHandler = aHandler;
+
+    error = otLinkEnergyScan(mInstance, aScanChannels, aScanDuration, &ThreadHelper::sEnergyScanHandler, this);
+    if (error != OT_ERROR_NONE)
+    {
+        mEnergyScanHandler = nullptr;
+    }
+
+exit:
+    return error;
+}
+
+void ThreadHelper::SurveyChannels(bool aEnergyScan, uint16_t aScanDuration, ChannelSurveyHandler aHandler)
+{
+    VerifyOrExit(aHandler != nullptr);
+
+    if (!aEnergyScan)
+    {
+        UpdateChannelSurvey();
+        aHandler(OT_ERROR_NONE, mChannelSurvey);
+        ExitNow();
+    }
+
+    mChannelSurveyHandlers.push_back(std::move(aHandler));
+    // Join the energy scan of a survey in progress.
+    VerifyOrExit(mChannelSurveyHandlers.size() == 1);
+
+    EnergyScan(/* aScanChannels */ 0, aScanDuration,
+               [this](otError aError, const std::vector<otEnergyScanResult> &aResults) {
+                   HandleSurveyEnergyScan(aError, aResults);
+               });
+
+exit:
+    return;
+}
+
+void ThreadHelper::HandleSurveyEnergyScan(otError aError, const std::vector<otEnergyScanResult> &aResults)
+{
+    std::vector<ChannelSurveyHandler> handlers;
+
+    LogOpenThreadResult("Channel survey energy scan", aError);
+
+    if (aError == OT_ERROR_NONE)
+    {
+        mSurveyEnergyScan                   = aResults;
+        mChannelSurvey.mEnergyScanTimestamp = GetUnixTimeMs();
+    }
+
+    UpdateChannelSurvey();
+
+    // A handler may request another survey.
+    handlers.swap(mChannelSurveyHandlers);
+    for (const ChannelSurveyHandler &handler : handlers)
+    {
+        handler(aError, mChannelSurvey);
+    }
+}
+
+void ThreadHelper::UpdateChannelSurvey(void)
+{
+    uint32_t          channelMask  = otLinkGetSupportedChannelMask(mInstance);
+    constexpr uint8_t kNumChannels = sizeof(channelMask) * 8; // 8 bit per byte
+
+    mChannelSurvey.mChannels.clear();
+
+    for (uint8_t channel = 0; channel < kNumChannels; channel++)
+    {
+        ChannelReport report;
+
+        if (!(channelMask & (1U << channel)))
         {
-            mScanHandler(error, {});
+            continue;
         }
-        mScanHandler = nullptr;
+
+        report.mChannel = channel;
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+        report.mOccupancy = otChannelMonitorGetChannelOccupancy(mInstance, channel);
+#else  // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+        report.mOccupancy = 0;
+#endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+        report.mMaxRssi = OT_RADIO_RSSI_INVALID;
+
+        for (const otEnergyScanResult &result : mSurveyEnergyScan)
+        {
+            if (result.mChannel == channel)
+            {
+                report.mMaxRssi = result.mMaxRssi;
+                break;
+            }
+        }
+
+        mChannelSurvey.mChannels.push_back(report);
     }
+
+#if OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    mChannelSurvey.mSampleCount = otChannelMonitorGetSampleCount(mInstance);
+#else  // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    mChannelSurvey.mSampleCount = 0;
+#endif // OPENTHREAD_CONFIG_CHANNEL_MONITOR_ENABLE
+    mChannelSurvey.mCcaFailureRate = otLinkGetCcaFailureRate(mInstance);
+    mChannelSurvey.mTimestamp      = GetUnixTimeMs();
 }
 
 void ThreadHelper::RandomFill(void *aBuf, size_t size)
@@ -131,14 +351,44 @@ void ThreadHelper::ActiveScanHandler(otActiveScanResult *aResult)
 {
     if (aResult == nullptr)
     {
-        if (mScanHandler != nullptr)
+        ScanResultHandler handler = std::move(mScanHandler);
+
+        mScanHandler = nullptr;
+
+        if (handler != nullptr)
         {
-            mScanHandler(OT_ERROR_NONE, mScanResults);
+            handler(nullptr);
         }
     }
-    else
+    else if (mScanHandler != nullptr)
+    {
+        mScanHandler(aResult);
+    }
+}
+
+void ThreadHelper::sEnergyScanHandler(otEnergyScanResult *aResult, void *aThreadHelper)
+{
+    ThreadHelper *helper = static_cast<ThreadHelper *>(aThreadHelper);
+
+    helper->EnergyScanHandler(aResult);
+}
+
+void ThreadHelper::EnergyScanHandler(otEnergyScanResult *aResult)
+{
+    if (aResult == nullptr)
+    {
+        EnergyScanResultHandler handler = std::move(mEnergyScanHandler);
+
+        mEnergyScanHandler = nullptr;
+
+        if (handler != nullptr)
+        {
+            handler(nullptr);
+        }
+    }
+    else if (mEnergyScanHandler != nullptr)
     {
-        mScanResults.push_back(*aResult);
+        mEnergyScanHandler(aResult);
     }
 }
 
@@ -292,6 +542,67 @@ exit:
     }
 }
 
+void ThreadHelper::AttachDataset(const std::vector<uint8_t> &aDatasetTlvs, ResultHandler aHandler)
+{
+    otError                  error = OT_ERROR_NONE;
+    otOperationalDatasetTlvs datasetTlvs;
+    otOperationalDatasetTlvs currentTlvs;
+    otDeviceRole             role      = otThreadGetDeviceRole(mInstance);
+    bool                     attaching = false;
+
+    VerifyOrExit(aHandler != nullptr, error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(mAttachHandler == nullptr && mJoinerHandler == nullptr, error = OT_ERROR_INVALID_STATE);
+    VerifyOrExit(!aDatasetTlvs.empty() && aDatasetTlvs.size() <= sizeof(datasetTlvs.mTlvs),
+                 error = OT_ERROR_INVALID_ARGS);
+
+    {
+        TlvView view(aDatasetTlvs.data(), aDatasetTlvs.size());
+
+        VerifyOrExit(view.IsValid(), error = OT_ERROR_PARSE);
+        VerifyOrExit((Meshcop::GetTlvTypes(view) & kAttachDatasetTlvs) == kAttachDatasetTlvs,
+                     error = OT_ERROR_INVALID_ARGS);
+    }
+
+    memcpy(datasetTlvs.mTlvs, aDatasetTlvs.data(), aDatasetTlvs.size());
+    datasetTlvs.mLength = static_cast<uint8_t>(aDatasetTlvs.size());
+
+    if (otDatasetGetActiveTlvs(mInstance, &currentTlvs) == OT_ERROR_NONE &&
+        currentTlvs.mLength == datasetTlvs.mLength &&
+        memcmp(currentTlvs.mTlvs, datasetTlvs.mTlvs, datasetTlvs.mLength) == 0)
+    {
+        // Provisioning again with the same dataset, e.g. a retry, has nothing to do once attached.
+        VerifyOrExit(role == OT_DEVICE_ROLE_DISABLED || role == OT_DEVICE_ROLE_DETACHED);
+    }
+    else
+    {
+        // The dataset replaces the network of an attached device, it has to attach again.
+        if (role != OT_DEVICE_ROLE_DISABLED)
+        {
+            SuccessOrExit(error = otThreadSetEnabled(mInstance, false));
+        }
+        SuccessOrExit(error = otDatasetSetActiveTlvs(mInstance, &datasetTlvs));
+    }
+
+    mAttachHandler = aHandler;
+    attaching      = true;
+
+    if (!otIp6IsEnabled(mInstance))
+    {
+        SuccessOrExit(error = otIp6SetEnabled(mInstance, true));
+    }
+    SuccessOrExit(error = otThreadSetEnabled(mInstance, true));
+
+exit:
+    if (error != OT_ERROR_NONE && attaching)
+    {
+        mAttachHandler = nullptr;
+    }
+    if (aHandler != nullptr && (error != OT_ERROR_NONE || !attaching))
+    {
+        aHandler(error);
+    }
+}
+
 otError ThreadHelper::Reset(void)
 {
     mDeviceRoleHandlers.clear();
@@ -352,6 +663,137 @@ void ThreadHelper::JoinerCallback(otError aError)
     }
 }
 
+void ThreadHelper::AddJoiners(std::vector<JoinerEntry> aJoiners, AddJoinersHandler aHandler)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(mAddJoinersHandler == nullptr, error = OT_ERROR_BUSY);
+
+    // A petition in progress was started by another user of the commissioner, which gets its state changes.
+    VerifyOrExit(otCommissionerGetState(mInstance) != OT_COMMISSIONER_STATE_PETITION, error = OT_ERROR_INVALID_STATE);
+
+    if (otCommissionerGetState(mInstance) == OT_COMMISSIONER_STATE_DISABLED)
+    {
+        SuccessOrExit(
+            error = otCommissionerStart(mInstance, sCommissionerStateCallback, sCommissionerJoinerCallback, this));
+    }
+
+    mPendingJoiners    = std::move(aJoiners);
+    mAddJoinersHandler = std::move(aHandler);
+
+    if (otCommissionerGetState(mInstance) == OT_COMMISSIONER_STATE_ACTIVE)
+    {
+        AddPendingJoiners();
+    }
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        LogOpenThreadResult("Add joiners", error);
+        aHandler(error, {});
+    }
+}
+
+void ThreadHelper::AddJoinerEventHandler(JoinerEventHandler aHandler)
+{
+    mJoinerEventHandlers.emplace_back(aHandler);
+}
+
+void ThreadHelper::sCommissionerStateCallback(otCommissionerState aState, void *aThreadHelper)
+{
+    static_cast<ThreadHelper *>(aThreadHelper)->CommissionerStateCallback(aState);
+}
+
+void ThreadHelper::CommissionerStateCallback(otCommissionerState aState)
+{
+    AddJoinersHandler handler;
+
+    switch (aState)
+    {
+    case OT_COMMISSIONER_STATE_ACTIVE:
+        otbrLog(OTBR_LOG_INFO, "Commissioner is active");
+        AddPendingJoiners();
+        break;
+    case OT_COMMISSIONER_STATE_DISABLED:
+        // The petition was rejected, or the commissioner was stopped before it was accepted.
+        VerifyOrExit(mAddJoinersHandler != nullptr);
+        otbrLog(OTBR_LOG_WARNING, "Commissioner petition failed, %zu joiners not added", mPendingJoiners.size());
+        handler            = std::move(mAddJoinersHandler);
+        mAddJoinersHandler = nullptr;
+        mPendingJoiners.clear();
+        handler(OT_ERROR_REJECTED, {});
+        break;
+    case OT_COMMISSIONER_STATE_PETITION:
+        break;
+    }
+
+exit:
+    return;
+}
+
+void ThreadHelper::sCommissionerJoinerCallback(otCommissionerJoinerEvent aEvent,
+                                               const otJoinerInfo *      aJoinerInfo,
+                                               const otExtAddress *      aJoinerId,
+                                               void *                    aThreadHelper)
+{
+    static_cast<ThreadHelper *>(aThreadHelper)->CommissionerJoinerCallback(aEvent, aJoinerInfo, aJoinerId);
+}
+
+void ThreadHelper::CommissionerJoinerCallback(otCommissionerJoinerEvent aEvent,
+                                              const otJoinerInfo *      aJoinerInfo,
+                                              const otExtAddress *      aJoinerId)
+{
+    for (const auto &handler : mJoinerEventHandlers)
+    {
+        handler(aEvent, aJoinerInfo, aJoinerId);
+    }
+}
+
+void ThreadHelper::AddPendingJoiners(void)
+{
+    static const otExtAddress kAnyEui64 = {};
+
+    AddJoinersHandler        handler = std::move(mAddJoinersHandler);
+    std::vector<JoinerEntry> joiners = std::move(mPendingJoiners);
+    std::vector<otError>     results;
+    size_t                   added = 0;
+
+    mAddJoinersHandler = nullptr;
+    mPendingJoiners.clear();
+    VerifyOrExit(handler != nullptr);
+
+    results.reserve(joiners.size());
+
+    // All the joiners are added in one go, without returning to the mainloop in between.
+    for (const JoinerEntry &joiner : joiners)
+    {
+        otError error;
+
+        if (joiner.mDiscerner.mLength != 0)
+        {
+            error = otCommissionerAddJoinerWithDiscerner(mInstance, &joiner.mDiscerner, joiner.mPskd.c_str(),
+                                                         joiner.mTimeout);
+        }
+        else
+        {
+            bool isAny = memcmp(&joiner.mEui64, &kAnyEui64, sizeof(kAnyEui64)) == 0;
+
+            error = otCommissionerAddJoiner(mInstance, isAny ? nullptr : &joiner.mEui64, joiner.mPskd.c_str(),
+                                            joiner.mTimeout);
+        }
+
+        added += (error == OT_ERROR_NONE) ? 1 : 0;
+        results.push_back(error);
+    }
+
+    otbrLog(added == joiners.size() ? OTBR_LOG_INFO : OTBR_LOG_WARNING, "Added %zu of %zu joiners", added,
+            joiners.size());
+    handler(OT_ERROR_NONE, results);
+
+exit:
+    return;
+}
+
 otError ThreadHelper::TryResumeNetwork(void)
 {
     otError error = OT_ERROR_NONE;
@@ -377,49 +819,91 @@ exit:
 #if OTBR_ENABLE_UNSECURE_JOIN
 otError ThreadHelper::PermitUnsecureJoin(uint16_t aPort, uint32_t aSeconds)
 {
-    otError      error = OT_ERROR_NONE;
-    otExtAddress steeringData;
+    return PermitUnsecureJoin(std::vector<uint16_t>{aPort}, aSeconds);
+}
 
-    // 0xff to allow all devices to join
-    memset(&steeringData.m8, 0xff, sizeof(steeringData.m8));
-    SuccessOrExit(error = otIp6AddUnsecurePort(mInstance, aPort));
-    otThreadSetSteeringData(mInstance, &steeringData);
+otError ThreadHelper::PermitUnsecureJoin(const std::vector<uint16_t> &aPorts, uint32_t aSeconds)
+{
+    otError error    = OT_ERROR_NONE;
+    auto    deadline = std::chrono::steady_clock::now() + std::chrono::seconds(aSeconds);
+
+    VerifyOrExit(aSeconds > 0, CloseUnsecurePorts(aPorts));
 
-    if (aSeconds > 0)
+    for (uint16_t port : aPorts)
     {
-        auto triggerTime = std::chrono::steady_clock::now() + std::chrono::seconds(aSeconds);
+        auto opened = mUnsecurePortDeadlines.find(port);
 
-        if (mUnsecurePortCloseTime.find(aPort) == mUnsecurePortCloseTime.end() ||
-            mUnsecurePortCloseTime[aPort] < triggerTime)
+        if (opened == mUnsecurePortDeadlines.end())
+        {
+            SuccessOrExit(error = otIp6AddUnsecurePort(mInstance, port));
+            mUnsecurePortDeadlines[port] = deadline;
+        }
+        else if (opened->second < deadline)
         {
-            mUnsecurePortCloseTime[aPort] = triggerTime;
+            // A port is kept open until the last joiner using it is done.
+            opened->second = deadline;
         }
+    }
 
-        mNcp->PostTimerTask(triggerTime, [this, aPort]() {
-            auto         now = std::chrono::steady_clock::now();
-            otExtAddress noneAddress;
+exit:
+    UpdateUnsecurePorts();
+    return error;
+}
 
-            // 0 to clean steering data
-            memset(&noneAddress.m8, 0, sizeof(noneAddress.m8));
-            if (now >= mUnsecurePortCloseTime[aPort])
-            {
-                (void)otIp6RemoveUnsecurePort(mInstance, aPort);
-                otThreadSetSteeringData(mInstance, &noneAddress);
-                mUnsecurePortCloseTime.erase(aPort);
-            }
-        });
+void ThreadHelper::CloseUnsecurePorts(const std::vector<uint16_t> &aPorts)
+{
+    for (uint16_t port : aPorts)
+    {
+        mUnsecurePortDeadlines.erase(port);
+        (void)otIp6RemoveUnsecurePort(mInstance, port);
     }
-    else
+
+    UpdateUnsecurePorts();
+}
+
+void ThreadHelper::HandleUnsecurePortTimer(void)
+{
+    auto now = std::chrono::steady_clock::now();
+
+    for (auto port = mUnsecurePortDeadlines.begin(); port != mUnsecurePortDeadlines.end();)
     {
-        otExtAddress noneAddress;
+        if (port->second <= now)
+        {
+            (void)otIp6RemoveUnsecurePort(mInstance, port->first);
+            port = mUnsecurePortDeadlines.erase(port);
+        }
+        else
+        {
+            ++port;
+        }
+    }
+
+    UpdateUnsecurePorts();
+}
+
+void ThreadHelper::UpdateUnsecurePorts(void)
+{
+    otExtAddress steeringData;
+    auto         deadline = std::chrono::steady_clock::time_point::max();
+
+    // 0xff to allow all devices to join while a port is open, 0 to clean steering data
+    memset(&steeringData.m8, mUnsecurePortDeadlines.empty() ? 0 : 0xff, sizeof(steeringData.m8));
+    otThreadSetSteeringData(mInstance, &steeringData);
 
-        memset(&noneAddress.m8, 0, sizeof(noneAddress.m8));
-        (void)otIp6RemoveUnsecurePort(mInstance, aPort);
-        otThreadSetSteeringData(mInstance, &noneAddress);
+    for (const auto &port : mUnsecurePortDeadlines)
+    {
+        deadline = std::min(deadline, port.second);
     }
 
-exit:
-    return error;
+    // One timer for the earliest deadline, the later ones are handled when it fires.
+    if (mUnsecurePortDeadlines.empty())
+    {
+        mUnsecurePortTimer.Cancel();
+    }
+    else if (!mUnsecurePortTimer.Reschedule(deadline))
+    {
+        mUnsecurePortTimer = mNcp->PostTimerTask(deadline, [this]() { HandleUnsecurePortTimer(); });
+    }
 }
 #endif
 
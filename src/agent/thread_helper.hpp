@@ -41,6 +41,7 @@
 #include <string>
 #include <vector>
 
+#include <openthread/commissioner.h>
 #include <openthread/instance.h>
 #include <openthread/ip6.h>
 #include <openthread/jam_detection.h>
@@ -49,6 +50,7 @@
 #include <openthread/thread.h>
 
 #include "common/logging.hpp"
+#include "common/timer_wheel.hpp"
 
 namespace otbr {
 namespace Ncp {
@@ -65,9 +67,53 @@ namespace agent {
 class ThreadHelper
 {
 public:
-    using DeviceRoleHandler = std::function<void(otDeviceRole)>;
-    using ScanHandler       = std::function<void(otError, const std::vector<otActiveScanResult> &)>;
-    using ResultHandler     = std::function<void(otError)>;
+    using DeviceRoleHandler       = std::function<void(otDeviceRole)>;
+    using ScanHandler             = std::function<void(otError, const std::vector<otActiveScanResult> &)>;
+    using ScanResultHandler       = std::function<void(const otActiveScanResult *)>;
+    using EnergyScanHandler       = std::function<void(otError, const std::vector<otEnergyScanResult> &)>;
+    using EnergyScanResultHandler = std::function<void(const otEnergyScanResult *)>;
+    using ResultHandler           = std::function<void(otError)>;
+    using AddJoinersHandler       = std::function<void(otError, const std::vector<otError> &)>;
+    using JoinerEventHandler =
+        std::function<void(otCommissionerJoinerEvent, const otJoinerInfo *, const otExtAddress *)>;
+
+    /**
+     * This structure represents a joiner to commission.
+     *
+     */
+    struct JoinerEntry
+    {
+        otExtAddress      mEui64;     ///< The EUI-64 of the joiner, all zeros for any joiner.
+        otJoinerDiscerner mDiscerner; ///< The discerner of the joiner, used instead of the EUI-64 if not empty.
+        std::string       mPskd;      ///< The pre-shared key of the joiner.
+        uint32_t          mTimeout;   ///< The time in seconds the joiner is allowed to join.
+    };
+
+    /**
+     * This structure represents the quality of a channel in a channel survey.
+     *
+     */
+    struct ChannelReport
+    {
+        uint8_t  mChannel;   ///< IEEE 802.15.4 channel.
+        uint16_t mOccupancy; ///< Channel monitor occupancy, 0xffff for 100%, 0 without the channel monitor.
+        int8_t   mMaxRssi;   ///< Max RSSI (dBm) of the last energy scan, `OT_RADIO_RSSI_INVALID` if not scanned.
+    };
+
+    /**
+     * This structure represents a channel survey.
+     *
+     */
+    struct ChannelSurvey
+    {
+        std::vector<ChannelReport> mChannels;            ///< The supported channels.
+        uint32_t                   mSampleCount;         ///< The number of channel monitor samples.
+        uint16_t                   mCcaFailureRate;      ///< The CCA failure rate, 0xffff for 100%.
+        uint64_t                   mTimestamp;           ///< When the survey was taken, in ms since the Unix epoch.
+        uint64_t                   mEnergyScanTimestamp; ///< When the last energy scan finished, 0 if never.
+    };
+
+    using ChannelSurveyHandler = std::function<void(otError, const ChannelSurvey &)>;
 
     /**
      * The constructor of a Thread helper.
@@ -90,13 +136,37 @@ public:
      * This method permits unsecure join on port.
      *
      * @param[in]   aPort     The port number.
-     * @param[in]   aSeconds  The timeout to close the port, 0 for never close.
+     * @param[in]   aSeconds  The timeout to close the port, 0 to close it now.
      *
      * @returns The error value of underlying OpenThread api calls.
      *
      */
     otError PermitUnsecureJoin(uint16_t aPort, uint32_t aSeconds);
 
+    /**
+     * This method permits unsecure join on several ports, e.g. for the joiners of a multi-joiner commissioning.
+     *
+     * A port already open is kept open until the later of its deadlines. If a port fails to open, the ports before
+     * it in @p aPorts are left open until their deadline.
+     *
+     * @param[in]   aPorts    The port numbers.
+     * @param[in]   aSeconds  The timeout to close the ports, 0 to close them now.
+     *
+     * @returns The error value of underlying OpenThread api calls.
+     *
+     */
+    otError PermitUnsecureJoin(const std::vector<uint16_t> &aPorts, uint32_t aSeconds);
+
+    /**
+     * This method closes unsecure ports before their deadline.
+     *
+     * The steering data allowing all devices to join is cleared once no port is left open.
+     *
+     * @param[in]   aPorts    The port numbers.
+     *
+     */
+    void CloseUnsecurePorts(const std::vector<uint16_t> &aPorts);
+
     /**
      * This method performs a Thread network scan.
      *
@@ -105,6 +175,70 @@ public:
      */
     void Scan(ScanHandler aHandler);
 
+    /**
+     * This method performs a Thread network scan and reports each result as it arrives.
+     *
+     * The handler is called with every beacon received, and once more with a null result when the scan finishes.
+     * It is not called if the scan cannot be started.
+     *
+     * @param[in]   aHandler  The scan result handler.
+     *
+     * @retval OT_ERROR_NONE    Successfully started the scan.
+     * @retval OT_ERROR_BUSY    A scan is already in progress.
+     * @returns The error value of underlying OpenThread api calls.
+     *
+     */
+    otError StreamScan(ScanResultHandler aHandler);
+
+    /**
+     * This method performs an energy scan.
+     *
+     * @param[in]   aScanChannels   A bitmask of the channels to scan, 0 for all supported channels.
+     * @param[in]   aScanDuration   The time in milliseconds to spend scanning each channel, 0 for the default.
+     * @param[in]   aHandler        The energy scan result handler.
+     *
+     */
+    void EnergyScan(uint32_t aScanChannels, uint16_t aScanDuration, EnergyScanHandler aHandler);
+
+    /**
+     * This method performs an energy scan and reports the result of each channel as it is scanned.
+     *
+     * The handler is called the same way as by StreamScan().
+     *
+     * @param[in]   aScanChannels   A bitmask of the channels to scan, 0 for all supported channels.
+     * @param[in]   aScanDuration   The time in milliseconds to spend scanning each channel, 0 for the default.
+     * @param[in]   aHandler        The energy scan result handler.
+     *
+     * @retval OT_ERROR_NONE    Successfully started the energy scan.
+     * @retval OT_ERROR_BUSY    An energy scan is already in progress.
+     * @returns The error value of underlying OpenThread api calls.
+     *
+     */
+    otError StreamEnergyScan(uint32_t aScanChannels, uint16_t aScanDuration, EnergyScanResultHandler aHandler);
+
+    /**
+     * This method surveys the quality of all supported channels.
+     *
+     * The channel monitor occupancies and the CCA failure rate are read when the survey is reported, and merged with
+     * the results of an energy scan. Without a new energy scan, the results of the last one are reported, as told by
+     * `mEnergyScanTimestamp`. A survey requested while an energy scan of another survey is in progress is reported
+     * with the results of that scan.
+     *
+     * @param[in]   aEnergyScan     Whether to run a new energy scan.
+     * @param[in]   aScanDuration   The time in milliseconds to spend scanning each channel, 0 for the default.
+     * @param[in]   aHandler        The channel survey handler.
+     *
+     */
+    void SurveyChannels(bool aEnergyScan, uint16_t aScanDuration, ChannelSurveyHandler aHandler);
+
+    /**
+     * This method returns the last channel survey.
+     *
+     * @returns The last channel survey, which is empty before the first one.
+     *
+     */
+    const ChannelSurvey &GetChannelSurvey(void) const { return mChannelSurvey; }
+
     /**
      * This method attaches the device to the Thread network.
      *
@@ -138,6 +272,21 @@ public:
      */
     void Attach(ResultHandler aHandler);
 
+    /**
+     * This method attaches the device to the Thread network of a complete Active Operational Dataset in one step.
+     *
+     * The dataset is committed as the active dataset, instead of setting each network parameter. Attaching again
+     * with the active dataset of a device already attached completes at once. The handler gets `OT_ERROR_PARSE` for
+     * malformed TLVs, and `OT_ERROR_INVALID_ARGS` if a TLV needed to attach is missing.
+     *
+     * @note The joiner start and the attach proccesses are exclusive.
+     *
+     * @param[in]   aDatasetTlvs    The Active Operational Dataset, encoded in TLVs.
+     * @param[in]   aHandler        The attach result handler.
+     *
+     */
+    void AttachDataset(const std::vector<uint8_t> &aDatasetTlvs, ResultHandler aHandler);
+
     /**
      * This method resets the OpenThread stack.
      *
@@ -168,6 +317,29 @@ public:
                      const std::string &aVendorData,
                      ResultHandler      aHandler);
 
+    /**
+     * This method adds a batch of joiners to the commissioner, starting the commissioner if it is disabled.
+     *
+     * The joiners are added back-to-back once the commissioner is active, and the handler is called with the result
+     * of adding each of them. The progress of each joiner is then reported to the joiner event handlers, if the
+     * commissioner was started by this helper.
+     *
+     * @param[in]   aJoiners    The joiners to add.
+     * @param[in]   aHandler    The handler called with an error if the commissioner cannot be started, or with
+     *                          `OT_ERROR_NONE` and the result of adding each joiner.
+     *
+     */
+    void AddJoiners(std::vector<JoinerEntry> aJoiners, AddJoinersHandler aHandler);
+
+    /**
+     * This method adds a handler for the events of the joiners being commissioned.
+     *
+     * @param[in]   aHandler    The handler called with the event, the joiner entry or nullptr if the joiner was not
+     *                          added by this border router, and the joiner ID or nullptr.
+     *
+     */
+    void AddJoinerEventHandler(JoinerEventHandler aHandler);
+
     /**
      * This method tries to restore the network after reboot
      *
@@ -192,6 +364,17 @@ public:
      */
     void StateChangedCallback(otChangedFlags aFlags);
 
+    /**
+     * This method moves the helper to the OpenThread instance re-initialized by a soft reset.
+     *
+     * The scans in progress end with the results received so far, the attach and joiner operations fail with
+     * `OT_ERROR_ABORT`, and the unsecure ports which did not expire are opened again.
+     *
+     * @param[in]  aInstance  The re-initialized OpenThread instance.
+     *
+     */
+    void HandleSoftReset(otInstance *aInstance);
+
     /**
      * This method logs OpenThread action result.
      *
@@ -209,9 +392,29 @@ private:
     static void sActiveScanHandler(otActiveScanResult *aResult, void *aThreadHelper);
     void        ActiveScanHandler(otActiveScanResult *aResult);
 
+    static void sEnergyScanHandler(otEnergyScanResult *aResult, void *aThreadHelper);
+    void        EnergyScanHandler(otEnergyScanResult *aResult);
+
     static void sJoinerCallback(otError aError, void *aThreadHelper);
     void        JoinerCallback(otError aResult);
 
+    static void sCommissionerStateCallback(otCommissionerState aState, void *aThreadHelper);
+    void        CommissionerStateCallback(otCommissionerState aState);
+    static void sCommissionerJoinerCallback(otCommissionerJoinerEvent aEvent,
+                                            const otJoinerInfo *      aJoinerInfo,
+                                            const otExtAddress *      aJoinerId,
+                                            void *                    aThreadHelper);
+    void        CommissionerJoinerCallback(otCommissionerJoinerEvent aEvent,
+                                           const otJoinerInfo *      aJoinerInfo,
+                                           const otExtAddress *      aJoinerId);
+    void        AddPendingJoiners(void);
+
+    void HandleUnsecurePortTimer(void);
+    void UpdateUnsecurePorts(void);
+
+    void UpdateChannelSurvey(void);
+    void HandleSurveyEnergyScan(otError aError, const std::vector<otEnergyScanResult> &aResults);
+
     void    RandomFill(void *aBuf, size_t size);
     uint8_t RandomChannelFromChannelMask(uint32_t aChannelMask);
 
@@ -219,12 +422,23 @@ private:
 
     otbr::Ncp::ControllerOpenThread *mNcp;
 
-    ScanHandler                     mScanHandler;
-    std::vector<otActiveScanResult> mScanResults;
+    ScanResultHandler       mScanHandler;
+    EnergyScanResultHandler mEnergyScanHandler;
+
+    ChannelSurvey                     mChannelSurvey;
+    std::vector<otEnergyScanResult>   mSurveyEnergyScan;
+    std::vector<ChannelSurveyHandler> mChannelSurveyHandlers;
 
     std::vector<DeviceRoleHandler> mDeviceRoleHandlers;
 
-    std::map<uint16_t, std::chrono::steady_clock::time_point> mUnsecurePortCloseTime;
+    // The joiners waiting for the commissioner to become active, see `AddJoiners()`
+    std::vector<JoinerEntry>        mPendingJoiners;
+    AddJoinersHandler               mAddJoinersHandler;
+    std::vector<JoinerEventHandler> mJoinerEventHandlers;
+
+    // The unsecure ports open and when to close them, see `UpdateUnsecurePorts()`
+    std::map<uint16_t, std::chrono::steady_clock::time_point> mUnsecurePortDeadlines;
+    TimerWheel::Handle                                        mUnsecurePortTimer;
 
     ResultHandler mAttachHandler;
     ResultHandler mJoinerHandler;
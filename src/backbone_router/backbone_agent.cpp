@@ -35,39 +35,42 @@
 
 #include <assert.h>
 #include <net/if.h>
+#include <string.h>
 
 #include <openthread/backbone_router_ftd.h>
 
+#include "agent/instance_params.hpp"
 #include "common/code_utils.hpp"
+#include "common/metrics.hpp"
 
 namespace otbr {
 namespace BackboneRouter {
 
+// Thread devices register their DUAs with a new Primary Backbone Router within its reregistration delay.
+static constexpr std::chrono::seconds kRestoredDuaTimeout(300);
+
 BackboneAgent::BackboneAgent(otbr::Ncp::ControllerOpenThread &aNcp)
     : mNcp(aNcp)
     , mBackboneRouterState(OT_BACKBONE_ROUTER_STATE_DISABLED)
     , mNdProxyManager(aNcp)
+    , mMulticastRoutingManager(aNcp)
 {
 }
 
 void BackboneAgent::Init(void)
 {
-    mNcp.On(Ncp::kEventBackboneRouterState, HandleBackboneRouterState, this);
-    mNcp.On(Ncp::kEventBackboneRouterDomainPrefixEvent, HandleBackboneRouterDomainPrefixEvent, this);
-    mNcp.On(Ncp::kEventBackboneRouterNdProxyEvent, HandleBackboneRouterNdProxyEvent, this);
+    mNcp.On<Ncp::kEventBackboneRouterState>(HandleBackboneRouterState, this);
+    mNcp.On<Ncp::kEventBackboneRouterDomainPrefixEvent>(HandleBackboneRouterDomainPrefixEvent, this);
+    mNcp.On<Ncp::kEventBackboneRouterNdProxyEvent>(HandleBackboneRouterNdProxyEvent, this);
+    mNcp.On<Ncp::kEventBackboneRouterMulticastListenerEvent>(HandleBackboneRouterMulticastListenerEvent, this);
 
     mNdProxyManager.Init();
 
     HandleBackboneRouterState();
 }
 
-void BackboneAgent::HandleBackboneRouterState(void *aContext, int aEvent, va_list aArguments)
+void BackboneAgent::HandleBackboneRouterState(void *aContext)
 {
-    OT_UNUSED_VARIABLE(aEvent);
-    OT_UNUSED_VARIABLE(aArguments);
-
-    assert(aEvent == Ncp::kEventBackboneRouterState);
-
     static_cast<BackboneAgent *>(aContext)->HandleBackboneRouterState();
 }
 
@@ -102,7 +105,10 @@ void BackboneAgent::OnBecomePrimary(void)
     if (mDomainPrefix.IsValid())
     {
         mNdProxyManager.Enable(mDomainPrefix);
+        ApplyRestoredDuas();
     }
+
+    mMulticastRoutingManager.Enable();
 }
 
 void BackboneAgent::OnResignPrimary(void)
@@ -111,6 +117,9 @@ void BackboneAgent::OnResignPrimary(void)
             StateToString(mBackboneRouterState));
 
     mNdProxyManager.Disable();
+    mMulticastRoutingManager.Disable();
+    mRestoredDuas.clear();
+    mRestoredDuaTimer.Cancel();
 }
 
 const char *BackboneAgent::StateToString(otBackboneRouterState aState)
@@ -144,20 +153,35 @@ void BackboneAgent::UpdateFdSet(fd_set & aReadFdSet,
 void BackboneAgent::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
 {
     mNdProxyManager.Process(aReadFdSet, aWriteFdSet, aErrorFdSet);
+    mMulticastRoutingManager.Process();
 }
 
-void BackboneAgent::HandleBackboneRouterDomainPrefixEvent(void *aContext, int aEvent, va_list aArguments)
+void BackboneAgent::HandleBackboneInterfaceChanged(void)
 {
-    OT_UNUSED_VARIABLE(aEvent);
+    VerifyOrExit(IsPrimary());
 
-    otBackboneRouterDomainPrefixEvent event;
-    const otIp6Prefix *               domainPrefix;
+    otbrLog(OTBR_LOG_NOTICE, "BackboneAgent: Backbone interface changed to %s",
+            InstanceParams::Get().GetBackboneIfName());
 
-    assert(aEvent == Ncp::kEventBackboneRouterDomainPrefixEvent);
+    mNdProxyManager.Disable();
+    mMulticastRoutingManager.Disable();
+
+    if (mDomainPrefix.IsValid())
+    {
+        mNdProxyManager.Enable(mDomainPrefix);
+    }
+
+    mMulticastRoutingManager.Enable();
+
+exit:
+    return;
+}
 
-    event        = static_cast<otBackboneRouterDomainPrefixEvent>(va_arg(aArguments, int));
-    domainPrefix = va_arg(aArguments, const otIp6Prefix *);
-    static_cast<BackboneAgent *>(aContext)->HandleBackboneRouterDomainPrefixEvent(event, domainPrefix);
+void BackboneAgent::HandleBackboneRouterDomainPrefixEvent(void *                            aContext,
+                                                          otBackboneRouterDomainPrefixEvent aEvent,
+                                                          const otIp6Prefix *               aDomainPrefix)
+{
+    static_cast<BackboneAgent *>(aContext)->HandleBackboneRouterDomainPrefixEvent(aEvent, aDomainPrefix);
 }
 
 void BackboneAgent::HandleBackboneRouterDomainPrefixEvent(otBackboneRouterDomainPrefixEvent aEvent,
@@ -178,27 +202,99 @@ void BackboneAgent::HandleBackboneRouterDomainPrefixEvent(otBackboneRouterDomain
 
     mNdProxyManager.Disable();
     mNdProxyManager.Enable(mDomainPrefix);
+    ApplyRestoredDuas();
 exit:
     return;
 }
 
-void BackboneAgent::HandleBackboneRouterNdProxyEvent(void *aContext, int aEvent, va_list aArguments)
+void BackboneAgent::HandleBackboneRouterNdProxyEvent(void *                       aContext,
+                                                     otBackboneRouterNdProxyEvent aEvent,
+                                                     const otIp6Address *         aDua)
 {
-    OT_UNUSED_VARIABLE(aEvent);
+    static_cast<BackboneAgent *>(aContext)->HandleBackboneRouterNdProxyEvent(aEvent, aDua);
+}
 
-    otBackboneRouterNdProxyEvent event;
-    const otIp6Address *         address;
+void BackboneAgent::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua)
+{
+    if (aEvent == OT_BACKBONE_ROUTER_NDPROXY_ADDED)
+    {
+        Metrics::Get().Increment(Metrics::kCounterDuaAdded);
+    }
+    else if (aEvent == OT_BACKBONE_ROUTER_NDPROXY_REMOVED)
+    {
+        Metrics::Get().Increment(Metrics::kCounterDuaRemoved);
+    }
 
-    assert(aEvent == Ncp::kEventBackboneRouterNdProxyEvent);
+    // A restored DUA is left to the Thread device once it registers again, or removes it.
+    if (aEvent == OT_BACKBONE_ROUTER_NDPROXY_CLEARED)
+    {
+        mRestoredDuas.clear();
+    }
+    else if (aDua != nullptr)
+    {
+        mRestoredDuas.erase(Ip6Address(aDua->mFields.m8));
+    }
 
-    event   = static_cast<otBackboneRouterNdProxyEvent>(va_arg(aArguments, int));
-    address = va_arg(aArguments, const otIp6Address *);
-    static_cast<BackboneAgent *>(aContext)->HandleBackboneRouterNdProxyEvent(event, address);
+    mNdProxyManager.HandleBackboneRouterNdProxyEvent(aEvent, aDua);
 }
 
-void BackboneAgent::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua)
+void BackboneAgent::RestoreDuas(const std::set<Ip6Address> &aDuas)
 {
-    mNdProxyManager.HandleBackboneRouterNdProxyEvent(aEvent, aDua);
+    mRestoredDuas.insert(aDuas.begin(), aDuas.end());
+
+    otbrLog(OTBR_LOG_INFO, "BackboneAgent: restoring %zu DUAs", aDuas.size());
+
+    ApplyRestoredDuas();
+}
+
+void BackboneAgent::ApplyRestoredDuas(void)
+{
+    VerifyOrExit(!mRestoredDuas.empty() && IsPrimary() && mNdProxyManager.IsEnabled());
+
+    for (const Ip6Address &dua : mRestoredDuas)
+    {
+        otIp6Address address;
+
+        memcpy(address.mFields.m8, dua.m8, sizeof(address.mFields.m8));
+        mNdProxyManager.HandleBackboneRouterNdProxyEvent(OT_BACKBONE_ROUTER_NDPROXY_ADDED, &address);
+    }
+
+    if (!mRestoredDuaTimer.IsPending())
+    {
+        mRestoredDuaTimer = mNcp.PostTimerTask(std::chrono::steady_clock::now() + kRestoredDuaTimeout,
+                                               [this]() { ExpireRestoredDuas(); });
+    }
+
+exit:
+    return;
+}
+
+void BackboneAgent::ExpireRestoredDuas(void)
+{
+    otbrLog(OTBR_LOG_INFO, "BackboneAgent: %zu restored DUAs were not registered again", mRestoredDuas.size());
+
+    for (const Ip6Address &dua : mRestoredDuas)
+    {
+        otIp6Address address;
+
+        memcpy(address.mFields.m8, dua.m8, sizeof(address.mFields.m8));
+        mNdProxyManager.HandleBackboneRouterNdProxyEvent(OT_BACKBONE_ROUTER_NDPROXY_REMOVED, &address);
+    }
+
+    mRestoredDuas.clear();
+}
+
+void BackboneAgent::HandleBackboneRouterMulticastListenerEvent(void *                                 aContext,
+                                                               otBackboneRouterMulticastListenerEvent aEvent,
+                                                               const otIp6Address *                   aAddress)
+{
+    static_cast<BackboneAgent *>(aContext)->HandleBackboneRouterMulticastListenerEvent(aEvent, aAddress);
+}
+
+void BackboneAgent::HandleBackboneRouterMulticastListenerEvent(otBackboneRouterMulticastListenerEvent aEvent,
+                                                               const otIp6Address *                   aAddress)
+{
+    mMulticastRoutingManager.HandleBackboneMulticastListenerEvent(aEvent, Ip6Address(aAddress->mFields.m8));
 }
 
 } // namespace BackboneRouter
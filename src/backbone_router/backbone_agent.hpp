@@ -34,10 +34,13 @@
 #ifndef BACKBONE_ROUTER_BACKBONE_AGENT_HPP_
 #define BACKBONE_ROUTER_BACKBONE_AGENT_HPP_
 
+#include <set>
+
 #include <openthread/backbone_router_ftd.h>
 
 #include "agent/instance_params.hpp"
 #include "agent/ncp_openthread.hpp"
+#include "backbone_router/multicast_routing.hpp"
 #include "backbone_router/nd_proxy.hpp"
 
 namespace otbr {
@@ -99,24 +102,60 @@ public:
      */
     void Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet);
 
+    /**
+     * This method restarts the ND proxy and multicast routing on the current backbone interface.
+     *
+     * It is called after the backbone interface name in `InstanceParams` changed, and does nothing unless this
+     * device is the Primary Backbone Router.
+     *
+     */
+    void HandleBackboneInterfaceChanged(void);
+
+    /**
+     * This method proxies the DUAs a failed peer Backbone Router was proxying, see `StateSync`.
+     *
+     * The DUAs are proxied once this device is the Primary Backbone Router, until their Thread devices register them
+     * here. The DUAs which are not registered again within five minutes are removed.
+     *
+     * @param[in] aDuas  The DUAs to proxy.
+     *
+     */
+    void RestoreDuas(const std::set<Ip6Address> &aDuas);
+
 private:
+
     void        OnBecomePrimary(void);
     void        OnResignPrimary(void);
     bool        IsPrimary(void) const { return mBackboneRouterState == OT_BACKBONE_ROUTER_STATE_PRIMARY; }
-    static void HandleBackboneRouterState(void *aContext, int aEvent, va_list aArguments);
+    static void HandleBackboneRouterState(void *aContext);
     void        HandleBackboneRouterState(void);
-    static void HandleBackboneRouterDomainPrefixEvent(void *aContext, int aEvent, va_list aArguments);
+    static void HandleBackboneRouterDomainPrefixEvent(void *                            aContext,
+                                                      otBackboneRouterDomainPrefixEvent aEvent,
+                                                      const otIp6Prefix *               aDomainPrefix);
     void        HandleBackboneRouterDomainPrefixEvent(otBackboneRouterDomainPrefixEvent aEvent,
                                                       const otIp6Prefix *               aDomainPrefix);
-    static void HandleBackboneRouterNdProxyEvent(void *aContext, int aEvent, va_list aArguments);
+    static void HandleBackboneRouterNdProxyEvent(void *                       aContext,
+                                                 otBackboneRouterNdProxyEvent aEvent,
+                                                 const otIp6Address *         aAddress);
     void        HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aAddress);
+    static void HandleBackboneRouterMulticastListenerEvent(void *                                 aContext,
+                                                           otBackboneRouterMulticastListenerEvent aEvent,
+                                                           const otIp6Address *                   aAddress);
+    void        HandleBackboneRouterMulticastListenerEvent(otBackboneRouterMulticastListenerEvent aEvent,
+                                                           const otIp6Address *                   aAddress);
+
+    void ApplyRestoredDuas(void);
+    void ExpireRestoredDuas(void);
 
     static const char *StateToString(otBackboneRouterState aState);
 
     otbr::Ncp::ControllerOpenThread &mNcp;
     otBackboneRouterState            mBackboneRouterState;
     NdProxyManager                   mNdProxyManager;
+    MulticastRoutingManager          mMulticastRoutingManager;
     Ip6Prefix                        mDomainPrefix;
+    std::set<Ip6Address>             mRestoredDuas; // The restored DUAs not registered again since.
+    TimerWheel::Handle               mRestoredDuaTimer;
 };
 
 /**
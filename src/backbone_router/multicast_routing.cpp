@@ -0,0 +1,397 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements the Multicast Routing Manager of the Backbone Router.
+ */
+
+#include "backbone_router/multicast_routing.hpp"
+
+#include <errno.h>
+#include <net/if.h>
+#include <netinet/icmp6.h>
+#include <netinet/in.h>
+#include <netinet/ip6.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#if __linux__
+#include <linux/mroute6.h>
+#else
+#error "Platform not supported"
+#endif
+
+#include "agent/instance_params.hpp"
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/mainloop_poller.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+// Entries without traffic for kMfcExpireTimeout are removed, they are checked every kMfcExpireInterval.
+static constexpr std::chrono::seconds kMfcExpireTimeout(300);
+static constexpr std::chrono::seconds kMfcExpireInterval(60);
+
+static constexpr uint8_t kRealmLocalScope = 3;
+
+static uint8_t GetMulticastScope(const Ip6Address &aAddress)
+{
+    return aAddress.m8[1] & 0x0f;
+}
+
+MulticastRoutingManager::MulticastRoutingManager(otbr::Ncp::ControllerOpenThread &aNcp)
+    : mNcp(aNcp)
+    , mMulticastRouterSock(-1)
+{
+}
+
+void MulticastRoutingManager::Enable(void)
+{
+    otbrError           error = OTBR_ERROR_NONE;
+    int                 one   = 1;
+    struct icmp6_filter filter;
+
+    VerifyOrExit(!IsEnabled());
+
+    mMulticastRouterSock = socket(AF_INET6, SOCK_RAW | SOCK_CLOEXEC, IPPROTO_ICMPV6);
+    VerifyOrExit(mMulticastRouterSock >= 0, error = OTBR_ERROR_ERRNO);
+
+    // The kernel reports bypass the ICMPv6 filter, so no ICMPv6 message needs to wake the agent.
+    ICMP6_FILTER_SETBLOCKALL(&filter);
+    VerifyOrExit(setsockopt(mMulticastRouterSock, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    // Only one socket on the host can be the multicast router.
+    VerifyOrExit(setsockopt(mMulticastRouterSock, IPPROTO_IPV6, MRT6_INIT, &one, sizeof(one)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    SuccessOrExit(error = AddMulticastInterface(kMifIndexThread, InstanceParams::Get().GetThreadIfName()));
+    SuccessOrExit(error = AddMulticastInterface(kMifIndexBackbone, InstanceParams::Get().GetBackboneIfName()));
+
+    SuccessOrExit(error = MainloopPoller::Get().Register(mMulticastRouterSock, MainloopPoller::kEventRead));
+
+exit:
+    if (error != OTBR_ERROR_NONE && mMulticastRouterSock >= 0)
+    {
+        close(mMulticastRouterSock);
+        mMulticastRouterSock = -1;
+    }
+
+    otbrLogResult(error, "MulticastRoutingManager: %s", __FUNCTION__);
+}
+
+void MulticastRoutingManager::Disable(void)
+{
+    VerifyOrExit(IsEnabled());
+
+    // Closing the socket makes the kernel remove the multicast interfaces and the forwarding cache.
+    MainloopPoller::Get().Unregister(mMulticastRouterSock);
+    close(mMulticastRouterSock);
+    mMulticastRouterSock = -1;
+
+    mMulticastForwardingCacheTable.clear();
+    mExpiryTimer.Cancel();
+
+    otbrLog(OTBR_LOG_INFO, "MulticastRoutingManager: %s", __FUNCTION__);
+
+exit:
+    return;
+}
+
+void MulticastRoutingManager::HandleBackboneMulticastListenerEvent(otBackboneRouterMulticastListenerEvent aEvent,
+                                                                   const Ip6Address &                     aAddress)
+{
+    switch (aEvent)
+    {
+    case OT_BACKBONE_ROUTER_MULTICAST_LISTENER_ADDED:
+        VerifyOrExit(mListenerSet.insert(aAddress).second);
+        break;
+    case OT_BACKBONE_ROUTER_MULTICAST_LISTENER_REMOVED:
+        VerifyOrExit(mListenerSet.erase(aAddress) > 0);
+        break;
+    }
+
+    otbrLog(OTBR_LOG_INFO, "MulticastRoutingManager: %s listener %s, %zu in total",
+            aEvent == OT_BACKBONE_ROUTER_MULTICAST_LISTENER_ADDED ? "Add" : "Remove", aAddress.ToString().c_str(),
+            mListenerSet.size());
+
+    UpdateGroupForwarding(aAddress);
+
+exit:
+    return;
+}
+
+void MulticastRoutingManager::Process(void)
+{
+    VerifyOrExit(IsEnabled());
+
+    if (MainloopPoller::Get().IsReadable(mMulticastRouterSock))
+    {
+        ProcessMulticastRouterMessage();
+    }
+
+exit:
+    return;
+}
+
+otbrError MulticastRoutingManager::AddMulticastInterface(MifIndex aMif, const char *aIfName)
+{
+    otbrError      error = OTBR_ERROR_NONE;
+    struct mif6ctl mif6ctl;
+
+    memset(&mif6ctl, 0, sizeof(mif6ctl));
+    mif6ctl.mif6c_mifi = aMif;
+    mif6ctl.mif6c_pifi = static_cast<uint16_t>(if_nametoindex(aIfName));
+
+    VerifyOrExit(mif6ctl.mif6c_pifi > 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(setsockopt(mMulticastRouterSock, IPPROTO_IPV6, MRT6_ADD_MIF, &mif6ctl, sizeof(mif6ctl)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+exit:
+    otbrLogResult(error, "MulticastRoutingManager: add MIF %u for %s", aMif, aIfName);
+    return error;
+}
+
+void MulticastRoutingManager::ProcessMulticastRouterMessage(void)
+{
+    otbrError      error = OTBR_ERROR_NONE;
+    uint8_t        buffer[sizeof(struct mrt6msg) + sizeof(struct ip6_hdr) + 256];
+    struct mrt6msg msg;
+    ssize_t        len;
+
+    len = recv(mMulticastRouterSock, buffer, sizeof(buffer), MSG_DONTWAIT);
+    VerifyOrExit(len >= 0, error = errno == EAGAIN ? OTBR_ERROR_NONE : OTBR_ERROR_ERRNO);
+    VerifyOrExit(static_cast<size_t>(len) >= sizeof(msg));
+    memcpy(&msg, buffer, sizeof(msg));
+
+    // Kernel messages start with a zero byte, unlike ICMPv6 messages received on the same socket.
+    VerifyOrExit(msg.im6_mbz == 0 && msg.im6_msgtype == MRT6MSG_NOCACHE);
+
+    AddMulticastForwardingCache(Ip6Address(msg.im6_src.s6_addr), Ip6Address(msg.im6_dst.s6_addr),
+                                static_cast<MifIndex>(msg.im6_mif));
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "MulticastRoutingManager: failed to read a kernel message: %s", strerror(errno));
+    }
+}
+
+void MulticastRoutingManager::AddMulticastForwardingCache(const Ip6Address &aSource,
+                                                          const Ip6Address &aGroup,
+                                                          MifIndex          aIif)
+{
+    MifIndex oif = kMifIndexNone;
+
+    if (aIif == kMifIndexThread)
+    {
+        if (GetMulticastScope(aGroup) > kRealmLocalScope)
+        {
+            oif = kMifIndexBackbone;
+        }
+    }
+    else if (aIif == kMifIndexBackbone)
+    {
+        if (mListenerSet.count(aGroup) > 0)
+        {
+            oif = kMifIndexThread;
+        }
+    }
+    else
+    {
+        ExitNow();
+    }
+
+    // A blocking entry is installed as well, so the kernel stops reporting the pair.
+    SuccessOrExit(SetMulticastForwardingCache(MfcKey(aSource, aGroup), aIif, oif));
+    ScheduleExpiry();
+
+exit:
+    return;
+}
+
+otbrError MulticastRoutingManager::SetMulticastForwardingCache(const MfcKey &aKey, MifIndex aIif, MifIndex aOif)
+{
+    otbrError      error = OTBR_ERROR_NONE;
+    struct mf6cctl mf6cctl;
+
+    memset(&mf6cctl, 0, sizeof(mf6cctl));
+    mf6cctl.mf6cc_origin.sin6_family   = AF_INET6;
+    mf6cctl.mf6cc_mcastgrp.sin6_family = AF_INET6;
+    aKey.first.CopyTo(mf6cctl.mf6cc_origin.sin6_addr);
+    aKey.second.CopyTo(mf6cctl.mf6cc_mcastgrp.sin6_addr);
+    mf6cctl.mf6cc_parent = aIif;
+
+    if (aOif != kMifIndexNone)
+    {
+        IF_SET(aOif, &mf6cctl.mf6cc_ifset);
+    }
+
+    // Adding an existing entry replaces its outgoing interfaces.
+    VerifyOrExit(setsockopt(mMulticastRouterSock, IPPROTO_IPV6, MRT6_ADD_MFC, &mf6cctl, sizeof(mf6cctl)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+    {
+        MulticastForwardingCache &entry = mMulticastForwardingCacheTable[aKey];
+
+        entry.mIif         = aIif;
+        entry.mOif         = aOif;
+        entry.mLastUseTime = Clock::now();
+        entry.mPacketCount = 0;
+    }
+
+exit:
+    otbrLogResult(error, "MulticastRoutingManager: set MFC %s -> %s: MIF %u -> %d", aKey.first.ToString().c_str(),
+                  aKey.second.ToString().c_str(), aIif, aOif == kMifIndexNone ? -1 : static_cast<int>(aOif));
+    return error;
+}
+
+void MulticastRoutingManager::RemoveMulticastForwardingCache(const MfcKey &aKey) const
+{
+    otbrError      error = OTBR_ERROR_NONE;
+    struct mf6cctl mf6cctl;
+
+    memset(&mf6cctl, 0, sizeof(mf6cctl));
+    mf6cctl.mf6cc_origin.sin6_family   = AF_INET6;
+    mf6cctl.mf6cc_mcastgrp.sin6_family = AF_INET6;
+    aKey.first.CopyTo(mf6cctl.mf6cc_origin.sin6_addr);
+    aKey.second.CopyTo(mf6cctl.mf6cc_mcastgrp.sin6_addr);
+
+    VerifyOrExit(setsockopt(mMulticastRouterSock, IPPROTO_IPV6, MRT6_DEL_MFC, &mf6cctl, sizeof(mf6cctl)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+exit:
+    otbrLogResult(error, "MulticastRoutingManager: remove MFC %s -> %s", aKey.first.ToString().c_str(),
+                  aKey.second.ToString().c_str());
+}
+
+void MulticastRoutingManager::UpdateGroupForwarding(const Ip6Address &aGroup)
+{
+    MifIndex oif = mListenerSet.count(aGroup) > 0 ? kMifIndexThread : kMifIndexNone;
+
+    VerifyOrExit(IsEnabled());
+
+    // Only the entries of traffic from the backbone depend on the listeners. They are switched in place, so the
+    // group needs no new kernel report.
+    for (auto it = mMulticastForwardingCacheTable.lower_bound(MfcKey(Ip6Address(), aGroup));
+         it != mMulticastForwardingCacheTable.end();)
+    {
+        auto next = std::next(it);
+
+        if (it->first.second == aGroup && it->second.mIif == kMifIndexBackbone && it->second.mOif != oif)
+        {
+            SetMulticastForwardingCache(it->first, kMifIndexBackbone, oif);
+        }
+
+        it = next;
+    }
+
+exit:
+    return;
+}
+
+void MulticastRoutingManager::ScheduleExpiry(void)
+{
+    VerifyOrExit(!mExpiryTimer.IsPending());
+    mExpiryTimer =
+        mNcp.PostTimerTask(Clock::now() + kMfcExpireInterval, [this]() { ExpireMulticastForwardingCache(); });
+
+exit:
+    return;
+}
+
+void MulticastRoutingManager::ExpireMulticastForwardingCache(void)
+{
+    Clock::time_point now     = Clock::now();
+    size_t            expired = 0;
+
+    VerifyOrExit(IsEnabled());
+
+    for (auto it = mMulticastForwardingCacheTable.begin(); it != mMulticastForwardingCacheTable.end();)
+    {
+        MulticastForwardingCache &entry = it->second;
+        unsigned long             packetCount;
+
+        // An entry is used as long as its kernel packet counter moves.
+        if (GetPacketCount(it->first, packetCount) && packetCount != entry.mPacketCount)
+        {
+            entry.mPacketCount = packetCount;
+            entry.mLastUseTime = now;
+        }
+
+        if (now - entry.mLastUseTime >= kMfcExpireTimeout)
+        {
+            RemoveMulticastForwardingCache(it->first);
+            it = mMulticastForwardingCacheTable.erase(it);
+            expired++;
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    otbrLog(OTBR_LOG_DEBUG, "MulticastRoutingManager: expired %zu MFC entries, %zu left", expired,
+            mMulticastForwardingCacheTable.size());
+
+    if (!mMulticastForwardingCacheTable.empty())
+    {
+        ScheduleExpiry();
+    }
+
+exit:
+    return;
+}
+
+bool MulticastRoutingManager::GetPacketCount(const MfcKey &aKey, unsigned long &aPacketCount) const
+{
+    struct sioc_sg_req6 request;
+    bool                found;
+
+    memset(&request, 0, sizeof(request));
+    request.src.sin6_family = AF_INET6;
+    request.grp.sin6_family = AF_INET6;
+    aKey.first.CopyTo(request.src.sin6_addr);
+    aKey.second.CopyTo(request.grp.sin6_addr);
+
+    found = ioctl(mMulticastRouterSock, SIOCGETSGCNT_IN6, &request) == 0;
+
+    if (found)
+    {
+        aPacketCount = request.pktcnt;
+    }
+
+    return found;
+}
+
+} // namespace BackboneRouter
+} // namespace otbr
@@ -0,0 +1,159 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the Multicast Routing Manager of the Backbone Router.
+ */
+
+#ifndef BACKBONE_ROUTER_MULTICAST_ROUTING_HPP_
+#define BACKBONE_ROUTER_MULTICAST_ROUTING_HPP_
+
+#include <chrono>
+#include <map>
+#include <unordered_set>
+#include <utility>
+
+#include <openthread/backbone_router_ftd.h>
+
+#include "agent/ncp_openthread.hpp"
+#include "common/timer_wheel.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+namespace BackboneRouter {
+
+/**
+ * @addtogroup border-router-bbr
+ *
+ * @brief
+ *   This module includes definition for the Multicast Routing Manager.
+ *
+ * @{
+ */
+
+/**
+ * This class implements the Multicast Routing Manager.
+ *
+ * It installs kernel multicast forwarding cache (MFC) entries between the Thread and the backbone interfaces, so
+ * that multicast forwarding stays in the kernel. An entry is installed when the kernel reports the first packet of
+ * a (source, group) pair without an entry. Packets from the Thread network are forwarded to the backbone when their
+ * scope is larger than realm-local. Packets from the backbone are forwarded to the Thread network when the group has
+ * a Multicast Listener Registration (MLR). Entries without traffic expire lazily.
+ *
+ */
+class MulticastRoutingManager
+{
+public:
+    /**
+     * This constructor initializes a Multicast Routing Manager instance.
+     *
+     * @param[in] aNcp  The Thread instance.
+     *
+     */
+    explicit MulticastRoutingManager(otbr::Ncp::ControllerOpenThread &aNcp);
+
+    /**
+     * This method enables multicast routing.
+     *
+     */
+    void Enable(void);
+
+    /**
+     * This method disables multicast routing and removes all the forwarding cache entries.
+     *
+     */
+    void Disable(void);
+
+    /**
+     * This method returns whether multicast routing is enabled.
+     *
+     */
+    bool IsEnabled(void) const { return mMulticastRouterSock >= 0; }
+
+    /**
+     * This method handles a Backbone Router Multicast Listener event.
+     *
+     * @param[in] aEvent    The Multicast Listener event.
+     * @param[in] aAddress  The multicast address of the listener.
+     *
+     */
+    void HandleBackboneMulticastListenerEvent(otBackboneRouterMulticastListenerEvent aEvent,
+                                              const Ip6Address &                     aAddress);
+
+    /**
+     * This method processes the kernel multicast routing messages.
+     *
+     */
+    void Process(void);
+
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    enum MifIndex : uint16_t
+    {
+        kMifIndexThread   = 0,
+        kMifIndexBackbone = 1,
+        kMifIndexNone     = 0xffff,
+    };
+
+    struct MulticastForwardingCache
+    {
+        MifIndex          mIif;
+        MifIndex          mOif;
+        Clock::time_point mLastUseTime;
+        unsigned long     mPacketCount;
+    };
+
+    typedef std::pair<Ip6Address, Ip6Address> MfcKey; ///< The (source, group) pair.
+
+    otbrError AddMulticastInterface(MifIndex aMif, const char *aIfName);
+    void      ProcessMulticastRouterMessage(void);
+    void      AddMulticastForwardingCache(const Ip6Address &aSource, const Ip6Address &aGroup, MifIndex aIif);
+    otbrError SetMulticastForwardingCache(const MfcKey &aKey, MifIndex aIif, MifIndex aOif);
+    void      RemoveMulticastForwardingCache(const MfcKey &aKey) const;
+    void      UpdateGroupForwarding(const Ip6Address &aGroup);
+    void      ScheduleExpiry(void);
+    void      ExpireMulticastForwardingCache(void);
+    bool      GetPacketCount(const MfcKey &aKey, unsigned long &aPacketCount) const;
+
+    otbr::Ncp::ControllerOpenThread &          mNcp;
+    int                                        mMulticastRouterSock;
+    std::unordered_set<Ip6Address>             mListenerSet;
+    std::map<MfcKey, MulticastForwardingCache> mMulticastForwardingCacheTable;
+    TimerWheel::Handle                         mExpiryTimer;
+};
+
+/**
+ * @}
+ */
+
+} // namespace BackboneRouter
+} // namespace otbr
+
+#endif // BACKBONE_ROUTER_MULTICAST_ROUTING_HPP_
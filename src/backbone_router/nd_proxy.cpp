@@ -36,14 +36,26 @@
 #include <openthread/backbone_router_ftd.h>
 
 #include <assert.h>
+#include <endian.h>
 #include <net/if.h>
 #include <netinet/icmp6.h>
 #include <netinet/ip6.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <sys/eventfd.h>
 #include <sys/ioctl.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <chrono>
+#include <vector>
+
 #if __linux__
+#include <linux/filter.h>
 #include <linux/netfilter.h>
+#include <linux/netfilter_ipv6.h>
 #else
 #error "Platform not supported"
 #endif
@@ -52,12 +64,28 @@
 #include "backbone_router/constants.hpp"
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_poller.hpp"
+#include "common/memory_stats.hpp"
+#include "common/metrics.hpp"
+#include "common/trace.hpp"
 #include "common/types.hpp"
-#include "utils/system_utils.hpp"
+#include "common/usdt.hpp"
+#include "utils/nftables.hpp"
 
 namespace otbr {
 namespace BackboneRouter {
 
+static const char kNftTableName[] = "otbr_nd_proxy";
+static const char kNftChainName[] = "prerouting";
+
+static void RecordProcessDuration(std::chrono::steady_clock::time_point aStartTime)
+{
+    auto duration =
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - aStartTime);
+
+    Metrics::Get().Record(Metrics::kHistogramNdProxyProcess, static_cast<uint64_t>(duration.count()));
+}
+
 void NdProxyManager::Enable(const Ip6Prefix &aDomainPrefix)
 {
     otbrError error = OTBR_ERROR_NONE;
@@ -71,12 +99,35 @@ void NdProxyManager::Enable(const Ip6Prefix &aDomainPrefix)
     SuccessOrExit(error = UpdateMacAddress());
     SuccessOrExit(error = InitNetfilterQueue());
 
-    // Add ip6tables rule for unicast ICMPv6 messages
-    VerifyOrExit(SystemUtils::ExecuteCommand(
-                     "ip6tables -t raw -A PREROUTING -6 -d %s -p icmpv6 --icmpv6-type neighbor-solicitation -i %s -j "
-                     "NFQUEUE --queue-num 88",
-                     mDomainPrefix.ToString().c_str(), InstanceParams::Get().GetBackboneIfName()) == 0,
-                 error = OTBR_ERROR_ERRNO);
+    // Queue unicast NS to the domain prefix. The table is added, flushed and filled in one atomic batch.
+    {
+        NftablesBatch batch;
+
+        batch.AddTable(kNftTableName);
+        batch.DeleteTable(kNftTableName);
+        batch.AddTable(kNftTableName);
+        batch.AddChain(kNftTableName, kNftChainName, NF_INET_PRE_ROUTING, NF_IP6_PRI_RAW);
+        batch.BeginRule(kNftTableName, kNftChainName);
+        batch.MatchInputInterface(InstanceParams::Get().GetBackboneIfName());
+        batch.MatchDestinationPrefix(mDomainPrefix);
+        batch.MatchIcmp6Type(ND_NEIGHBOR_SOLICIT);
+        batch.Queue(kUnicastNsQueueNum, /* aBypass */ true);
+        batch.EndRule();
+
+        SuccessOrExit(error = batch.Commit());
+    }
+
+    PublishDuaSnapshot();
+
+    if (InstanceParams::Get().GetBackboneThreadCpu() != InstanceParams::kBackboneThreadNone)
+    {
+        SuccessOrExit(error = StartBackboneThread());
+    }
+    else
+    {
+        SuccessOrExit(error = MainloopPoller::Get().Register(mIcmp6RawSock, MainloopPoller::kEventRead));
+        SuccessOrExit(error = MainloopPoller::Get().Register(mUnicastNsQueueSock, MainloopPoller::kEventRead));
+    }
 
 exit:
     if (error != OTBR_ERROR_NONE)
@@ -94,15 +145,17 @@ void NdProxyManager::Disable(void)
 
     VerifyOrExit(IsEnabled());
 
+    StopBackboneThread();
     FiniNetfilterQueue();
     FiniIcmp6RawSocket();
 
-    // Remove ip6tables rule for unicast ICMPv6 messages
-    VerifyOrExit(SystemUtils::ExecuteCommand(
-                     "ip6tables -t raw -D PREROUTING -6 -d %s -p icmpv6 --icmpv6-type neighbor-solicitation -i %s -j "
-                     "NFQUEUE --queue-num 88",
-                     mDomainPrefix.ToString().c_str(), InstanceParams::Get().GetBackboneIfName()) == 0,
-                 error = OTBR_ERROR_ERRNO);
+    // Remove the rule queueing unicast NS
+    {
+        NftablesBatch batch;
+
+        batch.DeleteTable(kNftTableName);
+        SuccessOrExit(error = batch.Commit());
+    }
 
 exit:
     otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
@@ -112,6 +165,13 @@ void NdProxyManager::Init(void)
 {
     mBackboneIfIndex = if_nametoindex(InstanceParams::Get().GetBackboneIfName());
     VerifyOrDie(mBackboneIfIndex > 0, "if_nametoindex failed");
+
+    // The batch buffers are large, so they are allocated once instead of living on the stack.
+    mNsBatch.reset(new NsBatch());
+    mNaBatch.reset(new NaBatch());
+    mNaBatch->mCount = 0;
+    mUnsolicitedNaBatch.reset(new NaBatch());
+    mUnsolicitedNaBatch->mCount = 0;
 }
 
 void NdProxyManager::UpdateFdSet(fd_set & aReadFdSet,
@@ -120,134 +180,283 @@ void NdProxyManager::UpdateFdSet(fd_set & aReadFdSet,
                                  int &    aMaxFd,
                                  timeval &aTimeout) const
 {
+    // The sockets are registered with `MainloopPoller` when they are opened.
+    OTBR_UNUSED_VARIABLE(aReadFdSet);
     OTBR_UNUSED_VARIABLE(aWriteFdSet);
     OTBR_UNUSED_VARIABLE(aErrorFdSet);
+    OTBR_UNUSED_VARIABLE(aMaxFd);
     OTBR_UNUSED_VARIABLE(aTimeout);
-
-    if (mIcmp6RawSock >= 0)
-    {
-        FD_SET(mIcmp6RawSock, &aReadFdSet);
-        aMaxFd = std::max(aMaxFd, mIcmp6RawSock);
-    }
-
-    if (mUnicastNsQueueSock >= 0)
-    {
-        FD_SET(mUnicastNsQueueSock, &aReadFdSet);
-        aMaxFd = std::max(aMaxFd, mUnicastNsQueueSock);
-    }
 }
 
 void NdProxyManager::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
 {
+    MemoryStats::Scope memoryScope(MemoryStats::kSubsystemNdProxy);
+
+    OTBR_UNUSED_VARIABLE(aReadFdSet);
     OTBR_UNUSED_VARIABLE(aWriteFdSet);
     OTBR_UNUSED_VARIABLE(aErrorFdSet);
 
-    VerifyOrExit(IsEnabled());
+    VerifyOrExit(IsEnabled() && !IsBackboneThreadRunning());
+
+    ProcessNeighborSolicitations(MainloopPoller::Get().IsReadable(mIcmp6RawSock),
+                                 MainloopPoller::Get().IsReadable(mUnicastNsQueueSock));
+exit:
+    return;
+}
+
+void NdProxyManager::ProcessNeighborSolicitations(bool aMulticast, bool aUnicast)
+{
+    // The snapshot is loaded once, the DUA events handled meanwhile are seen by the next batch.
+    mProcessingDuas = std::atomic_load(&mDuaSnapshot);
 
-    if (FD_ISSET(mIcmp6RawSock, &aReadFdSet))
+    if (aMulticast)
     {
+        auto start = std::chrono::steady_clock::now();
+
         ProcessMulticastNeighborSolicition();
+        RecordProcessDuration(start);
     }
 
-    if (FD_ISSET(mUnicastNsQueueSock, &aReadFdSet))
+    if (aUnicast)
     {
+        auto start = std::chrono::steady_clock::now();
+
         ProcessUnicastNeighborSolicition();
+        RecordProcessDuration(start);
     }
+
+    mProcessingDuas.reset();
+}
+
+otbrError NdProxyManager::StartBackboneThread(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    int       cpu   = InstanceParams::Get().GetBackboneThreadCpu();
+    sigset_t  allSignals;
+    sigset_t  oldSignals;
+
+    mBackboneThreadStopFd = eventfd(0, EFD_CLOEXEC);
+    VerifyOrExit(mBackboneThreadStopFd >= 0, error = OTBR_ERROR_ERRNO);
+
+    // Signals are left to the mainloop thread, whose poll they interrupt.
+    sigfillset(&allSignals);
+    pthread_sigmask(SIG_SETMASK, &allSignals, &oldSignals);
+    mBackboneThread = std::thread(&NdProxyManager::RunBackboneThread, this);
+    pthread_sigmask(SIG_SETMASK, &oldSignals, nullptr);
+
+    pthread_setname_np(mBackboneThread.native_handle(), "otbr-backbone");
+
+    if (cpu != InstanceParams::kBackboneThreadAnyCpu)
+    {
+        cpu_set_t cpus;
+        int       ret = EINVAL;
+
+        CPU_ZERO(&cpus);
+
+        if (cpu < CPU_SETSIZE)
+        {
+            CPU_SET(cpu, &cpus);
+            ret = pthread_setaffinity_np(mBackboneThread.native_handle(), sizeof(cpus), &cpus);
+        }
+
+        // Not fatal, the thread then runs on any CPU.
+        if (ret != 0)
+        {
+            otbrLog(OTBR_LOG_WARNING, "NdProxyManager: failed to pin the backbone thread to CPU %d: %s", cpu,
+                    strerror(ret));
+        }
+    }
+
 exit:
-    return;
+    otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
+    return error;
+}
+
+void NdProxyManager::StopBackboneThread(void)
+{
+    uint64_t stop = 1;
+
+    if (IsBackboneThreadRunning())
+    {
+        VerifyOrDie(write(mBackboneThreadStopFd, &stop, sizeof(stop)) == sizeof(stop), strerror(errno));
+        mBackboneThread.join();
+    }
+
+    if (mBackboneThreadStopFd >= 0)
+    {
+        close(mBackboneThreadStopFd);
+        mBackboneThreadStopFd = -1;
+    }
+}
+
+void NdProxyManager::RunBackboneThread(void)
+{
+    MemoryStats::Scope memoryScope(MemoryStats::kSubsystemNdProxy);
+
+    struct pollfd fds[3];
+
+    memset(fds, 0, sizeof(fds));
+    fds[0].fd     = mIcmp6RawSock;
+    fds[0].events = POLLIN;
+    fds[1].fd     = mUnicastNsQueueSock;
+    fds[1].events = POLLIN;
+    fds[2].fd     = mBackboneThreadStopFd;
+    fds[2].events = POLLIN;
+
+    otbrLog(OTBR_LOG_INFO, "NdProxyManager: backbone thread started");
+
+    while (true)
+    {
+        if (poll(fds, 3, -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            otbrLog(OTBR_LOG_ERR, "NdProxyManager: backbone thread poll failed: %s", strerror(errno));
+            break;
+        }
+
+        if (fds[2].revents != 0)
+        {
+            break;
+        }
+
+        ProcessNeighborSolicitations(fds[0].revents & POLLIN, fds[1].revents & POLLIN);
+    }
+
+    otbrLog(OTBR_LOG_INFO, "NdProxyManager: backbone thread stopped");
 }
 
 void NdProxyManager::ProcessMulticastNeighborSolicition()
 {
-    struct msghdr     msghdr;
-    sockaddr_in6      sin6;
-    struct iovec      iovec;
-    ssize_t           len;
-    struct icmp6_hdr *icmp6header;
-    struct cmsghdr *  cmsghdr;
-    unsigned char     cbuf[2 * CMSG_SPACE(sizeof(struct in6_pktinfo))];
-    uint8_t           packet[kMaxICMP6PacketSize];
-    otbrError         error = OTBR_ERROR_NONE;
-    bool              found = false;
+    otbrError error = OTBR_ERROR_NONE;
+    NsBatch & batch = *mNsBatch;
+    int       count = kMaxBatchSize;
+
+    // Drain a bounded number of batches, so that an NS flood cannot starve the mainloop.
+    for (int round = 0; round < kMaxBatchesPerEvent && count == kMaxBatchSize; ++round)
+    {
+        for (int i = 0; i < kMaxBatchSize; ++i)
+        {
+            struct msghdr &msghdr = batch.mMessages[i].msg_hdr;
+
+            batch.mIovecs[i].iov_base = batch.mPackets[i];
+            batch.mIovecs[i].iov_len  = sizeof(batch.mPackets[i]);
+
+            msghdr.msg_name       = &batch.mSources[i];
+            msghdr.msg_namelen    = sizeof(batch.mSources[i]);
+            msghdr.msg_iov        = &batch.mIovecs[i];
+            msghdr.msg_iovlen     = 1;
+            msghdr.msg_control    = batch.mControls[i];
+            msghdr.msg_controllen = sizeof(batch.mControls[i]);
+            msghdr.msg_flags      = 0;
+        }
 
-    iovec.iov_len  = kMaxICMP6PacketSize;
-    iovec.iov_base = packet;
+        count = recvmmsg(mIcmp6RawSock, batch.mMessages, kMaxBatchSize, MSG_DONTWAIT, nullptr);
 
-    msghdr.msg_name       = &sin6;
-    msghdr.msg_namelen    = sizeof(sin6);
-    msghdr.msg_iov        = &iovec;
-    msghdr.msg_iovlen     = 1;
-    msghdr.msg_control    = cbuf;
-    msghdr.msg_controllen = sizeof(cbuf);
+        if (count < 0)
+        {
+            VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK, error = OTBR_ERROR_ERRNO);
+            break;
+        }
 
-    len = recvmsg(mIcmp6RawSock, &msghdr, 0);
+        for (int i = 0; i < count; ++i)
+        {
+            HandleMulticastNeighborSolicit(batch.mPackets[i], batch.mMessages[i].msg_len, batch.mSources[i],
+                                           batch.mMessages[i].msg_hdr);
+        }
 
-    VerifyOrExit(len >= static_cast<ssize_t>(sizeof(struct icmp6_hdr)), error = OTBR_ERROR_ERRNO);
+        // Answer the whole batch with a single system call.
+        FlushNeighborAdvertisements(*mNaBatch);
+    }
 
+exit:
+    if (error != OTBR_ERROR_NONE)
     {
-        Ip6Address &src = *reinterpret_cast<Ip6Address *>(&sin6.sin6_addr);
+        Metrics::Get().Increment(Metrics::kCounterNdProxyErrors);
+    }
 
-        icmp6header = reinterpret_cast<icmp6_hdr *>(packet);
+    otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
+}
+
+void NdProxyManager::HandleMulticastNeighborSolicit(const uint8_t *      aPacket,
+                                                    size_t               aLength,
+                                                    const sockaddr_in6 & aSource,
+                                                    const struct msghdr &aMsgHdr)
+{
+    const Ip6Address &                src    = *reinterpret_cast<const Ip6Address *>(&aSource.sin6_addr);
+    const struct icmp6_hdr *          icmp6header;
+    const struct nd_neighbor_solicit *ns;
+    struct cmsghdr *                  cmsghdr;
+    otbrError                         error = OTBR_ERROR_NONE;
+    bool                              found = false;
 
-        // only process neighbor solicit
-        VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT, error = OTBR_ERROR_PARSE);
+    VerifyOrExit(aLength >= sizeof(struct icmp6_hdr), error = OTBR_ERROR_PARSE);
 
-        otbrLog(OTBR_LOG_DEBUG, "NdProxyManager: Received ND-NS from %s", src.ToString().c_str());
+    icmp6header = reinterpret_cast<const icmp6_hdr *>(aPacket);
 
-        for (cmsghdr = CMSG_FIRSTHDR(&msghdr); cmsghdr; cmsghdr = CMSG_NXTHDR(&msghdr, cmsghdr))
+    // only process neighbor solicit
+    VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT, error = OTBR_ERROR_PARSE);
+    Metrics::Get().Increment(Metrics::kCounterNdProxyNsMulticast);
+
+    otbrLog(OTBR_LOG_DEBUG, "NdProxyManager: Received ND-NS from %s", src.ToString().c_str());
+
+    VerifyOrExit(aLength >= sizeof(*ns), error = OTBR_ERROR_PARSE);
+    ns = reinterpret_cast<const struct nd_neighbor_solicit *>(aPacket);
+
+    for (cmsghdr = CMSG_FIRSTHDR(&aMsgHdr); cmsghdr;
+         cmsghdr = CMSG_NXTHDR(const_cast<struct msghdr *>(&aMsgHdr), cmsghdr))
+    {
+        if (cmsghdr->cmsg_level != IPPROTO_IPV6)
         {
-            if (cmsghdr->cmsg_level != IPPROTO_IPV6)
+            continue;
+        }
+
+        switch (cmsghdr->cmsg_type)
+        {
+        case IPV6_PKTINFO:
+            if (cmsghdr->cmsg_len == CMSG_LEN(sizeof(struct in6_pktinfo)))
             {
-                continue;
+                struct in6_pktinfo *pktinfo = (struct in6_pktinfo *)CMSG_DATA(cmsghdr);
+                Ip6Address &        dst     = *reinterpret_cast<Ip6Address *>(&pktinfo->ipi6_addr);
+                uint32_t            ifindex = pktinfo->ipi6_ifindex;
+                const Ip6Address &  target  = *reinterpret_cast<const Ip6Address *>(&ns->nd_ns_target);
+
+                // The NS is sent to the solicited-node address of its target, so only the target is looked up.
+                found = mProcessingDuas->mTargets.Contains(target) && dst.IsSolicitedNodeMulticastAddressOf(target);
+
+                otbrLog(OTBR_LOG_DEBUG, "NdProxyManager: dst=%s, ifindex=%d, proxying=%s", dst.ToString().c_str(),
+                        ifindex, found ? "Y" : "N");
             }
+            break;
 
-            switch (cmsghdr->cmsg_type)
+        case IPV6_HOPLIMIT:
+            if (cmsghdr->cmsg_len == CMSG_LEN(sizeof(int)))
             {
-            case IPV6_PKTINFO:
-                if (cmsghdr->cmsg_len == CMSG_LEN(sizeof(struct in6_pktinfo)))
-                {
-                    struct in6_pktinfo *pktinfo = (struct in6_pktinfo *)CMSG_DATA(cmsghdr);
-                    Ip6Address &        dst     = *reinterpret_cast<Ip6Address *>(&pktinfo->ipi6_addr);
-                    uint32_t            ifindex = pktinfo->ipi6_ifindex;
-
-                    for (const Ip6Address &ipaddr : mNdProxySet)
-                    {
-                        if (ipaddr.ToSolicitedNodeMulticastAddress() == dst)
-                        {
-                            found = true;
-                            break;
-                        }
-                    }
-
-                    otbrLog(OTBR_LOG_DEBUG, "NdProxyManager: dst=%s, ifindex=%d, proxying=%s", dst.ToString().c_str(),
-                            ifindex, found ? "Y" : "N");
-                }
-                break;
-
-            case IPV6_HOPLIMIT:
-                if (cmsghdr->cmsg_len == CMSG_LEN(sizeof(int)))
-                {
-                    int hops = *(int *)CMSG_DATA(cmsghdr);
-
-                    otbrLog(OTBR_LOG_DEBUG, "NdProxyManager: hops=%d (%s)", hops, hops == 255 ? "Good" : "Bad");
-
-                    VerifyOrExit(hops == 255);
-                }
-                break;
+                int hops = *(int *)CMSG_DATA(cmsghdr);
+
+                otbrLog(OTBR_LOG_DEBUG, "NdProxyManager: hops=%d (%s)", hops, hops == 255 ? "Good" : "Bad");
+
+                VerifyOrExit(hops == 255);
             }
+            break;
         }
+    }
 
-        VerifyOrExit(found, error = OTBR_ERROR_NOT_FOUND);
+    VerifyOrExit(found, error = OTBR_ERROR_NOT_FOUND);
+    Metrics::Get().Increment(Metrics::kCounterNdProxyNsMatched);
 
-        {
-            struct nd_neighbor_solicit *ns     = reinterpret_cast<struct nd_neighbor_solicit *>(packet);
-            Ip6Address &                target = *reinterpret_cast<Ip6Address *>(&ns->nd_ns_target);
+    {
+        const Ip6Address &target = *reinterpret_cast<const Ip6Address *>(&ns->nd_ns_target);
 
-            otbrLog(OTBR_LOG_INFO, "NdProxyManager: send solicited NA for multicast NS: src=%s, target=%s",
-                    src.ToString().c_str(), target.ToString().c_str());
+        Trace::Get().Log(Trace::kEventNdProxyNs, be64toh(target.m64[1]), true);
+        OTBR_USDT2(nd_proxy_ns_in, target.m8, true);
+        otbrLog(OTBR_LOG_INFO, "NdProxyManager: send solicited NA for multicast NS: src=%s, target=%s",
+                src.ToString().c_str(), target.ToString().c_str());
 
-            SendNeighborAdvertisement(target, src);
-        }
+        QueueSolicitedNeighborAdvertisement(target, src);
     }
 
 exit:
@@ -257,20 +466,38 @@ exit:
 void NdProxyManager::ProcessUnicastNeighborSolicition(void)
 {
     otbrError error = OTBR_ERROR_NONE;
-    char      packet[kMaxICMP6PacketSize];
+    char      packet[kNfqBufferSize];
     ssize_t   len;
 
-    VerifyOrExit((len = recv(mUnicastNsQueueSock, packet, sizeof(packet), 0)) >= 0, error = OTBR_ERROR_ERRNO);
-    VerifyOrExit(nfq_handle_packet(mNfqHandler, packet, len) == 0, error = OTBR_ERROR_ERRNO);
+    // A single recv() may return several queued packets, and the queue is drained for a bounded number of reads.
+    for (int round = 0; round < kMaxBatchesPerEvent; ++round)
+    {
+        len = recv(mUnicastNsQueueSock, packet, sizeof(packet), MSG_DONTWAIT);
+
+        if (len < 0)
+        {
+            VerifyOrExit(errno == EAGAIN || errno == EWOULDBLOCK, error = OTBR_ERROR_ERRNO);
+            break;
+        }
 
-    error = OTBR_ERROR_NONE;
+        VerifyOrExit(nfq_handle_packet(mNfqHandler, packet, len) == 0, error = OTBR_ERROR_ERRNO);
+    }
 
 exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        Metrics::Get().Increment(Metrics::kCounterNdProxyErrors);
+    }
+
+    FlushVerdicts();
+    FlushNeighborAdvertisements(*mNaBatch);
     otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
 }
 
 void NdProxyManager::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEvent aEvent, const otIp6Address *aDua)
 {
+    MemoryStats::Scope memoryScope(MemoryStats::kSubsystemNdProxy);
+
     Ip6Address target;
 
     if (aEvent != OT_BACKBONE_ROUTER_NDPROXY_CLEARED)
@@ -284,73 +511,166 @@ void NdProxyManager::HandleBackboneRouterNdProxyEvent(otBackboneRouterNdProxyEve
     case OT_BACKBONE_ROUTER_NDPROXY_ADDED:
     case OT_BACKBONE_ROUTER_NDPROXY_RENEWED:
     {
-        bool isNewInsert = mNdProxySet.insert(target).second;
+        bool isNewInsert = mNdProxySet.Insert(target);
 
         if (isNewInsert)
         {
-            JoinSolicitedNodeMulticastGroup(target);
+            AddSolicitedNodeGroupMember(target);
+            mNsFilterDirty = true;
         }
 
+        mRegistrationTimes[target] = Clock::now();
+        mDuaSnapshotDirty          = true;
+        ScheduleMembershipUpdate();
+
         SendNeighborAdvertisement(target, Ip6Address::GetLinkLocalAllNodesMulticastAddress());
         break;
     }
     case OT_BACKBONE_ROUTER_NDPROXY_REMOVED:
-        mNdProxySet.erase(target);
-        LeaveSolicitedNodeMulticastGroup(target);
+        if (mNdProxySet.Erase(target))
+        {
+            RemoveSolicitedNodeGroupMember(target);
+            mRegistrationTimes.erase(target);
+            mNsFilterDirty    = true;
+            mDuaSnapshotDirty = true;
+            ScheduleMembershipUpdate();
+        }
         break;
     case OT_BACKBONE_ROUTER_NDPROXY_CLEARED:
-        for (const Ip6Address &proxingTarget : mNdProxySet)
+        for (const auto &group : mSolicitedNodeGroups)
         {
-            LeaveSolicitedNodeMulticastGroup(proxingTarget);
+            mDirtyGroups.insert(group.first);
         }
-        mNdProxySet.clear();
+        mSolicitedNodeGroups.clear();
+        mNdProxySet.Clear();
+        mRegistrationTimes.clear();
+        mNsFilterDirty    = true;
+        mDuaSnapshotDirty = true;
+        ScheduleMembershipUpdate();
         break;
     }
 }
 
+void NdProxyManager::PublishDuaSnapshot(void)
+{
+    std::shared_ptr<DuaSnapshot> snapshot = std::make_shared<DuaSnapshot>();
+
+    snapshot->mTargets           = mNdProxySet;
+    snapshot->mRegistrationTimes = mRegistrationTimes;
+
+    std::atomic_store(&mDuaSnapshot, std::shared_ptr<const DuaSnapshot>(std::move(snapshot)));
+    mDuaSnapshotDirty = false;
+}
+
 void NdProxyManager::SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst)
 {
-    uint8_t                    packet[kMaxICMP6PacketSize];
-    uint16_t                   len = 0;
-    struct nd_neighbor_advert &na  = *reinterpret_cast<struct nd_neighbor_advert *>(packet);
-    struct nd_opt_hdr &        opt = *reinterpret_cast<struct nd_opt_hdr *>(packet + sizeof(struct nd_neighbor_advert));
-    bool                       isSolicited = !aDst.IsMulticast();
-    sockaddr_in6               dst;
-    otbrError                  error = OTBR_ERROR_NONE;
-    otBackboneRouterNdProxyInfo aNdProxyInfo;
+    // Only sent for a registration, which is always recent.
+    QueueNeighborAdvertisement(*mUnsolicitedNaBatch, aTarget, aDst, /* aOverride */ true);
+    FlushNeighborAdvertisements(*mUnsolicitedNaBatch);
+}
 
-    VerifyOrExit(otBackboneRouterGetNdProxyInfo(mNcp.GetInstance(), reinterpret_cast<const otIp6Address *>(&aTarget),
-                                                &aNdProxyInfo) == OT_ERROR_NONE,
-                 error = OTBR_ERROR_OPENTHREAD);
+void NdProxyManager::QueueSolicitedNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst)
+{
+    auto it = mProcessingDuas->mRegistrationTimes.find(aTarget);
 
-    memset(packet, 0, sizeof(packet));
+    if (it == mProcessingDuas->mRegistrationTimes.end())
+    {
+        Metrics::Get().Increment(Metrics::kCounterNdProxyNaFailed);
+        otbrLog(OTBR_LOG_WARNING, "NdProxyManager: %s is not proxied", aTarget.ToString().c_str());
+    }
+    else
+    {
+        QueueNeighborAdvertisement(*mNaBatch, aTarget, aDst,
+                                   Clock::now() - it->second <= std::chrono::seconds(kDuaRecentTime));
+    }
+}
 
-    na.nd_na_type = ND_NEIGHBOR_ADVERT;
-    na.nd_na_code = 0;
-    // set Solicited
-    na.nd_na_flags_reserved = isSolicited ? ND_NA_FLAG_SOLICITED : 0;
-    // set Router
-    na.nd_na_flags_reserved |= ND_NA_FLAG_ROUTER;
-    // set Override
-    na.nd_na_flags_reserved |= aNdProxyInfo.mTimeSinceLastTransaction <= kDuaRecentTime ? ND_NA_FLAG_OVERRIDE : 0;
+void NdProxyManager::QueueNeighborAdvertisement(NaBatch &         aBatch,
+                                                const Ip6Address &aTarget,
+                                                const Ip6Address &aDst,
+                                                bool              aOverride)
+{
+    uint8_t *packet;
+    bool     isSolicited = !aDst.IsMulticast();
 
-    memcpy(&na.nd_na_target, aTarget.m8, sizeof(Ip6Address));
-    len += sizeof(struct nd_neighbor_advert);
+    if (aBatch.mCount == kMaxBatchSize)
+    {
+        FlushNeighborAdvertisements(aBatch);
+    }
 
-    opt.nd_opt_type = ND_OPT_TARGET_LINKADDR;
-    opt.nd_opt_len  = 1;
+    packet = aBatch.mPackets[aBatch.mCount];
+    memset(packet, 0, kNaPacketSize);
 
-    memcpy(reinterpret_cast<uint8_t *>(&opt) + 2, mMacAddress.m8, sizeof(mMacAddress));
+    {
+        struct nd_neighbor_advert &na  = *reinterpret_cast<struct nd_neighbor_advert *>(packet);
+        struct nd_opt_hdr &        opt = *reinterpret_cast<struct nd_opt_hdr *>(packet + sizeof(na));
 
-    len += (opt.nd_opt_len * 8);
+        na.nd_na_type = ND_NEIGHBOR_ADVERT;
+        na.nd_na_code = 0;
+        // set Solicited
+        na.nd_na_flags_reserved = isSolicited ? ND_NA_FLAG_SOLICITED : 0;
+        // set Router
+        na.nd_na_flags_reserved |= ND_NA_FLAG_ROUTER;
+        // set Override
+        na.nd_na_flags_reserved |= aOverride ? ND_NA_FLAG_OVERRIDE : 0;
 
-    aDst.CopyTo(dst);
+        memcpy(&na.nd_na_target, aTarget.m8, sizeof(Ip6Address));
 
-    VerifyOrExit(sendto(mIcmp6RawSock, packet, len, 0, reinterpret_cast<const sockaddr *>(&dst), sizeof(dst)) == len,
-                 error = OTBR_ERROR_ERRNO);
+        opt.nd_opt_type = ND_OPT_TARGET_LINKADDR;
+        opt.nd_opt_len  = 1;
+
+        memcpy(reinterpret_cast<uint8_t *>(&opt) + 2, mMacAddress.m8, sizeof(mMacAddress));
+    }
+
+    aDst.CopyTo(aBatch.mDestinations[aBatch.mCount]);
+    aBatch.mCount++;
+}
+
+void NdProxyManager::FlushNeighborAdvertisements(NaBatch &aBatch)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    int       sent  = 0;
+
+    VerifyOrExit(aBatch.mCount > 0);
+
+    for (unsigned int i = 0; i < aBatch.mCount; ++i)
+    {
+        struct msghdr &msghdr = aBatch.mMessages[i].msg_hdr;
+
+        aBatch.mIovecs[i].iov_base = aBatch.mPackets[i];
+        aBatch.mIovecs[i].iov_len  = kNaPacketSize;
+
+        memset(&msghdr, 0, sizeof(msghdr));
+        msghdr.msg_name    = &aBatch.mDestinations[i];
+        msghdr.msg_namelen = sizeof(aBatch.mDestinations[i]);
+        msghdr.msg_iov     = &aBatch.mIovecs[i];
+        msghdr.msg_iovlen  = 1;
+    }
+
+    sent = sendmmsg(mIcmp6RawSock, aBatch.mMessages, aBatch.mCount, 0);
+    if (sent < 0)
+    {
+        sent  = 0;
+        error = OTBR_ERROR_ERRNO;
+    }
+
+    for (unsigned int i = 0; i < aBatch.mCount; ++i)
+    {
+        bool ok = i < static_cast<unsigned int>(sent) && aBatch.mMessages[i].msg_len == kNaPacketSize;
+
+        Metrics::Get().Increment(ok ? Metrics::kCounterNdProxyNaSent : Metrics::kCounterNdProxyNaFailed);
+    }
+
+    Trace::Get().Log(Trace::kEventNdProxyNaFlush, aBatch.mCount, static_cast<uint32_t>(sent));
+    OTBR_USDT2(nd_proxy_na_out, aBatch.mCount, sent);
+
+    otbrLog(error == OTBR_ERROR_NONE ? OTBR_LOG_DEBUG : OTBR_LOG_WARNING, "NdProxyManager: sent %d of %u NA(s): %s",
+            sent, aBatch.mCount, otbrErrorString(error));
+
+    aBatch.mCount = 0;
 
 exit:
-    otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
+    return;
 }
 
 otbrError NdProxyManager::UpdateMacAddress(void)
@@ -406,6 +726,18 @@ otbrError NdProxyManager::InitIcmp6RawSocket(void)
 
     VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_ICMPV6, ICMP6_FILTER, &filter, sizeof(filter)) == 0,
                  error = OTBR_ERROR_ERRNO);
+
+    // Not fatal: without the socket filter every NS is still checked against the proxied DUAs in user space.
+    UpdateNsFilter();
+
+    // A new socket has no memberships, so every group of the proxied DUAs is joined again.
+    mJoinedGroups.clear();
+    for (const auto &group : mSolicitedNodeGroups)
+    {
+        mDirtyGroups.insert(group.first);
+    }
+    ScheduleMembershipUpdate();
+
 exit:
     if (error != OTBR_ERROR_NONE)
     {
@@ -415,12 +747,76 @@ exit:
     return error;
 }
 
+otbrError NdProxyManager::UpdateNsFilter(void)
+{
+    // The socket filter sees the ICMPv6 message without the IPv6 header.
+    enum
+    {
+        kTypeOffset       = offsetof(struct nd_neighbor_solicit, nd_ns_type),
+        kTargetTailOffset = offsetof(struct nd_neighbor_solicit, nd_ns_target) + sizeof(Ip6Address) - sizeof(uint32_t),
+        kAccept           = 0xffffffff,
+        kDrop             = 0,
+    };
+
+    otbrError                error = OTBR_ERROR_NONE;
+    std::vector<uint32_t>    tails;
+    std::vector<sock_filter> program;
+    struct sock_fprog        fprog;
+
+    VerifyOrExit(mIcmp6RawSock >= 0);
+
+    // Only the last 32 bits of each target are compared in the kernel, which takes a single instruction per DUA.
+    // The few NS passing because of a collision are dropped by the exact lookup in user space.
+    tails.reserve(mNdProxySet.GetSize());
+    for (const Ip6Address &target : mNdProxySet)
+    {
+        tails.push_back(static_cast<uint32_t>(target.m8[12]) << 24 | static_cast<uint32_t>(target.m8[13]) << 16 |
+                        static_cast<uint32_t>(target.m8[14]) << 8 | target.m8[15]);
+    }
+    std::sort(tails.begin(), tails.end());
+    tails.erase(std::unique(tails.begin(), tails.end()), tails.end());
+
+    // Jump offsets are 8 bits wide, so each comparison is followed by its own accept instead of jumping to a shared
+    // one. Two instructions per DUA, plus the header and the final drop.
+    VerifyOrExit(tails.size() <= (BPF_MAXINSNS - 6) / 2, error = OTBR_ERROR_INVALID_ARGS);
+
+    program.push_back(BPF_STMT(BPF_LD | BPF_B | BPF_ABS, kTypeOffset));
+    program.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, ND_NEIGHBOR_SOLICIT, 1, 0));
+    program.push_back(BPF_STMT(BPF_RET | BPF_K, kDrop));
+    program.push_back(BPF_STMT(BPF_LD | BPF_W | BPF_ABS, kTargetTailOffset));
+    for (uint32_t tail : tails)
+    {
+        program.push_back(BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, tail, 0, 1));
+        program.push_back(BPF_STMT(BPF_RET | BPF_K, kAccept));
+    }
+    program.push_back(BPF_STMT(BPF_RET | BPF_K, kDrop));
+
+    fprog.len    = static_cast<unsigned short>(program.size());
+    fprog.filter = program.data();
+
+    // Attaching replaces the previous filter atomically.
+    VerifyOrExit(setsockopt(mIcmp6RawSock, SOL_SOCKET, SO_ATTACH_FILTER, &fprog, sizeof(fprog)) == 0,
+                 error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (error == OTBR_ERROR_INVALID_ARGS)
+    {
+        // Too many DUAs for one program, let all NS through.
+        setsockopt(mIcmp6RawSock, SOL_SOCKET, SO_DETACH_FILTER, nullptr, 0);
+    }
+
+    otbrLogResult(error, "NdProxyManager: %s with %zu target(s)", __FUNCTION__, tails.size());
+    return error;
+}
+
 void NdProxyManager::FiniIcmp6RawSocket(void)
 {
     if (mIcmp6RawSock != -1)
     {
+        MainloopPoller::Get().Unregister(mIcmp6RawSock);
         close(mIcmp6RawSock);
         mIcmp6RawSock = -1;
+        mJoinedGroups.clear();
     }
 }
 
@@ -432,11 +828,20 @@ otbrError NdProxyManager::InitNetfilterQueue(void)
     VerifyOrExit(nfq_unbind_pf(mNfqHandler, AF_INET6) >= 0);
     VerifyOrExit(nfq_bind_pf(mNfqHandler, AF_INET6) >= 0);
 
-    VerifyOrExit((mNfqQueueHandler = nfq_create_queue(mNfqHandler, 88, HandleNetfilterQueue, this)) != nullptr);
-    VerifyOrExit(nfq_set_mode(mNfqQueueHandler, NFQNL_COPY_PACKET, 0xffff) >= 0);
+    VerifyOrExit((mNfqQueueHandler = nfq_create_queue(mNfqHandler, kUnicastNsQueueNum, HandleNetfilterQueue, this)) !=
+                 nullptr);
+    // Only the IPv6 header and the NS itself are inspected, the rest of the packet is never copied.
+    VerifyOrExit(nfq_set_mode(mNfqQueueHandler, NFQNL_COPY_PACKET, kNfqCopyRange) >= 0);
     VerifyOrExit((mUnicastNsQueueSock = nfq_fd(mNfqHandler)) >= 0);
 
-    error = OTBR_ERROR_NONE;
+    // Let packets through instead of dropping them when the agent falls behind, so backbone traffic is never lost.
+    if (nfq_set_queue_flags(mNfqQueueHandler, NFQA_CFG_F_FAIL_OPEN, NFQA_CFG_F_FAIL_OPEN) < 0)
+    {
+        otbrLog(OTBR_LOG_WARNING, "NdProxyManager: failed to enable fail-open on NFQUEUE: %s", strerror(errno));
+    }
+
+    mHasPendingVerdict = false;
+    error              = OTBR_ERROR_NONE;
 
 exit:
     otbrLogResult(error, "NdProxyManager: %s", __FUNCTION__);
@@ -453,6 +858,7 @@ void NdProxyManager::FiniNetfilterQueue(void)
 {
     if (mUnicastNsQueueSock != -1)
     {
+        MainloopPoller::Get().Unregister(mUnicastNsQueueSock);
         close(mUnicastNsQueueSock);
         mUnicastNsQueueSock = -1;
     }
@@ -482,12 +888,12 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
                                          struct nfgenmsg *    aNfMsg,
                                          struct nfq_data *    aNfData)
 {
+    OTBR_UNUSED_VARIABLE(aNfQueueHandler);
     OTBR_UNUSED_VARIABLE(aNfMsg);
 
     struct nfqnl_msg_packet_hdr *ph;
     unsigned char *              data;
     uint32_t                     id      = 0;
-    int                          ret     = 0;
     int                          len     = 0;
     int                          verdict = NF_ACCEPT;
 
@@ -503,7 +909,8 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
         otbrLog(OTBR_LOG_DEBUG, "NdProxyManager: %s: id %d", __FUNCTION__, id);
     }
 
-    VerifyOrExit((len = nfq_get_payload(aNfData, &data)) > 0, error = OTBR_ERROR_PARSE);
+    VerifyOrExit((len = nfq_get_payload(aNfData, &data)) >= static_cast<int>(sizeof(struct ip6_hdr)),
+                 error = OTBR_ERROR_PARSE);
 
     ip6header = reinterpret_cast<struct ip6_hdr *>(data);
     src       = *reinterpret_cast<Ip6Address *>(&ip6header->ip6_src);
@@ -514,61 +921,173 @@ int NdProxyManager::HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
     otbrLog(OTBR_LOG_DEBUG, "NdProxyManager: Handle Neighbor Solicitation: from %s to %s", src.ToString().c_str(),
             dst.ToString().c_str());
 
+    VerifyOrExit(len >= static_cast<int>(kNfqCopyRange), error = OTBR_ERROR_PARSE);
     icmp6header = reinterpret_cast<struct icmp6_hdr *>(data + sizeof(struct ip6_hdr));
     VerifyOrExit(icmp6header->icmp6_type == ND_NEIGHBOR_SOLICIT);
+    Metrics::Get().Increment(Metrics::kCounterNdProxyNsUnicast);
 
-    VerifyOrExit(mNdProxySet.find(dst) != mNdProxySet.end(), error = OTBR_ERROR_NOT_FOUND);
+    VerifyOrExit(mProcessingDuas->mTargets.Contains(dst), error = OTBR_ERROR_NOT_FOUND);
+    Metrics::Get().Increment(Metrics::kCounterNdProxyNsMatched);
 
     {
         struct nd_neighbor_solicit &ns = *reinterpret_cast<struct nd_neighbor_solicit *>(data + sizeof(struct ip6_hdr));
         Ip6Address &                target = *reinterpret_cast<Ip6Address *>(&ns.nd_ns_target);
 
+        Trace::Get().Log(Trace::kEventNdProxyNs, be64toh(target.m64[1]), false);
+        OTBR_USDT2(nd_proxy_ns_in, target.m8, false);
         otbrLog(OTBR_LOG_DEBUG, "NdProxyManager: %s: target: %s, hoplimit %d", __FUNCTION__, target.ToString().c_str(),
                 ip6header->ip6_hlim);
         VerifyOrExit(ip6header->ip6_hlim == 255, error = OTBR_ERROR_PARSE);
-        SendNeighborAdvertisement(target, src);
+        QueueSolicitedNeighborAdvertisement(target, src);
         verdict = NF_DROP;
     }
 
 exit:
-    ret = nfq_set_verdict(aNfQueueHandler, id, verdict, len, data);
+    if (ph != nullptr)
+    {
+        SetVerdict(id, verdict);
+    }
 
-    otbrLogResult(error, "NdProxyManager: %s (nfq_set_verdict id  %d, ret %d verdict %d)", __FUNCTION__, id, ret,
-                  verdict);
+    otbrLogResult(error, "NdProxyManager: %s (id %d, verdict %d)", __FUNCTION__, id, verdict);
 
-    return ret;
+    return 0;
 }
 
-void NdProxyManager::JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const
+void NdProxyManager::SetVerdict(uint32_t aId, int aVerdict)
 {
-    ipv6_mreq  mreq;
-    otbrError  error                     = OTBR_ERROR_NONE;
-    Ip6Address solicitedMulticastAddress = aTarget.ToSolicitedNodeMulticastAddress();
+    // A batch verdict covers every packet up to its id, so consecutive packets with the same verdict are merged.
+    if (mHasPendingVerdict && mPendingVerdict != aVerdict)
+    {
+        FlushVerdicts();
+    }
 
-    mreq.ipv6mr_interface = mBackboneIfIndex;
-    solicitedMulticastAddress.CopyTo(mreq.ipv6mr_multiaddr);
+    Metrics::Get().Increment(aVerdict == NF_DROP ? Metrics::kCounterNdProxyDropped : Metrics::kCounterNdProxyAccepted);
+
+    mHasPendingVerdict = true;
+    mPendingVerdict    = aVerdict;
+    mPendingVerdictId  = aId;
+}
 
-    VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_JOIN_GROUP, &mreq, sizeof(mreq)) == 0,
+void NdProxyManager::FlushVerdicts(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(mHasPendingVerdict);
+    mHasPendingVerdict = false;
+
+    VerifyOrExit(nfq_set_verdict_batch(mNfqQueueHandler, mPendingVerdictId, mPendingVerdict) >= 0,
                  error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        Metrics::Get().Increment(Metrics::kCounterNdProxyErrors);
+        otbrLog(OTBR_LOG_WARNING, "NdProxyManager: failed to set verdict %d up to id %u: %s", mPendingVerdict,
+                mPendingVerdictId, strerror(errno));
+    }
+}
+
+void NdProxyManager::AddSolicitedNodeGroupMember(const Ip6Address &aTarget)
+{
+    Ip6Address group = aTarget.ToSolicitedNodeMulticastAddress();
+
+    if (mSolicitedNodeGroups[group]++ == 0)
+    {
+        mDirtyGroups.insert(group);
+    }
+}
+
+void NdProxyManager::RemoveSolicitedNodeGroupMember(const Ip6Address &aTarget)
+{
+    auto it = mSolicitedNodeGroups.find(aTarget.ToSolicitedNodeMulticastAddress());
+
+    VerifyOrExit(it != mSolicitedNodeGroups.end());
+
+    if (--it->second == 0)
+    {
+        mDirtyGroups.insert(it->first);
+        mSolicitedNodeGroups.erase(it);
+    }
+
+exit:
+    return;
+}
+
+void NdProxyManager::ScheduleMembershipUpdate(void)
+{
+    // DUA events come in bursts, e.g. on a BBR takeover, so the update runs once the burst is over.
+    VerifyOrExit(!mMembershipTimer.IsPending());
+    mMembershipTimer = mNcp.PostTimerTask(std::chrono::steady_clock::now(), [this]() { ApplyMembershipUpdate(); });
+
 exit:
-    otbrLogResult(error, "NdProxyManager: JoinSolicitedNodeMulticastGroup of %s: %s", aTarget.ToString().c_str(),
-                  solicitedMulticastAddress.ToString().c_str());
+    return;
 }
 
-void NdProxyManager::LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const
+void NdProxyManager::ApplyMembershipUpdate(void)
 {
-    ipv6_mreq  mreq;
-    otbrError  error                     = OTBR_ERROR_NONE;
-    Ip6Address solicitedMulticastAddress = aTarget.ToSolicitedNodeMulticastAddress();
+    MemoryStats::Scope memoryScope(MemoryStats::kSubsystemNdProxy);
+
+    uint32_t joined = 0;
+    uint32_t left   = 0;
+
+    if (mDuaSnapshotDirty)
+    {
+        PublishDuaSnapshot();
+    }
+
+    VerifyOrExit(mIcmp6RawSock >= 0);
+
+    for (const Ip6Address &group : mDirtyGroups)
+    {
+        bool wanted = mSolicitedNodeGroups.count(group) > 0;
+        bool member = mJoinedGroups.count(group) > 0;
+
+        // A group joined and left again within the burst needs no system call.
+        if (wanted == member || UpdateMulticastGroup(group, wanted) != OTBR_ERROR_NONE)
+        {
+            continue;
+        }
+
+        if (wanted)
+        {
+            mJoinedGroups.insert(group);
+            joined++;
+        }
+        else
+        {
+            mJoinedGroups.erase(group);
+            left++;
+        }
+    }
+
+    if (mNsFilterDirty)
+    {
+        UpdateNsFilter();
+    }
+
+    otbrLog(OTBR_LOG_INFO, "NdProxyManager: joined %u and left %u solicited-node group(s), %zu joined in total",
+            joined, left, mJoinedGroups.size());
+
+exit:
+    mDirtyGroups.clear();
+    mNsFilterDirty = false;
+}
+
+otbrError NdProxyManager::UpdateMulticastGroup(const Ip6Address &aGroup, bool aJoin) const
+{
+    ipv6_mreq mreq;
+    otbrError error = OTBR_ERROR_NONE;
 
     mreq.ipv6mr_interface = mBackboneIfIndex;
-    solicitedMulticastAddress.CopyTo(mreq.ipv6mr_multiaddr);
+    aGroup.CopyTo(mreq.ipv6mr_multiaddr);
 
-    VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, IPV6_LEAVE_GROUP, &mreq, sizeof(mreq)) == 0,
+    VerifyOrExit(setsockopt(mIcmp6RawSock, IPPROTO_IPV6, aJoin ? IPV6_JOIN_GROUP : IPV6_LEAVE_GROUP, &mreq,
+                            sizeof(mreq)) == 0,
                  error = OTBR_ERROR_ERRNO);
 exit:
-    otbrLogResult(error, "NdProxyManager: LeaveSolicitedNodeMulticastGroup of %s: %s", aTarget.ToString().c_str(),
-                  solicitedMulticastAddress.ToString().c_str());
+    otbrLogResult(error, "NdProxyManager: %s solicited-node group %s", aJoin ? "Join" : "Leave",
+                  aGroup.ToString().c_str());
+    return error;
 }
 
 } // namespace BackboneRouter
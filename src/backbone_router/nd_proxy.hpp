@@ -38,16 +38,24 @@
 #define __APPLE_USE_RFC_3542
 #endif
 
+#include <chrono>
 #include <inttypes.h>
 #include <libnetfilter_queue/libnetfilter_queue.h>
-#include <map>
+#include <memory>
+#include <netinet/icmp6.h>
 #include <netinet/in.h>
-#include <set>
+#include <netinet/ip6.h>
 #include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <openthread/backbone_router_ftd.h>
 
 #include "agent/ncp_openthread.hpp"
+#include "common/ip6_address_set.hpp"
+#include "common/timer_wheel.hpp"
 #include "common/types.hpp"
 
 namespace otbr {
@@ -65,6 +73,11 @@ namespace BackboneRouter {
 /**
  * This class implements ND Proxy manager.
  *
+ * Neighbor Solicitations are answered in the mainloop, or by a dedicated backbone thread if enabled with
+ * `InstanceParams::SetBackboneThreadCpu()`, so that bursts of backbone traffic do not delay the Thread processing.
+ * Either way the packet processing does not call OpenThread, it reads an immutable snapshot of the proxied DUAs
+ * which the mainloop replaces after each burst of DUA events.
+ *
  */
 class NdProxyManager
 {
@@ -79,9 +92,21 @@ public:
         , mUnicastNsQueueSock(-1)
         , mNfqHandler(nullptr)
         , mNfqQueueHandler(nullptr)
+        , mHasPendingVerdict(false)
+        , mPendingVerdict(0)
+        , mPendingVerdictId(0)
+        , mNsFilterDirty(false)
+        , mDuaSnapshotDirty(false)
+        , mBackboneThreadStopFd(-1)
     {
     }
 
+    /**
+     * The destructor stops the backbone thread.
+     *
+     */
+    ~NdProxyManager(void) { StopBackboneThread(); }
+
     /**
      * This method initializes a ND Proxy manager instance.
      *
@@ -102,6 +127,12 @@ public:
      */
     void Disable(void);
 
+    /**
+     * This method returns whether Neighbor Solicitations are processed by the backbone thread.
+     *
+     */
+    bool IsBackboneThreadRunning(void) const { return mBackboneThread.joinable(); }
+
     /**
      * This method updates the fd_set and timeout for mainloop.
      *
@@ -150,33 +181,119 @@ private:
     enum
     {
         kMaxICMP6PacketSize = 1500, ///< Max size of an ICMP6 packet in bytes.
+        kMaxBatchSize       = 16,   ///< Max number of packets received or sent in one system call.
+        kMaxBatchesPerEvent = 4,    ///< Max number of batches received per readiness event.
+        kNfqBufferSize      = 8192, ///< Size of the buffer receiving queued packets from netlink.
+        kUnicastNsQueueNum  = 88,   ///< The NFQUEUE receiving unicast NS to the domain prefix.
+    };
+
+    typedef std::chrono::steady_clock Clock;
+
+    static constexpr size_t kNaPacketSize = sizeof(struct nd_neighbor_advert) + 8; ///< With a link-layer address.
+    static constexpr size_t kNfqCopyRange = sizeof(struct ip6_hdr) + sizeof(struct nd_neighbor_solicit);
+
+    // The buffers of a batch of received Neighbor Solicitations, allocated once by Init().
+    struct NsBatch
+    {
+        uint8_t        mPackets[kMaxBatchSize][kMaxICMP6PacketSize];
+        uint8_t        mControls[kMaxBatchSize][2 * CMSG_SPACE(sizeof(struct in6_pktinfo))];
+        sockaddr_in6   mSources[kMaxBatchSize];
+        struct iovec   mIovecs[kMaxBatchSize];
+        struct mmsghdr mMessages[kMaxBatchSize];
+    };
+
+    // The Neighbor Advertisements queued to be sent at once.
+    struct NaBatch
+    {
+        uint8_t        mPackets[kMaxBatchSize][kNaPacketSize];
+        sockaddr_in6   mDestinations[kMaxBatchSize];
+        struct iovec   mIovecs[kMaxBatchSize];
+        struct mmsghdr mMessages[kMaxBatchSize];
+        unsigned int   mCount;
+    };
+
+    // The proxied DUAs read by the packet processing. A snapshot is never modified once published, so the backbone
+    // thread reads it without a lock while the mainloop publishes the next one.
+    struct DuaSnapshot
+    {
+        Ip6AddressSet                                     mTargets;
+        std::unordered_map<Ip6Address, Clock::time_point> mRegistrationTimes;
     };
 
     void       SendNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst);
+    void       QueueNeighborAdvertisement(NaBatch &         aBatch,
+                                          const Ip6Address &aTarget,
+                                          const Ip6Address &aDst,
+                                          bool              aOverride);
+    void       QueueSolicitedNeighborAdvertisement(const Ip6Address &aTarget, const Ip6Address &aDst);
+    void       FlushNeighborAdvertisements(NaBatch &aBatch);
+    void       PublishDuaSnapshot(void);
+    otbrError  StartBackboneThread(void);
+    void       StopBackboneThread(void);
+    void       RunBackboneThread(void);
+    void       ProcessNeighborSolicitations(bool aMulticast, bool aUnicast);
+    void       HandleMulticastNeighborSolicit(const uint8_t *      aPacket,
+                                              size_t               aLength,
+                                              const sockaddr_in6 & aSource,
+                                              const struct msghdr &aMsgHdr);
     otbrError  UpdateMacAddress(void);
     otbrError  InitIcmp6RawSocket(void);
+    otbrError  UpdateNsFilter(void);
     void       FiniIcmp6RawSocket(void);
     otbrError  InitNetfilterQueue(void);
     void       FiniNetfilterQueue(void);
     void       ProcessMulticastNeighborSolicition(void);
     void       ProcessUnicastNeighborSolicition(void);
-    void       JoinSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const;
-    void       LeaveSolicitedNodeMulticastGroup(const Ip6Address &aTarget) const;
+    void       AddSolicitedNodeGroupMember(const Ip6Address &aTarget);
+    void       RemoveSolicitedNodeGroupMember(const Ip6Address &aTarget);
+    void       ScheduleMembershipUpdate(void);
+    void       ApplyMembershipUpdate(void);
+    otbrError  UpdateMulticastGroup(const Ip6Address &aGroup, bool aJoin) const;
     static int HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler,
                                     struct nfgenmsg *    aNfMsg,
                                     struct nfq_data *    aNfData,
                                     void *               aContext);
-    int HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler, struct nfgenmsg *aNfMsg, struct nfq_data *aNfData);
+    int  HandleNetfilterQueue(struct nfq_q_handle *aNfQueueHandler, struct nfgenmsg *aNfMsg, struct nfq_data *aNfData);
+    void SetVerdict(uint32_t aId, int aVerdict);
+    void FlushVerdicts(void);
 
     otbr::Ncp::ControllerOpenThread &mNcp;
-    std::set<Ip6Address>             mNdProxySet;
+    Ip6AddressSet                    mNdProxySet;
     uint32_t                         mBackboneIfIndex;
     int                              mIcmp6RawSock;
     int                              mUnicastNsQueueSock;
     struct nfq_handle *              mNfqHandler;      ///< A pointer to an NFQUEUE handler.
     struct nfq_q_handle *            mNfqQueueHandler; ///< A pointer to a newly created queue.
+    bool                             mHasPendingVerdict;
+    int                              mPendingVerdict;
+    uint32_t                         mPendingVerdictId;
     MacAddress                       mMacAddress;
     Ip6Prefix                        mDomainPrefix;
+    std::unique_ptr<NsBatch>         mNsBatch;
+    std::unique_ptr<NaBatch>         mNaBatch;
+    std::unique_ptr<NaBatch>         mUnsolicitedNaBatch;
+
+    // Solicited-node groups are shared by many DUAs. Joins and leaves are applied once per burst of DUA events,
+    // for the groups whose membership changed since the last update.
+    std::unordered_map<Ip6Address, uint32_t> mSolicitedNodeGroups; ///< Number of proxied DUAs of each group.
+    std::unordered_set<Ip6Address>           mJoinedGroups;        ///< Groups joined on the ICMPv6 raw socket.
+    std::unordered_set<Ip6Address>           mDirtyGroups;         ///< Groups to reconcile at the next update.
+    bool                                     mNsFilterDirty;
+    TimerWheel::Handle                       mMembershipTimer;
+
+    // The registration time of each proxied DUA, for the Override flag of the NAs. Only used by the mainloop.
+    std::unordered_map<Ip6Address, Clock::time_point> mRegistrationTimes;
+    bool                                              mDuaSnapshotDirty;
+
+    // Only accessed with std::atomic_load() and std::atomic_store(), the packet processing keeps the snapshot it
+    // loaded in mProcessingDuas while it handles a batch.
+    std::shared_ptr<const DuaSnapshot> mDuaSnapshot;
+    std::shared_ptr<const DuaSnapshot> mProcessingDuas;
+
+    // The solicited NAs are sent by the packet processing in mNaBatch, the unsolicited ones by the mainloop in
+    // mUnsolicitedNaBatch. The backbone thread is stopped by making mBackboneThreadStopFd readable.
+    std::thread mBackboneThread;
+    int         mBackboneThreadStopFd;
 };
 
 /**
@@ -0,0 +1,118 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements the agent configuration file.
+ */
+
+#include "common/config_file.hpp"
+
+#include <fstream>
+#include <sstream>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+static std::string Trim(const std::string &aString)
+{
+    static const char kWhitespace[] = " \t\r";
+
+    size_t begin = aString.find_first_not_of(kWhitespace);
+    size_t end   = aString.find_last_not_of(kWhitespace);
+
+    return (begin == std::string::npos) ? std::string() : aString.substr(begin, end - begin + 1);
+}
+
+otbrError ConfigFile::Load(const char *aPath)
+{
+    otbrError          error = OTBR_ERROR_NONE;
+    std::ifstream      file(aPath);
+    std::ostringstream content;
+
+    // The errno of the failed open() is kept by the file stream.
+    VerifyOrExit(file.is_open(), error = OTBR_ERROR_ERRNO);
+
+    content << file.rdbuf();
+    error = Parse(content.str());
+
+exit:
+    return error;
+}
+
+otbrError ConfigFile::Parse(const std::string &aContent)
+{
+    otbrError          error = OTBR_ERROR_NONE;
+    std::istringstream stream(aContent);
+    std::string        line;
+    size_t             lineNumber = 0;
+
+    mEntries.clear();
+    mErrorLine = 0;
+
+    while (std::getline(stream, line))
+    {
+        size_t      separator;
+        std::string key;
+
+        ++lineNumber;
+        line = Trim(line);
+
+        if (line.empty() || line[0] == '#')
+        {
+            continue;
+        }
+
+        separator = line.find('=');
+        VerifyOrExit(separator != std::string::npos, error = OTBR_ERROR_PARSE);
+
+        key = Trim(line.substr(0, separator));
+        VerifyOrExit(!key.empty(), error = OTBR_ERROR_PARSE);
+
+        mEntries[key] = Trim(line.substr(separator + 1));
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        mEntries.clear();
+        mErrorLine = lineNumber;
+    }
+
+    return error;
+}
+
+const char *ConfigFile::Get(const std::string &aKey) const
+{
+    auto it = mEntries.find(aKey);
+
+    return (it == mEntries.end()) ? nullptr : it->second.c_str();
+}
+
+} // namespace otbr
@@ -0,0 +1,121 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for the agent configuration file.
+ */
+
+#ifndef OTBR_COMMON_CONFIG_FILE_HPP_
+#define OTBR_COMMON_CONFIG_FILE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <map>
+#include <string>
+
+#include <stddef.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class parses a configuration file of `key = value` lines.
+ *
+ * Blank lines and lines starting with `#` are ignored, and whitespace around keys and values is removed. A key given
+ * more than once takes the last value.
+ *
+ */
+class ConfigFile
+{
+public:
+    /**
+     * This constructor initializes an empty configuration.
+     *
+     */
+    ConfigFile(void)
+        : mErrorLine(0)
+    {
+    }
+
+    /**
+     * This method reads and parses a configuration file.
+     *
+     * @param[in]   aPath   The path of the configuration file.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully parsed the file.
+     * @retval  OTBR_ERROR_ERRNO    Failed to read the file, see errno.
+     * @retval  OTBR_ERROR_PARSE    A line is not a `key = value` pair, see `GetErrorLine()`.
+     *
+     */
+    otbrError Load(const char *aPath);
+
+    /**
+     * This method parses the content of a configuration file.
+     *
+     * The previous entries are dropped, and no entries are kept on failure.
+     *
+     * @param[in]   aContent    The content of the configuration file.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully parsed the content.
+     * @retval  OTBR_ERROR_PARSE    A line is not a `key = value` pair, see `GetErrorLine()`.
+     *
+     */
+    otbrError Parse(const std::string &aContent);
+
+    /**
+     * This method returns the value of a key.
+     *
+     * @param[in]   aKey    The key.
+     *
+     * @returns The value of @p aKey, or nullptr if the key is not present.
+     *
+     */
+    const char *Get(const std::string &aKey) const;
+
+    /**
+     * This method returns all entries, ordered by key.
+     *
+     */
+    const std::map<std::string, std::string> &GetEntries(void) const { return mEntries; }
+
+    /**
+     * This method returns the line number, starting from 1, of the line that failed to parse.
+     *
+     */
+    size_t GetErrorLine(void) const { return mErrorLine; }
+
+private:
+    std::map<std::string, std::string> mEntries;
+    size_t                             mErrorLine;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_CONFIG_FILE_HPP_
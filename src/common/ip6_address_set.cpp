@@ -0,0 +1,160 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements a hash set of IPv6 addresses.
+ */
+
+#include "common/ip6_address_set.hpp"
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+Ip6AddressSet::Ip6AddressSet(void)
+    : mSlots(kMinCapacity)
+    , mSize(0)
+    , mRemoved(0)
+{
+}
+
+size_t Ip6AddressSet::Hash(const Ip6Address &aAddress)
+{
+    uint64_t iid = aAddress.m64[1];
+
+    // Fibonacci hashing spreads similar interface identifiers over the table, the high bits are the best mixed.
+    iid ^= iid >> 29;
+    iid *= UINT64_C(0x9e3779b97f4a7c15);
+
+    return static_cast<size_t>(iid >> 32);
+}
+
+const Ip6AddressSet::Slot *Ip6AddressSet::Find(const Ip6Address &aAddress) const
+{
+    size_t      mask  = mSlots.size() - 1;
+    size_t      index = Hash(aAddress) & mask;
+    const Slot *found = nullptr;
+
+    // The table always has empty slots, so the probe sequence terminates.
+    while (mSlots[index].mState != kSlotEmpty)
+    {
+        if (mSlots[index].mState == kSlotOccupied && mSlots[index].mAddress == aAddress)
+        {
+            found = &mSlots[index];
+            break;
+        }
+
+        index = (index + 1) & mask;
+    }
+
+    return found;
+}
+
+bool Ip6AddressSet::Insert(const Ip6Address &aAddress)
+{
+    bool   inserted = false;
+    size_t mask;
+    size_t index;
+
+    VerifyOrExit(!Contains(aAddress));
+
+    if ((mSize + mRemoved + 1) * 2 > mSlots.size())
+    {
+        // Grow when live addresses fill the table, otherwise rebuilding drops the removed slots.
+        Rehash((mSize + 1) * 2 > mSlots.size() / 2 ? mSlots.size() * 2 : mSlots.size());
+    }
+
+    mask  = mSlots.size() - 1;
+    index = Hash(aAddress) & mask;
+
+    while (mSlots[index].mState == kSlotOccupied)
+    {
+        index = (index + 1) & mask;
+    }
+
+    mRemoved -= (mSlots[index].mState == kSlotRemoved);
+    mSlots[index].mAddress = aAddress;
+    mSlots[index].mState   = kSlotOccupied;
+    ++mSize;
+    inserted = true;
+
+exit:
+    return inserted;
+}
+
+bool Ip6AddressSet::Erase(const Ip6Address &aAddress)
+{
+    Slot *slot = const_cast<Slot *>(Find(aAddress));
+
+    if (slot != nullptr)
+    {
+        slot->mState = kSlotRemoved;
+        --mSize;
+        ++mRemoved;
+    }
+
+    return slot != nullptr;
+}
+
+void Ip6AddressSet::Clear(void)
+{
+    mSlots.assign(kMinCapacity, Slot());
+    mSize    = 0;
+    mRemoved = 0;
+}
+
+void Ip6AddressSet::Rehash(size_t aCapacity)
+{
+    std::vector<Slot> slots(aCapacity);
+    size_t            mask = aCapacity - 1;
+
+    for (const Slot &slot : mSlots)
+    {
+        size_t index;
+
+        if (slot.mState != kSlotOccupied)
+        {
+            continue;
+        }
+
+        index = Hash(slot.mAddress) & mask;
+
+        while (slots[index].mState == kSlotOccupied)
+        {
+            index = (index + 1) & mask;
+        }
+
+        slots[index] = slot;
+    }
+
+    mSlots.swap(slots);
+    mRemoved = 0;
+}
+
+} // namespace otbr
@@ -0,0 +1,214 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for a hash set of IPv6 addresses.
+ */
+
+#ifndef OTBR_COMMON_IP6_ADDRESS_SET_HPP_
+#define OTBR_COMMON_IP6_ADDRESS_SET_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <iterator>
+#include <vector>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements an open-addressing hash set of IPv6 addresses.
+ *
+ * Addresses are hashed by their interface identifier only, as the addresses kept in a set usually share their
+ * prefix, e.g. the Domain Unicast Addresses of a Thread Domain. Collisions are resolved by linear probing in a
+ * power-of-two table, which is grown or rebuilt before live and removed slots fill half of it.
+ *
+ */
+class Ip6AddressSet
+{
+private:
+    enum : uint8_t
+    {
+        kSlotEmpty,
+        kSlotOccupied,
+        kSlotRemoved,
+    };
+
+    struct Slot
+    {
+        Ip6Address mAddress;
+        uint8_t    mState = kSlotEmpty;
+    };
+
+public:
+    /**
+     * This class implements a forward iterator over the addresses of the set.
+     *
+     * Iterators are invalidated by any change of the set.
+     *
+     */
+    class ConstIterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef const Ip6Address          value_type;
+        typedef ptrdiff_t                 difference_type;
+        typedef const Ip6Address *        pointer;
+        typedef const Ip6Address &        reference;
+
+        const Ip6Address &operator*(void) const { return mSlot->mAddress; }
+        const Ip6Address *operator->(void) const { return &mSlot->mAddress; }
+
+        ConstIterator &operator++(void)
+        {
+            ++mSlot;
+            SkipFreeSlots();
+            return *this;
+        }
+
+        bool operator==(const ConstIterator &aOther) const { return mSlot == aOther.mSlot; }
+        bool operator!=(const ConstIterator &aOther) const { return mSlot != aOther.mSlot; }
+
+    private:
+        friend class Ip6AddressSet;
+
+        ConstIterator(const Slot *aSlot, const Slot *aEnd)
+            : mSlot(aSlot)
+            , mEnd(aEnd)
+        {
+            SkipFreeSlots();
+        }
+
+        void SkipFreeSlots(void)
+        {
+            while (mSlot != mEnd && mSlot->mState != kSlotOccupied)
+            {
+                ++mSlot;
+            }
+        }
+
+        const Slot *mSlot;
+        const Slot *mEnd;
+    };
+
+    /**
+     * This constructor initializes an empty set.
+     *
+     */
+    Ip6AddressSet(void);
+
+    /**
+     * This method inserts an address.
+     *
+     * @param[in]   aAddress    The address to insert.
+     *
+     * @returns Whether @p aAddress was inserted, false if it was already in the set.
+     *
+     */
+    bool Insert(const Ip6Address &aAddress);
+
+    /**
+     * This method removes an address.
+     *
+     * @param[in]   aAddress    The address to remove.
+     *
+     * @returns Whether @p aAddress was removed, false if it was not in the set.
+     *
+     */
+    bool Erase(const Ip6Address &aAddress);
+
+    /**
+     * This method returns whether an address is in the set.
+     *
+     * @param[in]   aAddress    The address to look up.
+     *
+     * @returns Whether @p aAddress is in the set.
+     *
+     */
+    bool Contains(const Ip6Address &aAddress) const { return Find(aAddress) != nullptr; }
+
+    /**
+     * This method removes all addresses.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method returns the number of addresses in the set.
+     *
+     * @returns The number of addresses.
+     *
+     */
+    size_t GetSize(void) const { return mSize; }
+
+    /**
+     * This method returns whether the set is empty.
+     *
+     * @returns Whether the set is empty.
+     *
+     */
+    bool IsEmpty(void) const { return mSize == 0; }
+
+    /**
+     * This method returns an iterator to the first address of the set.
+     *
+     * @returns The iterator to the first address.
+     *
+     */
+    ConstIterator begin(void) const { return ConstIterator(mSlots.data(), GetSlotsEnd()); }
+
+    /**
+     * This method returns an iterator past the last address of the set.
+     *
+     * @returns The iterator past the last address.
+     *
+     */
+    ConstIterator end(void) const { return ConstIterator(GetSlotsEnd(), GetSlotsEnd()); }
+
+private:
+    static constexpr size_t kMinCapacity = 16;
+
+    static size_t Hash(const Ip6Address &aAddress);
+
+    const Slot *GetSlotsEnd(void) const { return mSlots.data() + mSlots.size(); }
+    const Slot *Find(const Ip6Address &aAddress) const;
+    void        Rehash(size_t aCapacity);
+
+    std::vector<Slot> mSlots;
+    size_t            mSize;    // The number of occupied slots.
+    size_t            mRemoved; // The number of removed slots, which still lengthen probe sequences.
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_IP6_ADDRESS_SET_HPP_
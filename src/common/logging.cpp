@@ -28,8 +28,17 @@
 
 #include "common/logging.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 #include <assert.h>
 #include <errno.h>
+#include <inttypes.h>
+#include <semaphore.h>
 #include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -38,16 +47,215 @@
 #include <sys/time.h>
 #include <syslog.h>
 
+#include "common/code_utils.hpp"
+#include "common/memory_stats.hpp"
 #include "common/time.hpp"
 
 static int sLevel = LOG_INFO;
 
+static std::atomic<uint32_t> sLinesPerSecond(0);
+static std::atomic<uint64_t> sSuppressed(0);
+static std::mutex            sRateLimitMutex;
+
+namespace {
+
+/**
+ * This class implements writing log lines to syslog from a background thread.
+ *
+ * Callers format each line into a fixed-size record of a bounded lock-free ring buffer, so logging never waits for
+ * syslog. Each record carries a sequence number telling whether it is free for the producer at a position or
+ * published for the consumer, which allows any thread to log while a single thread writes the lines.
+ *
+ */
+class AsyncLog
+{
+public:
+    AsyncLog(void)
+        : mRunning(false)
+        , mStopping(false)
+        , mMask(0)
+        , mTail(0)
+        , mHead(0)
+        , mDropped(0)
+        , mReportedDropped(0)
+    {
+        sem_init(&mReady, /* pshared */ 0, /* value */ 0);
+    }
+
+    ~AsyncLog(void) { Stop(); }
+
+    void Start(uint32_t aNumRecords)
+    {
+        uint32_t numRecords = 1;
+
+        VerifyOrExit(!mRunning && aNumRecords > 0);
+
+        while (numRecords < aNumRecords)
+        {
+            numRecords <<= 1;
+        }
+
+        mRecords.reset(new Record[numRecords]);
+        for (uint32_t i = 0; i < numRecords; i++)
+        {
+            mRecords[i].mSequence.store(i, std::memory_order_relaxed);
+        }
+
+        mMask     = numRecords - 1;
+        mTail     = 0;
+        mHead     = 0;
+        mStopping = false;
+
+        mThread  = std::thread(&AsyncLog::Run, this);
+        mRunning = true;
+
+    exit:
+        return;
+    }
+
+    void Stop(void)
+    {
+        VerifyOrExit(mRunning);
+
+        // Lines logged from now on are written synchronously, the thread writes the remaining records and exits.
+        mRunning  = false;
+        mStopping = true;
+        sem_post(&mReady);
+        mThread.join();
+
+    exit:
+        return;
+    }
+
+    bool IsRunning(void) const { return mRunning; }
+
+    uint64_t GetDroppedCount(void) const { return mDropped; }
+
+    void Push(int aLevel, const char *aFormat, va_list aArguments)
+    {
+        uint32_t position = mTail.load(std::memory_order_relaxed);
+        Record * record;
+
+        while (true)
+        {
+            int32_t diff;
+
+            record = &mRecords[position & mMask];
+            diff   = static_cast<int32_t>(record->mSequence.load(std::memory_order_acquire) - position);
+
+            if (diff == 0)
+            {
+                if (mTail.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // The record still holds the line from a lap ago, the ring buffer is full.
+                mDropped++;
+                ExitNow();
+            }
+            else
+            {
+                position = mTail.load(std::memory_order_relaxed);
+            }
+        }
+
+        record->mLevel = aLevel;
+        vsnprintf(record->mLine, sizeof(record->mLine), aFormat, aArguments);
+        record->mSequence.store(position + 1, std::memory_order_release);
+        sem_post(&mReady);
+
+    exit:
+        return;
+    }
+
+private:
+    // Longer lines are truncated.
+    static constexpr size_t kLineSize = 256;
+
+    struct Record
+    {
+        std::atomic<uint32_t> mSequence;
+        int                   mLevel;
+        char                  mLine[kLineSize];
+    };
+
+    void Run(void)
+    {
+        otbr::MemoryStats::Scope memoryScope(otbr::MemoryStats::kSubsystemLogging);
+
+        while (true)
+        {
+            Record * record;
+            uint64_t dropped;
+
+            while (sem_wait(&mReady) != 0 && errno == EINTR)
+            {
+            }
+
+            // Only the wakeup of Stop() finds no claimed record.
+            if (mHead == mTail.load(std::memory_order_acquire))
+            {
+                VerifyOrExit(!mStopping);
+                continue;
+            }
+
+            record = &mRecords[mHead & mMask];
+
+            // Another thread claimed the record first but has not finished writing it.
+            while (record->mSequence.load(std::memory_order_acquire) != mHead + 1)
+            {
+                std::this_thread::yield();
+            }
+
+            syslog(record->mLevel, "%s", record->mLine);
+            record->mSequence.store(mHead + mMask + 1, std::memory_order_release);
+            mHead++;
+
+            dropped = mDropped;
+            if (dropped != mReportedDropped)
+            {
+                syslog(LOG_WARNING, "%" PRIu64 " log lines dropped, the log queue is full", dropped - mReportedDropped);
+                mReportedDropped = dropped;
+            }
+        }
+
+    exit:
+        return;
+    }
+
+    std::atomic<bool>         mRunning;
+    std::atomic<bool>         mStopping;
+    std::unique_ptr<Record[]> mRecords;
+    uint32_t                  mMask;
+    std::atomic<uint32_t>     mTail;
+    uint32_t                  mHead;
+    std::atomic<uint64_t>     mDropped;
+    uint64_t                  mReportedDropped;
+    sem_t                     mReady;
+    std::thread               mThread;
+};
+
+AsyncLog sAsyncLog;
+
+} // namespace
+
 /** Get the current debug log level */
 int otbrLogGetLevel(void)
 {
     return sLevel;
 }
 
+/** Set the debug log level */
+void otbrLogSetLevel(int aLevel)
+{
+    assert(aLevel >= LOG_EMERG && aLevel <= LOG_DEBUG);
+
+    sLevel = aLevel;
+}
+
 /** Initialize logging */
 void otbrLogInit(const char *aIdent, int aLevel, bool aPrintStderr)
 {
@@ -59,7 +267,7 @@ void otbrLogInit(const char *aIdent, int aLevel, bool aPrintStderr)
 }
 
 /** log to the syslog or log file */
-void otbrLog(int aLevel, const char *aFormat, ...)
+void(otbrLog)(int aLevel, const char *aFormat, ...)
 {
     va_list ap;
 
@@ -71,16 +279,115 @@ void otbrLog(int aLevel, const char *aFormat, ...)
 /** log to the syslog or log file */
 void otbrLogv(int aLevel, const char *aFormat, va_list ap)
 {
+    otbr::MemoryStats::Scope memoryScope(otbr::MemoryStats::kSubsystemLogging);
+
     assert(aFormat);
 
-    if (aLevel <= sLevel)
+    if (aLevel > sLevel)
+    {
+        return;
+    }
+
+    if (sAsyncLog.IsRunning())
+    {
+        sAsyncLog.Push(aLevel, aFormat, ap);
+    }
+    else
     {
         vsyslog(aLevel, aFormat, ap);
     }
 }
 
+void otbrLogSetRateLimit(uint32_t aLinesPerSecond)
+{
+    sLinesPerSecond.store(aLinesPerSecond, std::memory_order_relaxed);
+}
+
+uint32_t otbrLogGetRateLimit(void)
+{
+    return sLinesPerSecond.load(std::memory_order_relaxed);
+}
+
+uint64_t otbrLogGetSuppressedCount(void)
+{
+    return sSuppressed.load(std::memory_order_relaxed);
+}
+
+bool otbrLogRateLimitAllow(otbrLogRateLimit *aRateLimit, int aLevel, const char *aFile, int aLine)
+{
+    uint32_t    rate       = sLinesPerSecond.load(std::memory_order_relaxed);
+    bool        allow      = true;
+    uint32_t    suppressed = 0;
+    const char *fileName;
+
+    VerifyOrExit(rate != 0 && aLevel < OTBR_LOG_DEBUG);
+
+    {
+        std::lock_guard<std::mutex> lock(sRateLimitMutex);
+        auto                        elapsed = std::chrono::steady_clock::now().time_since_epoch();
+        uint64_t now = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count());
+
+        if (aRateLimit->mRefillTime == 0)
+        {
+            aRateLimit->mTokens     = rate;
+            aRateLimit->mRefillTime = now;
+        }
+        else
+        {
+            uint64_t tokens = (now - aRateLimit->mRefillTime) * rate / 1000;
+
+            if (tokens > 0)
+            {
+                // Only the time worth the added tokens is consumed, a full bucket does not save any more.
+                aRateLimit->mTokens = static_cast<uint32_t>(std::min<uint64_t>(aRateLimit->mTokens + tokens, rate));
+                aRateLimit->mRefillTime += tokens * 1000 / rate;
+
+                if (aRateLimit->mTokens == rate)
+                {
+                    aRateLimit->mRefillTime = now;
+                }
+            }
+        }
+
+        if (aRateLimit->mTokens == 0)
+        {
+            aRateLimit->mSuppressed++;
+            allow = false;
+        }
+        else
+        {
+            aRateLimit->mTokens--;
+            suppressed              = aRateLimit->mSuppressed;
+            aRateLimit->mSuppressed = 0;
+        }
+    }
+
+    if (!allow)
+    {
+        sSuppressed.fetch_add(1, std::memory_order_relaxed);
+    }
+    else if (suppressed > 0)
+    {
+        fileName = strrchr(aFile, '/');
+        (otbrLog)(aLevel, "%u messages suppressed at %s:%d", suppressed, fileName ? fileName + 1 : aFile, aLine);
+    }
+
+exit:
+    return allow;
+}
+
+void otbrLogStartAsync(uint32_t aNumRecords)
+{
+    sAsyncLog.Start(aNumRecords);
+}
+
+uint64_t otbrLogGetDroppedCount(void)
+{
+    return sAsyncLog.GetDroppedCount();
+}
+
 /** Hex dump data to the log */
-void otbrDump(int aLevel, const char *aPrefix, const void *aMemory, size_t aSize)
+void(otbrDump)(int aLevel, const char *aPrefix, const void *aMemory, size_t aSize)
 {
     static const char kHexChars[] = "0123456789abcdef";
     assert(aPrefix && (aMemory || aSize == 0));
@@ -88,7 +395,7 @@ void otbrDump(int aLevel, const char *aPrefix, const void *aMemory, size_t aSize
     const uint8_t *p8;
     int            addr;
 
-    if (aLevel >= sLevel)
+    if (aLevel > sLevel)
     {
         return;
     }
@@ -126,7 +433,7 @@ void otbrDump(int aLevel, const char *aPrefix, const void *aMemory, size_t aSize
         }
         *ch = 0;
 
-        syslog(aLevel, "%s: %04x: %s", aPrefix, addr, hex);
+        otbrLog(aLevel, "%s: %04x: %s", aPrefix, addr, hex);
     }
 }
 
@@ -181,5 +488,6 @@ const char *otbrErrorString(otbrError aError)
 
 void otbrLogDeinit(void)
 {
+    sAsyncLog.Stop();
     closelog();
 }
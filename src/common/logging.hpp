@@ -37,6 +37,7 @@
 
 #include <stdarg.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include "common/types.hpp"
 
@@ -56,11 +57,42 @@ enum
     OTBR_LOG_DEBUG,   /* debug-level messages */
 };
 
+/**
+ * The most verbose log level compiled in.
+ *
+ * Logging calls above this level are removed at build time, including the evaluation of their arguments.
+ *
+ */
+#ifndef OTBR_MAX_LOG_LEVEL
+#define OTBR_MAX_LOG_LEVEL OTBR_LOG_DEBUG
+#endif
+
 /**
  * Get current log level
  */
 int otbrLogGetLevel(void);
 
+/**
+ * This function sets the log level.
+ *
+ * @param[in]   aLevel  The most verbose level logged, between OTBR_LOG_EMERG and OTBR_LOG_DEBUG.
+ *
+ */
+void otbrLogSetLevel(int aLevel);
+
+/**
+ * This function returns whether logs at level @p aLevel are written.
+ *
+ * @param[in]   aLevel  Log level of the logger.
+ *
+ * @returns Whether @p aLevel is compiled in and enabled by the current log level.
+ *
+ */
+inline bool otbrLogIsEnabled(int aLevel)
+{
+    return aLevel <= OTBR_MAX_LOG_LEVEL && aLevel <= otbrLogGetLevel();
+}
+
 /**
  * Control log to syslog
  *
@@ -79,6 +111,83 @@ void otbrLogEnableSyslog(bool aEnabled);
  */
 void otbrLogInit(const char *aIdent, int aLevel, bool aPrintStderr);
 
+/**
+ * This function moves writing log lines to syslog to a background thread.
+ *
+ * Log lines are formatted by the caller into a lock-free ring buffer of fixed-size records, so a blocking syslog does
+ * not stall the caller. Lines longer than a record are truncated. Lines logged while the ring buffer is full are
+ * dropped and counted, the background thread logs how many were dropped. otbrLogDeinit() writes the remaining lines
+ * and stops the thread.
+ *
+ * @param[in]   aNumRecords     The number of records, rounded up to a power of two. Zero keeps logging synchronous.
+ *
+ */
+void otbrLogStartAsync(uint32_t aNumRecords);
+
+/**
+ * This function returns the number of log lines dropped because the asynchronous log ring buffer was full.
+ *
+ * @returns The number of dropped log lines.
+ *
+ */
+uint64_t otbrLogGetDroppedCount(void);
+
+/**
+ * This function sets the rate limit of each logging call site.
+ *
+ * A call site logs a burst of up to @p aLinesPerSecond lines, then @p aLinesPerSecond lines per second. Lines above
+ * the limit are suppressed, and the next line logged by the call site is preceded by how many were suppressed. Debug
+ * lines are never suppressed.
+ *
+ * @param[in]   aLinesPerSecond     The number of lines per second of each call site. Zero disables the rate limit.
+ *
+ */
+void otbrLogSetRateLimit(uint32_t aLinesPerSecond);
+
+/**
+ * This function returns the rate limit of each logging call site.
+ *
+ * @returns The number of lines per second of each call site, zero if the rate limit is disabled.
+ *
+ */
+uint32_t otbrLogGetRateLimit(void);
+
+/**
+ * This function returns the number of log lines suppressed by the rate limit.
+ *
+ * @returns The number of suppressed log lines.
+ *
+ */
+uint64_t otbrLogGetSuppressedCount(void);
+
+/**
+ * This structure represents the token bucket of a logging call site.
+ *
+ * Call sites keep it in static storage, where it is zero-initialized without a guard.
+ *
+ */
+struct otbrLogRateLimit
+{
+    uint64_t mRefillTime; ///< Time in milliseconds the tokens were last refilled, zero if never.
+    uint32_t mTokens;     ///< Lines the call site may log right now.
+    uint32_t mSuppressed; ///< Lines suppressed since the call site last logged.
+};
+
+/**
+ * This function takes a token from the bucket of a logging call site.
+ *
+ * If lines were suppressed before the token is taken, how many is logged first.
+ *
+ * @param[inout]    aRateLimit  The token bucket of the call site.
+ * @param[in]       aLevel      Log level of the line.
+ * @param[in]       aFile       Source file of the call site.
+ * @param[in]       aLine       Source line of the call site.
+ *
+ * @returns Whether the line is logged.
+ *
+ */
+bool otbrLogRateLimitAllow(otbrLogRateLimit *aRateLimit, int aLevel, const char *aFile, int aLine);
+
 /**
  * This function log at level @p aLevel.
  *
@@ -88,6 +197,29 @@ void otbrLogInit(const char *aIdent, int aLevel, bool aPrintStderr);
  */
 void otbrLog(int aLevel, const char *aFormat, ...);
 
+/**
+ * This macro takes a token from the bucket of the enclosing call site, see otbrLogRateLimitAllow().
+ *
+ * Every expansion is a distinct lambda, so it gets its own bucket.
+ *
+ */
+#define OTBR_LOG_RATE_LIMIT_ALLOW(aLevel)                                                    \
+    [](int aOtbrLogLevel) -> bool {                                                          \
+        static otbrLogRateLimit sOtbrLogRateLimit;                                           \
+        return otbrLogRateLimitAllow(&sOtbrLogRateLimit, aOtbrLogLevel, __FILE__, __LINE__); \
+    }(aLevel)
+
+/**
+ * This macro skips otbrLog() when @p aLevel is disabled or the call site exceeds its rate limit, without evaluating
+ * the other arguments.
+ *
+ * The call is removed at build time if @p aLevel is above OTBR_MAX_LOG_LEVEL. @p aLevel may be evaluated more than
+ * once.
+ *
+ */
+#define otbrLog(aLevel, ...)                                                                                       \
+    ((otbrLogIsEnabled(aLevel) && OTBR_LOG_RATE_LIMIT_ALLOW(aLevel)) ? (otbrLog)((aLevel), __VA_ARGS__) : (void)0)
+
 /**
  * This macro log a action result according to @p aError.
  *
@@ -126,6 +258,12 @@ void otbrLogv(int aLevel, const char *aFormat, va_list);
  */
 void otbrDump(int aLevel, const char *aPrefix, const void *aMemory, size_t aSize);
 
+/**
+ * This macro skips otbrDump() when @p aLevel is disabled, without evaluating the other arguments.
+ *
+ */
+#define otbrDump(aLevel, ...) (otbrLogIsEnabled(aLevel) ? (otbrDump)((aLevel), __VA_ARGS__) : (void)0)
+
 /**
  * This function converts error code to string.
  *
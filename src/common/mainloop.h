@@ -38,28 +38,4 @@
 
 #include <openthread/openthread-system.h>
 
-#else
-#include <sys/select.h>
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-/**
- * This structure represents a context for a select() based mainloop.
- *
- */
-typedef struct otSysMainloopContext
-{
-    fd_set         mReadFdSet;  ///< The read file descriptors.
-    fd_set         mWriteFdSet; ///< The write file descriptors.
-    fd_set         mErrorFdSet; ///< The error file descriptors.
-    int            mMaxFd;      ///< The max file descriptor.
-    struct timeval mTimeout;    ///< The timeout.
-} otSysMainloopContext;
-
-#ifdef __cplusplus
-} // end of extern "C"
-#endif
-
 #endif // OTBR_COMMON_OTBR_MAINLOOP_HPP_
@@ -0,0 +1,443 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the mainloop file descriptor poller.
+ */
+
+#include "common/mainloop_poller.hpp"
+
+#include <algorithm>
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#if OTBR_ENABLE_EPOLL
+#include <sys/epoll.h>
+#endif
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+// A timeout is extended by at most this fraction of itself.
+static const int kTimerSlackRatio = 16;
+
+#if OTBR_ENABLE_EPOLL
+// Maximum number of epoll events handled per wakeup. Remaining events are reported in the next wakeup.
+static const int kMaxEpollEvents = 64;
+
+static uint32_t ToEpollEvents(uint8_t aEvents)
+{
+    uint32_t events = 0;
+
+    if (aEvents & MainloopPoller::kEventRead)
+    {
+        events |= EPOLLIN;
+    }
+
+    if (aEvents & MainloopPoller::kEventWrite)
+    {
+        events |= EPOLLOUT;
+    }
+
+    if (aEvents & MainloopPoller::kEventError)
+    {
+        events |= EPOLLPRI;
+    }
+
+    return events;
+}
+
+static uint8_t FromEpollEvents(uint32_t aEpollEvents, uint8_t aInterests)
+{
+    uint8_t events = 0;
+
+    // Like select(), report a hang-up or pending error as readable/writable so the owner sees it on its next I/O.
+    if (aEpollEvents & (EPOLLIN | EPOLLHUP | EPOLLERR))
+    {
+        events |= MainloopPoller::kEventRead;
+    }
+
+    if (aEpollEvents & (EPOLLOUT | EPOLLERR))
+    {
+        events |= MainloopPoller::kEventWrite;
+    }
+
+    if (aEpollEvents & (EPOLLPRI | EPOLLERR))
+    {
+        events |= MainloopPoller::kEventError;
+    }
+
+    return events & aInterests;
+}
+
+static int ToTimeoutMs(const timeval &aTimeout)
+{
+    int timeout = 0;
+
+    if (aTimeout.tv_sec > 0 || (aTimeout.tv_sec == 0 && aTimeout.tv_usec > 0))
+    {
+        timeout = static_cast<int>(aTimeout.tv_sec * 1000 + (aTimeout.tv_usec + 999) / 1000);
+    }
+
+    return timeout;
+}
+#endif // OTBR_ENABLE_EPOLL
+
+static thread_local MainloopPoller *sThreadPoller = nullptr;
+
+MainloopPoller &MainloopPoller::Get(void)
+{
+    static MainloopPoller sMainloopPoller;
+
+    return (sThreadPoller != nullptr) ? *sThreadPoller : sMainloopPoller;
+}
+
+void MainloopPoller::SetThreadPoller(MainloopPoller *aPoller)
+{
+    sThreadPoller = aPoller;
+}
+
+MainloopPoller::MainloopPoller(void)
+    : mEpollFd(-1)
+    , mMaxFd(-1)
+    , mTimerSlack(0)
+{
+#if OTBR_ENABLE_EPOLL
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+
+    if (mEpollFd < 0)
+    {
+        otbrLog(OTBR_LOG_WARNING, "MainloopPoller: epoll unavailable, falling back to select(): %s", strerror(errno));
+    }
+#endif
+}
+
+MainloopPoller::~MainloopPoller(void)
+{
+    if (mEpollFd >= 0)
+    {
+        close(mEpollFd);
+        mEpollFd = -1;
+    }
+}
+
+otbrError MainloopPoller::Register(int aFd, uint8_t aEvents)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    uint8_t   oldEvents;
+
+    VerifyOrExit(aFd >= 0, error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(IsEpollEnabled() || aFd < FD_SETSIZE, error = OTBR_ERROR_INVALID_ARGS);
+
+    if (static_cast<size_t>(aFd) >= mInterests.size())
+    {
+        mInterests.resize(aFd + 1, 0);
+    }
+
+    oldEvents = mInterests[aFd];
+    VerifyOrExit(oldEvents != aEvents);
+
+#if OTBR_ENABLE_EPOLL
+    if (IsEpollEnabled())
+    {
+        struct epoll_event event;
+        int                op;
+
+        memset(&event, 0, sizeof(event));
+        event.events  = ToEpollEvents(aEvents);
+        event.data.fd = aFd;
+
+        if (aEvents == 0)
+        {
+            op = EPOLL_CTL_DEL;
+        }
+        else if (oldEvents == 0)
+        {
+            op = EPOLL_CTL_ADD;
+        }
+        else
+        {
+            op = EPOLL_CTL_MOD;
+        }
+
+        if (epoll_ctl(mEpollFd, op, aFd, &event) != 0)
+        {
+            // The kernel drops a registration when the file descriptor is closed, and keeps it when the
+            // file descriptor was duplicated. Recover from both cases instead of failing.
+            if (op == EPOLL_CTL_MOD && errno == ENOENT)
+            {
+                VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, aFd, &event) == 0, error = OTBR_ERROR_ERRNO);
+            }
+            else if (op == EPOLL_CTL_ADD && errno == EEXIST)
+            {
+                VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_MOD, aFd, &event) == 0, error = OTBR_ERROR_ERRNO);
+            }
+            else
+            {
+                VerifyOrExit(op == EPOLL_CTL_DEL && (errno == ENOENT || errno == EBADF), error = OTBR_ERROR_ERRNO);
+            }
+        }
+    }
+#endif
+
+    mInterests[aFd] = aEvents;
+
+    if (aEvents != 0 && aFd > mMaxFd)
+    {
+        mMaxFd = aFd;
+    }
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_ERR, "MainloopPoller: failed to register fd %d: %s", aFd,
+                error == OTBR_ERROR_ERRNO ? strerror(errno) : otbrErrorString(error));
+    }
+
+    return error;
+}
+
+void MainloopPoller::Unregister(int aFd)
+{
+    VerifyOrExit(aFd >= 0 && static_cast<size_t>(aFd) < mInterests.size());
+
+    Register(aFd, 0);
+
+    // The file descriptor number may be reused before the next poll, do not report stale events for it.
+    if (static_cast<size_t>(aFd) < mReadyEvents.size())
+    {
+        mReadyEvents[aFd] = 0;
+    }
+
+exit:
+    return;
+}
+
+void MainloopPoller::ClearReadyEvents(void)
+{
+    for (int fd : mReadyFds)
+    {
+        mReadyEvents[fd] = 0;
+    }
+
+    mReadyFds.clear();
+}
+
+void MainloopPoller::SetReadyEvents(int aFd, uint8_t aEvents)
+{
+    VerifyOrExit(aEvents != 0);
+
+    if (static_cast<size_t>(aFd) >= mReadyEvents.size())
+    {
+        mReadyEvents.resize(aFd + 1, 0);
+    }
+
+    mReadyEvents[aFd] = aEvents;
+    mReadyFds.push_back(aFd);
+
+exit:
+    return;
+}
+
+int MainloopPoller::Poll(otSysMainloopContext &aMainloop)
+{
+    int rval;
+
+    ClearReadyEvents();
+    ApplyTimerSlack(aMainloop.mTimeout, mTimerSlack, std::chrono::steady_clock::now());
+
+#if OTBR_ENABLE_EPOLL
+    if (IsEpollEnabled())
+    {
+        rval = PollEpoll(aMainloop);
+    }
+    else
+#endif
+    {
+        rval = PollSelect(aMainloop);
+    }
+
+    return rval;
+}
+
+void MainloopPoller::ApplyTimerSlack(struct timeval &                      aTimeout,
+                                     std::chrono::milliseconds             aMaxSlack,
+                                     std::chrono::steady_clock::time_point aNow)
+{
+    using std::chrono::microseconds;
+
+    microseconds timeout = std::chrono::seconds(aTimeout.tv_sec) + microseconds(aTimeout.tv_usec);
+    microseconds step(1000);
+    int64_t      deadline;
+
+    VerifyOrExit(aMaxSlack.count() > 0 && timeout >= step * kTimerSlackRatio);
+
+    while (step * 2 <= aMaxSlack && step * 2 * kTimerSlackRatio <= timeout)
+    {
+        step *= 2;
+    }
+
+    // The grids of all the steps are aligned, so deadlines rounded with different steps still coincide.
+    deadline = std::chrono::duration_cast<microseconds>(aNow.time_since_epoch() + timeout).count();
+    timeout += microseconds((step.count() - deadline % step.count()) % step.count());
+
+    aTimeout.tv_sec  = static_cast<time_t>(timeout.count() / 1000000);
+    aTimeout.tv_usec = static_cast<suseconds_t>(timeout.count() % 1000000);
+
+exit:
+    return;
+}
+
+int MainloopPoller::PollSelect(otSysMainloopContext &aMainloop)
+{
+    int rval;
+
+    for (int fd = 0; fd <= mMaxFd; ++fd)
+    {
+        uint8_t events = mInterests[fd];
+
+        if (events == 0)
+        {
+            continue;
+        }
+
+        if (events & kEventRead)
+        {
+            FD_SET(fd, &aMainloop.mReadFdSet);
+        }
+
+        if (events & kEventWrite)
+        {
+            FD_SET(fd, &aMainloop.mWriteFdSet);
+        }
+
+        if (events & kEventError)
+        {
+            FD_SET(fd, &aMainloop.mErrorFdSet);
+        }
+
+        if (fd > aMainloop.mMaxFd)
+        {
+            aMainloop.mMaxFd = fd;
+        }
+    }
+
+    rval = select(aMainloop.mMaxFd + 1, &aMainloop.mReadFdSet, &aMainloop.mWriteFdSet, &aMainloop.mErrorFdSet,
+                  &aMainloop.mTimeout);
+    VerifyOrExit(rval > 0);
+
+    for (int fd = 0; fd <= mMaxFd; ++fd)
+    {
+        uint8_t events = 0;
+
+        if (mInterests[fd] == 0)
+        {
+            continue;
+        }
+
+        if (FD_ISSET(fd, &aMainloop.mReadFdSet))
+        {
+            events |= kEventRead;
+        }
+
+        if (FD_ISSET(fd, &aMainloop.mWriteFdSet))
+        {
+            events |= kEventWrite;
+        }
+
+        if (FD_ISSET(fd, &aMainloop.mErrorFdSet))
+        {
+            events |= kEventError;
+        }
+
+        SetReadyEvents(fd, events);
+    }
+
+exit:
+    return rval;
+}
+
+#if OTBR_ENABLE_EPOLL
+int MainloopPoller::PollEpoll(otSysMainloopContext &aMainloop)
+{
+    int rval;
+
+    if (aMainloop.mMaxFd < 0)
+    {
+        // Nothing is polled through the fd sets, wait on epoll directly.
+        ExitNow(rval = WaitEpoll(ToTimeoutMs(aMainloop.mTimeout)));
+    }
+
+    FD_SET(mEpollFd, &aMainloop.mReadFdSet);
+
+    rval = select(std::max(aMainloop.mMaxFd, mEpollFd) + 1, &aMainloop.mReadFdSet, &aMainloop.mWriteFdSet,
+                  &aMainloop.mErrorFdSet, &aMainloop.mTimeout);
+    VerifyOrExit(rval > 0);
+
+    if (FD_ISSET(mEpollFd, &aMainloop.mReadFdSet))
+    {
+        int count;
+
+        FD_CLR(mEpollFd, &aMainloop.mReadFdSet);
+        rval -= 1;
+
+        count = WaitEpoll(0);
+        rval  = (count < 0) ? count : rval + count;
+    }
+
+exit:
+    return rval;
+}
+
+int MainloopPoller::WaitEpoll(int aTimeoutMs)
+{
+    struct epoll_event events[kMaxEpollEvents];
+    int                count;
+
+    count = epoll_wait(mEpollFd, events, kMaxEpollEvents, aTimeoutMs);
+
+    for (int i = 0; i < count; ++i)
+    {
+        int fd = events[i].data.fd;
+
+        if (static_cast<size_t>(fd) < mInterests.size())
+        {
+            SetReadyEvents(fd, FromEpollEvents(events[i].events, mInterests[fd]));
+        }
+    }
+
+    return count;
+}
+#endif // OTBR_ENABLE_EPOLL
+
+} // namespace otbr
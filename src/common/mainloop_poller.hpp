@@ -0,0 +1,240 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for the mainloop file descriptor poller.
+ */
+
+#ifndef OTBR_COMMON_MAINLOOP_POLLER_HPP_
+#define OTBR_COMMON_MAINLOOP_POLLER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stdint.h>
+
+#include <chrono>
+#include <vector>
+
+#include "common/mainloop.h"
+#include "common/types.hpp"
+
+#ifndef OTBR_ENABLE_EPOLL
+#ifdef __linux__
+#define OTBR_ENABLE_EPOLL 1
+#else
+#define OTBR_ENABLE_EPOLL 0
+#endif
+#endif
+
+namespace otbr {
+
+/**
+ * This class implements a persistent registry of file descriptors for the agent mainloop.
+ *
+ * Components register their file descriptors once and only change the registration when their interest
+ * actually changes. On Linux the registry is backed by epoll, so a wakeup costs O(ready fds) instead of
+ * O(max fd) and the FD_SETSIZE limit does not apply to registered file descriptors. File descriptors which
+ * are still reported through `otSysMainloopContext` (e.g. the OpenThread platform) are polled with select()
+ * together with the epoll file descriptor.
+ *
+ * When epoll is not available, registered file descriptors are merged into the select() sets.
+ *
+ * A file descriptor MUST be unregistered before it is closed.
+ *
+ */
+class MainloopPoller
+{
+public:
+    static constexpr uint32_t kDefaultTimerSlackMs = 100; ///< The default maximum delay of a wakeup, in ms.
+
+    /**
+     * Events a file descriptor can be registered for.
+     *
+     */
+    enum : uint8_t
+    {
+        kEventRead  = 1 << 0, ///< The file descriptor is readable.
+        kEventWrite = 1 << 1, ///< The file descriptor is writable.
+        kEventError = 1 << 2, ///< An exceptional condition on the file descriptor.
+    };
+
+    /**
+     * This constructor creates a poller for a thread which runs its own loop besides the mainloop.
+     *
+     */
+    MainloopPoller(void);
+
+    /**
+     * This method gets the poller of the calling thread.
+     *
+     * @returns  The poller installed with `SetThreadPoller()`, or the single mainloop instance.
+     *
+     */
+    static MainloopPoller &Get(void);
+
+    /**
+     * This method installs a poller for the calling thread.
+     *
+     * Components running on the thread then register their file descriptors with @p aPoller through `Get()`.
+     *
+     * @param[in]   aPoller     The poller of the calling thread, or nullptr to use the mainloop instance again.
+     *
+     */
+    static void SetThreadPoller(MainloopPoller *aPoller);
+
+    /**
+     * This method registers a file descriptor or updates its interested events.
+     *
+     * Registering with no events is equivalent to unregistering the file descriptor.
+     *
+     * @param[in]   aFd         The file descriptor.
+     * @param[in]   aEvents     The interested events, a bitwise OR of `kEvent*`.
+     *
+     * @retval  OTBR_ERROR_NONE         Successfully updated the registration.
+     * @retval  OTBR_ERROR_INVALID_ARGS @p aFd is invalid or cannot be handled by select().
+     * @retval  OTBR_ERROR_ERRNO        Failed to update the epoll interest list.
+     *
+     */
+    otbrError Register(int aFd, uint8_t aEvents);
+
+    /**
+     * This method unregisters a file descriptor.
+     *
+     * @param[in]   aFd     The file descriptor.
+     *
+     */
+    void Unregister(int aFd);
+
+    /**
+     * This method returns the events which happened on a registered file descriptor in the last poll.
+     *
+     * @param[in]   aFd     The file descriptor.
+     *
+     * @returns A bitwise OR of `kEvent*`.
+     *
+     */
+    uint8_t GetReadyEvents(int aFd) const
+    {
+        return (aFd >= 0 && static_cast<size_t>(aFd) < mReadyEvents.size()) ? mReadyEvents[aFd] : 0;
+    }
+
+    /**
+     * This method indicates whether a registered file descriptor was readable in the last poll.
+     *
+     * @param[in]   aFd     The file descriptor.
+     *
+     */
+    bool IsReadable(int aFd) const { return GetReadyEvents(aFd) & kEventRead; }
+
+    /**
+     * This method indicates whether a registered file descriptor was writable in the last poll.
+     *
+     * @param[in]   aFd     The file descriptor.
+     *
+     */
+    bool IsWritable(int aFd) const { return GetReadyEvents(aFd) & kEventWrite; }
+
+    /**
+     * This method returns the registered file descriptors which had events in the last poll.
+     *
+     * This allows a component with many file descriptors to only visit the ready ones. A file descriptor
+     * unregistered after the poll may still be listed, but has no ready events.
+     *
+     * @returns The list of ready file descriptors.
+     *
+     */
+    const std::vector<int> &GetReadyFds(void) const { return mReadyFds; }
+
+    /**
+     * This method sets how much later than requested a timeout may wake the poller.
+     *
+     * Timeouts are extended to end on a grid of a power of two milliseconds, no coarser than 1/16 of the timeout
+     * and @p aMaxSlack. Timers firing close to each other then share one wakeup, and a timer which keeps getting
+     * rescheduled wakes the poller at most once per grid step.
+     *
+     * @param[in]   aMaxSlack   The maximum extension of a timeout, zero to wake exactly when requested.
+     *
+     */
+    void SetTimerSlack(std::chrono::milliseconds aMaxSlack) { mTimerSlack = aMaxSlack; }
+
+    /**
+     * This method extends a timeout by the timer slack, as done by `Poll()`.
+     *
+     * @param[inout]    aTimeout    The timeout to extend.
+     * @param[in]       aMaxSlack   The maximum extension of the timeout.
+     * @param[in]       aNow        The time the timeout starts from.
+     *
+     */
+    static void ApplyTimerSlack(struct timeval &                      aTimeout,
+                                std::chrono::milliseconds             aMaxSlack,
+                                std::chrono::steady_clock::time_point aNow);
+
+    /**
+     * This method waits for events on the registered file descriptors and those in @p aMainloop.
+     *
+     * On return, the file descriptor sets in @p aMainloop are updated the same way select() does.
+     *
+     * @param[inout]    aMainloop   A reference to OpenThread mainloop context.
+     *
+     * @returns The number of ready file descriptors, or -1 on failure with errno set.
+     *
+     */
+    int Poll(otSysMainloopContext &aMainloop);
+
+    /**
+     * This method indicates whether the poller is backed by epoll.
+     *
+     * @retval  true    The poller uses epoll.
+     * @retval  false   The poller uses select().
+     *
+     */
+    bool IsEpollEnabled(void) const { return mEpollFd >= 0; }
+
+    ~MainloopPoller(void);
+
+private:
+    void ClearReadyEvents(void);
+    void SetReadyEvents(int aFd, uint8_t aEvents);
+    int  PollSelect(otSysMainloopContext &aMainloop);
+#if OTBR_ENABLE_EPOLL
+    int PollEpoll(otSysMainloopContext &aMainloop);
+    int WaitEpoll(int aTimeoutMs);
+#endif
+
+    int                       mEpollFd;
+    int                       mMaxFd;
+    std::chrono::milliseconds mTimerSlack;
+    std::vector<uint8_t>      mInterests;
+    std::vector<uint8_t>      mReadyEvents;
+    std::vector<int>          mReadyFds;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MAINLOOP_POLLER_HPP_
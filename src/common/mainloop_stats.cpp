@@ -0,0 +1,142 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the mainloop latency statistics.
+ */
+
+#include "common/mainloop_stats.hpp"
+
+#include <inttypes.h>
+#include <string.h>
+
+#include "common/logging.hpp"
+#include "common/mainloop_watchdog.hpp"
+
+namespace otbr {
+
+// Upper bound (in microseconds) of the first histogram bucket.
+static const uint64_t kFirstBucketUpperBoundUs = 16;
+
+constexpr uint8_t  MainloopStats::kNumBuckets;
+constexpr uint32_t MainloopStats::kStallThresholdUs;
+
+MainloopStats &MainloopStats::Get(void)
+{
+    static MainloopStats sMainloopStats;
+
+    return sMainloopStats;
+}
+
+MainloopStats::Probe::Probe(Component aComponent, Phase aPhase)
+    : mComponent(aComponent)
+    , mPhase(aPhase)
+    , mStart(std::chrono::steady_clock::now())
+{
+    MainloopWatchdog::Get().Enter(aComponent, aPhase);
+}
+
+MainloopStats::Probe::~Probe(void)
+{
+    auto duration = std::chrono::steady_clock::now() - mStart;
+
+    MainloopWatchdog::Get().Leave();
+    MainloopStats::Get().Record(
+        mComponent, mPhase,
+        static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count()));
+}
+
+MainloopStats::MainloopStats(void)
+{
+    Clear();
+}
+
+void MainloopStats::Clear(void)
+{
+    memset(mHistograms, 0, sizeof(mHistograms));
+}
+
+void MainloopStats::Record(Component aComponent, Phase aPhase, uint64_t aDurationUs)
+{
+    Histogram &histogram = mHistograms[aComponent][aPhase];
+
+    histogram.mCount++;
+    histogram.mTotalUs += aDurationUs;
+    histogram.mBuckets[GetBucket(aDurationUs)]++;
+
+    if (aDurationUs > histogram.mMaxUs)
+    {
+        histogram.mMaxUs = aDurationUs;
+    }
+
+    if (aDurationUs >= kStallThresholdUs)
+    {
+        histogram.mStallCount++;
+        otbrLog(OTBR_LOG_WARNING, "Mainloop stall: %s.%s took %" PRIu64 " us", ComponentToString(aComponent),
+                PhaseToString(aPhase), aDurationUs);
+    }
+}
+
+uint8_t MainloopStats::GetBucket(uint64_t aDurationUs)
+{
+    uint8_t bucket = 0;
+
+    while (bucket < kNumBuckets - 1 && aDurationUs >= (kFirstBucketUpperBoundUs << bucket))
+    {
+        bucket++;
+    }
+
+    return bucket;
+}
+
+uint64_t MainloopStats::GetBucketUpperBound(uint8_t aBucket)
+{
+    return aBucket < kNumBuckets - 1 ? (kFirstBucketUpperBoundUs << aBucket) : UINT64_MAX;
+}
+
+const char *MainloopStats::ComponentToString(Component aComponent)
+{
+    static const char *const kComponentNames[] = {"agent", "dbus", "rest", "ubus"};
+
+    static_assert(sizeof(kComponentNames) / sizeof(kComponentNames[0]) == kNumComponents,
+                  "kComponentNames is not in sync with Component");
+
+    return aComponent < kNumComponents ? kComponentNames[aComponent] : "unknown";
+}
+
+const char *MainloopStats::PhaseToString(Phase aPhase)
+{
+    static const char *const kPhaseNames[] = {"UpdateFdSet", "Process"};
+
+    static_assert(sizeof(kPhaseNames) / sizeof(kPhaseNames[0]) == kNumPhases, "kPhaseNames is not in sync with Phase");
+
+    return aPhase < kNumPhases ? kPhaseNames[aPhase] : "unknown";
+}
+
+} // namespace otbr
@@ -0,0 +1,214 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for the mainloop latency statistics.
+ */
+
+#ifndef OTBR_COMMON_MAINLOOP_STATS_HPP_
+#define OTBR_COMMON_MAINLOOP_STATS_HPP_
+
+#include "openthread-br/config.h"
+
+#include <chrono>
+
+#include <stdint.h>
+
+namespace otbr {
+
+/**
+ * This class collects per-component latency statistics of the agent mainloop.
+ *
+ * Each component's `UpdateFdSet()` and `Process()` calls are timed and accumulated into a histogram with
+ * power-of-two buckets. Calls lasting longer than `kStallThresholdUs` are counted as stalls and logged.
+ *
+ */
+class MainloopStats
+{
+public:
+    /**
+     * Mainloop components.
+     *
+     */
+    enum Component : uint8_t
+    {
+        kComponentAgent, ///< The agent instance: NCP, border agent, mDNS and backbone agent.
+        kComponentDBus,  ///< The D-Bus agent.
+        kComponentRest,  ///< The REST server.
+        kComponentUbus,  ///< The ubus server.
+        kNumComponents,
+    };
+
+    /**
+     * Mainloop phases.
+     *
+     */
+    enum Phase : uint8_t
+    {
+        kPhaseUpdateFdSet, ///< The `UpdateFdSet()` call.
+        kPhaseProcess,     ///< The `Process()` call.
+        kNumPhases,
+    };
+
+    static constexpr uint8_t  kNumBuckets       = 16;     ///< Number of histogram buckets.
+    static constexpr uint32_t kStallThresholdUs = 100000; ///< Calls lasting at least this long are stalls.
+
+    /**
+     * This structure represents the latency histogram of one component phase.
+     *
+     */
+    struct Histogram
+    {
+        uint64_t mCount;                ///< The number of calls.
+        uint64_t mTotalUs;              ///< The accumulated duration in microseconds.
+        uint64_t mMaxUs;                ///< The maximum duration in microseconds.
+        uint64_t mStallCount;           ///< The number of calls lasting at least `kStallThresholdUs`.
+        uint64_t mBuckets[kNumBuckets]; ///< The number of calls per bucket, see `GetBucketUpperBound()`.
+    };
+
+    /**
+     * This class measures the duration of a scope and records it when destroyed.
+     *
+     */
+    class Probe
+    {
+    public:
+        /**
+         * The constructor starts the measurement.
+         *
+         * The call is also reported to `MainloopWatchdog`.
+         *
+         * @param[in]   aComponent  The component being measured.
+         * @param[in]   aPhase      The phase being measured.
+         *
+         */
+        Probe(Component aComponent, Phase aPhase);
+
+        /**
+         * The destructor records the measured duration.
+         *
+         */
+        ~Probe(void);
+
+    private:
+        Component                             mComponent;
+        Phase                                 mPhase;
+        std::chrono::steady_clock::time_point mStart;
+    };
+
+    /**
+     * This method gets the single `MainloopStats` instance.
+     *
+     * @returns  The single `MainloopStats` instance.
+     *
+     */
+    static MainloopStats &Get(void);
+
+    /**
+     * This method records the duration of one call.
+     *
+     * @param[in]   aComponent      The component.
+     * @param[in]   aPhase          The phase.
+     * @param[in]   aDurationUs     The duration in microseconds.
+     *
+     */
+    void Record(Component aComponent, Phase aPhase, uint64_t aDurationUs);
+
+    /**
+     * This method returns the histogram of a component phase.
+     *
+     * @param[in]   aComponent      The component.
+     * @param[in]   aPhase          The phase.
+     *
+     * @returns The histogram.
+     *
+     */
+    const Histogram &GetHistogram(Component aComponent, Phase aPhase) const
+    {
+        return mHistograms[aComponent][aPhase];
+    }
+
+    /**
+     * This method clears all statistics.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method returns the exclusive upper bound of a histogram bucket.
+     *
+     * Bucket 0 holds durations below 16us and each following bucket doubles the bound. The last bucket holds all
+     * remaining durations and has no upper bound.
+     *
+     * @param[in]   aBucket     The bucket index.
+     *
+     * @returns The upper bound in microseconds, or UINT64_MAX for the last bucket.
+     *
+     */
+    static uint64_t GetBucketUpperBound(uint8_t aBucket);
+
+    /**
+     * This method returns the histogram bucket of a duration.
+     *
+     * @param[in]   aDurationUs     The duration in microseconds.
+     *
+     * @returns The bucket index.
+     *
+     */
+    static uint8_t GetBucket(uint64_t aDurationUs);
+
+    /**
+     * This method converts a component to its name.
+     *
+     * @param[in]   aComponent      The component.
+     *
+     * @returns The component name.
+     *
+     */
+    static const char *ComponentToString(Component aComponent);
+
+    /**
+     * This method converts a phase to its name.
+     *
+     * @param[in]   aPhase      The phase.
+     *
+     * @returns The phase name.
+     *
+     */
+    static const char *PhaseToString(Phase aPhase);
+
+private:
+    MainloopStats(void);
+
+    Histogram mHistograms[kNumComponents][kNumPhases];
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MAINLOOP_STATS_HPP_
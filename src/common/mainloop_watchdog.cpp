@@ -0,0 +1,239 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the mainloop stall watchdog.
+ */
+
+#include "common/mainloop_watchdog.hpp"
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GLIBC__)
+#include <execinfo.h>
+#define OTBR_WATCHDOG_BACKTRACE 1
+#else
+#define OTBR_WATCHDOG_BACKTRACE 0
+#endif
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+// The time (in milliseconds) to wait for the mainloop thread to capture its backtrace.
+static const uint32_t kBacktraceTimeoutMs = 100;
+
+constexpr uint32_t MainloopWatchdog::kDefaultBudgetMs;
+constexpr int      MainloopWatchdog::kBacktraceSignal;
+constexpr int      MainloopWatchdog::kMaxFrames;
+
+void *           MainloopWatchdog::sFrames[kMaxFrames];
+std::atomic<int> MainloopWatchdog::sNumFrames(0);
+
+MainloopWatchdog &MainloopWatchdog::Get(void)
+{
+    static MainloopWatchdog sMainloopWatchdog;
+
+    return sMainloopWatchdog;
+}
+
+MainloopWatchdog::MainloopWatchdog(void)
+    : mStopping(false)
+    , mBudgetMs(kDefaultBudgetMs)
+    , mMainloopThread(pthread_self())
+    , mReportedActivation(0)
+    , mBusySinceUs(0)
+    , mActivation(0)
+    , mComponent(0)
+    , mPhase(0)
+    , mStallCount(0)
+{
+}
+
+int64_t MainloopWatchdog::GetNowUs(void)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+otbrError MainloopWatchdog::Start(uint32_t aBudgetMs)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(aBudgetMs > 0, error = OTBR_ERROR_INVALID_ARGS);
+    VerifyOrExit(!IsRunning(), error = OTBR_ERROR_DUPLICATED);
+
+#if OTBR_WATCHDOG_BACKTRACE
+    {
+        struct sigaction action;
+
+        // The first call of backtrace() may load libgcc, do it here instead of in the signal handler.
+        sNumFrames.store(backtrace(sFrames, kMaxFrames));
+
+        memset(&action, 0, sizeof(action));
+        action.sa_handler = HandleBacktraceSignal;
+        action.sa_flags   = SA_RESTART;
+        sigemptyset(&action.sa_mask);
+        VerifyOrExit(sigaction(kBacktraceSignal, &action, nullptr) == 0, error = OTBR_ERROR_ERRNO);
+    }
+#endif
+
+    mBudgetMs           = aBudgetMs;
+    mMainloopThread     = pthread_self();
+    mReportedActivation = mActivation.load();
+    mStopping           = false;
+    mStallCount.store(0);
+    mThread = std::thread(&MainloopWatchdog::Run, this);
+
+    otbrLog(OTBR_LOG_INFO, "Mainloop watchdog started, budget %u ms", aBudgetMs);
+
+exit:
+    return error;
+}
+
+void MainloopWatchdog::Stop(void)
+{
+    VerifyOrExit(IsRunning());
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mStopping = true;
+    }
+
+    mCondition.notify_all();
+    mThread.join();
+
+exit:
+    return;
+}
+
+void MainloopWatchdog::Enter(MainloopStats::Component aComponent, MainloopStats::Phase aPhase)
+{
+    mComponent.store(aComponent);
+    mPhase.store(aPhase);
+    mActivation.fetch_add(1);
+    mBusySinceUs.store(GetNowUs());
+}
+
+void MainloopWatchdog::Run(void)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    // Check often enough that a stall is reported at most a quarter of the budget late.
+    auto interval = std::chrono::milliseconds(mBudgetMs / 4 + 1);
+
+    while (!mStopping)
+    {
+        mCondition.wait_for(lock, interval);
+
+        if (!mStopping)
+        {
+            Check();
+        }
+    }
+}
+
+void MainloopWatchdog::Check(void)
+{
+    uint64_t activation  = mActivation.load();
+    int64_t  busySinceUs = mBusySinceUs.load();
+    int64_t  elapsedUs;
+
+    VerifyOrExit(busySinceUs != 0 && activation != mReportedActivation);
+
+    elapsedUs = GetNowUs() - busySinceUs;
+    VerifyOrExit(elapsedUs >= static_cast<int64_t>(mBudgetMs) * 1000);
+
+    mReportedActivation = activation;
+    mStallCount.fetch_add(1);
+
+    otbrLog(OTBR_LOG_WARNING, "Mainloop watchdog: %s.%s has been running for %u ms",
+            MainloopStats::ComponentToString(static_cast<MainloopStats::Component>(mComponent.load())),
+            MainloopStats::PhaseToString(static_cast<MainloopStats::Phase>(mPhase.load())),
+            static_cast<uint32_t>(elapsedUs / 1000));
+
+    LogBacktrace();
+
+exit:
+    return;
+}
+
+void MainloopWatchdog::HandleBacktraceSignal(int aSignal)
+{
+    int savedErrno = errno;
+
+    OTBR_UNUSED_VARIABLE(aSignal);
+
+#if OTBR_WATCHDOG_BACKTRACE
+    sNumFrames.store(backtrace(sFrames, kMaxFrames));
+#endif
+
+    errno = savedErrno;
+}
+
+void MainloopWatchdog::LogBacktrace(void)
+{
+#if OTBR_WATCHDOG_BACKTRACE
+    char **symbols;
+    int    numFrames;
+
+    sNumFrames.store(-1);
+    VerifyOrExit(pthread_kill(mMainloopThread, kBacktraceSignal) == 0,
+                 otbrLog(OTBR_LOG_WARNING, "Mainloop watchdog: failed to interrupt mainloop thread"));
+
+    for (uint32_t waited = 0; (numFrames = sNumFrames.load()) < 0 && waited < kBacktraceTimeoutMs; waited++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    VerifyOrExit(numFrames >= 0, otbrLog(OTBR_LOG_WARNING, "Mainloop watchdog: no backtrace from mainloop thread"));
+
+    symbols = backtrace_symbols(sFrames, numFrames);
+    VerifyOrExit(symbols != nullptr);
+
+    for (int i = 0; i < numFrames; i++)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Mainloop watchdog:   #%-2d %s", i, symbols[i]);
+    }
+
+    free(symbols);
+
+exit:
+    return;
+#else
+    otbrLog(OTBR_LOG_WARNING, "Mainloop watchdog: backtrace is not supported on this platform");
+#endif
+}
+
+} // namespace otbr
@@ -0,0 +1,160 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for the mainloop stall watchdog.
+ */
+
+#ifndef OTBR_COMMON_MAINLOOP_WATCHDOG_HPP_
+#define OTBR_COMMON_MAINLOOP_WATCHDOG_HPP_
+
+#include "openthread-br/config.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+
+#include "common/mainloop_stats.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a watchdog which detects mainloop iterations stuck in a component.
+ *
+ * The mainloop thread marks the start and the end of each component call, which `MainloopStats::Probe` does. A
+ * watchdog thread checks periodically whether the current call has been running longer than the budget. When it
+ * has, the watchdog logs the component and phase, and a backtrace of the mainloop thread if the platform supports
+ * it. Each stalled call is reported once. Waiting for events in the poller is not covered.
+ *
+ * The backtrace is captured by interrupting the mainloop thread with `kBacktraceSignal`, a blocking call other
+ * than common I/O may therefore return early with `EINTR`.
+ *
+ */
+class MainloopWatchdog
+{
+public:
+    static constexpr uint32_t kDefaultBudgetMs = 2000;    ///< The default budget of a component call.
+    static constexpr int      kBacktraceSignal = SIGUSR2; ///< The signal used to capture the backtrace.
+
+    /**
+     * This method gets the single `MainloopWatchdog` instance.
+     *
+     * @returns  The single `MainloopWatchdog` instance.
+     *
+     */
+    static MainloopWatchdog &Get(void);
+
+    /**
+     * This method starts the watchdog thread.
+     *
+     * The calling thread is watched, it MUST be the mainloop thread.
+     *
+     * @param[in]   aBudgetMs   The time in milliseconds a component call may run before it is reported.
+     *
+     * @retval  OTBR_ERROR_NONE         Successfully started the watchdog.
+     * @retval  OTBR_ERROR_INVALID_ARGS @p aBudgetMs is zero.
+     * @retval  OTBR_ERROR_DUPLICATED   The watchdog is already running.
+     *
+     */
+    otbrError Start(uint32_t aBudgetMs);
+
+    /**
+     * This method stops the watchdog thread.
+     *
+     */
+    void Stop(void);
+
+    /**
+     * This method indicates whether the watchdog is running.
+     *
+     */
+    bool IsRunning(void) const { return mThread.joinable(); }
+
+    /**
+     * This method marks the start of a component call in the mainloop thread.
+     *
+     * @param[in]   aComponent  The component.
+     * @param[in]   aPhase      The phase.
+     *
+     */
+    void Enter(MainloopStats::Component aComponent, MainloopStats::Phase aPhase);
+
+    /**
+     * This method marks the end of the current component call in the mainloop thread.
+     *
+     */
+    void Leave(void) { mBusySinceUs.store(0); }
+
+    /**
+     * This method returns the number of stalls reported since the watchdog started.
+     *
+     */
+    uint32_t GetStallCount(void) const { return mStallCount.load(); }
+
+    ~MainloopWatchdog(void) { Stop(); }
+
+private:
+    static constexpr int kMaxFrames = 32;
+
+    MainloopWatchdog(void);
+
+    static int64_t GetNowUs(void);
+    static void    HandleBacktraceSignal(int aSignal);
+
+    void Run(void);
+    void Check(void);
+    void LogBacktrace(void);
+
+    std::thread             mThread;
+    std::mutex              mMutex;
+    std::condition_variable mCondition;
+    bool                    mStopping;
+    uint32_t                mBudgetMs;
+    pthread_t               mMainloopThread;
+    uint64_t                mReportedActivation;
+
+    std::atomic<int64_t>  mBusySinceUs;
+    std::atomic<uint64_t> mActivation;
+    std::atomic<uint8_t>  mComponent;
+    std::atomic<uint8_t>  mPhase;
+    std::atomic<uint32_t> mStallCount;
+
+    static void *           sFrames[kMaxFrames];
+    static std::atomic<int> sNumFrames;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MAINLOOP_WATCHDOG_HPP_
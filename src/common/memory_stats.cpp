@@ -0,0 +1,223 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the per-subsystem heap memory statistics.
+ */
+
+#include "common/memory_stats.hpp"
+
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <new>
+
+namespace otbr {
+
+#if OTBR_ENABLE_MEMORY_STATS
+
+/**
+ * This union is the header of each allocation, its size keeps the memory after it aligned for any type.
+ *
+ */
+union AllocationHeader
+{
+    struct
+    {
+        size_t                 mSize;
+        MemoryStats::Subsystem mSubsystem;
+    } mInfo;
+    max_align_t mAlignment;
+};
+
+// Word sized atomics, 64-bit ones need libatomic on some 32-bit targets.
+static std::atomic<size_t> sCurrentBytes[MemoryStats::kNumSubsystems];
+static std::atomic<size_t> sPeakBytes[MemoryStats::kNumSubsystems];
+static std::atomic<size_t> sAllocations[MemoryStats::kNumSubsystems];
+
+static thread_local MemoryStats::Subsystem sSubsystem = MemoryStats::kSubsystemAgent;
+
+static void *Allocate(size_t aSize)
+{
+    AllocationHeader *header = static_cast<AllocationHeader *>(malloc(sizeof(AllocationHeader) + aSize));
+    size_t            current;
+    size_t            peak;
+
+    if (header != nullptr)
+    {
+        header->mInfo.mSize      = aSize;
+        header->mInfo.mSubsystem = sSubsystem;
+
+        current = sCurrentBytes[sSubsystem].fetch_add(aSize, std::memory_order_relaxed) + aSize;
+        peak    = sPeakBytes[sSubsystem].load(std::memory_order_relaxed);
+
+        while (current > peak &&
+               !sPeakBytes[sSubsystem].compare_exchange_weak(peak, current, std::memory_order_relaxed))
+        {
+        }
+
+        sAllocations[sSubsystem].fetch_add(1, std::memory_order_relaxed);
+        header++;
+    }
+
+    return header;
+}
+
+static void Free(void *aPointer)
+{
+    AllocationHeader *header = static_cast<AllocationHeader *>(aPointer);
+
+    if (header != nullptr)
+    {
+        header--;
+        sCurrentBytes[header->mInfo.mSubsystem].fetch_sub(header->mInfo.mSize, std::memory_order_relaxed);
+        free(header);
+    }
+}
+
+MemoryStats::Scope::Scope(Subsystem aSubsystem)
+    : mPrevious(sSubsystem)
+{
+    sSubsystem = aSubsystem;
+}
+
+MemoryStats::Scope::~Scope(void)
+{
+    sSubsystem = mPrevious;
+}
+
+MemoryStats::Usage MemoryStats::GetUsage(Subsystem aSubsystem)
+{
+    Usage usage;
+
+    usage.mCurrentBytes = sCurrentBytes[aSubsystem].load(std::memory_order_relaxed);
+    usage.mPeakBytes    = sPeakBytes[aSubsystem].load(std::memory_order_relaxed);
+    usage.mAllocations  = sAllocations[aSubsystem].load(std::memory_order_relaxed);
+
+    return usage;
+}
+
+#else // OTBR_ENABLE_MEMORY_STATS
+
+MemoryStats::Usage MemoryStats::GetUsage(Subsystem)
+{
+    return Usage{0, 0, 0};
+}
+
+#endif // OTBR_ENABLE_MEMORY_STATS
+
+const char *MemoryStats::SubsystemToString(Subsystem aSubsystem)
+{
+    static const char *const kSubsystemNames[] = {
+        "agent",             // kSubsystemAgent
+        "rest",              // kSubsystemRest
+        "dbus",              // kSubsystemDBus
+        "mdns",              // kSubsystemMdns
+        "advertising_proxy", // kSubsystemAdvertisingProxy
+        "nd_proxy",          // kSubsystemNdProxy
+        "logging",           // kSubsystemLogging
+    };
+
+    static_assert(sizeof(kSubsystemNames) / sizeof(kSubsystemNames[0]) == kNumSubsystems,
+                  "kSubsystemNames is not in sync with Subsystem");
+
+    return aSubsystem < kNumSubsystems ? kSubsystemNames[aSubsystem] : "unknown";
+}
+
+} // namespace otbr
+
+#if OTBR_ENABLE_MEMORY_STATS
+
+void *operator new(size_t aSize)
+{
+    void *pointer;
+
+    while ((pointer = otbr::Allocate(aSize)) == nullptr)
+    {
+        std::new_handler handler = std::get_new_handler();
+
+        if (handler == nullptr)
+        {
+            throw std::bad_alloc();
+        }
+
+        handler();
+    }
+
+    return pointer;
+}
+
+void *operator new[](size_t aSize)
+{
+    return operator new(aSize);
+}
+
+void *operator new(size_t aSize, const std::nothrow_t &) noexcept
+{
+    return otbr::Allocate(aSize);
+}
+
+void *operator new[](size_t aSize, const std::nothrow_t &) noexcept
+{
+    return otbr::Allocate(aSize);
+}
+
+void operator delete(void *aPointer) noexcept
+{
+    otbr::Free(aPointer);
+}
+
+void operator delete[](void *aPointer) noexcept
+{
+    otbr::Free(aPointer);
+}
+
+void operator delete(void *aPointer, const std::nothrow_t &) noexcept
+{
+    otbr::Free(aPointer);
+}
+
+void operator delete[](void *aPointer, const std::nothrow_t &) noexcept
+{
+    otbr::Free(aPointer);
+}
+
+// Called by code built as C++14 or later.
+void operator delete(void *aPointer, size_t) noexcept
+{
+    otbr::Free(aPointer);
+}
+
+void operator delete[](void *aPointer, size_t) noexcept
+{
+    otbr::Free(aPointer);
+}
+
+#endif // OTBR_ENABLE_MEMORY_STATS
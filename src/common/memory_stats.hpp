@@ -0,0 +1,140 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the per-subsystem heap memory statistics.
+ */
+
+#ifndef OTBR_COMMON_MEMORY_STATS_HPP_
+#define OTBR_COMMON_MEMORY_STATS_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stdint.h>
+
+#ifndef OTBR_ENABLE_MEMORY_STATS
+#define OTBR_ENABLE_MEMORY_STATS 0
+#endif
+
+namespace otbr {
+
+/**
+ * This class accounts the heap memory allocated with `operator new` to the subsystem allocating it.
+ *
+ * The global `operator new` and `operator delete` are replaced to keep the size and the subsystem of each allocation
+ * in a header before it, so memory is credited back to the subsystem which allocated it wherever it is freed. The
+ * subsystem is the one of the innermost `Scope` of the allocating thread, memory allocated outside of any scope is
+ * accounted to the agent.
+ *
+ * Memory allocated with `malloc()`, e.g. by the Avahi and libdbus C libraries, is not accounted.
+ *
+ * This is only built with `OTBR_ENABLE_MEMORY_STATS`, otherwise scopes are no-ops and the usage is always zero.
+ *
+ */
+class MemoryStats
+{
+public:
+    /**
+     * Subsystems memory is accounted to.
+     *
+     */
+    enum Subsystem : uint8_t
+    {
+        kSubsystemAgent,            ///< Everything not in another subsystem.
+        kSubsystemRest,             ///< The REST server.
+        kSubsystemDBus,             ///< The D-Bus agent.
+        kSubsystemMdns,             ///< The mDNS publisher.
+        kSubsystemAdvertisingProxy, ///< The SRP Advertising Proxy.
+        kSubsystemNdProxy,          ///< The Backbone Router ND proxy.
+        kSubsystemLogging,          ///< The logging functions.
+        kNumSubsystems,
+    };
+
+    /**
+     * This structure represents the memory usage of a subsystem.
+     *
+     */
+    struct Usage
+    {
+        uint64_t mCurrentBytes; ///< The bytes currently allocated.
+        uint64_t mPeakBytes;    ///< The maximum of the bytes allocated at once.
+        uint64_t mAllocations;  ///< The number of allocations since start.
+    };
+
+    /**
+     * This class sets the subsystem of the allocations of the current thread for the lifetime of the scope.
+     *
+     */
+    class Scope
+    {
+    public:
+#if OTBR_ENABLE_MEMORY_STATS
+        explicit Scope(Subsystem aSubsystem);
+
+        ~Scope(void);
+
+    private:
+        Subsystem mPrevious;
+#else
+        explicit Scope(Subsystem) {}
+#endif
+    };
+
+    /**
+     * This method indicates whether memory is accounted.
+     *
+     * @returns Whether the agent is built with `OTBR_ENABLE_MEMORY_STATS`.
+     *
+     */
+    static bool IsEnabled(void) { return OTBR_ENABLE_MEMORY_STATS; }
+
+    /**
+     * This method returns the memory usage of a subsystem.
+     *
+     * @param[in]   aSubsystem  The subsystem.
+     *
+     * @returns The usage of @p aSubsystem.
+     *
+     */
+    static Usage GetUsage(Subsystem aSubsystem);
+
+    /**
+     * This method returns the name of a subsystem.
+     *
+     * @param[in]   aSubsystem  The subsystem.
+     *
+     * @returns The name of @p aSubsystem, e.g. "rest".
+     *
+     */
+    static const char *SubsystemToString(Subsystem aSubsystem);
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_MEMORY_STATS_HPP_
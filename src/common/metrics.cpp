@@ -0,0 +1,420 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the agent metrics.
+ */
+
+#include "common/metrics.hpp"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/memory_stats.hpp"
+
+namespace otbr {
+
+static const Metrics::Info kCounterInfo[] = {
+    {"otbr_rest_responses_total", "class=\"2xx\"", "REST responses by status class."},
+    {"otbr_rest_responses_total", "class=\"3xx\"", nullptr},
+    {"otbr_rest_responses_total", "class=\"4xx\"", nullptr},
+    {"otbr_rest_responses_total", "class=\"5xx\"", nullptr},
+    {"otbr_dbus_method_calls_total", nullptr, "D-Bus method calls handled."},
+    {"otbr_dbus_signals_skipped_total", nullptr, "D-Bus signals not sent since no peer subscribes to them."},
+    {"otbr_mdns_publish_results_total", "result=\"success\"", "mDNS service and host publish results."},
+    {"otbr_mdns_publish_results_total", "result=\"failure\"", nullptr},
+    {"otbr_mdns_name_conflicts_total", nullptr, "mDNS name conflicts, including renames by the mDNS daemon."},
+    {"otbr_mdns_publish_retries_total", nullptr, "mDNS services and hosts published again before their result."},
+    {"otbr_nd_proxy_ns_received_total", "type=\"multicast\"", "Neighbor Solicitations received by the ND proxy."},
+    {"otbr_nd_proxy_ns_received_total", "type=\"unicast\"", nullptr},
+    {"otbr_nd_proxy_ns_matched_total", nullptr, "Neighbor Solicitations whose target is a proxied DUA."},
+    {"otbr_nd_proxy_na_sent_total", "result=\"success\"", "Neighbor Advertisements sent by the ND proxy."},
+    {"otbr_nd_proxy_na_sent_total", "result=\"failure\"", nullptr},
+    {"otbr_nd_proxy_verdicts_total", "verdict=\"accept\"", "Verdicts on unicast Neighbor Solicitations."},
+    {"otbr_nd_proxy_verdicts_total", "verdict=\"drop\"", nullptr},
+    {"otbr_nd_proxy_socket_errors_total", nullptr, "Socket errors of the ND proxy."},
+    {"otbr_backbone_dua_events_total", "event=\"added\"", "DUA events from the Backbone Router."},
+    {"otbr_backbone_dua_events_total", "event=\"removed\"", nullptr},
+    {"otbr_srp_updates_total", nullptr, "SRP updates received by the advertising proxy."},
+    {"otbr_srp_update_results_total", "result=\"success\"", "SRP update advertising results."},
+    {"otbr_srp_update_results_total", "result=\"failure\"", nullptr},
+    {"otbr_srp_update_results_total", "result=\"timeout\"", nullptr},
+};
+
+static const Metrics::Info kGaugeInfo[] = {
+    {"otbr_mdns_outstanding_publications", nullptr, "mDNS services and hosts waiting for their publish result."},
+};
+
+static const Metrics::Info kHistogramInfo[] = {
+    {"otbr_rest_request_duration_microseconds", nullptr,
+     "Time from a REST request being handled to its response being ready."},
+    {"otbr_mdns_publish_duration_milliseconds", nullptr,
+     "Time from an mDNS service or host publish request to its result."},
+    {"otbr_nd_proxy_process_duration_microseconds", nullptr,
+     "Time to process the Neighbor Solicitations read by one ND proxy socket event."},
+};
+
+static_assert(sizeof(kCounterInfo) / sizeof(kCounterInfo[0]) == Metrics::kNumCounters,
+              "kCounterInfo is not in sync with Counter");
+static_assert(sizeof(kGaugeInfo) / sizeof(kGaugeInfo[0]) == Metrics::kNumGauges,
+              "kGaugeInfo is not in sync with Gauge");
+static_assert(sizeof(kHistogramInfo) / sizeof(kHistogramInfo[0]) == Metrics::kNumHistograms,
+              "kHistogramInfo is not in sync with Histogram");
+
+Metrics &Metrics::Get(void)
+{
+    static Metrics sMetrics;
+
+    return sMetrics;
+}
+
+Metrics::Metrics(void)
+{
+    Clear();
+}
+
+void Metrics::Clear(void)
+{
+    for (std::atomic<uint64_t> &counter : mCounters)
+    {
+        counter.store(0, std::memory_order_relaxed);
+    }
+
+    for (std::atomic<uint64_t> &gauge : mGauges)
+    {
+        gauge.store(0, std::memory_order_relaxed);
+    }
+
+    for (AtomicHistogram &histogram : mHistograms)
+    {
+        histogram.mCount.store(0, std::memory_order_relaxed);
+        histogram.mTotal.store(0, std::memory_order_relaxed);
+        histogram.mMax.store(0, std::memory_order_relaxed);
+
+        for (std::atomic<uint64_t> &bucket : histogram.mBuckets)
+        {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+}
+
+void Metrics::Record(Histogram aHistogram, uint64_t aValue)
+{
+    AtomicHistogram &histogram = mHistograms[aHistogram];
+    uint64_t         max       = histogram.mMax.load(std::memory_order_relaxed);
+
+    histogram.mCount.fetch_add(1, std::memory_order_relaxed);
+    histogram.mTotal.fetch_add(aValue, std::memory_order_relaxed);
+    histogram.mBuckets[MainloopStats::GetBucket(aValue)].fetch_add(1, std::memory_order_relaxed);
+
+    // A failed exchange reloads `max`, so the loop ends once the stored maximum is at least `aValue`.
+    while (aValue > max && !histogram.mMax.compare_exchange_weak(max, aValue, std::memory_order_relaxed))
+    {
+    }
+}
+
+MainloopStats::Histogram Metrics::GetHistogram(Histogram aHistogram) const
+{
+    const AtomicHistogram &  histogram = mHistograms[aHistogram];
+    MainloopStats::Histogram copy      = {};
+
+    copy.mCount   = histogram.mCount.load(std::memory_order_relaxed);
+    copy.mTotalUs = histogram.mTotal.load(std::memory_order_relaxed);
+    copy.mMaxUs   = histogram.mMax.load(std::memory_order_relaxed);
+
+    for (uint8_t i = 0; i < MainloopStats::kNumBuckets; i++)
+    {
+        copy.mBuckets[i] = histogram.mBuckets[i].load(std::memory_order_relaxed);
+    }
+
+    return copy;
+}
+
+void Metrics::RecordRestResponse(uint8_t aStatusClass, uint64_t aDurationUs)
+{
+    VerifyOrExit(aStatusClass >= 2 && aStatusClass <= 5);
+
+    Increment(static_cast<Counter>(kCounterRestResponses2xx + aStatusClass - 2));
+    Record(kHistogramRestRequest, aDurationUs);
+
+exit:
+    return;
+}
+
+void Metrics::GetSnapshot(Snapshot &aSnapshot) const
+{
+    for (uint8_t i = 0; i < kNumCounters; i++)
+    {
+        aSnapshot.mCounters[i] = GetCounter(static_cast<Counter>(i));
+    }
+
+    for (uint8_t i = 0; i < kNumGauges; i++)
+    {
+        aSnapshot.mGauges[i] = GetGauge(static_cast<Gauge>(i));
+    }
+
+    for (uint8_t i = 0; i < kNumHistograms; i++)
+    {
+        aSnapshot.mHistograms[i] = GetHistogram(static_cast<Histogram>(i));
+    }
+}
+
+void Metrics::GetSamples(const Snapshot &aSnapshot, std::vector<Sample> &aSamples)
+{
+    aSamples.clear();
+
+    for (uint8_t i = 0; i < kNumCounters; i++)
+    {
+        aSamples.push_back({kCounterInfo[i].mName, kCounterInfo[i].mLabels, aSnapshot.mCounters[i]});
+    }
+
+    for (uint8_t i = 0; i < kNumGauges; i++)
+    {
+        aSamples.push_back({kGaugeInfo[i].mName, kGaugeInfo[i].mLabels, aSnapshot.mGauges[i]});
+    }
+
+    for (uint8_t i = 0; i < kNumHistograms; i++)
+    {
+        const Info &                    info      = kHistogramInfo[i];
+        const MainloopStats::Histogram &histogram = aSnapshot.mHistograms[i];
+
+        aSamples.push_back({std::string(info.mName) + "_count", info.mLabels, histogram.mCount});
+        aSamples.push_back({std::string(info.mName) + "_sum", info.mLabels, histogram.mTotalUs});
+        aSamples.push_back({std::string(info.mName) + "_max", info.mLabels, histogram.mMaxUs});
+    }
+}
+
+const Metrics::Info &Metrics::GetInfo(Counter aCounter)
+{
+    return kCounterInfo[aCounter];
+}
+
+const Metrics::Info &Metrics::GetInfo(Gauge aGauge)
+{
+    return kGaugeInfo[aGauge];
+}
+
+const Metrics::Info &Metrics::GetInfo(Histogram aHistogram)
+{
+    return kHistogramInfo[aHistogram];
+}
+
+void Metrics::Write(std::string &aOutput) const
+{
+    const MainloopStats &stats = MainloopStats::Get();
+    Snapshot             snapshot;
+    char                 labels[sizeof("component=\"agent\",phase=\"UpdateFdSet\"")];
+
+    GetSnapshot(snapshot);
+
+    for (uint8_t i = 0; i < kNumCounters; i++)
+    {
+        if (kCounterInfo[i].mHelp != nullptr)
+        {
+            WriteFamily(aOutput, kCounterInfo[i].mName, "counter", kCounterInfo[i].mHelp);
+        }
+
+        WriteSample(aOutput, kCounterInfo[i].mName, kCounterInfo[i].mLabels, snapshot.mCounters[i]);
+    }
+
+    for (uint8_t i = 0; i < kNumGauges; i++)
+    {
+        if (kGaugeInfo[i].mHelp != nullptr)
+        {
+            WriteFamily(aOutput, kGaugeInfo[i].mName, "gauge", kGaugeInfo[i].mHelp);
+        }
+
+        WriteSample(aOutput, kGaugeInfo[i].mName, kGaugeInfo[i].mLabels, snapshot.mGauges[i]);
+    }
+
+    for (uint8_t i = 0; i < kNumHistograms; i++)
+    {
+        if (kHistogramInfo[i].mHelp != nullptr)
+        {
+            WriteFamily(aOutput, kHistogramInfo[i].mName, "histogram", kHistogramInfo[i].mHelp);
+        }
+
+        WriteHistogram(aOutput, kHistogramInfo[i].mName, kHistogramInfo[i].mLabels, snapshot.mHistograms[i]);
+    }
+
+    WriteFamily(aOutput, "otbr_mainloop_duration_microseconds", "histogram",
+                "Duration of the mainloop calls of each component.");
+
+    for (uint8_t component = 0; component < MainloopStats::kNumComponents; component++)
+    {
+        for (uint8_t phase = 0; phase < MainloopStats::kNumPhases; phase++)
+        {
+            snprintf(labels, sizeof(labels), "component=\"%s\",phase=\"%s\"",
+                     MainloopStats::ComponentToString(static_cast<MainloopStats::Component>(component)),
+                     MainloopStats::PhaseToString(static_cast<MainloopStats::Phase>(phase)));
+            WriteHistogram(aOutput, "otbr_mainloop_duration_microseconds", labels,
+                           stats.GetHistogram(static_cast<MainloopStats::Component>(component),
+                                              static_cast<MainloopStats::Phase>(phase)));
+        }
+    }
+
+    WriteFamily(aOutput, "otbr_mainloop_stalls_total", "counter", "Mainloop calls which stalled the mainloop.");
+
+    for (uint8_t component = 0; component < MainloopStats::kNumComponents; component++)
+    {
+        for (uint8_t phase = 0; phase < MainloopStats::kNumPhases; phase++)
+        {
+            snprintf(labels, sizeof(labels), "component=\"%s\",phase=\"%s\"",
+                     MainloopStats::ComponentToString(static_cast<MainloopStats::Component>(component)),
+                     MainloopStats::PhaseToString(static_cast<MainloopStats::Phase>(phase)));
+            WriteSample(aOutput, "otbr_mainloop_stalls_total", labels,
+                        stats.GetHistogram(static_cast<MainloopStats::Component>(component),
+                                           static_cast<MainloopStats::Phase>(phase))
+                            .mStallCount);
+        }
+    }
+
+    WriteFamily(aOutput, "otbr_log_dropped_total", "counter", "Log lines dropped because the log queue was full.");
+    WriteSample(aOutput, "otbr_log_dropped_total", nullptr, otbrLogGetDroppedCount());
+
+    WriteFamily(aOutput, "otbr_log_suppressed_total", "counter", "Log lines suppressed by the rate limit.");
+    WriteSample(aOutput, "otbr_log_suppressed_total", nullptr, otbrLogGetSuppressedCount());
+
+    if (MemoryStats::IsEnabled())
+    {
+        WriteMemoryStats(aOutput);
+    }
+}
+
+void Metrics::WriteMemoryStats(std::string &aOutput)
+{
+    char labels[sizeof("subsystem=\"advertising_proxy\"")];
+
+    WriteFamily(aOutput, "otbr_memory_bytes", "gauge", "Heap memory allocated by each subsystem.");
+
+    for (uint8_t i = 0; i < MemoryStats::kNumSubsystems; i++)
+    {
+        auto subsystem = static_cast<MemoryStats::Subsystem>(i);
+
+        snprintf(labels, sizeof(labels), "subsystem=\"%s\"", MemoryStats::SubsystemToString(subsystem));
+        WriteSample(aOutput, "otbr_memory_bytes", labels, MemoryStats::GetUsage(subsystem).mCurrentBytes);
+    }
+
+    WriteFamily(aOutput, "otbr_memory_peak_bytes", "gauge", "Maximum heap memory allocated by each subsystem.");
+
+    for (uint8_t i = 0; i < MemoryStats::kNumSubsystems; i++)
+    {
+        auto subsystem = static_cast<MemoryStats::Subsystem>(i);
+
+        snprintf(labels, sizeof(labels), "subsystem=\"%s\"", MemoryStats::SubsystemToString(subsystem));
+        WriteSample(aOutput, "otbr_memory_peak_bytes", labels, MemoryStats::GetUsage(subsystem).mPeakBytes);
+    }
+
+    WriteFamily(aOutput, "otbr_memory_allocations_total", "counter", "Heap allocations made by each subsystem.");
+
+    for (uint8_t i = 0; i < MemoryStats::kNumSubsystems; i++)
+    {
+        auto subsystem = static_cast<MemoryStats::Subsystem>(i);
+
+        snprintf(labels, sizeof(labels), "subsystem=\"%s\"", MemoryStats::SubsystemToString(subsystem));
+        WriteSample(aOutput, "otbr_memory_allocations_total", labels, MemoryStats::GetUsage(subsystem).mAllocations);
+    }
+}
+
+void Metrics::WriteFamily(std::string &aOutput, const char *aName, const char *aType, const char *aHelp)
+{
+    aOutput += "# HELP ";
+    aOutput += aName;
+    aOutput += ' ';
+    aOutput += aHelp;
+    aOutput += "\n# TYPE ";
+    aOutput += aName;
+    aOutput += ' ';
+    aOutput += aType;
+    aOutput += '\n';
+}
+
+void Metrics::WriteSample(std::string &aOutput, const char *aName, const char *aLabels, uint64_t aValue)
+{
+    char value[sizeof(" 18446744073709551615\n")];
+
+    aOutput += aName;
+
+    if (aLabels != nullptr && aLabels[0] != '\0')
+    {
+        aOutput += '{';
+        aOutput += aLabels;
+        aOutput += '}';
+    }
+
+    snprintf(value, sizeof(value), " %" PRIu64 "\n", aValue);
+    aOutput += value;
+}
+
+void Metrics::WriteHistogram(std::string &                   aOutput,
+                             const char *                    aName,
+                             const char *                    aLabels,
+                             const MainloopStats::Histogram &aHistogram)
+{
+    std::string bucketName = std::string(aName) + "_bucket";
+    std::string labels;
+    size_t      labelsLength;
+    uint64_t    count = 0;
+
+    if (aLabels != nullptr && aLabels[0] != '\0')
+    {
+        labels = aLabels;
+        labels += ',';
+    }
+
+    labelsLength = labels.size();
+
+    for (uint8_t i = 0; i < MainloopStats::kNumBuckets; i++)
+    {
+        char bound[sizeof("le=\"18446744073709551615\"")];
+
+        // Buckets hold integral durations below their upper bound, i.e. at most the bound minus one.
+        if (i < MainloopStats::kNumBuckets - 1)
+        {
+            snprintf(bound, sizeof(bound), "le=\"%" PRIu64 "\"", MainloopStats::GetBucketUpperBound(i) - 1);
+        }
+        else
+        {
+            snprintf(bound, sizeof(bound), "le=\"+Inf\"");
+        }
+
+        count += aHistogram.mBuckets[i];
+        labels.resize(labelsLength);
+        labels += bound;
+        WriteSample(aOutput, bucketName.c_str(), labels.c_str(), count);
+    }
+
+    WriteSample(aOutput, (std::string(aName) + "_sum").c_str(), aLabels, aHistogram.mTotalUs);
+    WriteSample(aOutput, (std::string(aName) + "_count").c_str(), aLabels, aHistogram.mCount);
+}
+
+} // namespace otbr
@@ -0,0 +1,366 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for the agent metrics exported in text exposition format.
+ */
+
+#ifndef OTBR_COMMON_METRICS_HPP_
+#define OTBR_COMMON_METRICS_HPP_
+
+#include "openthread-br/config.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include "common/mainloop_stats.hpp"
+
+namespace otbr {
+
+/**
+ * This class is the registry of the agent counters, gauges and histograms.
+ *
+ * Every metric is registered under a static name and labels, see the info tables in metrics.cpp, so subsystems
+ * only refer to it by its enumerator. Values are kept in relaxed atomics: updating a counter is a single atomic
+ * add, and a metric can be updated from any thread without a lock.
+ *
+ * The REST `/metrics` resource, the D-Bus `Metrics` property and the ubus `metrics` method are all fed from the
+ * same `Snapshot`. The text output follows the Prometheus exposition format: every metric family is preceded by
+ * its `# HELP` and `# TYPE` lines, and histograms are written with cumulative `_bucket`, `_sum` and `_count`
+ * samples.
+ *
+ */
+class Metrics
+{
+public:
+    /**
+     * Agent counters.
+     *
+     * Counters of the same metric family are kept next to each other, see `kCounterInfo` in metrics.cpp.
+     *
+     */
+    enum Counter : uint8_t
+    {
+        kCounterRestResponses2xx,   ///< REST responses with a 2xx status.
+        kCounterRestResponses3xx,   ///< REST responses with a 3xx status.
+        kCounterRestResponses4xx,   ///< REST responses with a 4xx status.
+        kCounterRestResponses5xx,   ///< REST responses with a 5xx status.
+        kCounterDBusMethodCalls,    ///< D-Bus method calls handled.
+        kCounterDBusSignalsSkipped, ///< D-Bus signals not sent since no peer subscribes to them.
+        kCounterMdnsPublishSuccess, ///< mDNS services and hosts published.
+        kCounterMdnsPublishFailure, ///< mDNS services and hosts failed to publish.
+        kCounterMdnsNameConflicts,  ///< mDNS name conflicts, including renames by the mDNS daemon.
+        kCounterMdnsPublishRetries, ///< mDNS services and hosts published again while still being published.
+        kCounterNdProxyNsMulticast, ///< Multicast Neighbor Solicitations received by the ND proxy.
+        kCounterNdProxyNsUnicast,   ///< Unicast Neighbor Solicitations received by the ND proxy.
+        kCounterNdProxyNsMatched,   ///< Neighbor Solicitations whose target is a proxied DUA.
+        kCounterNdProxyNaSent,      ///< Neighbor Advertisements sent by the ND proxy.
+        kCounterNdProxyNaFailed,    ///< Neighbor Advertisements the ND proxy failed to send.
+        kCounterNdProxyAccepted,    ///< Unicast Neighbor Solicitations accepted back to the kernel.
+        kCounterNdProxyDropped,     ///< Unicast Neighbor Solicitations dropped after being answered.
+        kCounterNdProxyErrors,      ///< Socket errors of the ND proxy.
+        kCounterDuaAdded,           ///< DUAs added to the ND proxy by the Backbone Router.
+        kCounterDuaRemoved,         ///< DUAs removed from the ND proxy by the Backbone Router.
+        kCounterSrpUpdates,         ///< SRP updates received by the advertising proxy.
+        kCounterSrpUpdateSuccess,   ///< SRP updates advertised successfully.
+        kCounterSrpUpdateFailure,   ///< SRP updates failed to be advertised.
+        kCounterSrpUpdateTimeout,   ///< SRP updates timed out while being advertised.
+        kNumCounters,
+    };
+
+    /**
+     * Agent gauges.
+     *
+     */
+    enum Gauge : uint8_t
+    {
+        kGaugeMdnsOutstanding, ///< mDNS publications waiting for their result.
+        kNumGauges,
+    };
+
+    /**
+     * Agent histograms.
+     *
+     * All histograms share the buckets of `MainloopStats`.
+     *
+     */
+    enum Histogram : uint8_t
+    {
+        kHistogramRestRequest,    ///< Time to handle a REST request, in microseconds.
+        kHistogramMdnsPublish,    ///< Time to publish an mDNS service or host, in milliseconds.
+        kHistogramNdProxyProcess, ///< Time to process the ND proxy socket events, in microseconds.
+        kNumHistograms,
+    };
+
+    /**
+     * This structure represents the static registration of a metric.
+     *
+     */
+    struct Info
+    {
+        const char *mName;   ///< The metric family name.
+        const char *mLabels; ///< The labels without braces, or nullptr.
+        const char *mHelp;   ///< The description of the family, nullptr if the previous entry has the same family.
+    };
+
+    /**
+     * This structure represents a copy of all the metrics at one point in time.
+     *
+     */
+    struct Snapshot
+    {
+        uint64_t                 mCounters[kNumCounters];     ///< The counter values.
+        uint64_t                 mGauges[kNumGauges];         ///< The gauge values.
+        MainloopStats::Histogram mHistograms[kNumHistograms]; ///< The histograms.
+    };
+
+    /**
+     * This structure represents a single named value of a snapshot.
+     *
+     */
+    struct Sample
+    {
+        std::string mName;   ///< The metric name, e.g. "otbr_srp_updates_total".
+        const char *mLabels; ///< The labels without braces, or nullptr.
+        uint64_t    mValue;  ///< The value.
+    };
+
+    /**
+     * This method gets the single `Metrics` instance.
+     *
+     * @returns  The single `Metrics` instance.
+     *
+     */
+    static Metrics &Get(void);
+
+    /**
+     * This method increments a counter.
+     *
+     * @param[in]   aCounter    The counter.
+     *
+     */
+    void Increment(Counter aCounter) { Add(aCounter, 1); }
+
+    /**
+     * This method adds to a counter.
+     *
+     * @param[in]   aCounter    The counter.
+     * @param[in]   aValue      The value to add.
+     *
+     */
+    void Add(Counter aCounter, uint64_t aValue) { mCounters[aCounter].fetch_add(aValue, std::memory_order_relaxed); }
+
+    /**
+     * This method returns the value of a counter.
+     *
+     * @param[in]   aCounter    The counter.
+     *
+     * @returns The counter value.
+     *
+     */
+    uint64_t GetCounter(Counter aCounter) const { return mCounters[aCounter].load(std::memory_order_relaxed); }
+
+    /**
+     * This method sets a gauge.
+     *
+     * @param[in]   aGauge  The gauge.
+     * @param[in]   aValue  The value.
+     *
+     */
+    void SetGauge(Gauge aGauge, uint64_t aValue) { mGauges[aGauge].store(aValue, std::memory_order_relaxed); }
+
+    /**
+     * This method returns the value of a gauge.
+     *
+     * @param[in]   aGauge  The gauge.
+     *
+     * @returns The gauge value.
+     *
+     */
+    uint64_t GetGauge(Gauge aGauge) const { return mGauges[aGauge].load(std::memory_order_relaxed); }
+
+    /**
+     * This method adds a sample to a histogram.
+     *
+     * @param[in]   aHistogram  The histogram.
+     * @param[in]   aValue      The sample, in the unit of the histogram.
+     *
+     */
+    void Record(Histogram aHistogram, uint64_t aValue);
+
+    /**
+     * This method returns a copy of a histogram.
+     *
+     * @param[in]   aHistogram  The histogram.
+     *
+     * @returns The histogram, with the same buckets as `MainloopStats`.
+     *
+     */
+    MainloopStats::Histogram GetHistogram(Histogram aHistogram) const;
+
+    /**
+     * This method records a REST response.
+     *
+     * @param[in]   aStatusClass    The first digit of the HTTP status code, responses outside 2xx to 5xx are not
+     *                              counted.
+     * @param[in]   aDurationUs     The time from the request being handled to the response being ready, in
+     *                              microseconds.
+     *
+     */
+    void RecordRestResponse(uint8_t aStatusClass, uint64_t aDurationUs);
+
+    /**
+     * This method clears all metrics.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method copies all metrics.
+     *
+     * Each value is read atomically, but the snapshot as a whole is not: metrics updated while it is taken may be
+     * seen by some values and not others.
+     *
+     * @param[out]  aSnapshot   The snapshot.
+     *
+     */
+    void GetSnapshot(Snapshot &aSnapshot) const;
+
+    /**
+     * This method flattens a snapshot into named values.
+     *
+     * Counters and gauges give one sample each, histograms give their `_count`, `_sum` and `_max` samples. This is
+     * the form exported by the D-Bus and ubus interfaces.
+     *
+     * @param[in]   aSnapshot   The snapshot.
+     * @param[out]  aSamples    The samples.
+     *
+     */
+    static void GetSamples(const Snapshot &aSnapshot, std::vector<Sample> &aSamples);
+
+    /**
+     * This method returns the registration of a counter.
+     *
+     * @param[in]   aCounter    The counter.
+     *
+     * @returns The name, labels and description of the counter.
+     *
+     */
+    static const Info &GetInfo(Counter aCounter);
+
+    /**
+     * This method returns the registration of a gauge.
+     *
+     * @param[in]   aGauge  The gauge.
+     *
+     * @returns The name, labels and description of the gauge.
+     *
+     */
+    static const Info &GetInfo(Gauge aGauge);
+
+    /**
+     * This method returns the registration of a histogram.
+     *
+     * @param[in]   aHistogram  The histogram.
+     *
+     * @returns The name, labels and description of the histogram.
+     *
+     */
+    static const Info &GetInfo(Histogram aHistogram);
+
+    /**
+     * This method appends the agent metrics and the mainloop latency histograms to a string.
+     *
+     * @param[inout]    aOutput     The string to append to.
+     *
+     */
+    void Write(std::string &aOutput) const;
+
+    /**
+     * This method appends the `# HELP` and `# TYPE` lines of a metric family to a string.
+     *
+     * @param[inout]    aOutput     The string to append to.
+     * @param[in]       aName       The metric family name.
+     * @param[in]       aType       The metric type, e.g. "counter" or "gauge".
+     * @param[in]       aHelp       The description of the metric family.
+     *
+     */
+    static void WriteFamily(std::string &aOutput, const char *aName, const char *aType, const char *aHelp);
+
+    /**
+     * This method appends a sample to a string.
+     *
+     * @param[inout]    aOutput     The string to append to.
+     * @param[in]       aName       The metric name.
+     * @param[in]       aLabels     The labels without braces, e.g. `type="ns"`, or nullptr.
+     * @param[in]       aValue      The sample value.
+     *
+     */
+    static void WriteSample(std::string &aOutput, const char *aName, const char *aLabels, uint64_t aValue);
+
+    /**
+     * This method appends the samples of a histogram to a string.
+     *
+     * Bucket bounds are those of `MainloopStats::GetBucketUpperBound()`, the last bucket is written as `+Inf`.
+     *
+     * @param[inout]    aOutput     The string to append to.
+     * @param[in]       aName       The metric family name.
+     * @param[in]       aLabels     The labels without braces, or nullptr.
+     * @param[in]       aHistogram  The histogram.
+     *
+     */
+    static void WriteHistogram(std::string &                   aOutput,
+                               const char *                    aName,
+                               const char *                    aLabels,
+                               const MainloopStats::Histogram &aHistogram);
+
+private:
+    struct AtomicHistogram
+    {
+        std::atomic<uint64_t> mCount;
+        std::atomic<uint64_t> mTotal;
+        std::atomic<uint64_t> mMax;
+        std::atomic<uint64_t> mBuckets[MainloopStats::kNumBuckets];
+    };
+
+    Metrics(void);
+
+    static void WriteMemoryStats(std::string &aOutput);
+
+    std::atomic<uint64_t> mCounters[kNumCounters];
+    std::atomic<uint64_t> mGauges[kNumGauges];
+    AtomicHistogram       mHistograms[kNumHistograms];
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_METRICS_HPP_
@@ -0,0 +1,121 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the agent startup timeline.
+ */
+
+#include "common/startup_timeline.hpp"
+
+#include "common/logging.hpp"
+
+namespace otbr {
+
+StartupTimeline &StartupTimeline::Get(void)
+{
+    static StartupTimeline sStartupTimeline;
+
+    return sStartupTimeline;
+}
+
+StartupTimeline::StartupTimeline(void)
+    : mStart(Clock::now())
+    , mTimeToAttachMs(-1)
+{
+}
+
+void StartupTimeline::Start(void)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    mStart = Clock::now();
+    mPhases.clear();
+    mTimeToAttachMs = -1;
+}
+
+uint32_t StartupTimeline::ToOffsetMs(Clock::time_point aTimePoint) const
+{
+    return aTimePoint > mStart ? static_cast<uint32_t>(
+                                     std::chrono::duration_cast<std::chrono::milliseconds>(aTimePoint - mStart).count())
+                               : 0;
+}
+
+void StartupTimeline::Record(const char *aName, Clock::time_point aStart, Clock::time_point aEnd)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    PhaseRecord                 record;
+
+    record.mName       = aName;
+    record.mStartMs    = ToOffsetMs(aStart);
+    record.mDurationMs = ToOffsetMs(aEnd) - record.mStartMs;
+    mPhases.push_back(record);
+
+    otbrLog(OTBR_LOG_DEBUG, "Startup phase %s took %u ms", aName, record.mDurationMs);
+}
+
+void StartupTimeline::MarkAttached(void)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    if (mTimeToAttachMs < 0)
+    {
+        mTimeToAttachMs = ToOffsetMs(Clock::now());
+        otbrLog(OTBR_LOG_INFO, "Startup: attached to Thread network %lld ms after start",
+                static_cast<long long>(mTimeToAttachMs));
+    }
+}
+
+std::vector<StartupTimeline::PhaseRecord> StartupTimeline::GetPhases(void) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mPhases;
+}
+
+int64_t StartupTimeline::GetTimeToAttachMs(void) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    return mTimeToAttachMs;
+}
+
+void StartupTimeline::Report(void) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (const PhaseRecord &phase : mPhases)
+    {
+        otbrLog(OTBR_LOG_INFO, "Startup phase %-16s start %6u ms, took %6u ms", phase.mName, phase.mStartMs,
+                phase.mDurationMs);
+    }
+
+    otbrLog(OTBR_LOG_INFO, "Startup completed in %u ms", ToOffsetMs(Clock::now()));
+}
+
+} // namespace otbr
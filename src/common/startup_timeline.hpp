@@ -0,0 +1,165 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for the agent startup timeline.
+ */
+
+#ifndef OTBR_COMMON_STARTUP_TIMELINE_HPP_
+#define OTBR_COMMON_STARTUP_TIMELINE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#include <stdint.h>
+
+namespace otbr {
+
+/**
+ * This class records how long each startup phase of the agent takes.
+ *
+ * Phases may run concurrently, each phase is recorded with its offset from the start of the process. The time to
+ * the first attach to a Thread network is recorded separately as it usually happens after all phases completed.
+ *
+ */
+class StartupTimeline
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    /**
+     * This structure represents a completed startup phase.
+     *
+     */
+    struct PhaseRecord
+    {
+        const char *mName;       ///< The phase name.
+        uint32_t    mStartMs;    ///< The start of the phase in milliseconds since the start.
+        uint32_t    mDurationMs; ///< The duration of the phase in milliseconds.
+    };
+
+    /**
+     * This class measures the duration of a scope and records it as a phase when destroyed.
+     *
+     */
+    class Phase
+    {
+    public:
+        /**
+         * The constructor starts the measurement.
+         *
+         * @param[in]   aName   The phase name, which MUST outlive the timeline.
+         *
+         */
+        explicit Phase(const char *aName)
+            : mName(aName)
+            , mStart(Clock::now())
+        {
+        }
+
+        /**
+         * The destructor records the phase.
+         *
+         */
+        ~Phase(void) { StartupTimeline::Get().Record(mName, mStart, Clock::now()); }
+
+    private:
+        const char *      mName;
+        Clock::time_point mStart;
+    };
+
+    /**
+     * This method gets the single `StartupTimeline` instance.
+     *
+     * @returns  The single `StartupTimeline` instance.
+     *
+     */
+    static StartupTimeline &Get(void);
+
+    /**
+     * This method marks the start of the process and clears recorded phases.
+     *
+     */
+    void Start(void);
+
+    /**
+     * This method records a completed phase. This method is thread-safe.
+     *
+     * @param[in]   aName   The phase name, which MUST outlive the timeline.
+     * @param[in]   aStart  The start of the phase.
+     * @param[in]   aEnd    The end of the phase.
+     *
+     */
+    void Record(const char *aName, Clock::time_point aStart, Clock::time_point aEnd);
+
+    /**
+     * This method records the first attach to a Thread network.
+     *
+     * Only the first call after `Start()` has an effect, which logs the time to first attach.
+     *
+     */
+    void MarkAttached(void);
+
+    /**
+     * This method returns the recorded phases in the order they completed.
+     *
+     */
+    std::vector<PhaseRecord> GetPhases(void) const;
+
+    /**
+     * This method returns the time from the start to the first attach.
+     *
+     * @returns The time in milliseconds, or -1 if not attached yet.
+     *
+     */
+    int64_t GetTimeToAttachMs(void) const;
+
+    /**
+     * This method logs all recorded phases and the time since the start.
+     *
+     */
+    void Report(void) const;
+
+private:
+    StartupTimeline(void);
+
+    uint32_t ToOffsetMs(Clock::time_point aTimePoint) const;
+
+    mutable std::mutex       mMutex;
+    Clock::time_point        mStart;
+    std::vector<PhaseRecord> mPhases;
+    int64_t                  mTimeToAttachMs;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_STARTUP_TIMELINE_HPP_
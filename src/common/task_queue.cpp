@@ -0,0 +1,220 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the mainloop task queue.
+ */
+
+#include "common/task_queue.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+
+#if __linux__
+#include <sys/eventfd.h>
+#endif
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/mainloop_poller.hpp"
+
+namespace otbr {
+
+TaskQueue::TaskQueue(void)
+    : mEventFd(-1)
+    , mPipeWriteFd(-1)
+    , mHead(&mStub)
+    , mTail(&mStub)
+{
+    mStub.mNext.store(nullptr, std::memory_order_relaxed);
+}
+
+TaskQueue::~TaskQueue(void)
+{
+    Node *node;
+
+    while ((node = Pop()) != nullptr)
+    {
+        delete node;
+    }
+
+    if (mEventFd >= 0)
+    {
+        MainloopPoller::Get().Unregister(mEventFd);
+        close(mEventFd);
+    }
+
+    if (mPipeWriteFd >= 0)
+    {
+        close(mPipeWriteFd);
+    }
+}
+
+otbrError TaskQueue::Init(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+#if __linux__
+    mEventFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    VerifyOrExit(mEventFd >= 0, error = OTBR_ERROR_ERRNO);
+#else
+    {
+        int fds[2];
+
+        VerifyOrExit(pipe(fds) == 0, error = OTBR_ERROR_ERRNO);
+        mEventFd     = fds[0];
+        mPipeWriteFd = fds[1];
+
+        for (int fd : fds)
+        {
+            fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+            fcntl(fd, F_SETFD, FD_CLOEXEC);
+        }
+    }
+#endif
+
+    SuccessOrExit(error = MainloopPoller::Get().Register(mEventFd, MainloopPoller::kEventRead));
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_ERR, "TaskQueue: failed to initialize: %s", strerror(errno));
+    }
+
+    return error;
+}
+
+void TaskQueue::Post(Task aTask)
+{
+    Node *node = new Node;
+
+    node->mTask = std::move(aTask);
+    Push(node);
+    Wakeup();
+}
+
+void TaskQueue::Process(void)
+{
+    Node *last;
+    Node *node;
+
+    VerifyOrExit(MainloopPoller::Get().IsReadable(mEventFd));
+    ClearWakeup();
+
+    // Only run tasks posted before this point, tasks posted by the tasks run in the next iteration. A task being
+    // pushed concurrently may not be visible yet, its producer wakes up the mainloop again once the push completed.
+    last = mHead.load(std::memory_order_acquire);
+    VerifyOrExit(last != &mStub);
+
+    while ((node = Pop()) != nullptr)
+    {
+        bool isLast = (node == last);
+
+        node->mTask();
+        delete node;
+
+        if (isLast)
+        {
+            break;
+        }
+    }
+
+exit:
+    return;
+}
+
+void TaskQueue::Push(Node *aNode)
+{
+    Node *prev;
+
+    aNode->mNext.store(nullptr, std::memory_order_relaxed);
+    prev = mHead.exchange(aNode, std::memory_order_acq_rel);
+    prev->mNext.store(aNode, std::memory_order_release);
+}
+
+TaskQueue::Node *TaskQueue::Pop(void)
+{
+    Node *tail = mTail;
+    Node *next = tail->mNext.load(std::memory_order_acquire);
+    Node *node = nullptr;
+
+    if (tail == &mStub)
+    {
+        VerifyOrExit(next != nullptr);
+        mTail = next;
+        tail  = next;
+        next  = next->mNext.load(std::memory_order_acquire);
+    }
+
+    if (next == nullptr)
+    {
+        // The tail is the last node, unless a producer is in the middle of pushing after it.
+        VerifyOrExit(tail == mHead.load(std::memory_order_acquire));
+
+        // Put the stub back so the tail can be detached.
+        Push(&mStub);
+        next = tail->mNext.load(std::memory_order_acquire);
+        VerifyOrExit(next != nullptr);
+    }
+
+    mTail = next;
+    node  = tail;
+
+exit:
+    return node;
+}
+
+void TaskQueue::Wakeup(void)
+{
+    uint64_t one = 1;
+    int      fd  = (mPipeWriteFd >= 0) ? mPipeWriteFd : mEventFd;
+    ssize_t  rval;
+
+    // The counter or pipe is only ever full when a wakeup is already pending, so EAGAIN is not an error.
+    rval = write(fd, &one, mPipeWriteFd >= 0 ? 1 : sizeof(one));
+
+    if (rval < 0 && errno != EAGAIN)
+    {
+        otbrLog(OTBR_LOG_ERR, "TaskQueue: failed to wake up mainloop: %s", strerror(errno));
+    }
+}
+
+void TaskQueue::ClearWakeup(void)
+{
+    uint8_t buffer[64];
+
+    while (read(mEventFd, buffer, sizeof(buffer)) > 0)
+    {
+    }
+}
+
+} // namespace otbr
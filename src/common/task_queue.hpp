@@ -0,0 +1,119 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for the mainloop task queue.
+ */
+
+#ifndef OTBR_COMMON_TASK_QUEUE_HPP_
+#define OTBR_COMMON_TASK_QUEUE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <atomic>
+#include <functional>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a lock-free multi-producer single-consumer queue of tasks run by the mainloop.
+ *
+ * Tasks can be posted from any thread without taking a lock. They are run in the posting order by `Process()`,
+ * which MUST only be called from the mainloop thread. The mainloop is woken up through a file descriptor
+ * registered with `MainloopPoller` whenever a task is posted.
+ *
+ */
+class TaskQueue
+{
+public:
+    typedef std::function<void(void)> Task;
+
+    /**
+     * The constructor initializes the task queue.
+     *
+     */
+    TaskQueue(void);
+
+    /**
+     * The destructor discards all pending tasks without running them.
+     *
+     */
+    ~TaskQueue(void);
+
+    /**
+     * This method initializes the wakeup file descriptor and registers it with the mainloop.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully initialized the task queue.
+     * @retval  OTBR_ERROR_ERRNO    Failed to create the wakeup file descriptor.
+     *
+     */
+    otbrError Init(void);
+
+    /**
+     * This method posts a task to be run by the mainloop.
+     *
+     * This method is thread-safe and lock-free.
+     *
+     * @param[in]   aTask   The task to run.
+     *
+     */
+    void Post(Task aTask);
+
+    /**
+     * This method runs all tasks posted so far.
+     *
+     * This method MUST be called from the mainloop thread after `MainloopPoller::Poll()`.
+     *
+     */
+    void Process(void);
+
+private:
+    struct Node
+    {
+        std::atomic<Node *> mNext;
+        Task                mTask;
+    };
+
+    void  Push(Node *aNode);
+    Node *Pop(void);
+    void  Wakeup(void);
+    void  ClearWakeup(void);
+
+    int                 mEventFd;
+    int                 mPipeWriteFd;
+    std::atomic<Node *> mHead; // Most recently posted node, updated by producers.
+    Node *              mTail; // Oldest node, only accessed by the consumer.
+    Node                mStub;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_TASK_QUEUE_HPP_
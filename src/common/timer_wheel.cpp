@@ -0,0 +1,324 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the hierarchical timer wheel.
+ */
+
+#include "common/timer_wheel.hpp"
+
+#include <algorithm>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+constexpr TimerWheel::TimerId       TimerWheel::kInvalidTimerId;
+constexpr std::chrono::milliseconds TimerWheel::kTick;
+constexpr size_t                    TimerWheel::Task::kStorageSize;
+
+TimerWheel::TimerWheel(Clock::time_point aNow)
+    : mCurrentTick(0)
+    , mEpoch(aNow)
+    , mSize(0)
+{
+    for (uint32_t &list : mLists)
+    {
+        list = kNone;
+    }
+}
+
+uint64_t TimerWheel::ToTick(Clock::time_point aTimePoint) const
+{
+    uint64_t tick = 0;
+
+    if (aTimePoint > mEpoch)
+    {
+        // Round up so a timer never fires early.
+        tick = static_cast<uint64_t>((aTimePoint - mEpoch + Clock::duration(kTick) - Clock::duration(1)) / kTick);
+    }
+
+    return tick;
+}
+
+uint64_t TimerWheel::ToElapsedTicks(Clock::time_point aTimePoint) const
+{
+    return aTimePoint > mEpoch ? static_cast<uint64_t>((aTimePoint - mEpoch) / kTick) : 0;
+}
+
+TimerWheel::Clock::time_point TimerWheel::ToTimePoint(uint64_t aTick) const
+{
+    return mEpoch + Clock::duration(kTick) * static_cast<Clock::rep>(aTick);
+}
+
+uint32_t TimerWheel::FindEntry(TimerId aTimerId) const
+{
+    uint32_t index      = static_cast<uint32_t>(aTimerId);
+    uint32_t generation = static_cast<uint32_t>(aTimerId >> 32);
+
+    if (index >= mEntries.size() || mEntries[index].mGeneration != generation || !(generation & 1))
+    {
+        index = kNone;
+    }
+
+    return index;
+}
+
+TimerWheel::TimerId TimerWheel::Add(Clock::time_point aTimePoint, Task aTask)
+{
+    uint32_t index;
+
+    if (!mFreeEntries.empty())
+    {
+        index = mFreeEntries.back();
+        mFreeEntries.pop_back();
+    }
+    else
+    {
+        index = static_cast<uint32_t>(mEntries.size());
+        mEntries.push_back(Entry());
+        mEntries[index].mGeneration = 0;
+    }
+
+    Entry &entry = mEntries[index];
+
+    entry.mGeneration++;
+    entry.mTick = std::max(ToTick(aTimePoint), mCurrentTick + 1);
+    entry.mTask = std::move(aTask);
+    Schedule(index);
+    mSize++;
+
+    return (static_cast<TimerId>(entry.mGeneration) << 32) | index;
+}
+
+bool TimerWheel::Cancel(TimerId aTimerId)
+{
+    uint32_t index = FindEntry(aTimerId);
+    bool     found = (index != kNone);
+
+    if (found)
+    {
+        Release(index);
+    }
+
+    return found;
+}
+
+bool TimerWheel::Reschedule(TimerId aTimerId, Clock::time_point aTimePoint)
+{
+    uint32_t index = FindEntry(aTimerId);
+    bool     found = (index != kNone);
+
+    if (found)
+    {
+        Unlink(index);
+        mEntries[index].mTick = std::max(ToTick(aTimePoint), mCurrentTick + 1);
+        Schedule(index);
+    }
+
+    return found;
+}
+
+TimerWheel::Clock::time_point TimerWheel::GetFireTime(TimerId aTimerId) const
+{
+    uint32_t index = FindEntry(aTimerId);
+
+    return index != kNone ? ToTimePoint(mEntries[index].mTick) : Clock::time_point::max();
+}
+
+void TimerWheel::Schedule(uint32_t aIndex)
+{
+    uint64_t tick  = mEntries[aIndex].mTick;
+    uint64_t delta = tick > mCurrentTick ? tick - mCurrentTick : 0;
+    uint32_t list  = kOverflowList;
+
+    for (uint32_t level = 0; level < kNumLevels; level++)
+    {
+        if (delta < (uint64_t{1} << (kSlotBits * (level + 1))))
+        {
+            list = level * kNumSlots + static_cast<uint32_t>((tick >> (kSlotBits * level)) & kSlotMask);
+            break;
+        }
+    }
+
+    Link(aIndex, list);
+}
+
+void TimerWheel::Link(uint32_t aIndex, uint32_t aList)
+{
+    Entry &entry = mEntries[aIndex];
+
+    entry.mList = aList;
+    entry.mPrev = kNone;
+    entry.mNext = mLists[aList];
+
+    if (entry.mNext != kNone)
+    {
+        mEntries[entry.mNext].mPrev = aIndex;
+    }
+
+    mLists[aList] = aIndex;
+}
+
+void TimerWheel::Unlink(uint32_t aIndex)
+{
+    Entry &entry = mEntries[aIndex];
+
+    if (entry.mPrev != kNone)
+    {
+        mEntries[entry.mPrev].mNext = entry.mNext;
+    }
+    else
+    {
+        mLists[entry.mList] = entry.mNext;
+    }
+
+    if (entry.mNext != kNone)
+    {
+        mEntries[entry.mNext].mPrev = entry.mPrev;
+    }
+}
+
+void TimerWheel::Release(uint32_t aIndex)
+{
+    Entry &entry = mEntries[aIndex];
+
+    Unlink(aIndex);
+    entry.mTask = nullptr;
+    entry.mGeneration++;
+    mFreeEntries.push_back(aIndex);
+    mSize--;
+}
+
+void TimerWheel::Cascade(uint32_t aList)
+{
+    uint32_t index = mLists[aList];
+
+    mLists[aList] = kNone;
+
+    while (index != kNone)
+    {
+        uint32_t next = mEntries[index].mNext;
+
+        Schedule(index);
+        index = next;
+    }
+}
+
+void TimerWheel::FireList(uint32_t aList)
+{
+    while (mLists[aList] != kNone)
+    {
+        uint32_t index = mLists[aList];
+        Task     task  = std::move(mEntries[index].mTask);
+
+        // Release the entry first, the task may add or cancel timers.
+        Release(index);
+        task();
+    }
+}
+
+void TimerWheel::Process(Clock::time_point aNow)
+{
+    uint64_t targetTick = ToElapsedTicks(aNow);
+
+    while (mCurrentTick < targetTick)
+    {
+        if (mSize == 0)
+        {
+            mCurrentTick = targetTick;
+            break;
+        }
+
+        mCurrentTick++;
+
+        // Move timers from higher levels down when the lower level wraps around, starting from the highest level
+        // as its timers may land in the lower levels being cascaded.
+        if ((mCurrentTick & ((uint64_t{1} << (kSlotBits * kNumLevels)) - 1)) == 0)
+        {
+            Cascade(kOverflowList);
+        }
+
+        for (uint32_t level = kNumLevels - 1; level > 0; level--)
+        {
+            if ((mCurrentTick & ((uint64_t{1} << (kSlotBits * level)) - 1)) == 0)
+            {
+                Cascade(level * kNumSlots + static_cast<uint32_t>((mCurrentTick >> (kSlotBits * level)) & kSlotMask));
+            }
+        }
+
+        FireList(static_cast<uint32_t>(mCurrentTick & kSlotMask));
+    }
+}
+
+uint64_t TimerWheel::GetEarliestTick(uint32_t aList) const
+{
+    uint64_t tick = UINT64_MAX;
+
+    for (uint32_t index = mLists[aList]; index != kNone; index = mEntries[index].mNext)
+    {
+        tick = std::min(tick, mEntries[index].mTick);
+    }
+
+    return tick;
+}
+
+TimerWheel::Clock::time_point TimerWheel::GetNextFireTime(void) const
+{
+    Clock::time_point fireTime = Clock::time_point::max();
+    uint64_t          tick     = UINT64_MAX;
+
+    VerifyOrExit(mSize > 0);
+
+    // Slots of a level are ordered starting right after the current one, so only the first non-empty slot of each
+    // level can hold the earliest timer.
+    for (uint32_t level = 0; level < kNumLevels; level++)
+    {
+        uint64_t current = mCurrentTick >> (kSlotBits * level);
+
+        for (uint32_t i = 1; i <= kNumSlots; i++)
+        {
+            uint32_t list = level * kNumSlots + static_cast<uint32_t>((current + i) & kSlotMask);
+
+            if (mLists[list] != kNone)
+            {
+                tick = std::min(tick, GetEarliestTick(list));
+                break;
+            }
+        }
+    }
+
+    tick     = std::min(tick, GetEarliestTick(kOverflowList));
+    fireTime = ToTimePoint(tick);
+
+exit:
+    return fireTime;
+}
+
+} // namespace otbr
@@ -0,0 +1,418 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for the hierarchical timer wheel.
+ */
+
+#ifndef OTBR_COMMON_TIMER_WHEEL_HPP_
+#define OTBR_COMMON_TIMER_WHEEL_HPP_
+
+#include "openthread-br/config.h"
+
+#include <chrono>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace otbr {
+
+/**
+ * This class implements a hierarchical timer wheel.
+ *
+ * Time is divided into ticks of `kTick`, timers due within the same tick are fired together. Adding and cancelling a
+ * timer takes O(1), firing takes O(1) amortized per timer. Timer entries are kept in a pool which is only grown and
+ * tasks are stored inline in the entries, so steady-state operation does not allocate memory.
+ *
+ */
+class TimerWheel
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    /**
+     * This type represents the identifier of a timer. Zero is never a valid timer.
+     *
+     */
+    typedef uint64_t TimerId;
+
+    static constexpr TimerId kInvalidTimerId = 0; ///< The invalid timer id.
+
+    /**
+     * This class holds the task of a timer.
+     *
+     * Unlike `std::function`, the callable is always stored inline and a callable which does not fit fails to
+     * compile instead of being allocated on the heap. A task can only be moved.
+     *
+     */
+    class Task
+    {
+    public:
+        static constexpr size_t kStorageSize = 6 * sizeof(void *); ///< The maximum size of the callable.
+
+        /**
+         * The constructor initializes an empty task.
+         *
+         */
+        Task(void)
+            : mInvoke(nullptr)
+            , mManage(nullptr)
+        {
+        }
+
+        /**
+         * The constructor initializes an empty task.
+         *
+         */
+        Task(std::nullptr_t)
+            : Task()
+        {
+        }
+
+        /**
+         * The constructor initializes a task with a callable.
+         *
+         * @param[in]   aCallable   The callable, e.g. a lambda expression, invoked with no arguments.
+         *
+         */
+        template <typename Callable,
+                  typename = typename std::enable_if<
+                      !std::is_same<typename std::decay<Callable>::type, Task>::value>::type>
+        Task(Callable &&aCallable)
+        {
+            typedef typename std::decay<Callable>::type Type;
+
+            static_assert(sizeof(Type) <= kStorageSize, "The callable is too large to be stored inline");
+            static_assert(alignof(Type) <= alignof(Storage), "The callable is over-aligned");
+
+            new (&mStorage) Type(std::forward<Callable>(aCallable));
+            mInvoke = &Invoke<Type>;
+            mManage = &Manage<Type>;
+        }
+
+        Task(Task &&aOther) noexcept
+            : mInvoke(nullptr)
+            , mManage(nullptr)
+        {
+            *this = std::move(aOther);
+        }
+
+        Task &operator=(Task &&aOther) noexcept
+        {
+            if (this != &aOther)
+            {
+                Reset();
+
+                if (aOther.mManage != nullptr)
+                {
+                    aOther.mManage(kOperationMove, &mStorage, &aOther.mStorage);
+                    mInvoke        = aOther.mInvoke;
+                    mManage        = aOther.mManage;
+                    aOther.mInvoke = nullptr;
+                    aOther.mManage = nullptr;
+                }
+            }
+
+            return *this;
+        }
+
+        Task(const Task &) = delete;
+        Task &operator=(const Task &) = delete;
+
+        ~Task(void) { Reset(); }
+
+        /**
+         * This method indicates whether the task holds a callable.
+         *
+         */
+        explicit operator bool(void) const { return mInvoke != nullptr; }
+
+        /**
+         * This method invokes the callable. The task MUST NOT be empty.
+         *
+         */
+        void operator()(void) { mInvoke(&mStorage); }
+
+    private:
+        enum Operation
+        {
+            kOperationMove,
+            kOperationDestroy,
+        };
+
+        typedef typename std::aligned_storage<kStorageSize, alignof(void *)>::type Storage;
+
+        template <typename Type> static void Invoke(void *aStorage) { (*static_cast<Type *>(aStorage))(); }
+
+        template <typename Type> static void Manage(Operation aOperation, void *aDest, void *aSource)
+        {
+            if (aOperation == kOperationMove)
+            {
+                new (aDest) Type(std::move(*static_cast<Type *>(aSource)));
+            }
+
+            static_cast<Type *>(aSource)->~Type();
+        }
+
+        void Reset(void)
+        {
+            if (mManage != nullptr)
+            {
+                mManage(kOperationDestroy, nullptr, &mStorage);
+                mInvoke = nullptr;
+                mManage = nullptr;
+            }
+        }
+
+        Storage mStorage;
+        void (*mInvoke)(void *aStorage);
+        void (*mManage)(Operation aOperation, void *aDest, void *aSource);
+    };
+
+    /**
+     * This class implements a handle of a timer.
+     *
+     * A handle is a plain reference to a timer and can be copied freely. Operations on a handle of a timer which
+     * already fired or was cancelled have no effect. A handle MUST NOT outlive its timer wheel.
+     *
+     */
+    class Handle
+    {
+    public:
+        /**
+         * The constructor initializes a handle which refers to no timer.
+         *
+         */
+        Handle(void)
+            : mWheel(nullptr)
+            , mTimerId(kInvalidTimerId)
+        {
+        }
+
+        /**
+         * The constructor initializes a handle of a timer.
+         *
+         * @param[in]   aWheel      The timer wheel the timer belongs to.
+         * @param[in]   aTimerId    The timer id.
+         *
+         */
+        Handle(TimerWheel &aWheel, TimerId aTimerId)
+            : mWheel(&aWheel)
+            , mTimerId(aTimerId)
+        {
+        }
+
+        /**
+         * This method indicates whether the timer is still pending.
+         *
+         */
+        bool IsPending(void) const { return mWheel != nullptr && mWheel->IsPending(mTimerId); }
+
+        /**
+         * This method returns the time the timer fires.
+         *
+         * @returns The time point, or `Clock::time_point::max()` if the timer is not pending.
+         *
+         */
+        Clock::time_point GetFireTime(void) const
+        {
+            return mWheel != nullptr ? mWheel->GetFireTime(mTimerId) : Clock::time_point::max();
+        }
+
+        /**
+         * This method cancels the timer.
+         *
+         */
+        void Cancel(void)
+        {
+            if (mWheel != nullptr)
+            {
+                mWheel->Cancel(mTimerId);
+            }
+        }
+
+        /**
+         * This method changes the time the timer fires.
+         *
+         * @param[in]   aTimePoint  The new time to fire the timer.
+         *
+         * @retval  true    The timer was rescheduled.
+         * @retval  false   The timer is not pending.
+         *
+         */
+        bool Reschedule(Clock::time_point aTimePoint)
+        {
+            return mWheel != nullptr && mWheel->Reschedule(mTimerId, aTimePoint);
+        }
+
+    private:
+        TimerWheel *mWheel;
+        TimerId     mTimerId;
+    };
+
+    /**
+     * The tick duration. A timer fires at the end of the tick it is due in.
+     *
+     */
+    static constexpr std::chrono::milliseconds kTick = std::chrono::milliseconds(10);
+
+    /**
+     * The constructor initializes an empty timer wheel.
+     *
+     * @param[in]   aNow    The current time.
+     *
+     */
+    explicit TimerWheel(Clock::time_point aNow = Clock::now());
+
+    /**
+     * This method adds a timer.
+     *
+     * A timer due in the past fires on the next call to `Process()`.
+     *
+     * @param[in]   aTimePoint  The time to fire the timer.
+     * @param[in]   aTask       The task to run when the timer fires.
+     *
+     * @returns The timer id.
+     *
+     */
+    TimerId Add(Clock::time_point aTimePoint, Task aTask);
+
+    /**
+     * This method cancels a timer.
+     *
+     * Cancelling a timer which already fired or was cancelled has no effect.
+     *
+     * @param[in]   aTimerId    The timer id.
+     *
+     * @retval  true    The timer was cancelled.
+     * @retval  false   The timer does not exist.
+     *
+     */
+    bool Cancel(TimerId aTimerId);
+
+    /**
+     * This method changes the time a timer fires.
+     *
+     * @param[in]   aTimerId    The timer id.
+     * @param[in]   aTimePoint  The new time to fire the timer.
+     *
+     * @retval  true    The timer was rescheduled.
+     * @retval  false   The timer does not exist.
+     *
+     */
+    bool Reschedule(TimerId aTimerId, Clock::time_point aTimePoint);
+
+    /**
+     * This method indicates whether a timer is pending.
+     *
+     * @param[in]   aTimerId    The timer id.
+     *
+     */
+    bool IsPending(TimerId aTimerId) const { return FindEntry(aTimerId) != kNone; }
+
+    /**
+     * This method returns the time a timer fires.
+     *
+     * @param[in]   aTimerId    The timer id.
+     *
+     * @returns The time point, or `Clock::time_point::max()` if the timer does not exist.
+     *
+     */
+    Clock::time_point GetFireTime(TimerId aTimerId) const;
+
+    /**
+     * This method fires all timers due until @p aNow.
+     *
+     * Timers added by the tasks run here fire in a later call, even if they are already due.
+     *
+     * @param[in]   aNow    The current time.
+     *
+     */
+    void Process(Clock::time_point aNow);
+
+    /**
+     * This method returns the time the earliest timer fires.
+     *
+     * @returns The time point, or `Clock::time_point::max()` if there is no timer.
+     *
+     */
+    Clock::time_point GetNextFireTime(void) const;
+
+    /**
+     * This method returns the number of pending timers.
+     *
+     */
+    size_t GetSize(void) const { return mSize; }
+
+private:
+    static constexpr uint32_t kSlotBits     = 6;
+    static constexpr uint32_t kNumSlots     = 1 << kSlotBits;
+    static constexpr uint32_t kSlotMask     = kNumSlots - 1;
+    static constexpr uint32_t kNumLevels    = 4;
+    static constexpr uint32_t kNumLists     = kNumLevels * kNumSlots + 1; // The last list holds far away timers.
+    static constexpr uint32_t kOverflowList = kNumLists - 1;
+    static constexpr uint32_t kNone         = UINT32_MAX;
+
+    struct Entry
+    {
+        uint64_t mTick;       // The tick the timer is due in.
+        uint32_t mGeneration; // Incremented whenever the entry is released, an odd value means in use.
+        uint32_t mList;       // The list the entry is in.
+        uint32_t mPrev;
+        uint32_t mNext;
+        Task     mTask;
+    };
+
+    uint64_t          ToTick(Clock::time_point aTimePoint) const;
+    uint64_t          ToElapsedTicks(Clock::time_point aTimePoint) const;
+    Clock::time_point ToTimePoint(uint64_t aTick) const;
+    uint32_t          FindEntry(TimerId aTimerId) const;
+    void              Schedule(uint32_t aIndex);
+    void              Link(uint32_t aIndex, uint32_t aList);
+    void              Unlink(uint32_t aIndex);
+    void              Release(uint32_t aIndex);
+    void              Cascade(uint32_t aList);
+    void              FireList(uint32_t aList);
+    uint64_t          GetEarliestTick(uint32_t aList) const;
+
+    std::vector<Entry>    mEntries;
+    std::vector<uint32_t> mFreeEntries;
+    uint32_t              mLists[kNumLists];
+    uint64_t              mCurrentTick;
+    Clock::time_point     mEpoch;
+    size_t                mSize;
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_TIMER_WHEEL_HPP_
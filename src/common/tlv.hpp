@@ -36,9 +36,12 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
+#include <iterator>
+
 namespace otbr {
 
 /**
@@ -196,6 +199,40 @@ public:
      */
     Tlv *GetNext(void) { return reinterpret_cast<Tlv *>(static_cast<uint8_t *>(GetValue()) + GetLength()); }
 
+    /**
+     * This method returns the size of the Tlv, including the type, the length and the value.
+     *
+     * @returns The size of the Tlv in bytes.
+     *
+     */
+    size_t GetSize(void) const
+    {
+        return static_cast<size_t>(static_cast<const uint8_t *>(GetValue()) - reinterpret_cast<const uint8_t *>(this)) +
+               GetLength();
+    }
+
+    /**
+     * This method returns the Tlv at the start of a buffer, if the whole Tlv is within the buffer.
+     *
+     * @param[in]   aBuffer     A pointer to the buffer.
+     * @param[in]   aLength     The length of the buffer in bytes.
+     *
+     * @returns A pointer to the Tlv, or nullptr if the buffer ends before the Tlv header or value does.
+     *
+     */
+    static const Tlv *FromBuffer(const void *aBuffer, size_t aLength)
+    {
+        const Tlv *tlv = static_cast<const Tlv *>(aBuffer);
+
+        if (aLength < sizeof(Tlv) || (tlv->mLength == kLengthEscape && aLength < sizeof(Tlv) + sizeof(uint16_t)) ||
+            aLength < tlv->GetSize())
+        {
+            tlv = nullptr;
+        }
+
+        return tlv;
+    }
+
 private:
     void *GetValue(void)
     {
@@ -206,10 +243,164 @@ private:
     uint8_t mLength;
 };
 
+/**
+ * This class implements a forward iterator over the Tlvs of a buffer.
+ *
+ * The iterator never reads past the end of the buffer, it reaches the end at the first Tlv which is not entirely
+ * within the buffer.
+ *
+ */
+class TlvIterator
+{
+public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef Tlv                       value_type;
+    typedef ptrdiff_t                 difference_type;
+    typedef const Tlv *               pointer;
+    typedef const Tlv &               reference;
+
+    /**
+     * This constructor creates an end iterator.
+     *
+     */
+    TlvIterator(void)
+        : mTlv(nullptr)
+        , mEnd(nullptr)
+    {
+    }
+
+    /**
+     * This constructor creates an iterator at the first Tlv of a buffer.
+     *
+     * @param[in]   aBegin  A pointer to the start of the buffer.
+     * @param[in]   aEnd    A pointer to the end of the buffer.
+     *
+     */
+    TlvIterator(const uint8_t *aBegin, const uint8_t *aEnd)
+        : mTlv(Tlv::FromBuffer(aBegin, static_cast<size_t>(aEnd - aBegin)))
+        , mEnd(aEnd)
+    {
+    }
+
+    const Tlv &operator*(void) const { return *mTlv; }
+    const Tlv *operator->(void) const { return mTlv; }
+
+    TlvIterator &operator++(void)
+    {
+        const uint8_t *next = reinterpret_cast<const uint8_t *>(mTlv) + mTlv->GetSize();
+
+        mTlv = Tlv::FromBuffer(next, static_cast<size_t>(mEnd - next));
+
+        return *this;
+    }
+
+    TlvIterator operator++(int)
+    {
+        TlvIterator it = *this;
+
+        ++(*this);
+
+        return it;
+    }
+
+    bool operator==(const TlvIterator &aOther) const { return mTlv == aOther.mTlv; }
+    bool operator!=(const TlvIterator &aOther) const { return mTlv != aOther.mTlv; }
+
+private:
+    const Tlv *    mTlv;
+    const uint8_t *mEnd;
+};
+
+/**
+ * This class implements a bounds-checked view of the Tlvs in a buffer, without copying them.
+ *
+ */
+class TlvView
+{
+public:
+    /**
+     * This constructor creates a view of a buffer of Tlvs.
+     *
+     * @param[in]   aBuffer     A pointer to the buffer, which must outlive the view.
+     * @param[in]   aLength     The length of the buffer in bytes.
+     *
+     */
+    TlvView(const void *aBuffer, size_t aLength)
+        : mBegin(static_cast<const uint8_t *>(aBuffer))
+        , mEnd(static_cast<const uint8_t *>(aBuffer) + aLength)
+    {
+    }
+
+    TlvIterator begin(void) const { return TlvIterator(mBegin, mEnd); }
+    TlvIterator end(void) const { return TlvIterator(); }
+
+    /**
+     * This method returns if the buffer is a sequence of whole Tlvs, without trailing bytes.
+     *
+     * @returns Whether the buffer is well-formed.
+     *
+     */
+    bool IsValid(void) const
+    {
+        const uint8_t *cur = mBegin;
+
+        while (cur < mEnd)
+        {
+            const Tlv *tlv = Tlv::FromBuffer(cur, static_cast<size_t>(mEnd - cur));
+
+            if (tlv == nullptr)
+            {
+                break;
+            }
+            cur += tlv->GetSize();
+        }
+
+        return cur == mEnd;
+    }
+
+    /**
+     * This method finds the first Tlv of a type.
+     *
+     * @param[in]   aType   The Tlv type.
+     *
+     * @returns A pointer to the Tlv within the buffer, or nullptr if there is no such Tlv.
+     *
+     */
+    const Tlv *Find(uint8_t aType) const
+    {
+        const Tlv *found = nullptr;
+
+        for (const Tlv &tlv : *this)
+        {
+            if (tlv.GetType() == aType)
+            {
+                found = &tlv;
+                break;
+            }
+        }
+
+        return found;
+    }
+
+private:
+    const uint8_t *mBegin;
+    const uint8_t *mEnd;
+};
+
 namespace Meshcop {
 
 enum
 {
+    kChannel                 = 0,
+    kPanId                   = 1,
+    kExtendedPanId           = 2,
+    kNetworkName             = 3,
+    kPskc                    = 4,
+    kNetworkKey              = 5,
+    kMeshLocalPrefix         = 7,
+    kSecurityPolicy          = 12,
+    kActiveTimestamp         = 14,
+    kChannelMask             = 53,
     kState                   = 16,
     kCommissionerId          = 10,
     kCommissionerSessionId   = 11,
@@ -230,6 +421,39 @@ enum
     kStateRejected = -1,
 };
 
+/**
+ * This function returns the bit of a Tlv type in a set of Tlv types, for the types below 32.
+ *
+ * @param[in]   aType   The Tlv type.
+ *
+ * @returns The bit of @p aType, or 0 if the type is 32 or above.
+ *
+ */
+constexpr uint32_t TlvTypeBit(uint8_t aType)
+{
+    return aType < 32 ? (1u << aType) : 0;
+}
+
+/**
+ * This function returns the set of the Tlv types below 32 found in a view.
+ *
+ * @param[in]   aView   The view of the Tlvs.
+ *
+ * @returns The set of Tlv types, see `TlvTypeBit()`.
+ *
+ */
+inline uint32_t GetTlvTypes(const TlvView &aView)
+{
+    uint32_t types = 0;
+
+    for (const Tlv &tlv : aView)
+    {
+        types |= TlvTypeBit(tlv.GetType());
+    }
+
+    return types;
+}
+
 } // namespace Meshcop
 
 } // namespace otbr
@@ -0,0 +1,277 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the binary trace of hot path events.
+ */
+
+#include "common/trace.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include <string.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+struct EventInfo
+{
+    const char *mName;
+    const char *mArgNames[2];
+};
+
+static const EventInfo kEventInfo[] = {
+    {"nd-proxy-ns", {"target-iid", "multicast"}},
+    {"nd-proxy-na-flush", {"queued", "sent"}},
+    {"rest-response", {"status", "duration-us"}},
+    {"dbus-method-call", {"serial", "duration-us"}},
+    {"srp-update", {"update-id", "timeout-ms"}},
+    {"srp-update-result", {"update-id", "error"}},
+};
+
+static_assert(sizeof(kEventInfo) / sizeof(kEventInfo[0]) == Trace::kNumEvents, "kEventInfo is not in sync with Event");
+
+// The binary trace starts with `kMagic` and the number of rings. Every ring is its thread id and number of entries,
+// followed by the entries from the oldest. All integers are little endian.
+static const char     kMagic[8]     = {'O', 'T', 'B', 'R', 'T', 'R', 'C', '1'};
+static const size_t   kHeaderSize   = sizeof(kMagic) + sizeof(uint32_t);
+static const size_t   kRingHeadSize = 2 * sizeof(uint32_t);
+static const size_t   kEntrySize    = 2 * sizeof(uint64_t) + sizeof(uint32_t) + 2 * sizeof(uint16_t);
+static const uint32_t kMinRingSize  = 16;
+
+constexpr uint32_t Trace::kMaxRingSize;
+
+thread_local Trace::Ring *Trace::sRing = nullptr;
+
+static void AppendLittleEndian(std::string &aOutput, uint64_t aValue, size_t aSize)
+{
+    for (size_t i = 0; i < aSize; ++i)
+    {
+        aOutput.push_back(static_cast<char>(aValue >> (8 * i)));
+    }
+}
+
+static uint64_t ReadLittleEndian(const uint8_t *aData, size_t aSize)
+{
+    uint64_t value = 0;
+
+    for (size_t i = 0; i < aSize; ++i)
+    {
+        value |= static_cast<uint64_t>(aData[i]) << (8 * i);
+    }
+
+    return value;
+}
+
+Trace &Trace::Get(void)
+{
+    static Trace sTrace;
+
+    return sTrace;
+}
+
+void Trace::Start(uint32_t aRingSize)
+{
+    uint32_t ringSize = kMinRingSize;
+
+    VerifyOrExit(aRingSize != 0, Stop());
+
+    aRingSize = std::min(aRingSize, kMaxRingSize);
+
+    while (ringSize < aRingSize)
+    {
+        ringSize <<= 1;
+    }
+
+    mRingSize.store(ringSize, std::memory_order_relaxed);
+
+exit:
+    return;
+}
+
+Trace::Ring *Trace::AddRing(uint32_t aRingSize)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    std::unique_ptr<Ring>       ring(new Ring());
+
+    ring->mThreadId = static_cast<uint32_t>(syscall(SYS_gettid));
+    ring->mMask     = aRingSize - 1;
+    ring->mEntries.reset(new Entry[aRingSize]);
+    ring->mHead.store(0, std::memory_order_relaxed);
+    mRings.push_back(std::move(ring));
+
+    return mRings.back().get();
+}
+
+void Trace::Append(Event aEvent, uint64_t aArg0, uint32_t aArg1)
+{
+    Ring *   ring = sRing;
+    uint64_t head;
+
+    if (ring == nullptr)
+    {
+        uint32_t ringSize = mRingSize.load(std::memory_order_relaxed);
+
+        VerifyOrExit(ringSize != 0);
+        ring = sRing = AddRing(ringSize);
+    }
+
+    head = ring->mHead.load(std::memory_order_relaxed);
+
+    {
+        Entry &entry = ring->mEntries[head & ring->mMask];
+        auto   now   = std::chrono::steady_clock::now().time_since_epoch();
+
+        entry.mTimestamp = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+        entry.mArg0      = aArg0;
+        entry.mArg1      = aArg1;
+        entry.mEvent     = aEvent;
+        entry.mReserved  = 0;
+    }
+
+    ring->mHead.store(head + 1, std::memory_order_release);
+
+exit:
+    return;
+}
+
+void Trace::Write(std::string &aOutput) const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    std::vector<Entry>          entries;
+
+    aOutput.append(kMagic, sizeof(kMagic));
+    AppendLittleEndian(aOutput, mRings.size(), sizeof(uint32_t));
+
+    for (const std::unique_ptr<Ring> &ring : mRings)
+    {
+        uint64_t size  = ring->mMask + 1;
+        uint64_t head  = ring->mHead.load(std::memory_order_acquire);
+        uint64_t first = head > size ? head - size : 0;
+        uint64_t last;
+
+        entries.clear();
+
+        for (uint64_t i = first; i < head; ++i)
+        {
+            entries.push_back(ring->mEntries[i & ring->mMask]);
+        }
+
+        // The owning thread keeps writing while the entries are copied, those it may have overwritten in the
+        // meantime are dropped, including the one it may be writing at `last`.
+        std::atomic_thread_fence(std::memory_order_acquire);
+        last = ring->mHead.load(std::memory_order_relaxed) + 1;
+
+        if (last > first + size)
+        {
+            uint64_t overwritten = std::min<uint64_t>(last - size - first, entries.size());
+
+            entries.erase(entries.begin(), entries.begin() + static_cast<ptrdiff_t>(overwritten));
+        }
+
+        AppendLittleEndian(aOutput, ring->mThreadId, sizeof(uint32_t));
+        AppendLittleEndian(aOutput, entries.size(), sizeof(uint32_t));
+
+        for (const Entry &entry : entries)
+        {
+            AppendLittleEndian(aOutput, entry.mTimestamp, sizeof(uint64_t));
+            AppendLittleEndian(aOutput, entry.mArg0, sizeof(uint64_t));
+            AppendLittleEndian(aOutput, entry.mArg1, sizeof(uint32_t));
+            AppendLittleEndian(aOutput, entry.mEvent, sizeof(uint16_t));
+            AppendLittleEndian(aOutput, entry.mReserved, sizeof(uint16_t));
+        }
+    }
+}
+
+otbrError Trace::Parse(const uint8_t *aData, size_t aLength, std::vector<Sample> &aSamples)
+{
+    otbrError      error = OTBR_ERROR_NONE;
+    const uint8_t *end   = aData + aLength;
+    uint32_t       numRings;
+
+    aSamples.clear();
+
+    VerifyOrExit(aLength >= kHeaderSize && memcmp(aData, kMagic, sizeof(kMagic)) == 0, error = OTBR_ERROR_PARSE);
+    numRings = static_cast<uint32_t>(ReadLittleEndian(aData + sizeof(kMagic), sizeof(uint32_t)));
+    aData += kHeaderSize;
+
+    for (uint32_t ring = 0; ring < numRings; ++ring)
+    {
+        uint32_t threadId;
+        uint32_t count;
+
+        VerifyOrExit(static_cast<size_t>(end - aData) >= kRingHeadSize, error = OTBR_ERROR_PARSE);
+        threadId = static_cast<uint32_t>(ReadLittleEndian(aData, sizeof(uint32_t)));
+        count    = static_cast<uint32_t>(ReadLittleEndian(aData + sizeof(uint32_t), sizeof(uint32_t)));
+        aData += kRingHeadSize;
+
+        VerifyOrExit(static_cast<size_t>(end - aData) / kEntrySize >= count, error = OTBR_ERROR_PARSE);
+
+        for (uint32_t i = 0; i < count; ++i, aData += kEntrySize)
+        {
+            Sample sample;
+
+            sample.mTimestamp = ReadLittleEndian(aData, sizeof(uint64_t));
+            sample.mThreadId  = threadId;
+            sample.mArg0      = ReadLittleEndian(aData + 8, sizeof(uint64_t));
+            sample.mArg1      = static_cast<uint32_t>(ReadLittleEndian(aData + 16, sizeof(uint32_t)));
+            sample.mEvent     = static_cast<uint16_t>(ReadLittleEndian(aData + 20, sizeof(uint16_t)));
+            aSamples.push_back(sample);
+        }
+    }
+
+    VerifyOrExit(aData == end, error = OTBR_ERROR_PARSE);
+
+    std::stable_sort(aSamples.begin(), aSamples.end(),
+                     [](const Sample &aLhs, const Sample &aRhs) { return aLhs.mTimestamp < aRhs.mTimestamp; });
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        aSamples.clear();
+    }
+
+    return error;
+}
+
+const char *Trace::GetEventName(uint16_t aEvent)
+{
+    return aEvent < kNumEvents ? kEventInfo[aEvent].mName : nullptr;
+}
+
+const char *Trace::GetArgName(uint16_t aEvent, uint8_t aIndex)
+{
+    return aEvent < kNumEvents && aIndex < 2 ? kEventInfo[aEvent].mArgNames[aIndex] : nullptr;
+}
+
+} // namespace otbr
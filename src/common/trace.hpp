@@ -0,0 +1,224 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for the binary trace of hot path events.
+ */
+
+#ifndef OTBR_COMMON_TRACE_HPP_
+#define OTBR_COMMON_TRACE_HPP_
+
+#include "openthread-br/config.h"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class records hot path events into per-thread rings of fixed size binary entries.
+ *
+ * Recording an event costs a clock read and a 24-byte store, so tracing can stay enabled where text logging of the
+ * same events would be too expensive. Each thread writes its own ring, wrapping over its oldest entries, and the
+ * rings are exported on demand in a compact binary format, which `trace-decode` turns into text.
+ *
+ */
+class Trace
+{
+public:
+    /**
+     * Trace events.
+     *
+     * The names of events and their arguments are kept in `kEventInfo` in trace.cpp. New events are only appended, so
+     * older traces still decode.
+     *
+     */
+    enum Event : uint16_t
+    {
+        kEventNdProxyNs,       ///< A Neighbor Solicitation for a proxied DUA: target IID, whether it is multicast.
+        kEventNdProxyNaFlush,  ///< Neighbor Advertisements flushed: queued, sent.
+        kEventRestResponse,    ///< A REST response: HTTP status, handling time in microseconds.
+        kEventDBusMethodCall,  ///< A D-Bus method call: message serial, handling time in microseconds.
+        kEventSrpUpdate,       ///< An SRP update received: update id, timeout in milliseconds.
+        kEventSrpUpdateResult, ///< An SRP update completed: update id, OpenThread error.
+        kNumEvents,
+    };
+
+    /**
+     * This structure represents a decoded trace entry.
+     *
+     */
+    struct Sample
+    {
+        uint64_t mTimestamp; ///< Monotonic time of the event in nanoseconds.
+        uint32_t mThreadId;  ///< Kernel id of the thread which recorded the event.
+        uint16_t mEvent;     ///< The event, may be unknown to this version.
+        uint64_t mArg0;      ///< The first argument.
+        uint32_t mArg1;      ///< The second argument.
+    };
+
+    static constexpr uint32_t kMaxRingSize = 1 << 20; ///< Maximum number of entries of a ring.
+
+    /**
+     * This method gets the single `Trace` instance.
+     *
+     * @returns  The single `Trace` instance.
+     *
+     */
+    static Trace &Get(void);
+
+    /**
+     * This method enables tracing.
+     *
+     * Rings are allocated by the first event of each thread, rings allocated before keep their size.
+     *
+     * @param[in]   aRingSize   The number of entries of each thread ring, rounded up to a power of two and limited
+     *                          to `kMaxRingSize`. Zero disables tracing.
+     *
+     */
+    void Start(uint32_t aRingSize);
+
+    /**
+     * This method disables tracing, recorded events are kept for export.
+     *
+     */
+    void Stop(void) { mRingSize.store(0, std::memory_order_relaxed); }
+
+    /**
+     * This method returns whether tracing is enabled.
+     *
+     * @returns Whether tracing is enabled.
+     *
+     */
+    bool IsEnabled(void) const { return mRingSize.load(std::memory_order_relaxed) != 0; }
+
+    /**
+     * This method records an event if tracing is enabled.
+     *
+     * @param[in]   aEvent  The event.
+     * @param[in]   aArg0   The first argument.
+     * @param[in]   aArg1   The second argument.
+     *
+     */
+    void Log(Event aEvent, uint64_t aArg0 = 0, uint32_t aArg1 = 0)
+    {
+        if (IsEnabled())
+        {
+            Append(aEvent, aArg0, aArg1);
+        }
+    }
+
+    /**
+     * This method appends the rings of all threads in the binary trace format.
+     *
+     * Events recorded while exporting may be missing from the output, but never appear torn. The oldest entry of a
+     * full ring is never exported, its thread may be overwriting it.
+     *
+     * @param[out]  aOutput     The output to append to.
+     *
+     */
+    void Write(std::string &aOutput) const;
+
+    /**
+     * This method decodes a binary trace.
+     *
+     * @param[in]   aData       A pointer to the binary trace.
+     * @param[in]   aLength     The length of the binary trace.
+     * @param[out]  aSamples    The decoded entries of all threads, ordered by timestamp.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully decoded the trace.
+     * @retval  OTBR_ERROR_PARSE    The trace is truncated or not in the binary trace format.
+     *
+     */
+    static otbrError Parse(const uint8_t *aData, size_t aLength, std::vector<Sample> &aSamples);
+
+    /**
+     * This method returns the name of an event.
+     *
+     * @param[in]   aEvent  The event.
+     *
+     * @returns The name of the event, or nullptr if the event is unknown.
+     *
+     */
+    static const char *GetEventName(uint16_t aEvent);
+
+    /**
+     * This method returns the name of an event argument.
+     *
+     * @param[in]   aEvent  The event.
+     * @param[in]   aIndex  The index of the argument, either 0 or 1.
+     *
+     * @returns The name of the argument, or nullptr if the event is unknown.
+     *
+     */
+    static const char *GetArgName(uint16_t aEvent, uint8_t aIndex);
+
+private:
+    struct Entry
+    {
+        uint64_t mTimestamp;
+        uint64_t mArg0;
+        uint32_t mArg1;
+        uint16_t mEvent;
+        uint16_t mReserved;
+    };
+
+    struct Ring
+    {
+        uint32_t                 mThreadId;
+        uint32_t                 mMask;
+        std::unique_ptr<Entry[]> mEntries;
+        std::atomic<uint64_t>    mHead; // Number of entries ever written, only advanced by the owning thread.
+    };
+
+    Trace(void)
+        : mRingSize(0)
+    {
+    }
+
+    void  Append(Event aEvent, uint64_t aArg0, uint32_t aArg1);
+    Ring *AddRing(uint32_t aRingSize);
+
+    static thread_local Ring *sRing;
+
+    std::atomic<uint32_t>              mRingSize;
+    mutable std::mutex                 mMutex;
+    std::vector<std::unique_ptr<Ring>> mRings; // Rings of exited threads are kept for export.
+};
+
+} // namespace otbr
+
+#endif // OTBR_COMMON_TRACE_HPP_
@@ -89,15 +89,27 @@ std::string Ip6Address::ToString() const
     return std::string(strbuf);
 }
 
-Ip6Address Ip6Address::ToSolicitedNodeMulticastAddress(void) const
+// Returns the mask of the first `aBits` bits of a 64-bit address word, in network byte order.
+static uint64_t GetPrefixMask(int aBits)
 {
-    Ip6Address ma(Ip6Address::GetSolicitedMulticastAddressPrefix());
+    uint8_t  bytes[sizeof(uint64_t)];
+    uint64_t mask;
 
-    ma.m8[13] = m8[13];
-    ma.m8[14] = m8[14];
-    ma.m8[15] = m8[15];
+    for (uint8_t &byte : bytes)
+    {
+        byte = (aBits >= 8) ? 0xff : (aBits <= 0) ? 0 : static_cast<uint8_t>(0xff << (8 - aBits));
+        aBits -= 8;
+    }
+
+    memcpy(&mask, bytes, sizeof(mask));
 
-    return ma;
+    return mask;
+}
+
+bool Ip6Address::MatchesPrefix(const Ip6Address &aPrefix, uint8_t aLength) const
+{
+    return ((m64[0] ^ aPrefix.m64[0]) & GetPrefixMask(aLength)) == 0 &&
+           ((m64[1] ^ aPrefix.m64[1]) & GetPrefixMask(aLength - 64)) == 0;
 }
 
 void Ip6Address::CopyTo(struct sockaddr_in6 &aSockAddr) const
@@ -130,6 +142,16 @@ Ip6Address Ip6Address::FromString(const char *aStr)
     return addr;
 }
 
+size_t Ip6Prefix::GetHash(void) const
+{
+    Ip6Address masked;
+
+    masked.m64[0] = mPrefix.m64[0] & GetPrefixMask(mLength);
+    masked.m64[1] = mPrefix.m64[1] & GetPrefixMask(mLength - 64);
+
+    return masked.GetHash() ^ mLength;
+}
+
 void Ip6Prefix::Set(const otIp6Prefix &aPrefix)
 {
     memcpy(reinterpret_cast<void *>(this), &aPrefix, sizeof(*this));
@@ -38,6 +38,7 @@
 
 #include <stdint.h>
 #include <string.h>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -168,6 +169,49 @@ public:
      */
     bool operator==(const Ip6Address &aOther) const { return m64[0] == aOther.m64[0] && m64[1] == aOther.m64[1]; }
 
+    /**
+     * This method overloads `!=` operator and compares if the Ip6 address is different from the other address.
+     *
+     * @param[in] aOther  The other Ip6 address to compare with.
+     *
+     * @returns  Whether the Ip6 address is different from the other address.
+     *
+     */
+    bool operator!=(const Ip6Address &aOther) const { return !(*this == aOther); }
+
+    /**
+     * This method returns the hash of the Ip6 address, see `std::hash<Ip6Address>`.
+     *
+     * Both halves are mixed: the addresses of a prefix only differ in the interface identifier, while the
+     * solicited-node groups of a subnet only differ in the low bits.
+     *
+     * @returns The hash value.
+     *
+     */
+    size_t GetHash(void) const
+    {
+        uint64_t hash = m64[0] ^ (m64[1] * UINT64_C(0x9e3779b97f4a7c15));
+
+        hash ^= hash >> 32;
+        hash *= UINT64_C(0x9e3779b97f4a7c15);
+        hash ^= hash >> 29;
+
+        return static_cast<size_t>(hash);
+    }
+
+    /**
+     * This method returns if the first bits of the Ip6 address match a prefix.
+     *
+     * The address is compared as two 64-bit words, whatever the prefix length.
+     *
+     * @param[in] aPrefix  The prefix, its bits after @p aLength are ignored.
+     * @param[in] aLength  The prefix length in bits, up to 128.
+     *
+     * @returns  Whether the Ip6 address matches the prefix.
+     *
+     */
+    bool MatchesPrefix(const Ip6Address &aPrefix, uint8_t aLength) const;
+
     /**
      * Retrieve the 16-bit Thread locator.
      *
@@ -182,7 +226,34 @@ public:
      * @returns The solicited node multicast address.
      *
      */
-    Ip6Address ToSolicitedNodeMulticastAddress(void) const;
+    Ip6Address ToSolicitedNodeMulticastAddress(void) const
+    {
+        Ip6Address address;
+
+        // ff02::1:ffXX:XXXX, built in place as it is derived for every Neighbor Solicitation.
+        address.m8[0]  = 0xff;
+        address.m8[1]  = 0x02;
+        address.m8[11] = 0x01;
+        address.m8[12] = 0xff;
+        address.m8[13] = m8[13];
+        address.m8[14] = m8[14];
+        address.m8[15] = m8[15];
+
+        return address;
+    }
+
+    /**
+     * This method returns if the Ip6 address is the solicited node multicast address of another address.
+     *
+     * @param[in] aAddress  The other address.
+     *
+     * @returns  Whether the Ip6 address is the solicited node multicast address of @p aAddress.
+     *
+     */
+    bool IsSolicitedNodeMulticastAddressOf(const Ip6Address &aAddress) const
+    {
+        return *this == aAddress.ToSolicitedNodeMulticastAddress();
+    }
 
     /**
      * This method returns the string representation for the Ip6 address.
@@ -200,6 +271,22 @@ public:
      */
     bool IsMulticast(void) const { return m8[0] == 0xff; }
 
+    /**
+     * This method returns if the Ip6 address is a link-local unicast address.
+     *
+     * @returns  Whether the Ip6 address is a link-local unicast address.
+     *
+     */
+    bool IsLinkLocal(void) const { return m8[0] == 0xfe && (m8[1] & 0xc0) == 0x80; }
+
+    /**
+     * This method returns if the Ip6 address is the loopback address (::1).
+     *
+     * @returns  Whether the Ip6 address is the loopback address.
+     *
+     */
+    bool IsLoopback(void) const { return m64[0] == 0 && m32[2] == 0 && m16[6] == 0 && m8[14] == 0 && m8[15] == 1; }
+
     /**
      * This function returns the wellknown Link Local All Nodes Multicast Address (ff02::1).
      *
@@ -311,6 +398,39 @@ public:
      */
     bool IsValid(void) const { return mLength > 0 && mLength <= 128; }
 
+    /**
+     * This method returns if an Ip6 address is within the Ip6 prefix.
+     *
+     * @param[in] aAddress  The Ip6 address.
+     *
+     * @returns  Whether @p aAddress starts with the Ip6 prefix.
+     *
+     */
+    bool Contains(const Ip6Address &aAddress) const { return aAddress.MatchesPrefix(mPrefix, mLength); }
+
+    /**
+     * This method overloads `==` operator and compares if the Ip6 prefix is equal to the other prefix.
+     *
+     * The bits after the prefix length are ignored.
+     *
+     * @param[in] aOther  The other Ip6 prefix to compare with.
+     *
+     * @returns  Whether the Ip6 prefix is equal to the other prefix.
+     *
+     */
+    bool operator==(const Ip6Prefix &aOther) const
+    {
+        return mLength == aOther.mLength && mPrefix.MatchesPrefix(aOther.mPrefix, mLength);
+    }
+
+    /**
+     * This method returns the hash of the Ip6 prefix, see `std::hash<Ip6Prefix>`.
+     *
+     * @returns The hash value, the bits after the prefix length are ignored.
+     *
+     */
+    size_t GetHash(void) const;
+
     Ip6Address mPrefix; ///< The IPv6 prefix.
     uint8_t    mLength; ///< The IPv6 prefix length (in bits).
 } OTBR_TOOL_PACKED_END;
@@ -350,4 +470,26 @@ public:
 
 } // namespace otbr
 
+namespace std {
+
+/**
+ * This specialization allows `otbr::Ip6Address` keys in unordered containers.
+ *
+ */
+template <> struct hash<otbr::Ip6Address>
+{
+    size_t operator()(const otbr::Ip6Address &aAddress) const { return aAddress.GetHash(); }
+};
+
+/**
+ * This specialization allows `otbr::Ip6Prefix` keys in unordered containers.
+ *
+ */
+template <> struct hash<otbr::Ip6Prefix>
+{
+    size_t operator()(const otbr::Ip6Prefix &aPrefix) const { return aPrefix.GetHash(); }
+};
+
+} // namespace std
+
 #endif // OTBR_COMMON_TYPES_HPP_
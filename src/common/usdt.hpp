@@ -0,0 +1,88 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for the USDT probes of the agent hot paths.
+ *
+ * Probes are in the `otbr` provider and are only built with `OTBR_ENABLE_USDT`, otherwise they compile to nothing
+ * and their arguments are not evaluated. An enabled probe is a single `nop` until a tracer attaches to it, e.g.
+ *
+ *     bpftrace -e 'usdt:/usr/sbin/otbr-agent:otbr:rest_handle_start { @s[arg0] = nsecs; }
+ *                  usdt:/usr/sbin/otbr-agent:otbr:rest_handle_done /@s[arg0]/ {
+ *                      @us = hist((nsecs - @s[arg0]) / 1000); delete(@s[arg0]); }'
+ *
+ * Probes and their arguments:
+ *
+ * | Probe                 | Arguments                                                          |
+ * |-----------------------|--------------------------------------------------------------------|
+ * | `mainloop_start`      | number of ready file descriptors                                   |
+ * | `mainloop_done`       |                                                                    |
+ * | `rest_accept`         | connection fd                                                      |
+ * | `rest_parse_start`    | connection fd, number of bytes read                                |
+ * | `rest_parse_done`     | connection fd, whether the request is complete                     |
+ * | `rest_handle_start`   | connection fd, request URL                                         |
+ * | `rest_handle_done`    | connection fd, whether the response waits for a callback           |
+ * | `rest_write`          | connection fd, number of bytes written or -1                       |
+ * | `dbus_dispatch_start` | message serial, member name                                        |
+ * | `dbus_dispatch_done`  | message serial                                                     |
+ * | `mdns_publish_start`  | instance or host name                                              |
+ * | `mdns_publish_done`   | instance or host name, `otbrError`                                 |
+ * | `srp_update_start`    | update id, timeout in milliseconds                                 |
+ * | `srp_update_done`     | update id, `otError`                                               |
+ * | `nd_proxy_ns_in`      | pointer to the 16-byte target address, whether the NS is multicast |
+ * | `nd_proxy_na_out`     | number of queued Neighbor Advertisements, number sent              |
+ *
+ */
+
+#ifndef OTBR_COMMON_USDT_HPP_
+#define OTBR_COMMON_USDT_HPP_
+
+#include "openthread-br/config.h"
+
+#ifndef OTBR_ENABLE_USDT
+#define OTBR_ENABLE_USDT 0
+#endif
+
+#if OTBR_ENABLE_USDT
+
+#include <sys/sdt.h>
+
+#define OTBR_USDT0(aName) DTRACE_PROBE(otbr, aName)
+#define OTBR_USDT1(aName, aArg0) DTRACE_PROBE1(otbr, aName, aArg0)
+#define OTBR_USDT2(aName, aArg0, aArg1) DTRACE_PROBE2(otbr, aName, aArg0, aArg1)
+
+#else // OTBR_ENABLE_USDT
+
+#define OTBR_USDT0(aName) ((void)0)
+#define OTBR_USDT1(aName, aArg0) ((void)0)
+#define OTBR_USDT2(aName, aArg0, aArg1) ((void)0)
+
+#endif // OTBR_ENABLE_USDT
+
+#endif // OTBR_COMMON_USDT_HPP_
@@ -26,8 +26,12 @@
  *    POSSIBILITY OF SUCH DAMAGE.
  */
 
+#include <algorithm>
 #include <map>
+
+#include <errno.h>
 #include <string.h>
+#include <unistd.h>
 
 #include "common/code_utils.hpp"
 #include "dbus/client/client_error.hpp"
@@ -39,6 +43,29 @@
 namespace otbr {
 namespace DBus {
 
+// The size of each read of an exported properties file.
+static const size_t kExportReadSize = 16384;
+
+static ClientError NameToTableEvent(const std::string &aEventName, TableEvent &aEvent)
+{
+    ClientError error = ClientError::ERROR_NONE;
+
+    if (aEventName == OTBR_TABLE_EVENT_NAME_ADDED)
+    {
+        aEvent = OTBR_TABLE_EVENT_ADDED;
+    }
+    else if (aEventName == OTBR_TABLE_EVENT_NAME_REMOVED)
+    {
+        aEvent = OTBR_TABLE_EVENT_REMOVED;
+    }
+    else
+    {
+        error = ClientError::OT_ERROR_NOT_FOUND;
+    }
+
+    return error;
+}
+
 static ClientError NameToDeviceRole(const std::string &aRoleName, DeviceRole &aDeviceRole)
 {
     static std::pair<const char *, DeviceRole> sRoleMap[] = {
@@ -61,6 +88,29 @@ static ClientError NameToDeviceRole(const std::string &aRoleName, DeviceRole &aD
     return error;
 }
 
+// The properties the server signals the changes of, see `kSignaledProperties` of `DBusThreadObject`
+static const char *const kCachedProperties[] = {
+    OTBR_DBUS_PROPERTY_DEVICE_ROLE, OTBR_DBUS_PROPERTY_NETWORK_NAME, OTBR_DBUS_PROPERTY_PANID,
+    OTBR_DBUS_PROPERTY_EXTPANID,    OTBR_DBUS_PROPERTY_CHANNEL,      OTBR_DBUS_PROPERTY_RLOC16,
+    OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY,
+};
+
+static bool IsCachedProperty(const std::string &aPropertyName)
+{
+    bool cached = false;
+
+    for (const char *name : kCachedProperties)
+    {
+        if (aPropertyName == name)
+        {
+            cached = true;
+            break;
+        }
+    }
+
+    return cached;
+}
+
 bool IsThreadActive(DeviceRole aRole)
 {
     bool isActive = false;
@@ -84,6 +134,8 @@ bool IsThreadActive(DeviceRole aRole)
 ThreadApiDBus::ThreadApiDBus(DBusConnection *aConnection)
     : mInterfaceName("wpan0")
     , mConnection(aConnection)
+    , mPropertyCacheEnabled(false)
+    , mEventLoopAttached(false)
 {
     SubscribeDeviceRoleSignal();
 }
@@ -91,19 +143,222 @@ ThreadApiDBus::ThreadApiDBus(DBusConnection *aConnection)
 ThreadApiDBus::ThreadApiDBus(DBusConnection *aConnection, const std::string &aInterfaceName)
     : mInterfaceName(aInterfaceName)
     , mConnection(aConnection)
+    , mPropertyCacheEnabled(false)
+    , mEventLoopAttached(false)
 {
     SubscribeDeviceRoleSignal();
 }
 
+ThreadApiDBus::~ThreadApiDBus(void)
+{
+    for (DBusPendingCall *pending : mAsyncCalls)
+    {
+        // Cancelling frees the call context without calling its handler.
+        dbus_pending_call_cancel(pending);
+        dbus_pending_call_unref(pending);
+    }
+
+    if (mEventLoopAttached)
+    {
+        dbus_connection_set_watch_functions(mConnection, nullptr, nullptr, nullptr, nullptr, nullptr);
+        dbus_connection_set_timeout_functions(mConnection, nullptr, nullptr, nullptr, nullptr, nullptr);
+    }
+
+    dbus_connection_remove_filter(mConnection, sDBusMessageFilter, this);
+}
+
+ClientError ThreadApiDBus::AttachToEventLoop(void)
+{
+    ClientError ret = ClientError::ERROR_NONE;
+
+    VerifyOrExit(!mEventLoopAttached);
+    VerifyOrExit(dbus_connection_set_watch_functions(mConnection, sAddWatch, sRemoveWatch, sToggleWatch, this, nullptr),
+                 ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(
+        dbus_connection_set_timeout_functions(mConnection, sAddTimeout, sRemoveTimeout, sToggleTimeout, this, nullptr),
+        ret = ClientError::ERROR_DBUS);
+    mEventLoopAttached = true;
+
+exit:
+    return ret;
+}
+
+dbus_bool_t ThreadApiDBus::sAddWatch(DBusWatch *aWatch, void *aThreadApiDBus)
+{
+    static_cast<ThreadApiDBus *>(aThreadApiDBus)->mWatches.insert(aWatch);
+
+    return TRUE;
+}
+
+void ThreadApiDBus::sRemoveWatch(DBusWatch *aWatch, void *aThreadApiDBus)
+{
+    static_cast<ThreadApiDBus *>(aThreadApiDBus)->mWatches.erase(aWatch);
+}
+
+void ThreadApiDBus::sToggleWatch(DBusWatch *aWatch, void *aThreadApiDBus)
+{
+    // Enabled state is read from the watch on every update.
+    OTBR_UNUSED_VARIABLE(aWatch);
+    OTBR_UNUSED_VARIABLE(aThreadApiDBus);
+}
+
+dbus_bool_t ThreadApiDBus::sAddTimeout(DBusTimeout *aTimeout, void *aThreadApiDBus)
+{
+    static_cast<ThreadApiDBus *>(aThreadApiDBus)->mTimeouts[aTimeout] =
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(dbus_timeout_get_interval(aTimeout));
+
+    return TRUE;
+}
+
+void ThreadApiDBus::sRemoveTimeout(DBusTimeout *aTimeout, void *aThreadApiDBus)
+{
+    static_cast<ThreadApiDBus *>(aThreadApiDBus)->mTimeouts.erase(aTimeout);
+}
+
+void ThreadApiDBus::sToggleTimeout(DBusTimeout *aTimeout, void *aThreadApiDBus)
+{
+    // A re-enabled timeout starts over.
+    sAddTimeout(aTimeout, aThreadApiDBus);
+}
+
+void ThreadApiDBus::UpdateFdSet(fd_set &        aReadFdSet,
+                                fd_set &        aWriteFdSet,
+                                fd_set &        aErrorFdSet,
+                                int &           aMaxFd,
+                                struct timeval &aTimeout)
+{
+    auto now = std::chrono::steady_clock::now();
+
+    for (DBusWatch *watch : mWatches)
+    {
+        unsigned int flags;
+        int          fd;
+
+        if (!dbus_watch_get_enabled(watch) || (fd = dbus_watch_get_unix_fd(watch)) < 0)
+        {
+            continue;
+        }
+
+        flags = dbus_watch_get_flags(watch);
+
+        if (flags & DBUS_WATCH_READABLE)
+        {
+            FD_SET(fd, &aReadFdSet);
+        }
+
+        if (flags & DBUS_WATCH_WRITABLE)
+        {
+            FD_SET(fd, &aWriteFdSet);
+        }
+
+        FD_SET(fd, &aErrorFdSet);
+
+        if (fd > aMaxFd)
+        {
+            aMaxFd = fd;
+        }
+    }
+
+    for (const auto &timeout : mTimeouts)
+    {
+        std::chrono::microseconds remaining(0);
+
+        if (!dbus_timeout_get_enabled(timeout.first))
+        {
+            continue;
+        }
+
+        if (timeout.second > now)
+        {
+            remaining = std::chrono::duration_cast<std::chrono::microseconds>(timeout.second - now);
+        }
+
+        if (remaining.count() < static_cast<int64_t>(aTimeout.tv_sec) * 1000000 + aTimeout.tv_usec)
+        {
+            aTimeout.tv_sec  = static_cast<time_t>(remaining.count() / 1000000);
+            aTimeout.tv_usec = static_cast<suseconds_t>(remaining.count() % 1000000);
+        }
+    }
+
+    if (dbus_connection_get_dispatch_status(mConnection) == DBUS_DISPATCH_DATA_REMAINS)
+    {
+        aTimeout = {0, 0};
+    }
+}
+
+void ThreadApiDBus::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
+{
+    auto                       now = std::chrono::steady_clock::now();
+    std::vector<DBusWatch *>   watches(mWatches.begin(), mWatches.end());
+    std::vector<DBusTimeout *> expired;
+
+    // Handling a watch or timeout may add or remove others, so iterate over copies.
+    for (DBusWatch *watch : watches)
+    {
+        unsigned int flags = 0;
+        int          fd;
+
+        if (mWatches.count(watch) == 0 || !dbus_watch_get_enabled(watch) ||
+            (fd = dbus_watch_get_unix_fd(watch)) < 0)
+        {
+            continue;
+        }
+
+        if ((dbus_watch_get_flags(watch) & DBUS_WATCH_READABLE) && FD_ISSET(fd, &aReadFdSet))
+        {
+            flags |= DBUS_WATCH_READABLE;
+        }
+
+        if ((dbus_watch_get_flags(watch) & DBUS_WATCH_WRITABLE) && FD_ISSET(fd, &aWriteFdSet))
+        {
+            flags |= DBUS_WATCH_WRITABLE;
+        }
+
+        if (FD_ISSET(fd, &aErrorFdSet))
+        {
+            flags |= DBUS_WATCH_ERROR;
+        }
+
+        if (flags != 0)
+        {
+            dbus_watch_handle(watch, flags);
+        }
+    }
+
+    for (auto &timeout : mTimeouts)
+    {
+        if (dbus_timeout_get_enabled(timeout.first) && timeout.second <= now)
+        {
+            timeout.second = now + std::chrono::milliseconds(dbus_timeout_get_interval(timeout.first));
+            expired.push_back(timeout.first);
+        }
+    }
+
+    for (DBusTimeout *timeout : expired)
+    {
+        if (mTimeouts.count(timeout) != 0)
+        {
+            dbus_timeout_handle(timeout);
+        }
+    }
+
+    while (dbus_connection_dispatch(mConnection) == DBUS_DISPATCH_DATA_REMAINS)
+        ;
+}
+
 ClientError ThreadApiDBus::SubscribeDeviceRoleSignal(void)
 {
-    std::string matchRule = "type='signal',interface='" DBUS_INTERFACE_PROPERTIES "'";
+    std::string matchRule      = "type='signal',interface='" DBUS_INTERFACE_PROPERTIES "'";
+    std::string tableMatchRule = "type='signal',interface='" OTBR_DBUS_THREAD_INTERFACE "'";
     DBusError   error;
     ClientError ret = ClientError::ERROR_NONE;
 
     dbus_error_init(&error);
     dbus_bus_add_match(mConnection, matchRule.c_str(), &error);
+    VerifyOrExit(!dbus_error_is_set(&error), ret = ClientError::OT_ERROR_FAILED);
 
+    // The table change signals
+    dbus_bus_add_match(mConnection, tableMatchRule.c_str(), &error);
     VerifyOrExit(!dbus_error_is_set(&error), ret = ClientError::OT_ERROR_FAILED);
 
     dbus_connection_add_filter(mConnection, sDBusMessageFilter, this, nullptr);
@@ -125,9 +380,21 @@ DBusHandlerResult ThreadApiDBus::DBusMessageFilter(DBusConnection *aConnection,
 {
     (void)aConnection;
 
-    DBusMessageIter iter, subIter, dictEntryIter, valIter;
-    std::string     interfaceName, propertyName, val;
-    DeviceRole      role = OTBR_DEVICE_ROLE_DISABLED;
+    DBusMessageIter              iter, subIter, dictEntryIter;
+    std::string                  interfaceName, propertyName, val;
+    DeviceRole                   role = OTBR_DEVICE_ROLE_DISABLED;
+    std::shared_ptr<DBusMessage> message;
+
+    VerifyOrExit(dbus_message_has_path(aMessage, (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str()));
+
+    if (dbus_message_has_interface(aMessage, OTBR_DBUS_THREAD_INTERFACE))
+    {
+        if (!HandleScanSignal(aMessage) && !HandleJoinerEventSignal(aMessage))
+        {
+            HandleTableChangedSignal(aMessage);
+        }
+        ExitNow();
+    }
 
     VerifyOrExit(dbus_message_is_signal(aMessage, DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL));
     VerifyOrExit(dbus_message_iter_init(aMessage, &iter));
@@ -136,30 +403,163 @@ DBusHandlerResult ThreadApiDBus::DBusMessageFilter(DBusConnection *aConnection,
 
     VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY);
     dbus_message_iter_recurse(&iter, &subIter);
-    VerifyOrExit(dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY);
-    dbus_message_iter_recurse(&subIter, &dictEntryIter);
-    SuccessOrExit(DBusMessageExtract(&dictEntryIter, propertyName));
-    VerifyOrExit(dbus_message_iter_get_arg_type(&dictEntryIter) == DBUS_TYPE_VARIANT);
-    dbus_message_iter_recurse(&dictEntryIter, &valIter);
-    SuccessOrExit(DBusMessageExtract(&valIter, val));
-
-    VerifyOrExit(propertyName == OTBR_DBUS_PROPERTY_DEVICE_ROLE);
-    SuccessOrExit(NameToDeviceRole(val, role));
 
-    for (const auto &f : mDeviceRoleHandlers)
+    // The server may signal several properties changed at the same time.
+    for (; dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY; dbus_message_iter_next(&subIter))
     {
-        f(role);
+        dbus_message_iter_recurse(&subIter, &dictEntryIter);
+        SuccessOrExit(DBusMessageExtract(&dictEntryIter, propertyName));
+        VerifyOrExit(dbus_message_iter_get_arg_type(&dictEntryIter) == DBUS_TYPE_VARIANT);
+
+        if (mPropertyCacheEnabled && IsCachedProperty(propertyName))
+        {
+            if (message == nullptr)
+            {
+                message = std::shared_ptr<DBusMessage>(dbus_message_ref(aMessage), dbus_message_unref);
+            }
+
+            CacheProperty(propertyName, message, dictEntryIter);
+        }
+
+        if (propertyName == OTBR_DBUS_PROPERTY_DEVICE_ROLE &&
+            DBusMessageExtractFromVariant(&dictEntryIter, val) == OTBR_ERROR_NONE &&
+            NameToDeviceRole(val, role) == ClientError::ERROR_NONE)
+        {
+            for (const auto &f : mDeviceRoleHandlers)
+            {
+                f(role);
+            }
+        }
     }
 
 exit:
     return DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
 }
 
+void ThreadApiDBus::HandleTableChangedSignal(DBusMessage *aMessage)
+{
+    DBusMessageIter iter;
+    uint32_t        sequence;
+    std::string     eventName;
+    TableEvent      event;
+
+    VerifyOrExit(dbus_message_iter_init(aMessage, &iter));
+    SuccessOrExit(DBusMessageExtract(&iter, sequence));
+    SuccessOrExit(DBusMessageExtract(&iter, eventName));
+    VerifyOrExit(NameToTableEvent(eventName, event) == ClientError::ERROR_NONE);
+
+    if (dbus_message_is_signal(aMessage, OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_CHILD_TABLE_CHANGED_SIGNAL))
+    {
+        ChildInfo child;
+
+        SuccessOrExit(DBusMessageExtract(&iter, child));
+        for (const auto &f : mChildTableChangedHandlers)
+        {
+            f(sequence, event, child);
+        }
+    }
+    else if (dbus_message_is_signal(aMessage, OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_NEIGHBOR_TABLE_CHANGED_SIGNAL))
+    {
+        NeighborInfo neighbor;
+
+        SuccessOrExit(DBusMessageExtract(&iter, neighbor));
+        for (const auto &f : mNeighborTableChangedHandlers)
+        {
+            f(sequence, event, neighbor);
+        }
+    }
+
+exit:
+    return;
+}
+
+bool ThreadApiDBus::HandleScanSignal(DBusMessage *aMessage)
+{
+    DBusMessageIter  iter;
+    bool             handled = true;
+    ActiveScanResult scanResult;
+    EnergyScanResult energyScanResult;
+
+    if (dbus_message_is_signal(aMessage, OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_RESULT_SIGNAL))
+    {
+        VerifyOrExit(mScanResultHandler != nullptr);
+        VerifyOrExit(dbus_message_iter_init(aMessage, &iter));
+        SuccessOrExit(DBusMessageExtract(&iter, scanResult));
+        mScanResultHandler(&scanResult);
+    }
+    else if (dbus_message_is_signal(aMessage, OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_FINISHED_SIGNAL))
+    {
+        ScanResultHandler handler = std::move(mScanResultHandler);
+
+        mScanResultHandler = nullptr;
+        VerifyOrExit(handler != nullptr);
+        handler(nullptr);
+    }
+    else if (dbus_message_is_signal(aMessage, OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ENERGY_SCAN_RESULT_SIGNAL))
+    {
+        VerifyOrExit(mEnergyScanResultHandler != nullptr);
+        VerifyOrExit(dbus_message_iter_init(aMessage, &iter));
+        SuccessOrExit(DBusMessageExtract(&iter, energyScanResult));
+        mEnergyScanResultHandler(&energyScanResult);
+    }
+    else if (dbus_message_is_signal(aMessage, OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ENERGY_SCAN_FINISHED_SIGNAL))
+    {
+        EnergyScanResultHandler handler = std::move(mEnergyScanResultHandler);
+
+        mEnergyScanResultHandler = nullptr;
+        VerifyOrExit(handler != nullptr);
+        handler(nullptr);
+    }
+    else
+    {
+        handled = false;
+    }
+
+exit:
+    return handled;
+}
+
+bool ThreadApiDBus::HandleJoinerEventSignal(DBusMessage *aMessage)
+{
+    DBusMessageIter iter;
+    JoinerEvent     event;
+    bool            handled = false;
+
+    VerifyOrExit(dbus_message_is_signal(aMessage, OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_JOINER_EVENT_SIGNAL));
+    handled = true;
+    VerifyOrExit(!mJoinerEventHandlers.empty());
+    VerifyOrExit(dbus_message_iter_init(aMessage, &iter));
+    SuccessOrExit(DBusMessageExtract(&iter, event));
+
+    for (const auto &handler : mJoinerEventHandlers)
+    {
+        handler(event);
+    }
+
+exit:
+    return handled;
+}
+
 void ThreadApiDBus::AddDeviceRoleHandler(const DeviceRoleHandler &aHandler)
 {
     mDeviceRoleHandlers.push_back(aHandler);
 }
 
+void ThreadApiDBus::AddChildTableChangedHandler(const ChildTableChangedHandler &aHandler)
+{
+    mChildTableChangedHandlers.push_back(aHandler);
+}
+
+void ThreadApiDBus::AddNeighborTableChangedHandler(const NeighborTableChangedHandler &aHandler)
+{
+    mNeighborTableChangedHandlers.push_back(aHandler);
+}
+
+void ThreadApiDBus::AddJoinerEventHandler(const JoinerEventHandler &aHandler)
+{
+    mJoinerEventHandlers.push_back(aHandler);
+}
+
 ClientError ThreadApiDBus::Scan(const ScanHandler &aHandler)
 {
     ClientError error = ClientError::ERROR_NONE;
@@ -192,11 +592,93 @@ void ThreadApiDBus::ScanPendingCallHandler(DBusPendingCall *aPending)
     mScanHandler = nullptr;
 }
 
+ClientError ThreadApiDBus::StreamScan(const ScanResultHandler &aHandler)
+{
+    ClientError error = ClientError::ERROR_NONE;
+
+    VerifyOrExit(mScanResultHandler == nullptr, error = ClientError::OT_ERROR_INVALID_STATE);
+    mScanResultHandler = aHandler;
+
+    // The results are signaled, they are dispatched after this call returns.
+    error = CallDBusMethodSync(OTBR_DBUS_STREAM_SCAN_METHOD);
+    if (error != ClientError::ERROR_NONE)
+    {
+        mScanResultHandler = nullptr;
+    }
+exit:
+    return error;
+}
+
+ClientError ThreadApiDBus::StreamEnergyScan(uint32_t                       aScanChannels,
+                                            uint16_t                       aScanDuration,
+                                            const EnergyScanResultHandler &aHandler)
+{
+    ClientError error = ClientError::ERROR_NONE;
+
+    VerifyOrExit(mEnergyScanResultHandler == nullptr, error = ClientError::OT_ERROR_INVALID_STATE);
+    mEnergyScanResultHandler = aHandler;
+
+    error = CallDBusMethodSync(OTBR_DBUS_STREAM_ENERGY_SCAN_METHOD, std::tie(aScanChannels, aScanDuration));
+    if (error != ClientError::ERROR_NONE)
+    {
+        mEnergyScanResultHandler = nullptr;
+    }
+exit:
+    return error;
+}
+
+ClientError ThreadApiDBus::SurveyChannels(bool                        aEnergyScan,
+                                          uint16_t                    aScanDuration,
+                                          const ChannelSurveyHandler &aHandler)
+{
+    ClientError error = ClientError::ERROR_NONE;
+
+    VerifyOrExit(mChannelSurveyHandler == nullptr, error = ClientError::OT_ERROR_INVALID_STATE);
+    mChannelSurveyHandler = aHandler;
+
+    error = CallDBusMethodAsync(
+        OTBR_DBUS_SURVEY_CHANNELS_METHOD, std::tie(aEnergyScan, aScanDuration),
+        &ThreadApiDBus::sHandleDBusPendingCall<&ThreadApiDBus::SurveyChannelsPendingCallHandler>);
+    if (error != ClientError::ERROR_NONE)
+    {
+        mChannelSurveyHandler = nullptr;
+    }
+exit:
+    return error;
+}
+
+void ThreadApiDBus::SurveyChannelsPendingCallHandler(DBusPendingCall *aPending)
+{
+    ClientError       ret = ClientError::OT_ERROR_FAILED;
+    ChannelSurvey     survey;
+    UniqueDBusMessage message(dbus_pending_call_steal_reply(aPending));
+    auto              args    = std::tie(survey);
+    auto              handler = mChannelSurveyHandler;
+
+    if (message != nullptr)
+    {
+        ret = CheckErrorMessage(message.get());
+    }
+
+    if (ret == ClientError::ERROR_NONE && DBusMessageToTuple(*message, args) != OTBR_ERROR_NONE)
+    {
+        ret = ClientError::ERROR_DBUS;
+    }
+
+    mChannelSurveyHandler = nullptr;
+    handler(ret, survey);
+}
+
 ClientError ThreadApiDBus::PermitUnsecureJoin(uint16_t aPort, uint32_t aSeconds)
 {
     return CallDBusMethodSync(OTBR_DBUS_PERMIT_UNSECURE_JOIN_METHOD, std::tie(aPort, aSeconds));
 }
 
+ClientError ThreadApiDBus::PermitUnsecureJoin(const std::vector<uint16_t> &aPorts, uint32_t aSeconds)
+{
+    return CallDBusMethodSync(OTBR_DBUS_PERMIT_UNSECURE_JOIN_PORTS_METHOD, std::tie(aPorts, aSeconds));
+}
+
 ClientError ThreadApiDBus::Attach(const std::string &         aNetworkName,
                                   uint16_t                    aPanId,
                                   uint64_t                    aExtPanId,
@@ -252,6 +734,31 @@ exit:
     return error;
 }
 
+ClientError ThreadApiDBus::AttachDataset(const std::vector<uint8_t> &aDatasetTlvs, const OtResultHandler &aHandler)
+{
+    ClientError error = ClientError::ERROR_NONE;
+    const auto  args  = std::tie(aDatasetTlvs);
+
+    VerifyOrExit(mAttachHandler == nullptr && mJoinerHandler == nullptr, error = ClientError::OT_ERROR_INVALID_STATE);
+    mAttachHandler = aHandler;
+
+    if (aHandler)
+    {
+        error = CallDBusMethodAsync(OTBR_DBUS_ATTACH_DATASET_METHOD, args,
+                                    &ThreadApiDBus::sHandleDBusPendingCall<&ThreadApiDBus::AttachPendingCallHandler>);
+    }
+    else
+    {
+        error = CallDBusMethodSync(OTBR_DBUS_ATTACH_DATASET_METHOD, args);
+    }
+    if (error != ClientError::ERROR_NONE)
+    {
+        mAttachHandler = nullptr;
+    }
+exit:
+    return error;
+}
+
 void ThreadApiDBus::AttachPendingCallHandler(DBusPendingCall *aPending)
 {
     ClientError       ret = ClientError::OT_ERROR_FAILED;
@@ -311,6 +818,40 @@ ClientError ThreadApiDBus::Reset(void)
     return CallDBusMethodSync(OTBR_DBUS_RESET_METHOD);
 }
 
+ClientError ThreadApiDBus::ReloadConfig(void)
+{
+    return CallDBusMethodSync(OTBR_DBUS_RELOAD_CONFIG_METHOD);
+}
+
+ClientError ThreadApiDBus::GetChurnEvents(uint64_t                 aSince,
+                                          uint64_t                 aUntil,
+                                          std::vector<ChurnEvent> &aEvents,
+                                          uint32_t &               aDropped)
+{
+    ClientError             ret = ClientError::ERROR_NONE;
+    DBus::UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                                                 (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                                                 OTBR_DBUS_THREAD_INTERFACE,
+                                                                 OTBR_DBUS_GET_CHURN_EVENTS_METHOD));
+    DBus::UniqueDBusMessage reply = nullptr;
+    DBusError               error;
+    auto                    args = std::tie(aEvents, aDropped);
+
+    dbus_error_init(&error);
+    VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(TupleToDBusMessage(*message, std::tie(aSince, aUntil)) == OTBR_ERROR_NONE,
+                 ret = ClientError::ERROR_DBUS);
+    reply = DBus::UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
+    VerifyOrExit(!dbus_error_is_set(&error), ret = DBus::ConvertFromDBusErrorName(error.message));
+    VerifyOrExit(reply != nullptr, ret = ClientError::ERROR_DBUS);
+    SuccessOrExit(ret = DBus::CheckErrorMessage(reply.get()));
+    VerifyOrExit(DBusMessageToTuple(*reply, args) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+exit:
+    dbus_error_free(&error);
+    return ret;
+}
+
 ClientError ThreadApiDBus::JoinerStart(const std::string &    aPskd,
                                        const std::string &    aProvisioningUrl,
                                        const std::string &    aVendorName,
@@ -363,6 +904,31 @@ ClientError ThreadApiDBus::JoinerStop(void)
     return CallDBusMethodSync(OTBR_DBUS_JOINER_STOP_METHOD);
 }
 
+ClientError ThreadApiDBus::AddJoiners(const std::vector<JoinerEntry> &aJoiners, std::vector<uint8_t> &aErrors)
+{
+    ClientError             ret = ClientError::ERROR_NONE;
+    DBus::UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                                                 (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                                                 OTBR_DBUS_THREAD_INTERFACE,
+                                                                 OTBR_DBUS_ADD_JOINERS_METHOD));
+    DBus::UniqueDBusMessage reply = nullptr;
+    DBusError               error;
+    auto                    args = std::tie(aErrors);
+
+    dbus_error_init(&error);
+    VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(TupleToDBusMessage(*message, std::tie(aJoiners)) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+    reply = DBus::UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
+    VerifyOrExit(!dbus_error_is_set(&error), ret = DBus::ConvertFromDBusErrorName(error.message));
+    VerifyOrExit(reply != nullptr, ret = ClientError::ERROR_DBUS);
+    SuccessOrExit(ret = DBus::CheckErrorMessage(reply.get()));
+    VerifyOrExit(DBusMessageToTuple(*reply, args) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+exit:
+    dbus_error_free(&error);
+    return ret;
+}
+
 ClientError ThreadApiDBus::AddOnMeshPrefix(const OnMeshPrefix &aPrefix)
 {
     return CallDBusMethodSync(OTBR_DBUS_ADD_ON_MESH_PREFIX_METHOD, std::tie(aPrefix));
@@ -383,6 +949,37 @@ ClientError ThreadApiDBus::RemoveExternalRoute(const Ip6Prefix &aPrefix)
     return CallDBusMethodSync(OTBR_DBUS_REMOVE_EXTERNAL_ROUTE_METHOD, std::tie(aPrefix));
 }
 
+ClientError ThreadApiDBus::UpdateNetworkData(const std::vector<OnMeshPrefix> & aAddedPrefixes,
+                                             const std::vector<Ip6Prefix> &    aRemovedPrefixes,
+                                             const std::vector<ExternalRoute> &aAddedRoutes,
+                                             const std::vector<Ip6Prefix> &    aRemovedRoutes,
+                                             std::vector<uint8_t> &            aErrors)
+{
+    ClientError             ret = ClientError::ERROR_NONE;
+    DBus::UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                                                 (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                                                 OTBR_DBUS_THREAD_INTERFACE,
+                                                                 OTBR_DBUS_UPDATE_NETWORK_DATA_METHOD));
+    DBus::UniqueDBusMessage reply = nullptr;
+    DBusError               error;
+    auto                    args = std::tie(aErrors);
+
+    dbus_error_init(&error);
+    VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(TupleToDBusMessage(*message, std::tie(aAddedPrefixes, aRemovedPrefixes, aAddedRoutes,
+                                                       aRemovedRoutes)) == OTBR_ERROR_NONE,
+                 ret = ClientError::ERROR_DBUS);
+    reply = DBus::UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
+    VerifyOrExit(!dbus_error_is_set(&error), ret = DBus::ConvertFromDBusErrorName(error.message));
+    VerifyOrExit(reply != nullptr, ret = ClientError::ERROR_DBUS);
+    SuccessOrExit(ret = DBus::CheckErrorMessage(reply.get()));
+    VerifyOrExit(DBusMessageToTuple(*reply, args) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+exit:
+    dbus_error_free(&error);
+    return ret;
+}
+
 ClientError ThreadApiDBus::SetMeshLocalPrefix(const std::array<uint8_t, OTBR_IP6_PREFIX_SIZE> &aPrefix)
 {
     return SetProperty(OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX, aPrefix);
@@ -524,6 +1121,16 @@ ClientError ThreadApiDBus::GetNeighborTable(std::vector<NeighborInfo> &aNeighbor
     return GetProperty(OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY, aNeighborTable);
 }
 
+ClientError ThreadApiDBus::GetChildTableSequence(uint32_t &aSequence)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_CHILD_TABLE_SEQUENCE, aSequence);
+}
+
+ClientError ThreadApiDBus::GetNeighborTableSequence(uint32_t &aSequence)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_SEQUENCE, aSequence);
+}
+
 ClientError ThreadApiDBus::GetPartitionId(uint32_t &aPartitionId)
 {
     return GetProperty(OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY, aPartitionId);
@@ -554,6 +1161,31 @@ ClientError ThreadApiDBus::GetRadioRegion(std::string &aRadioRegion)
     return GetProperty(OTBR_DBUS_PROPERTY_RADIO_REGION, aRadioRegion);
 }
 
+ClientError ThreadApiDBus::GetMainloopStats(std::vector<MainloopComponentStats> &aStats)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_MAINLOOP_STATS, aStats);
+}
+
+ClientError ThreadApiDBus::GetBackboneRouterCounters(BackboneRouterCounters &aCounters)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_BACKBONE_ROUTER_COUNTERS, aCounters);
+}
+
+ClientError ThreadApiDBus::GetRcpLinkStats(RcpLinkStats &aStats)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_RCP_LINK_STATS, aStats);
+}
+
+ClientError ThreadApiDBus::GetMemoryStats(std::vector<MemoryUsage> &aUsages)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_MEMORY_STATS, aUsages);
+}
+
+ClientError ThreadApiDBus::GetMetrics(std::vector<MetricSample> &aSamples)
+{
+    return GetProperty(OTBR_DBUS_PROPERTY_METRICS, aSamples);
+}
+
 std::string ThreadApiDBus::GetInterfaceName(void)
 {
     return mInterfaceName;
@@ -689,6 +1321,19 @@ template <typename ValType> ClientError ThreadApiDBus::GetProperty(const std::st
     DBusMessageIter iter;
 
     dbus_error_init(&error);
+
+    {
+        auto cached = mPropertyCache.find(aPropertyName);
+
+        if (cached != mPropertyCache.end())
+        {
+            iter = cached->second.mVariantIter;
+            VerifyOrExit(DBus::DBusMessageExtractFromVariant(&iter, aValue) == OTBR_ERROR_NONE,
+                         ret = ClientError::ERROR_DBUS);
+            ExitNow();
+        }
+    }
+
     VerifyOrExit(message != nullptr, ret = ClientError::OT_ERROR_FAILED);
     otbr::DBus::TupleToDBusMessage(*message, std::tie(OTBR_DBUS_THREAD_INTERFACE, aPropertyName));
     reply = DBus::UniqueDBusMessage(
@@ -705,6 +1350,197 @@ exit:
     return ret;
 }
 
+ClientError ThreadApiDBus::SetPropertyCacheEnabled(bool aEnabled)
+{
+    std::vector<std::string> propertyNames(std::begin(kCachedProperties), std::end(kCachedProperties));
+    UniqueDBusMessage        reply = nullptr;
+    DBusMessageIter          iter;
+    DBusMessageIter          subIter;
+    ClientError              ret = ClientError::ERROR_NONE;
+
+    mPropertyCache.clear();
+    mPropertyCacheEnabled = false;
+    VerifyOrExit(aEnabled);
+
+    // Signals received since are only processed after this call, so they overwrite these values.
+    SuccessOrExit(ret = CallGetProperties(propertyNames, reply));
+    VerifyOrExit(dbus_message_iter_init(reply.get(), &iter), ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY, ret = ClientError::ERROR_DBUS);
+    dbus_message_iter_recurse(&iter, &subIter);
+
+    {
+        std::shared_ptr<DBusMessage> message(reply.release(), dbus_message_unref);
+
+        for (const std::string &propertyName : propertyNames)
+        {
+            VerifyOrExit(dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_VARIANT, ret = ClientError::ERROR_DBUS);
+            CacheProperty(propertyName, message, subIter);
+            dbus_message_iter_next(&subIter);
+        }
+    }
+
+    mPropertyCacheEnabled = true;
+
+exit:
+    if (!mPropertyCacheEnabled)
+    {
+        mPropertyCache.clear();
+    }
+
+    return ret;
+}
+
+void ThreadApiDBus::CacheProperty(const std::string &           aPropertyName,
+                                  std::shared_ptr<DBusMessage> &aMessage,
+                                  const DBusMessageIter &       aVariantIter)
+{
+    CachedProperty &property = mPropertyCache[aPropertyName];
+
+    // The iterator stays valid as long as the message it points into is kept.
+    property.mMessage     = aMessage;
+    property.mVariantIter = aVariantIter;
+}
+
+ClientError ThreadApiDBus::CallGetPropertyAsync(const std::string &aPropertyName, ReplyHandler aHandler)
+{
+    UniqueDBusMessage message(dbus_message_new_method_call((OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(),
+                                                           (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+                                                           DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTY_GET_METHOD));
+    ClientError       ret = ClientError::ERROR_NONE;
+
+    VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(TupleToDBusMessage(*message, std::tie(OTBR_DBUS_THREAD_INTERFACE, aPropertyName)) == OTBR_ERROR_NONE,
+                 ret = ClientError::ERROR_DBUS);
+    ret = SendWithReply(message.get(), std::move(aHandler));
+
+exit:
+    return ret;
+}
+
+ClientError ThreadApiDBus::SendWithReply(DBusMessage *aMessage, ReplyHandler aHandler)
+{
+    ClientError      ret     = ClientError::ERROR_NONE;
+    DBusPendingCall *pending = nullptr;
+    AsyncCall *      call    = nullptr;
+
+    VerifyOrExit(dbus_connection_send_with_reply(mConnection, aMessage, &pending, DBUS_TIMEOUT_USE_DEFAULT) &&
+                     pending != nullptr,
+                 ret = ClientError::ERROR_DBUS);
+
+    call = new AsyncCall{this, std::move(aHandler)};
+
+    if (!dbus_pending_call_set_notify(pending, sHandleAsyncReply, call, sFreeAsyncCall))
+    {
+        delete call;
+        dbus_pending_call_cancel(pending);
+        dbus_pending_call_unref(pending);
+        ExitNow(ret = ClientError::ERROR_DBUS);
+    }
+
+    mAsyncCalls.insert(pending);
+
+exit:
+    return ret;
+}
+
+void ThreadApiDBus::sHandleAsyncReply(DBusPendingCall *aPending, void *aAsyncCall)
+{
+    AsyncCall *       call = static_cast<AsyncCall *>(aAsyncCall);
+    UniqueDBusMessage reply(dbus_pending_call_steal_reply(aPending));
+    ClientError       error;
+
+    error = (reply == nullptr) ? ClientError::ERROR_DBUS : CheckErrorMessage(reply.get());
+    call->mApi->mAsyncCalls.erase(aPending);
+    call->mHandler(error, reply.get());
+
+    // This is the last reference, which frees the call context.
+    dbus_pending_call_unref(aPending);
+}
+
+void ThreadApiDBus::sFreeAsyncCall(void *aAsyncCall)
+{
+    delete static_cast<AsyncCall *>(aAsyncCall);
+}
+
+ClientError ThreadApiDBus::CallGetProperties(const std::vector<std::string> &aPropertyNames, UniqueDBusMessage &aReply)
+{
+    return CallPropertiesMethod(OTBR_DBUS_GET_PROPERTIES_METHOD, aPropertyNames, aReply);
+}
+
+ClientError ThreadApiDBus::CallPropertiesMethod(const char *                    aMethodName,
+                                                const std::vector<std::string> &aPropertyNames,
+                                                UniqueDBusMessage &             aReply)
+{
+    ClientError       ret     = ClientError::ERROR_NONE;
+    UniqueDBusMessage message = UniqueDBusMessage(dbus_message_new_method_call(
+        (OTBR_DBUS_SERVER_PREFIX + mInterfaceName).c_str(), (OTBR_DBUS_OBJECT_PREFIX + mInterfaceName).c_str(),
+        OTBR_DBUS_THREAD_INTERFACE, aMethodName));
+    DBusError         error;
+
+    dbus_error_init(&error);
+    VerifyOrExit(message != nullptr, ret = ClientError::ERROR_DBUS);
+    VerifyOrExit(TupleToDBusMessage(*message, std::tie(aPropertyNames)) == OTBR_ERROR_NONE,
+                 ret = ClientError::ERROR_DBUS);
+    aReply = UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(mConnection, message.get(), DBUS_TIMEOUT_USE_DEFAULT, &error));
+    VerifyOrExit(!dbus_error_is_set(&error), ret = DBus::ConvertFromDBusErrorName(error.message));
+    VerifyOrExit(aReply != nullptr, ret = ClientError::ERROR_DBUS);
+    ret = DBus::CheckErrorMessage(aReply.get());
+exit:
+    dbus_error_free(&error);
+    return ret;
+}
+
+ClientError ThreadApiDBus::CallExportProperties(const std::vector<std::string> &aPropertyNames,
+                                                UniqueDBusMessage &             aData)
+{
+    ClientError       ret   = ClientError::ERROR_NONE;
+    UniqueDBusMessage reply = nullptr;
+    std::vector<char> buffer;
+    int               fd = -1;
+    DBusError         error;
+
+    dbus_error_init(&error);
+    VerifyOrExit(dbus_connection_can_send_type(mConnection, DBUS_TYPE_UNIX_FD),
+                 ret = ClientError::OT_ERROR_NOT_CAPABLE);
+    SuccessOrExit(ret = CallPropertiesMethod(OTBR_DBUS_EXPORT_PROPERTIES_METHOD, aPropertyNames, reply));
+    VerifyOrExit(dbus_message_get_args(reply.get(), &error, DBUS_TYPE_UNIX_FD, &fd, DBUS_TYPE_INVALID),
+                 ret = ClientError::ERROR_DBUS);
+
+    while (true)
+    {
+        size_t  offset = buffer.size();
+        ssize_t rval;
+
+        buffer.resize(offset + kExportReadSize);
+        rval = read(fd, &buffer[offset], kExportReadSize);
+        buffer.resize(offset + static_cast<size_t>(std::max<ssize_t>(rval, 0)));
+
+        if (rval < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        VerifyOrExit(rval >= 0, ret = ClientError::ERROR_DBUS);
+
+        if (rval == 0)
+        {
+            break;
+        }
+    }
+
+    aData = UniqueDBusMessage(dbus_message_demarshal(buffer.data(), static_cast<int>(buffer.size()), &error));
+    VerifyOrExit(aData != nullptr, ret = ClientError::ERROR_DBUS);
+
+exit:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+    dbus_error_free(&error);
+    return ret;
+}
+
 template <void (ThreadApiDBus::*Handler)(DBusPendingCall *aPending)>
 void ThreadApiDBus::sHandleDBusPendingCall(DBusPendingCall *aPending, void *aThreadApiDBus)
 {
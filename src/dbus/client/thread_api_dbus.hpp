@@ -34,12 +34,19 @@
 #ifndef OTBR_THREAD_API_DBUS_HPP_
 #define OTBR_THREAD_API_DBUS_HPP_
 
+#include <chrono>
 #include <functional>
+#include <map>
+#include <memory>
+#include <set>
+
+#include <sys/select.h>
 
 #include <dbus/dbus.h>
 
 #include "common/types.hpp"
 #include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
 #include "dbus/common/error.hpp"
 #include "dbus/common/types.hpp"
 
@@ -51,9 +58,15 @@ bool IsThreadActive(DeviceRole aRole);
 class ThreadApiDBus
 {
 public:
-    using DeviceRoleHandler = std::function<void(DeviceRole)>;
-    using ScanHandler       = std::function<void(const std::vector<ActiveScanResult> &)>;
-    using OtResultHandler   = std::function<void(ClientError)>;
+    using DeviceRoleHandler           = std::function<void(DeviceRole)>;
+    using ScanHandler                 = std::function<void(const std::vector<ActiveScanResult> &)>;
+    using ScanResultHandler           = std::function<void(const ActiveScanResult *)>;
+    using EnergyScanResultHandler     = std::function<void(const EnergyScanResult *)>;
+    using ChannelSurveyHandler        = std::function<void(ClientError, const ChannelSurvey &)>;
+    using OtResultHandler             = std::function<void(ClientError)>;
+    using ChildTableChangedHandler    = std::function<void(uint32_t, TableEvent, const ChildInfo &)>;
+    using NeighborTableChangedHandler = std::function<void(uint32_t, TableEvent, const NeighborInfo &)>;
+    using JoinerEventHandler          = std::function<void(const JoinerEvent &)>;
 
     /**
      * The constructor of a d-bus object.
@@ -74,6 +87,54 @@ public:
      */
     ThreadApiDBus(DBusConnection *aConnection, const std::string &aInterfaceName);
 
+    /**
+     * The destructor of a d-bus object.
+     *
+     * Outstanding asynchronous calls are cancelled without calling their handlers.
+     *
+     */
+    ~ThreadApiDBus(void);
+
+    /**
+     * This method lets an external event loop drive the dbus connection.
+     *
+     * After this call, the connection is polled through `UpdateFdSet()` and `Process()` instead of
+     * `dbus_connection_read_write_dispatch()`, so that replies of many outstanding asynchronous calls, e.g.
+     * `GetPropertyAsync()`, are handled as they arrive without blocking the caller. Only one `ThreadApiDBus` may do
+     * this for a connection.
+     *
+     * @retval ERROR_NONE successfully attached to the event loop
+     * @retval ERROR_DBUS failed to set the watch or timeout functions of the connection
+     *
+     */
+    ClientError AttachToEventLoop(void);
+
+    /**
+     * This method updates the file descriptor sets and timeout for select().
+     *
+     * @param[inout]    aReadFdSet   The read file descriptors.
+     * @param[inout]    aWriteFdSet  The write file descriptors.
+     * @param[inout]    aErrorFdSet  The error file descriptors.
+     * @param[inout]    aMaxFd       The max file descriptor.
+     * @param[inout]    aTimeout     The select timeout.
+     *
+     */
+    void UpdateFdSet(fd_set &        aReadFdSet,
+                     fd_set &        aWriteFdSet,
+                     fd_set &        aErrorFdSet,
+                     int &           aMaxFd,
+                     struct timeval &aTimeout);
+
+    /**
+     * This method processes the dbus I/O and dispatches the received messages.
+     *
+     * @param[in]   aReadFdSet   The read file descriptors.
+     * @param[in]   aWriteFdSet  The write file descriptors.
+     * @param[in]   aErrorFdSet  The error file descriptors.
+     *
+     */
+    void Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet);
+
     /**
      * This method adds a callback for device role change.
      *
@@ -82,6 +143,36 @@ public:
      */
     void AddDeviceRoleHandler(const DeviceRoleHandler &aHandler);
 
+    /**
+     * This method adds a callback for each child added to or removed from the child table.
+     *
+     * The handler is called with the sequence number of the change, the event and the child. When a sequence
+     * number is skipped, a change was missed and the whole table should be read again, together with its sequence
+     * number by `GetProperties()`, see `GetChildTableSequence()`.
+     *
+     * @param[in]   aHandler  The child table handler.
+     *
+     */
+    void AddChildTableChangedHandler(const ChildTableChangedHandler &aHandler);
+
+    /**
+     * This method adds a callback for each neighbor added to or removed from the neighbor table.
+     *
+     * The sequence numbers are handled as for `AddChildTableChangedHandler()`.
+     *
+     * @param[in]   aHandler  The neighbor table handler.
+     *
+     */
+    void AddNeighborTableChangedHandler(const NeighborTableChangedHandler &aHandler);
+
+    /**
+     * This method adds a callback for the progress of the joiners added by `AddJoiners()`.
+     *
+     * @param[in]   aHandler  The joiner event handler.
+     *
+     */
+    void AddJoinerEventHandler(const JoinerEventHandler &aHandler);
+
     /**
      * This method permits unsecure join on port.
      *
@@ -95,6 +186,19 @@ public:
      */
     ClientError PermitUnsecureJoin(uint16_t aPort, uint32_t aSeconds);
 
+    /**
+     * This method permits unsecure join on several ports, e.g. one per joiner of a multi-joiner commissioning.
+     *
+     * @param[in]   aPorts    The port numbers.
+     * @param[in]   aSeconds  The timeout to close the ports, 0 to close them now.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError PermitUnsecureJoin(const std::vector<uint16_t> &aPorts, uint32_t aSeconds);
+
     /**
      * This method performs a Thread network scan.
      *
@@ -107,6 +211,53 @@ public:
      */
     ClientError Scan(const ScanHandler &aHandler);
 
+    /**
+     * This method performs a Thread network scan and reports each result as it arrives.
+     *
+     * The handler is called with every result, and once more with a null result when the scan finishes.
+     *
+     * @param[in]   aHandler  The scan result handler.
+     *
+     * @retval ERROR_NONE successfully started the scan
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError StreamScan(const ScanResultHandler &aHandler);
+
+    /**
+     * This method performs an energy scan and reports the result of each channel as it is scanned.
+     *
+     * The handler is called the same way as by `StreamScan()`.
+     *
+     * @param[in]   aScanChannels   A bitmask of the channels to scan, 0 for all supported channels.
+     * @param[in]   aScanDuration   The time in milliseconds to spend scanning each channel, 0 for the default.
+     * @param[in]   aHandler        The energy scan result handler.
+     *
+     * @retval ERROR_NONE successfully started the energy scan
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError StreamEnergyScan(uint32_t                       aScanChannels,
+                                 uint16_t                       aScanDuration,
+                                 const EnergyScanResultHandler &aHandler);
+
+    /**
+     * This method reports the quality of all supported channels, merging the channel monitor, the CCA failure rate
+     * and an energy scan.
+     *
+     * @param[in]   aEnergyScan     Whether to run a new energy scan, the last one is reported otherwise.
+     * @param[in]   aScanDuration   The time in milliseconds to spend scanning each channel, 0 for the default.
+     * @param[in]   aHandler        The channel survey handler.
+     *
+     * @retval ERROR_NONE successfully requested the survey
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError SurveyChannels(bool aEnergyScan, uint16_t aScanDuration, const ChannelSurveyHandler &aHandler);
+
     /**
      * This method attaches the device to the Thread network.
      * @param[in]   aNetworkName    The network name.
@@ -145,6 +296,21 @@ public:
      */
     ClientError Attach(const OtResultHandler &aHandler);
 
+    /**
+     * This method attaches the device to the Thread network of a complete Active Operational Dataset.
+     *
+     * The dataset is committed in one step, e.g. to provision a device with a single call.
+     *
+     * @param[in]   aDatasetTlvs    The Active Operational Dataset, encoded in TLVs.
+     * @param[in]   aHandler        The attach result handler.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError AttachDataset(const std::vector<uint8_t> &aDatasetTlvs, const OtResultHandler &aHandler);
+
     /**
      * This method performs a factory reset.
      *
@@ -167,6 +333,32 @@ public:
      */
     ClientError Reset(void);
 
+    /**
+     * This method applies the agent configuration file again.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError ReloadConfig(void);
+
+    /**
+     * This method gets the children attaching and detaching and the parent, role and partition changes in a time
+     * range.
+     *
+     * @param[in]   aSince      The start of the range, in milliseconds since the Unix epoch, included.
+     * @param[in]   aUntil      The end of the range, in milliseconds since the Unix epoch, excluded. 0 for no end.
+     * @param[out]  aEvents     The events in the range, oldest first.
+     * @param[out]  aDropped    The number of events the server dropped because its log was full.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetChurnEvents(uint64_t aSince, uint64_t aUntil, std::vector<ChurnEvent> &aEvents, uint32_t &aDropped);
+
     /**
      * This method triggers a thread join process.
      *
@@ -203,6 +395,21 @@ public:
      */
     ClientError JoinerStop(void);
 
+    /**
+     * This method adds a batch of joiners to the commissioner, starting the commissioner if it is disabled.
+     *
+     * The joiners are added together, their progress is then reported to the joiner event handlers.
+     *
+     * @param[in]   aJoiners  The joiners to add.
+     * @param[out]  aErrors   The OpenThread error of adding each joiner, in the order of @p aJoiners.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError AddJoiners(const std::vector<JoinerEntry> &aJoiners, std::vector<uint8_t> &aErrors);
+
     /**
      * This method adds a on-mesh address prefix.
      *
@@ -251,6 +458,29 @@ public:
      */
     ClientError RemoveExternalRoute(const Ip6Prefix &aPrefix);
 
+    /**
+     * This method adds and removes several on-mesh prefixes and external routes, registering the network data once.
+     *
+     * The removals are done before the additions, so a prefix or a route is replaced by removing and adding it in
+     * the same call.
+     *
+     * @param[in]   aAddedPrefixes      The on-mesh prefixes to add.
+     * @param[in]   aRemovedPrefixes    The on-mesh prefixes to remove.
+     * @param[in]   aAddedRoutes        The external routes to add.
+     * @param[in]   aRemovedRoutes      The external routes to remove.
+     * @param[out]  aErrors             The OpenThread error of each change, in the order of the arguments.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError UpdateNetworkData(const std::vector<OnMeshPrefix> & aAddedPrefixes,
+                                  const std::vector<Ip6Prefix> &    aRemovedPrefixes,
+                                  const std::vector<ExternalRoute> &aAddedRoutes,
+                                  const std::vector<Ip6Prefix> &    aRemovedRoutes,
+                                  std::vector<uint8_t> &            aErrors);
+
     /**
      * This method sets the mesh-local prefix.
      *
@@ -576,6 +806,30 @@ public:
      */
     ClientError GetNeighborTable(std::vector<NeighborInfo> &aNeighborTable);
 
+    /**
+     * This method gets the sequence number of the last child table change.
+     *
+     * @param[out]  aSequence   The sequence number.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetChildTableSequence(uint32_t &aSequence);
+
+    /**
+     * This method gets the sequence number of the last neighbor table change.
+     *
+     * @param[out]  aSequence   The sequence number.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetNeighborTableSequence(uint32_t &aSequence);
+
     /**
      * This method gets the network's parition id.
      *
@@ -648,6 +902,181 @@ public:
      */
     ClientError GetRadioRegion(std::string &aRadioRegion);
 
+    /**
+     * This method gets the latency statistics of the mainloop components.
+     *
+     * @param[out]  aStats  The statistics of each component phase.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetMainloopStats(std::vector<MainloopComponentStats> &aStats);
+
+    /**
+     * This method gets the counters of the Backbone Router and its ND proxy.
+     *
+     * @param[out]  aCounters   The Backbone Router counters.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetBackboneRouterCounters(BackboneRouterCounters &aCounters);
+
+    /**
+     * This method gets the statistics of the spinel link to the RCP.
+     *
+     * @param[out]  aStats      The RCP link statistics.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetRcpLinkStats(RcpLinkStats &aStats);
+
+    /**
+     * This method gets the heap memory usage of each subsystem of the agent.
+     *
+     * @param[out]  aUsages     The memory usage of each subsystem.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise, NotImplemented if the agent is built without
+     *                    memory accounting
+     *
+     */
+    ClientError GetMemoryStats(std::vector<MemoryUsage> &aUsages);
+
+    /**
+     * This method gets a snapshot of the agent metrics.
+     *
+     * @param[out]  aSamples    The metric values, histograms are reported by their count, sum and maximum.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError GetMetrics(std::vector<MetricSample> &aSamples);
+
+    /**
+     * This method enables or disables the cache of the properties the server signals the changes of.
+     *
+     * When enabled, the values of the device role, network name, PAN ID, extended PAN ID, channel, RLOC16 and
+     * partition ID are read once, and then kept up to date with the PropertiesChanged signals of the server. Their
+     * getters are answered from the cache without a bus call. The signals are only received when the connection is
+     * dispatched, e.g. with `dbus_connection_read_write_dispatch()`.
+     *
+     * @param[in]   aEnabled    Whether to enable the cache.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    ClientError SetPropertyCacheEnabled(bool aEnabled);
+
+    /**
+     * This method gets several properties in one call, instead of one call per property.
+     *
+     * @param[in]   aPropertyNames  The names of the properties, e.g. `OTBR_DBUS_PROPERTY_CHANNEL`.
+     * @param[out]  aValues         The value of each property, in the order of @p aPropertyNames.
+     *
+     * @retval ERROR_NONE successfully performed the dbus function call
+     * @retval ERROR_DBUS dbus encode/decode error
+     * @retval ...        OpenThread defined error value otherwise
+     *
+     */
+    template <typename... ValTypes>
+    ClientError GetProperties(const std::vector<std::string> &aPropertyNames, ValTypes &... aValues)
+    {
+        UniqueDBusMessage reply = nullptr;
+        DBusMessageIter   iter;
+        DBusMessageIter   subIter;
+        ClientError       ret;
+
+        VerifyOrExit(aPropertyNames.size() == sizeof...(ValTypes), ret = ClientError::OT_ERROR_INVALID_ARGS);
+        SuccessOrExit(ret = CallGetProperties(aPropertyNames, reply));
+        VerifyOrExit(dbus_message_iter_init(reply.get(), &iter), ret = ClientError::ERROR_DBUS);
+        VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY, ret = ClientError::ERROR_DBUS);
+        dbus_message_iter_recurse(&iter, &subIter);
+        ret = ExtractProperties(&subIter, aValues...);
+
+    exit:
+        return ret;
+    }
+
+    /**
+     * This method gets several properties through a file descriptor instead of through the bus daemon.
+     *
+     * This is meant for large values, e.g. the child table. The bus daemon only passes the file descriptor, and the
+     * values are read from it directly. The connection must be able to pass file descriptors.
+     *
+     * @param[in]   aPropertyNames  The names of the properties, e.g. `OTBR_DBUS_PROPERTY_CHILD_TABLE`.
+     * @param[out]  aValues         The value of each property, in the order of @p aPropertyNames.
+     *
+     * @retval ERROR_NONE           successfully performed the dbus function call
+     * @retval ERROR_DBUS           dbus encode/decode error
+     * @retval OT_ERROR_NOT_CAPABLE the connection cannot pass file descriptors
+     * @retval ...                  OpenThread defined error value otherwise
+     *
+     */
+    template <typename... ValTypes>
+    ClientError ExportProperties(const std::vector<std::string> &aPropertyNames, ValTypes &... aValues)
+    {
+        UniqueDBusMessage data = nullptr;
+        DBusMessageIter   iter;
+        DBusMessageIter   subIter;
+        ClientError       ret;
+
+        VerifyOrExit(aPropertyNames.size() == sizeof...(ValTypes), ret = ClientError::OT_ERROR_INVALID_ARGS);
+        SuccessOrExit(ret = CallExportProperties(aPropertyNames, data));
+        VerifyOrExit(dbus_message_iter_init(data.get(), &iter), ret = ClientError::ERROR_DBUS);
+        VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY, ret = ClientError::ERROR_DBUS);
+        dbus_message_iter_recurse(&iter, &subIter);
+        ret = ExtractProperties(&subIter, aValues...);
+
+    exit:
+        return ret;
+    }
+
+    /**
+     * This method gets a property without waiting for the reply.
+     *
+     * Any number of calls may be outstanding on the connection, the handler of each is called when its reply is
+     * dispatched. The value type cannot be deduced from a lambda, so it must be given explicitly, e.g.
+     * `GetPropertyAsync<uint16_t>(OTBR_DBUS_PROPERTY_CHANNEL, handler)`.
+     *
+     * @param[in]   aPropertyName   The name of the property, e.g. `OTBR_DBUS_PROPERTY_CHANNEL`.
+     * @param[in]   aHandler        The handler called with the error and the value of the property.
+     *
+     * @retval ERROR_NONE successfully sent the dbus function call
+     * @retval ERROR_DBUS dbus encode error
+     *
+     */
+    template <typename ValType>
+    ClientError GetPropertyAsync(const std::string &                                      aPropertyName,
+                                 const std::function<void(ClientError, const ValType &)> &aHandler)
+    {
+        return CallGetPropertyAsync(aPropertyName, [aHandler](ClientError aError, DBusMessage *aReply) {
+            ValType         value{};
+            DBusMessageIter iter;
+
+            if (aError == ClientError::ERROR_NONE &&
+                (!dbus_message_iter_init(aReply, &iter) ||
+                 DBusMessageExtractFromVariant(&iter, value) != OTBR_ERROR_NONE))
+            {
+                aError = ClientError::ERROR_DBUS;
+            }
+
+            aHandler(aError, value);
+        });
+    }
+
     /**
      * This method returns the network interface name the client is bound to.
      *
@@ -657,6 +1086,26 @@ public:
     std::string GetInterfaceName(void);
 
 private:
+    using ReplyHandler = std::function<void(ClientError aError, DBusMessage *aReply)>;
+
+    struct AsyncCall
+    {
+        ThreadApiDBus *mApi;
+        ReplyHandler   mHandler;
+    };
+
+    ClientError CallGetPropertyAsync(const std::string &aPropertyName, ReplyHandler aHandler);
+    ClientError SendWithReply(DBusMessage *aMessage, ReplyHandler aHandler);
+    static void sHandleAsyncReply(DBusPendingCall *aPending, void *aAsyncCall);
+    static void sFreeAsyncCall(void *aAsyncCall);
+
+    static dbus_bool_t sAddWatch(DBusWatch *aWatch, void *aThreadApiDBus);
+    static void        sRemoveWatch(DBusWatch *aWatch, void *aThreadApiDBus);
+    static void        sToggleWatch(DBusWatch *aWatch, void *aThreadApiDBus);
+    static dbus_bool_t sAddTimeout(DBusTimeout *aTimeout, void *aThreadApiDBus);
+    static void        sRemoveTimeout(DBusTimeout *aTimeout, void *aThreadApiDBus);
+    static void        sToggleTimeout(DBusTimeout *aTimeout, void *aThreadApiDBus);
+
     ClientError CallDBusMethodSync(const std::string &aMethodName);
     ClientError CallDBusMethodAsync(const std::string &aMethodName, DBusPendingCallNotifyFunction aFunction);
 
@@ -671,9 +1120,37 @@ private:
 
     template <typename ValType> ClientError GetProperty(const std::string &aPropertyName, ValType &aValue);
 
+    ClientError CallGetProperties(const std::vector<std::string> &aPropertyNames, UniqueDBusMessage &aReply);
+    ClientError CallPropertiesMethod(const char *                    aMethodName,
+                                     const std::vector<std::string> &aPropertyNames,
+                                     UniqueDBusMessage &             aReply);
+    ClientError CallExportProperties(const std::vector<std::string> &aPropertyNames, UniqueDBusMessage &aData);
+
+    ClientError ExtractProperties(DBusMessageIter *aIter)
+    {
+        return dbus_message_iter_get_arg_type(aIter) == DBUS_TYPE_INVALID ? ClientError::ERROR_NONE
+                                                                          : ClientError::ERROR_DBUS;
+    }
+
+    template <typename ValType, typename... ValTypes>
+    ClientError ExtractProperties(DBusMessageIter *aIter, ValType &aValue, ValTypes &... aValues)
+    {
+        ClientError ret = ClientError::ERROR_NONE;
+
+        VerifyOrExit(DBusMessageExtractFromVariant(aIter, aValue) == OTBR_ERROR_NONE, ret = ClientError::ERROR_DBUS);
+        dbus_message_iter_next(aIter);
+        ret = ExtractProperties(aIter, aValues...);
+
+    exit:
+        return ret;
+    }
+
     ClientError              SubscribeDeviceRoleSignal(void);
     static DBusHandlerResult sDBusMessageFilter(DBusConnection *aConnection, DBusMessage *aMessage, void *aData);
     DBusHandlerResult        DBusMessageFilter(DBusConnection *aConnection, DBusMessage *aMessage);
+    void                     HandleTableChangedSignal(DBusMessage *aMessage);
+    bool                     HandleScanSignal(DBusMessage *aMessage);
+    bool                     HandleJoinerEventSignal(DBusMessage *aMessage);
 
     template <void (ThreadApiDBus::*Handler)(DBusPendingCall *aPending)>
     static void sHandleDBusPendingCall(DBusPendingCall *aPending, void *aThreadApiDBus);
@@ -683,19 +1160,45 @@ private:
     void        JoinerStartPendingCallHandler(DBusPendingCall *aPending);
     static void sScanPendingCallHandler(DBusPendingCall *aPending, void *aThreadApiDBus);
     void        ScanPendingCallHandler(DBusPendingCall *aPending);
+    void        SurveyChannelsPendingCallHandler(DBusPendingCall *aPending);
 
     static void EmptyFree(void *aData) { (void)aData; }
 
+    void CacheProperty(const std::string &           aPropertyName,
+                       std::shared_ptr<DBusMessage> &aMessage,
+                       const DBusMessageIter &       aVariantIter);
+
     std::string mInterfaceName;
 
     DBusConnection *mConnection;
 
-    ScanHandler     mScanHandler;
-    OtResultHandler mAttachHandler;
-    OtResultHandler mFactoryResetHandler;
-    OtResultHandler mJoinerHandler;
-
-    std::vector<DeviceRoleHandler> mDeviceRoleHandlers;
+    ScanHandler             mScanHandler;
+    ScanResultHandler       mScanResultHandler;
+    EnergyScanResultHandler mEnergyScanResultHandler;
+    ChannelSurveyHandler    mChannelSurveyHandler;
+    OtResultHandler         mAttachHandler;
+    OtResultHandler         mFactoryResetHandler;
+    OtResultHandler         mJoinerHandler;
+
+    std::vector<DeviceRoleHandler>           mDeviceRoleHandlers;
+    std::vector<ChildTableChangedHandler>    mChildTableChangedHandlers;
+    std::vector<NeighborTableChangedHandler> mNeighborTableChangedHandlers;
+    std::vector<JoinerEventHandler>          mJoinerEventHandlers;
+
+    // The last known value of a property, a variant in a message received from the server
+    struct CachedProperty
+    {
+        std::shared_ptr<DBusMessage> mMessage;
+        DBusMessageIter              mVariantIter;
+    };
+
+    bool                                  mPropertyCacheEnabled;
+    std::map<std::string, CachedProperty> mPropertyCache;
+
+    std::set<DBusPendingCall *>                                    mAsyncCalls;
+    bool                                                           mEventLoopAttached;
+    std::set<DBusWatch *>                                          mWatches;
+    std::map<DBusTimeout *, std::chrono::steady_clock::time_point> mTimeouts;
 };
 
 } // namespace DBus
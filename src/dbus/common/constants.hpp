@@ -45,16 +45,36 @@
 #define OTBR_DBUS_OBJECT_PREFIX "/io/openthread/BorderRouter/"
 
 #define OTBR_DBUS_SCAN_METHOD "Scan"
+#define OTBR_DBUS_STREAM_SCAN_METHOD "StreamScan"
+#define OTBR_DBUS_ENERGY_SCAN_METHOD "EnergyScan"
+#define OTBR_DBUS_STREAM_ENERGY_SCAN_METHOD "StreamEnergyScan"
+#define OTBR_DBUS_SURVEY_CHANNELS_METHOD "SurveyChannels"
 #define OTBR_DBUS_ATTACH_METHOD "Attach"
+#define OTBR_DBUS_ATTACH_DATASET_METHOD "AttachDataset"
 #define OTBR_DBUS_FACTORY_RESET_METHOD "FactoryReset"
 #define OTBR_DBUS_RESET_METHOD "Reset"
 #define OTBR_DBUS_ADD_ON_MESH_PREFIX_METHOD "AddOnMeshPrefix"
 #define OTBR_DBUS_REMOVE_ON_MESH_PREFIX_METHOD "RemoveOnMeshPrefix"
 #define OTBR_DBUS_PERMIT_UNSECURE_JOIN_METHOD "PermitUnsecureJoin"
+#define OTBR_DBUS_PERMIT_UNSECURE_JOIN_PORTS_METHOD "PermitUnsecureJoinPorts"
 #define OTBR_DBUS_JOINER_START_METHOD "JoinerStart"
 #define OTBR_DBUS_JOINER_STOP_METHOD "JoinerStop"
+#define OTBR_DBUS_ADD_JOINERS_METHOD "AddJoiners"
 #define OTBR_DBUS_ADD_EXTERNAL_ROUTE_METHOD "AddExternalRoute"
 #define OTBR_DBUS_REMOVE_EXTERNAL_ROUTE_METHOD "RemoveExternalRoute"
+#define OTBR_DBUS_UPDATE_NETWORK_DATA_METHOD "UpdateNetworkData"
+#define OTBR_DBUS_GET_PROPERTIES_METHOD "GetProperties"
+#define OTBR_DBUS_EXPORT_PROPERTIES_METHOD "ExportProperties"
+#define OTBR_DBUS_RELOAD_CONFIG_METHOD "ReloadConfig"
+#define OTBR_DBUS_GET_CHURN_EVENTS_METHOD "GetChurnEvents"
+
+#define OTBR_DBUS_CHILD_TABLE_CHANGED_SIGNAL "ChildTableChanged"
+#define OTBR_DBUS_NEIGHBOR_TABLE_CHANGED_SIGNAL "NeighborTableChanged"
+#define OTBR_DBUS_SCAN_RESULT_SIGNAL "ScanResult"
+#define OTBR_DBUS_SCAN_FINISHED_SIGNAL "ScanFinished"
+#define OTBR_DBUS_ENERGY_SCAN_RESULT_SIGNAL "EnergyScanResult"
+#define OTBR_DBUS_ENERGY_SCAN_FINISHED_SIGNAL "EnergyScanFinished"
+#define OTBR_DBUS_JOINER_EVENT_SIGNAL "JoinerEvent"
 
 #define OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX "MeshLocalPrefix"
 #define OTBR_DBUS_PROPERTY_LEGACY_ULA_PREFIX "LegacyULAPrefix"
@@ -86,6 +106,15 @@
 #define OTBR_DBUS_PROPERTY_EXTERNAL_ROUTES "ExternalRoutes"
 #define OTBR_DBUS_PROPERTY_ACTIVE_DATASET_TLVS "ActiveDatasetTlvs"
 #define OTBR_DBUS_PROPERTY_RADIO_REGION "RadioRegion"
+#define OTBR_DBUS_PROPERTY_MAINLOOP_STATS "MainloopStats"
+#define OTBR_DBUS_PROPERTY_BACKBONE_ROUTER_COUNTERS "BackboneRouterCounters"
+#define OTBR_DBUS_PROPERTY_RCP_LINK_STATS "RcpLinkStats"
+#define OTBR_DBUS_PROPERTY_MEMORY_STATS "MemoryStats"
+#define OTBR_DBUS_PROPERTY_METRICS "Metrics"
+#define OTBR_DBUS_PROPERTY_CHILD_TABLE_SEQUENCE "ChildTableSequence"
+#define OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_SEQUENCE "NeighborTableSequence"
+#define OTBR_DBUS_PROPERTY_VERSION "Version"
+#define OTBR_DBUS_PROPERTY_EUI64 "Eui64"
 
 #define OTBR_ROLE_NAME_DISABLED "disabled"
 #define OTBR_ROLE_NAME_DETACHED "detached"
@@ -93,4 +122,7 @@
 #define OTBR_ROLE_NAME_ROUTER "router"
 #define OTBR_ROLE_NAME_LEADER "leader"
 
+#define OTBR_TABLE_EVENT_NAME_ADDED "added"
+#define OTBR_TABLE_EVENT_NAME_REMOVED "removed"
+
 #endif // OTBR_DBUS_CONSTANTS_HPP_
@@ -36,6 +36,9 @@
 namespace otbr {
 namespace DBus {
 
+static uint32_t sDumpSampleInterval = 0;
+static uint32_t sDumpSampleCount    = 0;
+
 static void DumpDBusMessage(std::ostringstream &sout, DBusMessageIter *aIter)
 {
     int type = dbus_message_iter_get_arg_type(aIter);
@@ -165,17 +168,42 @@ static void DumpDBusMessage(std::ostringstream &sout, DBusMessageIter *aIter)
     return;
 }
 
-void DumpDBusMessage(DBusMessage &aMessage)
+void SetDBusMessageDumpSampleInterval(uint32_t aInterval)
+{
+    sDumpSampleInterval = aInterval;
+    sDumpSampleCount    = 0;
+}
+
+bool ShouldDumpDBusMessage(int &aLevel)
+{
+    bool shouldDump = false;
+
+    if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
+    {
+        aLevel     = OTBR_LOG_DEBUG;
+        shouldDump = true;
+    }
+    else if (sDumpSampleInterval != 0 && ++sDumpSampleCount >= sDumpSampleInterval)
+    {
+        sDumpSampleCount = 0;
+        aLevel           = OTBR_LOG_INFO;
+        shouldDump       = true;
+    }
+
+    return shouldDump;
+}
+
+void DumpDBusMessage(DBusMessage &aMessage, int aLevel)
 {
     DBusMessageIter    iter;
     std::ostringstream sout;
 
     VerifyOrExit(dbus_message_iter_init(&aMessage, &iter),
-                 otbrLog(OTBR_LOG_DEBUG, "Failed to iterate dbus message during dump"));
+                 otbrLog(aLevel, "Failed to iterate dbus message during dump"));
     sout << "{ ";
     DumpDBusMessage(sout, &iter);
     sout << "}";
-    otbrLog(OTBR_LOG_DEBUG, sout.str().c_str());
+    otbrLog(aLevel, "%s", sout.str().c_str());
 exit:
     return;
 }
@@ -34,17 +34,64 @@
 #ifndef OTBR_AGENT_DBUS_MESSAGE_DUMP_HPP_
 #define OTBR_AGENT_DBUS_MESSAGE_DUMP_HPP_
 
+#include <stdint.h>
+
 #include <dbus/dbus.h>
 
+#include "common/code_utils.hpp"
+
+#ifndef OTBR_ENABLE_DBUS_MESSAGE_DUMP
+#define OTBR_ENABLE_DBUS_MESSAGE_DUMP 1
+#endif
+
 namespace otbr {
 namespace DBus {
 
+/**
+ * This function makes one of every @p aInterval messages dumped at info level, when debug logging is off.
+ *
+ * @param[in] aInterval  The sampling interval, zero to only dump at debug level.
+ */
+void SetDBusMessageDumpSampleInterval(uint32_t aInterval);
+
+/**
+ * This function decides whether a message is dumped, and at which log level.
+ *
+ * @param[out] aLevel  The log level to dump at.
+ *
+ * @returns Whether to dump the message.
+ */
+bool ShouldDumpDBusMessage(int &aLevel);
+
+/**
+ * This function dumps a DBus message to the log at a given level.
+ *
+ * @param[in] aMessage  The DBus message to dump.
+ * @param[in] aLevel    The log level.
+ */
+void DumpDBusMessage(DBusMessage &aMessage, int aLevel);
+
 /**
  * This function dumps a DBus message to the log
  *
+ * The message is only iterated when it is logged, i.e. at debug level or when it is sampled. Building with
+ * `OTBR_ENABLE_DBUS_MESSAGE_DUMP` set to 0 removes the dump.
+ *
  * @param[in] aMessage  The DBus message to dump.
  */
-void DumpDBusMessage(DBusMessage &aMessage);
+inline void DumpDBusMessage(DBusMessage &aMessage)
+{
+#if OTBR_ENABLE_DBUS_MESSAGE_DUMP
+    int level;
+
+    if (ShouldDumpDBusMessage(level))
+    {
+        DumpDBusMessage(aMessage, level);
+    }
+#else
+    OTBR_UNUSED_VARIABLE(aMessage);
+#endif
+}
 
 } // namespace DBus
 } // namespace otbr
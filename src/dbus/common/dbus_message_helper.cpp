@@ -71,41 +71,6 @@ exit:
     return error;
 }
 
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint8_t> &aValue)
-{
-    return DBusMessageExtractPrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint16_t> &aValue)
-{
-    return DBusMessageExtractPrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint32_t> &aValue)
-{
-    return DBusMessageExtractPrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint64_t> &aValue)
-{
-    return DBusMessageExtractPrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int16_t> &aValue)
-{
-    return DBusMessageExtractPrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int32_t> &aValue)
-{
-    return DBusMessageExtractPrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int64_t> &aValue)
-{
-    return DBusMessageExtractPrimitive(aIter, aValue);
-}
-
 otbrError DBusMessageEncode(DBusMessageIter *aIter, bool aValue)
 {
     dbus_bool_t val   = aValue ? 1 : 0;
@@ -142,41 +107,6 @@ exit:
     return error;
 }
 
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint8_t> &aValue)
-{
-    return DBusMessageEncodePrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint16_t> &aValue)
-{
-    return DBusMessageEncodePrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint32_t> &aValue)
-{
-    return DBusMessageEncodePrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint64_t> &aValue)
-{
-    return DBusMessageEncodePrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<int16_t> &aValue)
-{
-    return DBusMessageEncodePrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<int32_t> &aValue)
-{
-    return DBusMessageEncodePrimitive(aIter, aValue);
-}
-
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<int64_t> &aValue)
-{
-    return DBusMessageEncodePrimitive(aIter, aValue);
-}
-
 bool IsDBusMessageEmpty(DBusMessage &aMessage)
 {
     DBusMessageIter iter;
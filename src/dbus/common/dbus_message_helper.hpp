@@ -37,6 +37,7 @@
 #include <array>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <vector>
 
 #include <dbus/dbus.h>
@@ -73,6 +74,28 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, const LeaderData &aLeaderDat
 otbrError DBusMessageExtract(DBusMessageIter *aIter, LeaderData &aLeaderData);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const ChannelQuality &aQuality);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, ChannelQuality &aQuality);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const EnergyScanResult &aResult);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, EnergyScanResult &aResult);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const ChannelReport &aReport);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, ChannelReport &aReport);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const ChannelSurvey &aSurvey);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, ChannelSurvey &aSurvey);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MainloopComponentStats &aStats);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MainloopComponentStats &aStats);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const BackboneRouterCounters &aCounters);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, BackboneRouterCounters &aCounters);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const RcpLinkStats &aStats);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, RcpLinkStats &aStats);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MemoryUsage &aUsage);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MemoryUsage &aUsage);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const MetricSample &aSample);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, MetricSample &aSample);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const JoinerEntry &aEntry);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, JoinerEntry &aEntry);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const JoinerEvent &aEvent);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, JoinerEvent &aEvent);
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const ChurnEvent &aEvent);
+otbrError DBusMessageExtract(DBusMessageIter *aIter, ChurnEvent &aEvent);
 
 template <typename T> struct DBusTypeTrait;
 
@@ -112,6 +135,24 @@ template <> struct DBusTypeTrait<Ip6Prefix>
     static constexpr const char *TYPE_AS_STRING = "(ayy)";
 };
 
+template <> struct DBusTypeTrait<std::vector<Ip6Prefix>>
+{
+    // array of {array of bytes, byte}
+    static constexpr const char *TYPE_AS_STRING = "a(ayy)";
+};
+
+template <> struct DBusTypeTrait<OnMeshPrefix>
+{
+    // struct of {{array of bytes, byte}, byte, {bool, bool, bool, bool, bool, bool, bool}}
+    static constexpr const char *TYPE_AS_STRING = "((ayy)y(bbbbbbb))";
+};
+
+template <> struct DBusTypeTrait<std::vector<OnMeshPrefix>>
+{
+    // array of {{array of bytes, byte}, byte, {bool, bool, bool, bool, bool, bool, bool}}
+    static constexpr const char *TYPE_AS_STRING = "a((ayy)y(bbbbbbb))";
+};
+
 template <> struct DBusTypeTrait<ExternalRoute>
 {
     // struct of {{array of bytes, byte}, uint16, byte, bool, bool}
@@ -170,6 +211,103 @@ template <> struct DBusTypeTrait<ChannelQuality>
     static constexpr const char *TYPE_AS_STRING = "(yq)";
 };
 
+template <> struct DBusTypeTrait<EnergyScanResult>
+{
+    // struct of { uint8, int8 }
+    static constexpr const char *TYPE_AS_STRING = "(yy)";
+};
+
+template <> struct DBusTypeTrait<ChannelReport>
+{
+    // struct of { uint8, uint16, int8 }
+    static constexpr const char *TYPE_AS_STRING = "(yqy)";
+};
+
+template <> struct DBusTypeTrait<ChannelSurvey>
+{
+    // struct of { array of struct of { uint8, uint16, int8 }, uint32, uint16, uint64, uint64 }
+    static constexpr const char *TYPE_AS_STRING = "(a(yqy)uqtt)";
+};
+
+template <> struct DBusTypeTrait<MainloopComponentStats>
+{
+    // struct of { string, uint64, uint64, uint64, uint64, array<uint64> }
+    static constexpr const char *TYPE_AS_STRING = "(sttttat)";
+};
+
+template <> struct DBusTypeTrait<std::vector<MainloopComponentStats>>
+{
+    // array of struct of { string, uint64, uint64, uint64, uint64, array<uint64> }
+    static constexpr const char *TYPE_AS_STRING = "a(sttttat)";
+};
+
+template <> struct DBusTypeTrait<BackboneRouterCounters>
+{
+    // struct of { uint64 x 13, array<uint64> }
+    static constexpr const char *TYPE_AS_STRING = "(tttttttttttttat)";
+};
+
+template <> struct DBusTypeTrait<RcpLinkStats>
+{
+    // struct of { uint64, uint64, uint32, uint32, uint64, uint64, uint64, uint32, uint32,
+    //             uint64 x 6, array<uint64> }
+    static constexpr const char *TYPE_AS_STRING = "(ttuutttuuttttttat)";
+};
+
+template <> struct DBusTypeTrait<MemoryUsage>
+{
+    // struct of { string, uint64, uint64, uint64 }
+    static constexpr const char *TYPE_AS_STRING = "(sttt)";
+};
+
+template <> struct DBusTypeTrait<std::vector<MemoryUsage>>
+{
+    // array of struct of { string, uint64, uint64, uint64 }
+    static constexpr const char *TYPE_AS_STRING = "a(sttt)";
+};
+
+template <> struct DBusTypeTrait<MetricSample>
+{
+    // struct of { string, string, uint64 }
+    static constexpr const char *TYPE_AS_STRING = "(sst)";
+};
+
+template <> struct DBusTypeTrait<std::vector<MetricSample>>
+{
+    // array of struct of { string, string, uint64 }
+    static constexpr const char *TYPE_AS_STRING = "a(sst)";
+};
+
+template <> struct DBusTypeTrait<JoinerEntry>
+{
+    // struct of { uint64, uint64, uint8, string, uint32 }
+    static constexpr const char *TYPE_AS_STRING = "(ttysu)";
+};
+
+template <> struct DBusTypeTrait<std::vector<JoinerEntry>>
+{
+    // array of struct of { uint64, uint64, uint8, string, uint32 }
+    static constexpr const char *TYPE_AS_STRING = "a(ttysu)";
+};
+
+template <> struct DBusTypeTrait<JoinerEvent>
+{
+    // struct of { string, uint64, uint64, uint8, uint64 }
+    static constexpr const char *TYPE_AS_STRING = "(sttyt)";
+};
+
+template <> struct DBusTypeTrait<ChurnEvent>
+{
+    // struct of { string, uint64, uint64, uint16, uint32 }
+    static constexpr const char *TYPE_AS_STRING = "(sttqu)";
+};
+
+template <> struct DBusTypeTrait<std::vector<ChurnEvent>>
+{
+    // array of struct of { string, uint64, uint64, uint16, uint32 }
+    static constexpr const char *TYPE_AS_STRING = "a(sttqu)";
+};
+
 template <> struct DBusTypeTrait<std::vector<ChildInfo>>
 {
     // array of struct of { uint64, uint32, uint32, uint16, uint16, uint8, uint8,
@@ -235,23 +373,24 @@ otbrError DBusMessageEncode(DBusMessageIter *aIter, bool aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, int8_t aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::string &aValue);
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const char *aValue);
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint8_t> &aValue);
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint16_t> &aValue);
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint32_t> &aValue);
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<uint64_t> &aValue);
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<int16_t> &aValue);
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<int32_t> &aValue);
-otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<int64_t> &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, bool &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, int8_t &aValue);
 otbrError DBusMessageExtract(DBusMessageIter *aIter, std::string &aValue);
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint8_t> &aValue);
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint16_t> &aValue);
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint32_t> &aValue);
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<uint64_t> &aValue);
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int16_t> &aValue);
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int32_t> &aValue);
-otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<int64_t> &aValue);
+
+/**
+ * This trait indicates whether arrays of a type are copied as a whole with the fixed array functions of libdbus.
+ *
+ * This holds for the integer types, whose D-Bus encoding is their memory layout. `bool` is excluded, D-Bus booleans
+ * are 32 bits wide. Arrays of structures have no fixed form in D-Bus and are always encoded element by element.
+ *
+ */
+template <typename T>
+struct DBusFixedTypeTrait : std::integral_constant<bool, std::is_integral<T>::value && !std::is_same<T, bool>::value>
+{
+};
+
+template <typename T> otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<T> &aValue);
+template <typename T> otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<T> &aValue);
 
 template <typename T> otbrError DBusMessageExtract(DBusMessageIter *aIter, T &aValue)
 {
@@ -266,7 +405,7 @@ exit:
     return error;
 }
 
-template <typename T> otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<T> &aValue)
+template <typename T> otbrError DBusMessageExtractElements(DBusMessageIter *aIter, std::vector<T> &aValue)
 {
     otbrError       error = OTBR_ERROR_NONE;
     DBusMessageIter subIter;
@@ -277,9 +416,9 @@ template <typename T> otbrError DBusMessageExtract(DBusMessageIter *aIter, std::
     aValue.clear();
     while (dbus_message_iter_get_arg_type(&subIter) != DBUS_TYPE_INVALID)
     {
-        T val;
-        SuccessOrExit(error = DBusMessageExtract(&subIter, val));
-        aValue.push_back(val);
+        // Extract in place, large structures are not copied.
+        aValue.emplace_back();
+        SuccessOrExit(error = DBusMessageExtract(&subIter, aValue.back()));
     }
     dbus_message_iter_next(aIter);
 
@@ -298,6 +437,7 @@ template <typename T> otbrError DBusMessageExtractPrimitive(DBusMessageIter *aIt
     VerifyOrExit(dbus_message_iter_get_arg_type(aIter) == DBUS_TYPE_ARRAY, error = OTBR_ERROR_DBUS);
     dbus_message_iter_recurse(aIter, &subIter);
 
+    aValue.clear();
     subtype = dbus_message_iter_get_arg_type(&subIter);
     if (subtype != DBUS_TYPE_INVALID)
     {
@@ -306,7 +446,7 @@ template <typename T> otbrError DBusMessageExtractPrimitive(DBusMessageIter *aIt
 
         if (val != nullptr)
         {
-            aValue = std::vector<T>(val, val + n);
+            aValue.assign(val, val + n);
         }
     }
     dbus_message_iter_next(aIter);
@@ -315,6 +455,21 @@ exit:
     return error;
 }
 
+template <typename T> otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<T> &aValue, std::true_type)
+{
+    return DBusMessageExtractPrimitive(aIter, aValue);
+}
+
+template <typename T> otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<T> &aValue, std::false_type)
+{
+    return DBusMessageExtractElements(aIter, aValue);
+}
+
+template <typename T> otbrError DBusMessageExtract(DBusMessageIter *aIter, std::vector<T> &aValue)
+{
+    return DBusMessageExtract(aIter, aValue, DBusFixedTypeTrait<T>());
+}
+
 template <typename T, size_t SIZE> otbrError DBusMessageExtract(DBusMessageIter *aIter, std::array<T, SIZE> &aValue)
 {
     DBusMessageIter subIter;
@@ -353,7 +508,7 @@ exit:
     return error;
 }
 
-template <typename T> otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<T> &aValue)
+template <typename T> otbrError DBusMessageEncodeElements(DBusMessageIter *aIter, const std::vector<T> &aValue)
 {
     otbrError       error = OTBR_ERROR_NONE;
     DBusMessageIter subIter;
@@ -392,6 +547,23 @@ exit:
     return error;
 }
 
+template <typename T>
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<T> &aValue, std::true_type)
+{
+    return DBusMessageEncodePrimitive(aIter, aValue);
+}
+
+template <typename T>
+otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<T> &aValue, std::false_type)
+{
+    return DBusMessageEncodeElements(aIter, aValue);
+}
+
+template <typename T> otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::vector<T> &aValue)
+{
+    return DBusMessageEncode(aIter, aValue, DBusFixedTypeTrait<T>());
+}
+
 template <typename T, size_t SIZE>
 otbrError DBusMessageEncode(DBusMessageIter *aIter, const std::array<T, SIZE> &aValue)
 {
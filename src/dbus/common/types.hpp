@@ -53,6 +53,12 @@ enum DeviceRole
     OTBR_DEVICE_ROLE_LEADER   = 4,
 };
 
+enum TableEvent
+{
+    OTBR_TABLE_EVENT_ADDED   = 0,
+    OTBR_TABLE_EVENT_REMOVED = 1,
+};
+
 struct ActiveScanResult
 {
     uint64_t             mExtAddress;    ///< IEEE 802.15.4 Extended Address
@@ -444,6 +450,91 @@ struct ChannelQuality
     uint16_t mOccupancy;
 };
 
+struct EnergyScanResult
+{
+    uint8_t mChannel; ///< IEEE 802.15.4 Channel
+    int8_t  mMaxRssi; ///< The max RSSI (dBm)
+};
+
+struct ChannelReport
+{
+    uint8_t  mChannel;   ///< IEEE 802.15.4 Channel
+    uint16_t mOccupancy; ///< Channel monitor occupancy, 0xffff for 100%
+    int8_t   mMaxRssi;   ///< The max RSSI (dBm) of the last energy scan, 127 if not scanned
+};
+
+struct ChannelSurvey
+{
+    std::vector<ChannelReport> mChannels;            ///< The supported channels
+    uint32_t                   mSampleCount;         ///< The number of channel monitor samples
+    uint16_t                   mCcaFailureRate;      ///< The CCA failure rate, 0xffff for 100%
+    uint64_t                   mTimestamp;           ///< When the survey was taken, in ms since the Unix epoch
+    uint64_t                   mEnergyScanTimestamp; ///< When the last energy scan finished, 0 if never
+};
+
+struct MainloopComponentStats
+{
+    std::string           mName;       ///< The component and phase, e.g. "rest.Process"
+    uint64_t              mCount;      ///< The number of calls
+    uint64_t              mTotalUs;    ///< The accumulated duration in microseconds
+    uint64_t              mMaxUs;      ///< The maximum duration in microseconds
+    uint64_t              mStallCount; ///< The number of calls lasting at least the stall threshold
+    std::vector<uint64_t> mHistogram;  ///< The number of calls per latency bucket
+};
+
+struct BackboneRouterCounters
+{
+    uint64_t              mNsMulticast;      ///< The number of multicast NS received by the ND proxy
+    uint64_t              mNsUnicast;        ///< The number of unicast NS received by the ND proxy
+    uint64_t              mNsMatched;        ///< The number of NS whose target is a proxied DUA
+    uint64_t              mNaSent;           ///< The number of NA sent by the ND proxy
+    uint64_t              mNaFailed;         ///< The number of NA the ND proxy failed to send
+    uint64_t              mAccepted;         ///< The number of unicast NS accepted back to the kernel
+    uint64_t              mDropped;          ///< The number of unicast NS dropped after being answered
+    uint64_t              mSocketErrors;     ///< The number of socket errors of the ND proxy
+    uint64_t              mDuaAdded;         ///< The number of DUAs added by the Backbone Router
+    uint64_t              mDuaRemoved;       ///< The number of DUAs removed by the Backbone Router
+    uint64_t              mProcessCount;     ///< The number of ND proxy socket events processed
+    uint64_t              mProcessTotalUs;   ///< The accumulated processing duration in microseconds
+    uint64_t              mProcessMaxUs;     ///< The maximum processing duration in microseconds
+    std::vector<uint64_t> mProcessHistogram; ///< The number of socket events per latency bucket
+};
+
+struct RcpLinkStats
+{
+    uint64_t              mTxFrames;         ///< The number of 802.15.4 frames sent by the RCP
+    uint64_t              mRxFrames;         ///< The number of 802.15.4 frames received by the RCP
+    uint32_t              mTxFrameRate;      ///< The frames sent per second over the last sample interval
+    uint32_t              mRxFrameRate;      ///< The frames received per second over the last sample interval
+    uint64_t              mTxRetries;        ///< The number of MAC retransmissions done by the RCP
+    uint64_t              mTxBytes;          ///< The number of bytes sent to the RCP UART
+    uint64_t              mRxBytes;          ///< The number of bytes received from the RCP UART
+    uint32_t              mTxByteRate;       ///< The UART bytes sent per second over the last sample interval
+    uint32_t              mRxByteRate;       ///< The UART bytes received per second over the last sample interval
+    uint64_t              mUartOverruns;     ///< The number of UART receive overruns
+    uint64_t              mUartFrameErrors;  ///< The number of UART framing errors
+    uint64_t              mTimeouts;         ///< The number of spinel property gets not answered in time
+    uint64_t              mLatencyCount;     ///< The number of spinel property gets timed
+    uint64_t              mLatencyTotalUs;   ///< The accumulated round-trip time in microseconds
+    uint64_t              mLatencyMaxUs;     ///< The maximum round-trip time in microseconds
+    std::vector<uint64_t> mLatencyHistogram; ///< The number of property gets per latency bucket
+};
+
+struct MemoryUsage
+{
+    std::string mSubsystem;    ///< The subsystem, e.g. "rest"
+    uint64_t    mCurrentBytes; ///< The heap bytes currently allocated by the subsystem
+    uint64_t    mPeakBytes;    ///< The maximum of the heap bytes allocated at once
+    uint64_t    mAllocations;  ///< The number of heap allocations since start
+};
+
+struct MetricSample
+{
+    std::string mName;   ///< The metric name, e.g. "otbr_srp_updates_total"
+    std::string mLabels; ///< The labels without braces, e.g. `result="success"`, empty if none
+    uint64_t    mValue;  ///< The value
+};
+
 struct ChildInfo
 {
     uint64_t mExtAddress;         ///< IEEE 802.15.4 Extended Address
@@ -490,6 +581,33 @@ struct LeaderData
     uint8_t  mLeaderRouterId;    ///< Leader Router ID
 };
 
+struct JoinerEntry
+{
+    uint64_t    mEui64;           ///< The joiner EUI-64, 0 for any joiner
+    uint64_t    mDiscerner;       ///< The joiner discerner, used instead of the EUI-64 if the length is not 0
+    uint8_t     mDiscernerLength; ///< The discerner length in bits, 0 for none
+    std::string mPskd;            ///< The joiner pre-shared key
+    uint32_t    mTimeout;         ///< The time in seconds the joiner is allowed to join
+};
+
+struct JoinerEvent
+{
+    std::string mEvent;           ///< "start", "connected", "finalize", "end" or "removed"
+    uint64_t    mEui64;           ///< The EUI-64 of the joiner entry, 0 for any joiner or a discerner
+    uint64_t    mDiscerner;       ///< The discerner of the joiner entry
+    uint8_t     mDiscernerLength; ///< The discerner length in bits, 0 if the entry has none
+    uint64_t    mJoinerId;        ///< The joiner ID, 0 if not known
+};
+
+struct ChurnEvent
+{
+    std::string mEvent;      ///< "ChildAdded", "ChildRemoved", "ParentChanged", "RoleChanged" or "PartitionChanged"
+    uint64_t    mTimestamp;  ///< The time of the event in milliseconds since the Unix epoch
+    uint64_t    mExtAddress; ///< The extended address of the child or of the parent, 0 otherwise
+    uint16_t    mRloc16;     ///< The RLOC16 of the child or of the parent, or of the node itself
+    uint32_t    mValue;      ///< The new role or partition id, 0 otherwise
+};
+
 } // namespace DBus
 } // namespace otbr
 
@@ -28,27 +28,33 @@
 
 #include "dbus/server/dbus_agent.hpp"
 
+#include <algorithm>
+
+#include "agent/instance_params.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_poller.hpp"
 #include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_message_dump.hpp"
 
 namespace otbr {
 namespace DBus {
 
-const struct timeval DBusAgent::kPollTimeout = {0, 0};
-
 DBusAgent::DBusAgent(const std::string &aInterfaceName, otbr::Ncp::ControllerOpenThread *aNcp)
     : mInterfaceName(aInterfaceName)
     , mNcp(aNcp)
 {
 }
 
-otbrError DBusAgent::Init(void)
+otbrError DBusAgent::Connect(void)
 {
     DBusError   dbusError;
     otbrError   error = OTBR_ERROR_NONE;
     int         requestReply;
     std::string serverName = OTBR_DBUS_SERVER_PREFIX + mInterfaceName;
 
+    // The connection may be set up by another thread than the mainloop.
+    dbus_threads_init_default();
+
     dbus_error_init(&dbusError);
     DBusConnection *conn = dbus_bus_get(DBUS_BUS_SYSTEM, &dbusError);
     mConnection          = std::unique_ptr<DBusConnection, std::function<void(DBusConnection *)>>(
@@ -60,28 +66,117 @@ otbrError DBusAgent::Init(void)
     VerifyOrExit(requestReply == DBUS_REQUEST_NAME_REPLY_PRIMARY_OWNER ||
                      requestReply == DBUS_REQUEST_NAME_REPLY_ALREADY_OWNER,
                  error = OTBR_ERROR_DBUS);
-    VerifyOrExit(
-        dbus_connection_set_watch_functions(mConnection.get(), AddDBusWatch, RemoveDBusWatch, nullptr, this, nullptr));
-    mThreadObject = std::unique_ptr<DBusThreadObject>(new DBusThreadObject(mConnection.get(), mInterfaceName, mNcp));
-    error         = mThreadObject->Init();
 exit:
     if (error != OTBR_ERROR_NONE)
     {
         otbrLog(OTBR_LOG_ERR, "dbus error %s: %s", dbusError.name, dbusError.message);
+        mConnection = nullptr;
     }
     dbus_error_free(&dbusError);
     return error;
 }
 
+otbrError DBusAgent::Init(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    if (mConnection == nullptr)
+    {
+        SuccessOrExit(error = Connect());
+    }
+
+    SetDBusMessageDumpSampleInterval(InstanceParams::Get().GetDBusDumpSampling());
+
+    VerifyOrExit(dbus_connection_set_watch_functions(mConnection.get(), AddDBusWatch, RemoveDBusWatch,
+                                                     ToggleDBusWatch, this, nullptr),
+                 error = OTBR_ERROR_DBUS);
+    mThreadObject = std::unique_ptr<DBusThreadObject>(new DBusThreadObject(mConnection.get(), mInterfaceName, mNcp));
+
+    // Without the monitor, every signal is sent.
+    mSignalSubscribers.Start(*mConnection, OTBR_DBUS_SERVER_PREFIX + mInterfaceName);
+    mThreadObject->SetSignalSubscribers(&mSignalSubscribers);
+    error = mThreadObject->Init();
+exit:
+    return error;
+}
+
 dbus_bool_t DBusAgent::AddDBusWatch(struct DBusWatch *aWatch, void *aContext)
 {
-    static_cast<DBusAgent *>(aContext)->mWatches.insert(aWatch);
+    DBusAgent *agent = static_cast<DBusAgent *>(aContext);
+    int        fd    = dbus_watch_get_unix_fd(aWatch);
+
+    VerifyOrExit(fd >= 0);
+
+    agent->mWatches[fd].push_back(aWatch);
+    agent->UpdateWatchFd(fd);
+
+exit:
     return TRUE;
 }
 
 void DBusAgent::RemoveDBusWatch(struct DBusWatch *aWatch, void *aContext)
 {
-    static_cast<DBusAgent *>(aContext)->mWatches.erase(aWatch);
+    DBusAgent *agent = static_cast<DBusAgent *>(aContext);
+    int        fd    = dbus_watch_get_unix_fd(aWatch);
+    auto       it    = agent->mWatches.find(fd);
+
+    VerifyOrExit(it != agent->mWatches.end());
+
+    it->second.erase(std::remove(it->second.begin(), it->second.end(), aWatch), it->second.end());
+    if (it->second.empty())
+    {
+        agent->mWatches.erase(it);
+    }
+
+    agent->UpdateWatchFd(fd);
+
+exit:
+    return;
+}
+
+void DBusAgent::ToggleDBusWatch(struct DBusWatch *aWatch, void *aContext)
+{
+    static_cast<DBusAgent *>(aContext)->UpdateWatchFd(dbus_watch_get_unix_fd(aWatch));
+}
+
+void DBusAgent::UpdateWatchFd(int aFd)
+{
+    uint8_t events = 0;
+    auto    it     = mWatches.find(aFd);
+
+    VerifyOrExit(aFd >= 0);
+
+    if (it != mWatches.end())
+    {
+        for (DBusWatch *watch : it->second)
+        {
+            unsigned int flags;
+
+            if (!dbus_watch_get_enabled(watch))
+            {
+                continue;
+            }
+
+            flags = dbus_watch_get_flags(watch);
+
+            if (flags & DBUS_WATCH_READABLE)
+            {
+                events |= MainloopPoller::kEventRead;
+            }
+
+            if (flags & DBUS_WATCH_WRITABLE)
+            {
+                events |= MainloopPoller::kEventWrite;
+            }
+
+            events |= MainloopPoller::kEventError;
+        }
+    }
+
+    MainloopPoller::Get().Register(aFd, events);
+
+exit:
+    return;
 }
 
 void DBusAgent::UpdateFdSet(fd_set &        aReadFdSet,
@@ -90,84 +185,74 @@ void DBusAgent::UpdateFdSet(fd_set &        aReadFdSet,
                             int &           aMaxFd,
                             struct timeval &aTimeOut)
 {
-    unsigned int flags;
-    int          fd;
+    OTBR_UNUSED_VARIABLE(aReadFdSet);
+    OTBR_UNUSED_VARIABLE(aWriteFdSet);
+    OTBR_UNUSED_VARIABLE(aErrorFdSet);
+    OTBR_UNUSED_VARIABLE(aMaxFd);
 
     if (dbus_connection_get_dispatch_status(mConnection.get()) == DBUS_DISPATCH_DATA_REMAINS)
     {
         aTimeOut = {0, 0};
     }
+}
 
-    for (const auto &watch : mWatches)
-    {
-        if (!dbus_watch_get_enabled(watch))
-        {
-            continue;
-        }
-
-        flags = dbus_watch_get_flags(watch);
-        fd    = dbus_watch_get_unix_fd(watch);
+void DBusAgent::HandleWatch(DBusWatch *aWatch, uint8_t aEvents)
+{
+    unsigned int flags;
 
-        if (fd < 0)
-        {
-            continue;
-        }
+    VerifyOrExit(dbus_watch_get_enabled(aWatch));
 
-        if (flags & DBUS_WATCH_READABLE)
-        {
-            FD_SET(fd, &aReadFdSet);
-        }
+    flags = dbus_watch_get_flags(aWatch);
 
-        if ((flags & DBUS_WATCH_WRITABLE))
-        {
-            FD_SET(fd, &aWriteFdSet);
-        }
+    if ((flags & DBUS_WATCH_READABLE) && !(aEvents & MainloopPoller::kEventRead))
+    {
+        flags &= static_cast<unsigned int>(~DBUS_WATCH_READABLE);
+    }
 
-        FD_SET(fd, &aErrorFdSet);
+    if ((flags & DBUS_WATCH_WRITABLE) && !(aEvents & MainloopPoller::kEventWrite))
+    {
+        flags &= static_cast<unsigned int>(~DBUS_WATCH_WRITABLE);
+    }
 
-        if (fd > aMaxFd)
-        {
-            aMaxFd = fd;
-        }
+    if (aEvents & MainloopPoller::kEventError)
+    {
+        flags |= DBUS_WATCH_ERROR;
     }
+
+    dbus_watch_handle(aWatch, flags);
+
+exit:
+    return;
 }
 
 void DBusAgent::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
 {
-    unsigned int flags;
-    int          fd;
+    const MainloopPoller &poller = MainloopPoller::Get();
 
-    for (const auto &watch : mWatches)
-    {
-        if (!dbus_watch_get_enabled(watch))
-        {
-            continue;
-        }
+    OTBR_UNUSED_VARIABLE(aReadFdSet);
+    OTBR_UNUSED_VARIABLE(aWriteFdSet);
+    OTBR_UNUSED_VARIABLE(aErrorFdSet);
 
-        flags = dbus_watch_get_flags(watch);
-        fd    = dbus_watch_get_unix_fd(watch);
+    // Learn the new subscribers before handling the method calls that may signal them.
+    mSignalSubscribers.Process();
 
-        if (fd < 0)
-        {
-            continue;
-        }
+    // Only visit the file descriptors with events instead of all the watches.
+    for (int fd : poller.GetReadyFds())
+    {
+        uint8_t events = poller.GetReadyEvents(fd);
 
-        if ((flags & DBUS_WATCH_READABLE) && !FD_ISSET(fd, &aReadFdSet))
+        // Handling a watch may add or remove watches of the same file descriptor, look them up again each time.
+        for (size_t i = 0;; i++)
         {
-            flags &= static_cast<unsigned int>(~DBUS_WATCH_READABLE);
-        }
+            auto it = mWatches.find(fd);
 
-        if ((flags & DBUS_WATCH_WRITABLE) && !FD_ISSET(fd, &aWriteFdSet))
-        {
-            flags &= static_cast<unsigned int>(~DBUS_WATCH_WRITABLE);
-        }
+            if (it == mWatches.end() || i >= it->second.size())
+            {
+                break;
+            }
 
-        if (FD_ISSET(fd, &aErrorFdSet))
-        {
-            flags |= DBUS_WATCH_ERROR;
+            HandleWatch(it->second[i], events);
         }
-
-        dbus_watch_handle(watch, flags);
     }
 
     while (DBUS_DISPATCH_DATA_REMAINS == dbus_connection_dispatch(mConnection.get()))
@@ -35,13 +35,16 @@
 #define OTBR_DBUS_AGENT_HPP_
 
 #include <functional>
-#include <set>
 #include <string>
+#include <unordered_map>
+#include <vector>
+
 #include <sys/select.h>
 
 #include "dbus/common/dbus_message_helper.hpp"
 #include "dbus/common/dbus_resources.hpp"
 #include "dbus/server/dbus_object.hpp"
+#include "dbus/server/dbus_signal_subscribers.hpp"
 #include "dbus/server/dbus_thread_object.hpp"
 
 #include "agent/ncp_openthread.hpp"
@@ -61,9 +64,22 @@ public:
      */
     DBusAgent(const std::string &aInterfaceName, otbr::Ncp::ControllerOpenThread *aNcp);
 
+    /**
+     * This method connects to the system bus and acquires the server name.
+     *
+     * This method only talks to the bus daemon and can be called from another thread while the NCP initializes
+     * concurrently. It MUST complete before `Init()` is called.
+     *
+     * @returns The connection error.
+     *
+     */
+    otbrError Connect(void);
+
     /**
      * This method initializes the dbus agent.
      *
+     * The agent connects to the system bus first unless `Connect()` succeeded already.
+     *
      * @returns The intialization error.
      *
      */
@@ -72,6 +88,8 @@ public:
     /**
      * This method performs the dbus select update.
      *
+     * The watched file descriptors are registered with `MainloopPoller`, only the timeout is updated here.
+     *
      * @param[out]      aReadFdSet   The read file descriptors.
      * @param[out]      aWriteFdSet  The write file descriptors.
      * @param[out]      aErorFdSet   The error file descriptors.
@@ -98,20 +116,25 @@ public:
 private:
     static dbus_bool_t AddDBusWatch(struct DBusWatch *aWatch, void *aContext);
     static void        RemoveDBusWatch(struct DBusWatch *aWatch, void *aContext);
-
-    static const struct timeval kPollTimeout;
+    static void        ToggleDBusWatch(struct DBusWatch *aWatch, void *aContext);
+    void               UpdateWatchFd(int aFd);
+    void               HandleWatch(DBusWatch *aWatch, uint8_t aEvents);
 
     std::string                       mInterfaceName;
+    SignalSubscribers                 mSignalSubscribers; // Declared first to outlive the thread object.
     std::unique_ptr<DBusThreadObject> mThreadObject;
     using UniqueDBusConnection = std::unique_ptr<DBusConnection, std::function<void(DBusConnection *)>>;
     UniqueDBusConnection             mConnection;
     otbr::Ncp::ControllerOpenThread *mNcp;
 
     /**
-     * This map is used to track DBusWatch-es.
+     * This map is used to track DBusWatch-es by file descriptor.
+     *
+     * libdbus may create separate read and write watches for the same socket, so that there are at most a few
+     * watches per file descriptor.
      *
      */
-    std::set<DBusWatch *> mWatches;
+    std::unordered_map<int, std::vector<DBusWatch *>> mWatches;
 };
 
 } // namespace DBus
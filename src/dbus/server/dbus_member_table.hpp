@@ -0,0 +1,167 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for a table keyed by d-bus interface and member names.
+ */
+
+#ifndef OTBR_DBUS_DBUS_MEMBER_TABLE_HPP_
+#define OTBR_DBUS_DBUS_MEMBER_TABLE_HPP_
+
+#include <stdint.h>
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace otbr {
+namespace DBus {
+
+/**
+ * This class implements a table of values keyed by an interface name and a member name.
+ *
+ * The names are copied once when an entry is added. Lookups hash the two C strings in place, so dispatching a
+ * message never builds a joined "interface.member" string.
+ *
+ */
+template <typename ValueType> class MemberTable
+{
+public:
+    /**
+     * This method adds an entry.
+     *
+     * @param[in]   aInterfaceName  The interface name.
+     * @param[in]   aMemberName     The member name.
+     * @param[in]   aValue          The value.
+     *
+     * @retval  true    The entry was added.
+     * @retval  false   An entry with the same names already exists, it is kept unchanged.
+     *
+     */
+    bool Add(const std::string &aInterfaceName, const std::string &aMemberName, ValueType aValue)
+    {
+        bool added = false;
+
+        if (Find(aInterfaceName.c_str(), aMemberName.c_str()) == nullptr)
+        {
+            mEntries.emplace(Hash(aInterfaceName.c_str(), aMemberName.c_str()),
+                             Entry{aInterfaceName, aMemberName, std::move(aValue)});
+            added = true;
+        }
+
+        return added;
+    }
+
+    /**
+     * This method finds an entry.
+     *
+     * @param[in]   aInterfaceName  The interface name, may be nullptr.
+     * @param[in]   aMemberName     The member name, may be nullptr.
+     *
+     * @returns The value of the entry, or nullptr if not found.
+     *
+     */
+    ValueType *Find(const char *aInterfaceName, const char *aMemberName)
+    {
+        ValueType *value = nullptr;
+
+        if (aInterfaceName != nullptr && aMemberName != nullptr)
+        {
+            auto range = mEntries.equal_range(Hash(aInterfaceName, aMemberName));
+
+            for (auto iter = range.first; iter != range.second; ++iter)
+            {
+                if (iter->second.mInterfaceName == aInterfaceName && iter->second.mMemberName == aMemberName)
+                {
+                    value = &iter->second.mValue;
+                    break;
+                }
+            }
+        }
+
+        return value;
+    }
+
+    /**
+     * This method finds an entry.
+     *
+     * @param[in]   aInterfaceName  The interface name, may be nullptr.
+     * @param[in]   aMemberName     The member name, may be nullptr.
+     *
+     * @returns The value of the entry, or nullptr if not found.
+     *
+     */
+    const ValueType *Find(const char *aInterfaceName, const char *aMemberName) const
+    {
+        return const_cast<MemberTable *>(this)->Find(aInterfaceName, aMemberName);
+    }
+
+    /**
+     * This method returns the number of entries.
+     *
+     */
+    size_t GetSize(void) const { return mEntries.size(); }
+
+private:
+    struct Entry
+    {
+        std::string mInterfaceName;
+        std::string mMemberName;
+        ValueType   mValue;
+    };
+
+    // FNV-1a over "interface.member", without joining the names.
+    static uint32_t Hash(const char *aInterfaceName, const char *aMemberName)
+    {
+        uint32_t hash = 2166136261u;
+
+        hash = HashBytes(hash, aInterfaceName);
+        hash = (hash ^ '.') * 16777619u;
+        hash = HashBytes(hash, aMemberName);
+
+        return hash;
+    }
+
+    static uint32_t HashBytes(uint32_t aHash, const char *aString)
+    {
+        for (; *aString != '\0'; ++aString)
+        {
+            aHash = (aHash ^ static_cast<uint8_t>(*aString)) * 16777619u;
+        }
+
+        return aHash;
+    }
+
+    std::unordered_multimap<uint32_t, Entry> mEntries;
+};
+
+} // namespace DBus
+} // namespace otbr
+
+#endif // OTBR_DBUS_DBUS_MEMBER_TABLE_HPP_
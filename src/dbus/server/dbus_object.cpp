@@ -27,12 +27,22 @@
  */
 
 #include <assert.h>
+#include <errno.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
 
 #include <dbus/dbus.h>
 
 #include "common/logging.hpp"
+#include "common/metrics.hpp"
+#include "common/trace.hpp"
+#include "common/usdt.hpp"
 #include "dbus/common/dbus_message_dump.hpp"
 #include "dbus/server/dbus_object.hpp"
 
@@ -41,9 +51,55 @@ using std::placeholders::_1;
 namespace otbr {
 namespace DBus {
 
+/**
+ * This function creates an anonymous file holding the given data, positioned at its start.
+ *
+ * @returns The file descriptor, or -1 on failure.
+ *
+ */
+static int CreateMemoryFile(const char *aData, size_t aLength)
+{
+    int fd = -1;
+
+#if defined(__linux__) && defined(SYS_memfd_create)
+    // memfd_create() may be missing from the C library even where the kernel has it.
+    fd = static_cast<int>(syscall(SYS_memfd_create, "otbr-dbus-export", 1U /* MFD_CLOEXEC */));
+#endif
+
+    if (fd < 0)
+    {
+        char path[] = "/tmp/otbr-dbus-export-XXXXXX";
+
+        fd = mkstemp(path);
+        VerifyOrExit(fd >= 0);
+        unlink(path);
+    }
+
+    while (aLength > 0)
+    {
+        ssize_t rval = write(fd, aData, aLength);
+
+        if (rval < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        VerifyOrExit(rval > 0, close(fd), fd = -1);
+        aData += rval;
+        aLength -= static_cast<size_t>(rval);
+    }
+
+    VerifyOrExit(lseek(fd, 0, SEEK_SET) == 0, close(fd), fd = -1);
+
+exit:
+    return fd;
+}
+
 DBusObject::DBusObject(DBusConnection *aConnection, const std::string &aObjectPath)
     : mConnection(aConnection)
     , mObjectPath(aObjectPath)
+    , mSignalSubscribers(nullptr)
+    , mPropertiesChangedWindow(0)
 {
 }
 
@@ -73,10 +129,10 @@ void DBusObject::RegisterMethod(const std::string &      aInterfaceName,
                                 const std::string &      aMethodName,
                                 const MethodHandlerType &aHandler)
 {
-    std::string fullPath = aInterfaceName + "." + aMethodName;
+    bool added = mMethodHandlers.Add(aInterfaceName, aMethodName, aHandler);
 
-    assert(mMethodHandlers.find(fullPath) == mMethodHandlers.end());
-    mMethodHandlers.emplace(fullPath, aHandler);
+    assert(added);
+    OTBR_UNUSED_VARIABLE(added);
 }
 
 void DBusObject::RegisterGetPropertyHandler(const std::string &        aInterfaceName,
@@ -84,16 +140,29 @@ void DBusObject::RegisterGetPropertyHandler(const std::string &        aInterfac
                                             const PropertyHandlerType &aHandler)
 {
     mGetPropertyHandlers[aInterfaceName].emplace(aPropertyName, aHandler);
+    mGetPropertyTable.Add(aInterfaceName, aPropertyName, aHandler);
+}
+
+void DBusObject::RegisterGetPropertiesMethod(const std::string &aInterfaceName, const std::string &aMethodName)
+{
+    RegisterMethod(aInterfaceName, aMethodName,
+                   std::bind(&DBusObject::GetPropertiesMethodHandler, this, aInterfaceName, _1));
+}
+
+void DBusObject::RegisterExportPropertiesMethod(const std::string &aInterfaceName, const std::string &aMethodName)
+{
+    RegisterMethod(aInterfaceName, aMethodName,
+                   std::bind(&DBusObject::ExportPropertiesMethodHandler, this, aInterfaceName, _1));
 }
 
 void DBusObject::RegisterSetPropertyHandler(const std::string &        aInterfaceName,
                                             const std::string &        aPropertyName,
                                             const PropertyHandlerType &aHandler)
 {
-    std::string fullPath = aInterfaceName + "." + aPropertyName;
+    bool added = mSetPropertyHandlers.Add(aInterfaceName, aPropertyName, aHandler);
 
-    assert(mSetPropertyHandlers.find(fullPath) == mSetPropertyHandlers.end());
-    mSetPropertyHandlers.emplace(fullPath, aHandler);
+    assert(added);
+    OTBR_UNUSED_VARIABLE(added);
 }
 
 DBusHandlerResult DBusObject::sMessageHandler(DBusConnection *aConnection, DBusMessage *aMessage, void *aData)
@@ -105,21 +174,29 @@ DBusHandlerResult DBusObject::sMessageHandler(DBusConnection *aConnection, DBusM
 
 DBusHandlerResult DBusObject::MessageHandler(DBusConnection *aConnection, DBusMessage *aMessage)
 {
-    DBusHandlerResult handled = DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
-    DBusRequest       request(aConnection, aMessage);
-    std::string       interface  = dbus_message_get_interface(aMessage);
-    std::string       memberName = interface + "." + dbus_message_get_member(aMessage);
-    auto              iter       = mMethodHandlers.find(memberName);
+    DBusHandlerResult        handled       = DBUS_HANDLER_RESULT_NOT_YET_HANDLED;
+    const char *             interfaceName = dbus_message_get_interface(aMessage);
+    const char *             memberName    = dbus_message_get_member(aMessage);
+    const MethodHandlerType *handler       = nullptr;
 
-    if (dbus_message_get_type(aMessage) == DBUS_MESSAGE_TYPE_METHOD_CALL && iter != mMethodHandlers.end())
+    if (dbus_message_get_type(aMessage) == DBUS_MESSAGE_TYPE_METHOD_CALL &&
+        (handler = mMethodHandlers.Find(interfaceName, memberName)) != nullptr)
     {
-        otbrLog(OTBR_LOG_INFO, "Handling method %s", memberName.c_str());
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
-        {
-            DumpDBusMessage(*aMessage);
-        }
-        (iter->second)(request);
+        DBusRequest               request(aConnection, aMessage);
+        auto                      start = std::chrono::steady_clock::now();
+        std::chrono::microseconds elapsed;
+
+        otbrLog(OTBR_LOG_INFO, "Handling method %s.%s", interfaceName, memberName);
+        DumpDBusMessage(*aMessage);
+        OTBR_USDT2(dbus_dispatch_start, dbus_message_get_serial(aMessage), memberName);
+        (*handler)(request);
+        OTBR_USDT1(dbus_dispatch_done, dbus_message_get_serial(aMessage));
         handled = DBUS_HANDLER_RESULT_HANDLED;
+        Metrics::Get().Increment(Metrics::kCounterDBusMethodCalls);
+
+        elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        Trace::Get().Log(Trace::kEventDBusMethodCall, dbus_message_get_serial(aMessage),
+                         static_cast<uint32_t>(elapsed.count()));
     }
 
     return handled;
@@ -133,34 +210,49 @@ void DBusObject::GetPropertyMethodHandler(DBusRequest &aRequest)
     std::string     interfaceName;
     std::string     propertyName;
     otError         error = OT_ERROR_NONE;
+    auto            now   = std::chrono::steady_clock::now();
 
     VerifyOrExit(reply != nullptr, error = OT_ERROR_NO_BUFS);
     VerifyOrExit(dbus_message_iter_init(aRequest.GetMessage(), &iter), error = OT_ERROR_FAILED);
     VerifyOrExit(DBusMessageExtract(&iter, interfaceName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
     VerifyOrExit(DBusMessageExtract(&iter, propertyName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
     {
-        auto propertyIter = mGetPropertyHandlers.find(interfaceName);
+        DBusMessageIter            replyIter;
+        const PropertyHandlerType *handler     = mGetPropertyTable.Find(interfaceName.c_str(), propertyName.c_str());
+        CachedReply *              cachedReply = mCachedReplies.Find(interfaceName.c_str(), propertyName.c_str());
 
         otbrLog(OTBR_LOG_INFO, "GetProperty %s.%s", interfaceName.c_str(), propertyName.c_str());
-        VerifyOrExit(propertyIter != mGetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
+        VerifyOrExit(handler != nullptr, error = OT_ERROR_NOT_FOUND);
+
+        if (cachedReply != nullptr && cachedReply->mReply != nullptr && now - cachedReply->mTime < cachedReply->mMaxAge)
         {
-            DBusMessageIter replyIter;
-            auto &          interfaceHandlers = propertyIter->second;
-            auto            interfaceIter     = interfaceHandlers.find(propertyName);
+            const char *sender = dbus_message_get_sender(aRequest.GetMessage());
+
+            // Copying the encoded body is much cheaper than reading and encoding the property again.
+            reply = UniqueDBusMessage(dbus_message_copy(cachedReply->mReply.get()));
+            VerifyOrExit(reply != nullptr, error = OT_ERROR_NO_BUFS);
+            VerifyOrExit(dbus_message_set_reply_serial(reply.get(), dbus_message_get_serial(aRequest.GetMessage())),
+                         error = OT_ERROR_NO_BUFS);
+            VerifyOrExit(sender == nullptr || dbus_message_set_destination(reply.get(), sender),
+                         error = OT_ERROR_NO_BUFS);
+            ExitNow();
+        }
 
-            VerifyOrExit(interfaceIter != interfaceHandlers.end(), error = OT_ERROR_NOT_FOUND);
-            dbus_message_iter_init_append(reply.get(), &replyIter);
-            SuccessOrExit(error = interfaceIter->second(replyIter));
+        dbus_message_iter_init_append(reply.get(), &replyIter);
+        SuccessOrExit(error = (*handler)(replyIter));
+
+        if (cachedReply != nullptr)
+        {
+            // Copy before sending, the copy must not carry the serial of this reply.
+            cachedReply->mReply = UniqueDBusMessage(dbus_message_copy(reply.get()));
+            cachedReply->mTime  = now;
         }
     }
 exit:
     if (error == OT_ERROR_NONE)
     {
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
-        {
-            otbrLog(OTBR_LOG_DEBUG, "GetProperty %s.%s reply:", interfaceName.c_str(), propertyName.c_str());
-            DumpDBusMessage(*reply);
-        }
+        otbrLog(OTBR_LOG_DEBUG, "GetProperty %s.%s reply:", interfaceName.c_str(), propertyName.c_str());
+        DumpDBusMessage(*reply);
 
         dbus_connection_send(aRequest.GetConnection(), reply.get(), nullptr);
     }
@@ -212,26 +304,124 @@ exit:
     }
 }
 
+otError DBusObject::EncodeProperties(const std::string &aInterfaceName, DBusRequest &aRequest, DBusMessage &aReply)
+{
+    DBusMessageIter          iter, subIter;
+    std::vector<std::string> propertyNames;
+    auto                     args         = std::tie(propertyNames);
+    auto                     propertyIter = mGetPropertyHandlers.find(aInterfaceName);
+    otError                  error        = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
+    VerifyOrExit(propertyIter != mGetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
+
+    // Fail before encoding anything if a property is unknown.
+    for (const std::string &propertyName : propertyNames)
+    {
+        VerifyOrExit(propertyIter->second.count(propertyName) != 0, error = OT_ERROR_NOT_FOUND);
+    }
+
+    dbus_message_iter_init_append(&aReply, &iter);
+    VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY, DBUS_TYPE_VARIANT_AS_STRING, &subIter),
+                 error = OT_ERROR_FAILED);
+
+    for (const std::string &propertyName : propertyNames)
+    {
+        SuccessOrExit(error = propertyIter->second.at(propertyName)(subIter));
+    }
+
+    VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OT_ERROR_FAILED);
+
+exit:
+    return error;
+}
+
+void DBusObject::GetPropertiesMethodHandler(const std::string &aInterfaceName, DBusRequest &aRequest)
+{
+    UniqueDBusMessage reply{dbus_message_new_method_return(aRequest.GetMessage())};
+    otError           error = OT_ERROR_NONE;
+
+    VerifyOrExit(reply != nullptr, error = OT_ERROR_NO_BUFS);
+    SuccessOrExit(error = EncodeProperties(aInterfaceName, aRequest, *reply));
+
+exit:
+    if (error == OT_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_DEBUG, "GetProperties %s reply:", aInterfaceName.c_str());
+        DumpDBusMessage(*reply);
+
+        dbus_connection_send(aRequest.GetConnection(), reply.get(), nullptr);
+    }
+    else
+    {
+        otbrLog(OTBR_LOG_WARNING, "GetProperties %s error:%s", aInterfaceName.c_str(), ConvertToDBusErrorName(error));
+        aRequest.ReplyOtResult(error);
+    }
+}
+
+void DBusObject::ExportPropertiesMethodHandler(const std::string &aInterfaceName, DBusRequest &aRequest)
+{
+    UniqueDBusMessage data{dbus_message_new_method_return(aRequest.GetMessage())};
+    UniqueDBusMessage reply{dbus_message_new_method_return(aRequest.GetMessage())};
+    char *            buffer = nullptr;
+    int               length = 0;
+    int               fd     = -1;
+    otError           error  = OT_ERROR_NONE;
+
+    VerifyOrExit(dbus_connection_can_send_type(aRequest.GetConnection(), DBUS_TYPE_UNIX_FD),
+                 error = OT_ERROR_NOT_CAPABLE);
+    VerifyOrExit(data != nullptr && reply != nullptr, error = OT_ERROR_NO_BUFS);
+
+    // The client decodes the file as the reply of GetProperties, see `dbus_message_demarshal()`.
+    SuccessOrExit(error = EncodeProperties(aInterfaceName, aRequest, *data));
+    VerifyOrExit(dbus_message_marshal(data.get(), &buffer, &length), error = OT_ERROR_NO_BUFS);
+    VerifyOrExit((fd = CreateMemoryFile(buffer, static_cast<size_t>(length))) >= 0, error = OT_ERROR_FAILED);
+
+    // The message keeps its own duplicate of the file descriptor.
+    VerifyOrExit(dbus_message_append_args(reply.get(), DBUS_TYPE_UNIX_FD, &fd, DBUS_TYPE_INVALID),
+                 error = OT_ERROR_NO_BUFS);
+
+exit:
+    if (buffer != nullptr)
+    {
+        dbus_free(buffer);
+    }
+
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    if (error == OT_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_DEBUG, "ExportProperties %s: %d bytes", aInterfaceName.c_str(), length);
+        dbus_connection_send(aRequest.GetConnection(), reply.get(), nullptr);
+    }
+    else
+    {
+        otbrLog(OTBR_LOG_WARNING, "ExportProperties %s error:%s", aInterfaceName.c_str(),
+                ConvertToDBusErrorName(error));
+        aRequest.ReplyOtResult(error);
+    }
+}
+
 void DBusObject::SetPropertyMethodHandler(DBusRequest &aRequest)
 {
-    DBusMessageIter iter;
-    std::string     interfaceName;
-    std::string     propertyName;
-    std::string     propertyFullPath;
-    otError         error = OT_ERROR_NONE;
+    DBusMessageIter            iter;
+    std::string                interfaceName;
+    std::string                propertyName;
+    const PropertyHandlerType *handler;
+    otError                    error = OT_ERROR_NONE;
 
     VerifyOrExit(dbus_message_iter_init(aRequest.GetMessage(), &iter), error = OT_ERROR_FAILED);
     VerifyOrExit(DBusMessageExtract(&iter, interfaceName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
     VerifyOrExit(DBusMessageExtract(&iter, propertyName) == OTBR_ERROR_NONE, error = OT_ERROR_PARSE);
 
-    propertyFullPath = interfaceName + "." + propertyName;
-    otbrLog(OTBR_LOG_INFO, "SetProperty %s", propertyFullPath.c_str());
-    {
-        auto handlerIter = mSetPropertyHandlers.find(propertyFullPath);
-
-        VerifyOrExit(handlerIter != mSetPropertyHandlers.end(), error = OT_ERROR_NOT_FOUND);
-        error = handlerIter->second(iter);
-    }
+    otbrLog(OTBR_LOG_INFO, "SetProperty %s.%s", interfaceName.c_str(), propertyName.c_str());
+    handler = mSetPropertyHandlers.Find(interfaceName.c_str(), propertyName.c_str());
+    VerifyOrExit(handler != nullptr, error = OT_ERROR_NOT_FOUND);
+    SuccessOrExit(error = (*handler)(iter));
+    InvalidatePropertyReply(interfaceName, propertyName);
 
 exit:
     if (error != OT_ERROR_NONE)
@@ -243,8 +433,219 @@ exit:
     return;
 }
 
+void DBusObject::SetPropertyReplyCached(const std::string &       aInterfaceName,
+                                        const std::string &       aPropertyName,
+                                        std::chrono::milliseconds aMaxAge)
+{
+    CachedReply *cachedReply = mCachedReplies.Find(aInterfaceName.c_str(), aPropertyName.c_str());
+
+    if (cachedReply == nullptr)
+    {
+        mCachedReplies.Add(aInterfaceName, aPropertyName, CachedReply());
+        cachedReply = mCachedReplies.Find(aInterfaceName.c_str(), aPropertyName.c_str());
+    }
+
+    cachedReply->mMaxAge = aMaxAge;
+    cachedReply->mReply  = nullptr;
+}
+
+void DBusObject::InvalidatePropertyReply(const std::string &aInterfaceName, const std::string &aPropertyName)
+{
+    CachedReply *cachedReply = mCachedReplies.Find(aInterfaceName.c_str(), aPropertyName.c_str());
+
+    if (cachedReply != nullptr)
+    {
+        cachedReply->mReply = nullptr;
+    }
+}
+
+otbrError DBusObject::QueuePropertyChanged(const std::string &aInterfaceName,
+                                           const std::string &aPropertyName,
+                                           PropertyEncoder    aEncoder)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    InvalidatePropertyReply(aInterfaceName, aPropertyName);
+    VerifyOrExit(IsSignalSubscribed(DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL));
+
+    if (mPropertiesChangedWindow == std::chrono::milliseconds::zero() || !mTimerPoster)
+    {
+        PropertyEncoders properties;
+
+        properties.emplace(aPropertyName, std::move(aEncoder));
+        ExitNow(error = SendPropertiesChanged(aInterfaceName, properties));
+    }
+
+    if (mPendingProperties.empty())
+    {
+        mPropertiesChangedTimer = mTimerPoster(std::chrono::steady_clock::now() + mPropertiesChangedWindow,
+                                               [this]() { FlushPropertiesChanged(); });
+    }
+
+    // A property changed again within the window is only signaled with its last value.
+    mPendingProperties[aInterfaceName][aPropertyName] = std::move(aEncoder);
+
+exit:
+    return error;
+}
+
+otbrError DBusObject::SignalPropertyChanged(const std::string &aInterfaceName, const std::string &aPropertyName)
+{
+    otbrError error         = OTBR_ERROR_NONE;
+    auto      interfaceIter = mGetPropertyHandlers.find(aInterfaceName);
+
+    VerifyOrExit(interfaceIter != mGetPropertyHandlers.end(), error = OTBR_ERROR_NOT_FOUND);
+
+    {
+        auto                handlerIter = interfaceIter->second.find(aPropertyName);
+        PropertyHandlerType handler;
+
+        VerifyOrExit(handlerIter != interfaceIter->second.end(), error = OTBR_ERROR_NOT_FOUND);
+        handler = handlerIter->second;
+
+        // The value is read when the signal is sent, so it is the latest one.
+        error = QueuePropertyChanged(aInterfaceName, aPropertyName, [handler](DBusMessageIter &aIter) {
+            return handler(aIter) == OT_ERROR_NONE ? OTBR_ERROR_NONE : OTBR_ERROR_DBUS;
+        });
+    }
+
+exit:
+    return error;
+}
+
+void DBusObject::FlushPropertiesChanged(void)
+{
+    std::map<std::string, PropertyEncoders> pending;
+
+    // The encoders may signal again, start a new window for those changes.
+    pending.swap(mPendingProperties);
+
+    for (const auto &interface : pending)
+    {
+        otbrError error = SendPropertiesChanged(interface.first, interface.second);
+
+        if (error != OTBR_ERROR_NONE)
+        {
+            otbrLog(OTBR_LOG_WARNING, "Failed to signal changed properties of %s: %s", interface.first.c_str(),
+                    otbrErrorString(error));
+        }
+    }
+}
+
+otbrError DBusObject::SendPropertiesChanged(const std::string &aInterfaceName, const PropertyEncoders &aProperties)
+{
+    UniqueDBusMessage signalMsg{
+        dbus_message_new_signal(mObjectPath.c_str(), DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL)};
+    DBusMessageIter iter, subIter, dictEntryIter;
+    otbrError       error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
+    dbus_message_iter_init_append(signalMsg.get(), &iter);
+
+    // interface_name
+    VerifyOrExit(DBusMessageEncode(&iter, aInterfaceName) == OTBR_ERROR_NONE, error = OTBR_ERROR_DBUS);
+
+    // changed_properties
+    VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
+                                                  "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
+                                                  &subIter),
+                 error = OTBR_ERROR_DBUS);
+
+    for (const auto &property : aProperties)
+    {
+        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
+                     error = OTBR_ERROR_DBUS);
+
+        SuccessOrExit(error = DBusMessageEncode(&dictEntryIter, property.first));
+        SuccessOrExit(error = property.second(dictEntryIter));
+
+        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OTBR_ERROR_DBUS);
+    }
+
+    VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OTBR_ERROR_DBUS);
+
+    // invalidated_properties
+    SuccessOrExit(error = DBusMessageEncode(&iter, std::vector<std::string>()));
+
+    otbrLog(OTBR_LOG_DEBUG, "Signal %zu changed properties of %s", aProperties.size(), aInterfaceName.c_str());
+    DumpDBusMessage(*signalMsg);
+
+    VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
+
+exit:
+    return error;
+}
+
+bool DBusObject::IsSignalSubscribed(const char *aInterfaceName, const char *aSignalName)
+{
+    bool subscribed = mSignalSubscribers == nullptr ||
+                      mSignalSubscribers->IsSubscribed(mObjectPath.c_str(), aInterfaceName, aSignalName);
+
+    if (!subscribed)
+    {
+        otbrLog(OTBR_LOG_DEBUG, "Skip signal %s.%s without subscribers", aInterfaceName, aSignalName);
+        Metrics::Get().Increment(Metrics::kCounterDBusSignalsSkipped);
+    }
+
+    return subscribed;
+}
+
+DBusRequest DBusObject::DeferRequest(DBusRequest &aRequest, std::chrono::milliseconds aTimeout)
+{
+    std::list<DeferredRequest>::iterator deferred;
+
+    // Drop the requests replied since, their timers have nothing left to do.
+    for (auto iter = mDeferredRequests.begin(); iter != mDeferredRequests.end();)
+    {
+        if (iter->mRequest.IsReplied())
+        {
+            iter->mTimer.Cancel();
+            iter = mDeferredRequests.erase(iter);
+        }
+        else
+        {
+            ++iter;
+        }
+    }
+
+    deferred = mDeferredRequests.emplace(mDeferredRequests.end(), aRequest);
+
+    if (mTimerPoster)
+    {
+        deferred->mTimer = mTimerPoster(std::chrono::steady_clock::now() + aTimeout, [this, deferred]() {
+            if (!deferred->mRequest.IsReplied())
+            {
+                otbrLog(OTBR_LOG_WARNING, "Deferred %s.%s timed out",
+                        dbus_message_get_interface(deferred->mRequest.GetMessage()),
+                        dbus_message_get_member(deferred->mRequest.GetMessage()));
+                deferred->mRequest.ReplyOtResult(OT_ERROR_RESPONSE_TIMEOUT);
+            }
+
+            mDeferredRequests.erase(deferred);
+        });
+    }
+
+    return deferred->mRequest;
+}
+
+void DBusObject::CancelDeferredRequests(otError aError)
+{
+    std::list<DeferredRequest> deferredRequests;
+
+    // Replying may defer new requests, which are not cancelled.
+    deferredRequests.swap(mDeferredRequests);
+
+    for (DeferredRequest &deferred : deferredRequests)
+    {
+        deferred.mTimer.Cancel();
+        deferred.mRequest.ReplyOtResult(aError);
+    }
+}
+
 DBusObject::~DBusObject(void)
 {
+    mPropertiesChangedTimer.Cancel();
+    CancelDeferredRequests(OT_ERROR_ABORT);
 }
 
 } // namespace DBus
@@ -34,20 +34,27 @@
 #ifndef OTBR_DBUS_DBUS_OBJECT_HPP_
 #define OTBR_DBUS_DBUS_OBJECT_HPP_
 
+#include <chrono>
 #include <functional>
+#include <list>
+#include <map>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 #include <dbus/dbus.h>
 
 #include "common/code_utils.hpp"
+#include "common/timer_wheel.hpp"
 #include "common/types.hpp"
 #include "dbus/common/constants.hpp"
 #include "dbus/common/dbus_message_dump.hpp"
 #include "dbus/common/dbus_message_helper.hpp"
 #include "dbus/common/dbus_resources.hpp"
+#include "dbus/server/dbus_member_table.hpp"
 #include "dbus/server/dbus_request.hpp"
+#include "dbus/server/dbus_signal_subscribers.hpp"
 
 namespace otbr {
 namespace DBus {
@@ -63,6 +70,8 @@ public:
 
     using PropertyHandlerType = std::function<otError(DBusMessageIter &)>;
 
+    using TimerPoster = std::function<TimerWheel::Handle(std::chrono::steady_clock::time_point, TimerWheel::Task)>;
+
     /**
      * The constructor of a d-bus object.
      *
@@ -107,6 +116,58 @@ public:
                                     const std::string &        aMethodName,
                                     const PropertyHandlerType &aHandler);
 
+    /**
+     * This method makes the replies to the Get calls of a property cached.
+     *
+     * The reply is encoded once and copied for the following calls, until it is invalidated or older than
+     * @p aMaxAge. This is meant for large properties which are expensive to encode, GetAll and GetProperties
+     * still read the property through its get handler.
+     *
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aPropertyName     The property name.
+     * @param[in]   aMaxAge           The time a cached reply is used for.
+     *
+     */
+    void SetPropertyReplyCached(const std::string &       aInterfaceName,
+                                const std::string &       aPropertyName,
+                                std::chrono::milliseconds aMaxAge);
+
+    /**
+     * This method drops the cached reply of a property, e.g. when the property changed.
+     *
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aPropertyName     The property name.
+     *
+     */
+    void InvalidatePropertyReply(const std::string &aInterfaceName, const std::string &aPropertyName);
+
+    /**
+     * This method registers a method which gets several properties of an interface in one call.
+     *
+     * The method takes an array of property names, and returns an array of variants with the value of each
+     * property in the same order. It fails as a whole if any of the properties cannot be read.
+     *
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aMethodName       The method name.
+     *
+     */
+    void RegisterGetPropertiesMethod(const std::string &aInterfaceName, const std::string &aMethodName);
+
+    /**
+     * This method registers a method which exports several properties of an interface through a file descriptor.
+     *
+     * The method takes an array of property names like the one registered by `RegisterGetPropertiesMethod()`, and
+     * returns a Unix file descriptor (type `h`) to a memory file. The file holds the reply that method would send,
+     * serialized by `dbus_message_marshal()`. Large values are then read by the client directly instead of passing
+     * through the bus daemon. The method fails with `OT_ERROR_NOT_CAPABLE` if the connection cannot pass file
+     * descriptors.
+     *
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aMethodName       The method name.
+     *
+     */
+    void RegisterExportPropertiesMethod(const std::string &aInterfaceName, const std::string &aMethodName);
+
     /**
      * This method registers the set handler for a property.
      *
@@ -135,12 +196,14 @@ public:
                      const std::string &              aSignalName,
                      const std::tuple<FieldTypes...> &aArgs)
     {
-        UniqueDBusMessage signalMsg{
-            dbus_message_new_signal(mObjectPath.c_str(), aInterfaceName.c_str(), aSignalName.c_str())};
-        otbrError error = OTBR_ERROR_NONE;
+        UniqueDBusMessage signalMsg;
+        otbrError         error = OTBR_ERROR_NONE;
 
+        VerifyOrExit(IsSignalSubscribed(aInterfaceName.c_str(), aSignalName.c_str()));
+        signalMsg = UniqueDBusMessage(
+            dbus_message_new_signal(mObjectPath.c_str(), aInterfaceName.c_str(), aSignalName.c_str()));
         VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
-        VerifyOrExit(error = otbr::DBus::TupleToDBusMessage(*signalMsg, aArgs));
+        SuccessOrExit(error = otbr::DBus::TupleToDBusMessage(*signalMsg, aArgs));
 
         VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
 
@@ -151,11 +214,14 @@ public:
     /**
      * This method sends a property changed signal.
      *
+     * When a coalescing window is set, the change is sent later in one signal with the other changes of the
+     * interface, see `SetPropertiesChangedWindow()`.
+     *
      * @param[in]   aInterfaceName    The interface name.
      * @param[in]   aPropertyName     The property name.
      * @param[in]   aValue            New value of the property.
      *
-     * @retval OTBR_ERROR_NONE  Signal successfully sent.
+     * @retval OTBR_ERROR_NONE  Signal successfully sent or queued.
      * @retval OTBR_ERROR_DBUS  Failed to send the signal.
      *
      */
@@ -164,45 +230,81 @@ public:
                                     const std::string &aPropertyName,
                                     const ValueType &  aValue)
     {
-        UniqueDBusMessage signalMsg{
-            dbus_message_new_signal(mObjectPath.c_str(), DBUS_INTERFACE_PROPERTIES, DBUS_PROPERTIES_CHANGED_SIGNAL)};
-        DBusMessageIter iter, subIter, dictEntryIter;
-        otbrError       error = OTBR_ERROR_NONE;
+        PropertyEncoder encoder = [aValue](DBusMessageIter &aIter) {
+            return DBusMessageEncodeToVariant(&aIter, aValue);
+        };
 
-        VerifyOrExit(signalMsg != nullptr, error = OTBR_ERROR_DBUS);
-        dbus_message_iter_init_append(signalMsg.get(), &iter);
-
-        // interface_name
-        VerifyOrExit(DBusMessageEncode(&iter, aInterfaceName) == OTBR_ERROR_NONE, error = OTBR_ERROR_DBUS);
-
-        // changed_properties
-        VerifyOrExit(dbus_message_iter_open_container(&iter, DBUS_TYPE_ARRAY,
-                                                      "{" DBUS_TYPE_STRING_AS_STRING DBUS_TYPE_VARIANT_AS_STRING "}",
-                                                      &subIter),
-                     error = OTBR_ERROR_DBUS);
-        VerifyOrExit(dbus_message_iter_open_container(&subIter, DBUS_TYPE_DICT_ENTRY, nullptr, &dictEntryIter),
-                     error = OTBR_ERROR_DBUS);
+        return QueuePropertyChanged(aInterfaceName, aPropertyName, std::move(encoder));
+    }
 
-        SuccessOrExit(error = DBusMessageEncode(&dictEntryIter, aPropertyName));
-        SuccessOrExit(error = DBusMessageEncodeToVariant(&dictEntryIter, aValue));
+    /**
+     * This method sends a property changed signal with the value read by the get handler of the property.
+     *
+     * @param[in]   aInterfaceName    The interface name.
+     * @param[in]   aPropertyName     The property name.
+     *
+     * @retval OTBR_ERROR_NONE      Signal successfully sent or queued.
+     * @retval OTBR_ERROR_NOT_FOUND The property has no get handler.
+     * @retval OTBR_ERROR_DBUS      Failed to send the signal.
+     *
+     */
+    otbrError SignalPropertyChanged(const std::string &aInterfaceName, const std::string &aPropertyName);
 
-        VerifyOrExit(dbus_message_iter_close_container(&subIter, &dictEntryIter), error = OTBR_ERROR_DBUS);
-        VerifyOrExit(dbus_message_iter_close_container(&iter, &subIter), error = OTBR_ERROR_DBUS);
+    /**
+     * This method sets the tracker of the signal subscribers.
+     *
+     * With it, the signals no peer subscribes to are neither encoded nor sent. Without it, every signal is sent.
+     *
+     * @param[in]   aSubscribers    The tracker, which MUST outlive the object, or nullptr.
+     *
+     */
+    void SetSignalSubscribers(SignalSubscribers *aSubscribers) { mSignalSubscribers = aSubscribers; }
 
-        // invalidated_properties
-        SuccessOrExit(error = DBusMessageEncode(&iter, std::vector<std::string>()));
+    /**
+     * This method sets the function posting the timers of the object.
+     *
+     * Without it, property changed signals are not coalesced and deferred requests do not time out.
+     *
+     * @param[in]   aPoster     The function posting a timer task.
+     *
+     */
+    void SetTimerPoster(TimerPoster aPoster) { mTimerPoster = std::move(aPoster); }
 
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
-        {
-            otbrLog(OTBR_LOG_DEBUG, "Signal %s.%s", aInterfaceName.c_str(), aPropertyName.c_str());
-            DumpDBusMessage(*signalMsg);
-        }
+    /**
+     * This method makes the object coalesce property changed signals.
+     *
+     * The properties of an interface changed within the window since the first pending change are sent in one
+     * PropertiesChanged signal, each with its last value.
+     *
+     * @param[in]   aWindow     The window, zero to send each change at once.
+     *
+     */
+    void SetPropertiesChangedWindow(std::chrono::milliseconds aWindow) { mPropertiesChangedWindow = aWindow; }
 
-        VerifyOrExit(dbus_connection_send(mConnection, signalMsg.get(), nullptr), error = OTBR_ERROR_DBUS);
+    /**
+     * This method parks a request which is replied later, e.g. from the callback of a long-running operation.
+     *
+     * The method handler returns at once, so other calls are handled meanwhile. The returned copy of the request
+     * is the one to keep for the reply. A request not replied within @p aTimeout is replied with
+     * `OT_ERROR_RESPONSE_TIMEOUT`, and later replies to it are dropped.
+     *
+     * @param[in]   aRequest    The request.
+     * @param[in]   aTimeout    The time to wait for the reply.
+     *
+     * @returns The request to reply.
+     *
+     */
+    DBusRequest DeferRequest(DBusRequest &aRequest, std::chrono::milliseconds aTimeout);
 
-    exit:
-        return error;
-    }
+    /**
+     * This method replies to all the deferred requests not replied yet with an error.
+     *
+     * This is used when the pending operations can no longer complete, e.g. the NCP is reset.
+     *
+     * @param[in]   aError  The error to reply.
+     *
+     */
+    void CancelDeferredRequests(otError aError);
 
     /**
      * The destructor of a d-bus object.
@@ -215,16 +317,62 @@ private:
 
     void GetPropertyMethodHandler(DBusRequest &aRequest);
 
+    void GetPropertiesMethodHandler(const std::string &aInterfaceName, DBusRequest &aRequest);
+
+    void ExportPropertiesMethodHandler(const std::string &aInterfaceName, DBusRequest &aRequest);
+
+    otError EncodeProperties(const std::string &aInterfaceName, DBusRequest &aRequest, DBusMessage &aReply);
+
     void SetPropertyMethodHandler(DBusRequest &aRequest);
 
+    using PropertyEncoder  = std::function<otbrError(DBusMessageIter &)>;
+    using PropertyEncoders = std::map<std::string, PropertyEncoder>;
+
+    otbrError QueuePropertyChanged(const std::string &aInterfaceName,
+                                   const std::string &aPropertyName,
+                                   PropertyEncoder    aEncoder);
+    otbrError SendPropertiesChanged(const std::string &aInterfaceName, const PropertyEncoders &aProperties);
+    void      FlushPropertiesChanged(void);
+    bool      IsSignalSubscribed(const char *aInterfaceName, const char *aSignalName);
+
+    struct CachedReply
+    {
+        std::chrono::milliseconds             mMaxAge;
+        std::chrono::steady_clock::time_point mTime;
+        UniqueDBusMessage                     mReply; ///< Without serial and destination, nullptr if invalidated.
+    };
+
+    struct DeferredRequest
+    {
+        DeferredRequest(const DBusRequest &aRequest)
+            : mRequest(aRequest)
+        {
+        }
+
+        DBusRequest        mRequest;
+        TimerWheel::Handle mTimer;
+    };
+
     static DBusHandlerResult sMessageHandler(DBusConnection *aConnection, DBusMessage *aMessage, void *aData);
     DBusHandlerResult        MessageHandler(DBusConnection *aConnection, DBusMessage *aMessage);
 
-    std::unordered_map<std::string, MethodHandlerType>                                    mMethodHandlers;
+    MemberTable<MethodHandlerType>                                                        mMethodHandlers;
     std::unordered_map<std::string, std::unordered_map<std::string, PropertyHandlerType>> mGetPropertyHandlers;
-    std::unordered_map<std::string, PropertyHandlerType>                                  mSetPropertyHandlers;
+    MemberTable<PropertyHandlerType>                                                      mGetPropertyTable;
+    MemberTable<PropertyHandlerType>                                                      mSetPropertyHandlers;
     DBusConnection *                                                                      mConnection;
     std::string                                                                           mObjectPath;
+    SignalSubscribers *                                                                   mSignalSubscribers;
+
+    // The changed properties of each interface not signaled yet
+    std::map<std::string, PropertyEncoders> mPendingProperties;
+    std::chrono::milliseconds               mPropertiesChangedWindow;
+    TimerPoster                             mTimerPoster;
+    TimerWheel::Handle                      mPropertiesChangedTimer;
+
+    std::list<DeferredRequest> mDeferredRequests;
+
+    MemberTable<CachedReply> mCachedReplies;
 };
 
 } // namespace DBus
@@ -31,6 +31,8 @@
  * This file includes definitions for a d-bus request.
  */
 
+#include <memory>
+
 #include "common/logging.hpp"
 
 #include "dbus/common/dbus_message_dump.hpp"
@@ -58,6 +60,7 @@ public:
     DBusRequest(DBusConnection *aConnection, DBusMessage *aMessage)
         : mConnection(aConnection)
         , mMessage(aMessage)
+        , mReplied(std::make_shared<bool>(false))
     {
         dbus_message_ref(aMessage);
         dbus_connection_ref(aConnection);
@@ -104,6 +107,17 @@ public:
      */
     DBusConnection *GetConnection(void) { return mConnection; }
 
+    /**
+     * This method indicates whether the d-bus method call has been replied.
+     *
+     * The copies of a request share this state, a call is only replied once however many copies try.
+     *
+     * @retval  true    The call has been replied.
+     * @retval  false   The call has not been replied.
+     *
+     */
+    bool IsReplied(void) const { return *mReplied; }
+
     /**
      * This method replies to the d-bus method call.
      *
@@ -112,17 +126,17 @@ public:
      */
     template <typename... Args> void Reply(const std::tuple<Args...> &aReply)
     {
-        UniqueDBusMessage reply{dbus_message_new_method_return(mMessage)};
+        UniqueDBusMessage reply{nullptr};
 
+        VerifyOrExit(!*mReplied);
+        *mReplied = true;
+        reply     = UniqueDBusMessage(dbus_message_new_method_return(mMessage));
         VerifyOrExit(reply != nullptr);
         VerifyOrExit(otbr::DBus::TupleToDBusMessage(*reply, aReply) == OTBR_ERROR_NONE);
 
-        if (otbrLogGetLevel() >= OTBR_LOG_DEBUG)
-        {
-            otbrLog(OTBR_LOG_DEBUG, "Replied to %s.%s :", dbus_message_get_interface(mMessage),
-                    dbus_message_get_member(mMessage));
-            DumpDBusMessage(*reply);
-        }
+        otbrLog(OTBR_LOG_DEBUG, "Replied to %s.%s :", dbus_message_get_interface(mMessage),
+                dbus_message_get_member(mMessage));
+        DumpDBusMessage(*reply);
         dbus_connection_send(mConnection, reply.get(), nullptr);
 
     exit:
@@ -140,6 +154,9 @@ public:
         UniqueDBusMessage reply{nullptr};
         auto              logLevel = (aError == OT_ERROR_NONE) ? OTBR_LOG_INFO : OTBR_LOG_ERR;
 
+        VerifyOrExit(!*mReplied);
+        *mReplied = true;
+
         otbrLog(logLevel, "Replied to %s.%s with result %s", dbus_message_get_interface(mMessage),
                 dbus_message_get_member(mMessage), ConvertToDBusErrorName(aError));
         if (aError == OT_ERROR_NONE)
@@ -187,12 +204,14 @@ private:
         }
         mConnection = aOther.mConnection;
         mMessage    = aOther.mMessage;
+        mReplied    = aOther.mReplied;
         dbus_message_ref(mMessage);
         dbus_connection_ref(mConnection);
     }
 
-    DBusConnection *mConnection;
-    DBusMessage *   mMessage;
+    DBusConnection *      mConnection;
+    DBusMessage *         mMessage;
+    std::shared_ptr<bool> mReplied;
 };
 
 } // namespace DBus
@@ -0,0 +1,468 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file implements tracking the subscribers of d-bus signals.
+ */
+
+#include "dbus/server/dbus_signal_subscribers.hpp"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/mainloop_poller.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+#include "dbus/common/dbus_resources.hpp"
+
+namespace otbr {
+namespace DBus {
+
+static const int kBusCallTimeoutMs = 5000;
+
+#define OTBR_DBUS_INTERFACE_STATS "org.freedesktop.DBus.Debug.Stats"
+
+static bool IsInPathNamespace(const char *aPath, const std::string &aNamespace)
+{
+    size_t length = aNamespace.size();
+
+    // The namespace "/" contains every path.
+    return aNamespace == "/" ||
+           (strncmp(aPath, aNamespace.c_str(), length) == 0 && (aPath[length] == '\0' || aPath[length] == '/'));
+}
+
+SignalSubscribers::SignalSubscribers(void)
+    : mMonitor(nullptr)
+    , mMonitorFd(-1)
+{
+}
+
+SignalSubscribers::~SignalSubscribers(void)
+{
+    Stop();
+}
+
+otbrError SignalSubscribers::Start(DBusConnection &aConnection, const std::string &aServerName)
+{
+    static const char *const kMonitorRules[] = {
+        "type='method_call',interface='" DBUS_INTERFACE_DBUS "',member='AddMatch'",
+        "type='method_call',interface='" DBUS_INTERFACE_DBUS "',member='RemoveMatch'",
+        "type='signal',sender='" DBUS_SERVICE_DBUS "',interface='" DBUS_INTERFACE_DBUS "',member='NameOwnerChanged'",
+    };
+
+    std::vector<std::string> rules(std::begin(kMonitorRules), std::end(kMonitorRules));
+    const char *             uniqueName = dbus_bus_get_unique_name(&aConnection);
+    UniqueDBusMessage        message;
+    UniqueDBusMessage        reply;
+    DBusError                dbusError;
+    otbrError                error = OTBR_ERROR_NONE;
+
+    dbus_error_init(&dbusError);
+    VerifyOrExit(mMonitor == nullptr);
+
+    // A monitor cannot send anything, it needs its own connection.
+    mMonitor = dbus_bus_get_private(DBUS_BUS_SYSTEM, &dbusError);
+    VerifyOrExit(mMonitor != nullptr, error = OTBR_ERROR_DBUS);
+    dbus_connection_set_exit_on_disconnect(mMonitor, FALSE);
+
+    message = UniqueDBusMessage(
+        dbus_message_new_method_call(DBUS_SERVICE_DBUS, DBUS_PATH_DBUS, DBUS_INTERFACE_MONITORING, "BecomeMonitor"));
+    VerifyOrExit(message != nullptr, error = OTBR_ERROR_DBUS);
+    SuccessOrExit(error = TupleToDBusMessage(*message, std::make_tuple(rules, static_cast<uint32_t>(0))));
+    reply = UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(mMonitor, message.get(), kBusCallTimeoutMs, &dbusError));
+    VerifyOrExit(reply != nullptr, error = OTBR_ERROR_DBUS);
+    VerifyOrExit(dbus_connection_get_unix_fd(mMonitor, &mMonitorFd), error = OTBR_ERROR_DBUS);
+
+    mOwnNames.clear();
+    mOwnNames.push_back(aServerName);
+    if (uniqueName != nullptr)
+    {
+        mOwnNames.push_back(uniqueName);
+    }
+
+    // The monitor started first, so that no peer is missed in between.
+    if (!SeedMatchRules(aConnection))
+    {
+        SeedUnknownPeers(aConnection);
+    }
+
+    SuccessOrExit(error = MainloopPoller::Get().Register(mMonitorFd, MainloopPoller::kEventRead));
+    otbrLog(OTBR_LOG_INFO, "Monitoring the signal subscribers of %zu peers", mPeers.size());
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Cannot monitor the signal subscribers, sending every signal: %s",
+                dbus_error_is_set(&dbusError) ? dbusError.message : otbrErrorString(error));
+        Stop();
+    }
+
+    dbus_error_free(&dbusError);
+    return error;
+}
+
+void SignalSubscribers::Stop(void)
+{
+    VerifyOrExit(mMonitor != nullptr);
+
+    if (mMonitorFd >= 0)
+    {
+        MainloopPoller::Get().Unregister(mMonitorFd);
+        mMonitorFd = -1;
+    }
+
+    dbus_connection_close(mMonitor);
+    dbus_connection_unref(mMonitor);
+    mMonitor = nullptr;
+    mPeers.clear();
+
+exit:
+    return;
+}
+
+bool SignalSubscribers::SeedMatchRules(DBusConnection &aConnection)
+{
+    UniqueDBusMessage message(dbus_message_new_method_call(DBUS_SERVICE_DBUS, DBUS_PATH_DBUS,
+                                                           OTBR_DBUS_INTERFACE_STATS, "GetAllMatchRules"));
+    UniqueDBusMessage reply;
+    DBusMessageIter   iter;
+    DBusMessageIter   subIter;
+    bool              seeded = false;
+
+    // The debug statistics are only available if the bus daemon is built with them.
+    VerifyOrExit(message != nullptr);
+    reply = UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(&aConnection, message.get(), kBusCallTimeoutMs, nullptr));
+    VerifyOrExit(reply != nullptr);
+    VerifyOrExit(dbus_message_iter_init(reply.get(), &iter));
+    VerifyOrExit(dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY);
+
+    for (dbus_message_iter_recurse(&iter, &subIter); dbus_message_iter_get_arg_type(&subIter) == DBUS_TYPE_DICT_ENTRY;
+         dbus_message_iter_next(&subIter))
+    {
+        DBusMessageIter          entryIter;
+        std::string              peer;
+        std::vector<std::string> rules;
+
+        dbus_message_iter_recurse(&subIter, &entryIter);
+        VerifyOrExit(DBusMessageExtract(&entryIter, peer) == OTBR_ERROR_NONE);
+        VerifyOrExit(DBusMessageExtract(&entryIter, rules) == OTBR_ERROR_NONE);
+
+        for (const std::string &rule : rules)
+        {
+            AddMatch(peer, rule);
+        }
+    }
+
+    seeded = true;
+
+exit:
+    if (!seeded)
+    {
+        mPeers.clear();
+    }
+
+    return seeded;
+}
+
+void SignalSubscribers::SeedUnknownPeers(DBusConnection &aConnection)
+{
+    UniqueDBusMessage message(
+        dbus_message_new_method_call(DBUS_SERVICE_DBUS, DBUS_PATH_DBUS, DBUS_INTERFACE_DBUS, "ListNames"));
+    UniqueDBusMessage        reply;
+    std::vector<std::string> names;
+    auto                     args = std::tie(names);
+
+    VerifyOrExit(message != nullptr);
+    reply = UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(&aConnection, message.get(), kBusCallTimeoutMs, nullptr));
+    VerifyOrExit(reply != nullptr && DBusMessageToTuple(*reply, args) == OTBR_ERROR_NONE);
+
+    for (const std::string &name : names)
+    {
+        // Only unique names are connections, the peers may have subscribed to anything.
+        if (name[0] == ':' && std::find(mOwnNames.begin(), mOwnNames.end(), name) == mOwnNames.end() &&
+            name != dbus_bus_get_unique_name(mMonitor))
+        {
+            AddUnknownPeer(name);
+        }
+    }
+
+exit:
+    return;
+}
+
+void SignalSubscribers::Process(void)
+{
+    if (mMonitor != nullptr && MainloopPoller::Get().GetReadyEvents(mMonitorFd) != 0)
+    {
+        ReadMessages();
+    }
+}
+
+void SignalSubscribers::ReadMessages(void)
+{
+    VerifyOrExit(mMonitor != nullptr);
+
+    dbus_connection_read_write(mMonitor, 0);
+
+    for (DBusMessage *message; (message = dbus_connection_pop_message(mMonitor)) != nullptr;)
+    {
+        HandleMessage(*message);
+        dbus_message_unref(message);
+    }
+
+    if (!dbus_connection_get_is_connected(mMonitor))
+    {
+        otbrLog(OTBR_LOG_WARNING, "Lost the monitor of the signal subscribers, sending every signal");
+        Stop();
+    }
+
+exit:
+    return;
+}
+
+void SignalSubscribers::HandleMessage(DBusMessage &aMessage)
+{
+    const char *sender = dbus_message_get_sender(&aMessage);
+    const char *rule;
+    const char *name;
+    const char *oldOwner;
+    const char *newOwner;
+
+    if (dbus_message_is_method_call(&aMessage, DBUS_INTERFACE_DBUS, "AddMatch") && sender != nullptr &&
+        dbus_message_get_args(&aMessage, nullptr, DBUS_TYPE_STRING, &rule, DBUS_TYPE_INVALID))
+    {
+        AddMatch(sender, rule);
+    }
+    else if (dbus_message_is_method_call(&aMessage, DBUS_INTERFACE_DBUS, "RemoveMatch") && sender != nullptr &&
+             dbus_message_get_args(&aMessage, nullptr, DBUS_TYPE_STRING, &rule, DBUS_TYPE_INVALID))
+    {
+        RemoveMatch(sender, rule);
+    }
+    else if (dbus_message_is_signal(&aMessage, DBUS_INTERFACE_DBUS, "NameOwnerChanged") &&
+             dbus_message_get_args(&aMessage, nullptr, DBUS_TYPE_STRING, &name, DBUS_TYPE_STRING, &oldOwner,
+                                   DBUS_TYPE_STRING, &newOwner, DBUS_TYPE_INVALID) &&
+             name[0] == ':' && newOwner[0] == '\0')
+    {
+        RemovePeer(name);
+    }
+}
+
+bool SignalSubscribers::IsSubscribed(const char *aPath, const char *aInterfaceName, const char *aSignalName)
+{
+    // The monitor may not have been read yet when a peer subscribes and then calls a method emitting the signal.
+    if (IsMonitoring() && !Matches(aPath, aInterfaceName, aSignalName))
+    {
+        ReadMessages();
+    }
+
+    return !IsMonitoring() || Matches(aPath, aInterfaceName, aSignalName);
+}
+
+bool SignalSubscribers::Matches(const char *aPath, const char *aInterfaceName, const char *aSignalName) const
+{
+    bool matches = false;
+
+    for (const auto &peer : mPeers)
+    {
+        VerifyOrExit(!peer.second.mUnknown, matches = true);
+
+        for (const MatchRule &rule : peer.second.mRules)
+        {
+            VerifyOrExit(!rule.Matches(mOwnNames, aPath, aInterfaceName, aSignalName), matches = true);
+        }
+    }
+
+exit:
+    return matches;
+}
+
+void SignalSubscribers::AddMatch(const std::string &aPeer, const std::string &aRule)
+{
+    MatchRule rule;
+
+    if (!ParseMatchRule(aRule, rule))
+    {
+        // The rule may still be valid to the bus daemon, let it match every signal.
+        rule                 = MatchRule();
+        rule.mRule           = aRule;
+        rule.mSignal         = true;
+        rule.mHasDestination = false;
+    }
+
+    mPeers[aPeer].mRules.push_back(rule);
+}
+
+void SignalSubscribers::RemoveMatch(const std::string &aPeer, const std::string &aRule)
+{
+    auto peer = mPeers.find(aPeer);
+
+    VerifyOrExit(peer != mPeers.end());
+
+    {
+        std::vector<MatchRule> &rules = peer->second.mRules;
+        auto                    rule  = std::find_if(rules.begin(), rules.end(),
+                                         [&aRule](const MatchRule &aMatchRule) { return aMatchRule.mRule == aRule; });
+
+        // A rule written differently is not found and kept, which only sends more signals.
+        VerifyOrExit(rule != rules.end());
+        rules.erase(rule);
+    }
+
+    if (!peer->second.mUnknown && peer->second.mRules.empty())
+    {
+        mPeers.erase(peer);
+    }
+
+exit:
+    return;
+}
+
+void SignalSubscribers::AddUnknownPeer(const std::string &aPeer)
+{
+    mPeers[aPeer].mUnknown = true;
+}
+
+void SignalSubscribers::RemovePeer(const std::string &aPeer)
+{
+    mPeers.erase(aPeer);
+}
+
+bool SignalSubscribers::ParseMatchRule(const std::string &aRule, MatchRule &aMatchRule)
+{
+    bool   parsed = false;
+    size_t pos    = 0;
+
+    aMatchRule                 = MatchRule();
+    aMatchRule.mRule           = aRule;
+    aMatchRule.mSignal         = true;
+    aMatchRule.mHasDestination = false;
+
+    while (pos < aRule.size())
+    {
+        size_t      equal = aRule.find('=', pos);
+        std::string key;
+        std::string value;
+        bool        quoted = false;
+
+        VerifyOrExit(equal != std::string::npos);
+        key = aRule.substr(pos, equal - pos);
+        key.erase(0, key.find_first_not_of(' '));
+
+        // Values are quoted with apostrophes, an apostrophe itself is escaped as \' outside the quotes.
+        for (pos = equal + 1; pos < aRule.size(); pos++)
+        {
+            char c = aRule[pos];
+
+            if (c == '\'')
+            {
+                quoted = !quoted;
+            }
+            else if (!quoted && c == '\\' && pos + 1 < aRule.size() && aRule[pos + 1] == '\'')
+            {
+                value.push_back('\'');
+                pos++;
+            }
+            else if (!quoted && c == ',')
+            {
+                break;
+            }
+            else
+            {
+                value.push_back(c);
+            }
+        }
+
+        VerifyOrExit(!quoted);
+        pos++;
+
+        if (key == "type")
+        {
+            aMatchRule.mSignal = (value == "signal");
+        }
+        else if (key == "sender")
+        {
+            aMatchRule.mSender = value;
+        }
+        else if (key == "interface")
+        {
+            aMatchRule.mInterface = value;
+        }
+        else if (key == "member")
+        {
+            aMatchRule.mMember = value;
+        }
+        else if (key == "path")
+        {
+            aMatchRule.mPath = value;
+        }
+        else if (key == "path_namespace")
+        {
+            aMatchRule.mPathNamespace = value;
+        }
+        else if (key == "destination")
+        {
+            aMatchRule.mHasDestination = true;
+        }
+
+        // The arguments only narrow the rule down, ignoring them matches more signals than the bus daemon does.
+    }
+
+    parsed = true;
+
+exit:
+    return parsed;
+}
+
+bool SignalSubscribers::MatchRule::Matches(const std::vector<std::string> &aOwnNames,
+                                           const char *                    aPath,
+                                           const char *                    aInterfaceName,
+                                           const char *                    aSignalName) const
+{
+    bool matches = false;
+
+    // The signals are broadcast, they never match a rule with a destination.
+    VerifyOrExit(mSignal && !mHasDestination);
+    VerifyOrExit(mSender.empty() || std::find(aOwnNames.begin(), aOwnNames.end(), mSender) != aOwnNames.end());
+    VerifyOrExit(mInterface.empty() || mInterface == aInterfaceName);
+    VerifyOrExit(mMember.empty() || mMember == aSignalName);
+    VerifyOrExit(mPath.empty() || mPath == aPath);
+    VerifyOrExit(mPathNamespace.empty() || IsInPathNamespace(aPath, mPathNamespace));
+    matches = true;
+
+exit:
+    return matches;
+}
+
+} // namespace DBus
+} // namespace otbr
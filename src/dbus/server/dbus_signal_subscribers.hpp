@@ -0,0 +1,214 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for tracking the subscribers of d-bus signals.
+ */
+
+#ifndef OTBR_DBUS_DBUS_SIGNAL_SUBSCRIBERS_HPP_
+#define OTBR_DBUS_DBUS_SIGNAL_SUBSCRIBERS_HPP_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <dbus/dbus.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+namespace DBus {
+
+/**
+ * This class tracks the match rules of the bus peers to tell whether anyone receives a signal.
+ *
+ * The bus daemon does not tell a service who listens to its signals. A private connection becomes a bus monitor of
+ * the AddMatch and RemoveMatch calls and of the NameOwnerChanged signals instead. Peers connected before the monitor
+ * started are seeded from the debug statistics of the bus if available, or else assumed to listen to every signal.
+ *
+ * The tracking only ever errs on the side of sending a signal. Without a monitor, every signal is subscribed.
+ *
+ */
+class SignalSubscribers
+{
+public:
+    /**
+     * The constructor of the tracker, which does not monitor the bus yet.
+     *
+     */
+    SignalSubscribers(void);
+
+    ~SignalSubscribers(void);
+
+    /**
+     * This method starts monitoring the bus.
+     *
+     * Monitoring the system bus requires root privileges.
+     *
+     * @param[in]   aConnection     The connection sending the signals, used to seed the peers.
+     * @param[in]   aServerName     The well-known name owned by @p aConnection.
+     *
+     * @retval OTBR_ERROR_NONE  Successfully started monitoring.
+     * @retval OTBR_ERROR_DBUS  Failed to monitor the bus, every signal is considered subscribed.
+     *
+     */
+    otbrError Start(DBusConnection &aConnection, const std::string &aServerName);
+
+    /**
+     * This method stops monitoring the bus, every signal is considered subscribed afterwards.
+     *
+     */
+    void Stop(void);
+
+    /**
+     * This method indicates whether the bus is monitored.
+     *
+     */
+    bool IsMonitoring(void) const { return mMonitor != nullptr; }
+
+    /**
+     * This method processes the messages received by the monitor.
+     *
+     */
+    void Process(void);
+
+    /**
+     * This method indicates whether a signal of the object may be received by any peer.
+     *
+     * The messages already received by the monitor are processed first, so that a peer subscribing before calling a
+     * method gets the signals emitted by the method.
+     *
+     * @param[in]   aPath           The object path.
+     * @param[in]   aInterfaceName  The interface name of the signal.
+     * @param[in]   aSignalName     The signal name.
+     *
+     * @returns Whether to send the signal.
+     *
+     */
+    bool IsSubscribed(const char *aPath, const char *aInterfaceName, const char *aSignalName);
+
+    /**
+     * This method indicates whether any known match rule matches a signal, regardless of monitoring.
+     *
+     * @param[in]   aPath           The object path.
+     * @param[in]   aInterfaceName  The interface name of the signal.
+     * @param[in]   aSignalName     The signal name.
+     *
+     * @returns Whether a match rule matches the signal.
+     *
+     */
+    bool Matches(const char *aPath, const char *aInterfaceName, const char *aSignalName) const;
+
+    /**
+     * This method records a match rule added by a peer.
+     *
+     * @param[in]   aPeer   The unique name of the peer.
+     * @param[in]   aRule   The match rule.
+     *
+     */
+    void AddMatch(const std::string &aPeer, const std::string &aRule);
+
+    /**
+     * This method forgets a match rule removed by a peer.
+     *
+     * @param[in]   aPeer   The unique name of the peer.
+     * @param[in]   aRule   The match rule.
+     *
+     */
+    void RemoveMatch(const std::string &aPeer, const std::string &aRule);
+
+    /**
+     * This method records a peer with unknown match rules, which matches every signal until it disconnects.
+     *
+     * @param[in]   aPeer   The unique name of the peer.
+     *
+     */
+    void AddUnknownPeer(const std::string &aPeer);
+
+    /**
+     * This method forgets a disconnected peer.
+     *
+     * @param[in]   aPeer   The unique name of the peer.
+     *
+     */
+    void RemovePeer(const std::string &aPeer);
+
+    /**
+     * This method sets the names of the connection sending the signals, to match the sender of the rules.
+     *
+     * @param[in]   aNames  The unique name and the well-known names.
+     *
+     */
+    void SetOwnNames(const std::vector<std::string> &aNames) { mOwnNames = aNames; }
+
+private:
+    struct MatchRule
+    {
+        bool Matches(const std::vector<std::string> &aOwnNames,
+                     const char *                    aPath,
+                     const char *                    aInterfaceName,
+                     const char *                    aSignalName) const;
+
+        std::string mRule;
+        bool        mSignal;
+        bool        mHasDestination;
+        std::string mSender;
+        std::string mInterface;
+        std::string mMember;
+        std::string mPath;
+        std::string mPathNamespace;
+    };
+
+    struct Peer
+    {
+        Peer(void)
+            : mUnknown(false)
+        {
+        }
+
+        bool                   mUnknown;
+        std::vector<MatchRule> mRules;
+    };
+
+    static bool ParseMatchRule(const std::string &aRule, MatchRule &aMatchRule);
+    bool        SeedMatchRules(DBusConnection &aConnection);
+    void        SeedUnknownPeers(DBusConnection &aConnection);
+    void        ReadMessages(void);
+    void        HandleMessage(DBusMessage &aMessage);
+
+    DBusConnection *            mMonitor;
+    int                         mMonitorFd;
+    std::vector<std::string>    mOwnNames;
+    std::map<std::string, Peer> mPeers;
+};
+
+} // namespace DBus
+} // namespace otbr
+
+#endif // OTBR_DBUS_DBUS_SIGNAL_SUBSCRIBERS_HPP_
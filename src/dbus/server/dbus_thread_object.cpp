@@ -29,8 +29,11 @@
 #include <assert.h>
 #include <string.h>
 
+#include <algorithm>
+
 #include <openthread/border_router.h>
 #include <openthread/channel_monitor.h>
+#include <openthread/commissioner.h>
 #include <openthread/instance.h>
 #include <openthread/joiner.h>
 #include <openthread/link_raw.h>
@@ -39,7 +42,13 @@
 #include <openthread/thread_ftd.h>
 #include <openthread/platform/radio.h>
 
+#include "agent/config_reloader.hpp"
+#include "agent/instance_params.hpp"
 #include "common/byteswap.hpp"
+#include "common/mainloop_stats.hpp"
+#include "common/memory_stats.hpp"
+#include "common/metrics.hpp"
+#include "common/tlv.hpp"
 #include "dbus/common/constants.hpp"
 #include "dbus/server/dbus_agent.hpp"
 #include "dbus/server/dbus_thread_object.hpp"
@@ -50,6 +59,7 @@
 
 using std::placeholders::_1;
 using std::placeholders::_2;
+using std::placeholders::_3;
 
 static std::string GetDeviceRoleName(otDeviceRole aRole)
 {
@@ -77,6 +87,43 @@ static std::string GetDeviceRoleName(otDeviceRole aRole)
     return roleName;
 }
 
+/**
+ * This structure represents a property whose change is signaled when any of its state change flags is set.
+ *
+ * The properties are cached by clients, see `ThreadApiDBus::SetPropertyCacheEnabled()`. The get handler of such
+ * a property must not fail, or the signal of all properties changed at the same time is lost.
+ *
+ */
+struct SignaledProperty
+{
+    const char *   mName;
+    otChangedFlags mFlags;
+};
+
+static const SignaledProperty kSignaledProperties[] = {
+    {OTBR_DBUS_PROPERTY_NETWORK_NAME, OT_CHANGED_THREAD_NETWORK_NAME},
+    {OTBR_DBUS_PROPERTY_PANID, OT_CHANGED_THREAD_PANID},
+    {OTBR_DBUS_PROPERTY_EXTPANID, OT_CHANGED_THREAD_EXT_PANID},
+    {OTBR_DBUS_PROPERTY_CHANNEL, OT_CHANGED_THREAD_CHANNEL},
+    {OTBR_DBUS_PROPERTY_RLOC16, OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_RLOC_ADDED},
+    {OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY, OT_CHANGED_THREAD_PARTITION_ID},
+};
+
+// The tables whose Get replies are cached. Besides membership, the entries carry age and link quality which
+// change without an event, so a cached reply is only used for a short time.
+static const char *const kCachedTableProperties[] = {
+    OTBR_DBUS_PROPERTY_CHILD_TABLE,
+    OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY,
+    OTBR_DBUS_PROPERTY_CHANNEL_MONITOR_ALL_CHANNEL_QUALITIES,
+};
+static const std::chrono::seconds kTableReplyMaxAge(1);
+
+// The time to wait for the long-running operations before replying a timeout
+static const std::chrono::seconds kScanTimeout(30);
+static const std::chrono::seconds kAttachTimeout(120);
+static const std::chrono::seconds kJoinerStartTimeout(120);
+static const std::chrono::seconds kAddJoinersTimeout(30);
+
 static uint64_t ConvertOpenThreadUint64(const uint8_t *aValue)
 {
     uint64_t val = 0;
@@ -88,39 +135,203 @@ static uint64_t ConvertOpenThreadUint64(const uint8_t *aValue)
     return val;
 }
 
+static void ConvertToOpenThreadUint64(uint64_t aValue, uint8_t *aResult)
+{
+    for (size_t i = sizeof(uint64_t); i > 0; i--)
+    {
+        aResult[i - 1] = static_cast<uint8_t>(aValue & 0xff);
+        aValue >>= 8;
+    }
+}
+
 namespace otbr {
 namespace DBus {
 
+static void ConvertToOpenThreadPrefix(const Ip6Prefix &aPrefix, otIp6Prefix &aResult)
+{
+    memset(&aResult, 0, sizeof(aResult));
+    // size is guaranteed by parsing
+    std::copy(aPrefix.mPrefix.begin(), aPrefix.mPrefix.end(), &aResult.mPrefix.mFields.m8[0]);
+    aResult.mLength = aPrefix.mLength;
+}
+
+static void ConvertToOpenThreadConfig(const OnMeshPrefix &aPrefix, otBorderRouterConfig &aResult)
+{
+    memset(&aResult, 0, sizeof(aResult));
+    ConvertToOpenThreadPrefix(aPrefix.mPrefix, aResult.mPrefix);
+    aResult.mPreference   = aPrefix.mPreference;
+    aResult.mPreferred    = aPrefix.mPreferred;
+    aResult.mSlaac        = aPrefix.mSlaac;
+    aResult.mDhcp         = aPrefix.mDhcp;
+    aResult.mConfigure    = aPrefix.mConfigure;
+    aResult.mDefaultRoute = aPrefix.mDefaultRoute;
+    aResult.mOnMesh       = aPrefix.mOnMesh;
+    aResult.mStable       = aPrefix.mStable;
+}
+
+static void ConvertToOpenThreadConfig(const ExternalRoute &aRoute, otExternalRouteConfig &aResult)
+{
+    memset(&aResult, 0, sizeof(aResult));
+    ConvertToOpenThreadPrefix(aRoute.mPrefix, aResult.mPrefix);
+    aResult.mPreference = aRoute.mPreference;
+    aResult.mStable     = aRoute.mStable;
+}
+
+static ChildInfo ConvertChildInfo(const otChildInfo &aChildInfo)
+{
+    ChildInfo info;
+
+    info.mExtAddress         = ConvertOpenThreadUint64(aChildInfo.mExtAddress.m8);
+    info.mTimeout            = aChildInfo.mTimeout;
+    info.mAge                = aChildInfo.mAge;
+    info.mRloc16             = aChildInfo.mRloc16;
+    info.mChildId            = aChildInfo.mChildId;
+    info.mNetworkDataVersion = aChildInfo.mNetworkDataVersion;
+    info.mLinkQualityIn      = aChildInfo.mLinkQualityIn;
+    info.mAverageRssi        = aChildInfo.mAverageRssi;
+    info.mLastRssi           = aChildInfo.mLastRssi;
+    info.mFrameErrorRate     = aChildInfo.mFrameErrorRate;
+    info.mMessageErrorRate   = aChildInfo.mMessageErrorRate;
+    info.mRxOnWhenIdle       = aChildInfo.mRxOnWhenIdle;
+    info.mFullThreadDevice   = aChildInfo.mFullThreadDevice;
+    info.mFullNetworkData    = aChildInfo.mFullNetworkData;
+    info.mIsStateRestoring   = aChildInfo.mIsStateRestoring;
+
+    return info;
+}
+
+static NeighborInfo ConvertNeighborInfo(const otNeighborInfo &aNeighborInfo)
+{
+    NeighborInfo info;
+
+    info.mExtAddress       = ConvertOpenThreadUint64(aNeighborInfo.mExtAddress.m8);
+    info.mAge              = aNeighborInfo.mAge;
+    info.mRloc16           = aNeighborInfo.mRloc16;
+    info.mLinkFrameCounter = aNeighborInfo.mLinkFrameCounter;
+    info.mMleFrameCounter  = aNeighborInfo.mMleFrameCounter;
+    info.mLinkQualityIn    = aNeighborInfo.mLinkQualityIn;
+    info.mAverageRssi      = aNeighborInfo.mAverageRssi;
+    info.mLastRssi         = aNeighborInfo.mLastRssi;
+    info.mFrameErrorRate   = aNeighborInfo.mFrameErrorRate;
+    info.mMessageErrorRate = aNeighborInfo.mMessageErrorRate;
+    info.mRxOnWhenIdle     = aNeighborInfo.mRxOnWhenIdle;
+    info.mFullThreadDevice = aNeighborInfo.mFullThreadDevice;
+    info.mFullNetworkData  = aNeighborInfo.mFullNetworkData;
+    info.mIsChild          = aNeighborInfo.mIsChild;
+
+    return info;
+}
+
+static ActiveScanResult ConvertScanResult(const otActiveScanResult &aResult)
+{
+    ActiveScanResult result;
+
+    result.mExtAddress    = ConvertOpenThreadUint64(aResult.mExtAddress.m8);
+    result.mExtendedPanId = ConvertOpenThreadUint64(aResult.mExtendedPanId.m8);
+    result.mNetworkName   = aResult.mNetworkName.m8;
+    result.mSteeringData =
+        std::vector<uint8_t>(aResult.mSteeringData.m8, aResult.mSteeringData.m8 + aResult.mSteeringData.mLength);
+    result.mPanId         = aResult.mPanId;
+    result.mJoinerUdpPort = aResult.mJoinerUdpPort;
+    result.mChannel       = aResult.mChannel;
+    result.mRssi          = aResult.mRssi;
+    result.mLqi           = aResult.mLqi;
+    result.mVersion       = aResult.mVersion;
+    result.mIsNative      = aResult.mIsNative;
+    result.mIsJoinable    = aResult.mIsJoinable;
+
+    return result;
+}
+
+// The neighbor table entry of a child, the child information carries no frame counters.
+static NeighborInfo ConvertChildToNeighborInfo(const otChildInfo &aChildInfo)
+{
+    NeighborInfo info;
+
+    info.mExtAddress       = ConvertOpenThreadUint64(aChildInfo.mExtAddress.m8);
+    info.mAge              = aChildInfo.mAge;
+    info.mRloc16           = aChildInfo.mRloc16;
+    info.mLinkFrameCounter = 0;
+    info.mMleFrameCounter  = 0;
+    info.mLinkQualityIn    = aChildInfo.mLinkQualityIn;
+    info.mAverageRssi      = aChildInfo.mAverageRssi;
+    info.mLastRssi         = aChildInfo.mLastRssi;
+    info.mFrameErrorRate   = aChildInfo.mFrameErrorRate;
+    info.mMessageErrorRate = aChildInfo.mMessageErrorRate;
+    info.mRxOnWhenIdle     = aChildInfo.mRxOnWhenIdle;
+    info.mFullThreadDevice = aChildInfo.mFullThreadDevice;
+    info.mFullNetworkData  = aChildInfo.mFullNetworkData;
+    info.mIsChild          = true;
+
+    return info;
+}
+
 DBusThreadObject::DBusThreadObject(DBusConnection *                 aConnection,
                                    const std::string &              aInterfaceName,
                                    otbr::Ncp::ControllerOpenThread *aNcp)
     : DBusObject(aConnection, OTBR_DBUS_OBJECT_PREFIX + aInterfaceName)
     , mNcp(aNcp)
+    , mChildTableSequence(0)
+    , mNeighborTableSequence(0)
 {
 }
 
 otbrError DBusThreadObject::Init(void)
 {
-    otbrError error        = DBusObject::Init();
-    auto      threadHelper = mNcp->GetThreadHelper();
+    otbrError      error        = DBusObject::Init();
+    auto           threadHelper = mNcp->GetThreadHelper();
+    otChangedFlags flags        = OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED | OT_CHANGED_THREAD_ROLE;
+
+    for (const SignaledProperty &property : kSignaledProperties)
+    {
+        flags |= property.mFlags;
+    }
 
     threadHelper->AddDeviceRoleHandler(std::bind(&DBusThreadObject::DeviceRoleHandler, this, _1));
+    threadHelper->AddJoinerEventHandler(std::bind(&DBusThreadObject::JoinerEventHandler, this, _1, _2, _3));
     mNcp->RegisterResetHandler(std::bind(&DBusThreadObject::NcpResetHandler, this));
+    mNcp->RegisterSoftResetHandler(std::bind(&DBusThreadObject::NcpSoftResetHandler, this));
+    mNcp->RegisterStateChangedHandler(flags, std::bind(&DBusThreadObject::StateChangedHandler, this, _1));
+    mNcp->RegisterNeighborTableHandler(std::bind(&DBusThreadObject::NeighborTableHandler, this, _1, _2));
+
+    SetTimerPoster([this](std::chrono::steady_clock::time_point aTimePoint, TimerWheel::Task aTask) {
+        return mNcp->PostTimerTask(aTimePoint, std::move(aTask));
+    });
+    // Bursts of role changes, e.g. while attaching, wake each client once.
+    SetPropertiesChangedWindow(std::chrono::milliseconds(InstanceParams::Get().GetDBusSignalWindow()));
 
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_METHOD,
                    std::bind(&DBusThreadObject::ScanHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_STREAM_SCAN_METHOD,
+                   std::bind(&DBusThreadObject::StreamScanHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ENERGY_SCAN_METHOD,
+                   std::bind(&DBusThreadObject::EnergyScanHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_STREAM_ENERGY_SCAN_METHOD,
+                   std::bind(&DBusThreadObject::StreamEnergyScanHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SURVEY_CHANNELS_METHOD,
+                   std::bind(&DBusThreadObject::SurveyChannelsHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ATTACH_METHOD,
                    std::bind(&DBusThreadObject::AttachHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ATTACH_DATASET_METHOD,
+                   std::bind(&DBusThreadObject::AttachDatasetHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_FACTORY_RESET_METHOD,
                    std::bind(&DBusThreadObject::FactoryResetHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_RESET_METHOD,
                    std::bind(&DBusThreadObject::ResetHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_RELOAD_CONFIG_METHOD,
+                   std::bind(&DBusThreadObject::ReloadConfigHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_CHURN_EVENTS_METHOD,
+                   std::bind(&DBusThreadObject::GetChurnEventsHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_JOINER_START_METHOD,
                    std::bind(&DBusThreadObject::JoinerStartHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_JOINER_STOP_METHOD,
                    std::bind(&DBusThreadObject::JoinerStopHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ADD_JOINERS_METHOD,
+                   std::bind(&DBusThreadObject::AddJoinersHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PERMIT_UNSECURE_JOIN_METHOD,
                    std::bind(&DBusThreadObject::PermitUnsecureJoinHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PERMIT_UNSECURE_JOIN_PORTS_METHOD,
+                   std::bind(&DBusThreadObject::PermitUnsecureJoinPortsHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ADD_ON_MESH_PREFIX_METHOD,
                    std::bind(&DBusThreadObject::AddOnMeshPrefixHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_REMOVE_ON_MESH_PREFIX_METHOD,
@@ -129,6 +340,10 @@ otbrError DBusThreadObject::Init(void)
                    std::bind(&DBusThreadObject::AddExternalRouteHandler, this, _1));
     RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_REMOVE_EXTERNAL_ROUTE_METHOD,
                    std::bind(&DBusThreadObject::RemoveExternalRouteHandler, this, _1));
+    RegisterMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_UPDATE_NETWORK_DATA_METHOD,
+                   std::bind(&DBusThreadObject::UpdateNetworkDataHandler, this, _1));
+    RegisterGetPropertiesMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_PROPERTIES_METHOD);
+    RegisterExportPropertiesMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_EXPORT_PROPERTIES_METHOD);
 
     RegisterMethod(DBUS_INTERFACE_INTROSPECTABLE, DBUS_INTROSPECT_METHOD,
                    std::bind(&DBusThreadObject::IntrospectHandler, this, _1));
@@ -144,6 +359,8 @@ otbrError DBusThreadObject::Init(void)
     RegisterSetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RADIO_REGION,
                                std::bind(&DBusThreadObject::SetRadioRegionHandler, this, _1));
 
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX,
+                               std::bind(&DBusThreadObject::GetMeshLocalPrefixHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_LINK_MODE,
                                std::bind(&DBusThreadObject::GetLinkModeHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE,
@@ -189,6 +406,10 @@ otbrError DBusThreadObject::Init(void)
                                std::bind(&DBusThreadObject::GetChildTableHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY,
                                std::bind(&DBusThreadObject::GetNeighborTableHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHILD_TABLE_SEQUENCE,
+                               std::bind(&DBusThreadObject::GetChildTableSequenceHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_SEQUENCE,
+                               std::bind(&DBusThreadObject::GetNeighborTableSequenceHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_PARTITION_ID_PROEPRTY,
                                std::bind(&DBusThreadObject::GetPartitionIDHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_INSTANT_RSSI,
@@ -201,6 +422,25 @@ otbrError DBusThreadObject::Init(void)
                                std::bind(&DBusThreadObject::GetActiveDatasetTlvsHandler, this, _1));
     RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RADIO_REGION,
                                std::bind(&DBusThreadObject::GetRadioRegionHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MAINLOOP_STATS,
+                               std::bind(&DBusThreadObject::GetMainloopStatsHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_BACKBONE_ROUTER_COUNTERS,
+                               std::bind(&DBusThreadObject::GetBackboneRouterCountersHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RCP_LINK_STATS,
+                               std::bind(&DBusThreadObject::GetRcpLinkStatsHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_MEMORY_STATS,
+                               std::bind(&DBusThreadObject::GetMemoryStatsHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_METRICS,
+                               std::bind(&DBusThreadObject::GetMetricsHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_VERSION,
+                               std::bind(&DBusThreadObject::GetVersionHandler, this, _1));
+    RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_EUI64,
+                               std::bind(&DBusThreadObject::GetEui64Handler, this, _1));
+
+    for (const char *name : kCachedTableProperties)
+    {
+        SetPropertyReplyCached(OTBR_DBUS_THREAD_INTERFACE, name, kTableReplyMaxAge);
+    }
 
     return error;
 }
@@ -210,17 +450,88 @@ void DBusThreadObject::DeviceRoleHandler(otDeviceRole aDeviceRole)
     SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE, GetDeviceRoleName(aDeviceRole));
 }
 
+void DBusThreadObject::NcpSoftResetHandler(void)
+{
+    for (const char *name : kCachedTableProperties)
+    {
+        InvalidatePropertyReply(OTBR_DBUS_THREAD_INTERFACE, name);
+    }
+
+    // The tables are emptied without a signal, skip a sequence number so clients read them again.
+    ++mChildTableSequence;
+    ++mNeighborTableSequence;
+}
+
 void DBusThreadObject::NcpResetHandler(void)
 {
+    // The callbacks of the operations in progress are dropped with the old ThreadHelper.
+    CancelDeferredRequests(OT_ERROR_ABORT);
+
     mNcp->GetThreadHelper()->AddDeviceRoleHandler(std::bind(&DBusThreadObject::DeviceRoleHandler, this, _1));
+    mNcp->GetThreadHelper()->AddJoinerEventHandler(
+        std::bind(&DBusThreadObject::JoinerEventHandler, this, _1, _2, _3));
     SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE,
                           GetDeviceRoleName(OT_DEVICE_ROLE_DISABLED));
 }
 
+void DBusThreadObject::StateChangedHandler(otChangedFlags aFlags)
+{
+    // Children are listed in the neighbor table as well.
+    if (aFlags & (OT_CHANGED_THREAD_CHILD_ADDED | OT_CHANGED_THREAD_CHILD_REMOVED | OT_CHANGED_THREAD_ROLE))
+    {
+        InvalidatePropertyReply(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHILD_TABLE);
+        InvalidatePropertyReply(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY);
+    }
+
+    for (const SignaledProperty &property : kSignaledProperties)
+    {
+        if (aFlags & property.mFlags)
+        {
+            SignalPropertyChanged(OTBR_DBUS_THREAD_INTERFACE, property.mName);
+        }
+    }
+}
+
+void DBusThreadObject::NeighborTableHandler(otNeighborTableEvent aEvent, const otNeighborTableEntryInfo &aEntryInfo)
+{
+    NeighborInfo neighbor;
+    std::string  eventName;
+
+    switch (aEvent)
+    {
+    case OT_NEIGHBOR_TABLE_EVENT_CHILD_ADDED:
+    case OT_NEIGHBOR_TABLE_EVENT_CHILD_REMOVED:
+        eventName = (aEvent == OT_NEIGHBOR_TABLE_EVENT_CHILD_ADDED) ? OTBR_TABLE_EVENT_NAME_ADDED
+                                                                    : OTBR_TABLE_EVENT_NAME_REMOVED;
+        InvalidatePropertyReply(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHILD_TABLE);
+        Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_CHILD_TABLE_CHANGED_SIGNAL,
+               std::make_tuple(++mChildTableSequence, eventName, ConvertChildInfo(aEntryInfo.mInfo.mChild)));
+        neighbor = ConvertChildToNeighborInfo(aEntryInfo.mInfo.mChild);
+        break;
+    case OT_NEIGHBOR_TABLE_EVENT_ROUTER_ADDED:
+    case OT_NEIGHBOR_TABLE_EVENT_ROUTER_REMOVED:
+        eventName = (aEvent == OT_NEIGHBOR_TABLE_EVENT_ROUTER_ADDED) ? OTBR_TABLE_EVENT_NAME_ADDED
+                                                                     : OTBR_TABLE_EVENT_NAME_REMOVED;
+        neighbor  = ConvertNeighborInfo(aEntryInfo.mInfo.mRouter);
+        break;
+    default:
+        ExitNow();
+    }
+
+    InvalidatePropertyReply(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY);
+    Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_NEIGHBOR_TABLE_CHANGED_SIGNAL,
+           std::make_tuple(++mNeighborTableSequence, eventName, neighbor));
+
+exit:
+    return;
+}
+
 void DBusThreadObject::ScanHandler(DBusRequest &aRequest)
 {
     auto threadHelper = mNcp->GetThreadHelper();
-    threadHelper->Scan(std::bind(&DBusThreadObject::ReplyScanResult, this, aRequest, _1, _2));
+
+    threadHelper->Scan(std::bind(&DBusThreadObject::ReplyScanResult, this, DeferRequest(aRequest, kScanTimeout), _1,
+                                 _2));
 }
 
 void DBusThreadObject::ReplyScanResult(DBusRequest &                          aRequest,
@@ -237,29 +548,146 @@ void DBusThreadObject::ReplyScanResult(DBusRequest &                          aR
     {
         for (const auto &r : aResult)
         {
-            ActiveScanResult result;
-
-            result.mExtAddress    = ConvertOpenThreadUint64(r.mExtAddress.m8);
-            result.mExtendedPanId = ConvertOpenThreadUint64(r.mExtendedPanId.m8);
-            result.mNetworkName   = r.mNetworkName.m8;
-            result.mSteeringData =
-                std::vector<uint8_t>(r.mSteeringData.m8, r.mSteeringData.m8 + r.mSteeringData.mLength);
-            result.mPanId         = r.mPanId;
-            result.mJoinerUdpPort = r.mJoinerUdpPort;
-            result.mChannel       = r.mChannel;
-            result.mRssi          = r.mRssi;
-            result.mLqi           = r.mLqi;
-            result.mVersion       = r.mVersion;
-            result.mIsNative      = r.mIsNative;
-            result.mIsJoinable    = r.mIsJoinable;
-
-            results.emplace_back(result);
+            results.emplace_back(ConvertScanResult(r));
         }
 
         aRequest.Reply(std::tie(results));
     }
 }
 
+void DBusThreadObject::StreamScanHandler(DBusRequest &aRequest)
+{
+    auto     threadHelper = mNcp->GetThreadHelper();
+    uint32_t count        = 0;
+
+    // The results are signaled as they arrive, the reply only tells whether the scan has started.
+    aRequest.ReplyOtResult(threadHelper->StreamScan([this, count](const otActiveScanResult *aResult) mutable {
+        if (aResult != nullptr)
+        {
+            count++;
+            Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_RESULT_SIGNAL,
+                   std::make_tuple(ConvertScanResult(*aResult)));
+        }
+        else
+        {
+            Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_SCAN_FINISHED_SIGNAL, std::make_tuple(count));
+        }
+    }));
+}
+
+void DBusThreadObject::EnergyScanHandler(DBusRequest &aRequest)
+{
+    auto     threadHelper = mNcp->GetThreadHelper();
+    uint32_t scanChannels;
+    uint16_t scanDuration;
+    auto     args = std::tie(scanChannels, scanDuration);
+
+    if (DBusMessageToTuple(*aRequest.GetMessage(), args) != OTBR_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(OT_ERROR_INVALID_ARGS);
+    }
+    else
+    {
+        threadHelper->EnergyScan(scanChannels, scanDuration,
+                                 std::bind(&DBusThreadObject::ReplyEnergyScanResult, this,
+                                           DeferRequest(aRequest, kScanTimeout), _1, _2));
+    }
+}
+
+void DBusThreadObject::StreamEnergyScanHandler(DBusRequest &aRequest)
+{
+    auto     threadHelper = mNcp->GetThreadHelper();
+    uint32_t scanChannels;
+    uint16_t scanDuration;
+    uint32_t count = 0;
+    auto     args  = std::tie(scanChannels, scanDuration);
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE,
+                 aRequest.ReplyOtResult(OT_ERROR_INVALID_ARGS));
+
+    aRequest.ReplyOtResult(threadHelper->StreamEnergyScan(
+        scanChannels, scanDuration, [this, count](const otEnergyScanResult *aResult) mutable {
+            if (aResult != nullptr)
+            {
+                count++;
+                Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ENERGY_SCAN_RESULT_SIGNAL,
+                       std::make_tuple(EnergyScanResult{aResult->mChannel, aResult->mMaxRssi}));
+            }
+            else
+            {
+                Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_ENERGY_SCAN_FINISHED_SIGNAL, std::make_tuple(count));
+            }
+        }));
+
+exit:
+    return;
+}
+
+void DBusThreadObject::ReplyEnergyScanResult(DBusRequest &                          aRequest,
+                                             otError                                aError,
+                                             const std::vector<otEnergyScanResult> &aResult)
+{
+    std::vector<EnergyScanResult> results;
+
+    if (aError != OT_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(aError);
+    }
+    else
+    {
+        for (const auto &r : aResult)
+        {
+            results.emplace_back(EnergyScanResult{r.mChannel, r.mMaxRssi});
+        }
+
+        aRequest.Reply(std::tie(results));
+    }
+}
+
+void DBusThreadObject::SurveyChannelsHandler(DBusRequest &aRequest)
+{
+    auto     threadHelper = mNcp->GetThreadHelper();
+    bool     energyScan;
+    uint16_t scanDuration;
+    auto     args = std::tie(energyScan, scanDuration);
+
+    if (DBusMessageToTuple(*aRequest.GetMessage(), args) != OTBR_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(OT_ERROR_INVALID_ARGS);
+    }
+    else
+    {
+        threadHelper->SurveyChannels(energyScan, scanDuration,
+                                     std::bind(&DBusThreadObject::ReplyChannelSurvey, this,
+                                               DeferRequest(aRequest, kScanTimeout), _1, _2));
+    }
+}
+
+void DBusThreadObject::ReplyChannelSurvey(DBusRequest &                             aRequest,
+                                          otError                                   aError,
+                                          const agent::ThreadHelper::ChannelSurvey &aSurvey)
+{
+    ChannelSurvey survey;
+
+    if (aError != OT_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(aError);
+    }
+    else
+    {
+        for (const auto &r : aSurvey.mChannels)
+        {
+            survey.mChannels.emplace_back(ChannelReport{r.mChannel, r.mOccupancy, r.mMaxRssi});
+        }
+        survey.mSampleCount         = aSurvey.mSampleCount;
+        survey.mCcaFailureRate      = aSurvey.mCcaFailureRate;
+        survey.mTimestamp           = aSurvey.mTimestamp;
+        survey.mEnergyScanTimestamp = aSurvey.mEnergyScanTimestamp;
+
+        aRequest.Reply(std::tie(survey));
+    }
+}
+
 void DBusThreadObject::AttachHandler(DBusRequest &aRequest)
 {
     auto                 threadHelper = mNcp->GetThreadHelper();
@@ -274,7 +702,9 @@ void DBusThreadObject::AttachHandler(DBusRequest &aRequest)
 
     if (IsDBusMessageEmpty(*aRequest.GetMessage()))
     {
-        threadHelper->Attach([aRequest](otError aError) mutable { aRequest.ReplyOtResult(aError); });
+        DBusRequest request = DeferRequest(aRequest, kAttachTimeout);
+
+        threadHelper->Attach([request](otError aError) mutable { request.ReplyOtResult(aError); });
     }
     else if (DBusMessageToTuple(*aRequest.GetMessage(), args) != OTBR_ERROR_NONE)
     {
@@ -282,8 +712,28 @@ void DBusThreadObject::AttachHandler(DBusRequest &aRequest)
     }
     else
     {
+        DBusRequest request = DeferRequest(aRequest, kAttachTimeout);
+
         threadHelper->Attach(name, panid, extPanId, masterKey, pskc, channelMask,
-                             [aRequest](otError aError) mutable { aRequest.ReplyOtResult(aError); });
+                             [request](otError aError) mutable { request.ReplyOtResult(aError); });
+    }
+}
+
+void DBusThreadObject::AttachDatasetHandler(DBusRequest &aRequest)
+{
+    auto                 threadHelper = mNcp->GetThreadHelper();
+    std::vector<uint8_t> datasetTlvs;
+    auto                 args = std::tie(datasetTlvs);
+
+    if (DBusMessageToTuple(*aRequest.GetMessage(), args) != OTBR_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(OT_ERROR_INVALID_ARGS);
+    }
+    else
+    {
+        DBusRequest request = DeferRequest(aRequest, kAttachTimeout);
+
+        threadHelper->AttachDataset(datasetTlvs, [request](otError aError) mutable { request.ReplyOtResult(aError); });
     }
 }
 
@@ -296,10 +746,43 @@ void DBusThreadObject::FactoryResetHandler(DBusRequest &aRequest)
 
 void DBusThreadObject::ResetHandler(DBusRequest &aRequest)
 {
-    mNcp->Reset();
+    mNcp->SoftReset();
     aRequest.ReplyOtResult(OT_ERROR_NONE);
 }
 
+void DBusThreadObject::ReloadConfigHandler(DBusRequest &aRequest)
+{
+    aRequest.ReplyOtResult(OtbrErrorToOtError(ConfigReloader::Get().Reload()));
+}
+
+void DBusThreadObject::GetChurnEventsHandler(DBusRequest &aRequest)
+{
+    const Ncp::ChurnLog &             churnLog = mNcp->GetChurnLog();
+    uint64_t                          since;
+    uint64_t                          until;
+    auto                              args = std::tie(since, until);
+    std::vector<Ncp::ChurnLog::Event> events;
+    std::vector<ChurnEvent>           churnEvents;
+    uint32_t                          dropped = churnLog.GetDroppedCount();
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE,
+                 aRequest.ReplyOtResult(OT_ERROR_INVALID_ARGS));
+
+    churnLog.GetEvents(since, until == 0 ? UINT64_MAX : until, events);
+
+    for (const Ncp::ChurnLog::Event &event : events)
+    {
+        churnEvents.emplace_back(ChurnEvent{Ncp::ChurnLog::TypeToString(event.mType), event.mTimestamp,
+                                            ConvertOpenThreadUint64(event.mExtAddress.m8), event.mRloc16,
+                                            event.mValue});
+    }
+
+    aRequest.Reply(std::tie(churnEvents, dropped));
+
+exit:
+    return;
+}
+
 void DBusThreadObject::JoinerStartHandler(DBusRequest &aRequest)
 {
     auto        threadHelper = mNcp->GetThreadHelper();
@@ -312,8 +795,10 @@ void DBusThreadObject::JoinerStartHandler(DBusRequest &aRequest)
     }
     else
     {
+        DBusRequest request = DeferRequest(aRequest, kJoinerStartTimeout);
+
         threadHelper->JoinerStart(pskd, provisionUrl, vendorName, vendorModel, vendorSwVersion, vendorData,
-                                  [aRequest](otError aError) mutable { aRequest.ReplyOtResult(aError); });
+                                  [request](otError aError) mutable { request.ReplyOtResult(aError); });
     }
 }
 
@@ -325,6 +810,86 @@ void DBusThreadObject::JoinerStopHandler(DBusRequest &aRequest)
     aRequest.ReplyOtResult(OT_ERROR_NONE);
 }
 
+void DBusThreadObject::AddJoinersHandler(DBusRequest &aRequest)
+{
+    auto                                          threadHelper = mNcp->GetThreadHelper();
+    std::vector<JoinerEntry>                      entries;
+    std::vector<agent::ThreadHelper::JoinerEntry> joiners;
+    auto                                          args = std::tie(entries);
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE,
+                 aRequest.ReplyOtResult(OT_ERROR_INVALID_ARGS));
+
+    for (const JoinerEntry &entry : entries)
+    {
+        agent::ThreadHelper::JoinerEntry joiner;
+
+        VerifyOrExit(entry.mDiscernerLength <= OT_JOINER_MAX_DISCERNER_LENGTH,
+                     aRequest.ReplyOtResult(OT_ERROR_INVALID_ARGS));
+        ConvertToOpenThreadUint64(entry.mEui64, joiner.mEui64.m8);
+        joiner.mDiscerner.mValue  = entry.mDiscerner;
+        joiner.mDiscerner.mLength = entry.mDiscernerLength;
+        joiner.mPskd              = entry.mPskd;
+        joiner.mTimeout           = entry.mTimeout;
+        joiners.emplace_back(std::move(joiner));
+    }
+
+    {
+        DBusRequest request = DeferRequest(aRequest, kAddJoinersTimeout);
+
+        threadHelper->AddJoiners(std::move(joiners),
+                                 [request](otError aError, const std::vector<otError> &aResults) mutable {
+                                     std::vector<uint8_t> results(aResults.begin(), aResults.end());
+
+                                     if (aError != OT_ERROR_NONE)
+                                     {
+                                         request.ReplyOtResult(aError);
+                                     }
+                                     else
+                                     {
+                                         request.Reply(std::tie(results));
+                                     }
+                                 });
+    }
+
+exit:
+    return;
+}
+
+void DBusThreadObject::JoinerEventHandler(otCommissionerJoinerEvent aEvent,
+                                          const otJoinerInfo *      aJoinerInfo,
+                                          const otExtAddress *      aJoinerId)
+{
+    static const char *const kEventNames[] = {"start", "connected", "finalize", "end", "removed"};
+    JoinerEvent              event         = {};
+
+    VerifyOrExit(static_cast<size_t>(aEvent) < sizeof(kEventNames) / sizeof(kEventNames[0]));
+    event.mEvent = kEventNames[aEvent];
+
+    if (aJoinerInfo != nullptr)
+    {
+        if (aJoinerInfo->mType == OT_JOINER_INFO_TYPE_EUI64)
+        {
+            event.mEui64 = ConvertOpenThreadUint64(aJoinerInfo->mSharedId.mEui64.m8);
+        }
+        else if (aJoinerInfo->mType == OT_JOINER_INFO_TYPE_DISCERNER)
+        {
+            event.mDiscerner       = aJoinerInfo->mSharedId.mDiscerner.mValue;
+            event.mDiscernerLength = aJoinerInfo->mSharedId.mDiscerner.mLength;
+        }
+    }
+
+    if (aJoinerId != nullptr)
+    {
+        event.mJoinerId = ConvertOpenThreadUint64(aJoinerId->m8);
+    }
+
+    Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_JOINER_EVENT_SIGNAL, std::make_tuple(event));
+
+exit:
+    return;
+}
+
 void DBusThreadObject::PermitUnsecureJoinHandler(DBusRequest &aRequest)
 {
 #ifdef OTBR_ENABLE_UNSECURE_JOIN
@@ -346,6 +911,27 @@ void DBusThreadObject::PermitUnsecureJoinHandler(DBusRequest &aRequest)
 #endif
 }
 
+void DBusThreadObject::PermitUnsecureJoinPortsHandler(DBusRequest &aRequest)
+{
+#ifdef OTBR_ENABLE_UNSECURE_JOIN
+    auto                  threadHelper = mNcp->GetThreadHelper();
+    std::vector<uint16_t> ports;
+    uint32_t              timeout;
+    auto                  args = std::tie(ports, timeout);
+
+    if (DBusMessageToTuple(*aRequest.GetMessage(), args) != OTBR_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(OT_ERROR_INVALID_ARGS);
+    }
+    else
+    {
+        aRequest.ReplyOtResult(threadHelper->PermitUnsecureJoin(ports, timeout));
+    }
+#else
+    aRequest.ReplyOtResult(OT_ERROR_NOT_IMPLEMENTED);
+#endif
+}
+
 void DBusThreadObject::AddOnMeshPrefixHandler(DBusRequest &aRequest)
 {
     auto                 threadHelper = mNcp->GetThreadHelper();
@@ -356,17 +942,7 @@ void DBusThreadObject::AddOnMeshPrefixHandler(DBusRequest &aRequest)
 
     VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
-    // size is guaranteed by parsing
-    std::copy(onMeshPrefix.mPrefix.mPrefix.begin(), onMeshPrefix.mPrefix.mPrefix.end(),
-              &config.mPrefix.mPrefix.mFields.m8[0]);
-    config.mPrefix.mLength = onMeshPrefix.mPrefix.mLength;
-    config.mPreference     = onMeshPrefix.mPreference;
-    config.mSlaac          = onMeshPrefix.mSlaac;
-    config.mDhcp           = onMeshPrefix.mDhcp;
-    config.mConfigure      = onMeshPrefix.mConfigure;
-    config.mDefaultRoute   = onMeshPrefix.mDefaultRoute;
-    config.mOnMesh         = onMeshPrefix.mOnMesh;
-    config.mStable         = onMeshPrefix.mStable;
+    ConvertToOpenThreadConfig(onMeshPrefix, config);
 
     SuccessOrExit(error = otBorderRouterAddOnMeshPrefix(threadHelper->GetInstance(), &config));
     SuccessOrExit(error = otBorderRouterRegister(threadHelper->GetInstance()));
@@ -384,9 +960,8 @@ void DBusThreadObject::RemoveOnMeshPrefixHandler(DBusRequest &aRequest)
     otIp6Prefix prefix;
 
     VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
-    // size is guaranteed by parsing
-    std::copy(onMeshPrefix.mPrefix.begin(), onMeshPrefix.mPrefix.end(), &prefix.mPrefix.mFields.m8[0]);
-    prefix.mLength = onMeshPrefix.mLength;
+
+    ConvertToOpenThreadPrefix(onMeshPrefix, prefix);
 
     SuccessOrExit(error = otBorderRouterRemoveOnMeshPrefix(threadHelper->GetInstance(), &prefix));
     SuccessOrExit(error = otBorderRouterRegister(threadHelper->GetInstance()));
@@ -402,15 +977,10 @@ void DBusThreadObject::AddExternalRouteHandler(DBusRequest &aRequest)
     auto                  args  = std::tie(route);
     otError               error = OT_ERROR_NONE;
     otExternalRouteConfig otRoute;
-    otIp6Prefix &         prefix = otRoute.mPrefix;
 
     VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
-    // size is guaranteed by parsing
-    std::copy(route.mPrefix.mPrefix.begin(), route.mPrefix.mPrefix.end(), &prefix.mPrefix.mFields.m8[0]);
-    prefix.mLength      = route.mPrefix.mLength;
-    otRoute.mPreference = route.mPreference;
-    otRoute.mStable     = route.mStable;
+    ConvertToOpenThreadConfig(route, otRoute);
 
     SuccessOrExit(error = otBorderRouterAddRoute(threadHelper->GetInstance(), &otRoute));
     if (route.mStable)
@@ -432,9 +1002,7 @@ void DBusThreadObject::RemoveExternalRouteHandler(DBusRequest &aRequest)
 
     VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
 
-    // size is guaranteed by parsing
-    std::copy(routePrefix.mPrefix.begin(), routePrefix.mPrefix.end(), &prefix.mPrefix.mFields.m8[0]);
-    prefix.mLength = routePrefix.mLength;
+    ConvertToOpenThreadPrefix(routePrefix, prefix);
 
     SuccessOrExit(error = otBorderRouterRemoveRoute(threadHelper->GetInstance(), &prefix));
     SuccessOrExit(error = otBorderRouterRegister(threadHelper->GetInstance()));
@@ -443,6 +1011,75 @@ exit:
     aRequest.ReplyOtResult(error);
 }
 
+void DBusThreadObject::UpdateNetworkDataHandler(DBusRequest &aRequest)
+{
+    otInstance *               instance = mNcp->GetThreadHelper()->GetInstance();
+    std::vector<OnMeshPrefix>  addedPrefixes;
+    std::vector<Ip6Prefix>     removedPrefixes;
+    std::vector<ExternalRoute> addedRoutes;
+    std::vector<Ip6Prefix>     removedRoutes;
+    auto                       args = std::tie(addedPrefixes, removedPrefixes, addedRoutes, removedRoutes);
+    std::vector<uint8_t>       results;
+    size_t                     index;
+    otError                    error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+    results.resize(addedPrefixes.size() + removedPrefixes.size() + addedRoutes.size() + removedRoutes.size());
+
+    // The results are in the order of the arguments, but the removals are done first so that a prefix or a route
+    // is replaced by removing and adding it in the same call.
+    index = addedPrefixes.size();
+    for (const Ip6Prefix &removedPrefix : removedPrefixes)
+    {
+        otIp6Prefix prefix;
+
+        ConvertToOpenThreadPrefix(removedPrefix, prefix);
+        results[index++] = otBorderRouterRemoveOnMeshPrefix(instance, &prefix);
+    }
+
+    index += addedRoutes.size();
+    for (const Ip6Prefix &removedRoute : removedRoutes)
+    {
+        otIp6Prefix prefix;
+
+        ConvertToOpenThreadPrefix(removedRoute, prefix);
+        results[index++] = otBorderRouterRemoveRoute(instance, &prefix);
+    }
+
+    index = 0;
+    for (const OnMeshPrefix &addedPrefix : addedPrefixes)
+    {
+        otBorderRouterConfig config;
+
+        ConvertToOpenThreadConfig(addedPrefix, config);
+        results[index++] = otBorderRouterAddOnMeshPrefix(instance, &config);
+    }
+
+    index += removedPrefixes.size();
+    for (const ExternalRoute &addedRoute : addedRoutes)
+    {
+        otExternalRouteConfig config;
+
+        ConvertToOpenThreadConfig(addedRoute, config);
+        results[index++] = otBorderRouterAddRoute(instance, &config);
+    }
+
+    // The local network data is registered with the leader once, for all the changes done.
+    if (std::find(results.begin(), results.end(), OT_ERROR_NONE) != results.end())
+    {
+        SuccessOrExit(error = otBorderRouterRegister(instance));
+    }
+
+    aRequest.Reply(std::tie(results));
+
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        aRequest.ReplyOtResult(error);
+    }
+}
+
 void DBusThreadObject::IntrospectHandler(DBusRequest &aRequest)
 {
     std::string xmlString(
@@ -519,6 +1156,20 @@ exit:
     return error;
 }
 
+otError DBusThreadObject::GetMeshLocalPrefixHandler(DBusMessageIter &aIter)
+{
+    auto                                      threadHelper = mNcp->GetThreadHelper();
+    const otMeshLocalPrefix *                 prefix       = otThreadGetMeshLocalPrefix(threadHelper->GetInstance());
+    std::array<uint8_t, OTBR_IP6_PREFIX_SIZE> data;
+    otError                                   error = OT_ERROR_NONE;
+
+    memcpy(&data.front(), prefix->m8, sizeof(prefix->m8));
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, data) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
 otError DBusThreadObject::GetDeviceRoleHandler(DBusMessageIter &aIter)
 {
     auto         threadHelper = mNcp->GetThreadHelper();
@@ -845,23 +1496,7 @@ otError DBusThreadObject::GetChildTableHandler(DBusMessageIter &aIter)
 
     while (otThreadGetChildInfoByIndex(threadHelper->GetInstance(), childIndex, &childInfo) == OT_ERROR_NONE)
     {
-        ChildInfo info;
-
-        info.mExtAddress         = ConvertOpenThreadUint64(childInfo.mExtAddress.m8);
-        info.mTimeout            = childInfo.mTimeout;
-        info.mAge                = childInfo.mAge;
-        info.mChildId            = childInfo.mChildId;
-        info.mNetworkDataVersion = childInfo.mNetworkDataVersion;
-        info.mLinkQualityIn      = childInfo.mLinkQualityIn;
-        info.mAverageRssi        = childInfo.mAverageRssi;
-        info.mLastRssi           = childInfo.mLastRssi;
-        info.mFrameErrorRate     = childInfo.mFrameErrorRate;
-        info.mMessageErrorRate   = childInfo.mMessageErrorRate;
-        info.mRxOnWhenIdle       = childInfo.mRxOnWhenIdle;
-        info.mFullThreadDevice   = childInfo.mFullThreadDevice;
-        info.mFullNetworkData    = childInfo.mFullNetworkData;
-        info.mIsStateRestoring   = childInfo.mIsStateRestoring;
-        childTable.push_back(info);
+        childTable.push_back(ConvertChildInfo(childInfo));
         childIndex++;
     }
 
@@ -881,23 +1516,7 @@ otError DBusThreadObject::GetNeighborTableHandler(DBusMessageIter &aIter)
 
     while (otThreadGetNextNeighborInfo(threadHelper->GetInstance(), &iter, &neighborInfo) == OT_ERROR_NONE)
     {
-        NeighborInfo info;
-
-        info.mExtAddress       = ConvertOpenThreadUint64(neighborInfo.mExtAddress.m8);
-        info.mAge              = neighborInfo.mAge;
-        info.mRloc16           = neighborInfo.mRloc16;
-        info.mLinkFrameCounter = neighborInfo.mLinkFrameCounter;
-        info.mMleFrameCounter  = neighborInfo.mMleFrameCounter;
-        info.mLinkQualityIn    = neighborInfo.mLinkQualityIn;
-        info.mAverageRssi      = neighborInfo.mAverageRssi;
-        info.mLastRssi         = neighborInfo.mLastRssi;
-        info.mFrameErrorRate   = neighborInfo.mFrameErrorRate;
-        info.mMessageErrorRate = neighborInfo.mMessageErrorRate;
-        info.mRxOnWhenIdle     = neighborInfo.mRxOnWhenIdle;
-        info.mFullThreadDevice = neighborInfo.mFullThreadDevice;
-        info.mFullNetworkData  = neighborInfo.mFullNetworkData;
-        info.mIsChild          = neighborInfo.mIsChild;
-        neighborTable.push_back(info);
+        neighborTable.push_back(ConvertNeighborInfo(neighborInfo));
     }
 
     VerifyOrExit(DBusMessageEncodeToVariant(&aIter, neighborTable) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
@@ -906,6 +1525,28 @@ exit:
     return error;
 }
 
+otError DBusThreadObject::GetChildTableSequenceHandler(DBusMessageIter &aIter)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, mChildTableSequence) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetNeighborTableSequenceHandler(DBusMessageIter &aIter)
+{
+    otError error = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, mNeighborTableSequence) == OTBR_ERROR_NONE,
+                 error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
 otError DBusThreadObject::GetPartitionIDHandler(DBusMessageIter &aIter)
 {
     auto     threadHelper = mNcp->GetThreadHelper();
@@ -981,7 +1622,8 @@ otError DBusThreadObject::SetActiveDatasetTlvsHandler(DBusMessageIter &aIter)
     otError                  error = OT_ERROR_NONE;
 
     VerifyOrExit(DBusMessageExtractFromVariant(&aIter, data) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
-    VerifyOrExit(data.size() <= sizeof(datasetTlvs.mTlvs));
+    VerifyOrExit(data.size() <= sizeof(datasetTlvs.mTlvs), error = OT_ERROR_INVALID_ARGS);
+    VerifyOrExit(TlvView(data.data(), data.size()).IsValid(), error = OT_ERROR_PARSE);
     std::copy(std::begin(data), std::end(data), std::begin(datasetTlvs.mTlvs));
     datasetTlvs.mLength = data.size();
     error               = otDatasetSetActiveTlvs(threadHelper->GetInstance(), &datasetTlvs);
@@ -1041,5 +1683,171 @@ exit:
     return error;
 }
 
+otError DBusThreadObject::GetMainloopStatsHandler(DBusMessageIter &aIter)
+{
+    otError                             error = OT_ERROR_NONE;
+    const MainloopStats &               stats = MainloopStats::Get();
+    std::vector<MainloopComponentStats> componentStats;
+
+    for (uint8_t i = 0; i < MainloopStats::kNumComponents; i++)
+    {
+        for (uint8_t j = 0; j < MainloopStats::kNumPhases; j++)
+        {
+            auto                            component = static_cast<MainloopStats::Component>(i);
+            auto                            phase     = static_cast<MainloopStats::Phase>(j);
+            const MainloopStats::Histogram &histogram = stats.GetHistogram(component, phase);
+            MainloopComponentStats          entry;
+
+            entry.mName       = std::string(MainloopStats::ComponentToString(component)) + "." +
+                                MainloopStats::PhaseToString(phase);
+            entry.mCount      = histogram.mCount;
+            entry.mTotalUs    = histogram.mTotalUs;
+            entry.mMaxUs      = histogram.mMaxUs;
+            entry.mStallCount = histogram.mStallCount;
+            entry.mHistogram.assign(histogram.mBuckets, histogram.mBuckets + MainloopStats::kNumBuckets);
+
+            componentStats.push_back(entry);
+        }
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, componentStats) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetBackboneRouterCountersHandler(DBusMessageIter &aIter)
+{
+    otError                  error   = OT_ERROR_NONE;
+    const Metrics &          metrics = Metrics::Get();
+    MainloopStats::Histogram latency = metrics.GetHistogram(Metrics::kHistogramNdProxyProcess);
+    BackboneRouterCounters   counters;
+
+    counters.mNsMulticast    = metrics.GetCounter(Metrics::kCounterNdProxyNsMulticast);
+    counters.mNsUnicast      = metrics.GetCounter(Metrics::kCounterNdProxyNsUnicast);
+    counters.mNsMatched      = metrics.GetCounter(Metrics::kCounterNdProxyNsMatched);
+    counters.mNaSent         = metrics.GetCounter(Metrics::kCounterNdProxyNaSent);
+    counters.mNaFailed       = metrics.GetCounter(Metrics::kCounterNdProxyNaFailed);
+    counters.mAccepted       = metrics.GetCounter(Metrics::kCounterNdProxyAccepted);
+    counters.mDropped        = metrics.GetCounter(Metrics::kCounterNdProxyDropped);
+    counters.mSocketErrors   = metrics.GetCounter(Metrics::kCounterNdProxyErrors);
+    counters.mDuaAdded       = metrics.GetCounter(Metrics::kCounterDuaAdded);
+    counters.mDuaRemoved     = metrics.GetCounter(Metrics::kCounterDuaRemoved);
+    counters.mProcessCount   = latency.mCount;
+    counters.mProcessTotalUs = latency.mTotalUs;
+    counters.mProcessMaxUs   = latency.mMaxUs;
+    counters.mProcessHistogram.assign(latency.mBuckets, latency.mBuckets + MainloopStats::kNumBuckets);
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, counters) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetRcpLinkStatsHandler(DBusMessageIter &aIter)
+{
+    otError                         error    = OT_ERROR_NONE;
+    const Ncp::RcpStats::Counters & counters = mNcp->GetRcpStats().GetCounters();
+    const MainloopStats::Histogram &latency  = mNcp->GetRcpStats().GetLatency();
+    RcpLinkStats                    stats;
+
+    stats.mTxFrames        = counters.mTxFrames;
+    stats.mRxFrames        = counters.mRxFrames;
+    stats.mTxFrameRate     = counters.mTxFrameRate;
+    stats.mRxFrameRate     = counters.mRxFrameRate;
+    stats.mTxRetries       = counters.mTxRetries;
+    stats.mTxBytes         = counters.mTxBytes;
+    stats.mRxBytes         = counters.mRxBytes;
+    stats.mTxByteRate      = counters.mTxByteRate;
+    stats.mRxByteRate      = counters.mRxByteRate;
+    stats.mUartOverruns    = counters.mUartOverruns;
+    stats.mUartFrameErrors = counters.mUartFrameErrors;
+    stats.mTimeouts        = counters.mTimeouts;
+    stats.mLatencyCount    = latency.mCount;
+    stats.mLatencyTotalUs  = latency.mTotalUs;
+    stats.mLatencyMaxUs    = latency.mMaxUs;
+    stats.mLatencyHistogram.assign(latency.mBuckets, latency.mBuckets + MainloopStats::kNumBuckets);
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, stats) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetMemoryStatsHandler(DBusMessageIter &aIter)
+{
+    otError                  error = OT_ERROR_NONE;
+    std::vector<MemoryUsage> usages;
+
+    VerifyOrExit(MemoryStats::IsEnabled(), error = OT_ERROR_NOT_IMPLEMENTED);
+
+    for (uint8_t i = 0; i < MemoryStats::kNumSubsystems; i++)
+    {
+        auto               subsystem = static_cast<MemoryStats::Subsystem>(i);
+        MemoryStats::Usage usage     = MemoryStats::GetUsage(subsystem);
+        MemoryUsage        entry;
+
+        entry.mSubsystem    = MemoryStats::SubsystemToString(subsystem);
+        entry.mCurrentBytes = usage.mCurrentBytes;
+        entry.mPeakBytes    = usage.mPeakBytes;
+        entry.mAllocations  = usage.mAllocations;
+
+        usages.push_back(entry);
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, usages) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetMetricsHandler(DBusMessageIter &aIter)
+{
+    otError                      error = OT_ERROR_NONE;
+    Metrics::Snapshot            snapshot;
+    std::vector<Metrics::Sample> samples;
+    std::vector<MetricSample>    metrics;
+
+    Metrics::Get().GetSnapshot(snapshot);
+    Metrics::GetSamples(snapshot, samples);
+
+    for (const Metrics::Sample &sample : samples)
+    {
+        metrics.push_back({sample.mName, sample.mLabels != nullptr ? sample.mLabels : "", sample.mValue});
+    }
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, metrics) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetVersionHandler(DBusMessageIter &aIter)
+{
+    std::string version = otGetVersionString();
+    otError     error   = OT_ERROR_NONE;
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, version) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+otError DBusThreadObject::GetEui64Handler(DBusMessageIter &aIter)
+{
+    auto         threadHelper = mNcp->GetThreadHelper();
+    otExtAddress extAddress;
+    uint64_t     eui64;
+    otError      error = OT_ERROR_NONE;
+
+    otLinkGetFactoryAssignedIeeeEui64(threadHelper->GetInstance(), &extAddress);
+    eui64 = ConvertOpenThreadUint64(extAddress.m8);
+
+    VerifyOrExit(DBusMessageEncodeToVariant(&aIter, eui64) == OTBR_ERROR_NONE, error = OT_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
 } // namespace DBus
 } // namespace otbr
@@ -83,19 +83,35 @@ public:
 private:
     void DeviceRoleHandler(otDeviceRole aDeviceRole);
     void NcpResetHandler(void);
+    void NcpSoftResetHandler(void);
+    void StateChangedHandler(otChangedFlags aFlags);
+    void NeighborTableHandler(otNeighborTableEvent aEvent, const otNeighborTableEntryInfo &aEntryInfo);
+    void JoinerEventHandler(otCommissionerJoinerEvent aEvent,
+                            const otJoinerInfo *      aJoinerInfo,
+                            const otExtAddress *      aJoinerId);
 
     void ScanHandler(DBusRequest &aRequest);
+    void StreamScanHandler(DBusRequest &aRequest);
+    void EnergyScanHandler(DBusRequest &aRequest);
+    void StreamEnergyScanHandler(DBusRequest &aRequest);
+    void SurveyChannelsHandler(DBusRequest &aRequest);
     void AttachHandler(DBusRequest &aRequest);
+    void AttachDatasetHandler(DBusRequest &aRequest);
     void LeaveHandler(DBusRequest &aRequest);
     void FactoryResetHandler(DBusRequest &aRequest);
     void ResetHandler(DBusRequest &aRequest);
+    void ReloadConfigHandler(DBusRequest &aRequest);
+    void GetChurnEventsHandler(DBusRequest &aRequest);
     void JoinerStartHandler(DBusRequest &aRequest);
     void JoinerStopHandler(DBusRequest &aRequest);
+    void AddJoinersHandler(DBusRequest &aRequest);
     void PermitUnsecureJoinHandler(DBusRequest &aRequest);
+    void PermitUnsecureJoinPortsHandler(DBusRequest &aRequest);
     void AddOnMeshPrefixHandler(DBusRequest &aRequest);
     void RemoveOnMeshPrefixHandler(DBusRequest &aRequest);
     void AddExternalRouteHandler(DBusRequest &aRequest);
     void RemoveExternalRouteHandler(DBusRequest &aRequest);
+    void UpdateNetworkDataHandler(DBusRequest &aRequest);
 
     void IntrospectHandler(DBusRequest &aRequest);
 
@@ -105,6 +121,7 @@ private:
     otError SetActiveDatasetTlvsHandler(DBusMessageIter &aIter);
     otError SetRadioRegionHandler(DBusMessageIter &aIter);
 
+    otError GetMeshLocalPrefixHandler(DBusMessageIter &aIter);
     otError GetLinkModeHandler(DBusMessageIter &aIter);
     otError GetDeviceRoleHandler(DBusMessageIter &aIter);
     otError GetNetworkNameHandler(DBusMessageIter &aIter);
@@ -127,16 +144,31 @@ private:
     otError GetChannelMonitorAllChannelQualities(DBusMessageIter &aIter);
     otError GetChildTableHandler(DBusMessageIter &aIter);
     otError GetNeighborTableHandler(DBusMessageIter &aIter);
+    otError GetChildTableSequenceHandler(DBusMessageIter &aIter);
+    otError GetNeighborTableSequenceHandler(DBusMessageIter &aIter);
     otError GetPartitionIDHandler(DBusMessageIter &aIter);
     otError GetInstantRssiHandler(DBusMessageIter &aIter);
     otError GetRadioTxPowerHandler(DBusMessageIter &aIter);
     otError GetExternalRoutesHandler(DBusMessageIter &aIter);
     otError GetActiveDatasetTlvsHandler(DBusMessageIter &aIter);
     otError GetRadioRegionHandler(DBusMessageIter &aIter);
+    otError GetMainloopStatsHandler(DBusMessageIter &aIter);
+    otError GetBackboneRouterCountersHandler(DBusMessageIter &aIter);
+    otError GetRcpLinkStatsHandler(DBusMessageIter &aIter);
+    otError GetMemoryStatsHandler(DBusMessageIter &aIter);
+    otError GetMetricsHandler(DBusMessageIter &aIter);
+    otError GetVersionHandler(DBusMessageIter &aIter);
+    otError GetEui64Handler(DBusMessageIter &aIter);
 
     void ReplyScanResult(DBusRequest &aRequest, otError aError, const std::vector<otActiveScanResult> &aResult);
+    void ReplyEnergyScanResult(DBusRequest &aRequest, otError aError, const std::vector<otEnergyScanResult> &aResult);
+    void ReplyChannelSurvey(DBusRequest &aRequest, otError aError, const agent::ThreadHelper::ChannelSurvey &aSurvey);
 
     otbr::Ncp::ControllerOpenThread *mNcp;
+
+    // The sequence numbers of the last table change signals
+    uint32_t mChildTableSequence;
+    uint32_t mNeighborTableSequence;
 };
 
 } // namespace DBus
@@ -0,0 +1,193 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the cache of discovered DNS-SD services and hosts.
+ */
+
+#include "mdns/discovery_cache.hpp"
+
+#include <iterator>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+void DiscoveryCache::UpdateInstance(const std::string &                      aType,
+                                    const Publisher::DiscoveredInstanceInfo &aInstanceInfo,
+                                    Clock::time_point                        aNow)
+{
+    Instances &instances = mServices[aType];
+
+    if (aInstanceInfo.mRemoved || aInstanceInfo.mTtl == 0)
+    {
+        instances.erase(aInstanceInfo.mName);
+    }
+    else
+    {
+        InstanceEntry &entry = instances[aInstanceInfo.mName];
+
+        entry.mInfo       = aInstanceInfo;
+        entry.mExpireTime = aNow + std::chrono::seconds(aInstanceInfo.mTtl);
+    }
+
+    if (instances.empty())
+    {
+        mServices.erase(aType);
+    }
+}
+
+void DiscoveryCache::UpdateHost(const std::string &                  aHostName,
+                                const Publisher::DiscoveredHostInfo &aHostInfo,
+                                Clock::time_point                    aNow)
+{
+    if (aHostInfo.mTtl == 0 || aHostInfo.mAddresses.empty())
+    {
+        mHosts.erase(aHostName);
+    }
+    else
+    {
+        HostEntry &entry = mHosts[aHostName];
+
+        entry.mInfo       = aHostInfo;
+        entry.mExpireTime = aNow + std::chrono::seconds(aHostInfo.mTtl);
+    }
+}
+
+size_t DiscoveryCache::FindInstances(const std::string &                             aType,
+                                     const std::string &                             aInstanceName,
+                                     Clock::time_point                               aNow,
+                                     std::vector<Publisher::DiscoveredInstanceInfo> &aInstances)
+{
+    Services::iterator service = mServices.find(aType);
+    size_t             count   = 0;
+
+    VerifyOrExit(service != mServices.end());
+
+    for (Instances::iterator it = service->second.begin(); it != service->second.end();)
+    {
+        if (it->second.mExpireTime <= aNow)
+        {
+            it = service->second.erase(it);
+            continue;
+        }
+
+        if (aInstanceName.empty() || it->first == aInstanceName)
+        {
+            aInstances.push_back(it->second.mInfo);
+            aInstances.back().mTtl = GetRemainingTtl(it->second.mExpireTime, aNow);
+            ++count;
+        }
+
+        ++it;
+    }
+
+    if (service->second.empty())
+    {
+        mServices.erase(service);
+    }
+
+exit:
+    return count;
+}
+
+bool DiscoveryCache::FindHost(const std::string &            aHostName,
+                              Clock::time_point              aNow,
+                              Publisher::DiscoveredHostInfo &aHostInfo)
+{
+    Hosts::iterator it    = mHosts.find(aHostName);
+    bool            found = false;
+
+    VerifyOrExit(it != mHosts.end());
+
+    if (it->second.mExpireTime <= aNow)
+    {
+        mHosts.erase(it);
+        ExitNow();
+    }
+
+    aHostInfo      = it->second.mInfo;
+    aHostInfo.mTtl = GetRemainingTtl(it->second.mExpireTime, aNow);
+    found          = true;
+
+exit:
+    return found;
+}
+
+void DiscoveryCache::Expire(Clock::time_point aNow)
+{
+    for (Services::iterator service = mServices.begin(); service != mServices.end();)
+    {
+        for (Instances::iterator it = service->second.begin(); it != service->second.end();)
+        {
+            it = (it->second.mExpireTime <= aNow) ? service->second.erase(it) : std::next(it);
+        }
+
+        service = service->second.empty() ? mServices.erase(service) : std::next(service);
+    }
+
+    for (Hosts::iterator it = mHosts.begin(); it != mHosts.end();)
+    {
+        it = (it->second.mExpireTime <= aNow) ? mHosts.erase(it) : std::next(it);
+    }
+}
+
+void DiscoveryCache::Clear(void)
+{
+    mServices.clear();
+    mHosts.clear();
+}
+
+size_t DiscoveryCache::GetInstanceCount(void) const
+{
+    size_t count = 0;
+
+    for (const auto &service : mServices)
+    {
+        count += service.second.size();
+    }
+
+    return count;
+}
+
+uint32_t DiscoveryCache::GetRemainingTtl(Clock::time_point aExpireTime, Clock::time_point aNow)
+{
+    Clock::duration remaining = aExpireTime - aNow;
+
+    // Round up, an entry which has not expired yet is never reported with a zero TTL.
+    remaining += std::chrono::seconds(1) - Clock::duration(1);
+
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::seconds>(remaining).count());
+}
+
+} // namespace Mdns
+
+} // namespace otbr
@@ -0,0 +1,187 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definition for the cache of discovered DNS-SD services and hosts.
+ */
+
+#ifndef OTBR_AGENT_MDNS_DISCOVERY_CACHE_HPP_
+#define OTBR_AGENT_MDNS_DISCOVERY_CACHE_HPP_
+
+#include <chrono>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "mdns/mdns.hpp"
+
+namespace otbr {
+
+namespace Mdns {
+
+/**
+ * @addtogroup border-router-mdns
+ *
+ * @{
+ */
+
+/**
+ * This class implements a cache of discovered service instances and hosts.
+ *
+ * Entries expire after their TTL. Expired entries are dropped lazily when they are looked up, or by `Expire()`.
+ * The TTL reported by lookups is the remaining TTL, so that answers served from the cache never outlive the
+ * discovered records.
+ *
+ */
+class DiscoveryCache
+{
+public:
+    typedef std::chrono::steady_clock Clock;
+
+    /**
+     * This method adds, updates or removes a discovered service instance.
+     *
+     * The instance is removed when it is marked as removed or its TTL is zero.
+     *
+     * @param[in]  aType          The service type, e.g. "_meshcop._udp".
+     * @param[in]  aInstanceInfo  The service instance information.
+     * @param[in]  aNow           The current time.
+     *
+     */
+    void UpdateInstance(const std::string &                      aType,
+                        const Publisher::DiscoveredInstanceInfo &aInstanceInfo,
+                        Clock::time_point                        aNow);
+
+    /**
+     * This method adds, updates or removes a discovered host.
+     *
+     * The host is removed when its TTL is zero or it has no address.
+     *
+     * @param[in]  aHostName  The host name, without the domain.
+     * @param[in]  aHostInfo  The host information.
+     * @param[in]  aNow       The current time.
+     *
+     */
+    void UpdateHost(const std::string &                  aHostName,
+                    const Publisher::DiscoveredHostInfo &aHostInfo,
+                    Clock::time_point                    aNow);
+
+    /**
+     * This method looks up service instances.
+     *
+     * @param[in]   aType           The service type.
+     * @param[in]   aInstanceName   The service instance name, or empty for all instances of @p aType.
+     * @param[in]   aNow            The current time.
+     * @param[out]  aInstances      The found instances, with their remaining TTL.
+     *
+     * @returns The number of found instances.
+     *
+     */
+    size_t FindInstances(const std::string &                             aType,
+                         const std::string &                             aInstanceName,
+                         Clock::time_point                               aNow,
+                         std::vector<Publisher::DiscoveredInstanceInfo> &aInstances);
+
+    /**
+     * This method looks up a host.
+     *
+     * @param[in]   aHostName   The host name, without the domain.
+     * @param[in]   aNow        The current time.
+     * @param[out]  aHostInfo   The found host, with its remaining TTL.
+     *
+     * @retval  true    The host is found.
+     * @retval  false   The host is not cached or has expired.
+     *
+     */
+    bool FindHost(const std::string &aHostName, Clock::time_point aNow, Publisher::DiscoveredHostInfo &aHostInfo);
+
+    /**
+     * This method drops all expired entries.
+     *
+     * @param[in]  aNow  The current time.
+     *
+     */
+    void Expire(Clock::time_point aNow);
+
+    /**
+     * This method drops all entries.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method returns the number of cached service instances, including expired ones not dropped yet.
+     *
+     * @returns The number of cached service instances.
+     *
+     */
+    size_t GetInstanceCount(void) const;
+
+    /**
+     * This method returns the number of cached hosts, including expired ones not dropped yet.
+     *
+     * @returns The number of cached hosts.
+     *
+     */
+    size_t GetHostCount(void) const { return mHosts.size(); }
+
+private:
+    struct InstanceEntry
+    {
+        Publisher::DiscoveredInstanceInfo mInfo;
+        Clock::time_point                 mExpireTime;
+    };
+
+    struct HostEntry
+    {
+        Publisher::DiscoveredHostInfo mInfo;
+        Clock::time_point             mExpireTime;
+    };
+
+    // Instances of a service type are keyed by the instance name.
+    typedef std::map<std::string, InstanceEntry>       Instances;
+    typedef std::unordered_map<std::string, Instances> Services;
+    typedef std::unordered_map<std::string, HostEntry> Hosts;
+
+    static uint32_t GetRemainingTtl(Clock::time_point aExpireTime, Clock::time_point aNow);
+
+    Services mServices;
+    Hosts    mHosts;
+};
+
+/**
+ * @}
+ */
+
+} // namespace Mdns
+
+} // namespace otbr
+
+#endif // OTBR_AGENT_MDNS_DISCOVERY_CACHE_HPP_
@@ -33,7 +33,14 @@
 
 #include "mdns/mdns.hpp"
 
+#include <algorithm>
+
+#include <string.h>
+
 #include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/metrics.hpp"
+#include "common/usdt.hpp"
 
 namespace otbr {
 
@@ -56,6 +63,168 @@ bool Publisher::IsServiceTypeEqual(const char *aFirstType, const char *aSecondTy
     return firstLength == secondLength && memcmp(aFirstType, aSecondType, firstLength) == 0;
 }
 
+void Publisher::CountPublishResult(otbrError aError)
+{
+    Metrics::Get().Increment(aError == OTBR_ERROR_NONE ? Metrics::kCounterMdnsPublishSuccess
+                                                       : Metrics::kCounterMdnsPublishFailure);
+
+    if (aError == OTBR_ERROR_DUPLICATED)
+    {
+        Metrics::Get().Increment(Metrics::kCounterMdnsNameConflicts);
+    }
+}
+
+otbrError Publisher::PublishHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength)
+{
+    otbrError  error = OTBR_ERROR_NONE;
+    Ip6Address address;
+
+    // Supports only IPv6 for now, may support IPv4 in the future.
+    VerifyOrExit(aAddressLength == sizeof(address.m8), error = OTBR_ERROR_INVALID_ARGS);
+
+    memcpy(address.m8, aAddress, sizeof(address.m8));
+    error = PublishHost(aName, AddressList{address});
+
+exit:
+    return error;
+}
+
+void Publisher::DiffAddresses(const AddressList &aOld,
+                              const AddressList &aNew,
+                              AddressList &      aRemoved,
+                              AddressList &      aAdded)
+{
+    aRemoved.clear();
+    aAdded.clear();
+
+    for (const Ip6Address &address : aOld)
+    {
+        if (std::find(aNew.begin(), aNew.end(), address) == aNew.end() &&
+            std::find(aRemoved.begin(), aRemoved.end(), address) == aRemoved.end())
+        {
+            aRemoved.push_back(address);
+        }
+    }
+
+    for (const Ip6Address &address : aNew)
+    {
+        if (std::find(aOld.begin(), aOld.end(), address) == aOld.end() &&
+            std::find(aAdded.begin(), aAdded.end(), address) == aAdded.end())
+        {
+            aAdded.push_back(address);
+        }
+    }
+}
+
+std::string Publisher::MakeServiceKey(const char *aName, const char *aType)
+{
+    std::string key(aName);
+    size_t      typeLength = strlen(aType);
+
+    if (typeLength > 0 && aType[typeLength - 1] == '.')
+    {
+        --typeLength;
+    }
+
+    // Neither instance names nor host names contain a NUL character.
+    key.push_back('\0');
+    key.append(aType, typeLength);
+
+    return key;
+}
+
+void Publisher::StartPublication(const std::string &aKey)
+{
+    // The key starts with the NUL terminated instance or host name.
+    OTBR_USDT1(mdns_publish_start, aKey.c_str());
+
+    if (!mOutstandingPublications.emplace(aKey, std::chrono::steady_clock::now()).second)
+    {
+        Metrics::Get().Increment(Metrics::kCounterMdnsPublishRetries);
+    }
+
+    UpdateOutstanding();
+}
+
+void Publisher::FinishPublication(const std::string &aKey, otbrError aError)
+{
+    auto publication = mOutstandingPublications.find(aKey);
+
+    OTBR_USDT2(mdns_publish_done, aKey.c_str(), aError);
+
+    if (publication != mOutstandingPublications.end())
+    {
+        RecordPublication(publication->second, aError);
+        mOutstandingPublications.erase(publication);
+        UpdateOutstanding();
+    }
+    else
+    {
+        CountPublishResult(aError);
+    }
+}
+
+void Publisher::FinishPublications(otbrError aError)
+{
+    for (const auto &publication : mOutstandingPublications)
+    {
+        OTBR_USDT2(mdns_publish_done, publication.first.c_str(), aError);
+        RecordPublication(publication.second, aError);
+    }
+
+    CancelPublications();
+}
+
+void Publisher::CancelPublication(const std::string &aKey)
+{
+    if (mOutstandingPublications.erase(aKey) > 0)
+    {
+        UpdateOutstanding();
+    }
+}
+
+void Publisher::CancelPublications(void)
+{
+    mOutstandingPublications.clear();
+    UpdateOutstanding();
+}
+
+void Publisher::RecordPublication(std::chrono::steady_clock::time_point aStartTime, otbrError aError)
+{
+    auto duration =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - aStartTime);
+
+    CountPublishResult(aError);
+    Metrics::Get().Record(Metrics::kHistogramMdnsPublish, static_cast<uint64_t>(duration.count()));
+}
+
+void Publisher::OnServiceResolved(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo)
+{
+    otbrLog(OTBR_LOG_INFO, "[mdns] service instance %s.%s %s, host %s, port %u, %zu addresses",
+            aInstanceInfo.mName.c_str(), aType.c_str(), aInstanceInfo.mRemoved ? "removed" : "resolved",
+            aInstanceInfo.mHostName.c_str(), aInstanceInfo.mPort, aInstanceInfo.mAddresses.size());
+
+    if (mDiscoveredServiceInstanceHandler != nullptr)
+    {
+        mDiscoveredServiceInstanceHandler(aType.c_str(), aInstanceInfo, mSubscriptionHandlerContext);
+    }
+}
+
+void Publisher::OnHostResolved(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo)
+{
+    otbrLog(OTBR_LOG_INFO, "[mdns] host %s resolved, %zu addresses", aHostName.c_str(), aHostInfo.mAddresses.size());
+
+    if (mDiscoveredHostHandler != nullptr)
+    {
+        mDiscoveredHostHandler(aHostName.c_str(), aHostInfo, mSubscriptionHandlerContext);
+    }
+}
+
+void Publisher::UpdateOutstanding(void)
+{
+    Metrics::Get().SetGauge(Metrics::kGaugeMdnsOutstanding, mOutstandingPublications.size());
+}
+
 otbrError Publisher::EncodeTxtData(const TxtList &aTxtList, uint8_t *aTxtData, uint16_t &aTxtLength)
 {
     otbrError error = OTBR_ERROR_NONE;
@@ -34,6 +34,9 @@
 #ifndef OTBR_AGENT_MDNS_HPP_
 #define OTBR_AGENT_MDNS_HPP_
 
+#include <chrono>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <sys/select.h>
@@ -92,6 +95,38 @@ public:
 
     typedef std::vector<TxtEntry> TxtList;
 
+    typedef std::vector<Ip6Address> AddressList;
+
+    /**
+     * This structure represents information of a discovered service instance.
+     *
+     */
+    struct DiscoveredInstanceInfo
+    {
+        bool                    mRemoved    = false; ///< The service instance is removed.
+        uint32_t                mNetifIndex = 0;     ///< The network interface the instance is discovered on.
+        std::string             mName;               ///< The service instance name.
+        std::string             mHostName;           ///< The full host name, e.g. "host.local.".
+        std::vector<Ip6Address> mAddresses;          ///< The IPv6 addresses of the host.
+        uint16_t                mPort     = 0;       ///< The service port.
+        uint16_t                mPriority = 0;       ///< The service priority.
+        uint16_t                mWeight   = 0;       ///< The service weight.
+        std::vector<uint8_t>    mTxtData;            ///< The TXT data in DNS-SD format.
+        uint32_t                mTtl = 0;            ///< The TTL of the records, in seconds.
+    };
+
+    /**
+     * This structure represents information of a discovered host.
+     *
+     */
+    struct DiscoveredHostInfo
+    {
+        std::string             mHostName;       ///< The full host name, e.g. "host.local.".
+        std::vector<Ip6Address> mAddresses;      ///< The IPv6 addresses of the host.
+        uint32_t                mNetifIndex = 0; ///< The network interface the host is discovered on.
+        uint32_t                mTtl        = 0; ///< The TTL of the address records, in seconds.
+    };
+
     /**
      * MDNS state values.
      *
@@ -132,6 +167,28 @@ public:
      */
     typedef void (*PublishHostHandler)(const char *aName, otbrError aError, void *aContext);
 
+    /**
+     * This function pointer is called when a service instance is discovered, updated or removed.
+     *
+     * @param[in]  aType          The service type of the subscription, e.g. "_meshcop._udp".
+     * @param[in]  aInstanceInfo  The service instance information.
+     * @param[in]  aContext       A user context.
+     *
+     */
+    typedef void (*DiscoveredServiceInstanceHandler)(const char *                  aType,
+                                                     const DiscoveredInstanceInfo &aInstanceInfo,
+                                                     void *                        aContext);
+
+    /**
+     * This function pointer is called when the addresses of a host are discovered or updated.
+     *
+     * @param[in]  aHostName  The host name of the subscription, without the domain.
+     * @param[in]  aHostInfo  The host information.
+     * @param[in]  aContext   A user context.
+     *
+     */
+    typedef void (*DiscoveredHostHandler)(const char *aHostName, const DiscoveredHostInfo &aHostInfo, void *aContext);
+
     /**
      * This method sets the handler for service publication.
      *
@@ -158,6 +215,23 @@ public:
         mHostHandlerContext = aContext;
     }
 
+    /**
+     * This method sets the handlers for service and host subscriptions.
+     *
+     * @param[in]  aInstanceHandler  A handler which will be called when a subscribed service instance changes.
+     * @param[in]  aHostHandler      A handler which will be called when a subscribed host changes.
+     * @param[in]  aContext          A user context which is associated to both handlers.
+     *
+     */
+    void SetSubscriptionHandlers(DiscoveredServiceInstanceHandler aInstanceHandler,
+                                 DiscoveredHostHandler            aHostHandler,
+                                 void *                           aContext)
+    {
+        mDiscoveredServiceInstanceHandler = aInstanceHandler;
+        mDiscoveredHostHandler            = aHostHandler;
+        mSubscriptionHandlerContext       = aContext;
+    }
+
     /**
      * This method starts the MDNS service.
      *
@@ -216,6 +290,23 @@ public:
      */
     virtual otbrError UnpublishService(const char *aName, const char *aType) = 0;
 
+    /**
+     * This method updates the TXT record of a published service.
+     *
+     * The service is not re-registered, so the new TXT record is announced without goodbye packets or probing.
+     *
+     * @param[in]   aName               The name of this service.
+     * @param[in]   aType               The type of this service.
+     * @param[in]   aTxtList            A list of TXT name/value pairs.
+     *
+     * @retval  OTBR_ERROR_NONE          Successfully updated the TXT record.
+     * @retval  OTBR_ERROR_NOT_FOUND     The service has not been published.
+     * @retval  OTBR_ERROR_INVALID_ARGS  The TXT record is too long.
+     * @retval  OTBR_ERROR_MDNS          Failed to update the TXT record.
+     *
+     */
+    virtual otbrError UpdateServiceTxt(const char *aName, const char *aType, const TxtList &aTxtList) = 0;
+
     /**
      * This method publishes or updates a host.
      *
@@ -231,7 +322,23 @@ public:
      * @retval  OTBR_ERROR_ERRNO         Failed to publish or update the host.
      *
      */
-    virtual otbrError PublishHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength) = 0;
+    otbrError PublishHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength);
+
+    /**
+     * This method publishes or updates a host with all of its addresses.
+     *
+     * Publishing a host is advertising an AAAA RR for each address of the host name. When the host has been
+     * published, only the records of the changed addresses are updated, see `DiffAddresses()`.
+     *
+     * @param[in]  aName       The name of the host.
+     * @param[in]  aAddresses  The addresses of the host, must not be empty.
+     *
+     * @retval  OTBR_ERROR_NONE          Successfully published or updated the host.
+     * @retval  OTBR_ERROR_INVALID_ARGS  The arguments are not valid.
+     * @retval  OTBR_ERROR_MDNS          Failed to publish or update the host.
+     *
+     */
+    virtual otbrError PublishHost(const char *aName, const AddressList &aAddresses) = 0;
 
     /**
      * This method un-publishes a host.
@@ -244,6 +351,63 @@ public:
      */
     virtual otbrError UnpublishHost(const char *aName) = 0;
 
+    /**
+     * This method starts a batch of publications.
+     *
+     * Hosts and services published until the matching `CommitBatch()` are committed together, so they share a
+     * single probing and announcing cycle. Batches may be nested, only the outermost `CommitBatch()` commits.
+     *
+     */
+    virtual void BeginBatch(void) = 0;
+
+    /**
+     * This method ends a batch of publications and commits the records published within the batch.
+     *
+     * @retval  OTBR_ERROR_NONE  Successfully committed the batch, or an outer batch is still open.
+     * @retval  OTBR_ERROR_MDNS  Failed to commit the batch.
+     *
+     */
+    virtual otbrError CommitBatch(void) = 0;
+
+    /**
+     * This method subscribes to a service type or a service instance.
+     *
+     * The discovered service instances are resolved, including the addresses of their hosts, and reported to the
+     * `DiscoveredServiceInstanceHandler` until the subscription is removed.
+     *
+     * @param[in]  aType          The service type, e.g. "_meshcop._udp".
+     * @param[in]  aInstanceName  The service instance name, or empty to browse all instances of @p aType.
+     *
+     */
+    virtual void SubscribeService(const std::string &aType, const std::string &aInstanceName) = 0;
+
+    /**
+     * This method removes a subscription added by `SubscribeService()`.
+     *
+     * @param[in]  aType          The service type.
+     * @param[in]  aInstanceName  The service instance name, or empty.
+     *
+     */
+    virtual void UnsubscribeService(const std::string &aType, const std::string &aInstanceName) = 0;
+
+    /**
+     * This method subscribes to the addresses of a host.
+     *
+     * The addresses are reported to the `DiscoveredHostHandler` until the subscription is removed.
+     *
+     * @param[in]  aHostName  The host name, without the domain.
+     *
+     */
+    virtual void SubscribeHost(const std::string &aHostName) = 0;
+
+    /**
+     * This method removes a subscription added by `SubscribeHost()`.
+     *
+     * @param[in]  aHostName  The host name, without the domain.
+     *
+     */
+    virtual void UnsubscribeHost(const std::string &aHostName) = 0;
+
     /**
      * This method performs the MDNS processing.
      *
@@ -309,6 +473,20 @@ public:
      */
     static bool IsServiceTypeEqual(const char *aFirstType, const char *aSecondType);
 
+    /**
+     * This method makes the key of a service from its instance name and type.
+     *
+     * The trailing dot of the type is ignored, see `IsServiceTypeEqual()`. A service key never equals a host name,
+     * so both can be used as keys of the same publication.
+     *
+     * @param[in]   aName   The service instance name.
+     * @param[in]   aType   The service type.
+     *
+     * @returns The service key.
+     *
+     */
+    static std::string MakeServiceKey(const char *aName, const char *aType);
+
     /**
      * This function writes the TXT entry list to a TXT data buffer.
      *
@@ -326,17 +504,114 @@ public:
      */
     static otbrError EncodeTxtData(const TxtList &aTxtList, uint8_t *aTxtData, uint16_t &aTxtLength);
 
+    /**
+     * This function compares two address sets of a host.
+     *
+     * Duplicated addresses and the order of the addresses are ignored.
+     *
+     * @param[in]   aOld      The published addresses.
+     * @param[in]   aNew      The addresses to publish.
+     * @param[out]  aRemoved  The addresses in @p aOld but not in @p aNew.
+     * @param[out]  aAdded    The addresses in @p aNew but not in @p aOld.
+     *
+     */
+    static void DiffAddresses(const AddressList &aOld,
+                              const AddressList &aNew,
+                              AddressList &      aRemoved,
+                              AddressList &      aAdded);
+
 protected:
     enum : uint8_t
     {
         kMaxTextEntrySize = 255,
     };
 
+    /**
+     * This method counts the result of publishing a service or a host in the agent metrics.
+     *
+     * @param[in]   aError  The publish result.
+     *
+     */
+    static void CountPublishResult(otbrError aError);
+
+    /**
+     * This method starts timing the publication of a service or a host.
+     *
+     * Publishing the same key again before its result is counted as a retry, the original start time is kept.
+     *
+     * @param[in]   aKey    The service key from `MakeServiceKey()`, or the host name.
+     *
+     */
+    void StartPublication(const std::string &aKey);
+
+    /**
+     * This method records the result of publishing a service or a host in the agent metrics.
+     *
+     * The result is always counted, the latency only when the publication was started by `StartPublication()`.
+     *
+     * @param[in]   aKey    The service key from `MakeServiceKey()`, or the host name.
+     * @param[in]   aError  The publish result.
+     *
+     */
+    void FinishPublication(const std::string &aKey, otbrError aError);
+
+    /**
+     * This method records the same result for all outstanding publications.
+     *
+     * @param[in]   aError  The publish result.
+     *
+     */
+    void FinishPublications(otbrError aError);
+
+    /**
+     * This method drops an outstanding publication without recording a result, e.g. when it is un-published.
+     *
+     * @param[in]   aKey    The service key from `MakeServiceKey()`, or the host name.
+     *
+     */
+    void CancelPublication(const std::string &aKey);
+
+    /**
+     * This method drops all outstanding publications without recording a result.
+     *
+     */
+    void CancelPublications(void);
+
+    /**
+     * This method reports a discovered, updated or removed service instance to the subscription handler.
+     *
+     * @param[in]   aType           The service type of the subscription.
+     * @param[in]   aInstanceInfo   The service instance information.
+     *
+     */
+    void OnServiceResolved(const std::string &aType, const DiscoveredInstanceInfo &aInstanceInfo);
+
+    /**
+     * This method reports the discovered addresses of a host to the subscription handler.
+     *
+     * @param[in]   aHostName   The host name of the subscription, without the domain.
+     * @param[in]   aHostInfo   The host information.
+     *
+     */
+    void OnHostResolved(const std::string &aHostName, const DiscoveredHostInfo &aHostInfo);
+
     PublishServiceHandler mServiceHandler        = nullptr;
     void *                mServiceHandlerContext = nullptr;
 
     PublishHostHandler mHostHandler        = nullptr;
     void *             mHostHandlerContext = nullptr;
+
+    DiscoveredServiceInstanceHandler mDiscoveredServiceInstanceHandler = nullptr;
+    DiscoveredHostHandler            mDiscoveredHostHandler            = nullptr;
+    void *                           mSubscriptionHandlerContext       = nullptr;
+
+private:
+    typedef std::unordered_map<std::string, std::chrono::steady_clock::time_point> Publications;
+
+    void RecordPublication(std::chrono::steady_clock::time_point aStartTime, otbrError aError);
+    void UpdateOutstanding(void);
+
+    Publications mOutstandingPublications;
 };
 
 /**
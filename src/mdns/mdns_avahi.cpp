@@ -33,6 +33,8 @@
 
 #include "mdns/mdns_avahi.hpp"
 
+#include <algorithm>
+
 #include <avahi-common/alternative.h>
 #include <avahi-common/error.h>
 #include <avahi-common/malloc.h>
@@ -45,6 +47,8 @@
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_poller.hpp"
+#include "common/memory_stats.hpp"
 #include "common/time.hpp"
 #include "utils/strcpy_utils.hpp"
 
@@ -55,6 +59,7 @@ AvahiTimeout::AvahiTimeout(const struct timeval *aTimeout,
     : mCallback(aCallback)
     , mContext(aContext)
     , mPoller(aPoller)
+    , mHeapIndex(kNotScheduled)
 {
     if (aTimeout)
     {
@@ -94,16 +99,21 @@ AvahiWatch *Poller::WatchNew(const struct AvahiPoll *aPoller,
 
 AvahiWatch *Poller::WatchNew(int aFd, AvahiWatchEvent aEvent, AvahiWatchCallback aCallback, void *aContext)
 {
+    AvahiWatch *watch;
+
     assert(aEvent && aCallback && aFd >= 0);
 
-    mWatches.push_back(new AvahiWatch(aFd, aEvent, aCallback, aContext, this));
+    watch = new AvahiWatch(aFd, aEvent, aCallback, aContext, this);
+    mWatches[aFd].push_back(watch);
+    UpdateWatchFd(aFd);
 
-    return mWatches.back();
+    return watch;
 }
 
 void Poller::WatchUpdate(AvahiWatch *aWatch, AvahiWatchEvent aEvent)
 {
     aWatch->mEvents = aEvent;
+    static_cast<Poller *>(aWatch->mPoller)->UpdateWatchFd(aWatch->mFd);
 }
 
 AvahiWatchEvent Poller::WatchGetEvents(AvahiWatch *aWatch)
@@ -118,15 +128,51 @@ void Poller::WatchFree(AvahiWatch *aWatch)
 
 void Poller::WatchFree(AvahiWatch &aWatch)
 {
-    for (Watches::iterator it = mWatches.begin(); it != mWatches.end(); ++it)
+    int  fd = aWatch.mFd;
+    auto it = mWatches.find(fd);
+
+    VerifyOrExit(it != mWatches.end());
+
+    it->second.erase(std::remove(it->second.begin(), it->second.end(), &aWatch), it->second.end());
+    if (it->second.empty())
     {
-        if (*it == &aWatch)
+        mWatches.erase(it);
+    }
+
+    delete &aWatch;
+    UpdateWatchFd(fd);
+
+exit:
+    return;
+}
+
+void Poller::UpdateWatchFd(int aFd)
+{
+    uint8_t events = 0;
+    auto    it     = mWatches.find(aFd);
+
+    if (it != mWatches.end())
+    {
+        for (const AvahiWatch *watch : it->second)
         {
-            mWatches.erase(it);
-            delete &aWatch;
-            break;
+            if (AVAHI_WATCH_IN & watch->mEvents)
+            {
+                events |= MainloopPoller::kEventRead;
+            }
+
+            if (AVAHI_WATCH_OUT & watch->mEvents)
+            {
+                events |= MainloopPoller::kEventWrite;
+            }
+
+            if (AVAHI_WATCH_ERR & watch->mEvents)
+            {
+                events |= MainloopPoller::kEventError;
+            }
         }
     }
+
+    MainloopPoller::Get().Register(aFd, events);
 }
 
 AvahiTimeout *Poller::TimeoutNew(const AvahiPoll *     aPoller,
@@ -140,19 +186,29 @@ AvahiTimeout *Poller::TimeoutNew(const AvahiPoll *     aPoller,
 
 AvahiTimeout *Poller::TimeoutNew(const struct timeval *aTimeout, AvahiTimeoutCallback aCallback, void *aContext)
 {
-    mTimers.push_back(new AvahiTimeout(aTimeout, aCallback, aContext, this));
-    return mTimers.back();
+    AvahiTimeout *timer = new AvahiTimeout(aTimeout, aCallback, aContext, this);
+
+    if (timer->mTimeout != 0)
+    {
+        ScheduleTimer(*timer);
+    }
+
+    return timer;
 }
 
 void Poller::TimeoutUpdate(AvahiTimeout *aTimer, const struct timeval *aTimeout)
 {
+    Poller *poller = static_cast<Poller *>(aTimer->mPoller);
+
     if (aTimeout == nullptr)
     {
         aTimer->mTimeout = 0;
+        poller->UnscheduleTimer(*aTimer);
     }
     else
     {
         aTimer->mTimeout = otbr::GetNow() + otbr::GetTimestamp(*aTimeout);
+        poller->ScheduleTimer(*aTimer);
     }
 }
 
@@ -163,151 +219,227 @@ void Poller::TimeoutFree(AvahiTimeout *aTimer)
 
 void Poller::TimeoutFree(AvahiTimeout &aTimer)
 {
-    for (Timers::iterator it = mTimers.begin(); it != mTimers.end(); ++it)
+    UnscheduleTimer(aTimer);
+    delete &aTimer;
+}
+
+void Poller::ScheduleTimer(AvahiTimeout &aTimer)
+{
+    if (aTimer.mHeapIndex == AvahiTimeout::kNotScheduled)
     {
-        if (*it == &aTimer)
-        {
-            mTimers.erase(it);
-            delete &aTimer;
-            break;
-        }
+        aTimer.mHeapIndex = mTimers.size();
+        mTimers.push_back(&aTimer);
+        SiftUpTimer(aTimer.mHeapIndex);
+    }
+    else
+    {
+        // The timeout may have moved either way.
+        SiftUpTimer(aTimer.mHeapIndex);
+        SiftDownTimer(aTimer.mHeapIndex);
     }
 }
 
-void Poller::UpdateFdSet(fd_set &aReadFdSet, fd_set &aWriteFdSet, fd_set &aErrorFdSet, int &aMaxFd, timeval &aTimeout)
+void Poller::UnscheduleTimer(AvahiTimeout &aTimer)
 {
-    for (Watches::iterator it = mWatches.begin(); it != mWatches.end(); ++it)
+    size_t index = aTimer.mHeapIndex;
+
+    VerifyOrExit(index != AvahiTimeout::kNotScheduled);
+
+    SwapTimers(index, mTimers.size() - 1);
+    mTimers.pop_back();
+    aTimer.mHeapIndex = AvahiTimeout::kNotScheduled;
+
+    if (index < mTimers.size())
     {
-        int             fd     = (*it)->mFd;
-        AvahiWatchEvent events = (*it)->mEvents;
+        AvahiTimeout *moved = mTimers[index];
 
-        if (AVAHI_WATCH_IN & events)
-        {
-            FD_SET(fd, &aReadFdSet);
-        }
+        SiftUpTimer(index);
+        SiftDownTimer(moved->mHeapIndex);
+    }
+
+exit:
+    return;
+}
+
+void Poller::SiftUpTimer(size_t aIndex)
+{
+    while (aIndex > 0)
+    {
+        size_t parent = (aIndex - 1) / 2;
 
-        if (AVAHI_WATCH_OUT & events)
+        if (!IsEarlier(*mTimers[aIndex], *mTimers[parent]))
         {
-            FD_SET(fd, &aWriteFdSet);
+            break;
         }
 
-        if (AVAHI_WATCH_ERR & events)
+        SwapTimers(aIndex, parent);
+        aIndex = parent;
+    }
+}
+
+void Poller::SiftDownTimer(size_t aIndex)
+{
+    while (true)
+    {
+        size_t earliest = aIndex;
+        size_t left     = 2 * aIndex + 1;
+        size_t right    = left + 1;
+
+        if (left < mTimers.size() && IsEarlier(*mTimers[left], *mTimers[earliest]))
         {
-            FD_SET(fd, &aErrorFdSet);
+            earliest = left;
         }
 
-        if (AVAHI_WATCH_HUP & events)
+        if (right < mTimers.size() && IsEarlier(*mTimers[right], *mTimers[earliest]))
         {
-            // TODO what do with this event type?
+            earliest = right;
         }
 
-        if (aMaxFd < fd)
+        if (earliest == aIndex)
         {
-            aMaxFd = fd;
+            break;
         }
 
-        (*it)->mHappened = 0;
+        SwapTimers(aIndex, earliest);
+        aIndex = earliest;
     }
+}
+
+void Poller::SwapTimers(size_t aIndex1, size_t aIndex2)
+{
+    std::swap(mTimers[aIndex1], mTimers[aIndex2]);
+    mTimers[aIndex1]->mHeapIndex = aIndex1;
+    mTimers[aIndex2]->mHeapIndex = aIndex2;
+}
 
-    unsigned long now = GetNow();
+void Poller::UpdateFdSet(fd_set &aReadFdSet, fd_set &aWriteFdSet, fd_set &aErrorFdSet, int &aMaxFd, timeval &aTimeout)
+{
+    OTBR_UNUSED_VARIABLE(aReadFdSet);
+    OTBR_UNUSED_VARIABLE(aWriteFdSet);
+    OTBR_UNUSED_VARIABLE(aErrorFdSet);
+    OTBR_UNUSED_VARIABLE(aMaxFd);
 
-    for (Timers::iterator it = mTimers.begin(); it != mTimers.end(); ++it)
+    unsigned long timeout = GetEarliestTimeout();
+    unsigned long now     = GetNow();
+
+    // The earliest timer is at the top of the heap, an idle poller costs nothing here.
+    VerifyOrExit(timeout != 0);
+
+    if (static_cast<long>(timeout - now) <= 0)
+    {
+        aTimeout.tv_usec = 0;
+        aTimeout.tv_sec  = 0;
+    }
+    else
     {
-        unsigned long timeout = (*it)->mTimeout;
+        time_t      sec;
+        suseconds_t usec;
 
-        if (timeout == 0)
-        {
-            continue;
-        }
+        timeout -= now;
+        sec  = static_cast<time_t>(timeout / 1000);
+        usec = static_cast<suseconds_t>((timeout % 1000) * 1000);
 
-        if (static_cast<long>(timeout - now) <= 0)
+        if (sec < aTimeout.tv_sec)
         {
-            aTimeout.tv_usec = 0;
-            aTimeout.tv_sec  = 0;
-            break;
+            aTimeout.tv_sec  = sec;
+            aTimeout.tv_usec = usec;
         }
-        else
+        else if (sec == aTimeout.tv_sec)
         {
-            time_t      sec;
-            suseconds_t usec;
-
-            timeout -= now;
-            sec  = static_cast<time_t>(timeout / 1000);
-            usec = static_cast<suseconds_t>((timeout % 1000) * 1000);
-
-            if (sec < aTimeout.tv_sec)
-            {
-                aTimeout.tv_sec = sec;
-            }
-            else if (sec == aTimeout.tv_sec)
+            if (usec < aTimeout.tv_usec)
             {
-                if (usec < aTimeout.tv_usec)
-                {
-                    aTimeout.tv_usec = usec;
-                }
+                aTimeout.tv_usec = usec;
             }
         }
     }
+
+exit:
+    return;
 }
 
-void Poller::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
+void Poller::HandleWatch(AvahiWatch &aWatch, uint8_t aReadyEvents)
 {
-    unsigned long now = GetNow();
+    aWatch.mHappened = 0;
 
-    for (Watches::iterator it = mWatches.begin(); it != mWatches.end(); ++it)
+    if ((AVAHI_WATCH_IN & aWatch.mEvents) && (aReadyEvents & MainloopPoller::kEventRead))
     {
-        int             fd     = (*it)->mFd;
-        AvahiWatchEvent events = (*it)->mEvents;
+        aWatch.mHappened |= AVAHI_WATCH_IN;
+    }
 
-        (*it)->mHappened = 0;
+    if ((AVAHI_WATCH_OUT & aWatch.mEvents) && (aReadyEvents & MainloopPoller::kEventWrite))
+    {
+        aWatch.mHappened |= AVAHI_WATCH_OUT;
+    }
 
-        if ((AVAHI_WATCH_IN & events) && FD_ISSET(fd, &aReadFdSet))
-        {
-            (*it)->mHappened |= AVAHI_WATCH_IN;
-        }
+    if ((AVAHI_WATCH_ERR & aWatch.mEvents) && (aReadyEvents & MainloopPoller::kEventError))
+    {
+        aWatch.mHappened |= AVAHI_WATCH_ERR;
+    }
 
-        if ((AVAHI_WATCH_OUT & events) && FD_ISSET(fd, &aWriteFdSet))
-        {
-            (*it)->mHappened |= AVAHI_WATCH_OUT;
-        }
+    // TODO hup events
+    if (aWatch.mHappened)
+    {
+        aWatch.mCallback(&aWatch, aWatch.mFd, static_cast<AvahiWatchEvent>(aWatch.mHappened), aWatch.mContext);
+    }
+}
 
-        if ((AVAHI_WATCH_ERR & events) && FD_ISSET(fd, &aErrorFdSet))
-        {
-            (*it)->mHappened |= AVAHI_WATCH_ERR;
-        }
+void Poller::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
+{
+    const MainloopPoller &poller = MainloopPoller::Get();
+    unsigned long         now    = GetNow();
+
+    OTBR_UNUSED_VARIABLE(aReadFdSet);
+    OTBR_UNUSED_VARIABLE(aWriteFdSet);
+    OTBR_UNUSED_VARIABLE(aErrorFdSet);
+
+    for (int fd : poller.GetReadyFds())
+    {
+        uint8_t ready = poller.GetReadyEvents(fd);
 
-        // TODO hup events
-        if ((*it)->mHappened)
+        // A callback may add or free watches of the same file descriptor, look them up again each time.
+        for (size_t i = 0;; i++)
         {
-            (*it)->mCallback(*it, (*it)->mFd, static_cast<AvahiWatchEvent>((*it)->mHappened), (*it)->mContext);
+            auto        it = mWatches.find(fd);
+            AvahiWatch *watch;
+
+            if (it == mWatches.end() || i >= it->second.size())
+            {
+                break;
+            }
+
+            watch = it->second[i];
+            HandleWatch(*watch, ready);
+
+            // The happened events are only valid during the callback.
+            it = mWatches.find(fd);
+            if (it != mWatches.end() && i < it->second.size() && it->second[i] == watch)
+            {
+                watch->mHappened = 0;
+            }
         }
     }
 
-    std::vector<AvahiTimeout *> expired;
-
-    for (Timers::iterator it = mTimers.begin(); it != mTimers.end(); ++it)
+    // A callback may re-arm its timer to expire at once, bound the number of callbacks in one call.
+    for (size_t count = mTimers.size(); count > 0 && !mTimers.empty(); count--)
     {
-        if ((*it)->mTimeout == 0)
-        {
-            continue;
-        }
+        AvahiTimeout *timer = mTimers.front();
 
-        if (static_cast<long>((*it)->mTimeout - now) <= 0)
+        if (static_cast<long>(timer->mTimeout - now) > 0)
         {
-            expired.push_back(*it);
+            break;
         }
-    }
 
-    for (std::vector<AvahiTimeout *>::iterator it = expired.begin(); it != expired.end(); ++it)
-    {
-        AvahiTimeout *avahiTimeout = *it;
-        avahiTimeout->mCallback(avahiTimeout, avahiTimeout->mContext);
+        // Like the simple poll of Avahi, a timer fires once and stays disabled until it is updated again.
+        timer->mTimeout = 0;
+        UnscheduleTimer(*timer);
+        timer->mCallback(timer, timer->mContext);
     }
 }
 
 PublisherAvahi::PublisherAvahi(int aProtocol, const char *aDomain, StateHandler aHandler, void *aContext)
     : mClient(nullptr)
     , mGroup(nullptr)
+    , mBatchDepth(0)
     , mProtocol(aProtocol == AF_INET6 ? AVAHI_PROTO_INET6
                                       : aProtocol == AF_INET ? AVAHI_PROTO_INET : AVAHI_PROTO_UNSPEC)
     , mDomain(aDomain)
@@ -345,6 +477,11 @@ bool PublisherAvahi::IsStarted(void) const
 void PublisherAvahi::Stop(void)
 {
     mServices.clear();
+    CancelPublications();
+
+    // Browsers and resolvers are owned by the client, free them before the client.
+    mSubscribedServices.clear();
+    mSubscribedHosts.clear();
 
     if (mGroup)
     {
@@ -389,16 +526,19 @@ void PublisherAvahi::HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupSt
     case AVAHI_ENTRY_GROUP_ESTABLISHED:
         /* The entry group has been established successfully */
         otbrLog(OTBR_LOG_INFO, "Group established.");
+        FinishPublications(OTBR_ERROR_NONE);
         break;
 
     case AVAHI_ENTRY_GROUP_COLLISION:
         otbrLog(OTBR_LOG_ERR, "Name collision!");
+        FinishPublications(OTBR_ERROR_DUPLICATED);
         break;
 
     case AVAHI_ENTRY_GROUP_FAILURE:
         otbrLog(OTBR_LOG_ERR, "Group failed: %s!",
                 avahi_strerror(avahi_client_errno(avahi_entry_group_get_client(aGroup))));
         /* Some kind of failure happened while we were registering our services */
+        FinishPublications(OTBR_ERROR_MDNS);
         break;
 
     case AVAHI_ENTRY_GROUP_UNCOMMITED:
@@ -425,6 +565,46 @@ exit:
     }
 }
 
+otbrError PublisherAvahi::CommitGroup(void)
+{
+    otbrError ret   = OTBR_ERROR_NONE;
+    int       error = 0;
+
+    VerifyOrExit(mGroup != nullptr);
+    // A group can only be committed once, avahi-daemon announces records added to it afterwards on their own.
+    VerifyOrExit(avahi_entry_group_get_state(mGroup) == AVAHI_ENTRY_GROUP_UNCOMMITED);
+
+    error = avahi_entry_group_commit(mGroup);
+
+exit:
+    if (error)
+    {
+        ret = OTBR_ERROR_MDNS;
+        otbrLog(OTBR_LOG_ERR, "Failed to commit entry group: %s!", avahi_strerror(error));
+        FinishPublications(ret);
+    }
+
+    return ret;
+}
+
+void PublisherAvahi::BeginBatch(void)
+{
+    ++mBatchDepth;
+}
+
+otbrError PublisherAvahi::CommitBatch(void)
+{
+    otbrError ret = OTBR_ERROR_NONE;
+
+    assert(mBatchDepth > 0);
+    VerifyOrExit(--mBatchDepth == 0);
+
+    ret = CommitGroup();
+
+exit:
+    return ret;
+}
+
 void PublisherAvahi::HandleClientState(AvahiClient *aClient, AvahiClientState aState)
 {
     otbrLog(OTBR_LOG_INFO, "Avahi client state changed to %d.", aState);
@@ -436,15 +616,16 @@ void PublisherAvahi::HandleClientState(AvahiClient *aClient, AvahiClientState aS
         otbrLog(OTBR_LOG_INFO, "Avahi client ready.");
         mState = State::kReady;
         CreateGroup(aClient);
+        // Commit everything published by the state handler at once.
+        BeginBatch();
         mStateHandler(mContext, mState);
-        if (mGroup)
-        {
-            avahi_entry_group_commit(mGroup);
-        }
+        CommitBatch();
+        StartSubscriptions();
         break;
 
     case AVAHI_CLIENT_FAILURE:
         otbrLog(OTBR_LOG_ERR, "Client failure: %s", avahi_strerror(avahi_client_errno(aClient)));
+        ReleaseSubscriptions();
         mState = State::kIdle;
         mStateHandler(mContext, mState);
         break;
@@ -465,6 +646,7 @@ void PublisherAvahi::HandleClientState(AvahiClient *aClient, AvahiClientState aS
         if (mGroup)
         {
             avahi_entry_group_reset(mGroup);
+            CancelPublications();
         }
         break;
 
@@ -484,32 +666,417 @@ void PublisherAvahi::UpdateFdSet(fd_set & aReadFdSet,
                                  int &    aMaxFd,
                                  timeval &aTimeout)
 {
+    MemoryStats::Scope memoryScope(MemoryStats::kSubsystemMdns);
+
     mPoller.UpdateFdSet(aReadFdSet, aWriteFdSet, aErrorFdSet, aMaxFd, aTimeout);
 }
 
 void PublisherAvahi::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
 {
+    MemoryStats::Scope memoryScope(MemoryStats::kSubsystemMdns);
+
     mPoller.Process(aReadFdSet, aWriteFdSet, aErrorFdSet);
 }
 
-otbrError PublisherAvahi::PublishService(const char *   aHostName,
-                                         uint16_t       aPort,
-                                         const char *   aName,
-                                         const char *   aType,
-                                         const TxtList &aTxtList)
+void PublisherAvahi::SubscribeService(const std::string &aType, const std::string &aInstanceName)
 {
-    otbrError ret   = OTBR_ERROR_ERRNO;
-    int       error = 0;
-    // aligned with AvahiStringList
-    AvahiStringList  buffer[kMaxSizeOfTxtRecord / sizeof(AvahiStringList)];
+    mSubscribedServices.emplace_back(new ServiceSubscription(*this, aType, aInstanceName));
+
+    if (mState == State::kReady)
+    {
+        mSubscribedServices.back()->Browse();
+    }
+
+    otbrLog(OTBR_LOG_INFO, "[mdns] subscribe service %s.%s (total %zu)", aInstanceName.c_str(), aType.c_str(),
+            mSubscribedServices.size());
+}
+
+void PublisherAvahi::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    ServiceSubscriptions::iterator it =
+        std::find_if(mSubscribedServices.begin(), mSubscribedServices.end(),
+                     [&aType, &aInstanceName](const std::unique_ptr<ServiceSubscription> &aSubscription) {
+                         return aSubscription->mType == aType && aSubscription->mInstanceName == aInstanceName;
+                     });
+
+    VerifyOrExit(it != mSubscribedServices.end());
+
+    // Avahi allows freeing browsers and resolvers from within their callbacks, so this is safe to be called
+    // from the subscription handlers.
+    mSubscribedServices.erase(it);
+
+    otbrLog(OTBR_LOG_INFO, "[mdns] unsubscribe service %s.%s (left %zu)", aInstanceName.c_str(), aType.c_str(),
+            mSubscribedServices.size());
+
+exit:
+    return;
+}
+
+void PublisherAvahi::SubscribeHost(const std::string &aHostName)
+{
+    mSubscribedHosts.emplace_back(new HostSubscription(*this, aHostName));
+
+    if (mState == State::kReady)
+    {
+        mSubscribedHosts.back()->Resolve();
+    }
+
+    otbrLog(OTBR_LOG_INFO, "[mdns] subscribe host %s (total %zu)", aHostName.c_str(), mSubscribedHosts.size());
+}
+
+void PublisherAvahi::UnsubscribeHost(const std::string &aHostName)
+{
+    HostSubscriptions::iterator it = std::find_if(mSubscribedHosts.begin(), mSubscribedHosts.end(),
+                                                  [&aHostName](const std::unique_ptr<HostSubscription> &aSubscription) {
+                                                      return aSubscription->mHostName == aHostName;
+                                                  });
+
+    VerifyOrExit(it != mSubscribedHosts.end());
+
+    mSubscribedHosts.erase(it);
+
+    otbrLog(OTBR_LOG_INFO, "[mdns] unsubscribe host %s (left %zu)", aHostName.c_str(), mSubscribedHosts.size());
+
+exit:
+    return;
+}
+
+void PublisherAvahi::StartSubscriptions(void)
+{
+    for (const auto &subscription : mSubscribedServices)
+    {
+        subscription->Browse();
+    }
+
+    for (const auto &subscription : mSubscribedHosts)
+    {
+        subscription->Resolve();
+    }
+}
+
+void PublisherAvahi::ReleaseSubscriptions(void)
+{
+    for (const auto &subscription : mSubscribedServices)
+    {
+        subscription->Release();
+    }
+
+    for (const auto &subscription : mSubscribedHosts)
+    {
+        subscription->Release();
+    }
+}
+
+static void CopyAddress(const AvahiAddress *aAddress, std::vector<otbr::Ip6Address> &aAddresses)
+{
+    aAddresses.clear();
+
+    if (aAddress != nullptr && aAddress->proto == AVAHI_PROTO_INET6)
+    {
+        aAddresses.push_back(otbr::Ip6Address(aAddress->data.ipv6.address));
+    }
+}
+
+PublisherAvahi::ServiceSubscription::ServiceSubscription(PublisherAvahi &   aPublisher,
+                                                         const std::string &aType,
+                                                         const std::string &aInstanceName)
+    : mPublisher(aPublisher)
+    , mType(aType)
+    , mInstanceName(aInstanceName)
+    , mBrowser(nullptr)
+{
+}
+
+void PublisherAvahi::ServiceSubscription::Browse(void)
+{
+    Release();
+
+    if (!mInstanceName.empty())
+    {
+        AddResolver(AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, mInstanceName.c_str(), mPublisher.mDomain);
+        ExitNow();
+    }
+
+    mBrowser = avahi_service_browser_new(mPublisher.mClient, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC, mType.c_str(),
+                                         mPublisher.mDomain, static_cast<AvahiLookupFlags>(0), HandleBrowseResult,
+                                         this);
+
+    if (mBrowser == nullptr)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[mdns] failed to browse service %s: %s", mType.c_str(),
+                avahi_strerror(avahi_client_errno(mPublisher.mClient)));
+    }
+
+exit:
+    return;
+}
+
+void PublisherAvahi::ServiceSubscription::Release(void)
+{
+    if (mBrowser != nullptr)
+    {
+        avahi_service_browser_free(mBrowser);
+        mBrowser = nullptr;
+    }
+
+    for (const auto &resolver : mResolvers)
+    {
+        avahi_service_resolver_free(resolver.second);
+    }
+
+    mResolvers.clear();
+}
+
+void PublisherAvahi::ServiceSubscription::HandleBrowseResult(AvahiServiceBrowser *  aServiceBrowser,
+                                                             AvahiIfIndex           aInterfaceIndex,
+                                                             AvahiProtocol          aProtocol,
+                                                             AvahiBrowserEvent      aEvent,
+                                                             const char *           aName,
+                                                             const char *           aType,
+                                                             const char *           aDomain,
+                                                             AvahiLookupResultFlags aFlags,
+                                                             void *                 aContext)
+{
+    (void)aServiceBrowser;
+    (void)aType;
+    (void)aFlags;
+
+    static_cast<ServiceSubscription *>(aContext)->HandleBrowseResult(aInterfaceIndex, aProtocol, aEvent, aName,
+                                                                     aDomain);
+}
+
+void PublisherAvahi::ServiceSubscription::HandleBrowseResult(AvahiIfIndex      aInterfaceIndex,
+                                                             AvahiProtocol     aProtocol,
+                                                             AvahiBrowserEvent aEvent,
+                                                             const char *      aName,
+                                                             const char *      aDomain)
+{
+    switch (aEvent)
+    {
+    case AVAHI_BROWSER_NEW:
+        otbrLog(OTBR_LOG_DEBUG, "[mdns] browse service %s: %s added", mType.c_str(), aName);
+        AddResolver(aInterfaceIndex, aProtocol, aName, aDomain);
+        break;
+
+    case AVAHI_BROWSER_REMOVE:
+        otbrLog(OTBR_LOG_DEBUG, "[mdns] browse service %s: %s removed", mType.c_str(), aName);
+        RemoveResolver(aName);
+        break;
+
+    case AVAHI_BROWSER_FAILURE:
+        otbrLog(OTBR_LOG_WARNING, "[mdns] failed to browse service %s: %s", mType.c_str(),
+                avahi_strerror(avahi_client_errno(mPublisher.mClient)));
+        break;
+
+    case AVAHI_BROWSER_CACHE_EXHAUSTED:
+    case AVAHI_BROWSER_ALL_FOR_NOW:
+        break;
+    }
+}
+
+void PublisherAvahi::ServiceSubscription::AddResolver(AvahiIfIndex  aInterfaceIndex,
+                                                      AvahiProtocol aProtocol,
+                                                      const char *  aName,
+                                                      const char *  aDomain)
+{
+    AvahiServiceResolver *resolver;
+
+    // The same instance may be reported on several interfaces and protocols, resolving it once is enough.
+    VerifyOrExit(mResolvers.find(aName) == mResolvers.end());
+
+    resolver = avahi_service_resolver_new(mPublisher.mClient, aInterfaceIndex, aProtocol, aName, mType.c_str(),
+                                          aDomain, AVAHI_PROTO_INET6, static_cast<AvahiLookupFlags>(0),
+                                          HandleResolveResult, this);
+
+    if (resolver == nullptr)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[mdns] failed to resolve service %s.%s: %s", aName, mType.c_str(),
+                avahi_strerror(avahi_client_errno(mPublisher.mClient)));
+        ExitNow();
+    }
+
+    mResolvers[aName] = resolver;
+
+exit:
+    return;
+}
+
+void PublisherAvahi::ServiceSubscription::RemoveResolver(const char *aName)
+{
+    DiscoveredInstanceInfo instanceInfo;
+    Resolvers::iterator    it = mResolvers.find(aName);
+
+    VerifyOrExit(it != mResolvers.end());
+
+    avahi_service_resolver_free(it->second);
+    mResolvers.erase(it);
+
+    instanceInfo.mRemoved = true;
+    instanceInfo.mName    = aName;
+
+    // The handler may remove this subscription, pass a copy of the name and access nothing after it.
+    mPublisher.OnServiceResolved(std::string(mType), instanceInfo);
+
+exit:
+    return;
+}
+
+void PublisherAvahi::ServiceSubscription::HandleResolveResult(AvahiServiceResolver * aServiceResolver,
+                                                              AvahiIfIndex           aInterfaceIndex,
+                                                              AvahiProtocol          aProtocol,
+                                                              AvahiResolverEvent     aEvent,
+                                                              const char *           aName,
+                                                              const char *           aType,
+                                                              const char *           aDomain,
+                                                              const char *           aHostName,
+                                                              const AvahiAddress *   aAddress,
+                                                              uint16_t               aPort,
+                                                              AvahiStringList *      aTxt,
+                                                              AvahiLookupResultFlags aFlags,
+                                                              void *                 aContext)
+{
+    (void)aServiceResolver;
+    (void)aProtocol;
+    (void)aType;
+    (void)aDomain;
+    (void)aFlags;
+
+    static_cast<ServiceSubscription *>(aContext)->HandleResolveResult(aInterfaceIndex, aEvent, aName, aHostName,
+                                                                      aAddress, aPort, aTxt);
+}
+
+void PublisherAvahi::ServiceSubscription::HandleResolveResult(AvahiIfIndex        aInterfaceIndex,
+                                                              AvahiResolverEvent  aEvent,
+                                                              const char *        aName,
+                                                              const char *        aHostName,
+                                                              const AvahiAddress *aAddress,
+                                                              uint16_t            aPort,
+                                                              AvahiStringList *   aTxt)
+{
+    DiscoveredInstanceInfo instanceInfo;
+
+    if (aEvent != AVAHI_RESOLVER_FOUND)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[mdns] failed to resolve service %s.%s: %s", aName, mType.c_str(),
+                avahi_strerror(avahi_client_errno(mPublisher.mClient)));
+        ExitNow();
+    }
+
+    instanceInfo.mNetifIndex = static_cast<uint32_t>(aInterfaceIndex);
+    instanceInfo.mName       = aName;
+    // Avahi reports host names without the trailing dot.
+    instanceInfo.mHostName = std::string(aHostName) + ".";
+    instanceInfo.mPort     = aPort;
+    instanceInfo.mTtl      = kDefaultTtl;
+    CopyAddress(aAddress, instanceInfo.mAddresses);
+
+    for (AvahiStringList *entry = aTxt; entry != nullptr; entry = avahi_string_list_get_next(entry))
+    {
+        VerifyOrExit(entry->size <= UINT8_MAX);
+        instanceInfo.mTxtData.push_back(static_cast<uint8_t>(entry->size));
+        instanceInfo.mTxtData.insert(instanceInfo.mTxtData.end(), entry->text, entry->text + entry->size);
+    }
+
+    // The handler may remove this subscription, pass a copy of the name and access nothing after it.
+    mPublisher.OnServiceResolved(std::string(mType), instanceInfo);
+
+exit:
+    return;
+}
+
+PublisherAvahi::HostSubscription::HostSubscription(PublisherAvahi &aPublisher, const std::string &aHostName)
+    : mPublisher(aPublisher)
+    , mHostName(aHostName)
+    , mResolver(nullptr)
+{
+}
+
+void PublisherAvahi::HostSubscription::Resolve(void)
+{
+    std::string fullHostName = mHostName + "." + (mPublisher.mDomain == nullptr ? "local." : mPublisher.mDomain);
+
+    Release();
+
+    mResolver = avahi_host_name_resolver_new(mPublisher.mClient, AVAHI_IF_UNSPEC, AVAHI_PROTO_UNSPEC,
+                                             fullHostName.c_str(), AVAHI_PROTO_INET6,
+                                             static_cast<AvahiLookupFlags>(0), HandleResolveResult, this);
+
+    if (mResolver == nullptr)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[mdns] failed to resolve host %s: %s", fullHostName.c_str(),
+                avahi_strerror(avahi_client_errno(mPublisher.mClient)));
+    }
+}
+
+void PublisherAvahi::HostSubscription::Release(void)
+{
+    if (mResolver != nullptr)
+    {
+        avahi_host_name_resolver_free(mResolver);
+        mResolver = nullptr;
+    }
+}
+
+void PublisherAvahi::HostSubscription::HandleResolveResult(AvahiHostNameResolver *aHostNameResolver,
+                                                           AvahiIfIndex           aInterfaceIndex,
+                                                           AvahiProtocol          aProtocol,
+                                                           AvahiResolverEvent     aEvent,
+                                                           const char *           aHostName,
+                                                           const AvahiAddress *   aAddress,
+                                                           AvahiLookupResultFlags aFlags,
+                                                           void *                 aContext)
+{
+    (void)aHostNameResolver;
+    (void)aProtocol;
+    (void)aFlags;
+
+    static_cast<HostSubscription *>(aContext)->HandleResolveResult(aInterfaceIndex, aEvent, aHostName, aAddress);
+}
+
+void PublisherAvahi::HostSubscription::HandleResolveResult(AvahiIfIndex        aInterfaceIndex,
+                                                           AvahiResolverEvent  aEvent,
+                                                           const char *        aHostName,
+                                                           const AvahiAddress *aAddress)
+{
+    DiscoveredHostInfo hostInfo;
+
+    if (aEvent != AVAHI_RESOLVER_FOUND)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[mdns] failed to resolve host %s: %s", mHostName.c_str(),
+                avahi_strerror(avahi_client_errno(mPublisher.mClient)));
+        ExitNow();
+    }
+
+    hostInfo.mHostName   = std::string(aHostName) + ".";
+    hostInfo.mNetifIndex = static_cast<uint32_t>(aInterfaceIndex);
+    hostInfo.mTtl        = kDefaultTtl;
+    CopyAddress(aAddress, hostInfo.mAddresses);
+
+    // The handler may remove this subscription, pass a copy of the name and access nothing after it.
+    mPublisher.OnHostResolved(std::string(mHostName), hostInfo);
+
+exit:
+    return;
+}
+
+PublisherAvahi::Services::iterator PublisherAvahi::FindService(const char *aName, const char *aType)
+{
+    return std::find_if(mServices.begin(), mServices.end(), [aName, aType](const Service &aService) {
+        return !strncmp(aService.mName, aName, sizeof(aService.mName)) &&
+               !strncmp(aService.mType, aType, sizeof(aService.mType));
+    });
+}
+
+otbrError PublisherAvahi::MakeTxtList(const TxtList &   aTxtList,
+                                      AvahiStringList * aBuffer,
+                                      size_t            aBufferSize,
+                                      AvahiStringList *&aHead)
+{
+    otbrError        ret  = OTBR_ERROR_NONE;
     AvahiStringList *last = nullptr;
-    AvahiStringList *curr = buffer;
+    AvahiStringList *curr = aBuffer;
     size_t           used = 0;
 
-    VerifyOrExit(aHostName == nullptr, ret = OTBR_ERROR_NOT_IMPLEMENTED);
-    VerifyOrExit(mState == State::kReady, errno = EAGAIN);
-    VerifyOrExit(mGroup != nullptr, ret = OTBR_ERROR_MDNS);
-
     for (const auto &txtEntry : aTxtList)
     {
         const char *   name        = txtEntry.mName;
@@ -519,7 +1086,7 @@ otbrError PublisherAvahi::PublishService(const char *   aHostName,
         // +1 for the size of "=", avahi doesn't need '\0' at the end of the entry
         size_t needed = sizeof(AvahiStringList) - sizeof(AvahiStringList::text) + nameLength + valueLength + 1;
 
-        VerifyOrExit(used + needed <= sizeof(buffer), errno = EMSGSIZE);
+        VerifyOrExit(used + needed <= aBufferSize, ret = OTBR_ERROR_INVALID_ARGS);
         curr->next = last;
         last       = curr;
         memcpy(curr->text, name, nameLength);
@@ -530,37 +1097,69 @@ otbrError PublisherAvahi::PublishService(const char *   aHostName,
             const uint8_t *next = curr->text + curr->size;
             curr                = OTBR_ALIGNED(next, AvahiStringList *);
         }
-        used = static_cast<size_t>(reinterpret_cast<uint8_t *>(curr) - reinterpret_cast<uint8_t *>(buffer));
+        used = static_cast<size_t>(reinterpret_cast<uint8_t *>(curr) - reinterpret_cast<uint8_t *>(aBuffer));
     }
 
-    for (Services::iterator it = mServices.begin(); it != mServices.end(); ++it)
+    aHead = last;
+
+exit:
+    return ret;
+}
+
+otbrError PublisherAvahi::PublishService(const char *   aHostName,
+                                         uint16_t       aPort,
+                                         const char *   aName,
+                                         const char *   aType,
+                                         const TxtList &aTxtList)
+{
+    MemoryStats::Scope memoryScope(MemoryStats::kSubsystemMdns);
+
+    otbrError ret   = OTBR_ERROR_ERRNO;
+    int       error = 0;
+    // aligned with AvahiStringList
+    AvahiStringList    buffer[kMaxSizeOfTxtRecord / sizeof(AvahiStringList)];
+    AvahiStringList *  txtHead = nullptr;
+    Services::iterator service;
+
+    VerifyOrExit(aHostName == nullptr, ret = OTBR_ERROR_NOT_IMPLEMENTED);
+    VerifyOrExit(mState == State::kReady, errno = EAGAIN);
+    VerifyOrExit(mGroup != nullptr, ret = OTBR_ERROR_MDNS);
+
+    service = FindService(aName, aType);
+
+    if (service != mServices.end() && service->mPort == aPort)
     {
-        if (!strncmp(it->mName, aName, sizeof(it->mName)) && !strncmp(it->mType, aType, sizeof(it->mType)) &&
-            it->mPort == aPort)
-        {
-            otbrLog(OTBR_LOG_INFO, "MDNS update service %s", aName);
-            error = avahi_entry_group_update_service_txt_strlst(
-                mGroup, AVAHI_IF_UNSPEC, mProtocol, static_cast<AvahiPublishFlags>(0), aName, aType, mDomain, last);
-            SuccessOrExit(error);
-            ret = OTBR_ERROR_NONE;
-            ExitNow();
-        }
+        otbrLog(OTBR_LOG_INFO, "MDNS update service %s", aName);
+        ExitNow(ret = UpdateServiceTxt(aName, aType, aTxtList));
     }
 
+    VerifyOrExit(MakeTxtList(aTxtList, buffer, sizeof(buffer), txtHead) == OTBR_ERROR_NONE, errno = EMSGSIZE);
+
     otbrLog(OTBR_LOG_INFO, "MDNS create service %s", aName);
     error = avahi_entry_group_add_service_strlst(mGroup, AVAHI_IF_UNSPEC, mProtocol, static_cast<AvahiPublishFlags>(0),
-                                                 aName, aType, mDomain, aHostName, aPort, last);
+                                                 aName, aType, mDomain, aHostName, aPort, txtHead);
     SuccessOrExit(error);
 
     {
-        Service service;
-        strcpy_safe(service.mName, sizeof(service.mName), aName);
-        strcpy_safe(service.mType, sizeof(service.mType), aType);
-        service.mPort = aPort;
-        mServices.push_back(service);
+        Service newService;
+        strcpy_safe(newService.mName, sizeof(newService.mName), aName);
+        strcpy_safe(newService.mType, sizeof(newService.mType), aType);
+        newService.mPort = aPort;
+        mServices.push_back(newService);
     }
 
-    ret = OTBR_ERROR_NONE;
+    // The result is reported per entry group, and not at all for services added to an established group.
+    if (avahi_entry_group_get_state(mGroup) == AVAHI_ENTRY_GROUP_ESTABLISHED)
+    {
+        CountPublishResult(OTBR_ERROR_NONE);
+    }
+    else
+    {
+        StartPublication(MakeServiceKey(aName, aType));
+    }
+
+    // Outside a batch, commit the service right away.
+    ret = (mBatchDepth == 0) ? CommitGroup() : OTBR_ERROR_NONE;
 
 exit:
 
@@ -578,6 +1177,32 @@ exit:
     return ret;
 }
 
+otbrError PublisherAvahi::UpdateServiceTxt(const char *aName, const char *aType, const TxtList &aTxtList)
+{
+    otbrError ret   = OTBR_ERROR_NONE;
+    int       error = 0;
+    // aligned with AvahiStringList
+    AvahiStringList  buffer[kMaxSizeOfTxtRecord / sizeof(AvahiStringList)];
+    AvahiStringList *txtHead = nullptr;
+
+    VerifyOrExit(mGroup != nullptr && FindService(aName, aType) != mServices.end(), ret = OTBR_ERROR_NOT_FOUND);
+    SuccessOrExit(ret = MakeTxtList(aTxtList, buffer, sizeof(buffer), txtHead));
+
+    // Only the TXT record is replaced, avahi-daemon announces it without probing the service again.
+    error = avahi_entry_group_update_service_txt_strlst(mGroup, AVAHI_IF_UNSPEC, mProtocol,
+                                                        static_cast<AvahiPublishFlags>(0), aName, aType, mDomain,
+                                                        txtHead);
+
+exit:
+    if (error)
+    {
+        ret = OTBR_ERROR_MDNS;
+        otbrLog(OTBR_LOG_ERR, "Failed to update TXT of service %s: %s!", aName, avahi_strerror(error));
+    }
+
+    return ret;
+}
+
 otbrError PublisherAvahi::UnpublishService(const char *aName, const char *aType)
 {
     OTBR_UNUSED_VARIABLE(aName);
@@ -588,11 +1213,12 @@ otbrError PublisherAvahi::UnpublishService(const char *aName, const char *aType)
     return OTBR_ERROR_NONE;
 }
 
-otbrError PublisherAvahi::PublishHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength)
+otbrError PublisherAvahi::PublishHost(const char *aName, const AddressList &aAddresses)
 {
+    MemoryStats::Scope memoryScope(MemoryStats::kSubsystemMdns);
+
     OTBR_UNUSED_VARIABLE(aName);
-    OTBR_UNUSED_VARIABLE(aAddress);
-    OTBR_UNUSED_VARIABLE(aAddressLength);
+    OTBR_UNUSED_VARIABLE(aAddresses);
 
     VerifyOrDie(false, "PublishHost is not implemented with avahi");
 
@@ -34,9 +34,16 @@
 #ifndef OTBR_AGENT_MDNS_AVAHI_HPP_
 #define OTBR_AGENT_MDNS_AVAHI_HPP_
 
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
+#include <stddef.h>
+#include <stdint.h>
+
 #include <avahi-client/client.h>
+#include <avahi-client/lookup.h>
 #include <avahi-client/publish.h>
 #include <avahi-common/domain.h>
 #include <avahi-common/watch.h>
@@ -91,10 +98,13 @@ struct AvahiWatch
  */
 struct AvahiTimeout
 {
-    unsigned long        mTimeout;  ///< Absolute time when this timer timeout.
-    AvahiTimeoutCallback mCallback; ///< The function to be called when timeout.
-    void *               mContext;  ///< The pointer to application-specific context.
-    void *               mPoller;   ///< The poller created this timer.
+    static const size_t kNotScheduled = SIZE_MAX; ///< The heap index of a disabled timer.
+
+    unsigned long        mTimeout;   ///< Absolute time when this timer timeout, zero if disabled.
+    AvahiTimeoutCallback mCallback;  ///< The function to be called when timeout.
+    void *               mContext;   ///< The pointer to application-specific context.
+    void *               mPoller;    ///< The poller created this timer.
+    size_t               mHeapIndex; ///< The index in the timer heap of the poller.
 
     /**
      * The constructor to initialize an AvahiTimeout.
@@ -128,6 +138,8 @@ public:
     /**
      * This method updates the fd_set and timeout for mainloop.
      *
+     * The watched file descriptors are registered with `MainloopPoller`, only the timeout is updated here.
+     *
      * @param[inout]    aReadFdSet      A reference to fd_set for polling read.
      * @param[inout]    aWriteFdSet     A reference to fd_set for polling write.
      * @param[inout]    aErrorFdSet     A reference to fd_set for polling error.
@@ -156,7 +168,9 @@ public:
     const AvahiPoll *GetAvahiPoll(void) const { return &mAvahiPoller; }
 
 private:
-    typedef std::vector<AvahiWatch *>   Watches;
+    // Avahi may watch the same file descriptor for reading and writing through different watches.
+    typedef std::unordered_map<int, std::vector<AvahiWatch *>> Watches;
+    // A min-heap of the enabled timers, ordered by their timeout.
     typedef std::vector<AvahiTimeout *> Timers;
 
     static AvahiWatch *    WatchNew(const struct AvahiPoll *aPoller,
@@ -169,6 +183,8 @@ private:
     static AvahiWatchEvent WatchGetEvents(AvahiWatch *aWatch);
     static void            WatchFree(AvahiWatch *aWatch);
     void                   WatchFree(AvahiWatch &aWatch);
+    void                   UpdateWatchFd(int aFd);
+    void                   HandleWatch(AvahiWatch &aWatch, uint8_t aReadyEvents);
     static AvahiTimeout *  TimeoutNew(const AvahiPoll *     aPoller,
                                       const struct timeval *aTimeout,
                                       AvahiTimeoutCallback  aCallback,
@@ -177,6 +193,16 @@ private:
     static void            TimeoutUpdate(AvahiTimeout *aTimer, const struct timeval *aTimeout);
     static void            TimeoutFree(AvahiTimeout *aTimer);
     void                   TimeoutFree(AvahiTimeout &aTimer);
+    void                   ScheduleTimer(AvahiTimeout &aTimer);
+    void                   UnscheduleTimer(AvahiTimeout &aTimer);
+    void                   SiftUpTimer(size_t aIndex);
+    void                   SiftDownTimer(size_t aIndex);
+    void                   SwapTimers(size_t aIndex1, size_t aIndex2);
+    static bool            IsEarlier(const AvahiTimeout &aTimer1, const AvahiTimeout &aTimer2)
+    {
+        return static_cast<long>(aTimer1.mTimeout - aTimer2.mTimeout) < 0;
+    }
+    unsigned long GetEarliestTimeout(void) const { return mTimers.empty() ? 0 : mTimers.front()->mTimeout; }
 
     Watches   mWatches;
     Timers    mTimers;
@@ -237,21 +263,38 @@ public:
      */
     otbrError UnpublishService(const char *aName, const char *aType) override;
 
+    /**
+     * This method updates the TXT record of a published service.
+     *
+     * @param[in]   aName               The name of this service.
+     * @param[in]   aType               The type of this service.
+     * @param[in]   aTxtList            A list of TXT name/value pairs.
+     *
+     * @retval  OTBR_ERROR_NONE          Successfully updated the TXT record.
+     * @retval  OTBR_ERROR_NOT_FOUND     The service has not been published.
+     * @retval  OTBR_ERROR_INVALID_ARGS  The TXT record is too long.
+     * @retval  OTBR_ERROR_MDNS          Failed to update the TXT record.
+     *
+     */
+    otbrError UpdateServiceTxt(const char *aName, const char *aType, const TxtList &aTxtList) override;
+
+    using Publisher::PublishHost;
+
     /**
      * This method publishes or updates a host.
      *
-     * Publishing a host is advertising an AAAA RR for the host name. This method should be called
+     * Publishing a host is advertising an AAAA RR for each address of the host name. This method should be called
      * before a service with non-null host name is published.
      *
-     * @param[in]  aName           The name of the host.
-     * @param[in]  aAddress        The address of the host.
-     * @param[in]  aAddressLength  The length of @p aAddress.
+     * @param[in]  aName       The name of the host.
+     * @param[in]  aAddresses  The addresses of the host.
      *
-     * @retval  OTBR_ERROR_NONE     Successfully published or updated the host.
-     * @retval  OTBR_ERROR_ERRNO    Failed to publish or update the host.
+     * @retval  OTBR_ERROR_NONE          Successfully published or updated the host.
+     * @retval  OTBR_ERROR_INVALID_ARGS  The arguments are not valid.
+     * @retval  OTBR_ERROR_MDNS          Failed to publish or update the host.
      *
      */
-    otbrError PublishHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength) override;
+    otbrError PublishHost(const char *aName, const AddressList &aAddresses) override;
 
     /**
      * This method un-publishes a host.
@@ -266,6 +309,59 @@ public:
      */
     otbrError UnpublishHost(const char *aName) override;
 
+    /**
+     * This method starts a batch of publications.
+     *
+     * Services published within the batch are added to the entry group and committed by `CommitBatch()`.
+     *
+     */
+    void BeginBatch(void) override;
+
+    /**
+     * This method ends a batch of publications and commits the entry group.
+     *
+     * @retval  OTBR_ERROR_NONE  Successfully committed the entry group, or an outer batch is still open.
+     * @retval  OTBR_ERROR_MDNS  Failed to commit the entry group.
+     *
+     */
+    otbrError CommitBatch(void) override;
+
+    /**
+     * This method subscribes to a service type or a service instance.
+     *
+     * Subscriptions added before the avahi client is running are started once it is.
+     *
+     * @param[in]  aType          The service type, e.g. "_meshcop._udp".
+     * @param[in]  aInstanceName  The service instance name, or empty to browse all instances of @p aType.
+     *
+     */
+    void SubscribeService(const std::string &aType, const std::string &aInstanceName) override;
+
+    /**
+     * This method removes a subscription added by `SubscribeService()`.
+     *
+     * @param[in]  aType          The service type.
+     * @param[in]  aInstanceName  The service instance name, or empty.
+     *
+     */
+    void UnsubscribeService(const std::string &aType, const std::string &aInstanceName) override;
+
+    /**
+     * This method subscribes to the addresses of a host.
+     *
+     * @param[in]  aHostName  The host name, without the domain.
+     *
+     */
+    void SubscribeHost(const std::string &aHostName) override;
+
+    /**
+     * This method removes a subscription added by `SubscribeHost()`.
+     *
+     * @param[in]  aHostName  The host name, without the domain.
+     *
+     */
+    void UnsubscribeHost(const std::string &aHostName) override;
+
     /**
      * This method starts the MDNS service.
      *
@@ -324,6 +420,7 @@ private:
         kMaxSizeOfHost        = AVAHI_LABEL_MAX,
         kMaxSizeOfDomain      = AVAHI_LABEL_MAX,
         kMaxSizeOfServiceType = AVAHI_LABEL_MAX,
+        kDefaultTtl           = 120, ///< The avahi client API does not expose the TTL of discovered records.
     };
 
     struct Service
@@ -335,16 +432,123 @@ private:
 
     typedef std::vector<Service> Services;
 
+    // Browses a service type, or resolves a single instance when the instance name is given.
+    class ServiceSubscription
+    {
+    public:
+        ServiceSubscription(PublisherAvahi &aPublisher, const std::string &aType, const std::string &aInstanceName);
+        ~ServiceSubscription(void) { Release(); }
+
+        void Browse(void);
+        void Release(void);
+
+        PublisherAvahi &  mPublisher;
+        const std::string mType;
+        const std::string mInstanceName;
+
+    private:
+        typedef std::unordered_map<std::string, AvahiServiceResolver *> Resolvers;
+
+        static void HandleBrowseResult(AvahiServiceBrowser *  aServiceBrowser,
+                                       AvahiIfIndex           aInterfaceIndex,
+                                       AvahiProtocol          aProtocol,
+                                       AvahiBrowserEvent      aEvent,
+                                       const char *           aName,
+                                       const char *           aType,
+                                       const char *           aDomain,
+                                       AvahiLookupResultFlags aFlags,
+                                       void *                 aContext);
+        void        HandleBrowseResult(AvahiIfIndex      aInterfaceIndex,
+                                       AvahiProtocol     aProtocol,
+                                       AvahiBrowserEvent aEvent,
+                                       const char *      aName,
+                                       const char *      aDomain);
+        static void HandleResolveResult(AvahiServiceResolver * aServiceResolver,
+                                        AvahiIfIndex           aInterfaceIndex,
+                                        AvahiProtocol          aProtocol,
+                                        AvahiResolverEvent     aEvent,
+                                        const char *           aName,
+                                        const char *           aType,
+                                        const char *           aDomain,
+                                        const char *           aHostName,
+                                        const AvahiAddress *   aAddress,
+                                        uint16_t               aPort,
+                                        AvahiStringList *      aTxt,
+                                        AvahiLookupResultFlags aFlags,
+                                        void *                 aContext);
+        void        HandleResolveResult(AvahiIfIndex        aInterfaceIndex,
+                                        AvahiResolverEvent  aEvent,
+                                        const char *        aName,
+                                        const char *        aHostName,
+                                        const AvahiAddress *aAddress,
+                                        uint16_t            aPort,
+                                        AvahiStringList *   aTxt);
+        void        AddResolver(AvahiIfIndex  aInterfaceIndex,
+                                AvahiProtocol aProtocol,
+                                const char *  aName,
+                                const char *  aDomain);
+        void        RemoveResolver(const char *aName);
+
+        AvahiServiceBrowser *mBrowser;
+        Resolvers            mResolvers;
+    };
+
+    // Resolves the addresses of a host.
+    class HostSubscription
+    {
+    public:
+        HostSubscription(PublisherAvahi &aPublisher, const std::string &aHostName);
+        ~HostSubscription(void) { Release(); }
+
+        void Resolve(void);
+        void Release(void);
+
+        PublisherAvahi &  mPublisher;
+        const std::string mHostName;
+
+    private:
+        static void HandleResolveResult(AvahiHostNameResolver *aHostNameResolver,
+                                        AvahiIfIndex           aInterfaceIndex,
+                                        AvahiProtocol          aProtocol,
+                                        AvahiResolverEvent     aEvent,
+                                        const char *           aHostName,
+                                        const AvahiAddress *   aAddress,
+                                        AvahiLookupResultFlags aFlags,
+                                        void *                 aContext);
+        void        HandleResolveResult(AvahiIfIndex        aInterfaceIndex,
+                                        AvahiResolverEvent  aEvent,
+                                        const char *        aHostName,
+                                        const AvahiAddress *aAddress);
+
+        AvahiHostNameResolver *mResolver;
+    };
+
+    typedef std::vector<std::unique_ptr<ServiceSubscription>> ServiceSubscriptions;
+    typedef std::vector<std::unique_ptr<HostSubscription>>    HostSubscriptions;
+
     static void HandleClientState(AvahiClient *aClient, AvahiClientState aState, void *aContext);
     void        HandleClientState(AvahiClient *aClient, AvahiClientState aState);
 
     void        CreateGroup(AvahiClient *aClient);
     static void HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupState aState, void *aContext);
     void        HandleGroupState(AvahiEntryGroup *aGroup, AvahiEntryGroupState aState);
+    otbrError   CommitGroup(void);
+
+    Services::iterator FindService(const char *aName, const char *aType);
+    static otbrError   MakeTxtList(const TxtList &   aTxtList,
+                                   AvahiStringList * aBuffer,
+                                   size_t            aBufferSize,
+                                   AvahiStringList *&aHead);
+    void               StartSubscriptions(void);
+    void               ReleaseSubscriptions(void);
+
+    ServiceSubscriptions mSubscribedServices;
+    HostSubscriptions    mSubscribedHosts;
 
     Services         mServices;
     AvahiClient *    mClient;
     AvahiEntryGroup *mGroup;
+    uint16_t         mBatchDepth;
     Poller           mPoller;
     int              mProtocol;
     const char *     mDomain;
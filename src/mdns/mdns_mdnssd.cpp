@@ -38,12 +38,15 @@
 #include <arpa/inet.h>
 #include <assert.h>
 #include <errno.h>
+#include <netinet/in.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/memory_stats.hpp"
+#include "common/metrics.hpp"
 #include "common/time.hpp"
 #include "utils/strcpy_utils.hpp"
 
@@ -235,17 +238,27 @@ void PublisherMDnsSd::Stop(void)
 {
     VerifyOrExit(mState == State::kReady);
 
-    for (Service &service : mServices)
+    for (auto &entry : mServices)
     {
+        Service &service = entry.second;
+
         otbrLog(OTBR_LOG_INFO, "[mdns] remove service %s.%s", service.mName, service.mType);
         DNSServiceRefDeallocate(service.mService);
     }
     mServices.clear();
+    mServiceKeys.clear();
 
     otbrLog(OTBR_LOG_INFO, "[mdns] remove all hosts");
     DNSServiceRefDeallocate(mHostsRef);
     mHostsRef = nullptr;
     mHosts.clear();
+    mHostNames.clear();
+    CancelPublications();
+
+    otbrLog(OTBR_LOG_INFO, "[mdns] remove all subscriptions");
+    mSubscribedServices.clear();
+    mSubscribedHosts.clear();
+    mReleasedRefs.clear();
 
 exit:
     return;
@@ -257,12 +270,29 @@ void PublisherMDnsSd::UpdateFdSet(fd_set & aReadFdSet,
                                   int &    aMaxFd,
                                   timeval &aTimeout)
 {
+    MemoryStats::Scope memoryScope(MemoryStats::kSubsystemMdns);
+
     (void)aWriteFdSet;
     (void)aErrorFdSet;
     (void)aTimeout;
 
-    for (Service &service : mServices)
+    // No callback is running now, it is safe to free the released subscriptions.
+    mReleasedRefs.clear();
+
+    for (const auto &subscription : mSubscribedServices)
     {
+        subscription->UpdateFdSet(aReadFdSet, aMaxFd);
+    }
+
+    for (const auto &subscription : mSubscribedHosts)
+    {
+        subscription->UpdateFdSet(aReadFdSet, aMaxFd);
+    }
+
+    for (const auto &entry : mServices)
+    {
+        const Service &service = entry.second;
+
         assert(service.mService != nullptr);
 
         int fd = DNSServiceRefSockFD(service.mService);
@@ -294,18 +324,34 @@ void PublisherMDnsSd::UpdateFdSet(fd_set & aReadFdSet,
 
 void PublisherMDnsSd::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSet, const fd_set &aErrorFdSet)
 {
-    std::vector<DNSServiceRef> readyServices;
+    MemoryStats::Scope memoryScope(MemoryStats::kSubsystemMdns);
+
+    std::vector<DNSServiceRef>                          readyServices;
+    std::vector<std::pair<ServiceRef *, DNSServiceRef>> readyRefs;
 
     (void)aWriteFdSet;
     (void)aErrorFdSet;
 
-    for (Service &service : mServices)
+    for (const auto &subscription : mSubscribedServices)
     {
-        int fd = DNSServiceRefSockFD(service.mService);
+        subscription->GetReadyRefs(aReadFdSet, readyRefs);
+    }
+
+    for (const auto &subscription : mSubscribedHosts)
+    {
+        if (subscription->IsReady(aReadFdSet))
+        {
+            readyRefs.emplace_back(subscription.get(), subscription->mServiceRef);
+        }
+    }
+
+    for (const auto &entry : mServices)
+    {
+        int fd = DNSServiceRefSockFD(entry.second.mService);
 
         if (FD_ISSET(fd, &aReadFdSet))
         {
-            readyServices.push_back(service.mService);
+            readyServices.push_back(entry.second.mService);
         }
     }
 
@@ -328,6 +374,496 @@ void PublisherMDnsSd::Process(const fd_set &aReadFdSet, const fd_set &aWriteFdSe
             otbrLog(OTBR_LOG_WARNING, "[mdns] DNSServiceProcessResult failed: %s", DNSErrorToString(error));
         }
     }
+
+    for (const auto &readyRef : readyRefs)
+    {
+        DNSServiceErrorType error;
+
+        // A callback may have released or restarted the service ref of another subscription. Released
+        // subscriptions are still alive until the next `UpdateFdSet()`, so it is safe to check them.
+        if (readyRef.first->mServiceRef != readyRef.second)
+        {
+            continue;
+        }
+
+        error = DNSServiceProcessResult(readyRef.second);
+
+        if (error != kDNSServiceErr_NoError)
+        {
+            otbrLog(OTBR_LOG_WARNING, "[mdns] DNSServiceProcessResult failed: %s", DNSErrorToString(error));
+        }
+    }
+}
+
+void PublisherMDnsSd::SubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    mSubscribedServices.emplace_back(new ServiceSubscription(*this, aType, aInstanceName));
+    mSubscribedServices.back()->Start();
+
+    otbrLog(OTBR_LOG_INFO, "[mdns] subscribe service %s.%s (total %zu)", aInstanceName.c_str(), aType.c_str(),
+            mSubscribedServices.size());
+}
+
+void PublisherMDnsSd::UnsubscribeService(const std::string &aType, const std::string &aInstanceName)
+{
+    ServiceSubscriptions::iterator it =
+        std::find_if(mSubscribedServices.begin(), mSubscribedServices.end(),
+                     [&aType, &aInstanceName](const std::unique_ptr<ServiceSubscription> &aSubscription) {
+                         return aSubscription->mType == aType && aSubscription->mInstanceName == aInstanceName;
+                     });
+
+    VerifyOrExit(it != mSubscribedServices.end());
+
+    (*it)->Stop();
+    ReleaseLater(std::move(*it));
+    mSubscribedServices.erase(it);
+
+    otbrLog(OTBR_LOG_INFO, "[mdns] unsubscribe service %s.%s (left %zu)", aInstanceName.c_str(), aType.c_str(),
+            mSubscribedServices.size());
+
+exit:
+    return;
+}
+
+void PublisherMDnsSd::SubscribeHost(const std::string &aHostName)
+{
+    mSubscribedHosts.emplace_back(new HostSubscription(*this, aHostName));
+    mSubscribedHosts.back()->Resolve();
+
+    otbrLog(OTBR_LOG_INFO, "[mdns] subscribe host %s (total %zu)", aHostName.c_str(), mSubscribedHosts.size());
+}
+
+void PublisherMDnsSd::UnsubscribeHost(const std::string &aHostName)
+{
+    HostSubscriptions::iterator it = std::find_if(mSubscribedHosts.begin(), mSubscribedHosts.end(),
+                                                  [&aHostName](const std::unique_ptr<HostSubscription> &aSubscription) {
+                                                      return aSubscription->mHostName == aHostName;
+                                                  });
+
+    VerifyOrExit(it != mSubscribedHosts.end());
+
+    (*it)->Release();
+    ReleaseLater(std::move(*it));
+    mSubscribedHosts.erase(it);
+
+    otbrLog(OTBR_LOG_INFO, "[mdns] unsubscribe host %s (left %zu)", aHostName.c_str(), mSubscribedHosts.size());
+
+exit:
+    return;
+}
+
+void PublisherMDnsSd::ReleaseLater(std::unique_ptr<ServiceRef> aServiceRef)
+{
+    mReleasedRefs.push_back(std::move(aServiceRef));
+}
+
+void PublisherMDnsSd::ServiceRef::Release(void)
+{
+    if (mServiceRef != nullptr)
+    {
+        DNSServiceRefDeallocate(mServiceRef);
+        mServiceRef = nullptr;
+    }
+}
+
+void PublisherMDnsSd::ServiceRef::UpdateFdSet(fd_set &aReadFdSet, int &aMaxFd) const
+{
+    int fd;
+
+    VerifyOrExit(mServiceRef != nullptr);
+
+    fd = DNSServiceRefSockFD(mServiceRef);
+    assert(fd != -1);
+
+    FD_SET(fd, &aReadFdSet);
+    aMaxFd = std::max(aMaxFd, fd);
+
+exit:
+    return;
+}
+
+bool PublisherMDnsSd::ServiceRef::IsReady(const fd_set &aReadFdSet) const
+{
+    return mServiceRef != nullptr && FD_ISSET(DNSServiceRefSockFD(mServiceRef), &aReadFdSet);
+}
+
+PublisherMDnsSd::ServiceSubscription::ServiceSubscription(PublisherMDnsSd &  aPublisher,
+                                                          const std::string &aType,
+                                                          const std::string &aInstanceName)
+    : mPublisher(aPublisher)
+    , mType(aType)
+    , mInstanceName(aInstanceName)
+{
+}
+
+void PublisherMDnsSd::ServiceSubscription::Start(void)
+{
+    DNSServiceErrorType error;
+
+    if (!mInstanceName.empty())
+    {
+        AddResolution(mInstanceName, mPublisher.GetDomain(), kDNSServiceInterfaceIndexAny);
+        ExitNow();
+    }
+
+    error = DNSServiceBrowse(&mServiceRef, /* flags */ 0, kDNSServiceInterfaceIndexAny, mType.c_str(),
+                             mPublisher.GetDomain(), HandleBrowseResult, this);
+
+    if (error != kDNSServiceErr_NoError)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[mdns] failed to browse service %s: %s", mType.c_str(), DNSErrorToString(error));
+        mServiceRef = nullptr;
+    }
+
+exit:
+    return;
+}
+
+void PublisherMDnsSd::ServiceSubscription::Stop(void)
+{
+    Release();
+
+    for (const auto &resolution : mResolutions)
+    {
+        resolution->Release();
+    }
+}
+
+void PublisherMDnsSd::ServiceSubscription::UpdateFdSet(fd_set &aReadFdSet, int &aMaxFd) const
+{
+    ServiceRef::UpdateFdSet(aReadFdSet, aMaxFd);
+
+    for (const auto &resolution : mResolutions)
+    {
+        resolution->UpdateFdSet(aReadFdSet, aMaxFd);
+    }
+}
+
+void PublisherMDnsSd::ServiceSubscription::GetReadyRefs(const fd_set &                                       aReadFdSet,
+                                                        std::vector<std::pair<ServiceRef *, DNSServiceRef>> &aRefs)
+{
+    if (IsReady(aReadFdSet))
+    {
+        aRefs.emplace_back(this, mServiceRef);
+    }
+
+    for (const auto &resolution : mResolutions)
+    {
+        if (resolution->IsReady(aReadFdSet))
+        {
+            aRefs.emplace_back(resolution.get(), resolution->mServiceRef);
+        }
+    }
+}
+
+void PublisherMDnsSd::ServiceSubscription::HandleBrowseResult(DNSServiceRef       aServiceRef,
+                                                              DNSServiceFlags     aFlags,
+                                                              uint32_t            aInterfaceIndex,
+                                                              DNSServiceErrorType aErrorCode,
+                                                              const char *        aInstanceName,
+                                                              const char *        aType,
+                                                              const char *        aDomain,
+                                                              void *              aContext)
+{
+    (void)aServiceRef;
+    (void)aType;
+
+    static_cast<ServiceSubscription *>(aContext)->HandleBrowseResult(aFlags, aInterfaceIndex, aErrorCode,
+                                                                     aInstanceName, aDomain);
+}
+
+void PublisherMDnsSd::ServiceSubscription::HandleBrowseResult(DNSServiceFlags     aFlags,
+                                                              uint32_t            aInterfaceIndex,
+                                                              DNSServiceErrorType aErrorCode,
+                                                              const char *        aInstanceName,
+                                                              const char *        aDomain)
+{
+    if (aErrorCode != kDNSServiceErr_NoError)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[mdns] failed to browse service %s: %s", mType.c_str(),
+                DNSErrorToString(aErrorCode));
+        Release();
+        ExitNow();
+    }
+
+    otbrLog(OTBR_LOG_DEBUG, "[mdns] browse service %s: %s %s", mType.c_str(), aInstanceName,
+            (aFlags & kDNSServiceFlagsAdd) ? "added" : "removed");
+
+    if (aFlags & kDNSServiceFlagsAdd)
+    {
+        AddResolution(aInstanceName, aDomain, aInterfaceIndex);
+    }
+    else
+    {
+        RemoveResolution(aInstanceName);
+    }
+
+exit:
+    return;
+}
+
+void PublisherMDnsSd::ServiceSubscription::AddResolution(const std::string &aInstanceName,
+                                                         const std::string &aDomain,
+                                                         uint32_t           aNetifIndex)
+{
+    // The same instance may be reported on several interfaces, resolving it once is enough.
+    for (const auto &resolution : mResolutions)
+    {
+        VerifyOrExit(resolution->GetInstanceName() != aInstanceName);
+    }
+
+    mResolutions.emplace_back(new ServiceInstanceResolution(*this, aInstanceName, aDomain, aNetifIndex));
+    mResolutions.back()->Resolve();
+
+exit:
+    return;
+}
+
+void PublisherMDnsSd::ServiceSubscription::RemoveResolution(const std::string &aInstanceName)
+{
+    DiscoveredInstanceInfo instanceInfo;
+
+    auto it = std::find_if(mResolutions.begin(), mResolutions.end(),
+                           [&aInstanceName](const std::unique_ptr<ServiceInstanceResolution> &aResolution) {
+                               return aResolution->GetInstanceName() == aInstanceName;
+                           });
+
+    VerifyOrExit(it != mResolutions.end());
+
+    (*it)->Release();
+    mPublisher.ReleaseLater(std::move(*it));
+    mResolutions.erase(it);
+
+    instanceInfo.mRemoved = true;
+    instanceInfo.mName    = aInstanceName;
+
+    // The handler may remove this subscription, nothing should be accessed after it.
+    mPublisher.OnServiceResolved(mType, instanceInfo);
+
+exit:
+    return;
+}
+
+void PublisherMDnsSd::ServiceSubscription::HandleInstanceResolved(const DiscoveredInstanceInfo &aInstanceInfo)
+{
+    mPublisher.OnServiceResolved(mType, aInstanceInfo);
+}
+
+PublisherMDnsSd::ServiceInstanceResolution::ServiceInstanceResolution(ServiceSubscription &aSubscription,
+                                                                      const std::string &  aInstanceName,
+                                                                      const std::string &  aDomain,
+                                                                      uint32_t             aNetifIndex)
+    : mSubscription(aSubscription)
+    , mDomain(aDomain)
+{
+    mInstanceInfo.mName       = aInstanceName;
+    mInstanceInfo.mNetifIndex = aNetifIndex;
+}
+
+void PublisherMDnsSd::ServiceInstanceResolution::Resolve(void)
+{
+    DNSServiceErrorType error;
+
+    Release();
+
+    error = DNSServiceResolve(&mServiceRef, /* flags */ 0, mInstanceInfo.mNetifIndex, mInstanceInfo.mName.c_str(),
+                              mSubscription.mType.c_str(), mDomain.c_str(), HandleResolveResult, this);
+
+    if (error != kDNSServiceErr_NoError)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[mdns] failed to resolve service %s.%s: %s", mInstanceInfo.mName.c_str(),
+                mSubscription.mType.c_str(), DNSErrorToString(error));
+        mServiceRef = nullptr;
+    }
+}
+
+void PublisherMDnsSd::ServiceInstanceResolution::HandleResolveResult(DNSServiceRef        aServiceRef,
+                                                                     DNSServiceFlags      aFlags,
+                                                                     uint32_t             aInterfaceIndex,
+                                                                     DNSServiceErrorType  aErrorCode,
+                                                                     const char *         aFullName,
+                                                                     const char *         aHostTarget,
+                                                                     uint16_t             aPort,
+                                                                     uint16_t             aTxtLength,
+                                                                     const unsigned char *aTxtRecord,
+                                                                     void *               aContext)
+{
+    (void)aServiceRef;
+    (void)aFullName;
+
+    static_cast<ServiceInstanceResolution *>(aContext)->HandleResolveResult(aFlags, aInterfaceIndex, aErrorCode,
+                                                                            aHostTarget, aPort, aTxtLength, aTxtRecord);
+}
+
+void PublisherMDnsSd::ServiceInstanceResolution::HandleResolveResult(DNSServiceFlags      aFlags,
+                                                                     uint32_t             aInterfaceIndex,
+                                                                     DNSServiceErrorType  aErrorCode,
+                                                                     const char *         aHostTarget,
+                                                                     uint16_t             aPort,
+                                                                     uint16_t             aTxtLength,
+                                                                     const unsigned char *aTxtRecord)
+{
+    DNSServiceErrorType error;
+
+    (void)aFlags;
+
+    if (aErrorCode != kDNSServiceErr_NoError)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[mdns] failed to resolve service %s.%s: %s", mInstanceInfo.mName.c_str(),
+                mSubscription.mType.c_str(), DNSErrorToString(aErrorCode));
+        Release();
+        ExitNow();
+    }
+
+    // The reply buffer is freed together with the service ref, copy everything before releasing it.
+    mInstanceInfo.mNetifIndex = aInterfaceIndex;
+    mInstanceInfo.mHostName   = aHostTarget;
+    mInstanceInfo.mPort       = ntohs(aPort);
+    mInstanceInfo.mTxtData.assign(aTxtRecord, aTxtRecord + aTxtLength);
+    mInstanceInfo.mAddresses.clear();
+
+    Release();
+
+    error = DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, aInterfaceIndex, kDNSServiceProtocol_IPv6,
+                                  mInstanceInfo.mHostName.c_str(), HandleGetAddrInfoResult, this);
+
+    if (error != kDNSServiceErr_NoError)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[mdns] failed to resolve host %s: %s", mInstanceInfo.mHostName.c_str(),
+                DNSErrorToString(error));
+        mServiceRef = nullptr;
+    }
+
+exit:
+    return;
+}
+
+void PublisherMDnsSd::ServiceInstanceResolution::HandleGetAddrInfoResult(DNSServiceRef          aServiceRef,
+                                                                         DNSServiceFlags        aFlags,
+                                                                         uint32_t               aInterfaceIndex,
+                                                                         DNSServiceErrorType    aErrorCode,
+                                                                         const char *           aHostName,
+                                                                         const struct sockaddr *aAddress,
+                                                                         uint32_t               aTtl,
+                                                                         void *                 aContext)
+{
+    (void)aServiceRef;
+    (void)aInterfaceIndex;
+    (void)aHostName;
+
+    static_cast<ServiceInstanceResolution *>(aContext)->HandleGetAddrInfoResult(aFlags, aErrorCode, aAddress, aTtl);
+}
+
+static void UpdateAddresses(std::vector<Ip6Address> &aAddresses, bool aAdded, const struct sockaddr &aAddress)
+{
+    Ip6Address address(reinterpret_cast<const ::sockaddr_in6 &>(aAddress).sin6_addr.s6_addr);
+    auto       it = std::find(aAddresses.begin(), aAddresses.end(), address);
+
+    if (aAdded && it == aAddresses.end())
+    {
+        aAddresses.push_back(address);
+    }
+    else if (!aAdded && it != aAddresses.end())
+    {
+        aAddresses.erase(it);
+    }
+}
+
+void PublisherMDnsSd::ServiceInstanceResolution::HandleGetAddrInfoResult(DNSServiceFlags        aFlags,
+                                                                         DNSServiceErrorType    aErrorCode,
+                                                                         const struct sockaddr *aAddress,
+                                                                         uint32_t               aTtl)
+{
+    if (aErrorCode != kDNSServiceErr_NoError)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[mdns] failed to resolve host %s: %s", mInstanceInfo.mHostName.c_str(),
+                DNSErrorToString(aErrorCode));
+        Release();
+        ExitNow();
+    }
+
+    VerifyOrExit(aAddress->sa_family == AF_INET6);
+
+    UpdateAddresses(mInstanceInfo.mAddresses, aFlags & kDNSServiceFlagsAdd, *aAddress);
+    mInstanceInfo.mTtl = aTtl;
+
+    // Wait for all addresses of this batch before reporting the instance.
+    VerifyOrExit(!(aFlags & kDNSServiceFlagsMoreComing));
+
+    mSubscription.HandleInstanceResolved(mInstanceInfo);
+
+exit:
+    return;
+}
+
+PublisherMDnsSd::HostSubscription::HostSubscription(PublisherMDnsSd &aPublisher, const std::string &aHostName)
+    : mPublisher(aPublisher)
+    , mHostName(aHostName)
+{
+    mHostInfo.mHostName = mHostName + "." + mPublisher.GetDomain();
+}
+
+void PublisherMDnsSd::HostSubscription::Resolve(void)
+{
+    DNSServiceErrorType error;
+
+    Release();
+
+    error = DNSServiceGetAddrInfo(&mServiceRef, /* flags */ 0, kDNSServiceInterfaceIndexAny, kDNSServiceProtocol_IPv6,
+                                  mHostInfo.mHostName.c_str(), HandleResolveResult, this);
+
+    if (error != kDNSServiceErr_NoError)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[mdns] failed to resolve host %s: %s", mHostInfo.mHostName.c_str(),
+                DNSErrorToString(error));
+        mServiceRef = nullptr;
+    }
+}
+
+void PublisherMDnsSd::HostSubscription::HandleResolveResult(DNSServiceRef          aServiceRef,
+                                                            DNSServiceFlags        aFlags,
+                                                            uint32_t               aInterfaceIndex,
+                                                            DNSServiceErrorType    aErrorCode,
+                                                            const char *           aHostName,
+                                                            const struct sockaddr *aAddress,
+                                                            uint32_t               aTtl,
+                                                            void *                 aContext)
+{
+    (void)aServiceRef;
+
+    static_cast<HostSubscription *>(aContext)->HandleResolveResult(aFlags, aInterfaceIndex, aErrorCode, aHostName,
+                                                                   aAddress, aTtl);
+}
+
+void PublisherMDnsSd::HostSubscription::HandleResolveResult(DNSServiceFlags        aFlags,
+                                                            uint32_t               aInterfaceIndex,
+                                                            DNSServiceErrorType    aErrorCode,
+                                                            const char *           aHostName,
+                                                            const struct sockaddr *aAddress,
+                                                            uint32_t               aTtl)
+{
+    (void)aHostName;
+
+    if (aErrorCode != kDNSServiceErr_NoError)
+    {
+        otbrLog(OTBR_LOG_WARNING, "[mdns] failed to resolve host %s: %s", mHostInfo.mHostName.c_str(),
+                DNSErrorToString(aErrorCode));
+        Release();
+        ExitNow();
+    }
+
+    VerifyOrExit(aAddress->sa_family == AF_INET6);
+
+    UpdateAddresses(mHostInfo.mAddresses, aFlags & kDNSServiceFlagsAdd, *aAddress);
+    mHostInfo.mNetifIndex = aInterfaceIndex;
+    mHostInfo.mTtl        = aTtl;
+
+    VerifyOrExit(!(aFlags & kDNSServiceFlagsMoreComing));
+
+    mPublisher.OnHostResolved(mHostName, mHostInfo);
+
+exit:
+    return;
 }
 
 void PublisherMDnsSd::HandleServiceRegisterResult(DNSServiceRef         aService,
@@ -360,7 +896,7 @@ void PublisherMDnsSd::HandleServiceRegisterResult(DNSServiceRef         aService
     // mDNSResponder could auto-rename the service instance name when name conflict
     // is detected. In this case, `aName` may not match `service->mName` and we
     // should use the original `service->mName` to find associated SRP service.
-    originalInstanceName = service->mName;
+    originalInstanceName = service->second.mName;
 
     otbrLog(OTBR_LOG_INFO, "[mdns] received reply for service %s.%s", originalInstanceName.c_str(), aType);
 
@@ -368,8 +904,11 @@ void PublisherMDnsSd::HandleServiceRegisterResult(DNSServiceRef         aService
     {
         otbrLog(OTBR_LOG_INFO, "[mdns] service %s.%s renamed to %s.%s", originalInstanceName.c_str(), aType, aName,
                 aType);
+        Metrics::Get().Increment(Metrics::kCounterMdnsNameConflicts);
     }
 
+    FinishPublication(MakeServiceKey(originalInstanceName.c_str(), aType), error);
+
     if (aError == kDNSServiceErr_NoError)
     {
         otbrLog(OTBR_LOG_INFO, "[mdns] successfully registered service %s.%s", originalInstanceName.c_str(), aType);
@@ -405,18 +944,21 @@ void PublisherMDnsSd::DiscardService(const char *aName, const char *aType, DNSSe
 
     if (service != mServices.end())
     {
-        assert(aServiceRef == nullptr || aServiceRef == service->mService);
+        assert(aServiceRef == nullptr || aServiceRef == service->second.mService);
 
-        otbrLog(OTBR_LOG_INFO, "[mdns] remove service ref %p", service->mService);
+        otbrLog(OTBR_LOG_INFO, "[mdns] remove service ref %p", service->second.mService);
 
-        DNSServiceRefDeallocate(service->mService);
+        DNSServiceRefDeallocate(service->second.mService);
+        CancelPublication(service->first);
+        mServiceKeys.erase(service->second.mService);
         mServices.erase(service);
     }
 }
 
 void PublisherMDnsSd::RecordService(const char *aName, const char *aType, DNSServiceRef aServiceRef)
 {
-    ServiceIterator service = FindPublishedService(aName, aType);
+    std::string     key     = MakeServiceKey(aName, aType);
+    ServiceIterator service = mServices.find(key);
 
     if (service == mServices.end())
     {
@@ -427,11 +969,12 @@ void PublisherMDnsSd::RecordService(const char *aName, const char *aType, DNSSer
         strcpy(newService.mName, aName);
         strcpy(newService.mType, aType);
         newService.mService = aServiceRef;
-        mServices.push_back(newService);
+        mServiceKeys.emplace(aServiceRef, key);
+        mServices.emplace(std::move(key), newService);
     }
     else
     {
-        assert(service->mService == aServiceRef);
+        assert(service->second.mService == aServiceRef);
     }
 }
 
@@ -441,6 +984,8 @@ otbrError PublisherMDnsSd::PublishService(const char *   aHostName,
                                           const char *   aType,
                                           const TxtList &aTxtList)
 {
+    MemoryStats::Scope memoryScope(MemoryStats::kSubsystemMdns);
+
     otbrError       ret   = OTBR_ERROR_NONE;
     int             error = 0;
     uint8_t         txt[kMaxSizeOfTxtRecord];
@@ -458,26 +1003,26 @@ otbrError PublisherMDnsSd::PublishService(const char *   aHostName,
         SuccessOrExit(error = MakeFullName(fullHostName, sizeof(fullHostName), aHostName));
     }
 
-    SuccessOrExit(ret = EncodeTxtData(aTxtList, txt, txtLength));
-
     if (service != mServices.end())
     {
         otbrLog(OTBR_LOG_INFO, "[mdns] update service %s.%s", aName, aType);
 
-        // Setting TTL to 0 to use default value.
-        SuccessOrExit(error = DNSServiceUpdateRecord(service->mService, nullptr, 0, txtLength, txt, /* ttl */ 0));
+        SuccessOrExit(ret = UpdateServiceTxt(aName, aType, aTxtList));
 
+        CountPublishResult(ret);
         if (mServiceHandler != nullptr)
         {
-            mServiceHandler(aName, aType, DNSErrorToOtbrError(error), mServiceHandlerContext);
+            mServiceHandler(aName, aType, ret, mServiceHandlerContext);
         }
     }
     else
     {
+        SuccessOrExit(ret = EncodeTxtData(aTxtList, txt, txtLength));
         SuccessOrExit(error = DNSServiceRegister(&serviceRef, /* flags */ 0, kDNSServiceInterfaceIndexAny, aName, aType,
                                                  mDomain, (aHostName != nullptr) ? fullHostName : nullptr, htons(aPort),
                                                  txtLength, txt, HandleServiceRegisterResult, this));
         RecordService(aName, aType, serviceRef);
+        StartPublication(MakeServiceKey(aName, aType));
     }
 
 exit:
@@ -489,6 +1034,31 @@ exit:
     return ret;
 }
 
+otbrError PublisherMDnsSd::UpdateServiceTxt(const char *aName, const char *aType, const TxtList &aTxtList)
+{
+    otbrError       ret   = OTBR_ERROR_NONE;
+    int             error = 0;
+    uint8_t         txt[kMaxSizeOfTxtRecord];
+    uint16_t        txtLength = sizeof(txt);
+    ServiceIterator service   = FindPublishedService(aName, aType);
+
+    VerifyOrExit(service != mServices.end(), ret = OTBR_ERROR_NOT_FOUND);
+    SuccessOrExit(ret = EncodeTxtData(aTxtList, txt, txtLength));
+
+    // Updating the primary TXT record of the registration announces it without re-probing.
+    // Setting TTL to 0 to use default value.
+    error = DNSServiceUpdateRecord(service->second.mService, nullptr, 0, txtLength, txt, /* ttl */ 0);
+
+exit:
+    if (error != kDNSServiceErr_NoError)
+    {
+        ret = OTBR_ERROR_MDNS;
+        otbrLog(OTBR_LOG_ERR, "[mdns] failed to update TXT of service %s.%s: %s!", aName, aType,
+                DNSErrorToString(error));
+    }
+    return ret;
+}
+
 otbrError PublisherMDnsSd::UnpublishService(const char *aName, const char *aType)
 {
     DiscardService(aName, aType);
@@ -503,22 +1073,20 @@ otbrError PublisherMDnsSd::DiscardHost(const char *aName, bool aSendGoodbye)
 
     VerifyOrExit(mHostsRef != nullptr && host != mHosts.end());
 
-    otbrLog(OTBR_LOG_INFO, "[mdns] remove host: %s (record ref: %p)", host->mName, host->mRecord);
+    otbrLog(OTBR_LOG_INFO, "[mdns] remove host: %s (%zu addresses)", host->second.mName,
+            host->second.mAddresses.size());
 
-    if (aSendGoodbye)
+    for (HostAddress &hostAddress : host->second.mAddresses)
     {
-        // The Bonjour mDNSResponder somehow doesn't send goodbye message for the AAAA record when it is
-        // removed by `DNSServiceRemoveRecord`. Per RFC 6762, a goodbye message of a record sets its TTL
-        // to zero but the receiver should record the TTL of 1 and flushes the cache 1 second later. Here
-        // we remove the AAAA record after updating its TTL to 1 second. This has the same effect as
-        // sending a goodbye message.
-        // TODO: resolve the goodbye issue with Bonjour mDNSResponder.
-        error = DNSServiceUpdateRecord(mHostsRef, host->mRecord, kDNSServiceFlagsUnique, host->mAddress.size(),
-                                       &host->mAddress.front(), /* ttl */ 1);
-        // Do not SuccessOrExit so that we always erase the host entry.
+        int removeError = RemoveHostAddress(hostAddress, aSendGoodbye);
 
-        DNSServiceRemoveRecord(mHostsRef, host->mRecord, /* flags */ 0);
+        // Do not exit on an error so that we always erase the host entry.
+        if (error == kDNSServiceErr_NoError)
+        {
+            error = removeError;
+        }
     }
+    CancelPublication(host->first);
     mHosts.erase(host);
 
 exit:
@@ -530,44 +1098,42 @@ exit:
     return ret;
 }
 
-void PublisherMDnsSd::RecordHost(const char *   aName,
-                                 const uint8_t *aAddress,
-                                 uint8_t        aAddressLength,
-                                 DNSRecordRef   aRecordRef)
+int PublisherMDnsSd::RemoveHostAddress(HostAddress &aHostAddress, bool aSendGoodbye)
 {
-    HostIterator host = FindPublishedHost(aName);
+    int error = 0;
 
-    if (host == mHosts.end())
+    if (aSendGoodbye)
     {
-        Host newHost;
-
-        otbrLog(OTBR_LOG_INFO, "[mdns] add new host %s", aName);
+        // The Bonjour mDNSResponder somehow doesn't send goodbye message for the AAAA record when it is
+        // removed by `DNSServiceRemoveRecord`. Per RFC 6762, a goodbye message of a record sets its TTL
+        // to zero but the receiver should record the TTL of 1 and flushes the cache 1 second later. Here
+        // we remove the AAAA record after updating its TTL to 1 second. This has the same effect as
+        // sending a goodbye message.
+        // TODO: resolve the goodbye issue with Bonjour mDNSResponder.
+        error = DNSServiceUpdateRecord(mHostsRef, aHostAddress.mRecord, kDNSServiceFlagsUnique,
+                                       sizeof(aHostAddress.mAddress.m8), aHostAddress.mAddress.m8, /* ttl */ 1);
 
-        strcpy(newHost.mName, aName);
-        std::copy(aAddress, aAddress + aAddressLength, newHost.mAddress.begin());
-        newHost.mRecord = aRecordRef;
-        mHosts.push_back(newHost);
+        DNSServiceRemoveRecord(mHostsRef, aHostAddress.mRecord, /* flags */ 0);
     }
-    else
-    {
-        otbrLog(OTBR_LOG_INFO, "[mdns] update existing host %s", host->mName);
+    mHostNames.erase(aHostAddress.mRecord);
 
-        // The address of the host may be updated.
-        std::copy(aAddress, aAddress + aAddressLength, host->mAddress.begin());
-        assert(host->mRecord == aRecordRef);
-    }
+    return error;
 }
 
-otbrError PublisherMDnsSd::PublishHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength)
+otbrError PublisherMDnsSd::PublishHost(const char *aName, const AddressList &aAddresses)
 {
+    MemoryStats::Scope memoryScope(MemoryStats::kSubsystemMdns);
+
     otbrError    ret   = OTBR_ERROR_NONE;
     int          error = 0;
     char         fullName[kMaxSizeOfDomain];
     HostIterator host = FindPublishedHost(aName);
+    AddressList  published;
+    AddressList  removed;
+    AddressList  added;
+    size_t       reused;
 
-    // Supports only IPv6 for now, may support IPv4 in the future.
-    VerifyOrExit(aAddressLength == OTBR_IP6_ADDRESS_SIZE, error = OTBR_ERROR_INVALID_ARGS);
-
+    VerifyOrExit(!aAddresses.empty(), ret = OTBR_ERROR_INVALID_ARGS);
     SuccessOrExit(ret = MakeFullName(fullName, sizeof(fullName), aName));
 
     if (mHostsRef == nullptr)
@@ -575,28 +1141,78 @@ otbrError PublisherMDnsSd::PublishHost(const char *aName, const uint8_t *aAddres
         SuccessOrExit(error = DNSServiceCreateConnection(&mHostsRef));
     }
 
-    if (host != mHosts.end())
+    if (host == mHosts.end())
     {
-        otbrLog(OTBR_LOG_INFO, "[mdns] update existing host %s", aName);
-        SuccessOrExit(error = DNSServiceUpdateRecord(mHostsRef, host->mRecord, kDNSServiceFlagsUnique, aAddressLength,
-                                                     aAddress, /* ttl */ 0));
+        Host newHost;
 
-        RecordHost(aName, aAddress, aAddressLength, host->mRecord);
-        if (mHostHandler != nullptr)
+        otbrLog(OTBR_LOG_INFO, "[mdns] publish new host %s", aName);
+
+        strcpy(newHost.mName, aName);
+        newHost.mPendingRecords = 0;
+        host                    = mHosts.emplace(aName, std::move(newHost)).first;
+    }
+
+    for (const HostAddress &hostAddress : host->second.mAddresses)
+    {
+        published.push_back(hostAddress.mAddress);
+    }
+
+    DiffAddresses(published, aAddresses, removed, added);
+    reused = std::min(removed.size(), added.size());
+
+    otbrLog(OTBR_LOG_INFO, "[mdns] host %s diff: updated=%zu added=%zu removed=%zu", aName, reused,
+            added.size() - reused, removed.size() - reused);
+
+    for (size_t i = 0; i < removed.size(); i++)
+    {
+        auto hostAddress = std::find_if(host->second.mAddresses.begin(), host->second.mAddresses.end(),
+                                        [&removed, i](const HostAddress &aHostAddress) {
+                                            return aHostAddress.mAddress == removed[i];
+                                        });
+
+        assert(hostAddress != host->second.mAddresses.end());
+
+        if (i < reused)
+        {
+            // Reuse the record of a removed address so that the address is replaced without re-registration.
+            SuccessOrExit(error = DNSServiceUpdateRecord(mHostsRef, hostAddress->mRecord, kDNSServiceFlagsUnique,
+                                                         sizeof(added[i].m8), added[i].m8, /* ttl */ 0));
+            hostAddress->mAddress = added[i];
+        }
+        else
         {
-            mHostHandler(aName, DNSErrorToOtbrError(error), mHostHandlerContext);
+            // A failed goodbye only delays the expiry of the address in caches, the record is removed anyway.
+            OTBR_UNUSED_VARIABLE(RemoveHostAddress(*hostAddress, /* aSendGoodbye */ true));
+            host->second.mAddresses.erase(hostAddress);
         }
     }
-    else
+
+    for (size_t i = reused; i < added.size(); i++)
     {
-        DNSRecordRef record;
+        HostAddress hostAddress;
 
-        otbrLog(OTBR_LOG_INFO, "[mdns] publish new host %s", aName);
-        SuccessOrExit(error = DNSServiceRegisterRecord(mHostsRef, &record, kDNSServiceFlagsUnique,
+        SuccessOrExit(error = DNSServiceRegisterRecord(mHostsRef, &hostAddress.mRecord, kDNSServiceFlagsUnique,
                                                        kDNSServiceInterfaceIndexAny, fullName, kDNSServiceType_AAAA,
-                                                       kDNSServiceClass_IN, aAddressLength, aAddress, /* ttl */ 0,
-                                                       HandleRegisterHostResult, this));
-        RecordHost(aName, aAddress, aAddressLength, record);
+                                                       kDNSServiceClass_IN, sizeof(added[i].m8), added[i].m8,
+                                                       /* ttl */ 0, HandleRegisterHostResult, this));
+        hostAddress.mAddress = added[i];
+        host->second.mAddresses.push_back(hostAddress);
+        host->second.mPendingRecords++;
+        mHostNames.emplace(hostAddress.mRecord, aName);
+    }
+
+    if (host->second.mPendingRecords > 0)
+    {
+        // The result is reported once the daemon replies to all the newly registered records.
+        StartPublication(aName);
+    }
+    else
+    {
+        CountPublishResult(OTBR_ERROR_NONE);
+        if (mHostHandler != nullptr)
+        {
+            mHostHandler(aName, OTBR_ERROR_NONE, mHostHandlerContext);
+        }
     }
 
 exit:
@@ -608,6 +1224,14 @@ exit:
             mHostsRef = nullptr;
         }
 
+        // The records of all hosts are released with the connection.
+        for (const auto &entry : mHosts)
+        {
+            CancelPublication(entry.first);
+        }
+        mHosts.clear();
+        mHostNames.clear();
+
         ret = OTBR_ERROR_MDNS;
         otbrLog(OTBR_LOG_ERR, "[mdns] failed to publish/update host %s for mdnssd error: %s!", aName,
                 DNSErrorToString(error));
@@ -642,10 +1266,18 @@ void PublisherMDnsSd::HandleRegisterHostResult(DNSServiceRef       aHostsConnect
     std::string  hostName;
 
     VerifyOrExit(host != mHosts.end());
-    hostName = host->mName;
+    hostName = host->second.mName;
 
     otbrLog(OTBR_LOG_INFO, "[mdns] received reply for host %s", hostName.c_str());
 
+    if (aErrorCode == kDNSServiceErr_NoError && host->second.mPendingRecords > 0)
+    {
+        // Wait for the replies to the other records registered along with this one.
+        VerifyOrExit(--host->second.mPendingRecords == 0);
+    }
+
+    FinishPublication(hostName, DNSErrorToOtbrError(aErrorCode));
+
     if (aErrorCode == kDNSServiceErr_NoError)
     {
         otbrLog(OTBR_LOG_INFO, "[mdns] successfully registered host %s", hostName.c_str());
@@ -687,27 +1319,26 @@ exit:
 
 PublisherMDnsSd::ServiceIterator PublisherMDnsSd::FindPublishedService(const char *aName, const char *aType)
 {
-    return std::find_if(mServices.begin(), mServices.end(), [&aName, aType](const Service &service) {
-        return strcmp(aName, service.mName) == 0 && IsServiceTypeEqual(aType, service.mType);
-    });
+    return mServices.find(MakeServiceKey(aName, aType));
 }
 
 PublisherMDnsSd::ServiceIterator PublisherMDnsSd::FindPublishedService(const DNSServiceRef &aServiceRef)
 {
-    return std::find_if(mServices.begin(), mServices.end(),
-                        [&aServiceRef](const Service &service) { return service.mService == aServiceRef; });
+    auto key = mServiceKeys.find(aServiceRef);
+
+    return key == mServiceKeys.end() ? mServices.end() : mServices.find(key->second);
 }
 
 PublisherMDnsSd::HostIterator PublisherMDnsSd::FindPublishedHost(const DNSRecordRef &aRecordRef)
 {
-    return std::find_if(mHosts.begin(), mHosts.end(),
-                        [&aRecordRef](const Host &host) { return host.mRecord == aRecordRef; });
+    auto name = mHostNames.find(aRecordRef);
+
+    return name == mHostNames.end() ? mHosts.end() : mHosts.find(name->second);
 }
 
 PublisherMDnsSd::HostIterator PublisherMDnsSd::FindPublishedHost(const char *aHostName)
 {
-    return std::find_if(mHosts.begin(), mHosts.end(),
-                        [&aHostName](const Host &host) { return strcmp(host.mName, aHostName) == 0; });
+    return mHosts.find(aHostName);
 }
 
 Publisher *Publisher::Create(int aFamily, const char *aDomain, StateHandler aHandler, void *aContext)
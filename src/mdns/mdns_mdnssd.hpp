@@ -34,7 +34,9 @@
 #ifndef OTBR_AGENT_MDNS_MDNSSD_HPP_
 #define OTBR_AGENT_MDNS_MDNSSD_HPP_
 
-#include <array>
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <dns_sd.h>
@@ -100,21 +102,41 @@ public:
      */
     otbrError UnpublishService(const char *aName, const char *aType) override;
 
+    /**
+     * This method updates the TXT record of a published service.
+     *
+     * @param[in]   aName               The name of this service.
+     * @param[in]   aType               The type of this service.
+     * @param[in]   aTxtList            A list of TXT name/value pairs.
+     *
+     * @retval  OTBR_ERROR_NONE          Successfully updated the TXT record.
+     * @retval  OTBR_ERROR_NOT_FOUND     The service has not been published.
+     * @retval  OTBR_ERROR_INVALID_ARGS  The TXT record is too long.
+     * @retval  OTBR_ERROR_MDNS          Failed to update the TXT record.
+     *
+     */
+    otbrError UpdateServiceTxt(const char *aName, const char *aType, const TxtList &aTxtList) override;
+
+    using Publisher::PublishHost;
+
     /**
      * This method publishes or updates a host.
      *
-     * Publishing a host is advertising an AAAA RR for the host name. This method should be called
+     * Publishing a host is advertising an AAAA RR for each address of the host name. This method should be called
      * before a service with non-null host name is published.
      *
-     * @param[in]  aName           The name of the host.
-     * @param[in]  aAddress        The address of the host.
-     * @param[in]  aAddressLength  The length of @p aAddress.
+     * Only the records of the changed addresses are updated when the host has been published. The record of a removed
+     * address is reused for an added address with `DNSServiceUpdateRecord()`, so a renumbered host is updated in place.
      *
-     * @retval  OTBR_ERROR_NONE     Successfully published or updated the host.
-     * @retval  OTBR_ERROR_ERRNO    Failed to publish or update the host.
+     * @param[in]  aName       The name of the host.
+     * @param[in]  aAddresses  The addresses of the host.
+     *
+     * @retval  OTBR_ERROR_NONE          Successfully published or updated the host.
+     * @retval  OTBR_ERROR_INVALID_ARGS  The arguments are not valid.
+     * @retval  OTBR_ERROR_MDNS          Failed to publish or update the host.
      *
      */
-    otbrError PublishHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength) override;
+    otbrError PublishHost(const char *aName, const AddressList &aAddresses) override;
 
     /**
      * This method un-publishes a host.
@@ -129,6 +151,56 @@ public:
      */
     otbrError UnpublishHost(const char *aName) override;
 
+    /**
+     * This method starts a batch of publications.
+     *
+     * mDNSResponder probes every registration on its own, so batching has no effect here.
+     *
+     */
+    void BeginBatch(void) override {}
+
+    /**
+     * This method ends a batch of publications.
+     *
+     * @retval  OTBR_ERROR_NONE  Always.
+     *
+     */
+    otbrError CommitBatch(void) override { return OTBR_ERROR_NONE; }
+
+    /**
+     * This method subscribes to a service type or a service instance.
+     *
+     * @param[in]  aType          The service type, e.g. "_meshcop._udp".
+     * @param[in]  aInstanceName  The service instance name, or empty to browse all instances of @p aType.
+     *
+     */
+    void SubscribeService(const std::string &aType, const std::string &aInstanceName) override;
+
+    /**
+     * This method removes a subscription added by `SubscribeService()`.
+     *
+     * @param[in]  aType          The service type.
+     * @param[in]  aInstanceName  The service instance name, or empty.
+     *
+     */
+    void UnsubscribeService(const std::string &aType, const std::string &aInstanceName) override;
+
+    /**
+     * This method subscribes to the addresses of a host.
+     *
+     * @param[in]  aHostName  The host name, without the domain.
+     *
+     */
+    void SubscribeHost(const std::string &aHostName) override;
+
+    /**
+     * This method removes a subscription added by `SubscribeHost()`.
+     *
+     * @param[in]  aHostName  The host name, without the domain.
+     *
+     */
+    void UnsubscribeHost(const std::string &aHostName) override;
+
     /**
      * This method starts the MDNS service.
      *
@@ -196,23 +268,171 @@ private:
         DNSServiceRef mService;
     };
 
+    struct HostAddress
+    {
+        Ip6Address   mAddress;
+        DNSRecordRef mRecord;
+    };
+
     struct Host
     {
-        char                                       mName[kMaxSizeOfServiceName];
-        std::array<uint8_t, OTBR_IP6_ADDRESS_SIZE> mAddress;
-        DNSRecordRef                               mRecord;
+        char                     mName[kMaxSizeOfServiceName];
+        std::vector<HostAddress> mAddresses;      // One AAAA record per address.
+        uint16_t                 mPendingRecords; // Registered records not yet replied by the daemon.
+    };
+
+    // A service ref owned by a subscription. Released refs are kept until the next `UpdateFdSet()`, so that a
+    // subscription can be removed from within the callback of any service ref.
+    class ServiceRef
+    {
+    public:
+        ServiceRef(void)
+            : mServiceRef(nullptr)
+        {
+        }
+        virtual ~ServiceRef(void) { Release(); }
+
+        void Release(void);
+        void UpdateFdSet(fd_set &aReadFdSet, int &aMaxFd) const;
+        bool IsReady(const fd_set &aReadFdSet) const;
+
+        DNSServiceRef mServiceRef;
+    };
+
+    class ServiceSubscription;
+
+    // Resolves one service instance, then the addresses of its host.
+    class ServiceInstanceResolution : public ServiceRef
+    {
+    public:
+        ServiceInstanceResolution(ServiceSubscription &aSubscription,
+                                  const std::string &  aInstanceName,
+                                  const std::string &  aDomain,
+                                  uint32_t             aNetifIndex);
+
+        void Resolve(void);
+
+        const std::string &GetInstanceName(void) const { return mInstanceInfo.mName; }
+
+    private:
+        static void HandleResolveResult(DNSServiceRef        aServiceRef,
+                                        DNSServiceFlags      aFlags,
+                                        uint32_t             aInterfaceIndex,
+                                        DNSServiceErrorType  aErrorCode,
+                                        const char *         aFullName,
+                                        const char *         aHostTarget,
+                                        uint16_t             aPort,
+                                        uint16_t             aTxtLength,
+                                        const unsigned char *aTxtRecord,
+                                        void *               aContext);
+        void        HandleResolveResult(DNSServiceFlags      aFlags,
+                                        uint32_t             aInterfaceIndex,
+                                        DNSServiceErrorType  aErrorCode,
+                                        const char *         aHostTarget,
+                                        uint16_t             aPort,
+                                        uint16_t             aTxtLength,
+                                        const unsigned char *aTxtRecord);
+        static void HandleGetAddrInfoResult(DNSServiceRef          aServiceRef,
+                                            DNSServiceFlags        aFlags,
+                                            uint32_t               aInterfaceIndex,
+                                            DNSServiceErrorType    aErrorCode,
+                                            const char *           aHostName,
+                                            const struct sockaddr *aAddress,
+                                            uint32_t               aTtl,
+                                            void *                 aContext);
+        void        HandleGetAddrInfoResult(DNSServiceFlags        aFlags,
+                                            DNSServiceErrorType    aErrorCode,
+                                            const struct sockaddr *aAddress,
+                                            uint32_t               aTtl);
+
+        ServiceSubscription &  mSubscription;
+        std::string            mDomain;
+        DiscoveredInstanceInfo mInstanceInfo;
     };
 
-    typedef std::vector<Service>           Services;
-    typedef std::vector<Host>              Hosts;
-    typedef std::vector<Service>::iterator ServiceIterator;
-    typedef std::vector<Host>::iterator    HostIterator;
+    // Browses a service type, or resolves a single instance when the instance name is given.
+    class ServiceSubscription : public ServiceRef
+    {
+    public:
+        ServiceSubscription(PublisherMDnsSd &aPublisher, const std::string &aType, const std::string &aInstanceName);
+
+        void Start(void);
+        void Stop(void);
+        void UpdateFdSet(fd_set &aReadFdSet, int &aMaxFd) const;
+        void GetReadyRefs(const fd_set &aReadFdSet, std::vector<std::pair<ServiceRef *, DNSServiceRef>> &aRefs);
+        void HandleInstanceResolved(const DiscoveredInstanceInfo &aInstanceInfo);
+
+        PublisherMDnsSd &  mPublisher;
+        const std::string  mType;
+        const std::string  mInstanceName;
+
+    private:
+        static void HandleBrowseResult(DNSServiceRef       aServiceRef,
+                                       DNSServiceFlags     aFlags,
+                                       uint32_t            aInterfaceIndex,
+                                       DNSServiceErrorType aErrorCode,
+                                       const char *        aInstanceName,
+                                       const char *        aType,
+                                       const char *        aDomain,
+                                       void *              aContext);
+        void        HandleBrowseResult(DNSServiceFlags     aFlags,
+                                       uint32_t            aInterfaceIndex,
+                                       DNSServiceErrorType aErrorCode,
+                                       const char *        aInstanceName,
+                                       const char *        aDomain);
+        void        AddResolution(const std::string &aInstanceName, const std::string &aDomain, uint32_t aNetifIndex);
+        void        RemoveResolution(const std::string &aInstanceName);
+
+        std::vector<std::unique_ptr<ServiceInstanceResolution>> mResolutions;
+    };
+
+    // Resolves the addresses of a host.
+    class HostSubscription : public ServiceRef
+    {
+    public:
+        HostSubscription(PublisherMDnsSd &aPublisher, const std::string &aHostName);
+
+        void Resolve(void);
+
+        PublisherMDnsSd & mPublisher;
+        const std::string mHostName;
+
+    private:
+        static void HandleResolveResult(DNSServiceRef          aServiceRef,
+                                        DNSServiceFlags        aFlags,
+                                        uint32_t               aInterfaceIndex,
+                                        DNSServiceErrorType    aErrorCode,
+                                        const char *           aHostName,
+                                        const struct sockaddr *aAddress,
+                                        uint32_t               aTtl,
+                                        void *                 aContext);
+        void        HandleResolveResult(DNSServiceFlags        aFlags,
+                                        uint32_t               aInterfaceIndex,
+                                        DNSServiceErrorType    aErrorCode,
+                                        const char *           aHostName,
+                                        const struct sockaddr *aAddress,
+                                        uint32_t               aTtl);
+
+        DiscoveredHostInfo mHostInfo;
+    };
+
+    typedef std::vector<std::unique_ptr<ServiceSubscription>> ServiceSubscriptions;
+    typedef std::vector<std::unique_ptr<HostSubscription>>    HostSubscriptions;
+    typedef std::vector<std::unique_ptr<ServiceRef>>          ServiceRefs;
+
+    // Services are keyed by the instance name and the service type, see `MakeServiceKey()`.
+    typedef std::unordered_map<std::string, Service>       Services;
+    typedef std::unordered_map<std::string, Host>          Hosts;
+    typedef std::unordered_map<DNSServiceRef, std::string> ServiceKeys;
+    typedef std::unordered_map<DNSRecordRef, std::string>  HostNames;
+    typedef Services::iterator                             ServiceIterator;
+    typedef Hosts::iterator                                HostIterator;
 
     void DiscardService(const char *aName, const char *aType, DNSServiceRef aServiceRef = nullptr);
     void RecordService(const char *aName, const char *aType, DNSServiceRef aServiceRef);
 
     otbrError DiscardHost(const char *aName, bool aSendGoodbye = true);
-    void      RecordHost(const char *aName, const uint8_t *aAddress, uint8_t aAddressLength, DNSRecordRef aRecordRef);
+    int       RemoveHostAddress(HostAddress &aHostAddress, bool aSendGoodbye);
 
     static void HandleServiceRegisterResult(DNSServiceRef         aService,
                                             const DNSServiceFlags aFlags,
@@ -244,8 +464,17 @@ private:
     HostIterator    FindPublishedHost(const DNSRecordRef &aRecordRef);
     HostIterator    FindPublishedHost(const char *aHostName);
 
+    const char *GetDomain(void) const { return mDomain == nullptr ? "local." : mDomain; }
+    void        ReleaseLater(std::unique_ptr<ServiceRef> aServiceRef);
+
+    ServiceSubscriptions mSubscribedServices;
+    HostSubscriptions    mSubscribedHosts;
+    ServiceRefs          mReleasedRefs;
+
     Services      mServices;
+    ServiceKeys   mServiceKeys; // The key of each service in `mServices` by its service ref.
     Hosts         mHosts;
+    HostNames     mHostNames;   // The name of each host in `mHosts` by its record ref.
     DNSServiceRef mHostsRef;
     const char *  mDomain;
     State         mState;
@@ -243,12 +243,14 @@ function thread_state()
 	luci.http.prepare_content("application/json")
 
 	local result = {}
-	result.state = threadget("state").State
+	local status = threadstatus({ "state", "panid", "channel", "networkname" })
+
+	result.state = status.State
 
 	if(result.state ~= "disabled") then
-		result.panid = threadget("panid").PanId
-		result.channel = threadget("channel").Channel
-		result.networkname = threadget("networkname").NetworkName
+		result.panid = status.PanId
+		result.channel = status.Channel
+		result.networkname = status.NetworkName
 	end
 	luci.http.write_json(result)
 end
@@ -287,11 +289,13 @@ function networkdata()
 		l[#l+1] = v
 	end
 
+	local status = threadstatus({ "state", "rloc16", "leaderdata" })
+
 	data.connect = l
-	data.state = threadget("state").State
-	data.rloc16 = threadget("rloc16").rloc16
+	data.state = status.State
+	data.rloc16 = status.rloc16
 	data.joinernum = threadget("joinernum").joinernum
-	data.leader = threadget("leaderdata").leaderdata.LeaderRouterId
+	data.leader = status.leaderdata and status.leaderdata.LeaderRouterId
 	return data
 end
 
@@ -336,7 +340,7 @@ function neighborlist()
 	return data
 end
 
-function connect_ubus(methods)
+function connect_ubus(methods, params)
 	local ubus = require "ubus"
 	local result
 	local conn = ubus.connect()
@@ -345,7 +349,7 @@ function connect_ubus(methods)
 		error("Failed to connect to ubusd")
 	end
 
-	result = conn:call("otbr", methods, {})
+	result = conn:call("otbr", methods, params or {})
 
 	return result
 end
@@ -355,3 +359,9 @@ function threadget(action)
 
 	return result
 end
+
+function threadstatus(fields)
+	local result = connect_ubus("status", { fields = fields })
+
+	return result
+end
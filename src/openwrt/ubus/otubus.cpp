@@ -32,9 +32,13 @@
 
 #include "openwrt/ubus/otubus.hpp"
 
-#include <mutex>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
 
-#include <sys/eventfd.h>
+#include <algorithm>
+#include <future>
 
 #include <openthread/commissioner.h>
 #include <openthread/thread.h>
@@ -42,15 +46,15 @@
 
 #include "agent/ncp_openthread.hpp"
 #include "common/logging.hpp"
+#include "common/metrics.hpp"
+#include "utils/hex.hpp"
 
 namespace otbr {
 namespace ubus {
 
 static UbusServer *sUbusServerInstance = nullptr;
-static int         sUbusEfd            = -1;
 static void *      sJsonUri            = nullptr;
 static int         sBufNum;
-static std::mutex *sNcpThreadMutex;
 
 const static int PANID_LENGTH     = 10;
 const static int XPANID_LENGTH    = 64;
@@ -58,6 +62,8 @@ const static int MASTERKEY_LENGTH = 64;
 
 UbusServer::UbusServer(Ncp::ControllerOpenThread *aController)
     : mIfFinishScan(false)
+    , mScanning(false)
+    , mScanList(nullptr)
     , mContext(nullptr)
     , mSockPath(nullptr)
     , mController(aController)
@@ -65,8 +71,15 @@ UbusServer::UbusServer(Ncp::ControllerOpenThread *aController)
 {
     memset(&mNetworkdataBuf, 0, sizeof(mNetworkdataBuf));
     memset(&mBuf, 0, sizeof(mBuf));
+    memset(&mScanBuf, 0, sizeof(mScanBuf));
+    memset(&mEntryBuf, 0, sizeof(mEntryBuf));
+    memset(&mCompletionFd, 0, sizeof(mCompletionFd));
+    mCompletionPipe[0] = -1;
+    mCompletionPipe[1] = -1;
 
     blob_buf_init(&mBuf, 0);
+    blob_buf_init(&mScanBuf, 0);
+    blob_buf_init(&mEntryBuf, 0);
     blob_buf_init(&mNetworkdataBuf, 0);
 }
 
@@ -78,8 +91,19 @@ UbusServer &UbusServer::GetInstance(void)
 void UbusServer::Initialize(Ncp::ControllerOpenThread *aController)
 {
     sUbusServerInstance = new UbusServer(aController);
+
+    if (sUbusServerInstance->mNcpTaskQueue.Init() != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_ERR, "Failed to create task queue for ubus");
+        exit(EXIT_FAILURE);
+    }
+
     otThreadSetReceiveDiagnosticGetCallback(aController->GetInstance(), &UbusServer::HandleDiagnosticGetResponse,
                                             sUbusServerInstance);
+    aController->RegisterSoftResetHandler([aController]() {
+        otThreadSetReceiveDiagnosticGetCallback(aController->GetInstance(), &UbusServer::HandleDiagnosticGetResponse,
+                                                sUbusServerInstance);
+    });
 }
 
 enum
@@ -95,6 +119,12 @@ enum
     ADD_JOINER_MAX,
 };
 
+enum
+{
+    FIELDS,
+    STATUS_MAX,
+};
+
 enum
 {
     MASTERKEY,
@@ -155,6 +185,10 @@ static const struct blobmsg_policy addJoinerPolicy[ADD_JOINER_MAX] = {
     [EUI64] = {.name = "eui64", .type = BLOBMSG_TYPE_STRING},
 };
 
+static const struct blobmsg_policy statusPolicy[STATUS_MAX] = {
+    [FIELDS] = {.name = "fields", .type = BLOBMSG_TYPE_ARRAY},
+};
+
 static const struct blobmsg_policy mgmtsetPolicy[MGMTSET_MAX] = {
     [MASTERKEY]   = {.name = "masterkey", .type = BLOBMSG_TYPE_STRING},
     [NETWORKNAME] = {.name = "networkname", .type = BLOBMSG_TYPE_STRING},
@@ -204,6 +238,8 @@ static const struct ubus_method otbrMethods[] = {
     {"macfilteraddr", &UbusServer::UbusMacfilterAddrHandler, 0, 0, nullptr, 0},
     {"joineradd", &UbusServer::UbusJoinerAddHandler, 0, 0, addJoinerPolicy, ARRAY_SIZE(addJoinerPolicy)},
     {"mgmtset", &UbusServer::UbusMgmtsetHandler, 0, 0, mgmtsetPolicy, ARRAY_SIZE(mgmtsetPolicy)},
+    {"status", &UbusServer::UbusStatusHandler, 0, 0, statusPolicy, ARRAY_SIZE(statusPolicy)},
+    {"metrics", &UbusServer::UbusMetricsHandler, 0, 0, nullptr, 0},
 };
 
 static struct ubus_object_type otbrObjType = {"otbr_prog", 0, otbrMethods, ARRAY_SIZE(otbrMethods)};
@@ -220,18 +256,30 @@ static struct ubus_object otbr = {
     n_methods : ARRAY_SIZE(otbrMethods),
 };
 
-void UbusServer::ProcessScan(void)
+void UbusServer::RunInNcpThread(const std::function<void(void)> &aTask)
+{
+    std::promise<void> done;
+    std::future<void>  isDone = done.get_future();
+
+    mNcpTaskQueue.Post([&aTask, &done]() {
+        aTask();
+        done.set_value();
+    });
+    isDone.wait();
+}
+
+void UbusServer::ProcessNcpTasks(void)
+{
+    mNcpTaskQueue.Process();
+}
+
+otError UbusServer::ProcessScan(void)
 {
-    otError  error        = OT_ERROR_NONE;
     uint32_t scanChannels = 0;
     uint16_t scanDuration = 0;
 
-    sNcpThreadMutex->lock();
-    SuccessOrExit(error = otLinkActiveScan(mController->GetInstance(), scanChannels, scanDuration,
-                                           &UbusServer::HandleActiveScanResult, this));
-exit:
-    sNcpThreadMutex->unlock();
-    return;
+    return otLinkActiveScan(mController->GetInstance(), scanChannels, scanDuration, &UbusServer::HandleActiveScanResult,
+                            this);
 }
 
 void UbusServer::HandleActiveScanResult(otActiveScanResult *aResult, void *aContext)
@@ -241,12 +289,10 @@ void UbusServer::HandleActiveScanResult(otActiveScanResult *aResult, void *aCont
 
 void UbusServer::OutputBytes(const uint8_t *aBytes, uint8_t aLength, char *aOutput)
 {
-    char byte2char[5] = "";
-    for (int i = 0; i < aLength; i++)
-    {
-        sprintf(byte2char, "%02x", aBytes[i]);
-        strcat(aOutput, byte2char);
-    }
+    char *end = aOutput + strlen(aOutput);
+
+    end += Utils::EncodeHex(aBytes, aLength, end, /* aLowerCase */ true);
+    *end = '\0';
 }
 
 void UbusServer::AppendResult(otError aError, struct ubus_context *aContext, struct ubus_request_data *aRequest)
@@ -264,30 +310,74 @@ void UbusServer::HandleActiveScanResultDetail(otActiveScanResult *aResult)
 
     if (aResult == nullptr)
     {
-        blobmsg_close_array(&mBuf, sJsonUri);
+        blobmsg_close_array(&mScanBuf, mScanList);
         mIfFinishScan = true;
+        PostCompletion();
         goto exit;
     }
 
-    jsonList = blobmsg_open_table(&mBuf, nullptr);
+    jsonList = blobmsg_open_table(&mScanBuf, nullptr);
 
-    blobmsg_add_u32(&mBuf, "IsJoinable", aResult->mIsJoinable);
+    blobmsg_add_u32(&mScanBuf, "IsJoinable", aResult->mIsJoinable);
 
-    blobmsg_add_string(&mBuf, "NetworkName", aResult->mNetworkName.m8);
+    blobmsg_add_string(&mScanBuf, "NetworkName", aResult->mNetworkName.m8);
 
     OutputBytes(aResult->mExtendedPanId.m8, OT_EXT_PAN_ID_SIZE, xpanidstring);
-    blobmsg_add_string(&mBuf, "ExtendedPanId", xpanidstring);
+    blobmsg_add_string(&mScanBuf, "ExtendedPanId", xpanidstring);
 
     sprintf(panidstring, "0x%04x", aResult->mPanId);
-    blobmsg_add_string(&mBuf, "PanId", panidstring);
+    blobmsg_add_string(&mScanBuf, "PanId", panidstring);
 
-    blobmsg_add_u32(&mBuf, "Channel", aResult->mChannel);
+    blobmsg_add_u32(&mScanBuf, "Channel", aResult->mChannel);
 
-    blobmsg_add_u32(&mBuf, "Rssi", aResult->mRssi);
+    blobmsg_add_u32(&mScanBuf, "Rssi", aResult->mRssi);
 
-    blobmsg_add_u32(&mBuf, "Lqi", aResult->mLqi);
+    blobmsg_add_u32(&mScanBuf, "Lqi", aResult->mLqi);
 
-    blobmsg_close_table(&mBuf, jsonList);
+    blobmsg_close_table(&mScanBuf, jsonList);
+
+exit:
+    return;
+}
+
+void UbusServer::PostCompletion(void)
+{
+    uint8_t one = 1;
+
+    // The pipe is only ever full when a wake up is already pending, so EAGAIN is not an error.
+    if (write(mCompletionPipe[1], &one, sizeof(one)) < 0 && errno != EAGAIN)
+    {
+        otbrLog(OTBR_LOG_ERR, "failed to wake up ubus thread: %s", strerror(errno));
+    }
+}
+
+void UbusServer::HandleCompletion(struct uloop_fd *aFd, unsigned int aEvents)
+{
+    uint8_t buffer[64];
+
+    OT_UNUSED_VARIABLE(aEvents);
+
+    while (read(aFd->fd, buffer, sizeof(buffer)) > 0)
+    {
+    }
+
+    GetInstance().HandleCompletionDetail();
+}
+
+void UbusServer::HandleCompletionDetail(void)
+{
+    VerifyOrExit(mScanning && mIfFinishScan);
+
+    blobmsg_add_u16(&mScanBuf, "Error", OT_ERROR_NONE);
+
+    for (struct ubus_request_data &request : mScanRequests)
+    {
+        ubus_send_reply(mContext, &request, mScanBuf.head);
+        ubus_complete_deferred_request(mContext, &request, UBUS_STATUS_OK);
+    }
+
+    mScanRequests.clear();
+    mScanning = false;
 
 exit:
     return;
@@ -312,31 +402,32 @@ int UbusServer::UbusScanHandlerDetail(struct ubus_context *     aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError  error = OT_ERROR_NONE;
-    uint64_t eventNum;
-    ssize_t  retval;
+    otError error = OT_ERROR_NONE;
 
-    blob_buf_init(&mBuf, 0);
-    sJsonUri = blobmsg_open_array(&mBuf, "scan_list");
+    // A request arriving while a scan is running shares its result instead of starting another one.
+    if (!mScanning)
+    {
+        blob_buf_init(&mScanBuf, 0);
+        mScanList = blobmsg_open_array(&mScanBuf, "scan_list");
 
-    mIfFinishScan = 0;
-    sUbusServerInstance->ProcessScan();
+        mIfFinishScan = false;
+        RunInNcpThread([&]() { error = ProcessScan(); });
+        SuccessOrExit(error);
 
-    eventNum = 1;
-    retval   = write(sUbusEfd, &eventNum, sizeof(uint64_t));
-    if (retval != sizeof(uint64_t))
-    {
-        error = OT_ERROR_FAILED;
-        goto exit;
+        mScanning = true;
     }
 
-    while (!mIfFinishScan)
+    // The reply is sent by HandleCompletionDetail() once the scan is done, so the ubus thread keeps serving.
+    mScanRequests.emplace_back();
+    ubus_defer_request(aContext, aRequest, &mScanRequests.back());
+
+exit:
+    if (error != OT_ERROR_NONE)
     {
-        sleep(1);
+        blob_buf_init(&mBuf, 0);
+        AppendResult(error, aContext, aRequest);
     }
 
-exit:
-    AppendResult(error, aContext, aRequest);
     return 0;
 }
 
@@ -665,25 +756,12 @@ int UbusServer::UbusLeaveHandlerDetail(struct ubus_context *     aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError  error = OT_ERROR_NONE;
-    uint64_t eventNum;
-    ssize_t  retval;
-
-    sNcpThreadMutex->lock();
-    otInstanceFactoryReset(mController->GetInstance());
+    otError error = OT_ERROR_NONE;
 
-    eventNum = 1;
-    retval   = write(sUbusEfd, &eventNum, sizeof(uint64_t));
-    if (retval != sizeof(uint64_t))
-    {
-        error = OT_ERROR_FAILED;
-        goto exit;
-    }
+    RunInNcpThread([this]() { otInstanceFactoryReset(mController->GetInstance()); });
 
     blob_buf_init(&mBuf, 0);
 
-exit:
-    sNcpThreadMutex->unlock();
     AppendResult(error, aContext, aRequest);
     return 0;
 }
@@ -702,21 +780,22 @@ int UbusServer::UbusThreadHandler(struct ubus_context *     aContext,
 
     blob_buf_init(&mBuf, 0);
 
-    if (!strcmp(aAction, "start"))
-    {
-        sNcpThreadMutex->lock();
-        SuccessOrExit(error = otIp6SetEnabled(mController->GetInstance(), true));
-        SuccessOrExit(error = otThreadSetEnabled(mController->GetInstance(), true));
-    }
-    else if (!strcmp(aAction, "stop"))
-    {
-        sNcpThreadMutex->lock();
-        SuccessOrExit(error = otThreadSetEnabled(mController->GetInstance(), false));
-        SuccessOrExit(error = otIp6SetEnabled(mController->GetInstance(), false));
-    }
+    RunInNcpThread([&]() {
+        if (!strcmp(aAction, "start"))
+        {
+            SuccessOrExit(error = otIp6SetEnabled(mController->GetInstance(), true));
+            SuccessOrExit(error = otThreadSetEnabled(mController->GetInstance(), true));
+        }
+        else if (!strcmp(aAction, "stop"))
+        {
+            SuccessOrExit(error = otThreadSetEnabled(mController->GetInstance(), false));
+            SuccessOrExit(error = otIp6SetEnabled(mController->GetInstance(), false));
+        }
+
+    exit:
+        return;
+    });
 
-exit:
-    sNcpThreadMutex->unlock();
     AppendResult(error, aContext, aRequest);
     return 0;
 }
@@ -740,29 +819,31 @@ int UbusServer::UbusParentHandlerDetail(struct ubus_context *     aContext,
 
     blob_buf_init(&mBuf, 0);
 
-    sNcpThreadMutex->lock();
-    SuccessOrExit(error = otThreadGetParentInfo(mController->GetInstance(), &parentInfo));
+    RunInNcpThread([&]() {
+        SuccessOrExit(error = otThreadGetParentInfo(mController->GetInstance(), &parentInfo));
 
-    jsonArray = blobmsg_open_array(&mBuf, "parent_list");
-    jsonList  = blobmsg_open_table(&mBuf, "parent");
-    blobmsg_add_string(&mBuf, "Role", "R");
+        jsonArray = blobmsg_open_array(&mBuf, "parent_list");
+        jsonList  = blobmsg_open_table(&mBuf, "parent");
+        blobmsg_add_string(&mBuf, "Role", "R");
 
-    sprintf(transfer, "0x%04x", parentInfo.mRloc16);
-    blobmsg_add_string(&mBuf, "Rloc16", transfer);
+        sprintf(transfer, "0x%04x", parentInfo.mRloc16);
+        blobmsg_add_string(&mBuf, "Rloc16", transfer);
 
-    sprintf(transfer, "%3d", parentInfo.mAge);
-    blobmsg_add_string(&mBuf, "Age", transfer);
+        sprintf(transfer, "%3d", parentInfo.mAge);
+        blobmsg_add_string(&mBuf, "Age", transfer);
 
-    OutputBytes(parentInfo.mExtAddress.m8, sizeof(parentInfo.mExtAddress.m8), extAddress);
-    blobmsg_add_string(&mBuf, "ExtAddress", extAddress);
+        OutputBytes(parentInfo.mExtAddress.m8, sizeof(parentInfo.mExtAddress.m8), extAddress);
+        blobmsg_add_string(&mBuf, "ExtAddress", extAddress);
 
-    blobmsg_add_u16(&mBuf, "LinkQualityIn", parentInfo.mLinkQualityIn);
+        blobmsg_add_u16(&mBuf, "LinkQualityIn", parentInfo.mLinkQualityIn);
 
-    blobmsg_close_table(&mBuf, jsonList);
-    blobmsg_close_array(&mBuf, jsonArray);
+        blobmsg_close_table(&mBuf, jsonList);
+        blobmsg_close_array(&mBuf, jsonArray);
+
+    exit:
+        return;
+    });
 
-exit:
-    sNcpThreadMutex->unlock();
     AppendResult(error, aContext, aRequest);
     return error;
 }
@@ -777,69 +858,237 @@ int UbusServer::UbusNeighborHandlerDetail(struct ubus_context *     aContext,
     OT_UNUSED_VARIABLE(aMethod);
     OT_UNUSED_VARIABLE(aMsg);
 
-    otError                error = OT_ERROR_NONE;
-    otNeighborInfo         neighborInfo;
-    otNeighborInfoIterator iterator                  = OT_NEIGHBOR_INFO_ITERATOR_INIT;
-    char                   transfer[XPANID_LENGTH]   = "";
-    void *                 jsonList                  = nullptr;
-    char                   mode[5]                   = "";
-    char                   extAddress[XPANID_LENGTH] = "";
+    otError error = OT_ERROR_NONE;
 
     blob_buf_init(&mBuf, 0);
 
-    sJsonUri = blobmsg_open_array(&mBuf, "neighbor_list");
+    RunInNcpThread([&]() { AddNeighborList(); });
+
+    AppendResult(error, aContext, aRequest);
+    return 0;
+}
+
+static bool IsSameNeighbor(const otNeighborInfo &aLeft, const otNeighborInfo &aRight)
+{
+    return memcmp(aLeft.mExtAddress.m8, aRight.mExtAddress.m8, sizeof(aLeft.mExtAddress.m8)) == 0 &&
+           aLeft.mRloc16 == aRight.mRloc16 && aLeft.mAge == aRight.mAge &&
+           aLeft.mAverageRssi == aRight.mAverageRssi && aLeft.mLastRssi == aRight.mLastRssi &&
+           aLeft.mLinkQualityIn == aRight.mLinkQualityIn && aLeft.mRxOnWhenIdle == aRight.mRxOnWhenIdle &&
+           aLeft.mFullThreadDevice == aRight.mFullThreadDevice && aLeft.mFullNetworkData == aRight.mFullNetworkData &&
+           aLeft.mIsChild == aRight.mIsChild;
+}
+
+void UbusServer::AddNeighborList(void)
+{
+    std::vector<NeighborEntry> neighbors;
+    NeighborEntry              entry;
+    otNeighborInfoIterator     iterator  = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    void *                     jsonArray = nullptr;
 
-    sNcpThreadMutex->lock();
-    while (otThreadGetNextNeighborInfo(mController->GetInstance(), &iterator, &neighborInfo) == OT_ERROR_NONE)
+    while (otThreadGetNextNeighborInfo(mController->GetInstance(), &iterator, &entry.mInfo) == OT_ERROR_NONE)
     {
-        jsonList = blobmsg_open_table(&mBuf, nullptr);
+        auto isSame = [&entry](const NeighborEntry &aCached) { return IsSameNeighbor(aCached.mInfo, entry.mInfo); };
+        auto cached = std::find_if(mNeighborCache.begin(), mNeighborCache.end(), isSame);
 
-        blobmsg_add_string(&mBuf, "Role", neighborInfo.mIsChild ? "C" : "R");
+        // Only the neighbors which changed since the last poll are encoded again.
+        if (cached != mNeighborCache.end())
+        {
+            entry.mTable.swap(cached->mTable);
+        }
+        else
+        {
+            EncodeNeighbor(entry.mInfo, entry.mTable);
+        }
 
-        sprintf(transfer, "0x%04x", neighborInfo.mRloc16);
-        blobmsg_add_string(&mBuf, "Rloc16", transfer);
+        neighbors.push_back(std::move(entry));
+        entry.mTable.clear();
+    }
 
-        sprintf(transfer, "%3d", neighborInfo.mAge);
-        blobmsg_add_string(&mBuf, "Age", transfer);
+    jsonArray = blobmsg_open_array(&mBuf, "neighbor_list");
 
-        sprintf(transfer, "%8d", neighborInfo.mAverageRssi);
-        blobmsg_add_string(&mBuf, "AvgRssi", transfer);
+    for (const NeighborEntry &neighbor : neighbors)
+    {
+        blob_put_raw(&mBuf, neighbor.mTable.data(), neighbor.mTable.size());
+    }
 
-        sprintf(transfer, "%9d", neighborInfo.mLastRssi);
-        blobmsg_add_string(&mBuf, "LastRssi", transfer);
+    blobmsg_close_array(&mBuf, jsonArray);
 
-        if (neighborInfo.mRxOnWhenIdle)
-        {
-            strcat(mode, "r");
-        }
+    mNeighborCache.swap(neighbors);
+}
+
+void UbusServer::EncodeNeighbor(const otNeighborInfo &aInfo, std::vector<uint8_t> &aTable)
+{
+    char              transfer[XPANID_LENGTH]   = "";
+    char              mode[5]                   = "";
+    char              extAddress[XPANID_LENGTH] = "";
+    void *            jsonList                  = nullptr;
+    struct blob_attr *table                     = nullptr;
+
+    // mEntryBuf keeps its allocation across calls, blob_buf_init() only rewinds it.
+    blob_buf_init(&mEntryBuf, 0);
+
+    jsonList = blobmsg_open_table(&mEntryBuf, nullptr);
+
+    blobmsg_add_string(&mEntryBuf, "Role", aInfo.mIsChild ? "C" : "R");
+
+    sprintf(transfer, "0x%04x", aInfo.mRloc16);
+    blobmsg_add_string(&mEntryBuf, "Rloc16", transfer);
+
+    sprintf(transfer, "%3d", aInfo.mAge);
+    blobmsg_add_string(&mEntryBuf, "Age", transfer);
+
+    sprintf(transfer, "%8d", aInfo.mAverageRssi);
+    blobmsg_add_string(&mEntryBuf, "AvgRssi", transfer);
 
-        if (neighborInfo.mFullThreadDevice)
+    sprintf(transfer, "%9d", aInfo.mLastRssi);
+    blobmsg_add_string(&mEntryBuf, "LastRssi", transfer);
+
+    if (aInfo.mRxOnWhenIdle)
+    {
+        strcat(mode, "r");
+    }
+
+    if (aInfo.mFullThreadDevice)
+    {
+        strcat(mode, "d");
+    }
+
+    if (aInfo.mFullNetworkData)
+    {
+        strcat(mode, "n");
+    }
+    blobmsg_add_string(&mEntryBuf, "Mode", mode);
+
+    OutputBytes(aInfo.mExtAddress.m8, sizeof(aInfo.mExtAddress.m8), extAddress);
+    blobmsg_add_string(&mEntryBuf, "ExtAddress", extAddress);
+
+    blobmsg_add_u16(&mEntryBuf, "LinkQualityIn", aInfo.mLinkQualityIn);
+
+    blobmsg_close_table(&mEntryBuf, jsonList);
+
+    table = static_cast<struct blob_attr *>(blob_data(mEntryBuf.head));
+    aTable.assign(reinterpret_cast<const uint8_t *>(table),
+                  reinterpret_cast<const uint8_t *>(table) + blob_pad_len(table));
+}
+
+int UbusServer::UbusStatusHandler(struct ubus_context *     aContext,
+                                  struct ubus_object *      aObj,
+                                  struct ubus_request_data *aRequest,
+                                  const char *              aMethod,
+                                  struct blob_attr *        aMsg)
+{
+    return GetInstance().UbusStatusHandlerDetail(aContext, aObj, aRequest, aMethod, aMsg);
+}
+
+int UbusServer::UbusStatusHandlerDetail(struct ubus_context *     aContext,
+                                        struct ubus_object *      aObj,
+                                        struct ubus_request_data *aRequest,
+                                        const char *              aMethod,
+                                        struct blob_attr *        aMsg)
+{
+    OT_UNUSED_VARIABLE(aObj);
+    OT_UNUSED_VARIABLE(aMethod);
+
+    static const char *const kDefaultFields[] = {
+        "state",
+        "networkname",
+        "channel",
+        "panid",
+        "extpanid",
+        "rloc16",
+        "partitionid",
+        "mode",
+        "leaderdata",
+        "neighbor",
+    };
+
+    otError                   error = OT_ERROR_NONE;
+    struct blob_attr *        tb[STATUS_MAX];
+    struct blob_attr *        field;
+    int                       remaining;
+    std::vector<const char *> fields;
+
+    blobmsg_parse(statusPolicy, STATUS_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+
+    if (tb[FIELDS] != nullptr)
+    {
+        blobmsg_for_each_attr(field, tb[FIELDS], remaining)
         {
-            strcat(mode, "d");
+            VerifyOrExit(blobmsg_type(field) == BLOBMSG_TYPE_STRING, error = OT_ERROR_INVALID_ARGS);
+            fields.push_back(blobmsg_get_string(field));
         }
+    }
+    else
+    {
+        fields.assign(kDefaultFields, kDefaultFields + ARRAY_SIZE(kDefaultFields));
+    }
+
+    blob_buf_init(&mBuf, 0);
 
-        if (neighborInfo.mFullNetworkData)
+    // All fields are read in a single hop to the mainloop thread, so a UI refresh costs one ubus call.
+    RunInNcpThread([&]() {
+        for (const char *name : fields)
         {
-            strcat(mode, "n");
+            otError fieldError = AddInformation(name);
+
+            // A field that is unavailable in the current state, e.g. leader data while detached, is left out.
+            if (fieldError == OT_ERROR_INVALID_ARGS)
+            {
+                error = fieldError;
+                break;
+            }
         }
-        blobmsg_add_string(&mBuf, "Mode", mode);
+    });
 
-        OutputBytes(neighborInfo.mExtAddress.m8, sizeof(neighborInfo.mExtAddress.m8), extAddress);
-        blobmsg_add_string(&mBuf, "ExtAddress", extAddress);
+exit:
+    if (error != OT_ERROR_NONE)
+    {
+        blob_buf_init(&mBuf, 0);
+    }
 
-        blobmsg_add_u16(&mBuf, "LinkQualityIn", neighborInfo.mLinkQualityIn);
+    AppendResult(error, aContext, aRequest);
+    return 0;
+}
 
-        blobmsg_close_table(&mBuf, jsonList);
+int UbusServer::UbusMetricsHandler(struct ubus_context *     aContext,
+                                   struct ubus_object *      aObj,
+                                   struct ubus_request_data *aRequest,
+                                   const char *              aMethod,
+                                   struct blob_attr *        aMsg)
+{
+    OT_UNUSED_VARIABLE(aObj);
+    OT_UNUSED_VARIABLE(aMethod);
+    OT_UNUSED_VARIABLE(aMsg);
 
-        memset(mode, 0, sizeof(mode));
-        memset(extAddress, 0, sizeof(extAddress));
-    }
+    return GetInstance().UbusMetricsHandlerDetail(aContext, aRequest);
+}
 
-    blobmsg_close_array(&mBuf, sJsonUri);
+int UbusServer::UbusMetricsHandlerDetail(struct ubus_context *aContext, struct ubus_request_data *aRequest)
+{
+    Metrics::Snapshot            snapshot;
+    std::vector<Metrics::Sample> samples;
+    void *                       list;
 
-    sNcpThreadMutex->unlock();
+    // Metrics are atomics, so unlike the other handlers this one does not need to hop to the mainloop thread.
+    Metrics::Get().GetSnapshot(snapshot);
+    Metrics::GetSamples(snapshot, samples);
 
-    AppendResult(error, aContext, aRequest);
+    blob_buf_init(&mBuf, 0);
+    list = blobmsg_open_array(&mBuf, "metrics");
+
+    for (const Metrics::Sample &sample : samples)
+    {
+        void *entry = blobmsg_open_table(&mBuf, nullptr);
+
+        blobmsg_add_string(&mBuf, "name", sample.mName.c_str());
+        blobmsg_add_string(&mBuf, "labels", sample.mLabels != nullptr ? sample.mLabels : "");
+        blobmsg_add_u64(&mBuf, "value", sample.mValue);
+        blobmsg_close_table(&mBuf, entry);
+    }
+
+    blobmsg_close_array(&mBuf, list);
+
+    AppendResult(OT_ERROR_NONE, aContext, aRequest);
     return 0;
 }
 
@@ -860,7 +1109,8 @@ int UbusServer::UbusMgmtset(struct ubus_context *     aContext,
     long                 value;
     int                  length = 0;
 
-    SuccessOrExit(error = otDatasetGetActive(mController->GetInstance(), &dataset));
+    RunInNcpThread([&]() { error = otDatasetGetActive(mController->GetInstance(), &dataset); });
+    SuccessOrExit(error);
 
     blobmsg_parse(mgmtsetPolicy, MGMTSET_MAX, tb, blob_data(aMsg), blob_len(aMsg));
     if (tb[MASTERKEY] != nullptr)
@@ -909,12 +1159,13 @@ int UbusServer::UbusMgmtset(struct ubus_context *     aContext,
         length = 0;
     }
     dataset.mActiveTimestamp++;
-    if (otCommissionerGetState(mController->GetInstance()) == OT_COMMISSIONER_STATE_DISABLED)
-    {
-        otCommissionerStop(mController->GetInstance());
-    }
-    SuccessOrExit(
-        error = otDatasetSendMgmtActiveSet(mController->GetInstance(), &dataset, tlvs, static_cast<uint8_t>(length)));
+    RunInNcpThread([&]() {
+        if (otCommissionerGetState(mController->GetInstance()) == OT_COMMISSIONER_STATE_DISABLED)
+        {
+            otCommissionerStop(mController->GetInstance());
+        }
+        error = otDatasetSendMgmtActiveSet(mController->GetInstance(), &dataset, tlvs, static_cast<uint8_t>(length));
+    });
 exit:
     AppendResult(error, aContext, aRequest);
     return 0;
@@ -933,73 +1184,74 @@ int UbusServer::UbusCommissioner(struct ubus_context *     aContext,
 
     otError error = OT_ERROR_NONE;
 
-    sNcpThreadMutex->lock();
-
-    if (!strcmp(aAction, "start"))
-    {
-        if (otCommissionerGetState(mController->GetInstance()) == OT_COMMISSIONER_STATE_DISABLED)
-        {
-            error = otCommissionerStart(mController->GetInstance(), &UbusServer::HandleStateChanged,
-                                        &UbusServer::HandleJoinerEvent, this);
-        }
-    }
-    else if (!strcmp(aAction, "joineradd"))
-    {
-        struct blob_attr *  tb[ADD_JOINER_MAX];
-        otExtAddress        addr;
-        const otExtAddress *addrPtr = nullptr;
-        char *              pskd    = nullptr;
-
-        blobmsg_parse(addJoinerPolicy, ADD_JOINER_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[PSKD] != nullptr)
+    RunInNcpThread([&]() {
+        if (!strcmp(aAction, "start"))
         {
-            pskd = blobmsg_get_string(tb[PSKD]);
+            if (otCommissionerGetState(mController->GetInstance()) == OT_COMMISSIONER_STATE_DISABLED)
+            {
+                error = otCommissionerStart(mController->GetInstance(), &UbusServer::HandleStateChanged,
+                                            &UbusServer::HandleJoinerEvent, this);
+            }
         }
-        if (tb[EUI64] != nullptr)
+        else if (!strcmp(aAction, "joineradd"))
         {
-            if (!strcmp(blobmsg_get_string(tb[EUI64]), "*"))
+            struct blob_attr *  tb[ADD_JOINER_MAX];
+            otExtAddress        addr;
+            const otExtAddress *addrPtr = nullptr;
+            char *              pskd    = nullptr;
+
+            blobmsg_parse(addJoinerPolicy, ADD_JOINER_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[PSKD] != nullptr)
             {
-                addrPtr = nullptr;
-                memset(&addr, 0, sizeof(addr));
+                pskd = blobmsg_get_string(tb[PSKD]);
             }
-            else
+            if (tb[EUI64] != nullptr)
             {
-                VerifyOrExit(Hex2Bin(blobmsg_get_string(tb[EUI64]), addr.m8, sizeof(addr)) == sizeof(addr),
-                             error = OT_ERROR_PARSE);
-                addrPtr = &addr;
+                if (!strcmp(blobmsg_get_string(tb[EUI64]), "*"))
+                {
+                    addrPtr = nullptr;
+                    memset(&addr, 0, sizeof(addr));
+                }
+                else
+                {
+                    VerifyOrExit(Hex2Bin(blobmsg_get_string(tb[EUI64]), addr.m8, sizeof(addr)) == sizeof(addr),
+                                 error = OT_ERROR_PARSE);
+                    addrPtr = &addr;
+                }
             }
-        }
 
-        unsigned long timeout = kDefaultJoinerTimeout;
-        SuccessOrExit(
-            error = otCommissionerAddJoiner(mController->GetInstance(), addrPtr, pskd, static_cast<uint32_t>(timeout)));
-    }
-    else if (!strcmp(aAction, "joinerremove"))
-    {
-        struct blob_attr *  tb[SET_NETWORK_MAX];
-        otExtAddress        addr;
-        const otExtAddress *addrPtr = nullptr;
-
-        blobmsg_parse(removeJoinerPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
+            unsigned long timeout = kDefaultJoinerTimeout;
+            SuccessOrExit(error = otCommissionerAddJoiner(mController->GetInstance(), addrPtr, pskd,
+                                                          static_cast<uint32_t>(timeout)));
+        }
+        else if (!strcmp(aAction, "joinerremove"))
         {
-            if (strcmp(blobmsg_get_string(tb[SETNETWORK]), "*") == 0)
-            {
-                addrPtr = nullptr;
-            }
-            else
+            struct blob_attr *  tb[SET_NETWORK_MAX];
+            otExtAddress        addr;
+            const otExtAddress *addrPtr = nullptr;
+
+            blobmsg_parse(removeJoinerPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
             {
-                VerifyOrExit(Hex2Bin(blobmsg_get_string(tb[SETNETWORK]), addr.m8, sizeof(addr)) == sizeof(addr),
-                             error = OT_ERROR_PARSE);
-                addrPtr = &addr;
+                if (strcmp(blobmsg_get_string(tb[SETNETWORK]), "*") == 0)
+                {
+                    addrPtr = nullptr;
+                }
+                else
+                {
+                    VerifyOrExit(Hex2Bin(blobmsg_get_string(tb[SETNETWORK]), addr.m8, sizeof(addr)) == sizeof(addr),
+                                 error = OT_ERROR_PARSE);
+                    addrPtr = &addr;
+                }
             }
+
+            SuccessOrExit(error = otCommissionerRemoveJoiner(mController->GetInstance(), addrPtr));
         }
 
-        SuccessOrExit(error = otCommissionerRemoveJoiner(mController->GetInstance(), addrPtr));
-    }
+    exit:
+        return;
+    });
 
-exit:
-    sNcpThreadMutex->unlock();
     blob_buf_init(&mBuf, 0);
     AppendResult(error, aContext, aRequest);
     return 0;
@@ -1076,44 +1328,170 @@ int UbusServer::UbusGetInformation(struct ubus_context *     aContext,
 
     blob_buf_init(&mBuf, 0);
 
-    sNcpThreadMutex->lock();
-    if (!strcmp(aAction, "networkname"))
+    RunInNcpThread([&]() {
+        if (!strcmp(aAction, "networkdata"))
+        {
+            ubus_send_reply(aContext, aRequest, mNetworkdataBuf.head);
+            if (time(nullptr) - mSecond > 10)
+            {
+                struct otIp6Address address;
+                uint8_t             tlvTypes[OT_NETWORK_DIAGNOSTIC_TYPELIST_MAX_ENTRIES];
+                uint8_t             count             = 0;
+                char                multicastAddr[10] = "ff03::2";
+
+                blob_buf_init(&mNetworkdataBuf, 0);
+
+                SuccessOrExit(error = otIp6AddressFromString(multicastAddr, &address));
+
+                tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_ROUTE);
+                tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE);
+
+                sBufNum = 0;
+                otThreadSendDiagnosticGet(mController->GetInstance(), &address, tlvTypes, count);
+                mSecond = time(nullptr);
+            }
+            goto exit;
+        }
+        else if (!strcmp(aAction, "joinernum"))
+        {
+            void *       jsonTable = nullptr;
+            void *       jsonArray = nullptr;
+            otJoinerInfo joinerInfo;
+            uint16_t     iterator        = 0;
+            int          joinerNum       = 0;
+            char         eui64[EXTPANID] = "";
+
+            blob_buf_init(&mBuf, 0);
+
+            jsonArray = blobmsg_open_array(&mBuf, "joinerList");
+            while (otCommissionerGetNextJoinerInfo(mController->GetInstance(), &iterator, &joinerInfo) == OT_ERROR_NONE)
+            {
+                memset(eui64, 0, sizeof(eui64));
+
+                jsonTable = blobmsg_open_table(&mBuf, nullptr);
+
+                blobmsg_add_string(&mBuf, "pskd", joinerInfo.mPskd.m8);
+
+                switch (joinerInfo.mType)
+                {
+                case OT_JOINER_INFO_TYPE_ANY:
+                    blobmsg_add_u16(&mBuf, "isAny", 1);
+                    break;
+                case OT_JOINER_INFO_TYPE_EUI64:
+                    blobmsg_add_u16(&mBuf, "isAny", 0);
+                    OutputBytes(joinerInfo.mSharedId.mEui64.m8, sizeof(joinerInfo.mSharedId.mEui64.m8), eui64);
+                    blobmsg_add_string(&mBuf, "eui64", eui64);
+                    break;
+                case OT_JOINER_INFO_TYPE_DISCERNER:
+                    blobmsg_add_u16(&mBuf, "isAny", 0);
+                    blobmsg_add_u64(&mBuf, "discernerValue", joinerInfo.mSharedId.mDiscerner.mValue);
+                    blobmsg_add_u16(&mBuf, "discernerLength", joinerInfo.mSharedId.mDiscerner.mLength);
+                    break;
+                }
+
+                blobmsg_close_table(&mBuf, jsonTable);
+
+                joinerNum++;
+            }
+            blobmsg_close_array(&mBuf, jsonArray);
+
+            blobmsg_add_u32(&mBuf, "joinernum", joinerNum);
+        }
+        else if (!strcmp(aAction, "macfilterstate"))
+        {
+            otMacFilterAddressMode mode = otLinkFilterGetAddressMode(mController->GetInstance());
+
+            blob_buf_init(&mBuf, 0);
+
+            if (mode == OT_MAC_FILTER_ADDRESS_MODE_DISABLED)
+            {
+                blobmsg_add_string(&mBuf, "state", "disable");
+            }
+            else if (mode == OT_MAC_FILTER_ADDRESS_MODE_ALLOWLIST)
+            {
+                blobmsg_add_string(&mBuf, "state", "allowlist");
+            }
+            else if (mode == OT_MAC_FILTER_ADDRESS_MODE_DENYLIST)
+            {
+                blobmsg_add_string(&mBuf, "state", "denylist");
+            }
+            else
+            {
+                blobmsg_add_string(&mBuf, "state", "error");
+            }
+        }
+        else if (!strcmp(aAction, "macfilteraddr"))
+        {
+            otMacFilterEntry    entry;
+            otMacFilterIterator iterator = OT_MAC_FILTER_ITERATOR_INIT;
+
+            blob_buf_init(&mBuf, 0);
+
+            sJsonUri = blobmsg_open_array(&mBuf, "addrlist");
+
+            while (otLinkFilterGetNextAddress(mController->GetInstance(), &iterator, &entry) == OT_ERROR_NONE)
+            {
+                char extAddress[XPANID_LENGTH] = "";
+                OutputBytes(entry.mExtAddress.m8, sizeof(entry.mExtAddress.m8), extAddress);
+                blobmsg_add_string(&mBuf, "addr", extAddress);
+            }
+
+            blobmsg_close_array(&mBuf, sJsonUri);
+        }
+        else if ((error = AddInformation(aAction)) == OT_ERROR_INVALID_ARGS)
+        {
+            perror("invalid argument in get information ubus\n");
+        }
+
+        AppendResult(error, aContext, aRequest);
+    exit:
+        return;
+    });
+
+    return 0;
+}
+
+otError UbusServer::AddInformation(const char *aField)
+{
+    otError error = OT_ERROR_NONE;
+
+    if (!strcmp(aField, "networkname"))
         blobmsg_add_string(&mBuf, "NetworkName", otThreadGetNetworkName(mController->GetInstance()));
-    else if (!strcmp(aAction, "state"))
+    else if (!strcmp(aField, "state"))
     {
         char state[10];
         GetState(mController->GetInstance(), state);
         blobmsg_add_string(&mBuf, "State", state);
     }
-    else if (!strcmp(aAction, "channel"))
+    else if (!strcmp(aField, "channel"))
         blobmsg_add_u32(&mBuf, "Channel", otLinkGetChannel(mController->GetInstance()));
-    else if (!strcmp(aAction, "panid"))
+    else if (!strcmp(aField, "panid"))
     {
         char panIdString[PANID_LENGTH];
         sprintf(panIdString, "0x%04x", otLinkGetPanId(mController->GetInstance()));
         blobmsg_add_string(&mBuf, "PanId", panIdString);
     }
-    else if (!strcmp(aAction, "rloc16"))
+    else if (!strcmp(aField, "rloc16"))
     {
         char rloc[PANID_LENGTH];
         sprintf(rloc, "0x%04x", otThreadGetRloc16(mController->GetInstance()));
         blobmsg_add_string(&mBuf, "rloc16", rloc);
     }
-    else if (!strcmp(aAction, "masterkey"))
+    else if (!strcmp(aField, "masterkey"))
     {
         char           outputKey[MASTERKEY_LENGTH] = "";
         const uint8_t *key = reinterpret_cast<const uint8_t *>(otThreadGetMasterKey(mController->GetInstance()));
         OutputBytes(key, OT_MASTER_KEY_SIZE, outputKey);
         blobmsg_add_string(&mBuf, "Masterkey", outputKey);
     }
-    else if (!strcmp(aAction, "pskc"))
+    else if (!strcmp(aField, "pskc"))
     {
         char          outputPskc[MASTERKEY_LENGTH] = "";
         const otPskc *pskc                         = otThreadGetPskc(mController->GetInstance());
         OutputBytes(pskc->m8, OT_MASTER_KEY_SIZE, outputPskc);
         blobmsg_add_string(&mBuf, "pskc", outputPskc);
     }
-    else if (!strcmp(aAction, "extpanid"))
+    else if (!strcmp(aField, "extpanid"))
     {
         char           outputExtPanId[XPANID_LENGTH] = "";
         const uint8_t *extPanId =
@@ -1121,7 +1499,7 @@ int UbusServer::UbusGetInformation(struct ubus_context *     aContext,
         OutputBytes(extPanId, OT_EXT_PAN_ID_SIZE, outputExtPanId);
         blobmsg_add_string(&mBuf, "ExtPanId", outputExtPanId);
     }
-    else if (!strcmp(aAction, "mode"))
+    else if (!strcmp(aField, "mode"))
     {
         otLinkModeConfig linkMode;
         char             mode[5] = "";
@@ -1146,17 +1524,18 @@ int UbusServer::UbusGetInformation(struct ubus_context *     aContext,
         }
         blobmsg_add_string(&mBuf, "Mode", mode);
     }
-    else if (!strcmp(aAction, "partitionid"))
+    else if (!strcmp(aField, "partitionid"))
     {
         blobmsg_add_u32(&mBuf, "Partitionid", otThreadGetPartitionId(mController->GetInstance()));
     }
-    else if (!strcmp(aAction, "leaderdata"))
+    else if (!strcmp(aField, "leaderdata"))
     {
         otLeaderData leaderData;
+        void *       jsonTable = nullptr;
 
         SuccessOrExit(error = otThreadGetLeaderData(mController->GetInstance(), &leaderData));
 
-        sJsonUri = blobmsg_open_table(&mBuf, "leaderdata");
+        jsonTable = blobmsg_open_table(&mBuf, "leaderdata");
 
         blobmsg_add_u32(&mBuf, "PartitionId", leaderData.mPartitionId);
         blobmsg_add_u32(&mBuf, "Weighting", leaderData.mWeighting);
@@ -1164,126 +1543,19 @@ int UbusServer::UbusGetInformation(struct ubus_context *     aContext,
         blobmsg_add_u32(&mBuf, "StableDataVersion", leaderData.mStableDataVersion);
         blobmsg_add_u32(&mBuf, "LeaderRouterId", leaderData.mLeaderRouterId);
 
-        blobmsg_close_table(&mBuf, sJsonUri);
+        blobmsg_close_table(&mBuf, jsonTable);
     }
-    else if (!strcmp(aAction, "networkdata"))
+    else if (!strcmp(aField, "neighbor"))
     {
-        ubus_send_reply(aContext, aRequest, mNetworkdataBuf.head);
-        if (time(nullptr) - mSecond > 10)
-        {
-            struct otIp6Address address;
-            uint8_t             tlvTypes[OT_NETWORK_DIAGNOSTIC_TYPELIST_MAX_ENTRIES];
-            uint8_t             count             = 0;
-            char                multicastAddr[10] = "ff03::2";
-
-            blob_buf_init(&mNetworkdataBuf, 0);
-
-            SuccessOrExit(error = otIp6AddressFromString(multicastAddr, &address));
-
-            tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_ROUTE);
-            tlvTypes[count++] = static_cast<uint8_t>(OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE);
-
-            sBufNum = 0;
-            otThreadSendDiagnosticGet(mController->GetInstance(), &address, tlvTypes, count);
-            mSecond = time(nullptr);
-        }
-        goto exit;
-    }
-    else if (!strcmp(aAction, "joinernum"))
-    {
-        void *       jsonTable = nullptr;
-        void *       jsonArray = nullptr;
-        otJoinerInfo joinerInfo;
-        uint16_t     iterator        = 0;
-        int          joinerNum       = 0;
-        char         eui64[EXTPANID] = "";
-
-        blob_buf_init(&mBuf, 0);
-
-        jsonArray = blobmsg_open_array(&mBuf, "joinerList");
-        while (otCommissionerGetNextJoinerInfo(mController->GetInstance(), &iterator, &joinerInfo) == OT_ERROR_NONE)
-        {
-            memset(eui64, 0, sizeof(eui64));
-
-            jsonTable = blobmsg_open_table(&mBuf, nullptr);
-
-            blobmsg_add_string(&mBuf, "pskd", joinerInfo.mPskd.m8);
-
-            switch (joinerInfo.mType)
-            {
-            case OT_JOINER_INFO_TYPE_ANY:
-                blobmsg_add_u16(&mBuf, "isAny", 1);
-                break;
-            case OT_JOINER_INFO_TYPE_EUI64:
-                blobmsg_add_u16(&mBuf, "isAny", 0);
-                OutputBytes(joinerInfo.mSharedId.mEui64.m8, sizeof(joinerInfo.mSharedId.mEui64.m8), eui64);
-                blobmsg_add_string(&mBuf, "eui64", eui64);
-                break;
-            case OT_JOINER_INFO_TYPE_DISCERNER:
-                blobmsg_add_u16(&mBuf, "isAny", 0);
-                blobmsg_add_u64(&mBuf, "discernerValue", joinerInfo.mSharedId.mDiscerner.mValue);
-                blobmsg_add_u16(&mBuf, "discernerLength", joinerInfo.mSharedId.mDiscerner.mLength);
-                break;
-            }
-
-            blobmsg_close_table(&mBuf, jsonTable);
-
-            joinerNum++;
-        }
-        blobmsg_close_array(&mBuf, jsonArray);
-
-        blobmsg_add_u32(&mBuf, "joinernum", joinerNum);
-    }
-    else if (!strcmp(aAction, "macfilterstate"))
-    {
-        otMacFilterAddressMode mode = otLinkFilterGetAddressMode(mController->GetInstance());
-
-        blob_buf_init(&mBuf, 0);
-
-        if (mode == OT_MAC_FILTER_ADDRESS_MODE_DISABLED)
-        {
-            blobmsg_add_string(&mBuf, "state", "disable");
-        }
-        else if (mode == OT_MAC_FILTER_ADDRESS_MODE_ALLOWLIST)
-        {
-            blobmsg_add_string(&mBuf, "state", "allowlist");
-        }
-        else if (mode == OT_MAC_FILTER_ADDRESS_MODE_DENYLIST)
-        {
-            blobmsg_add_string(&mBuf, "state", "denylist");
-        }
-        else
-        {
-            blobmsg_add_string(&mBuf, "state", "error");
-        }
-    }
-    else if (!strcmp(aAction, "macfilteraddr"))
-    {
-        otMacFilterEntry    entry;
-        otMacFilterIterator iterator = OT_MAC_FILTER_ITERATOR_INIT;
-
-        blob_buf_init(&mBuf, 0);
-
-        sJsonUri = blobmsg_open_array(&mBuf, "addrlist");
-
-        while (otLinkFilterGetNextAddress(mController->GetInstance(), &iterator, &entry) == OT_ERROR_NONE)
-        {
-            char extAddress[XPANID_LENGTH] = "";
-            OutputBytes(entry.mExtAddress.m8, sizeof(entry.mExtAddress.m8), extAddress);
-            blobmsg_add_string(&mBuf, "addr", extAddress);
-        }
-
-        blobmsg_close_array(&mBuf, sJsonUri);
+        AddNeighborList();
     }
     else
     {
-        perror("invalid argument in get information ubus\n");
+        error = OT_ERROR_INVALID_ARGS;
     }
 
-    AppendResult(error, aContext, aRequest);
 exit:
-    sNcpThreadMutex->unlock();
-    return 0;
+    return error;
 }
 
 void UbusServer::HandleDiagnosticGetResponse(otError              aError,
@@ -1418,181 +1690,185 @@ int UbusServer::UbusSetInformation(struct ubus_context *     aContext,
 
     blob_buf_init(&mBuf, 0);
 
-    sNcpThreadMutex->lock();
-    if (!strcmp(aAction, "networkname"))
-    {
-        struct blob_attr *tb[SET_NETWORK_MAX];
-
-        blobmsg_parse(setNetworknamePolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
+    RunInNcpThread([&]() {
+        if (!strcmp(aAction, "networkname"))
         {
-            char *newName = blobmsg_get_string(tb[SETNETWORK]);
-            SuccessOrExit(error = otThreadSetNetworkName(mController->GetInstance(), newName));
-        }
-    }
-    else if (!strcmp(aAction, "channel"))
-    {
-        struct blob_attr *tb[SET_NETWORK_MAX];
+            struct blob_attr *tb[SET_NETWORK_MAX];
 
-        blobmsg_parse(setChannelPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
-        {
-            uint32_t channel = blobmsg_get_u32(tb[SETNETWORK]);
-            SuccessOrExit(error = otLinkSetChannel(mController->GetInstance(), static_cast<uint8_t>(channel)));
+            blobmsg_parse(setNetworknamePolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
+            {
+                char *newName = blobmsg_get_string(tb[SETNETWORK]);
+                SuccessOrExit(error = otThreadSetNetworkName(mController->GetInstance(), newName));
+            }
         }
-    }
-    else if (!strcmp(aAction, "panid"))
-    {
-        struct blob_attr *tb[SET_NETWORK_MAX];
-
-        blobmsg_parse(setPanIdPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
+        else if (!strcmp(aAction, "channel"))
         {
-            long  value;
-            char *panid = blobmsg_get_string(tb[SETNETWORK]);
-            SuccessOrExit(error = ParseLong(panid, value));
-            error = otLinkSetPanId(mController->GetInstance(), static_cast<otPanId>(value));
-        }
-    }
-    else if (!strcmp(aAction, "masterkey"))
-    {
-        struct blob_attr *tb[SET_NETWORK_MAX];
+            struct blob_attr *tb[SET_NETWORK_MAX];
 
-        blobmsg_parse(setMasterkeyPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
+            blobmsg_parse(setChannelPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
+            {
+                uint32_t channel = blobmsg_get_u32(tb[SETNETWORK]);
+                SuccessOrExit(error = otLinkSetChannel(mController->GetInstance(), static_cast<uint8_t>(channel)));
+            }
+        }
+        else if (!strcmp(aAction, "panid"))
         {
-            otMasterKey key;
-            char *      masterkey = blobmsg_get_string(tb[SETNETWORK]);
+            struct blob_attr *tb[SET_NETWORK_MAX];
 
-            VerifyOrExit(Hex2Bin(masterkey, key.m8, sizeof(key.m8)) == OT_MASTER_KEY_SIZE, error = OT_ERROR_PARSE);
-            SuccessOrExit(error = otThreadSetMasterKey(mController->GetInstance(), &key));
+            blobmsg_parse(setPanIdPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
+            {
+                long  value;
+                char *panid = blobmsg_get_string(tb[SETNETWORK]);
+                SuccessOrExit(error = ParseLong(panid, value));
+                error = otLinkSetPanId(mController->GetInstance(), static_cast<otPanId>(value));
+            }
         }
-    }
-    else if (!strcmp(aAction, "pskc"))
-    {
-        struct blob_attr *tb[SET_NETWORK_MAX];
-
-        blobmsg_parse(setPskcPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
+        else if (!strcmp(aAction, "masterkey"))
         {
-            otPskc pskc;
+            struct blob_attr *tb[SET_NETWORK_MAX];
 
-            VerifyOrExit(Hex2Bin(blobmsg_get_string(tb[SETNETWORK]), pskc.m8, sizeof(pskc)) == OT_PSKC_MAX_SIZE,
-                         error = OT_ERROR_PARSE);
-            SuccessOrExit(error = otThreadSetPskc(mController->GetInstance(), &pskc));
-        }
-    }
-    else if (!strcmp(aAction, "extpanid"))
-    {
-        struct blob_attr *tb[SET_NETWORK_MAX];
+            blobmsg_parse(setMasterkeyPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
+            {
+                otMasterKey key;
+                char *      masterkey = blobmsg_get_string(tb[SETNETWORK]);
 
-        blobmsg_parse(setExtPanIdPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
-        {
-            otExtendedPanId extPanId;
-            char *          input = blobmsg_get_string(tb[SETNETWORK]);
-            VerifyOrExit(Hex2Bin(input, extPanId.m8, sizeof(extPanId)) >= 0, error = OT_ERROR_PARSE);
-            error = otThreadSetExtendedPanId(mController->GetInstance(), &extPanId);
+                VerifyOrExit(Hex2Bin(masterkey, key.m8, sizeof(key.m8)) == OT_MASTER_KEY_SIZE, error = OT_ERROR_PARSE);
+                SuccessOrExit(error = otThreadSetMasterKey(mController->GetInstance(), &key));
+            }
         }
-    }
-    else if (!strcmp(aAction, "mode"))
-    {
-        otLinkModeConfig  linkMode;
-        struct blob_attr *tb[SET_NETWORK_MAX];
-
-        blobmsg_parse(setModePolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
+        else if (!strcmp(aAction, "pskc"))
         {
-            char *inputMode = blobmsg_get_string(tb[SETNETWORK]);
-            for (char *ch = inputMode; *ch != '\0'; ch++)
+            struct blob_attr *tb[SET_NETWORK_MAX];
+
+            blobmsg_parse(setPskcPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
             {
-                switch (*ch)
-                {
-                case 'r':
-                    linkMode.mRxOnWhenIdle = 1;
-                    break;
+                otPskc pskc;
 
-                case 'd':
-                    linkMode.mDeviceType = 1;
-                    break;
+                VerifyOrExit(Hex2Bin(blobmsg_get_string(tb[SETNETWORK]), pskc.m8, sizeof(pskc)) == OT_PSKC_MAX_SIZE,
+                             error = OT_ERROR_PARSE);
+                SuccessOrExit(error = otThreadSetPskc(mController->GetInstance(), &pskc));
+            }
+        }
+        else if (!strcmp(aAction, "extpanid"))
+        {
+            struct blob_attr *tb[SET_NETWORK_MAX];
 
-                case 'n':
-                    linkMode.mNetworkData = 1;
-                    break;
+            blobmsg_parse(setExtPanIdPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
+            {
+                otExtendedPanId extPanId;
+                char *          input = blobmsg_get_string(tb[SETNETWORK]);
+                VerifyOrExit(Hex2Bin(input, extPanId.m8, sizeof(extPanId)) >= 0, error = OT_ERROR_PARSE);
+                error = otThreadSetExtendedPanId(mController->GetInstance(), &extPanId);
+            }
+        }
+        else if (!strcmp(aAction, "mode"))
+        {
+            otLinkModeConfig  linkMode;
+            struct blob_attr *tb[SET_NETWORK_MAX];
 
-                default:
-                    ExitNow(error = OT_ERROR_PARSE);
+            blobmsg_parse(setModePolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
+            {
+                char *inputMode = blobmsg_get_string(tb[SETNETWORK]);
+                for (char *ch = inputMode; *ch != '\0'; ch++)
+                {
+                    switch (*ch)
+                    {
+                    case 'r':
+                        linkMode.mRxOnWhenIdle = 1;
+                        break;
+
+                    case 'd':
+                        linkMode.mDeviceType = 1;
+                        break;
+
+                    case 'n':
+                        linkMode.mNetworkData = 1;
+                        break;
+
+                    default:
+                        ExitNow(error = OT_ERROR_PARSE);
+                    }
                 }
-            }
 
-            SuccessOrExit(error = otThreadSetLinkMode(mController->GetInstance(), linkMode));
+                SuccessOrExit(error = otThreadSetLinkMode(mController->GetInstance(), linkMode));
+            }
         }
-    }
-    else if (!strcmp(aAction, "macfilteradd"))
-    {
-        struct blob_attr *tb[SET_NETWORK_MAX];
-        otExtAddress      extAddr;
-
-        blobmsg_parse(macfilterAddPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
+        else if (!strcmp(aAction, "macfilteradd"))
         {
-            char *addr = blobmsg_get_string(tb[SETNETWORK]);
+            struct blob_attr *tb[SET_NETWORK_MAX];
+            otExtAddress      extAddr;
 
-            VerifyOrExit(Hex2Bin(addr, extAddr.m8, OT_EXT_ADDRESS_SIZE) == OT_EXT_ADDRESS_SIZE, error = OT_ERROR_PARSE);
-
-            error = otLinkFilterAddAddress(mController->GetInstance(), &extAddr);
+            blobmsg_parse(macfilterAddPolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
+            {
+                char *addr = blobmsg_get_string(tb[SETNETWORK]);
 
-            VerifyOrExit(error == OT_ERROR_NONE || error == OT_ERROR_ALREADY);
-        }
-    }
-    else if (!strcmp(aAction, "macfilterremove"))
-    {
-        struct blob_attr *tb[SET_NETWORK_MAX];
-        otExtAddress      extAddr;
+                VerifyOrExit(Hex2Bin(addr, extAddr.m8, OT_EXT_ADDRESS_SIZE) == OT_EXT_ADDRESS_SIZE,
+                             error = OT_ERROR_PARSE);
 
-        blobmsg_parse(macfilterRemovePolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
-        {
-            char *addr = blobmsg_get_string(tb[SETNETWORK]);
-            VerifyOrExit(Hex2Bin(addr, extAddr.m8, OT_EXT_ADDRESS_SIZE) == OT_EXT_ADDRESS_SIZE, error = OT_ERROR_PARSE);
+                error = otLinkFilterAddAddress(mController->GetInstance(), &extAddr);
 
-            otLinkFilterRemoveAddress(mController->GetInstance(), &extAddr);
+                VerifyOrExit(error == OT_ERROR_NONE || error == OT_ERROR_ALREADY);
+            }
         }
-    }
-    else if (!strcmp(aAction, "macfiltersetstate"))
-    {
-        struct blob_attr *tb[SET_NETWORK_MAX];
-
-        blobmsg_parse(macfilterSetStatePolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
-        if (tb[SETNETWORK] != nullptr)
+        else if (!strcmp(aAction, "macfilterremove"))
         {
-            char *state = blobmsg_get_string(tb[SETNETWORK]);
+            struct blob_attr *tb[SET_NETWORK_MAX];
+            otExtAddress      extAddr;
 
-            if (strcmp(state, "disable") == 0)
+            blobmsg_parse(macfilterRemovePolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
             {
-                otLinkFilterSetAddressMode(mController->GetInstance(), OT_MAC_FILTER_ADDRESS_MODE_DISABLED);
-            }
-            else if (strcmp(state, "allowlist") == 0)
-            {
-                otLinkFilterSetAddressMode(mController->GetInstance(), OT_MAC_FILTER_ADDRESS_MODE_ALLOWLIST);
+                char *addr = blobmsg_get_string(tb[SETNETWORK]);
+                VerifyOrExit(Hex2Bin(addr, extAddr.m8, OT_EXT_ADDRESS_SIZE) == OT_EXT_ADDRESS_SIZE,
+                             error = OT_ERROR_PARSE);
+
+                otLinkFilterRemoveAddress(mController->GetInstance(), &extAddr);
             }
-            else if (strcmp(state, "denylist") == 0)
+        }
+        else if (!strcmp(aAction, "macfiltersetstate"))
+        {
+            struct blob_attr *tb[SET_NETWORK_MAX];
+
+            blobmsg_parse(macfilterSetStatePolicy, SET_NETWORK_MAX, tb, blob_data(aMsg), blob_len(aMsg));
+            if (tb[SETNETWORK] != nullptr)
             {
-                otLinkFilterSetAddressMode(mController->GetInstance(), OT_MAC_FILTER_ADDRESS_MODE_DENYLIST);
+                char *state = blobmsg_get_string(tb[SETNETWORK]);
+
+                if (strcmp(state, "disable") == 0)
+                {
+                    otLinkFilterSetAddressMode(mController->GetInstance(), OT_MAC_FILTER_ADDRESS_MODE_DISABLED);
+                }
+                else if (strcmp(state, "allowlist") == 0)
+                {
+                    otLinkFilterSetAddressMode(mController->GetInstance(), OT_MAC_FILTER_ADDRESS_MODE_ALLOWLIST);
+                }
+                else if (strcmp(state, "denylist") == 0)
+                {
+                    otLinkFilterSetAddressMode(mController->GetInstance(), OT_MAC_FILTER_ADDRESS_MODE_DENYLIST);
+                }
             }
         }
-    }
-    else if (!strcmp(aAction, "macfilterclear"))
-    {
-        otLinkFilterClearAddresses(mController->GetInstance());
-    }
-    else
-    {
-        perror("invalid argument in get information ubus\n");
-    }
+        else if (!strcmp(aAction, "macfilterclear"))
+        {
+            otLinkFilterClearAddresses(mController->GetInstance());
+        }
+        else
+        {
+            perror("invalid argument in get information ubus\n");
+        }
+
+    exit:
+        return;
+    });
 
-exit:
-    sNcpThreadMutex->unlock();
     AppendResult(error, aContext, aRequest);
     return 0;
 }
@@ -1689,6 +1965,16 @@ int UbusServer::DisplayUbusInit(const char *aPath)
     /* file description */
     UbusAddFd();
 
+    if (pipe2(mCompletionPipe, O_CLOEXEC | O_NONBLOCK) != 0)
+    {
+        otbrLog(OTBR_LOG_ERR, "create completion pipe failed: %s", strerror(errno));
+        return -1;
+    }
+
+    mCompletionFd.fd = mCompletionPipe[0];
+    mCompletionFd.cb = HandleCompletion;
+    uloop_fd_add(&mCompletionFd, ULOOP_READ);
+
     /* Add a object */
     if (ubus_add_object(mContext, &otbr) != 0)
     {
@@ -1701,6 +1987,15 @@ int UbusServer::DisplayUbusInit(const char *aPath)
 
 void UbusServer::DisplayUbusDone(void)
 {
+    if (mCompletionPipe[0] >= 0)
+    {
+        uloop_fd_delete(&mCompletionFd);
+        close(mCompletionPipe[0]);
+        close(mCompletionPipe[1]);
+        mCompletionPipe[0] = -1;
+        mCompletionPipe[1] = -1;
+    }
+
     if (mContext)
     {
         ubus_free(mContext);
@@ -1787,18 +2082,9 @@ exit:
 } // namespace ubus
 } // namespace otbr
 
-void UbusServerInit(otbr::Ncp::ControllerOpenThread *aController, std::mutex *aNcpThreadMutex)
+void UbusServerInit(otbr::Ncp::ControllerOpenThread *aController)
 {
-    otbr::ubus::sNcpThreadMutex = aNcpThreadMutex;
-    otbr::ubus::sUbusEfd        = eventfd(0, 0);
-
     otbr::ubus::UbusServer::Initialize(aController);
-
-    if (otbr::ubus::sUbusEfd == -1)
-    {
-        perror("Failed to create eventfd for ubus");
-        exit(EXIT_FAILURE);
-    }
 }
 
 void UbusServerRun(void)
@@ -1806,39 +2092,7 @@ void UbusServerRun(void)
     otbr::ubus::UbusServer::GetInstance().InstallUbusObject();
 }
 
-void UbusUpdateFdSet(fd_set &aReadFdSet, int &aMaxFd)
+void UbusProcess(void)
 {
-    VerifyOrExit(otbr::ubus::sUbusEfd != -1);
-
-    FD_SET(otbr::ubus::sUbusEfd, &aReadFdSet);
-
-    if (aMaxFd < otbr::ubus::sUbusEfd)
-    {
-        aMaxFd = otbr::ubus::sUbusEfd;
-    }
-
-exit:
-    return;
-}
-
-void UbusProcess(const fd_set &aReadFdSet)
-{
-    ssize_t  retval;
-    uint64_t num;
-
-    VerifyOrExit(otbr::ubus::sUbusEfd != -1);
-
-    if (FD_ISSET(otbr::ubus::sUbusEfd, &aReadFdSet))
-    {
-        retval = read(otbr::ubus::sUbusEfd, &num, sizeof(uint64_t));
-        if (retval != sizeof(uint64_t))
-        {
-            perror("read ubus eventfd failed\n");
-            exit(EXIT_FAILURE);
-        }
-        goto exit;
-    }
-
-exit:
-    return;
+    otbr::ubus::UbusServer::GetInstance().ProcessNcpTasks();
 }
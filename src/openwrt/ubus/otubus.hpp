@@ -39,12 +39,17 @@
 #include <stdarg.h>
 #include <time.h>
 
+#include <atomic>
+#include <functional>
+#include <vector>
+
 #include <openthread/ip6.h>
 #include <openthread/link.h>
 #include <openthread/netdiag.h>
 #include <openthread/udp.h>
 
 #include "common/code_utils.hpp"
+#include "common/task_queue.hpp"
 
 extern "C" {
 #include <libubox/blobmsg_json.h>
@@ -93,6 +98,14 @@ public:
      */
     void InstallUbusObject(void);
 
+    /**
+     * This method runs the tasks posted by the ubus thread.
+     *
+     * This method MUST be called from the mainloop thread.
+     *
+     */
+    void ProcessNcpTasks(void);
+
     /**
      * This method handle ubus scan function request.
      *
@@ -507,6 +520,47 @@ public:
                                    const char *              aMethod,
                                    struct blob_attr *        aMsg);
 
+    /**
+     * This method handle ubus get status function request.
+     *
+     * The optional `fields` array of the message selects which fields are returned, it defaults to the ones shown by
+     * the status page.
+     *
+     * @param[in]   aContext    A pointer to the ubus context.
+     * @param[in]   aObj        A pointer to the ubus object.
+     * @param[in]   aRequest    A pointer to the ubus request.
+     * @param[in]   aMethod     A pointer to the ubus method.
+     * @param[in]   aMsg        A pointer to the ubus message.
+     *
+     * @retval 0   Successfully handler the request.
+     *
+     */
+    static int UbusStatusHandler(struct ubus_context *     aContext,
+                                 struct ubus_object *      aObj,
+                                 struct ubus_request_data *aRequest,
+                                 const char *              aMethod,
+                                 struct blob_attr *        aMsg);
+
+    /**
+     * This method handle ubus get metrics function request.
+     *
+     * The reply holds a `metrics` array of `name`, `labels` and `value` tables, see `Metrics::GetSamples()`.
+     *
+     * @param[in]   aContext    A pointer to the ubus context.
+     * @param[in]   aObj        A pointer to the ubus object.
+     * @param[in]   aRequest    A pointer to the ubus request.
+     * @param[in]   aMethod     A pointer to the ubus method.
+     * @param[in]   aMsg        A pointer to the ubus message.
+     *
+     * @retval 0   Successfully handler the request.
+     *
+     */
+    static int UbusMetricsHandler(struct ubus_context *     aContext,
+                                  struct ubus_object *      aObj,
+                                  struct ubus_request_data *aRequest,
+                                  const char *              aMethod,
+                                  struct blob_attr *        aMsg);
+
     /**
      * This method handle ubus start thread function request.
      *
@@ -766,13 +820,32 @@ public:
     void HandleDiagnosticGetResponse(otError aError, otMessage *aMessage, const otMessageInfo *aMessageInfo);
 
 private:
-    bool                       mIfFinishScan;
-    struct ubus_context *      mContext;
-    const char *               mSockPath;
-    struct blob_buf            mBuf;
-    struct blob_buf            mNetworkdataBuf;
-    Ncp::ControllerOpenThread *mController;
-    time_t                     mSecond;
+    /**
+     * This structure caches the encoded blobmsg table of a neighbor.
+     *
+     */
+    struct NeighborEntry
+    {
+        otNeighborInfo       mInfo;  ///< The neighbor information the table was encoded from.
+        std::vector<uint8_t> mTable; ///< The encoded table.
+    };
+
+    std::atomic<bool>                     mIfFinishScan;
+    bool                                  mScanning; ///< Whether a scan is running, only accessed by the ubus thread.
+    void *                                mScanList;
+    struct blob_buf                       mScanBuf; ///< Filled by the mainloop thread while a scan is running.
+    std::vector<struct ubus_request_data> mScanRequests;
+    int                                   mCompletionPipe[2];
+    struct uloop_fd                       mCompletionFd;
+    struct ubus_context *                 mContext;
+    const char *                          mSockPath;
+    struct blob_buf                       mBuf;
+    struct blob_buf                       mNetworkdataBuf;
+    struct blob_buf                       mEntryBuf; ///< Scratch buffer to encode a single neighbor table.
+    std::vector<NeighborEntry>            mNeighborCache;
+    Ncp::ControllerOpenThread *           mController;
+    time_t                                mSecond;
+    TaskQueue                             mNcpTaskQueue;
     enum
     {
         kDefaultJoinerTimeout = 120,
@@ -785,11 +858,24 @@ private:
      */
     UbusServer(Ncp::ControllerOpenThread *aController);
 
+    /**
+     * This method runs a task in the mainloop thread and waits for it to complete.
+     *
+     * OpenThread APIs MUST only be called from the mainloop thread, so the ubus handlers run them through this
+     * method. The ubus thread is blocked while the task runs, so the task may use the ubus context and buffers.
+     *
+     * @param[in]   aTask   The task to run.
+     *
+     */
+    void RunInNcpThread(const std::function<void(void)> &aTask);
+
     /**
      * This method start scan.
      *
+     * @returns The error of starting the scan.
+     *
      */
-    void ProcessScan(void);
+    otError ProcessScan(void);
 
     /**
      * This method detailly start scan.
@@ -826,6 +912,29 @@ private:
      */
     void HandleActiveScanResultDetail(otActiveScanResult *aResult);
 
+    /**
+     * This method wakes up the ubus thread to complete the deferred requests.
+     *
+     * It may be called from any thread.
+     *
+     */
+    void PostCompletion(void);
+
+    /**
+     * This method handles the wake up of the ubus thread (callback function).
+     *
+     * @param[in]   aFd         A pointer to the uloop fd.
+     * @param[in]   aEvents     The events of the fd.
+     *
+     */
+    static void HandleCompletion(struct uloop_fd *aFd, unsigned int aEvents);
+
+    /**
+     * This method replies to and completes the deferred scan requests once the scan finished.
+     *
+     */
+    void HandleCompletionDetail(void);
+
     /**
      * This method detailly handler get neighbor information.
      *
@@ -844,6 +953,53 @@ private:
                                   const char *              aMethod,
                                   struct blob_attr *        aMsg);
 
+    /**
+     * This method adds the neighbor list to mBuf, it MUST be called from the mainloop thread.
+     *
+     * The tables of the neighbors which did not change since the last call are copied from mNeighborCache instead of
+     * being encoded again.
+     *
+     */
+    void AddNeighborList(void);
+
+    /**
+     * This method encodes the blobmsg table of a neighbor.
+     *
+     * @param[in]   aInfo       The neighbor information.
+     * @param[out]  aTable      The encoded table.
+     *
+     */
+    void EncodeNeighbor(const otNeighborInfo &aInfo, std::vector<uint8_t> &aTable);
+
+    /**
+     * This method detailly handler get status information.
+     *
+     * @param[in]   aContext    A pointer to the ubus context.
+     * @param[in]   aObj        A pointer to the ubus object.
+     * @param[in]   aRequest    A pointer to the ubus request.
+     * @param[in]   aMethod     A pointer to the ubus method.
+     * @param[in]   aMsg        A pointer to the ubus message.
+     *
+     * @retval 0   Successfully handler the request.
+     *
+     */
+    int UbusStatusHandlerDetail(struct ubus_context *     aContext,
+                                struct ubus_object *      aObj,
+                                struct ubus_request_data *aRequest,
+                                const char *              aMethod,
+                                struct blob_attr *        aMsg);
+
+    /**
+     * This method detailly handler get metrics.
+     *
+     * @param[in]   aContext    A pointer to the ubus context.
+     * @param[in]   aRequest    A pointer to the ubus request.
+     *
+     * @retval 0   Successfully handler the request.
+     *
+     */
+    int UbusMetricsHandlerDetail(struct ubus_context *aContext, struct ubus_request_data *aRequest);
+
     /**
      * This method detailly handler get parent information.
      *
@@ -938,6 +1094,20 @@ private:
                            struct blob_attr *        aMsg,
                            const char *              action);
 
+    /**
+     * This method adds one field of the thread network information to mBuf.
+     *
+     * It MUST be called from the mainloop thread.
+     *
+     * @param[in]   aField      A pointer to the field name, e.g. "state" or "leaderdata".
+     *
+     * @retval OT_ERROR_NONE            Successfully added the field.
+     * @retval OT_ERROR_INVALID_ARGS    The field is unknown.
+     * @retval ...                      The field is not available in the current state.
+     *
+     */
+    otError AddInformation(const char *aField);
+
     /**
      * This method handle set information request.
      *
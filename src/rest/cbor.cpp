@@ -0,0 +1,204 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/cbor.hpp"
+
+#include <memory>
+
+#include "rest/encoder.hpp"
+#include "utils/cbor_writer.hpp"
+
+using otbr::Utils::CborWriter;
+
+namespace otbr {
+namespace rest {
+namespace Cbor {
+
+std::string Number2CborString(uint32_t aNumber)
+{
+    std::string ret;
+    CborWriter  writer(ret);
+
+    writer.Uint(aNumber);
+
+    return ret;
+}
+
+std::string Bytes2CborString(const uint8_t *aBytes, uint8_t aLength)
+{
+    std::string ret;
+    CborWriter  writer(ret);
+
+    writer.Bytes(aBytes, aLength);
+
+    return ret;
+}
+
+std::string String2CborString(const std::string &aString)
+{
+    std::string ret;
+    CborWriter  writer(ret);
+
+    writer.String(aString.c_str());
+
+    return ret;
+}
+
+std::string IpAddr2CborString(const otIp6Address &aAddress)
+{
+    std::string ret;
+    CborWriter  writer(ret);
+
+    EncodeIpAddr(writer, aAddress);
+
+    return ret;
+}
+
+std::string Node2CborString(const NodeInfo &aNode)
+{
+    std::string ret;
+    CborWriter  writer(ret);
+
+    EncodeNode(writer, aNode);
+
+    return ret;
+}
+
+std::string LeaderData2CborString(const otLeaderData &aLeaderData)
+{
+    std::string ret;
+    CborWriter  writer(ret);
+
+    EncodeLeaderData(writer, aLeaderData);
+
+    return ret;
+}
+
+std::string Diag2CborString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet, DiagTlvMask aTlvMask)
+{
+    std::string ret;
+    CborWriter  writer(ret);
+
+    EncodeDiag(writer, aDiagSet, aTlvMask);
+
+    return ret;
+}
+
+ChunkProducer Diag2CborChunks(std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet, DiagTlvMask aTlvMask)
+{
+    // The encoder is shared by the copies of the producer, since its writer is bound to its buffer.
+    auto encoder = std::make_shared<DiagChunkEncoder<CborWriter>>(aDiagSet, aTlvMask);
+
+    return [encoder](std::string &aChunk) { return (*encoder)(aChunk); };
+}
+
+std::string DiagHistory2CborString(const DiagnosticHistory &                           aHistory,
+                                   const std::vector<const DiagnosticHistory::Series *> &aSeries,
+                                   uint64_t                                              aSince)
+{
+    std::string ret;
+    CborWriter  writer(ret);
+
+    EncodeDiagHistory(writer, aHistory, aSeries, aSince);
+
+    return ret;
+}
+
+std::string Topology2CborString(const Topology &aTopology, uint64_t aSince)
+{
+    std::string ret;
+    CborWriter  writer(ret);
+
+    EncodeTopology(writer, aTopology, aSince);
+
+    return ret;
+}
+
+std::string NeighborTable2CborString(uint64_t aSequence, const std::vector<otNeighborInfo> &aNeighbors)
+{
+    std::string ret;
+    CborWriter  writer(ret);
+
+    EncodeNeighborTable(writer, aSequence, aNeighbors);
+
+    return ret;
+}
+
+std::string ChurnEvents2CborString(const std::vector<Ncp::ChurnLog::Event> &aEvents, uint32_t aDropped)
+{
+    std::string ret;
+    CborWriter  writer(ret);
+
+    EncodeChurnEvents(writer, aEvents, aDropped);
+
+    return ret;
+}
+
+std::string ScanResults2CborString(const std::vector<otActiveScanResult> &aResults)
+{
+    std::string ret;
+    CborWriter  writer(ret);
+
+    EncodeScanResults(writer, aResults);
+
+    return ret;
+}
+
+std::string ScanResults2CborString(const std::vector<otEnergyScanResult> &aResults)
+{
+    std::string ret;
+    CborWriter  writer(ret);
+
+    EncodeScanResults(writer, aResults);
+
+    return ret;
+}
+
+std::string MainloopStats2CborString(const MainloopStats &aStats)
+{
+    std::string ret;
+    CborWriter  writer(ret);
+
+    EncodeMainloopStats(writer, aStats);
+
+    return ret;
+}
+
+std::string Error2CborString(HttpStatusCode aErrorCode, const std::string &aErrorMessage)
+{
+    std::string ret;
+    CborWriter  writer(ret);
+
+    EncodeError(writer, aErrorCode, aErrorMessage);
+
+    return ret;
+}
+
+} // namespace Cbor
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,237 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes CBOR formatter definition for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_CBOR_HPP_
+#define OTBR_REST_CBOR_HPP_
+
+#include "openthread/link.h"
+#include "openthread/thread_ftd.h"
+
+#include "agent/churn_log.hpp"
+#include "common/mainloop_stats.hpp"
+#include "rest/diagnostic_history.hpp"
+#include "rest/neighbor_log.hpp"
+#include "rest/topology.hpp"
+#include "rest/types.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * The functions within this namespace serialize an object/string/number to CBOR (RFC 8949), with the same structure
+ * as the Json namespace. Byte arrays are serialized as CBOR byte strings instead of hex strings.
+ *
+ */
+namespace Cbor {
+
+/**
+ * This method serializes an integer to a CBOR unsigned integer.
+ *
+ * @param[in]   aNumber  The integer.
+ *
+ * @returns     The CBOR encoded data.
+ *
+ */
+std::string Number2CborString(uint32_t aNumber);
+
+/**
+ * This method serializes a bytes array to a CBOR byte string.
+ *
+ * @param[in]   aBytes   A pointer to the bytes.
+ * @param[in]   aLength  The number of bytes.
+ *
+ * @returns     The CBOR encoded data.
+ *
+ */
+std::string Bytes2CborString(const uint8_t *aBytes, uint8_t aLength);
+
+/**
+ * This method serializes a string to a CBOR text string.
+ *
+ * @param[in]   aString  The string.
+ *
+ * @returns     The CBOR encoded data.
+ *
+ */
+std::string String2CborString(const std::string &aString);
+
+/**
+ * This method serializes an IPv6 address to a CBOR text string.
+ *
+ * @param[in]   aAddress  The IPv6 address.
+ *
+ * @returns     The CBOR encoded data.
+ *
+ */
+std::string IpAddr2CborString(const otIp6Address &aAddress);
+
+/**
+ * This method serializes a Node object to a CBOR map.
+ *
+ * @param[in]   aNode  A Node object.
+ *
+ * @returns     The CBOR encoded data.
+ *
+ */
+std::string Node2CborString(const NodeInfo &aNode);
+
+/**
+ * This method serializes a LeaderData object to a CBOR map.
+ *
+ * @param[in]   aLeaderData  A LeaderData object.
+ *
+ * @returns     The CBOR encoded data.
+ *
+ */
+std::string LeaderData2CborString(const otLeaderData &aLeaderData);
+
+/**
+ * This method serializes the diagnostics of nodes to a CBOR array of maps.
+ *
+ * @param[in]   aDiagSet  The diagnostic TLVs of each node.
+ * @param[in]   aTlvMask  The TLV types to include for each node.
+ *
+ * @returns     The CBOR encoded data.
+ *
+ */
+std::string Diag2CborString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet,
+                            DiagTlvMask                                       aTlvMask = kDiagTlvMaskAll);
+
+/**
+ * This method creates a producer of a chunked response body, which serializes the diagnostics of nodes to a CBOR
+ * array of maps.
+ *
+ * @param[inout]    aDiagSet    The diagnostic TLVs of each node, moved into the producer.
+ * @param[in]       aTlvMask    The TLV types to include for each node.
+ *
+ * @returns The chunk producer.
+ *
+ */
+ChunkProducer Diag2CborChunks(std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet,
+                              DiagTlvMask                                 aTlvMask = kDiagTlvMaskAll);
+
+/**
+ * This method serializes the histories of nodes to a CBOR array of maps.
+ *
+ * @param[in]   aHistory  The diagnostic history.
+ * @param[in]   aSeries   The histories to serialize.
+ * @param[in]   aSince    Only samples recorded at or after this time, in milliseconds since the Unix epoch, are
+ *                        serialized.
+ *
+ * @returns     The CBOR encoded data.
+ *
+ */
+std::string DiagHistory2CborString(const DiagnosticHistory &                           aHistory,
+                                   const std::vector<const DiagnosticHistory::Series *> &aSeries,
+                                   uint64_t                                              aSince);
+
+/**
+ * This method serializes the changes of a topology since a version to a CBOR map.
+ *
+ * @param[in]   aTopology  The topology.
+ * @param[in]   aSince     The version the client has.
+ *
+ * @returns     The CBOR encoded data.
+ *
+ */
+std::string Topology2CborString(const Topology &aTopology, uint64_t aSince);
+
+/**
+ * This method serializes the neighbor table at a sequence number of its change log to a CBOR map.
+ *
+ * @param[in]   aSequence   The sequence number of the last change of the table.
+ * @param[in]   aNeighbors  The neighbors.
+ *
+ * @returns     The CBOR encoded data.
+ *
+ */
+std::string NeighborTable2CborString(uint64_t aSequence, const std::vector<otNeighborInfo> &aNeighbors);
+
+/**
+ * This method serializes the events of the churn log to a CBOR map.
+ *
+ * @param[in]   aEvents     The events.
+ * @param[in]   aDropped    The number of events dropped because the log was full.
+ *
+ * @returns     The CBOR encoded data.
+ *
+ */
+std::string ChurnEvents2CborString(const std::vector<Ncp::ChurnLog::Event> &aEvents, uint32_t aDropped);
+
+/**
+ * This method serializes the results of an active scan to a CBOR array.
+ *
+ * @param[in]   aResults    The active scan results.
+ *
+ * @returns     The CBOR encoded data.
+ *
+ */
+std::string ScanResults2CborString(const std::vector<otActiveScanResult> &aResults);
+
+/**
+ * This method serializes the results of an energy scan to a CBOR array.
+ *
+ * @param[in]   aResults    The energy scan results.
+ *
+ * @returns     The CBOR encoded data.
+ *
+ */
+std::string ScanResults2CborString(const std::vector<otEnergyScanResult> &aResults);
+
+/**
+ * This method serializes the mainloop latency statistics to a CBOR map.
+ *
+ * @param[in]   aStats  A MainloopStats object.
+ *
+ * @returns     The CBOR encoded data.
+ *
+ */
+std::string MainloopStats2CborString(const MainloopStats &aStats);
+
+/**
+ * This method serializes an error code and an error message to a CBOR map.
+ *
+ * @param[in]   aErrorCode     An enum HttpStatusCode such as '404'.
+ * @param[in]   aErrorMessage  Error message such as '404 Not Found'.
+ *
+ * @returns     The CBOR encoded data.
+ *
+ */
+std::string Error2CborString(HttpStatusCode aErrorCode, const std::string &aErrorMessage);
+
+} // namespace Cbor
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_CBOR_HPP_
@@ -28,10 +28,18 @@
 
 #include "rest/connection.hpp"
 
+#include <algorithm>
 #include <cerrno>
 
 #include <assert.h>
+#include <stdlib.h>
 #include <sys/time.h>
+#include <sys/uio.h>
+
+#include "common/mainloop_poller.hpp"
+#include "common/metrics.hpp"
+#include "common/trace.hpp"
+#include "common/usdt.hpp"
 
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
@@ -53,51 +61,68 @@ static const uint32_t kWriteTimeout = 10000000;
 // The timeout (in microseconds) since a connection is in wait read state
 static const uint32_t kReadTimeout = 1000000;
 
-Connection::Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd)
+// The timeout (in microseconds) a persistent connection waits for its next request
+static const uint32_t kIdleTimeout = 5000000;
+
+// The maximum number of requests handled on a persistent connection
+static const uint32_t kMaxRequestsPerConnection = 100;
+
+// The status of a successful response, which may be answered as not modified
+static const char kHttpStatusOk[] = "200 OK";
+
+Connection::Connection(steady_clock::time_point aStartTime, Resource *aResource, OtBridge *aBridge, int aFd)
     : mTimeStamp(aStartTime)
+    , mHandleTime(aStartTime)
     , mFd(aFd)
     , mState(ConnectionState::kInit)
     , mParser(&mRequest)
     , mResource(aResource)
+    , mBridge(aBridge)
+    , mCallState(kCallIdle)
+    , mWriteOffset(0)
+    , mRequestCount(0)
 {
 }
 
 void Connection::Init(void)
 {
     mParser.Init();
+    MainloopPoller::Get().Register(mFd, MainloopPoller::kEventRead);
 }
 
-void Connection::UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const
-{
-    if (mState == ConnectionState::kReadWait || mState == ConnectionState::kInit)
-    {
-        FD_SET(mFd, &aReadFdSet);
-        aMaxFd = aMaxFd < mFd ? mFd : aMaxFd;
-    }
-}
-
-void Connection::UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const
+void Connection::Reset(steady_clock::time_point aStartTime, int aFd)
 {
-    if (mState == ConnectionState::kWriteWait)
-    {
-        FD_SET(mFd, &aWriteFdSet);
-        aMaxFd = aMaxFd < mFd ? mFd : aMaxFd;
-    }
+    assert(mFd == -1);
+
+    mTimeStamp  = aStartTime;
+    mHandleTime = aStartTime;
+    mFd         = aFd;
+    mState      = ConnectionState::kInit;
+    mCallState  = kCallIdle;
+    mRequest.Reset();
+    mResponse.Reset();
+    mWriteHeader.clear();
+    mWriteOffset  = 0;
+    mRequestCount = 0;
 }
 
-void Connection::UpdateTimeout(timeval &aTimeout) const
+steady_clock::time_point Connection::GetTimeout(void) const
 {
-    struct timeval timeout;
-    uint32_t       timeoutLen = kReadTimeout;
-    auto           duration   = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
+    uint64_t timeoutLen = kReadTimeout;
+    uint64_t duration   = static_cast<uint64_t>(duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count());
 
     switch (mState)
     {
     case ConnectionState::kReadWait:
         timeoutLen = kReadTimeout;
         break;
+    case ConnectionState::kIdleWait:
+        timeoutLen = kIdleTimeout;
+        break;
+    case ConnectionState::kHandleWait:
     case ConnectionState::kCallbackWait:
-        timeoutLen = kCallbackCheckInterval;
+        // Check the callback at the next multiple of the interval.
+        timeoutLen = (duration / kCallbackCheckInterval + 1) * kCallbackCheckInterval;
         break;
     case ConnectionState::kWriteWait:
         timeoutLen = kWriteTimeout;
@@ -109,28 +134,7 @@ void Connection::UpdateTimeout(timeval &aTimeout) const
         break;
     }
 
-    if (duration <= timeoutLen)
-    {
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = timeoutLen - duration;
-    }
-    else
-    {
-        timeout.tv_sec  = 0;
-        timeout.tv_usec = 0;
-    }
-
-    if (timercmp(&timeout, &aTimeout, <))
-    {
-        aTimeout = timeout;
-    }
-}
-
-void Connection::UpdateFdSet(otSysMainloopContext &aMainloop) const
-{
-    UpdateTimeout(aMainloop.mTimeout);
-    UpdateReadFdSet(aMainloop.mReadFdSet, aMainloop.mMaxFd);
-    UpdateWriteFdSet(aMainloop.mWriteFdSet, aMainloop.mMaxFd);
+    return mTimeStamp + microseconds(timeoutLen);
 }
 
 void Connection::Disconnect(void)
@@ -139,12 +143,13 @@ void Connection::Disconnect(void)
 
     if (mFd != -1)
     {
+        MainloopPoller::Get().Unregister(mFd);
         close(mFd);
         mFd = -1;
     }
 }
 
-void Connection::Process(fd_set &aReadFdSet, fd_set &aWriteFdSet)
+void Connection::Process(void)
 {
     otbrError error = OTBR_ERROR_NONE;
 
@@ -153,14 +158,18 @@ void Connection::Process(fd_set &aReadFdSet, fd_set &aWriteFdSet)
     // Initial state, directly read for the first time.
     case ConnectionState::kInit:
     case ConnectionState::kReadWait:
-        ProcessWaitRead(aReadFdSet);
+    case ConnectionState::kIdleWait:
+        ProcessWaitRead();
+        break;
+    case ConnectionState::kHandleWait:
+        ProcessWaitHandle();
         break;
     case ConnectionState::kCallbackWait:
         //  Wait for Callback process.
         ProcessWaitCallback();
         break;
     case ConnectionState::kWriteWait:
-        ProcessWaitWrite(aWriteFdSet);
+        ProcessWaitWrite();
         break;
     default:
         assert(false);
@@ -172,27 +181,47 @@ void Connection::Process(fd_set &aReadFdSet, fd_set &aWriteFdSet)
     }
 }
 
-void Connection::ProcessWaitRead(fd_set &aReadFdSet)
+void Connection::ProcessWaitRead(void)
 {
     otbrError error    = OTBR_ERROR_NONE;
     int32_t   received = 0, err;
     char      buf[2048];
     auto      duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
 
-    // Reach a read timeout, will send response about this timeout later.
-    VerifyOrExit(duration <= kReadTimeout, error = OTBR_ERROR_REST);
+    if (mState == ConnectionState::kIdleWait)
+    {
+        // The client did not send another request in time, close the persistent connection without a response.
+        VerifyOrExit(duration <= kIdleTimeout, Disconnect());
+    }
+    else
+    {
+        // Reach a read timeout, will send response about this timeout later.
+        VerifyOrExit(duration <= kReadTimeout, error = OTBR_ERROR_REST);
+    }
 
     // It will succeed either fd is set or it is in kInit state.
-    VerifyOrExit(FD_ISSET(mFd, &aReadFdSet) || mState == ConnectionState::kInit);
+    VerifyOrExit(MainloopPoller::Get().IsReadable(mFd) || mState == ConnectionState::kInit);
 
     do
     {
-        mState   = ConnectionState::kReadWait;
         received = read(mFd, buf, sizeof(buf));
         err      = errno;
         if (received > 0)
         {
+            if (mState == ConnectionState::kIdleWait)
+            {
+                // The read timeout of the next request starts with its first data.
+                mTimeStamp = steady_clock::now();
+            }
+
+            mState = ConnectionState::kReadWait;
+            OTBR_USDT2(rest_parse_start, mFd, received);
             mParser.Process(buf, received);
+            OTBR_USDT2(rest_parse_done, mFd, mRequest.IsComplete());
+        }
+        else if (mState == ConnectionState::kInit)
+        {
+            mState = ConnectionState::kReadWait;
         }
     } while ((received > 0 && !mRequest.IsComplete()) || err == EINTR);
 
@@ -201,6 +230,9 @@ void Connection::ProcessWaitRead(fd_set &aReadFdSet)
         Handle();
     }
 
+    // The client closed an idle persistent connection.
+    VerifyOrExit(received != 0 || mState != ConnectionState::kIdleWait, Disconnect());
+
     // Check first failure situation: received == 0 (indicate another side at least has closes its write side )
     // and at the same time, the request has not been parsed completely.
     VerifyOrExit(received != 0 || mRequest.IsComplete(), error = OTBR_ERROR_REST);
@@ -229,16 +261,76 @@ void Connection::Handle(void)
 {
     otbrError error = OTBR_ERROR_NONE;
 
-    // Try to close server read side here, because we have started to handle the request and no longler read from
-    // socket.
-    VerifyOrExit((shutdown(mFd, SHUT_RD) == 0), error = OTBR_ERROR_REST);
+    ++mRequestCount;
+    mHandleTime = steady_clock::now();
 
-    mResource->Handle(mRequest, mResponse);
+    if (!mRequest.IsKeepAlive() || mRequestCount >= kMaxRequestsPerConnection)
+    {
+        // Try to close server read side here, because we have started to handle the request and no longler read from
+        // socket.
+        VerifyOrExit((shutdown(mFd, SHUT_RD) == 0), error = OTBR_ERROR_REST);
+    }
+
+    mResponse.SetCbor(mRequest.AcceptsCbor());
+    OTBR_USDT2(rest_handle_start, mFd, mRequest.GetRawUrl().c_str());
+    mState = ConnectionState::kHandleWait;
+
+    if (mBridge->IsEnabled())
+    {
+        // Nothing to poll on the socket until the resource handler returned on the mainloop.
+        MainloopPoller::Get().Register(mFd, 0);
+    }
+
+    ProcessWaitHandle();
+
+exit:
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
+        Write();
+    }
+}
+
+bool Connection::CallResource(OtBridge::Task aTask)
+{
+    bool done = false;
+
+    if (mCallState == kCallIdle)
+    {
+        // Without the REST thread, the bridge completes the call right away.
+        mCallState = kCallPending;
+        mBridge->Call(std::move(aTask), [this]() { mCallState = kCallDone; });
+    }
+
+    if (mCallState == kCallDone)
+    {
+        mCallState = kCallIdle;
+        done       = true;
+    }
+
+    return done;
+}
+
+void Connection::ProcessWaitHandle(void)
+{
+    VerifyOrExit(CallResource([this]() { mResource->Handle(mRequest, mResponse); }));
+
+    OTBR_USDT2(rest_handle_done, mFd, mResponse.NeedCallback());
+    mResponse.SetKeepAlive(mRequest.IsKeepAlive() && mRequestCount < kMaxRequestsPerConnection);
 
     if (mResponse.NeedCallback())
     {
+        // Nothing to poll on the socket until the response is ready.
+        MainloopPoller::Get().Register(mFd, 0);
         mState     = ConnectionState::kCallbackWait;
         mTimeStamp = steady_clock::now();
+
+        if (mResponse.IsStream())
+        {
+            // Send the header right away, the events follow as the callback handler appends them.
+            Write();
+        }
     }
     else
     {
@@ -247,21 +339,22 @@ void Connection::Handle(void)
     }
 
 exit:
-
-    if (error != OTBR_ERROR_NONE)
-    {
-        mResource->ErrorHandler(mResponse, HttpStatusCode::kStatusInternalServerError);
-        Write();
-    }
+    return;
 }
 
 void Connection::ProcessWaitCallback(void)
 {
     auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
 
-    mResource->HandleCallback(mRequest, mResponse);
+    VerifyOrExit(CallResource([this]() { mResource->HandleCallback(mRequest, mResponse); }));
 
-    if (mResponse.IsComplete())
+    if (mResponse.IsStream())
+    {
+        // Part of the stream may have been sent, it is too late to answer with an error.
+        VerifyOrExit(mResponse.IsComplete() || duration < kCallbackTimeout, Disconnect());
+        Write();
+    }
+    else if (mResponse.IsComplete())
     {
         Write();
     }
@@ -273,15 +366,18 @@ void Connection::ProcessWaitCallback(void)
             Write();
         }
     }
+
+exit:
+    return;
 }
 
-void Connection::ProcessWaitWrite(fd_set &aWriteFdSet)
+void Connection::ProcessWaitWrite(void)
 {
     auto duration = duration_cast<microseconds>(steady_clock::now() - mTimeStamp).count();
 
     if (duration <= kWriteTimeout)
     {
-        if (FD_ISSET(mFd, &aWriteFdSet))
+        if (MainloopPoller::Get().IsWritable(mFd))
         {
             Write();
         }
@@ -294,39 +390,120 @@ void Connection::ProcessWaitWrite(fd_set &aWriteFdSet)
 
 void Connection::Write(void)
 {
-    otbrError   error = OTBR_ERROR_NONE;
-    std::string errorCode;
-    int32_t     sendLength;
-    int32_t     err;
+    otbrError          error = OTBR_ERROR_NONE;
+    const std::string &body  = mResponse.GetBody();
+    struct iovec       iov[2];
+    int                iovCount = 0;
+    size_t             length;
+    ssize_t            sendLength;
+    int32_t            err;
+    // A stream is written in wait callback state as long as events are appended to it.
+    bool streaming = mResponse.IsStream() && !mResponse.IsComplete();
+
+    if (mWriteHeader.empty())
+    {
+        // Answer a conditional GET of an unchanged representation without the body.
+        if (mRequest.GetMethod() == HttpMethod::kGet && mResponse.GetResponseCode() == kHttpStatusOk &&
+            !mResponse.IsStream() && !mResponse.IsChunked())
+        {
+            mResponse.UpdateETag();
+
+            if (mRequest.MatchesIfNoneMatch(mResponse.GetETag()))
+            {
+                mResponse.SetNotModified();
+            }
+            else if (mRequest.AcceptsGzip())
+            {
+                mResponse.Compress();
+            }
+        }
 
-    if (mState != ConnectionState::kWriteWait)
+        if (mResponse.HasMoreChunks())
+        {
+            mResponse.NextChunk();
+        }
+
+        mWriteHeader = mResponse.SerializeHeader();
+        mWriteOffset = 0;
+
+        {
+            uint64_t duration =
+                static_cast<uint64_t>(duration_cast<microseconds>(steady_clock::now() - mHandleTime).count());
+
+            Metrics::Get().RecordRestResponse(static_cast<uint8_t>(mResponse.GetResponseCode()[0] - '0'), duration);
+            Trace::Get().Log(Trace::kEventRestResponse, strtoul(mResponse.GetResponseCode().c_str(), nullptr, 10),
+                             static_cast<uint32_t>(std::min<uint64_t>(duration, UINT32_MAX)));
+        }
+    }
+
+    if (mState != ConnectionState::kWriteWait && !streaming)
     {
-        // Change its state when try write for the first time.
-        mState        = ConnectionState::kWriteWait;
-        mTimeStamp    = steady_clock::now();
-        mWriteContent = mResponse.Serialize();
+        // Change its state when try write the complete response for the first time.
+        mState     = ConnectionState::kWriteWait;
+        mTimeStamp = steady_clock::now();
     }
 
-    // Check we do have something to write.
-    VerifyOrExit(mWriteContent.size() > 0, error = OTBR_ERROR_REST);
+    length = mWriteHeader.size() + body.size();
+
+    // Check we do have something to write, a stream may be waiting for its next event.
+    VerifyOrExit(mWriteOffset < length, error = streaming ? OTBR_ERROR_NONE : OTBR_ERROR_REST);
+
+    // Send the rest of the header and the body from where the last write stopped, without copying the body.
+    if (mWriteOffset < mWriteHeader.size())
+    {
+        iov[iovCount].iov_base = const_cast<char *>(mWriteHeader.data() + mWriteOffset);
+        iov[iovCount].iov_len  = mWriteHeader.size() - mWriteOffset;
+        iovCount++;
+        iov[iovCount].iov_base = const_cast<char *>(body.data());
+        iov[iovCount].iov_len  = body.size();
+        iovCount++;
+    }
+    else
+    {
+        iov[iovCount].iov_base = const_cast<char *>(body.data() + mWriteOffset - mWriteHeader.size());
+        iov[iovCount].iov_len  = length - mWriteOffset;
+        iovCount++;
+    }
 
-    sendLength = write(mFd, mWriteContent.c_str(), mWriteContent.size());
+    sendLength = writev(mFd, iov, iovCount);
     err        = errno;
+    OTBR_USDT2(rest_write, mFd, sendLength);
 
-    // Write successfully
-    if (sendLength == static_cast<int32_t>(mWriteContent.size()))
+    if (sendLength > 0)
     {
-        // Normal Exit
-        Disconnect();
+        mWriteOffset += static_cast<size_t>(sendLength);
     }
-    else if (sendLength > 0)
+
+    // Write successfully
+    if (mWriteOffset == length)
     {
-        // Partly write
-        mWriteContent = mWriteContent.substr(sendLength);
+        if (mResponse.HasMoreChunks())
+        {
+            // Produce the next chunk only once the previous one has been written, and send it when the socket
+            // becomes writable again.
+            mResponse.NextChunk();
+            mWriteOffset = mWriteHeader.size();
+            mTimeStamp   = steady_clock::now();
+            MainloopPoller::Get().Register(mFd, MainloopPoller::kEventWrite);
+        }
+        else if (streaming)
+        {
+            // Nothing to poll on the socket until the next event.
+            MainloopPoller::Get().Register(mFd, 0);
+        }
+        else if (mResponse.IsKeepAlive())
+        {
+            WaitNextRequest();
+        }
+        else
+        {
+            // Normal Exit
+            Disconnect();
+        }
     }
-    else
+    else if (sendLength <= 0)
     {
-        if (errno == EINTR)
+        if (err == EINTR)
         {
             // Try again
             Write();
@@ -335,8 +512,14 @@ void Connection::Write(void)
         {
             // There is an error when we write, if this, we directly disconnect this connection.
             VerifyOrExit(err == EAGAIN || err == EWOULDBLOCK, error = OTBR_ERROR_REST);
+            MainloopPoller::Get().Register(mFd, MainloopPoller::kEventWrite);
         }
     }
+    else
+    {
+        // Wait for the socket to write the rest.
+        MainloopPoller::Get().Register(mFd, MainloopPoller::kEventWrite);
+    }
 
 exit:
     if (error != OTBR_ERROR_NONE)
@@ -345,6 +528,29 @@ exit:
     }
 }
 
+void Connection::WaitNextRequest(void)
+{
+    mRequest.Reset();
+    mResponse.Reset();
+    mWriteHeader.clear();
+    mWriteOffset = 0;
+    mTimeStamp = steady_clock::now();
+    MainloopPoller::Get().Register(mFd, MainloopPoller::kEventRead);
+
+    // Pipelined requests already read are parsed here, and handled one by one so the responses keep their order.
+    mState = mParser.Resume() ? ConnectionState::kReadWait : ConnectionState::kIdleWait;
+
+    if (mRequest.IsComplete())
+    {
+        Handle();
+    }
+}
+
+bool Connection::IsWaitingCallback(void) const
+{
+    return mState == ConnectionState::kHandleWait || mState == ConnectionState::kCallbackWait;
+}
+
 bool Connection::IsComplete() const
 {
     return mState == ConnectionState::kComplete;
@@ -37,6 +37,7 @@
 #include <string.h>
 #include <unistd.h>
 
+#include "rest/ot_bridge.hpp"
 #include "rest/parser.hpp"
 #include "rest/resource.hpp"
 
@@ -58,10 +59,11 @@ public:
      * @param[in]   aStartTime  The reference start time of a conneciton which is set when created for the first time
      * and maybe reset when transfer to wait callback or wait write state.
      * @param[in]   aResource   A pointer to the resource handler.
+     * @param[in]   aBridge     A pointer to the bridge the resource handler is called through.
      * @param[in]   aFd         The file descriptor for the conneciton.
      *
      */
-    Connection(steady_clock::time_point aStartTime, Resource *aResource, int aFd);
+    Connection(steady_clock::time_point aStartTime, Resource *aResource, OtBridge *aBridge, int aFd);
 
     /**
      * This method initializes the connection.
@@ -70,22 +72,41 @@ public:
      */
     void Init(void);
 
+    /**
+     * This method resets a completed connection to serve a new socket, keeping the memory of its buffers.
+     *
+     * `Init()` needs to be called again before the connection is processed.
+     *
+     * @param[in]   aStartTime  The reference start time of the new connection.
+     * @param[in]   aFd         The file descriptor for the new conneciton.
+     *
+     */
+    void Reset(steady_clock::time_point aStartTime, int aFd);
+
     /**
      * This method performs processing.
      *
-     * @param[in]       aReadFdSet    The read file descriptors.
-     * @param[in]       aWriteFdSet   The write file descriptors.
+     * The socket readiness is taken from `MainloopPoller`, which this connection registers its socket with.
+     *
+     */
+    void Process(void);
+
+    /**
+     * This method returns the time this connection needs to be processed even if its socket has no events.
+     *
+     * @returns The time point to process this connection.
      *
      */
-    void Process(fd_set &aReadFdSet, fd_set &aWriteFdSet);
+    steady_clock::time_point GetTimeout(void) const;
 
     /**
-     * This method updates the file descriptor sets and timeout for mainloop.
+     * This method indicates whether this connection waits for the resource or callback handler to set its response.
      *
-     * @param[inout]    aMainloop   A reference to OpenThread mainloop context.
+     * @retval  true     This connection waits for a handler.
+     * @retval  false    This connection does not wait for a handler.
      *
      */
-    void UpdateFdSet(otSysMainloopContext &aMainloop) const;
+    bool IsWaitingCallback(void) const;
 
     /**
      * This method indicates whether this connection no longer need to be processed.
@@ -97,19 +118,29 @@ public:
     bool IsComplete(void) const;
 
 private:
-    void UpdateReadFdSet(fd_set &aReadFdSet, int &aMaxFd) const;
-    void UpdateWriteFdSet(fd_set &aWriteFdSet, int &aMaxFd) const;
-    void UpdateTimeout(timeval &aTimeout) const;
-    void ProcessWaitRead(fd_set &aReadFdSet);
+    enum CallState : uint8_t
+    {
+        kCallIdle,    // No call of the resource handler in progress
+        kCallPending, // The resource handler is called on the mainloop
+        kCallDone,    // The resource handler returned, the response is ready to be used
+    };
+
+    bool CallResource(OtBridge::Task aTask);
+    void ProcessWaitRead(void);
+    void ProcessWaitHandle(void);
     void ProcessWaitCallback(void);
-    void ProcessWaitWrite(fd_set &aWriteFdSet);
+    void ProcessWaitWrite(void);
     void Write(void);
     void Handle(void);
     void Disconnect(void);
+    void WaitNextRequest(void);
 
     // Timestamp used for each check point of a connection
     steady_clock::time_point mTimeStamp;
 
+    // Timestamp when the current request started being handled
+    steady_clock::time_point mHandleTime;
+
     // File descriptor for this connection
     int mFd;
 
@@ -128,8 +159,20 @@ private:
     // Resource handler instance
     Resource *mResource;
 
-    // Write buffer in case write multiple times
-    std::string mWriteContent;
+    // Bridge running the resource handler on the mainloop
+    OtBridge *mBridge;
+
+    // State of the call of the resource handler, the request and response are not touched while it is pending
+    CallState mCallState;
+
+    // Serialized status line and headers of the response, followed by the response body when written
+    std::string mWriteHeader;
+
+    // Number of bytes of the response written in case write multiple times
+    size_t mWriteOffset;
+
+    // Number of requests handled on this connection
+    uint32_t mRequestCount;
 };
 
 } // namespace rest
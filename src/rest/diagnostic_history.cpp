@@ -0,0 +1,229 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the network diagnostic history for OTBR-REST.
+ */
+
+#include "rest/diagnostic_history.hpp"
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "rest/diagnostic_store.hpp"
+
+namespace otbr {
+namespace rest {
+
+// The RLOC16 bits of the router id, which change when a child attaches to another parent
+static const uint16_t kRouterIdMask = 0xfc00;
+
+void DiagnosticHistory::Init(size_t aMemoryCap)
+{
+    size_t numSeries = aMemoryCap / (kSamplesPerNode * sizeof(Sample) + sizeof(Series));
+
+    mSamples.assign(numSeries * kSamplesPerNode, Sample());
+    mSeries.assign(numSeries, Series());
+    mIndex.clear();
+    mIndex.reserve(numSeries);
+
+    for (size_t i = 0; i < numSeries; ++i)
+    {
+        mSeries[i].mBase = i * kSamplesPerNode;
+    }
+}
+
+DiagnosticHistory::Series *DiagnosticHistory::Acquire(const otExtAddress &aExtAddress)
+{
+    uint64_t key    = DiagnosticStore::GetExtAddressKey(aExtAddress);
+    auto     it     = mIndex.find(key);
+    Series * series = nullptr;
+
+    VerifyOrExit(it == mIndex.end(), series = &mSeries[it->second]);
+
+    // Take a free series, or the one of the node which has not reported for the longest time.
+    for (Series &candidate : mSeries)
+    {
+        if (!candidate.mInUse)
+        {
+            series = &candidate;
+            break;
+        }
+
+        if (series == nullptr || GetSample(candidate, candidate.mCount - 1).mTimestamp <
+                                     GetSample(*series, series->mCount - 1).mTimestamp)
+        {
+            series = &candidate;
+        }
+    }
+
+    if (series->mInUse)
+    {
+        mIndex.erase(DiagnosticStore::GetExtAddressKey(series->mExtAddress));
+    }
+
+    series->mExtAddress    = aExtAddress;
+    series->mInUse         = true;
+    series->mOldest        = 0;
+    series->mCount         = 0;
+    series->mParentChanges = 0;
+    mIndex[key]            = static_cast<size_t>(series - mSeries.data());
+
+exit:
+    return series;
+}
+
+void DiagnosticHistory::Record(const otExtAddress &    aExtAddress,
+                               uint16_t                aRloc16,
+                               const otNetworkDiagTlv *aTlvs,
+                               size_t                  aCount,
+                               uint64_t                aTimestamp)
+{
+    Sample  sample;
+    Series *series;
+
+    VerifyOrExit(IsEnabled());
+
+    memset(&sample, 0, sizeof(sample));
+
+    for (size_t i = 0; i < aCount; ++i)
+    {
+        const otNetworkDiagTlv &tlv = aTlvs[i];
+
+        switch (tlv.mType)
+        {
+        case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
+            sample.mIfInUcastPkts  = tlv.mData.mMacCounters.mIfInUcastPkts;
+            sample.mIfOutUcastPkts = tlv.mData.mMacCounters.mIfOutUcastPkts;
+            sample.mIfInErrors     = tlv.mData.mMacCounters.mIfInErrors;
+            sample.mIfOutErrors    = tlv.mData.mMacCounters.mIfOutErrors;
+            sample.mIfInDiscards   = tlv.mData.mMacCounters.mIfInDiscards;
+            sample.mIfOutDiscards  = tlv.mData.mMacCounters.mIfOutDiscards;
+            sample.mFlags |= Sample::kHasMacCounters;
+            break;
+
+        case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
+            sample.mLinkQuality3 = tlv.mData.mConnectivity.mLinkQuality3;
+            sample.mLinkQuality2 = tlv.mData.mConnectivity.mLinkQuality2;
+            sample.mLinkQuality1 = tlv.mData.mConnectivity.mLinkQuality1;
+            sample.mFlags |= Sample::kHasConnectivity;
+            break;
+
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
+            sample.mChildCount = tlv.mData.mChildTable.mCount;
+            sample.mFlags |= Sample::kHasChildTable;
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    VerifyOrExit(sample.mFlags != 0);
+
+    series = Acquire(aExtAddress);
+
+    if (series->mCount > 0 &&
+        (GetSample(*series, series->mCount - 1).mRloc16 & kRouterIdMask) != (aRloc16 & kRouterIdMask))
+    {
+        ++series->mParentChanges;
+    }
+
+    sample.mTimestamp     = aTimestamp;
+    sample.mRloc16        = aRloc16;
+    sample.mParentChanges = series->mParentChanges;
+
+    mSamples[series->mBase + (series->mOldest + series->mCount) % kSamplesPerNode] = sample;
+
+    if (series->mCount < kSamplesPerNode)
+    {
+        ++series->mCount;
+    }
+    else
+    {
+        series->mOldest = (series->mOldest + 1) % kSamplesPerNode;
+    }
+
+exit:
+    return;
+}
+
+const DiagnosticHistory::Series *DiagnosticHistory::Find(const otExtAddress &aExtAddress) const
+{
+    auto it = mIndex.find(DiagnosticStore::GetExtAddressKey(aExtAddress));
+
+    return it == mIndex.end() ? nullptr : &mSeries[it->second];
+}
+
+const DiagnosticHistory::Series *DiagnosticHistory::Find(uint16_t aRloc16) const
+{
+    const Series *series = nullptr;
+
+    for (const Series &candidate : mSeries)
+    {
+        if (candidate.mInUse && GetSample(candidate, candidate.mCount - 1).mRloc16 == aRloc16)
+        {
+            series = &candidate;
+            break;
+        }
+    }
+
+    return series;
+}
+
+void DiagnosticHistory::GetSeries(std::vector<const Series *> &aSeries) const
+{
+    aSeries.clear();
+
+    for (const Series &series : mSeries)
+    {
+        if (series.mInUse)
+        {
+            aSeries.push_back(&series);
+        }
+    }
+}
+
+void DiagnosticHistory::GetSamples(const Series &aSeries, uint64_t aSince, std::vector<const Sample *> &aSamples) const
+{
+    aSamples.clear();
+
+    for (size_t i = 0; i < aSeries.mCount; ++i)
+    {
+        const Sample &sample = GetSample(aSeries, i);
+
+        if (sample.mTimestamp >= aSince)
+        {
+            aSamples.push_back(&sample);
+        }
+    }
+}
+
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,190 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the network diagnostic history for OTBR-REST.
+ */
+
+#ifndef OTBR_REST_DIAGNOSTIC_HISTORY_HPP_
+#define OTBR_REST_DIAGNOSTIC_HISTORY_HPP_
+
+#include <unordered_map>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "openthread/netdiag.h"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a bounded history of key diagnostic values of each node.
+ *
+ * The samples are kept in a ring buffer of `kSamplesPerNode` samples per node, preallocated at initialization from
+ * a memory cap, so recording does not allocate. Nodes are identified by their extended address. When all the rings
+ * are in use, the ring of the node which has not reported for the longest time is reused.
+ *
+ */
+class DiagnosticHistory
+{
+public:
+    static const size_t kSamplesPerNode = 32; ///< The number of samples kept per node.
+
+    /**
+     * This structure represents the diagnostic values of a node at a point in time.
+     *
+     */
+    struct Sample
+    {
+        enum : uint8_t
+        {
+            kHasMacCounters  = 1 << 0, ///< The MAC counters are valid.
+            kHasConnectivity = 1 << 1, ///< The link quality counts are valid.
+            kHasChildTable   = 1 << 2, ///< The child count is valid.
+        };
+
+        uint64_t mTimestamp;      ///< The time the sample was recorded, in milliseconds since the Unix epoch.
+        uint32_t mIfInUcastPkts;  ///< The number of unicast frames received.
+        uint32_t mIfOutUcastPkts; ///< The number of unicast frames sent.
+        uint32_t mIfInErrors;     ///< The number of frames received with errors.
+        uint32_t mIfOutErrors;    ///< The number of frames failed to send.
+        uint32_t mIfInDiscards;   ///< The number of received frames discarded.
+        uint32_t mIfOutDiscards;  ///< The number of frames discarded before sending.
+        uint16_t mRloc16;         ///< The RLOC16 of the node.
+        uint16_t mParentChanges;  ///< The number of times the node was seen with a new parent or router id.
+        uint8_t  mLinkQuality3;   ///< The number of neighbors with link quality 3.
+        uint8_t  mLinkQuality2;   ///< The number of neighbors with link quality 2.
+        uint8_t  mLinkQuality1;   ///< The number of neighbors with link quality 1.
+        uint8_t  mChildCount;     ///< The number of children.
+        uint8_t  mFlags;          ///< The valid values, a bitwise OR of `kHas*`.
+    };
+
+    /**
+     * This structure represents the history of a node.
+     *
+     */
+    struct Series
+    {
+        otExtAddress mExtAddress;    ///< The extended address of the node.
+        bool         mInUse;         ///< Whether the series belongs to a node.
+        size_t       mBase;          ///< The index of the first sample of the ring.
+        size_t       mOldest;        ///< The index of the oldest sample in the ring.
+        size_t       mCount;         ///< The number of samples in the ring.
+        uint16_t     mParentChanges; ///< The number of times the node was seen with a new parent or router id.
+    };
+
+    /**
+     * This method allocates the history.
+     *
+     * @param[in]   aMemoryCap  The maximum number of bytes the history uses, zero disables the history.
+     *
+     */
+    void Init(size_t aMemoryCap);
+
+    /**
+     * This method indicates whether the history is enabled.
+     *
+     */
+    bool IsEnabled(void) const { return !mSeries.empty(); }
+
+    /**
+     * This method records a sample from a diagnostic response.
+     *
+     * Nothing is recorded if the response carries none of the sampled TLV types.
+     *
+     * @param[in]   aExtAddress     The extended address of the node.
+     * @param[in]   aRloc16         The RLOC16 of the node.
+     * @param[in]   aTlvs           A pointer to the TLVs of the response.
+     * @param[in]   aCount          The number of TLVs.
+     * @param[in]   aTimestamp      The current time in milliseconds since the Unix epoch.
+     *
+     */
+    void Record(const otExtAddress &    aExtAddress,
+                uint16_t                aRloc16,
+                const otNetworkDiagTlv *aTlvs,
+                size_t                  aCount,
+                uint64_t                aTimestamp);
+
+    /**
+     * This method finds the history of a node by its extended address.
+     *
+     * @param[in]   aExtAddress     The extended address.
+     *
+     * @returns A pointer to the series, or nullptr if the node has no history.
+     *
+     */
+    const Series *Find(const otExtAddress &aExtAddress) const;
+
+    /**
+     * This method finds the history of a node by the RLOC16 of its latest sample.
+     *
+     * @param[in]   aRloc16     The RLOC16.
+     *
+     * @returns A pointer to the series, or nullptr if no node has the RLOC16.
+     *
+     */
+    const Series *Find(uint16_t aRloc16) const;
+
+    /**
+     * This method lists the histories of all nodes.
+     *
+     * @param[out]  aSeries     The series.
+     *
+     */
+    void GetSeries(std::vector<const Series *> &aSeries) const;
+
+    /**
+     * This method lists the samples of a node recorded at or after a time, oldest first.
+     *
+     * @param[in]   aSeries     The series.
+     * @param[in]   aSince      The time in milliseconds since the Unix epoch.
+     * @param[out]  aSamples    The samples.
+     *
+     */
+    void GetSamples(const Series &aSeries, uint64_t aSince, std::vector<const Sample *> &aSamples) const;
+
+private:
+    const Sample &GetSample(const Series &aSeries, size_t aIndex) const
+    {
+        return mSamples[aSeries.mBase + (aSeries.mOldest + aIndex) % kSamplesPerNode];
+    }
+
+    Series *Acquire(const otExtAddress &aExtAddress);
+
+    std::vector<Sample>                  mSamples;
+    std::vector<Series>                  mSeries;
+    std::unordered_map<uint64_t, size_t> mIndex;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_DIAGNOSTIC_HISTORY_HPP_
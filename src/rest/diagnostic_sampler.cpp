@@ -0,0 +1,129 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the adaptive network diagnostic sampler for OTBR-REST.
+ */
+
+#include "rest/diagnostic_sampler.hpp"
+
+#include <algorithm>
+
+namespace otbr {
+namespace rest {
+
+const uint8_t DiagnosticSampler::kMaxBackoff;
+
+bool DiagnosticSampler::IsIdentity(uint8_t aType)
+{
+    return aType == OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS || aType == OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS;
+}
+
+DiagnosticSampler::TlvState *DiagnosticSampler::FindState(TlvStates &aStates, uint8_t aType)
+{
+    auto it = std::find_if(aStates.begin(), aStates.end(),
+                           [aType](const TlvState &aState) { return aState.mType == aType; });
+
+    return it == aStates.end() ? nullptr : &*it;
+}
+
+void DiagnosticSampler::StartRound(uint16_t              aRloc16,
+                                   const uint8_t *       aTlvTypes,
+                                   size_t                aCount,
+                                   std::vector<uint8_t> &aDueTypes)
+{
+    auto node = mNodes.find(aRloc16);
+
+    aDueTypes.clear();
+
+    for (size_t i = 0; i < aCount; ++i)
+    {
+        TlvState *state = (node == mNodes.end()) ? nullptr : FindState(node->second, aTlvTypes[i]);
+
+        if (state != nullptr && state->mRounds < state->mBackoff)
+        {
+            ++state->mRounds;
+        }
+
+        // A TLV whose query was lost stays due until it is answered.
+        if (IsIdentity(aTlvTypes[i]) || state == nullptr || state->mRounds >= state->mBackoff)
+        {
+            aDueTypes.push_back(aTlvTypes[i]);
+        }
+    }
+}
+
+void DiagnosticSampler::Record(uint16_t                    aRloc16,
+                               const otNetworkDiagTlv *    aTlvs,
+                               size_t                      aCount,
+                               const std::vector<uint8_t> &aChangedTypes)
+{
+    TlvStates &states = mNodes[aRloc16];
+
+    for (size_t i = 0; i < aCount; ++i)
+    {
+        uint8_t   type  = aTlvs[i].mType;
+        TlvState *state = FindState(states, type);
+
+        if (state == nullptr)
+        {
+            states.push_back(TlvState{type, 1, 0});
+        }
+        else
+        {
+            bool changed = std::find(aChangedTypes.begin(), aChangedTypes.end(), type) != aChangedTypes.end();
+
+            state->mBackoff = changed ? 1 : std::min<uint8_t>(static_cast<uint8_t>(state->mBackoff * 2), kMaxBackoff);
+            state->mRounds  = 0;
+        }
+    }
+}
+
+uint8_t DiagnosticSampler::GetBackoff(uint16_t aRloc16, uint8_t aType) const
+{
+    auto    node    = mNodes.find(aRloc16);
+    uint8_t backoff = 0;
+
+    if (node != mNodes.end())
+    {
+        for (const TlvState &state : node->second)
+        {
+            if (state.mType == aType)
+            {
+                backoff = state.mBackoff;
+                break;
+            }
+        }
+    }
+
+    return backoff;
+}
+
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,129 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the adaptive network diagnostic sampler for OTBR-REST.
+ */
+
+#ifndef OTBR_REST_DIAGNOSTIC_SAMPLER_HPP_
+#define OTBR_REST_DIAGNOSTIC_SAMPLER_HPP_
+
+#include <unordered_map>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "openthread/netdiag.h"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class learns which diagnostic TLVs of each node change, so the crawler polls volatile TLVs every round and
+ * static ones less often.
+ *
+ * Each TLV type of a node has a backoff, the number of crawl rounds of the node between two queries of the TLV. The
+ * backoff is reset to one round when an answer shows the TLV changed, and doubled up to `kMaxBackoff` rounds when it
+ * did not. MAC counters thus stay polled every round, while the mode or the IPv6 address list are cached longer.
+ *
+ */
+class DiagnosticSampler
+{
+public:
+    static const uint8_t kMaxBackoff = 16; ///< The maximum number of rounds between two queries of a TLV.
+
+    /**
+     * This method starts a crawl round of a node and selects the TLV types to query it for.
+     *
+     * A TLV type is due if the node has not answered it yet, or it was not answered for as many rounds as its
+     * backoff. The Address16 and Extended MAC Address TLVs identify the node in the diagnostic store, so they are
+     * always due.
+     *
+     * @param[in]   aRloc16     The RLOC16 of the node.
+     * @param[in]   aTlvTypes   A pointer to the TLV types to sample.
+     * @param[in]   aCount      The number of TLV types.
+     * @param[out]  aDueTypes   The TLV types to query the node for in this round.
+     *
+     */
+    void StartRound(uint16_t aRloc16, const uint8_t *aTlvTypes, size_t aCount, std::vector<uint8_t> &aDueTypes);
+
+    /**
+     * This method records the TLVs of a diagnostic response of a node.
+     *
+     * @param[in]   aRloc16         The RLOC16 of the node.
+     * @param[in]   aTlvs           A pointer to the TLVs of the response.
+     * @param[in]   aCount          The number of TLVs.
+     * @param[in]   aChangedTypes   The types of the TLVs whose value changed, see `DiagnosticStore::Update()`.
+     *
+     */
+    void Record(uint16_t                    aRloc16,
+                const otNetworkDiagTlv *    aTlvs,
+                size_t                      aCount,
+                const std::vector<uint8_t> &aChangedTypes);
+
+    /**
+     * This method forgets what was learned about a node.
+     *
+     * @param[in]   aRloc16     The RLOC16 of the node.
+     *
+     */
+    void Remove(uint16_t aRloc16) { mNodes.erase(aRloc16); }
+
+    /**
+     * This method returns the backoff of a TLV type of a node.
+     *
+     * @param[in]   aRloc16     The RLOC16 of the node.
+     * @param[in]   aType       The TLV type.
+     *
+     * @returns The number of rounds between two queries of the TLV, or zero if the node has not answered it yet.
+     *
+     */
+    uint8_t GetBackoff(uint16_t aRloc16, uint8_t aType) const;
+
+private:
+    struct TlvState
+    {
+        uint8_t mType;
+        uint8_t mBackoff; // The number of rounds between two queries.
+        uint8_t mRounds;  // The number of rounds since the TLV was last answered, up to `mBackoff`.
+    };
+
+    typedef std::vector<TlvState> TlvStates;
+
+    static bool      IsIdentity(uint8_t aType);
+    static TlvState *FindState(TlvStates &aStates, uint8_t aType);
+
+    std::unordered_map<uint16_t, TlvStates> mNodes;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_DIAGNOSTIC_SAMPLER_HPP_
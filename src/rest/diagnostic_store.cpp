@@ -0,0 +1,218 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the network diagnostic store for OTBR-REST.
+ */
+
+#include "rest/diagnostic_store.hpp"
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace rest {
+
+uint64_t DiagnosticStore::GetExtAddressKey(const otExtAddress &aExtAddress)
+{
+    uint64_t key = 0;
+
+    for (uint8_t byte : aExtAddress.m8)
+    {
+        key = (key << 8) | byte;
+    }
+
+    return key;
+}
+
+const DiagnosticStore::Entry *DiagnosticStore::Update(const otNetworkDiagTlv *   aTlvs,
+                                                      size_t                   aCount,
+                                                      steady_clock::time_point aNow,
+                                                      std::vector<uint8_t> *   aChangedTypes)
+{
+    const uint16_t *    rloc16     = nullptr;
+    const otExtAddress *extAddress = nullptr;
+    Entry *             entry      = nullptr;
+
+    for (size_t i = 0; i < aCount; ++i)
+    {
+        if (aTlvs[i].mType == OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS)
+        {
+            rloc16 = &aTlvs[i].mData.mAddr16;
+        }
+        else if (aTlvs[i].mType == OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS)
+        {
+            extAddress = &aTlvs[i].mData.mExtAddress;
+        }
+    }
+
+    if (rloc16 != nullptr)
+    {
+        entry = FindOrCreate(*rloc16, extAddress);
+    }
+    else if (extAddress != nullptr)
+    {
+        auto it = mExtAddressIndex.find(GetExtAddressKey(*extAddress));
+
+        if (it != mExtAddressIndex.end())
+        {
+            entry = &mEntries.find(it->second)->second;
+        }
+    }
+
+    VerifyOrExit(entry != nullptr);
+
+    if (aChangedTypes != nullptr)
+    {
+        aChangedTypes->clear();
+    }
+
+    for (size_t i = 0; i < aCount; ++i)
+    {
+        bool merged  = false;
+        bool changed = true;
+
+        for (otNetworkDiagTlv &tlv : entry->mTlvs)
+        {
+            if (tlv.mType == aTlvs[i].mType)
+            {
+                changed = (memcmp(&tlv, &aTlvs[i], sizeof(tlv)) != 0);
+                tlv     = aTlvs[i];
+                merged  = true;
+                break;
+            }
+        }
+
+        if (!merged)
+        {
+            entry->mTlvs.push_back(aTlvs[i]);
+        }
+
+        if (changed && aChangedTypes != nullptr)
+        {
+            aChangedTypes->push_back(aTlvs[i].mType);
+        }
+    }
+
+    entry->mUpdateTime = aNow;
+    mExpiryQueue.splice(mExpiryQueue.end(), mExpiryQueue, entry->mExpiryIt);
+
+exit:
+    return entry;
+}
+
+DiagnosticStore::Entry *DiagnosticStore::FindOrCreate(uint16_t aRloc16, const otExtAddress *aExtAddress)
+{
+    auto   it    = mEntries.find(aRloc16);
+    Entry *entry = nullptr;
+
+    if (it != mEntries.end() && aExtAddress != nullptr && it->second.mHasExtAddress &&
+        memcmp(it->second.mExtAddress.m8, aExtAddress->m8, sizeof(aExtAddress->m8)) != 0)
+    {
+        // The RLOC16 has been taken over by another node.
+        Remove(it);
+        it = mEntries.end();
+    }
+
+    if (aExtAddress != nullptr)
+    {
+        auto index = mExtAddressIndex.find(GetExtAddressKey(*aExtAddress));
+
+        if (index != mExtAddressIndex.end() && index->second != aRloc16)
+        {
+            // The node has a new RLOC16, drop what it reported with the old one.
+            Remove(mEntries.find(index->second));
+        }
+    }
+
+    if (it == mEntries.end())
+    {
+        entry                 = &mEntries[aRloc16];
+        entry->mRloc16        = aRloc16;
+        entry->mHasExtAddress = false;
+        entry->mExpiryIt      = mExpiryQueue.insert(mExpiryQueue.end(), aRloc16);
+    }
+    else
+    {
+        entry = &it->second;
+    }
+
+    if (aExtAddress != nullptr && !entry->mHasExtAddress)
+    {
+        entry->mHasExtAddress                            = true;
+        entry->mExtAddress                               = *aExtAddress;
+        mExtAddressIndex[GetExtAddressKey(*aExtAddress)] = aRloc16;
+    }
+
+    return entry;
+}
+
+void DiagnosticStore::Remove(EntryMap::iterator aIt)
+{
+    uint16_t rloc16 = aIt->first;
+
+    if (aIt->second.mHasExtAddress)
+    {
+        mExtAddressIndex.erase(GetExtAddressKey(aIt->second.mExtAddress));
+    }
+
+    mExpiryQueue.erase(aIt->second.mExpiryIt);
+    mEntries.erase(aIt);
+
+    if (mRemovedHandler)
+    {
+        mRemovedHandler(rloc16);
+    }
+}
+
+void DiagnosticStore::Expire(steady_clock::time_point aNow)
+{
+    while (!mExpiryQueue.empty())
+    {
+        auto it = mEntries.find(mExpiryQueue.front());
+
+        if (aNow - it->second.mUpdateTime < mTtl)
+        {
+            break;
+        }
+
+        Remove(it);
+    }
+}
+
+const DiagnosticStore::Entry *DiagnosticStore::Find(uint16_t aRloc16) const
+{
+    auto it = mEntries.find(aRloc16);
+
+    return it == mEntries.end() ? nullptr : &it->second;
+}
+
+} // namespace rest
+} // namespace otbr
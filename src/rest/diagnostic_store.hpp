@@ -0,0 +1,178 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the network diagnostic store for OTBR-REST.
+ */
+
+#ifndef OTBR_REST_DIAGNOSTIC_STORE_HPP_
+#define OTBR_REST_DIAGNOSTIC_STORE_HPP_
+
+#include <chrono>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "openthread/netdiag.h"
+
+using std::chrono::steady_clock;
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a store of the network diagnostics received from each node.
+ *
+ * Entries are keyed by the RLOC16 of the node and also indexed by its extended address, so an entry follows a node
+ * whose RLOC16 changed. A diagnostic response is merged into the entry of the node TLV by TLV, a partial response
+ * only replaces the TLVs it carries. Entries which have not been updated for the time to live are expired in the
+ * order they were last updated, without visiting the other entries.
+ *
+ */
+class DiagnosticStore
+{
+public:
+    /**
+     * This structure represents the diagnostics of a node.
+     *
+     */
+    struct Entry
+    {
+        uint16_t                      mRloc16;        ///< The RLOC16 of the node.
+        bool                          mHasExtAddress; ///< Whether the extended address of the node is known.
+        otExtAddress                  mExtAddress;    ///< The extended address of the node.
+        steady_clock::time_point      mUpdateTime;    ///< The time the last diagnostic response was merged.
+        std::vector<otNetworkDiagTlv> mTlvs;          ///< The TLVs received from the node, one per TLV type.
+        std::list<uint16_t>::iterator mExpiryIt;      ///< The position of the entry in the expiry queue.
+    };
+
+    typedef std::unordered_map<uint16_t, Entry> EntryMap;
+
+    /**
+     * The constructor initializes an empty store.
+     *
+     * @param[in]   aTtl    The time an entry is kept after its last update.
+     *
+     */
+    explicit DiagnosticStore(steady_clock::duration aTtl)
+        : mTtl(aTtl)
+    {
+    }
+
+    /**
+     * This method sets the time an entry is kept after its last update.
+     *
+     * @param[in]   aTtl    The time to live.
+     *
+     */
+    void SetTtl(steady_clock::duration aTtl) { mTtl = aTtl; }
+
+    /**
+     * This method sets the handler called with the RLOC16 of each entry removed, expired or not.
+     *
+     * @param[in]   aHandler    The handler.
+     *
+     */
+    void SetRemovedHandler(std::function<void(uint16_t)> aHandler) { mRemovedHandler = std::move(aHandler); }
+
+    /**
+     * This method merges a diagnostic response into the entry of the node which sent it.
+     *
+     * The node is identified by the Address16 TLV, or by the Extended MAC Address TLV if the former is absent.
+     * TLVs are compared byte by byte, so the caller should clear each TLV before it is read.
+     *
+     * @param[in]   aTlvs           A pointer to the TLVs of the response.
+     * @param[in]   aCount          The number of TLVs.
+     * @param[in]   aNow            The current time.
+     * @param[out]  aChangedTypes   If not nullptr, the types of the TLVs which were new or had another value.
+     *
+     * @returns A pointer to the updated entry, or nullptr if the response identifies no known node.
+     *
+     */
+    const Entry *Update(const otNetworkDiagTlv * aTlvs,
+                        size_t                   aCount,
+                        steady_clock::time_point aNow,
+                        std::vector<uint8_t> *   aChangedTypes = nullptr);
+
+    /**
+     * This method removes the entries which have not been updated for the time to live.
+     *
+     * @param[in]   aNow    The current time.
+     *
+     */
+    void Expire(steady_clock::time_point aNow);
+
+    /**
+     * This method finds the entry of a node.
+     *
+     * @param[in]   aRloc16     The RLOC16 of the node.
+     *
+     * @returns A pointer to the entry, or nullptr if there is none.
+     *
+     */
+    const Entry *Find(uint16_t aRloc16) const;
+
+    /**
+     * This method returns the entries, in no particular order.
+     *
+     */
+    const EntryMap &GetEntries(void) const { return mEntries; }
+
+    /**
+     * This method converts an extended address to an integer key.
+     *
+     * @param[in]   aExtAddress     The extended address.
+     *
+     * @returns The extended address as a big-endian integer.
+     *
+     */
+    static uint64_t GetExtAddressKey(const otExtAddress &aExtAddress);
+
+private:
+
+    Entry *FindOrCreate(uint16_t aRloc16, const otExtAddress *aExtAddress);
+    void   Remove(EntryMap::iterator aIt);
+
+    steady_clock::duration                 mTtl;
+    EntryMap                               mEntries;
+    std::unordered_map<uint64_t, uint16_t> mExtAddressIndex;
+    std::function<void(uint16_t)>          mRemovedHandler;
+
+    // RLOC16s ordered from the least recently updated entry
+    std::list<uint16_t> mExpiryQueue;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_DIAGNOSTIC_STORE_HPP_
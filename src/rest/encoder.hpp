@@ -0,0 +1,770 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the encoders of REST resources, which write a resource with a JSON or a CBOR writer.
+ */
+
+#ifndef OTBR_REST_ENCODER_HPP_
+#define OTBR_REST_ENCODER_HPP_
+
+#include <limits.h>
+
+#include <arpa/inet.h>
+
+#include "openthread/link.h"
+#include "openthread/thread_ftd.h"
+
+#include "agent/churn_log.hpp"
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/mainloop_stats.hpp"
+#include "rest/diagnostic_history.hpp"
+#include "rest/neighbor_log.hpp"
+#include "rest/topology.hpp"
+#include "rest/types.hpp"
+
+namespace otbr {
+namespace rest {
+
+// The encoders only use the writer methods shared by `Utils::JsonWriter` and `Utils::CborWriter`.
+
+template <typename Writer> void EncodeMode(Writer &aWriter, const otLinkModeConfig &aMode)
+{
+    aWriter.BeginObject();
+    aWriter.UintMember("RxOnWhenIdle", aMode.mRxOnWhenIdle);
+    aWriter.UintMember("DeviceType", aMode.mDeviceType);
+    aWriter.UintMember("NetworkData", aMode.mNetworkData);
+    aWriter.EndObject();
+}
+
+template <typename Writer> void EncodeIpAddr(Writer &aWriter, const otIp6Address &aAddress)
+{
+    char addr[INET6_ADDRSTRLEN];
+
+    VerifyOrDie(inet_ntop(AF_INET6, aAddress.mFields.m8, addr, sizeof(addr)) != nullptr,
+                "Failed to convert Ip6 address to string");
+
+    aWriter.String(addr);
+}
+
+template <typename Writer> void EncodeChildTableEntry(Writer &aWriter, const otNetworkDiagChildEntry &aChildEntry)
+{
+    aWriter.BeginObject();
+    aWriter.UintMember("ChildId", aChildEntry.mChildId);
+    aWriter.UintMember("Timeout", aChildEntry.mTimeout);
+    aWriter.Key("Mode");
+    EncodeMode(aWriter, aChildEntry.mMode);
+    aWriter.EndObject();
+}
+
+template <typename Writer> void EncodeMacCounters(Writer &aWriter, const otNetworkDiagMacCounters &aMacCounters)
+{
+    aWriter.BeginObject();
+    aWriter.UintMember("IfInUnknownProtos", aMacCounters.mIfInUnknownProtos);
+    aWriter.UintMember("IfInErrors", aMacCounters.mIfInErrors);
+    aWriter.UintMember("IfOutErrors", aMacCounters.mIfOutErrors);
+    aWriter.UintMember("IfInUcastPkts", aMacCounters.mIfInUcastPkts);
+    aWriter.UintMember("IfInBroadcastPkts", aMacCounters.mIfInBroadcastPkts);
+    aWriter.UintMember("IfInDiscards", aMacCounters.mIfInDiscards);
+    aWriter.UintMember("IfOutUcastPkts", aMacCounters.mIfOutUcastPkts);
+    aWriter.UintMember("IfOutBroadcastPkts", aMacCounters.mIfOutBroadcastPkts);
+    aWriter.UintMember("IfOutDiscards", aMacCounters.mIfOutDiscards);
+    aWriter.EndObject();
+}
+
+template <typename Writer> void EncodeConnectivity(Writer &aWriter, const otNetworkDiagConnectivity &aConnectivity)
+{
+    aWriter.BeginObject();
+    aWriter.Key("ParentPriority");
+    aWriter.Int(aConnectivity.mParentPriority);
+    aWriter.UintMember("LinkQuality3", aConnectivity.mLinkQuality3);
+    aWriter.UintMember("LinkQuality2", aConnectivity.mLinkQuality2);
+    aWriter.UintMember("LinkQuality1", aConnectivity.mLinkQuality1);
+    aWriter.UintMember("LeaderCost", aConnectivity.mLeaderCost);
+    aWriter.UintMember("IdSequence", aConnectivity.mIdSequence);
+    aWriter.UintMember("ActiveRouters", aConnectivity.mActiveRouters);
+    aWriter.UintMember("SedBufferSize", aConnectivity.mSedBufferSize);
+    aWriter.UintMember("SedDatagramCount", aConnectivity.mSedDatagramCount);
+    aWriter.EndObject();
+}
+
+template <typename Writer> void EncodeRouteData(Writer &aWriter, const otNetworkDiagRouteData &aRouteData)
+{
+    aWriter.BeginObject();
+    aWriter.UintMember("RouteId", aRouteData.mRouterId);
+    aWriter.UintMember("LinkQualityOut", aRouteData.mLinkQualityOut);
+    aWriter.UintMember("LinkQualityIn", aRouteData.mLinkQualityIn);
+    aWriter.UintMember("RouteCost", aRouteData.mRouteCost);
+    aWriter.EndObject();
+}
+
+template <typename Writer> void EncodeRoute(Writer &aWriter, const otNetworkDiagRoute &aRoute)
+{
+    aWriter.BeginObject();
+    aWriter.UintMember("IdSequence", aRoute.mIdSequence);
+    aWriter.Key("RouteData");
+    aWriter.BeginArray();
+    for (uint16_t i = 0; i < aRoute.mRouteCount; ++i)
+    {
+        EncodeRouteData(aWriter, aRoute.mRouteData[i]);
+    }
+    aWriter.EndArray();
+    aWriter.EndObject();
+}
+
+template <typename Writer> void EncodeLeaderData(Writer &aWriter, const otLeaderData &aLeaderData)
+{
+    aWriter.BeginObject();
+    aWriter.UintMember("PartitionId", aLeaderData.mPartitionId);
+    aWriter.UintMember("Weighting", aLeaderData.mWeighting);
+    aWriter.UintMember("DataVersion", aLeaderData.mDataVersion);
+    aWriter.UintMember("StableDataVersion", aLeaderData.mStableDataVersion);
+    aWriter.UintMember("LeaderRouterId", aLeaderData.mLeaderRouterId);
+    aWriter.EndObject();
+}
+
+template <typename Writer> void EncodeMainloopHistogram(Writer &aWriter, const MainloopStats::Histogram &aHistogram)
+{
+    aWriter.UintMember("Count", aHistogram.mCount);
+    aWriter.UintMember("TotalUs", aHistogram.mTotalUs);
+    aWriter.UintMember("MaxUs", aHistogram.mMaxUs);
+    aWriter.UintMember("StallCount", aHistogram.mStallCount);
+    aWriter.Key("Histogram");
+    aWriter.BeginArray();
+    for (uint8_t i = 0; i < MainloopStats::kNumBuckets; i++)
+    {
+        aWriter.Uint(aHistogram.mBuckets[i]);
+    }
+    aWriter.EndArray();
+}
+
+template <typename Writer> void EncodeDiagTlv(Writer &aWriter, const otNetworkDiagTlv &aDiagTlv)
+{
+    switch (aDiagTlv.mType)
+    {
+    case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
+        aWriter.Key("ExtAddress");
+        aWriter.Bytes(aDiagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
+        aWriter.UintMember("Rloc16", aDiagTlv.mData.mAddr16);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
+        aWriter.Key("Mode");
+        EncodeMode(aWriter, aDiagTlv.mData.mMode);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
+        aWriter.UintMember("Timeout", aDiagTlv.mData.mTimeout);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
+        aWriter.Key("Connectivity");
+        EncodeConnectivity(aWriter, aDiagTlv.mData.mConnectivity);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
+        aWriter.Key("Route");
+        EncodeRoute(aWriter, aDiagTlv.mData.mRoute);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
+        aWriter.Key("LeaderData");
+        EncodeLeaderData(aWriter, aDiagTlv.mData.mLeaderData);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
+        aWriter.Key("NetworkData");
+        aWriter.Bytes(aDiagTlv.mData.mNetworkData.m8, aDiagTlv.mData.mNetworkData.mCount);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
+        aWriter.Key("IP6AddressList");
+        aWriter.BeginArray();
+        for (uint16_t i = 0; i < aDiagTlv.mData.mIp6AddrList.mCount; ++i)
+        {
+            EncodeIpAddr(aWriter, aDiagTlv.mData.mIp6AddrList.mList[i]);
+        }
+        aWriter.EndArray();
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
+        aWriter.Key("MACCounters");
+        EncodeMacCounters(aWriter, aDiagTlv.mData.mMacCounters);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
+        aWriter.UintMember("BatteryLevel", aDiagTlv.mData.mBatteryLevel);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
+        aWriter.UintMember("SupplyVoltage", aDiagTlv.mData.mSupplyVoltage);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
+        aWriter.Key("ChildTable");
+        aWriter.BeginArray();
+        for (uint16_t i = 0; i < aDiagTlv.mData.mChildTable.mCount; ++i)
+        {
+            EncodeChildTableEntry(aWriter, aDiagTlv.mData.mChildTable.mTable[i]);
+        }
+        aWriter.EndArray();
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
+        aWriter.Key("ChannelPages");
+        aWriter.Bytes(aDiagTlv.mData.mChannelPages.m8, aDiagTlv.mData.mChannelPages.mCount);
+        break;
+    case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
+        aWriter.UintMember("MaxChildTimeout", aDiagTlv.mData.mMaxChildTimeout);
+        break;
+    default:
+        break;
+    }
+}
+
+/**
+ * This function encodes the information of the node.
+ *
+ * @param[inout]    aWriter     The JSON or CBOR writer.
+ * @param[in]       aNode       The node information.
+ *
+ */
+template <typename Writer> void EncodeNode(Writer &aWriter, const NodeInfo &aNode)
+{
+    aWriter.BeginObject();
+    aWriter.UintMember("State", aNode.mRole);
+    aWriter.UintMember("NumOfRouter", aNode.mNumOfRouter);
+    aWriter.Key("RlocAddress");
+    EncodeIpAddr(aWriter, aNode.mRlocAddress);
+    aWriter.Key("ExtAddress");
+    aWriter.Bytes(aNode.mExtAddress, OT_EXT_ADDRESS_SIZE);
+    aWriter.StringMember("NetworkName", aNode.mNetworkName.c_str());
+    aWriter.UintMember("Rloc16", aNode.mRloc16);
+    aWriter.Key("LeaderData");
+    EncodeLeaderData(aWriter, aNode.mLeaderData);
+    aWriter.Key("ExtPanId");
+    aWriter.Bytes(aNode.mExtPanId, OT_EXT_PAN_ID_SIZE);
+    aWriter.EndObject();
+}
+
+/**
+ * This function encodes the diagnostics of a node as an object.
+ *
+ * @param[inout]    aWriter     The JSON or CBOR writer.
+ * @param[in]       aDiagTlvs   The diagnostic TLVs of the node.
+ * @param[in]       aTlvMask    The TLV types to encode.
+ *
+ */
+template <typename Writer> void EncodeDiagNode(Writer &                             aWriter,
+                                               const std::vector<otNetworkDiagTlv> &aDiagTlvs,
+                                               DiagTlvMask                          aTlvMask)
+{
+    aWriter.BeginObject();
+
+    for (const auto &diagTlv : aDiagTlvs)
+    {
+        if (diagTlv.mType < sizeof(DiagTlvMask) * CHAR_BIT && (aTlvMask & (1u << diagTlv.mType)))
+        {
+            EncodeDiagTlv(aWriter, diagTlv);
+        }
+    }
+
+    aWriter.EndObject();
+}
+
+/**
+ * This function encodes the diagnostics of nodes as an array of objects.
+ *
+ * @param[inout]    aWriter     The JSON or CBOR writer.
+ * @param[in]       aDiagSet    The diagnostic TLVs of each node.
+ * @param[in]       aTlvMask    The TLV types to encode.
+ *
+ */
+template <typename Writer> void EncodeDiag(Writer &                                          aWriter,
+                                           const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet,
+                                           DiagTlvMask                                       aTlvMask)
+{
+    aWriter.BeginArray();
+
+    for (const auto &diagItem : aDiagSet)
+    {
+        EncodeDiagNode(aWriter, diagItem, aTlvMask);
+    }
+
+    aWriter.EndArray();
+}
+
+/**
+ * This class encodes the diagnostics of nodes as an array of objects, a few nodes at a time.
+ *
+ * It is used as the `ChunkProducer` of a chunked response, so that only about `kChunkSize` bytes of the body
+ * are held at once. The TLVs of a node are released once it has been encoded.
+ *
+ * The writer is bound to the encoder's buffer, the encoder must not be copied or moved once constructed.
+ *
+ */
+template <typename Writer> class DiagChunkEncoder
+{
+public:
+    /**
+     * The constructor takes over the diagnostics to encode.
+     *
+     * @param[inout]    aDiagSet    The diagnostic TLVs of each node, left empty.
+     * @param[in]       aTlvMask    The TLV types to encode.
+     *
+     */
+    DiagChunkEncoder(std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet, DiagTlvMask aTlvMask)
+        : mTlvMask(aTlvMask)
+        , mNext(0)
+        , mWriter(mBuffer)
+    {
+        mDiagSet.swap(aDiagSet);
+        mWriter.BeginArray();
+    }
+
+    /**
+     * This method encodes the next nodes, until the chunk reaches `kChunkSize` bytes.
+     *
+     * @param[inout]    aChunk  An empty string to append the encoded data to.
+     *
+     * @returns Whether all nodes have been encoded.
+     *
+     */
+    bool operator()(std::string &aChunk)
+    {
+        while (mNext < mDiagSet.size() && mBuffer.size() < kChunkSize)
+        {
+            EncodeDiagNode(mWriter, mDiagSet[mNext], mTlvMask);
+            std::vector<otNetworkDiagTlv>().swap(mDiagSet[mNext]);
+            mNext++;
+        }
+
+        if (mNext == mDiagSet.size())
+        {
+            mWriter.EndArray();
+        }
+
+        // Hand the encoded data over and keep writing into the buffer of the previous chunk.
+        aChunk.swap(mBuffer);
+        mBuffer.clear();
+
+        return mNext == mDiagSet.size();
+    }
+
+private:
+    std::vector<std::vector<otNetworkDiagTlv>> mDiagSet;
+    DiagTlvMask                                mTlvMask;
+    size_t                                     mNext;
+    std::string                                mBuffer;
+    Writer                                     mWriter;
+};
+
+/**
+ * This function encodes the histories of nodes as an array of objects.
+ *
+ * @param[inout]    aWriter     The JSON or CBOR writer.
+ * @param[in]       aHistory    The diagnostic history.
+ * @param[in]       aSeries     The histories to encode.
+ * @param[in]       aSince      Only samples recorded at or after this time, in ms since the Unix epoch, are encoded.
+ *
+ */
+template <typename Writer> void EncodeDiagHistory(Writer &                                              aWriter,
+                                                  const DiagnosticHistory &                             aHistory,
+                                                  const std::vector<const DiagnosticHistory::Series *> &aSeries,
+                                                  uint64_t                                              aSince)
+{
+    std::vector<const DiagnosticHistory::Sample *> samples;
+
+    aWriter.BeginArray();
+
+    for (const DiagnosticHistory::Series *series : aSeries)
+    {
+        aHistory.GetSamples(*series, aSince, samples);
+
+        aWriter.BeginObject();
+        aWriter.Key("ExtAddress");
+        aWriter.Bytes(series->mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
+        aWriter.Key("Samples");
+        aWriter.BeginArray();
+
+        for (const DiagnosticHistory::Sample *sample : samples)
+        {
+            aWriter.BeginObject();
+            aWriter.UintMember("Timestamp", sample->mTimestamp);
+            aWriter.UintMember("Rloc16", sample->mRloc16);
+            aWriter.UintMember("ParentChanges", sample->mParentChanges);
+
+            if (sample->mFlags & DiagnosticHistory::Sample::kHasChildTable)
+            {
+                aWriter.UintMember("ChildCount", sample->mChildCount);
+            }
+
+            if (sample->mFlags & DiagnosticHistory::Sample::kHasConnectivity)
+            {
+                aWriter.UintMember("LinkQuality3", sample->mLinkQuality3);
+                aWriter.UintMember("LinkQuality2", sample->mLinkQuality2);
+                aWriter.UintMember("LinkQuality1", sample->mLinkQuality1);
+            }
+
+            if (sample->mFlags & DiagnosticHistory::Sample::kHasMacCounters)
+            {
+                aWriter.Key("MACCounters");
+                aWriter.BeginObject();
+                aWriter.UintMember("IfInUcastPkts", sample->mIfInUcastPkts);
+                aWriter.UintMember("IfOutUcastPkts", sample->mIfOutUcastPkts);
+                aWriter.UintMember("IfInErrors", sample->mIfInErrors);
+                aWriter.UintMember("IfOutErrors", sample->mIfOutErrors);
+                aWriter.UintMember("IfInDiscards", sample->mIfInDiscards);
+                aWriter.UintMember("IfOutDiscards", sample->mIfOutDiscards);
+                aWriter.EndObject();
+            }
+
+            aWriter.EndObject();
+        }
+
+        aWriter.EndArray();
+        aWriter.EndObject();
+    }
+
+    aWriter.EndArray();
+}
+
+/**
+ * This function encodes the changes of a topology since a version.
+ *
+ * @param[inout]    aWriter     The JSON or CBOR writer.
+ * @param[in]       aTopology   The topology.
+ * @param[in]       aSince      The version the client has, or zero for the full topology.
+ *
+ */
+template <typename Writer> void EncodeTopology(Writer &aWriter, const Topology &aTopology, uint64_t aSince)
+{
+    std::vector<const Topology::Node *> nodes;
+    std::vector<const Topology::Link *> links;
+
+    aTopology.GetChanges(aSince, nodes, links);
+
+    aWriter.BeginObject();
+    aWriter.UintMember("Version", aTopology.GetVersion());
+    aWriter.Key("Full");
+    aWriter.Bool(!aTopology.HasChangesSince(aSince));
+
+    aWriter.Key("Nodes");
+    aWriter.BeginArray();
+    for (const Topology::Node *node : nodes)
+    {
+        aWriter.BeginObject();
+        aWriter.UintMember("Rloc16", node->mRloc16);
+        aWriter.UintMember("Version", node->mVersion);
+
+        if (node->mRemoved)
+        {
+            aWriter.Key("Removed");
+            aWriter.Bool(true);
+        }
+        else
+        {
+            if (node->mHasExtAddress)
+            {
+                aWriter.Key("ExtAddress");
+                aWriter.Bytes(node->mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
+            }
+
+            if (node->mLeaderCost != Topology::kUnknownLeaderCost)
+            {
+                aWriter.UintMember("LeaderCost", node->mLeaderCost);
+            }
+        }
+
+        aWriter.EndObject();
+    }
+    aWriter.EndArray();
+
+    aWriter.Key("Links");
+    aWriter.BeginArray();
+    for (const Topology::Link *link : links)
+    {
+        aWriter.BeginObject();
+        aWriter.UintMember("From", link->mFrom);
+        aWriter.UintMember("To", link->mTo);
+        aWriter.UintMember("Version", link->mVersion);
+
+        if (link->mRemoved)
+        {
+            aWriter.Key("Removed");
+            aWriter.Bool(true);
+        }
+        else if (link->mIsChild)
+        {
+            aWriter.StringMember("Type", "Child");
+            aWriter.UintMember("Timeout", link->mChildTimeout);
+        }
+        else
+        {
+            aWriter.StringMember("Type", "Router");
+            aWriter.UintMember("LinkQualityIn", link->mLinkQualityIn);
+            aWriter.UintMember("LinkQualityOut", link->mLinkQualityOut);
+        }
+
+        aWriter.EndObject();
+    }
+    aWriter.EndArray();
+
+    aWriter.EndObject();
+}
+
+/**
+ * This function encodes a neighbor table entry.
+ *
+ * @param[inout]    aWriter     The JSON or CBOR writer.
+ * @param[in]       aNeighbor   The neighbor.
+ *
+ */
+template <typename Writer> void EncodeNeighbor(Writer &aWriter, const otNeighborInfo &aNeighbor)
+{
+    aWriter.BeginObject();
+    aWriter.Key("ExtAddress");
+    aWriter.Bytes(aNeighbor.mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
+    aWriter.UintMember("Rloc16", aNeighbor.mRloc16);
+    aWriter.UintMember("Age", aNeighbor.mAge);
+    aWriter.UintMember("LinkQualityIn", aNeighbor.mLinkQualityIn);
+    aWriter.Key("AverageRssi");
+    aWriter.Int(aNeighbor.mAverageRssi);
+    aWriter.Key("LastRssi");
+    aWriter.Int(aNeighbor.mLastRssi);
+    aWriter.UintMember("FrameErrorRate", aNeighbor.mFrameErrorRate);
+    aWriter.UintMember("MessageErrorRate", aNeighbor.mMessageErrorRate);
+    aWriter.UintMember("RxOnWhenIdle", aNeighbor.mRxOnWhenIdle);
+    aWriter.UintMember("FullThreadDevice", aNeighbor.mFullThreadDevice);
+    aWriter.UintMember("FullNetworkData", aNeighbor.mFullNetworkData);
+    aWriter.UintMember("IsChild", aNeighbor.mIsChild);
+    aWriter.EndObject();
+}
+
+/**
+ * This function encodes the neighbor table at a sequence number of its change log.
+ *
+ * @param[inout]    aWriter     The JSON or CBOR writer.
+ * @param[in]       aSequence   The sequence number of the last change of the table.
+ * @param[in]       aNeighbors  The neighbors.
+ *
+ */
+template <typename Writer>
+void EncodeNeighborTable(Writer &aWriter, uint64_t aSequence, const std::vector<otNeighborInfo> &aNeighbors)
+{
+    aWriter.BeginObject();
+    aWriter.UintMember("Sequence", aSequence);
+    aWriter.Key("Neighbors");
+    aWriter.BeginArray();
+    for (const otNeighborInfo &neighbor : aNeighbors)
+    {
+        EncodeNeighbor(aWriter, neighbor);
+    }
+    aWriter.EndArray();
+    aWriter.EndObject();
+}
+
+/**
+ * This function encodes a change of the neighbor table.
+ *
+ * @param[inout]    aWriter     The JSON or CBOR writer.
+ * @param[in]       aChange     The change.
+ *
+ */
+template <typename Writer> void EncodeNeighborChange(Writer &aWriter, const NeighborLog::Change &aChange)
+{
+    aWriter.BeginObject();
+    aWriter.UintMember("Sequence", aChange.mSequence);
+    aWriter.StringMember("Event", aChange.mAdded ? "Added" : "Removed");
+    aWriter.Key("Neighbor");
+    EncodeNeighbor(aWriter, aChange.mNeighbor);
+    aWriter.EndObject();
+}
+
+/**
+ * This function encodes the events of the churn log.
+ *
+ * @param[inout]    aWriter     The JSON or CBOR writer.
+ * @param[in]       aEvents     The events.
+ * @param[in]       aDropped    The number of events dropped because the log was full.
+ *
+ */
+template <typename Writer>
+void EncodeChurnEvents(Writer &aWriter, const std::vector<Ncp::ChurnLog::Event> &aEvents, uint32_t aDropped)
+{
+    aWriter.BeginObject();
+    aWriter.UintMember("Dropped", aDropped);
+    aWriter.Key("Events");
+    aWriter.BeginArray();
+    for (const Ncp::ChurnLog::Event &event : aEvents)
+    {
+        aWriter.BeginObject();
+        aWriter.UintMember("Timestamp", event.mTimestamp);
+        aWriter.StringMember("Event", Ncp::ChurnLog::TypeToString(event.mType));
+        aWriter.UintMember("Rloc16", event.mRloc16);
+
+        switch (event.mType)
+        {
+        case Ncp::ChurnLog::kTypeChildAdded:
+        case Ncp::ChurnLog::kTypeChildRemoved:
+        case Ncp::ChurnLog::kTypeParentChanged:
+            aWriter.Key("ExtAddress");
+            aWriter.Bytes(event.mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
+            break;
+        case Ncp::ChurnLog::kTypeRoleChanged:
+            aWriter.UintMember("Role", event.mValue);
+            break;
+        case Ncp::ChurnLog::kTypePartitionChanged:
+            aWriter.UintMember("PartitionId", event.mValue);
+            break;
+        default:
+            break;
+        }
+
+        aWriter.EndObject();
+    }
+    aWriter.EndArray();
+    aWriter.EndObject();
+}
+
+/**
+ * This function encodes an active scan result.
+ *
+ * @param[inout]    aWriter     The JSON or CBOR writer.
+ * @param[in]       aResult     The active scan result.
+ *
+ */
+template <typename Writer> void EncodeScanResult(Writer &aWriter, const otActiveScanResult &aResult)
+{
+    aWriter.BeginObject();
+    aWriter.Key("ExtAddress");
+    aWriter.Bytes(aResult.mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
+    aWriter.StringMember("NetworkName", aResult.mNetworkName.m8);
+    aWriter.Key("ExtPanId");
+    aWriter.Bytes(aResult.mExtendedPanId.m8, OT_EXT_PAN_ID_SIZE);
+    aWriter.UintMember("PanId", aResult.mPanId);
+    aWriter.UintMember("JoinerUdpPort", aResult.mJoinerUdpPort);
+    aWriter.UintMember("Channel", aResult.mChannel);
+    aWriter.Key("Rssi");
+    aWriter.Int(aResult.mRssi);
+    aWriter.UintMember("Lqi", aResult.mLqi);
+    aWriter.UintMember("Version", aResult.mVersion);
+    aWriter.UintMember("IsNative", aResult.mIsNative);
+    aWriter.UintMember("IsJoinable", aResult.mIsJoinable);
+    aWriter.EndObject();
+}
+
+/**
+ * This function encodes an energy scan result.
+ *
+ * @param[inout]    aWriter     The JSON or CBOR writer.
+ * @param[in]       aResult     The energy scan result.
+ *
+ */
+template <typename Writer> void EncodeScanResult(Writer &aWriter, const otEnergyScanResult &aResult)
+{
+    aWriter.BeginObject();
+    aWriter.UintMember("Channel", aResult.mChannel);
+    aWriter.Key("MaxRssi");
+    aWriter.Int(aResult.mMaxRssi);
+    aWriter.EndObject();
+}
+
+/**
+ * This function encodes the results of an active or energy scan.
+ *
+ * @param[inout]    aWriter     The JSON or CBOR writer.
+ * @param[in]       aResults    The scan results.
+ *
+ */
+template <typename Writer, typename ResultType>
+void EncodeScanResults(Writer &aWriter, const std::vector<ResultType> &aResults)
+{
+    aWriter.BeginArray();
+    for (const ResultType &result : aResults)
+    {
+        EncodeScanResult(aWriter, result);
+    }
+    aWriter.EndArray();
+}
+
+/**
+ * This function encodes the mainloop statistics.
+ *
+ * @param[inout]    aWriter     The JSON or CBOR writer.
+ * @param[in]       aStats      The mainloop statistics.
+ *
+ */
+template <typename Writer> void EncodeMainloopStats(Writer &aWriter, const MainloopStats &aStats)
+{
+    aWriter.BeginObject();
+    aWriter.UintMember("StallThresholdUs", MainloopStats::kStallThresholdUs);
+
+    // The last bucket has no upper bound.
+    aWriter.Key("BucketUpperBoundsUs");
+    aWriter.BeginArray();
+    for (uint8_t i = 0; i < MainloopStats::kNumBuckets - 1; i++)
+    {
+        aWriter.Uint(MainloopStats::GetBucketUpperBound(i));
+    }
+    aWriter.EndArray();
+
+    aWriter.Key("Components");
+    aWriter.BeginArray();
+    for (uint8_t i = 0; i < MainloopStats::kNumComponents; i++)
+    {
+        for (uint8_t j = 0; j < MainloopStats::kNumPhases; j++)
+        {
+            auto component = static_cast<MainloopStats::Component>(i);
+            auto phase     = static_cast<MainloopStats::Phase>(j);
+
+            aWriter.BeginObject();
+            EncodeMainloopHistogram(aWriter, aStats.GetHistogram(component, phase));
+            aWriter.StringMember("Component", MainloopStats::ComponentToString(component));
+            aWriter.StringMember("Phase", MainloopStats::PhaseToString(phase));
+            aWriter.EndObject();
+        }
+    }
+    aWriter.EndArray();
+    aWriter.EndObject();
+}
+
+/**
+ * This function encodes an error.
+ *
+ * @param[inout]    aWriter         The JSON or CBOR writer.
+ * @param[in]       aErrorCode      The HTTP status code.
+ * @param[in]       aErrorMessage   The error message.
+ *
+ */
+template <typename Writer> void EncodeError(Writer &           aWriter,
+                                            HttpStatusCode     aErrorCode,
+                                            const std::string &aErrorMessage)
+{
+    aWriter.BeginObject();
+    aWriter.UintMember("ErrorCode", static_cast<uint16_t>(aErrorCode));
+    aWriter.StringMember("ErrorMessage", aErrorMessage.c_str());
+    aWriter.EndObject();
+}
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_ENCODER_HPP_
@@ -28,451 +28,288 @@
 
 #include "rest/json.hpp"
 
+#include <string.h>
+
+#include <memory>
+
 #include "common/code_utils.hpp"
 #include "common/types.hpp"
+#include "rest/encoder.hpp"
+#include "utils/json_writer.hpp"
 
-extern "C" {
-#include <cJSON.h>
-}
+using otbr::Utils::JsonWriter;
 
 namespace otbr {
 namespace rest {
 namespace Json {
 
-static cJSON *Bytes2HexJson(const uint8_t *aBytes, uint8_t aLength)
-{
-    char hex[2 * aLength + 1];
-
-    otbr::Utils::Bytes2Hex(aBytes, aLength, hex);
-    hex[2 * aLength] = '\0';
-
-    return cJSON_CreateString(hex);
-}
-
 std::string String2JsonString(const std::string &aString)
 {
     std::string ret;
-    cJSON *     json    = nullptr;
-    char *      jsonOut = nullptr;
+    JsonWriter  writer(ret);
 
     VerifyOrExit(aString.size() > 0);
 
-    json    = cJSON_CreateString(aString.c_str());
-    jsonOut = cJSON_Print(json);
-    ret     = jsonOut;
-    if (jsonOut != nullptr)
-    {
-        cJSON_free(jsonOut);
-        jsonOut = nullptr;
-    }
-
-    cJSON_Delete(json);
+    ret.reserve(aString.size() + 2);
+    writer.String(aString.c_str());
 
 exit:
     return ret;
 }
 
-std::string Json2String(const cJSON *aJson)
+std::string IpAddr2JsonString(const otIp6Address &aAddress)
 {
     std::string ret;
-    char *      jsonOut = nullptr;
-
-    VerifyOrExit(aJson != nullptr);
+    JsonWriter  writer(ret);
 
-    jsonOut = cJSON_Print(aJson);
-    ret     = jsonOut;
-    if (jsonOut != nullptr)
-    {
-        cJSON_free(jsonOut);
-        jsonOut = nullptr;
-    }
+    EncodeIpAddr(writer, aAddress);
 
-exit:
     return ret;
 }
 
-static cJSON *CString2Json(const char *aString)
+std::string Node2JsonString(const NodeInfo &aNode)
 {
-    return cJSON_CreateString(aString);
+    std::string ret;
+    JsonWriter  writer(ret);
+
+    EncodeNode(writer, aNode);
+
+    return ret;
 }
 
-static cJSON *Mode2Json(const otLinkModeConfig &aMode)
+std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet, DiagTlvMask aTlvMask)
 {
-    cJSON *mode = cJSON_CreateObject();
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_AddItemToObject(mode, "RxOnWhenIdle", cJSON_CreateNumber(aMode.mRxOnWhenIdle));
-    cJSON_AddItemToObject(mode, "DeviceType", cJSON_CreateNumber(aMode.mDeviceType));
-    cJSON_AddItemToObject(mode, "NetworkData", cJSON_CreateNumber(aMode.mNetworkData));
+    EncodeDiag(writer, aDiagSet, aTlvMask);
 
-    return mode;
+    return ret;
 }
 
-static cJSON *IpAddr2Json(const otIp6Address &aAddress)
+ChunkProducer Diag2JsonChunks(std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet, DiagTlvMask aTlvMask)
 {
-    Ip6Address addr(aAddress.mFields.m8);
+    // The encoder is shared by the copies of the producer, since its writer is bound to its buffer.
+    auto encoder = std::make_shared<DiagChunkEncoder<JsonWriter>>(aDiagSet, aTlvMask);
 
-    return cJSON_CreateString(addr.ToString().c_str());
+    return [encoder](std::string &aChunk) { return (*encoder)(aChunk); };
 }
 
-static cJSON *ChildTableEntry2Json(const otNetworkDiagChildEntry &aChildEntry)
+std::string DiagHistory2JsonString(const DiagnosticHistory &                           aHistory,
+                                   const std::vector<const DiagnosticHistory::Series *> &aSeries,
+                                   uint64_t                                              aSince)
 {
-    cJSON *childEntry = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(childEntry, "ChildId", cJSON_CreateNumber(aChildEntry.mChildId));
-    cJSON_AddItemToObject(childEntry, "Timeout", cJSON_CreateNumber(aChildEntry.mTimeout));
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON *mode = Mode2Json(aChildEntry.mMode);
-    cJSON_AddItemToObject(childEntry, "Mode", mode);
+    EncodeDiagHistory(writer, aHistory, aSeries, aSince);
 
-    return childEntry;
+    return ret;
 }
 
-static cJSON *MacCounters2Json(const otNetworkDiagMacCounters &aMacCounters)
+std::string Topology2JsonString(const Topology &aTopology, uint64_t aSince)
 {
-    cJSON *macCounters = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(macCounters, "IfInUnknownProtos", cJSON_CreateNumber(aMacCounters.mIfInUnknownProtos));
-    cJSON_AddItemToObject(macCounters, "IfInErrors", cJSON_CreateNumber(aMacCounters.mIfInErrors));
-    cJSON_AddItemToObject(macCounters, "IfOutErrors", cJSON_CreateNumber(aMacCounters.mIfOutErrors));
-    cJSON_AddItemToObject(macCounters, "IfInUcastPkts", cJSON_CreateNumber(aMacCounters.mIfInUcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfInBroadcastPkts", cJSON_CreateNumber(aMacCounters.mIfInBroadcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfInDiscards", cJSON_CreateNumber(aMacCounters.mIfInDiscards));
-    cJSON_AddItemToObject(macCounters, "IfOutUcastPkts", cJSON_CreateNumber(aMacCounters.mIfOutUcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfOutBroadcastPkts", cJSON_CreateNumber(aMacCounters.mIfOutBroadcastPkts));
-    cJSON_AddItemToObject(macCounters, "IfOutDiscards", cJSON_CreateNumber(aMacCounters.mIfOutDiscards));
-
-    return macCounters;
-}
+    std::string ret;
+    JsonWriter  writer(ret);
 
-static cJSON *Connectivity2Json(const otNetworkDiagConnectivity &aConnectivity)
-{
-    cJSON *connectivity = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(connectivity, "ParentPriority", cJSON_CreateNumber(aConnectivity.mParentPriority));
-    cJSON_AddItemToObject(connectivity, "LinkQuality3", cJSON_CreateNumber(aConnectivity.mLinkQuality3));
-    cJSON_AddItemToObject(connectivity, "LinkQuality2", cJSON_CreateNumber(aConnectivity.mLinkQuality2));
-    cJSON_AddItemToObject(connectivity, "LinkQuality1", cJSON_CreateNumber(aConnectivity.mLinkQuality1));
-    cJSON_AddItemToObject(connectivity, "LeaderCost", cJSON_CreateNumber(aConnectivity.mLeaderCost));
-    cJSON_AddItemToObject(connectivity, "IdSequence", cJSON_CreateNumber(aConnectivity.mIdSequence));
-    cJSON_AddItemToObject(connectivity, "ActiveRouters", cJSON_CreateNumber(aConnectivity.mActiveRouters));
-    cJSON_AddItemToObject(connectivity, "SedBufferSize", cJSON_CreateNumber(aConnectivity.mSedBufferSize));
-    cJSON_AddItemToObject(connectivity, "SedDatagramCount", cJSON_CreateNumber(aConnectivity.mSedDatagramCount));
-
-    return connectivity;
+    EncodeTopology(writer, aTopology, aSince);
+
+    return ret;
 }
 
-static cJSON *RouteData2Json(const otNetworkDiagRouteData &aRouteData)
+std::string NeighborTable2JsonString(uint64_t aSequence, const std::vector<otNeighborInfo> &aNeighbors)
 {
-    cJSON *routeData = cJSON_CreateObject();
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_AddItemToObject(routeData, "RouteId", cJSON_CreateNumber(aRouteData.mRouterId));
-    cJSON_AddItemToObject(routeData, "LinkQualityOut", cJSON_CreateNumber(aRouteData.mLinkQualityOut));
-    cJSON_AddItemToObject(routeData, "LinkQualityIn", cJSON_CreateNumber(aRouteData.mLinkQualityIn));
-    cJSON_AddItemToObject(routeData, "RouteCost", cJSON_CreateNumber(aRouteData.mRouteCost));
+    EncodeNeighborTable(writer, aSequence, aNeighbors);
 
-    return routeData;
+    return ret;
 }
 
-static cJSON *Route2Json(const otNetworkDiagRoute &aRoute)
+std::string NeighborChange2JsonString(const NeighborLog::Change &aChange)
 {
-    cJSON *route = cJSON_CreateObject();
-
-    cJSON_AddItemToObject(route, "IdSequence", cJSON_CreateNumber(aRoute.mIdSequence));
-
-    cJSON *RouteData = cJSON_CreateArray();
-    for (uint16_t i = 0; i < aRoute.mRouteCount; ++i)
-    {
-        cJSON *RouteDatavalue = RouteData2Json(aRoute.mRouteData[i]);
-        cJSON_AddItemToArray(RouteData, RouteDatavalue);
-    }
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_AddItemToObject(route, "RouteData", RouteData);
+    EncodeNeighborChange(writer, aChange);
 
-    return route;
+    return ret;
 }
 
-static cJSON *LeaderData2Json(const otLeaderData &aLeaderData)
+std::string ChurnEvents2JsonString(const std::vector<Ncp::ChurnLog::Event> &aEvents, uint32_t aDropped)
 {
-    cJSON *leaderData = cJSON_CreateObject();
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_AddItemToObject(leaderData, "PartitionId", cJSON_CreateNumber(aLeaderData.mPartitionId));
-    cJSON_AddItemToObject(leaderData, "Weighting", cJSON_CreateNumber(aLeaderData.mWeighting));
-    cJSON_AddItemToObject(leaderData, "DataVersion", cJSON_CreateNumber(aLeaderData.mDataVersion));
-    cJSON_AddItemToObject(leaderData, "StableDataVersion", cJSON_CreateNumber(aLeaderData.mStableDataVersion));
-    cJSON_AddItemToObject(leaderData, "LeaderRouterId", cJSON_CreateNumber(aLeaderData.mLeaderRouterId));
+    EncodeChurnEvents(writer, aEvents, aDropped);
 
-    return leaderData;
+    return ret;
 }
 
-std::string IpAddr2JsonString(const otIp6Address &aAddress)
+std::string ScanResult2JsonString(const otActiveScanResult &aResult)
 {
     std::string ret;
-    cJSON *     ipAddr = IpAddr2Json(aAddress);
+    JsonWriter  writer(ret);
 
-    ret = Json2String(ipAddr);
-    cJSON_Delete(ipAddr);
+    EncodeScanResult(writer, aResult);
 
     return ret;
 }
 
-std::string Node2JsonString(const NodeInfo &aNode)
+std::string ScanResult2JsonString(const otEnergyScanResult &aResult)
 {
-    cJSON *     node = cJSON_CreateObject();
     std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_AddItemToObject(node, "State", cJSON_CreateNumber(aNode.mRole));
-    cJSON_AddItemToObject(node, "NumOfRouter", cJSON_CreateNumber(aNode.mNumOfRouter));
-    cJSON_AddItemToObject(node, "RlocAddress", IpAddr2Json(aNode.mRlocAddress));
-    cJSON_AddItemToObject(node, "ExtAddress", Bytes2HexJson(aNode.mExtAddress, OT_EXT_ADDRESS_SIZE));
-    cJSON_AddItemToObject(node, "NetworkName", cJSON_CreateString(aNode.mNetworkName.c_str()));
-    cJSON_AddItemToObject(node, "Rloc16", cJSON_CreateNumber(aNode.mRloc16));
-    cJSON_AddItemToObject(node, "LeaderData", LeaderData2Json(aNode.mLeaderData));
-    cJSON_AddItemToObject(node, "ExtPanId", Bytes2HexJson(aNode.mExtPanId, OT_EXT_PAN_ID_SIZE));
-
-    ret = Json2String(node);
-    cJSON_Delete(node);
+    EncodeScanResult(writer, aResult);
 
     return ret;
 }
 
-std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet)
+std::string ScanResults2JsonString(const std::vector<otActiveScanResult> &aResults)
 {
-    cJSON *     diagInfo          = cJSON_CreateArray();
-    cJSON *     diagInfoOfOneNode = nullptr;
-    cJSON *     addrList          = nullptr;
-    cJSON *     tableList         = nullptr;
     std::string ret;
-    uint64_t    timeout;
-
-    for (auto diagItem : aDiagSet)
-    {
-        diagInfoOfOneNode = cJSON_CreateObject();
-        for (auto diagTlv : diagItem)
-        {
-            switch (diagTlv.mType)
-            {
-            case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "ExtAddress",
-                                      Bytes2HexJson(diagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Rloc16", cJSON_CreateNumber(diagTlv.mData.mAddr16));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Mode", Mode2Json(diagTlv.mData.mMode));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
-
-                timeout = static_cast<uint64_t>(diagTlv.mData.mTimeout);
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Timeout", cJSON_CreateNumber(timeout));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
+    JsonWriter  writer(ret);
 
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Connectivity",
-                                      Connectivity2Json(diagTlv.mData.mConnectivity));
+    EncodeScanResults(writer, aResults);
 
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "Route", Route2Json(diagTlv.mData.mRoute));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "LeaderData", LeaderData2Json(diagTlv.mData.mLeaderData));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "NetworkData",
-                                      Bytes2HexJson(diagTlv.mData.mNetworkData.m8, diagTlv.mData.mNetworkData.mCount));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
-
-                addrList = cJSON_CreateArray();
-
-                for (uint16_t i = 0; i < diagTlv.mData.mIp6AddrList.mCount; ++i)
-                {
-                    cJSON_AddItemToArray(addrList, IpAddr2Json(diagTlv.mData.mIp6AddrList.mList[i]));
-                }
-                cJSON_AddItemToObject(diagInfoOfOneNode, "IP6AddressList", addrList);
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "MACCounters", MacCounters2Json(diagTlv.mData.mMacCounters));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "BatteryLevel",
-                                      cJSON_CreateNumber(diagTlv.mData.mBatteryLevel));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "SupplyVoltage",
-                                      cJSON_CreateNumber(diagTlv.mData.mSupplyVoltage));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
-
-                tableList = cJSON_CreateArray();
-
-                for (uint16_t i = 0; i < diagTlv.mData.mChildTable.mCount; ++i)
-                {
-                    cJSON_AddItemToArray(tableList, ChildTableEntry2Json(diagTlv.mData.mChildTable.mTable[i]));
-                }
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "ChildTable", tableList);
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
-
-                cJSON_AddItemToObject(
-                    diagInfoOfOneNode, "ChannelPages",
-                    Bytes2HexJson(diagTlv.mData.mChannelPages.m8, diagTlv.mData.mChannelPages.mCount));
-
-                break;
-            case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
-
-                cJSON_AddItemToObject(diagInfoOfOneNode, "MaxChildTimeout",
-                                      cJSON_CreateNumber(diagTlv.mData.mMaxChildTimeout));
-
-                break;
-            default:
-                break;
-            }
-        }
-        cJSON_AddItemToArray(diagInfo, diagInfoOfOneNode);
-    }
+    return ret;
+}
 
-    ret = Json2String(diagInfo);
+std::string ScanResults2JsonString(const std::vector<otEnergyScanResult> &aResults)
+{
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(diagInfo);
+    EncodeScanResults(writer, aResults);
 
     return ret;
 }
 
 std::string Bytes2HexJsonString(const uint8_t *aBytes, uint8_t aLength)
 {
-    cJSON *     hex = Bytes2HexJson(aBytes, aLength);
-    std::string ret = Json2String(hex);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(hex);
+    // The quoted hex digits, allocated once.
+    ret.reserve(2 * aLength + 2);
+    writer.HexString(aBytes, aLength);
 
     return ret;
 }
 
 std::string Number2JsonString(const uint32_t &aNumber)
 {
-    cJSON *     number = cJSON_CreateNumber(aNumber);
-    std::string ret    = Json2String(number);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(number);
+    writer.Uint(aNumber);
 
     return ret;
 }
 
 std::string Mode2JsonString(const otLinkModeConfig &aMode)
 {
-    cJSON *     mode = Mode2Json(aMode);
-    std::string ret  = Json2String(mode);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(mode);
+    EncodeMode(writer, aMode);
 
     return ret;
 }
 
 std::string Connectivity2JsonString(const otNetworkDiagConnectivity &aConnectivity)
 {
-    cJSON *     connectivity = Connectivity2Json(aConnectivity);
-    std::string ret          = Json2String(connectivity);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(connectivity);
+    EncodeConnectivity(writer, aConnectivity);
 
     return ret;
 }
 
 std::string RouteData2JsonString(const otNetworkDiagRouteData &aRouteData)
 {
-    cJSON *     routeData = RouteData2Json(aRouteData);
-    std::string ret       = Json2String(routeData);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(routeData);
+    EncodeRouteData(writer, aRouteData);
 
     return ret;
 }
 
 std::string Route2JsonString(const otNetworkDiagRoute &aRoute)
 {
-    cJSON *     route = Route2Json(aRoute);
-    std::string ret   = Json2String(route);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(route);
+    EncodeRoute(writer, aRoute);
 
     return ret;
 }
 
 std::string LeaderData2JsonString(const otLeaderData &aLeaderData)
 {
-    cJSON *     leaderData = LeaderData2Json(aLeaderData);
-    std::string ret        = Json2String(leaderData);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(leaderData);
+    EncodeLeaderData(writer, aLeaderData);
 
     return ret;
 }
 
 std::string MacCounters2JsonString(const otNetworkDiagMacCounters &aMacCounters)
 {
-    cJSON *     macCounters = MacCounters2Json(aMacCounters);
-    std::string ret         = Json2String(macCounters);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(macCounters);
+    EncodeMacCounters(writer, aMacCounters);
 
     return ret;
 }
 
 std::string ChildTableEntry2JsonString(const otNetworkDiagChildEntry &aChildEntry)
 {
-    cJSON *     childEntry = ChildTableEntry2Json(aChildEntry);
-    std::string ret        = Json2String(childEntry);
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(childEntry);
+    EncodeChildTableEntry(writer, aChildEntry);
 
     return ret;
 }
 
 std::string CString2JsonString(const char *aCString)
 {
-    cJSON *     cString = CString2Json(aCString);
-    std::string ret     = Json2String(cString);
+    std::string ret;
+    JsonWriter  writer(ret);
+
+    VerifyOrExit(aCString != nullptr);
 
-    cJSON_Delete(cString);
+    // Enough unless characters need an escape.
+    ret.reserve(strlen(aCString) + 2);
+    writer.String(aCString);
 
+exit:
     return ret;
 }
 
-std::string Error2JsonString(HttpStatusCode aErrorCode, std::string aErrorMessage)
+std::string MainloopStats2JsonString(const MainloopStats &aStats)
 {
     std::string ret;
-    cJSON *     error = cJSON_CreateObject();
+    JsonWriter  writer(ret);
 
-    cJSON_AddItemToObject(error, "ErrorCode", cJSON_CreateNumber(static_cast<int16_t>(aErrorCode)));
-    cJSON_AddItemToObject(error, "ErrorMessage", cJSON_CreateString(aErrorMessage.c_str()));
+    EncodeMainloopStats(writer, aStats);
 
-    ret = Json2String(error);
+    return ret;
+}
+
+std::string Error2JsonString(HttpStatusCode aErrorCode, std::string aErrorMessage)
+{
+    std::string ret;
+    JsonWriter  writer(ret);
 
-    cJSON_Delete(error);
+    EncodeError(writer, aErrorCode, aErrorMessage);
 
     return ret;
 }
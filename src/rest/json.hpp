@@ -37,6 +37,11 @@
 #include "openthread/link.h"
 #include "openthread/thread_ftd.h"
 
+#include "agent/churn_log.hpp"
+#include "common/mainloop_stats.hpp"
+#include "rest/diagnostic_history.hpp"
+#include "rest/neighbor_log.hpp"
+#include "rest/topology.hpp"
 #include "rest/types.hpp"
 #include "utils/hex.hpp"
 
@@ -100,15 +105,131 @@ std::string String2JsonString(const std::string &aString);
  */
 std::string Node2JsonString(const NodeInfo &aNode);
 
+/**
+ * This method formats the histories of nodes to a Json array and serialize it to a string.
+ *
+ * @param[in]   aHistory  The diagnostic history.
+ * @param[in]   aSeries   The histories to format.
+ * @param[in]   aSince    Only samples recorded at or after this time, in milliseconds since the Unix epoch, are
+ *                        formatted.
+ *
+ * @returns     A string serlialized by a Json array.
+ *
+ */
+std::string DiagHistory2JsonString(const DiagnosticHistory &                           aHistory,
+                                   const std::vector<const DiagnosticHistory::Series *> &aSeries,
+                                   uint64_t                                              aSince);
+
+/**
+ * This method formats the changes of a topology since a version to a Json object and serialize it to a string.
+ *
+ * Removed nodes and links are marked with `"Removed":true`. If the changes are not available, the whole topology is
+ * serialized and `"Full"` is true.
+ *
+ * @param[in]   aTopology  The topology.
+ * @param[in]   aSince     The version the client has.
+ *
+ * @returns     A string serlialized by a Json object.
+ *
+ */
+std::string Topology2JsonString(const Topology &aTopology, uint64_t aSince);
+
+/**
+ * This method formats the neighbor table at a sequence number of its change log to a Json object and serialize it
+ * to a string.
+ *
+ * @param[in]   aSequence   The sequence number of the last change of the table.
+ * @param[in]   aNeighbors  The neighbors.
+ *
+ * @returns     A string serlialized by a Json object.
+ *
+ */
+std::string NeighborTable2JsonString(uint64_t aSequence, const std::vector<otNeighborInfo> &aNeighbors);
+
+/**
+ * This method formats a change of the neighbor table to a Json object and serialize it to a string.
+ *
+ * @param[in]   aChange     The change.
+ *
+ * @returns     A string serlialized by a Json object.
+ *
+ */
+std::string NeighborChange2JsonString(const NeighborLog::Change &aChange);
+
+/**
+ * This method formats the events of the churn log to a Json object and serialize it to a string.
+ *
+ * @param[in]   aEvents     The events.
+ * @param[in]   aDropped    The number of events dropped because the log was full.
+ *
+ * @returns     A string serlialized by a Json object.
+ *
+ */
+std::string ChurnEvents2JsonString(const std::vector<Ncp::ChurnLog::Event> &aEvents, uint32_t aDropped);
+
+/**
+ * This method formats an active scan result to a Json object and serialize it to a string.
+ *
+ * @param[in]   aResult     The active scan result.
+ *
+ * @returns     A string serlialized by a Json object.
+ *
+ */
+std::string ScanResult2JsonString(const otActiveScanResult &aResult);
+
+/**
+ * This method formats an energy scan result to a Json object and serialize it to a string.
+ *
+ * @param[in]   aResult     The energy scan result.
+ *
+ * @returns     A string serlialized by a Json object.
+ *
+ */
+std::string ScanResult2JsonString(const otEnergyScanResult &aResult);
+
+/**
+ * This method formats the results of an active scan to a Json array and serialize it to a string.
+ *
+ * @param[in]   aResults    The active scan results.
+ *
+ * @returns     A string serlialized by a Json array.
+ *
+ */
+std::string ScanResults2JsonString(const std::vector<otActiveScanResult> &aResults);
+
+/**
+ * This method formats the results of an energy scan to a Json array and serialize it to a string.
+ *
+ * @param[in]   aResults    The energy scan results.
+ *
+ * @returns     A string serlialized by a Json array.
+ *
+ */
+std::string ScanResults2JsonString(const std::vector<otEnergyScanResult> &aResults);
+
 /**
  * This method formats a vector including serveral Diagnostic object to a Json array and serialize it to a string.
  *
  * @param[in]   aDiagSet  A vector including serveral Diagnostic object.
+ * @param[in]   aTlvMask  The TLV types to include in each Diagnostic object.
  *
  * @returns     A string serlialized by a Json array.
  *
  */
-std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet);
+std::string Diag2JsonString(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet,
+                            DiagTlvMask                                       aTlvMask = kDiagTlvMaskAll);
+
+/**
+ * This method creates a producer of a chunked response body, which serializes the diagnostics of nodes to a Json array.
+ *
+ * @param[inout]    aDiagSet    The diagnostic TLVs of each node, moved into the producer.
+ * @param[in]       aTlvMask    The TLV types to include for each node.
+ *
+ * @returns The chunk producer.
+ *
+ */
+ChunkProducer Diag2JsonChunks(std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet,
+                              DiagTlvMask                                 aTlvMask = kDiagTlvMaskAll);
 
 /**
  * This method formats an Ipv6Address to a Json string and serialize it to a string.
@@ -190,6 +311,16 @@ std::string MacCounters2JsonString(const otNetworkDiagMacCounters &aMacCounters)
  */
 std::string ChildTableEntry2JsonString(const otNetworkDiagChildEntry &aChildEntry);
 
+/**
+ * This method formats the mainloop latency statistics to a Json object and serialize it to a string.
+ *
+ * @param[in]   aStats  A MainloopStats object.
+ *
+ * @returns     A string serlialized by a Json object.
+ *
+ */
+std::string MainloopStats2JsonString(const MainloopStats &aStats);
+
 /**
  * This method formats an error code and an error message to a Json object and serialize it to a string.
  *
@@ -0,0 +1,85 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the neighbor table change log for OTBR-REST.
+ */
+
+#include "rest/neighbor_log.hpp"
+
+namespace otbr {
+namespace rest {
+
+NeighborLog::NeighborLog(size_t aCapacity)
+    : mCapacity(aCapacity)
+    , mSequence(0)
+    , mMinSequence(0)
+{
+}
+
+uint64_t NeighborLog::Add(bool aAdded, const otNeighborInfo &aNeighbor)
+{
+    Change change;
+
+    change.mSequence = ++mSequence;
+    change.mAdded    = aAdded;
+    change.mNeighbor = aNeighbor;
+    mChanges.push_back(change);
+
+    while (mChanges.size() > mCapacity)
+    {
+        mMinSequence = mChanges.front().mSequence;
+        mChanges.pop_front();
+    }
+
+    return mSequence;
+}
+
+void NeighborLog::Clear(void)
+{
+    mChanges.clear();
+    mMinSequence = mSequence;
+}
+
+void NeighborLog::GetChanges(uint64_t aSince, std::vector<const Change *> &aChanges) const
+{
+    aChanges.clear();
+
+    if (HasChangesSince(aSince))
+    {
+        // The sequence numbers in the log are consecutive, ending at the last one.
+        for (size_t i = mChanges.size() - (mSequence - aSince); i < mChanges.size(); ++i)
+        {
+            aChanges.push_back(&mChanges[i]);
+        }
+    }
+}
+
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,136 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the neighbor table change log for OTBR-REST.
+ */
+
+#ifndef OTBR_REST_NEIGHBOR_LOG_HPP_
+#define OTBR_REST_NEIGHBOR_LOG_HPP_
+
+#include <deque>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "openthread/thread.h"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a log of the recent changes of the neighbor table, for clients following the table.
+ *
+ * Every neighbor added or removed is a change tagged with the next sequence number. A client which has the table
+ * at a sequence number only needs the changes after it, as long as they are still in the log. Only a limited
+ * number of changes is kept, a client which fell further behind needs the whole table.
+ *
+ */
+class NeighborLog
+{
+public:
+    /**
+     * This structure represents a change of the neighbor table.
+     *
+     */
+    struct Change
+    {
+        uint64_t       mSequence; ///< The sequence number of the change.
+        bool           mAdded;    ///< Whether the neighbor was added, or removed.
+        otNeighborInfo mNeighbor; ///< The neighbor.
+    };
+
+    /**
+     * The constructor initializes an empty log at sequence number zero.
+     *
+     * @param[in]   aCapacity   The maximum number of changes kept.
+     *
+     */
+    explicit NeighborLog(size_t aCapacity = kDefaultCapacity);
+
+    /**
+     * This method logs a change, dropping the oldest one if the log is full.
+     *
+     * @param[in]   aAdded      Whether the neighbor was added, or removed.
+     * @param[in]   aNeighbor   The neighbor.
+     *
+     * @returns The sequence number of the change.
+     *
+     */
+    uint64_t Add(bool aAdded, const otNeighborInfo &aNeighbor);
+
+    /**
+     * This method drops all changes, e.g. when the table was emptied without a change.
+     *
+     * The sequence number is kept, clients at any earlier one need the whole table.
+     *
+     */
+    void Clear(void);
+
+    /**
+     * This method returns the sequence number of the last change.
+     *
+     */
+    uint64_t GetSequence(void) const { return mSequence; }
+
+    /**
+     * This method indicates whether the changes after a sequence number could be listed.
+     *
+     * @param[in]   aSince  The sequence number the client has.
+     *
+     * @retval  true    The changes could be listed.
+     * @retval  false   Changes after @p aSince were dropped, or @p aSince is in the future, the whole table is needed.
+     *
+     */
+    bool HasChangesSince(uint64_t aSince) const { return aSince >= mMinSequence && aSince <= mSequence; }
+
+    /**
+     * This method lists the changes after a sequence number, from the oldest.
+     *
+     * @param[in]   aSince      The sequence number, see `HasChangesSince()`.
+     * @param[out]  aChanges    The changes, empty if they could not be listed.
+     *
+     */
+    void GetChanges(uint64_t aSince, std::vector<const Change *> &aChanges) const;
+
+private:
+    static const size_t kDefaultCapacity = 256;
+
+    size_t   mCapacity;
+    uint64_t mSequence;
+    uint64_t mMinSequence; // The changes after this sequence number are all in the log.
+
+    std::deque<Change> mChanges;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_NEIGHBOR_LOG_HPP_
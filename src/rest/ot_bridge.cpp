@@ -0,0 +1,101 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the bridge between the REST thread and the OpenThread mainloop.
+ */
+
+#include "rest/ot_bridge.hpp"
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace rest {
+
+OtBridge::OtBridge(void)
+    : mEnabled(false)
+{
+}
+
+otbrError OtBridge::Enable(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    SuccessOrExit(error = mOtTasks.Init());
+    mEnabled = true;
+
+exit:
+    return error;
+}
+
+otbrError OtBridge::InitRestThread(void)
+{
+    return mRestTasks.Init();
+}
+
+void OtBridge::Call(Task aTask, Task aDone)
+{
+    if (!mEnabled)
+    {
+        aTask();
+        aDone();
+        ExitNow();
+    }
+
+    // The task queues order the accesses of both threads to the state shared by the tasks.
+    mOtTasks.Post([this, aTask, aDone]() {
+        aTask();
+        mRestTasks.Post([this, aDone]() {
+            aDone();
+
+            if (mDoneHandler)
+            {
+                mDoneHandler();
+            }
+        });
+    });
+
+exit:
+    return;
+}
+
+void OtBridge::PostToRestThread(Task aTask)
+{
+    if (mEnabled)
+    {
+        mRestTasks.Post(std::move(aTask));
+    }
+    else
+    {
+        aTask();
+    }
+}
+
+} // namespace rest
+} // namespace otbr
@@ -0,0 +1,147 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the bridge between the REST thread and the OpenThread mainloop.
+ */
+
+#ifndef OTBR_REST_OT_BRIDGE_HPP_
+#define OTBR_REST_OT_BRIDGE_HPP_
+
+#include "openthread-br/config.h"
+
+#include "common/task_queue.hpp"
+#include "common/types.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class runs the calls of the REST server into OpenThread on the mainloop.
+ *
+ * When the REST server runs on its own thread, a call is posted to the mainloop, which owns the OpenThread instance,
+ * and its completion is posted back to the REST thread. Without the REST thread, calls run right away.
+ *
+ */
+class OtBridge
+{
+public:
+    typedef TaskQueue::Task Task;
+
+    /**
+     * The constructor initializes a disabled bridge, which runs calls right away.
+     *
+     */
+    OtBridge(void);
+
+    /**
+     * This method enables the bridge.
+     *
+     * This method MUST be called from the mainloop thread, before the REST thread starts.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully enabled the bridge.
+     * @retval  OTBR_ERROR_ERRNO    Failed to create the wakeup file descriptor of the mainloop.
+     *
+     */
+    otbrError Enable(void);
+
+    /**
+     * This method initializes the queue of the REST thread.
+     *
+     * This method MUST be called from the REST thread, after its poller is installed.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully initialized the queue.
+     * @retval  OTBR_ERROR_ERRNO    Failed to create the wakeup file descriptor of the REST thread.
+     *
+     */
+    otbrError InitRestThread(void);
+
+    /**
+     * This method indicates whether the bridge is enabled.
+     *
+     */
+    bool IsEnabled(void) const { return mEnabled; }
+
+    /**
+     * This method sets the handler called on the REST thread after each completion.
+     *
+     * @param[in]   aHandler    The handler.
+     *
+     */
+    void SetDoneHandler(Task aHandler) { mDoneHandler = std::move(aHandler); }
+
+    /**
+     * This method calls into OpenThread.
+     *
+     * @p aTask MUST NOT touch the state of the REST thread, and the state it shares with @p aDone is only accessed
+     * by @p aDone once @p aTask completed.
+     *
+     * @param[in]   aTask   The task to run on the mainloop.
+     * @param[in]   aDone   The task to run on the REST thread once @p aTask completed.
+     *
+     */
+    void Call(Task aTask, Task aDone);
+
+    /**
+     * This method posts a task to the REST thread, or runs it right away if the bridge is disabled.
+     *
+     * This method is thread-safe.
+     *
+     * @param[in]   aTask   The task to run.
+     *
+     */
+    void PostToRestThread(Task aTask);
+
+    /**
+     * This method runs the calls posted to the mainloop.
+     *
+     * This method MUST be called from the mainloop thread after `MainloopPoller::Poll()`.
+     *
+     */
+    void ProcessOtTasks(void) { mOtTasks.Process(); }
+
+    /**
+     * This method runs the completions and tasks posted to the REST thread.
+     *
+     * This method MUST be called from the REST thread after `MainloopPoller::Poll()`.
+     *
+     */
+    void ProcessRestTasks(void) { mRestTasks.Process(); }
+
+private:
+    bool      mEnabled;
+    Task      mDoneHandler;
+    TaskQueue mOtTasks;
+    TaskQueue mRestTasks;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_OT_BRIDGE_HPP_
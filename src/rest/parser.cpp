@@ -58,12 +58,33 @@ static int OnBody(http_parser *parser, const char *at, size_t len)
     return 0;
 }
 
+static int OnHeaderField(http_parser *parser, const char *at, size_t len)
+{
+    Request *request = reinterpret_cast<Request *>(parser->data);
+
+    request->SetHeaderField(at, len);
+
+    return 0;
+}
+
+static int OnHeaderValue(http_parser *parser, const char *at, size_t len)
+{
+    Request *request = reinterpret_cast<Request *>(parser->data);
+
+    request->SetHeaderValue(at, len);
+
+    return 0;
+}
+
 static int OnMessageComplete(http_parser *parser)
 {
     Request *request = reinterpret_cast<Request *>(parser->data);
 
     request->SetReadComplete();
 
+    // Stop at the end of this request, the next request on a persistent connection is parsed after the response.
+    http_parser_pause(parser, 1);
+
     return 0;
 }
 
@@ -79,6 +100,7 @@ static int OnHeaderComplete(http_parser *parser)
 {
     Request *request = reinterpret_cast<Request *>(parser->data);
     request->SetMethod(parser->method);
+    request->SetKeepAlive(http_should_keep_alive(parser) != 0);
     return 0;
 }
 
@@ -87,27 +109,67 @@ static int OnHandlerData(http_parser *, const char *, size_t)
     return 0;
 }
 
+static http_parser_settings MakeSettings(void)
+{
+    http_parser_settings settings;
+
+    http_parser_settings_init(&settings);
+    settings.on_message_begin    = OnMessageBegin;
+    settings.on_url              = OnUrl;
+    settings.on_status           = OnHandlerData;
+    settings.on_header_field     = OnHeaderField;
+    settings.on_header_value     = OnHeaderValue;
+    settings.on_body             = OnBody;
+    settings.on_headers_complete = OnHeaderComplete;
+    settings.on_message_complete = OnMessageComplete;
+
+    return settings;
+}
+
+// The callbacks are the same for every connection, they find the request in the parser data.
+static const http_parser_settings kSettings = MakeSettings();
+
 Parser::Parser(Request *aRequest)
+    : mRequest(aRequest)
 {
-    mParser.data = aRequest;
 }
 
 void Parser::Init(void)
 {
-    mSettings.on_message_begin    = OnMessageBegin;
-    mSettings.on_url              = OnUrl;
-    mSettings.on_status           = OnHandlerData;
-    mSettings.on_header_field     = OnHandlerData;
-    mSettings.on_header_value     = OnHandlerData;
-    mSettings.on_body             = OnBody;
-    mSettings.on_headers_complete = OnHeaderComplete;
-    mSettings.on_message_complete = OnMessageComplete;
+    // A pooled connection reuses the parser, only its state is reset. The pending data keeps its capacity.
     http_parser_init(&mParser, HTTP_REQUEST);
+    mParser.data = mRequest;
+    mPendingData.clear();
 }
 
 void Parser::Process(const char *aBuf, size_t aLength)
 {
-    http_parser_execute(&mParser, &mSettings, aBuf, aLength);
+    size_t parsed = 0;
+
+    if (HTTP_PARSER_ERRNO(&mParser) != HPE_PAUSED)
+    {
+        parsed = http_parser_execute(&mParser, &kSettings, aBuf, aLength);
+    }
+
+    if (HTTP_PARSER_ERRNO(&mParser) == HPE_PAUSED && parsed < aLength)
+    {
+        mPendingData.append(aBuf + parsed, aLength - parsed);
+    }
+}
+
+bool Parser::Resume(void)
+{
+    std::string pending;
+
+    http_parser_pause(&mParser, 0);
+    pending.swap(mPendingData);
+
+    if (!pending.empty())
+    {
+        Process(pending.data(), pending.size());
+    }
+
+    return !pending.empty();
 }
 
 } // namespace rest
@@ -35,6 +35,7 @@
 #define OTBR_REST_PARSER_HPP_
 
 #include <memory>
+#include <string>
 
 #include "rest/types.hpp"
 
@@ -63,7 +64,7 @@ public:
     Parser(Request *aRequest);
 
     /**
-     * This method initializea the http-parser.
+     * This method initializes the http-parser for a new connection.
      *
      */
     void Init(void);
@@ -71,15 +72,28 @@ public:
     /**
      * This method performs a parse process.
      *
+     * The parser stops at the end of a complete request. The data of pipelined requests after it is kept, and is
+     * parsed by `Resume()` once the request is handled.
+     *
      * @param[in]    aBuf      A pointer pointing to read buffer.
      * @param[in]    aLength   An integer indicates how much data is to be processed by parser.
      *
      */
     void Process(const char *aBuf, size_t aLength);
 
+    /**
+     * This method continues with the next request on the connection, parsing the data kept by `Process()`.
+     *
+     * @retval  true    Data of the next request was already read.
+     * @retval  false   No data of the next request was read yet.
+     *
+     */
+    bool Resume(void);
+
 private:
-    http_parser          mParser;
-    http_parser_settings mSettings;
+    Request *   mRequest;
+    http_parser mParser;
+    std::string mPendingData;
 };
 
 } // namespace rest
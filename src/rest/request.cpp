@@ -28,22 +28,117 @@
 
 #include "rest/request.hpp"
 
+#include <algorithm>
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
 namespace otbr {
 namespace rest {
 
 Request::Request(void)
     : mComplete(false)
+    , mKeepAlive(false)
+    , mArena(mHeaderBuffer, sizeof(mHeaderBuffer))
+    , mHeaders(Utils::ArenaAllocator<Header>(mArena))
+    , mHeaderValueStarted(false)
 {
 }
 
 void Request::SetUrl(const char *aString, size_t aLength)
 {
-    mUrl += std::string(aString, aLength);
+    mUrl.append(aString, aLength);
 }
 
 void Request::SetBody(const char *aString, size_t aLength)
 {
-    mBody += std::string(aString, aLength);
+    mBody.append(aString, aLength);
+}
+
+void Request::SetHeaderField(const char *aString, size_t aLength)
+{
+    if (mHeaders.empty() || mHeaderValueStarted)
+    {
+        Utils::ArenaAllocator<char> allocator(mArena);
+
+        mHeaders.emplace_back(Utils::ArenaString(allocator), Utils::ArenaString(allocator));
+        mHeaderValueStarted = false;
+    }
+
+    mHeaders.back().first.append(aString, aLength);
+}
+
+void Request::SetHeaderValue(const char *aString, size_t aLength)
+{
+    VerifyOrExit(!mHeaders.empty());
+
+    mHeaderValueStarted = true;
+    mHeaders.back().second.append(aString, aLength);
+
+exit:
+    return;
+}
+
+const Utils::ArenaString &Request::GetHeaderValue(const char *aField) const
+{
+    static const Utils::ArenaString kEmpty;
+    const Utils::ArenaString *      value = &kEmpty;
+
+    for (const auto &header : mHeaders)
+    {
+        if (strcasecmp(header.first.c_str(), aField) == 0)
+        {
+            value = &header.second;
+            break;
+        }
+    }
+
+    return *value;
+}
+
+static bool IsBlank(char aChar)
+{
+    return aChar == ' ' || aChar == '\t';
+}
+
+bool Request::MatchesIfNoneMatch(const std::string &aETag) const
+{
+    const Utils::ArenaString &ifNoneMatch = GetHeaderValue("If-None-Match");
+    bool                      matched     = false;
+    size_t                    start       = 0;
+
+    VerifyOrExit(!aETag.empty() && !ifNoneMatch.empty());
+
+    // The value is "*" or a comma separated list of entity tags, compared weakly as required for GET.
+    while (start < ifNoneMatch.size() && !matched)
+    {
+        size_t end      = std::min(ifNoneMatch.find(',', start), ifNoneMatch.size());
+        size_t tagBegin = start;
+        size_t tagEnd   = end;
+
+        while (tagBegin < tagEnd && IsBlank(ifNoneMatch[tagBegin]))
+        {
+            ++tagBegin;
+        }
+
+        while (tagEnd > tagBegin && IsBlank(ifNoneMatch[tagEnd - 1]))
+        {
+            --tagEnd;
+        }
+
+        if (tagEnd - tagBegin >= 2 && ifNoneMatch.compare(tagBegin, 2, "W/") == 0)
+        {
+            tagBegin += 2;
+        }
+
+        matched = ifNoneMatch.compare(tagBegin, tagEnd - tagBegin, "*") == 0 ||
+                  ifNoneMatch.compare(tagBegin, tagEnd - tagBegin, aETag.c_str()) == 0;
+        start   = end + 1;
+    }
+
+exit:
+    return matched;
 }
 
 void Request::SetContentLength(size_t aContentLength)
@@ -61,30 +156,49 @@ HttpMethod Request::GetMethod() const
     return static_cast<HttpMethod>(mMethod);
 }
 
-std::string Request::GetBody() const
+const std::string &Request::GetBody(void) const
 {
     return mBody;
 }
 
 std::string Request::GetUrl(void) const
 {
-    std::string url = mUrl;
-
-    size_t urlEnd = url.find("?");
+    size_t urlEnd = std::min(mUrl.find('?'), mUrl.size());
 
-    if (urlEnd != std::string::npos)
+    while (urlEnd > 0 && mUrl[urlEnd - 1] == '/')
     {
-        url = url.substr(0, urlEnd);
+        --urlEnd;
     }
-    while (!url.empty() && url[url.size() - 1] == '/')
+
+    return (urlEnd > 0) ? mUrl.substr(0, urlEnd) : std::string("/");
+}
+
+std::string Request::GetQueryValue(const char *aKey) const
+{
+    std::string value;
+    size_t      keyLength = strlen(aKey);
+    size_t      begin     = mUrl.find('?');
+
+    // The parameters are compared in place, only the value found is copied.
+    while (begin != std::string::npos)
     {
-        url.pop_back();
-    }
+        size_t end     = std::min(mUrl.find('&', begin + 1), mUrl.size());
+        size_t nameEnd = std::min(mUrl.find('=', begin + 1), end);
 
-    VerifyOrExit(url.size() > 0, url = "/");
+        if (nameEnd - begin - 1 == keyLength && mUrl.compare(begin + 1, keyLength, aKey) == 0)
+        {
+            if (nameEnd < end)
+            {
+                value.assign(mUrl, nameEnd + 1, end - nameEnd - 1);
+            }
 
-exit:
-    return url;
+            break;
+        }
+
+        begin = (end < mUrl.size()) ? end : std::string::npos;
+    }
+
+    return value;
 }
 
 void Request::SetReadComplete(void)
@@ -102,5 +216,130 @@ bool Request::IsComplete(void) const
     return mComplete;
 }
 
+void Request::SetKeepAlive(bool aKeepAlive)
+{
+    mKeepAlive = aKeepAlive;
+}
+
+bool Request::IsKeepAlive(void) const
+{
+    return mKeepAlive;
+}
+
+void Request::SetPathParams(PathParams &&aParams)
+{
+    mPathParams = std::move(aParams);
+}
+
+std::string Request::GetPathParam(const char *aName) const
+{
+    std::string value;
+
+    for (const auto &param : mPathParams)
+    {
+        if (param.first == aName)
+        {
+            value = param.second;
+            break;
+        }
+    }
+
+    return value;
+}
+
+// Returns the quality value of a value in a header field like Accept, or -1 if the value is not listed.
+static double GetQuality(const Utils::ArenaString &aField, const char *aValue)
+{
+    double quality     = -1;
+    size_t valueLength = strlen(aValue);
+    size_t start       = 0;
+
+    // The field is parsed in place, e.g. "application/json, application/cbor;q=0.9".
+    while (start < aField.size())
+    {
+        size_t end        = std::min(aField.find(',', start), aField.size());
+        size_t param      = std::min(aField.find(';', start), end);
+        size_t valueBegin = start;
+        size_t valueEnd   = param;
+        double q          = 1;
+
+        while (valueBegin < valueEnd && IsBlank(aField[valueBegin]))
+        {
+            ++valueBegin;
+        }
+
+        while (valueEnd > valueBegin && IsBlank(aField[valueEnd - 1]))
+        {
+            --valueEnd;
+        }
+
+        // Only the q parameter is considered.
+        while (param < end)
+        {
+            size_t next = std::min(aField.find(';', param + 1), end);
+            size_t name = param + 1;
+
+            while (name < next && IsBlank(aField[name]))
+            {
+                ++name;
+            }
+
+            if (next - name >= 2 && aField.compare(name, 2, "q=") == 0)
+            {
+                q = strtod(aField.c_str() + name + 2, nullptr);
+            }
+
+            param = next;
+        }
+
+        if (valueEnd - valueBegin == valueLength &&
+            strncasecmp(aField.c_str() + valueBegin, aValue, valueLength) == 0)
+        {
+            quality = std::max(quality, q);
+        }
+
+        start = end + 1;
+    }
+
+    return quality;
+}
+
+bool Request::AcceptsCbor(void) const
+{
+    const Utils::ArenaString &accept = GetHeaderValue("Accept");
+    double                    cborQ  = GetQuality(accept, "application/cbor");
+    double                    jsonQ  = std::max(GetQuality(accept, "application/json"), GetQuality(accept, "*/*"));
+
+    jsonQ = std::max(jsonQ, GetQuality(accept, "application/*"));
+
+    return cborQ > 0 && cborQ >= jsonQ;
+}
+
+bool Request::AcceptsGzip(void) const
+{
+    const Utils::ArenaString &acceptEncoding = GetHeaderValue("Accept-Encoding");
+    double                    gzipQ          = GetQuality(acceptEncoding, "gzip");
+
+    if (gzipQ < 0)
+    {
+        gzipQ = GetQuality(acceptEncoding, "*");
+    }
+
+    return gzipQ > 0;
+}
+
+void Request::Reset(void)
+{
+    mUrl.clear();
+    mBody.clear();
+    // The header list has to give its storage back before the arena is rewound.
+    HeaderList(Utils::ArenaAllocator<Header>(mArena)).swap(mHeaders);
+    mArena.Reset();
+    mPathParams.clear();
+    mHeaderValueStarted = false;
+    mComplete           = false;
+    mKeepAlive          = false;
+}
+
 } // namespace rest
 } // namespace otbr
@@ -35,10 +35,12 @@
 #define OTBR_REST_REQUEST_HPP_
 
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "common/code_utils.hpp"
 #include "rest/types.hpp"
+#include "utils/arena.hpp"
 
 namespace otbr {
 namespace rest {
@@ -74,6 +76,24 @@ public:
      */
     void SetBody(const char *aString, size_t aLength);
 
+    /**
+     * This method sets the name of a header field, which may be called several times with parts of the name.
+     *
+     * @param[in]  aString    A pointer points to the header field name.
+     * @param[in]  aLength    Length of the header field name.
+     *
+     */
+    void SetHeaderField(const char *aString, size_t aLength);
+
+    /**
+     * This method sets the value of the last header field, which may be called several times with parts of the value.
+     *
+     * @param[in]  aString    A pointer points to the header field value.
+     * @param[in]  aLength    Length of the header field value.
+     *
+     */
+    void SetHeaderValue(const char *aString, size_t aLength);
+
     /**
      * This method sets the content-length field of a request.
      *
@@ -102,6 +122,32 @@ public:
      */
     void ResetReadComplete(void);
 
+    /**
+     * This method sets whether the client wants to keep the connection open after this request.
+     *
+     * @param[in]  aKeepAlive    Whether to keep the connection open.
+     *
+     */
+    void SetKeepAlive(bool aKeepAlive);
+
+    /**
+     * This method sets the parameters extracted from the path of this request by the router.
+     *
+     * @param[in]  aParams    The path parameters.
+     *
+     */
+    void SetPathParams(PathParams &&aParams);
+
+    /**
+     * This method clears the request in place, so the next request on a persistent connection can be parsed into it.
+     *
+     * The header fields are allocated from an arena of the request, which is rewound here, so parsing requests of
+     * similar sizes into the same instance does not allocate from the heap. The arena starts with a buffer inside
+     * the request, so the header fields of typical requests never allocate from the heap.
+     *
+     */
+    void Reset(void);
+
     /**
      * This method returns the HTTP method of this request.
      *
@@ -110,11 +156,11 @@ public:
     HttpMethod GetMethod() const;
 
     /**
-     * This method returns the HTTP method of this request.
+     * This method returns the body of this request.
      *
-     * @returns A HttpMethod enum representing HTTP method of this request.
+     * @returns A reference to the body of this request, valid until the request is reset.
      */
-    std::string GetBody() const;
+    const std::string &GetBody(void) const;
 
     /**
      * This method returns the url for this request.
@@ -123,6 +169,50 @@ public:
      */
     std::string GetUrl(void) const;
 
+    /**
+     * This method returns the value of a parameter in the query string of the url.
+     *
+     * @param[in]  aKey    The parameter name.
+     *
+     * @returns A string contains the value, or an empty string if the url has no such parameter.
+     */
+    std::string GetQueryValue(const char *aKey) const;
+
+    /**
+     * This method returns the url for this request as received, including the query string.
+     *
+     * @returns A reference to the url of this request.
+     */
+    const std::string &GetRawUrl(void) const { return mUrl; }
+
+    /**
+     * This method returns the value of a parameter in the path of this request, e.g. `rloc16` for a route
+     * `/diagnostics/{rloc16}`.
+     *
+     * @param[in]  aName    The parameter name.
+     *
+     * @returns A string contains the value, or an empty string if the route has no such parameter.
+     */
+    std::string GetPathParam(const char *aName) const;
+
+    /**
+     * This method returns the value of a header field.
+     *
+     * @param[in]  aField    The header field name, which is matched case-insensitively.
+     *
+     * @returns A reference to the value, or to an empty string if the request has no such header field. The
+     *          reference is valid until the request is reset.
+     */
+    const Utils::ArenaString &GetHeaderValue(const char *aField) const;
+
+    /**
+     * This method indicates whether the If-None-Match header field of this request matches an entity tag.
+     *
+     * @param[in]  aETag    The entity tag of the current representation, including the quotes.
+     *
+     */
+    bool MatchesIfNoneMatch(const std::string &aETag) const;
+
     /**
      * This method indicates whether this request is parsed completely.
      *
@@ -130,12 +220,48 @@ public:
      */
     bool IsComplete(void) const;
 
+    /**
+     * This method indicates whether the client wants to keep the connection open after this request.
+     *
+     */
+    bool IsKeepAlive(void) const;
+
+    /**
+     * This method indicates whether the client prefers a CBOR response to a JSON one.
+     *
+     * This is true if the Accept header field lists `application/cbor` with a quality value not lower than the one
+     * `application/json` gets.
+     *
+     */
+    bool AcceptsCbor(void) const;
+
+    /**
+     * This method indicates whether the client accepts a gzip compressed response.
+     *
+     * This is true if the Accept-Encoding header field lists `gzip`, or `*` without `gzip`, with a non-zero quality
+     * value.
+     *
+     */
+    bool AcceptsGzip(void) const;
+
 private:
+    typedef std::pair<Utils::ArenaString, Utils::ArenaString>  Header;
+    typedef std::vector<Header, Utils::ArenaAllocator<Header>> HeaderList;
+
+    static constexpr size_t kHeaderBufferSize = 1024; ///< Fits the header fields of typical requests.
+
     int32_t     mMethod;
     size_t      mContentLength;
     std::string mUrl;
     std::string mBody;
     bool        mComplete;
+    bool        mKeepAlive;
+    PathParams  mPathParams;
+
+    uint8_t      mHeaderBuffer[kHeaderBufferSize];
+    Utils::Arena mArena;
+    HeaderList   mHeaders;
+    bool         mHeaderValueStarted;
 };
 
 } // namespace rest
@@ -28,12 +28,28 @@
 
 #include "rest/resource.hpp"
 
+#include <algorithm>
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <strings.h>
+
 #include "string.h"
 
+#include <openthread/link.h>
+
+#include "agent/instance_params.hpp"
+#include "common/metrics.hpp"
+#include "common/trace.hpp"
+#include "rest/cbor.hpp"
+
 #define OT_PSKC_MAX_LENGTH 16
 #define OT_EXTENDED_PANID_LENGTH 8
 
 #define OT_REST_RESOURCE_PATH_DIAGNOETIC "/diagnostics"
+#define OT_REST_RESOURCE_PATH_DIAGNOSTICS_HISTORY "/diagnostics/history"
+#define OT_REST_RESOURCE_PATH_DIAGNOSTICS_NODE "/diagnostics/{rloc16}"
 #define OT_REST_RESOURCE_PATH_NODE "/node"
 #define OT_REST_RESOURCE_PATH_NODE_RLOC "/node/rloc"
 #define OT_REST_RESOURCE_PATH_NODE_RLOC16 "/node/rloc16"
@@ -43,20 +59,32 @@
 #define OT_REST_RESOURCE_PATH_NODE_LEADERDATA "/node/leader-data"
 #define OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER "/node/num-of-router"
 #define OT_REST_RESOURCE_PATH_NODE_EXTPANID "/node/ext-panid"
+#define OT_REST_RESOURCE_PATH_NODE_NEIGHBORS "/node/neighbors"
+#define OT_REST_RESOURCE_PATH_NODE_CHURN "/node/churn"
 #define OT_REST_RESOURCE_PATH_NETWORK "/networks"
+#define OT_REST_RESOURCE_PATH_MAINLOOP_STATS "/mainloop/stats"
+#define OT_REST_RESOURCE_PATH_METRICS "/metrics"
+#define OT_REST_RESOURCE_PATH_TOPOLOGY "/topology"
+#define OT_REST_RESOURCE_PATH_TRACE "/trace"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT "/networks/current"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_COMMISSION "/networks/commission"
 #define OT_REST_RESOURCE_PATH_NETWORK_CURRENT_PREFIX "/networks/current/prefix"
+#define OT_REST_RESOURCE_PATH_NETWORK_SCAN "/networks/scan"
+#define OT_REST_RESOURCE_PATH_NETWORK_ENERGY_SCAN "/networks/energy-scan"
 
 #define OT_REST_HTTP_STATUS_200 "200 OK"
+#define OT_REST_HTTP_STATUS_400 "400 Bad Request"
 #define OT_REST_HTTP_STATUS_404 "404 Not Found"
 #define OT_REST_HTTP_STATUS_405 "405 Method Not Allowed"
 #define OT_REST_HTTP_STATUS_408 "408 Request Timeout"
 #define OT_REST_HTTP_STATUS_500 "500 Internal Server Error"
+#define OT_REST_HTTP_STATUS_503 "503 Service Unavailable"
 
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
+using std::chrono::milliseconds;
 using std::chrono::steady_clock;
+using std::chrono::system_clock;
 
 using std::placeholders::_1;
 using std::placeholders::_2;
@@ -76,6 +104,263 @@ static const uint32_t kDiagResetTimeout = 3000000;
 // Timeout (in Microseconds) for collecting diagnostics
 static const uint32_t kDiagCollectTimeout = 2000000;
 
+// Timeout (in Microseconds) for a router to answer a unicast diagnostic query
+static const uint32_t kDiagSweepNodeTimeout = 1000000;
+
+// Timeout (in Microseconds) for collecting diagnostics by unicast queries, within the callback timeout of connections
+static const uint32_t kDiagSweepCollectTimeout = 8000000;
+
+// CCA failure rate (0xffff for 100%) above which the crawler backs off
+static const uint16_t kCrawlCcaFailureRateBusy = 0xffff / 10;
+
+// Maximum crawl interval, in multiples of the configured one
+static const uint32_t kCrawlMaxBackoff = 16;
+
+// Number of crawl rounds a node is kept without answering
+static const uint32_t kCrawlTtlRounds = 3;
+
+// The query parameter value requesting a resource as a stream of Server-Sent Events
+static const char kStreamEnabled[] = "1";
+
+// Time (in Microseconds) a neighbor table stream is kept open, within the callback timeout of connections
+static const uint32_t kNeighborStreamTimeout = 8000000;
+
+// The stream sequence number of a client without the neighbor table
+static const uint64_t kNeighborSequenceNone = UINT64_MAX;
+
+// Diagnostics of more nodes than this are sent with chunked transfer coding, instead of in one body
+static const size_t kDiagChunkedThreshold = 16;
+
+// Age (in Seconds) beyond which a saved response is not served after a restart
+static const uint64_t kSnapshotMaxAge = 24 * 3600;
+
+// Time (in Seconds) after a restart the saved responses are served at most, when the live data does not converge
+static const uint32_t kSnapshotServeTimeout = 120;
+
+/**
+ * This structure maps the name of a diagnostic TLV in the JSON output to its type, for selecting TLVs with the
+ * `tlvs` query parameter.
+ *
+ */
+struct DiagTlvName
+{
+    const char *mName;
+    uint8_t     mType;
+};
+
+static const DiagTlvName kDiagTlvNames[] = {
+    {"ExtAddress", OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS},
+    {"Rloc16", OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS},
+    {"Mode", OT_NETWORK_DIAGNOSTIC_TLV_MODE},
+    {"Timeout", OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT},
+    {"Connectivity", OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY},
+    {"Route", OT_NETWORK_DIAGNOSTIC_TLV_ROUTE},
+    {"LeaderData", OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA},
+    {"NetworkData", OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA},
+    {"IP6AddressList", OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST},
+    {"MACCounters", OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS},
+    {"BatteryLevel", OT_NETWORK_DIAGNOSTIC_TLV_BATTERY_LEVEL},
+    {"SupplyVoltage", OT_NETWORK_DIAGNOSTIC_TLV_SUPPLY_VOLTAGE},
+    {"ChildTable", OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE},
+    {"ChannelPages", OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES},
+    {"MaxChildTimeout", OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT},
+};
+
+// Diagnostics are kept longer than a collection takes, so the first answers are still there when it completes.
+static steady_clock::duration GetDiagTtl(void)
+{
+    uint32_t timeout = kDiagResetTimeout;
+
+    if (InstanceParams::Get().GetRestDiagSweepWindow() > 0)
+    {
+        timeout += kDiagSweepCollectTimeout;
+    }
+
+    return microseconds(timeout);
+}
+
+static DiagTlvMask GetDiagTlvBit(uint8_t aType)
+{
+    return static_cast<DiagTlvMask>(1) << aType;
+}
+
+/**
+ * This function parses the `tlvs` query parameter, a comma separated list of TLV names or numeric types.
+ *
+ * @param[in]   aTlvs       The value of the query parameter, an empty string selects all TLVs.
+ * @param[out]  aTlvMask    The selected TLV types.
+ *
+ * @retval  OTBR_ERROR_NONE         Successfully parsed the TLV types.
+ * @retval  OTBR_ERROR_INVALID_ARGS A TLV is unknown or cannot be queried.
+ *
+ */
+static otbrError ParseDiagTlvs(const std::string &aTlvs, DiagTlvMask &aTlvMask)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    size_t    begin = 0;
+
+    aTlvMask = 0;
+
+    if (aTlvs.empty())
+    {
+        for (uint8_t type : kAllTlvTypes)
+        {
+            aTlvMask |= GetDiagTlvBit(type);
+        }
+        ExitNow();
+    }
+
+    while (begin <= aTlvs.size())
+    {
+        size_t      end   = std::min(aTlvs.find(",", begin), aTlvs.size());
+        std::string tlv   = aTlvs.substr(begin, end - begin);
+        DiagTlvMask bit   = 0;
+        char *      value = nullptr;
+        long        type  = strtol(tlv.c_str(), &value, 10);
+
+        if (!tlv.empty() && *value == '\0')
+        {
+            for (uint8_t allowed : kAllTlvTypes)
+            {
+                bit |= (type == allowed) ? GetDiagTlvBit(allowed) : 0;
+            }
+        }
+        else
+        {
+            for (const DiagTlvName &name : kDiagTlvNames)
+            {
+                bit |= (strcasecmp(tlv.c_str(), name.mName) == 0) ? GetDiagTlvBit(name.mType) : 0;
+            }
+        }
+
+        VerifyOrExit(bit != 0, error = OTBR_ERROR_INVALID_ARGS);
+        aTlvMask |= bit;
+        begin = end + 1;
+    }
+
+exit:
+    return error;
+}
+
+/**
+ * This function parses the TLV types selected by the `tlvs` and `fields` query parameters.
+ *
+ * The `fields` parameter projects a collection resource to the given fields, which for diagnostics are the TLVs.
+ * When both are given, the TLVs listed in both are selected.
+ *
+ * @param[in]   aRequest    The request.
+ * @param[out]  aTlvMask    The selected TLV types.
+ *
+ * @retval  OTBR_ERROR_NONE         Successfully parsed the TLV types.
+ * @retval  OTBR_ERROR_INVALID_ARGS A TLV is unknown or cannot be queried.
+ *
+ */
+static otbrError ParseDiagTlvMask(const Request &aRequest, DiagTlvMask &aTlvMask)
+{
+    otbrError   error;
+    DiagTlvMask fieldMask;
+
+    SuccessOrExit(error = ParseDiagTlvs(aRequest.GetQueryValue("tlvs"), aTlvMask));
+    SuccessOrExit(error = ParseDiagTlvs(aRequest.GetQueryValue("fields"), fieldMask));
+    aTlvMask &= fieldMask;
+    VerifyOrExit(aTlvMask != 0, error = OTBR_ERROR_INVALID_ARGS);
+
+exit:
+    return error;
+}
+
+/**
+ * This function parses the `offset` and `limit` query parameters selecting a page of a collection resource.
+ *
+ * @param[in]   aRequest    The request.
+ * @param[out]  aOffset     The index of the first item, zero if not given.
+ * @param[out]  aLimit      The maximum number of items, unlimited if not given.
+ *
+ * @retval  OTBR_ERROR_NONE         Successfully parsed the page.
+ * @retval  OTBR_ERROR_INVALID_ARGS A parameter is not a decimal number, or the limit is zero.
+ *
+ */
+static otbrError ParsePage(const Request &aRequest, size_t &aOffset, size_t &aLimit)
+{
+    otbrError   error  = OTBR_ERROR_NONE;
+    std::string offset = aRequest.GetQueryValue("offset");
+    std::string limit  = aRequest.GetQueryValue("limit");
+    char *      end;
+
+    aOffset = 0;
+    aLimit  = SIZE_MAX;
+
+    if (!offset.empty())
+    {
+        VerifyOrExit(isdigit(offset[0]), error = OTBR_ERROR_INVALID_ARGS);
+        aOffset = strtoul(offset.c_str(), &end, 10);
+        VerifyOrExit(*end == '\0', error = OTBR_ERROR_INVALID_ARGS);
+    }
+
+    if (!limit.empty())
+    {
+        VerifyOrExit(isdigit(limit[0]), error = OTBR_ERROR_INVALID_ARGS);
+        aLimit = strtoul(limit.c_str(), &end, 10);
+        VerifyOrExit(*end == '\0' && aLimit > 0, error = OTBR_ERROR_INVALID_ARGS);
+    }
+
+exit:
+    return error;
+}
+
+/**
+ * This structure represents a resource whose GET response is cached, and the state changes invalidating it.
+ *
+ * Resources depending on state without a change flag, e.g. the number of routers, are not cached.
+ *
+ */
+struct CachedResource
+{
+    const char *   mPath;
+    otChangedFlags mFlags;
+};
+
+static const CachedResource kCachedResources[] = {
+    {OT_REST_RESOURCE_PATH_NODE_STATE, OT_CHANGED_THREAD_ROLE},
+    {OT_REST_RESOURCE_PATH_NODE_EXTADDRESS, OT_CHANGED_THREAD_LL_ADDR},
+    {OT_REST_RESOURCE_PATH_NODE_NETWORKNAME, OT_CHANGED_THREAD_NETWORK_NAME},
+    {OT_REST_RESOURCE_PATH_NODE_LEADERDATA,
+     OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_PARTITION_ID | OT_CHANGED_THREAD_NETDATA},
+    {OT_REST_RESOURCE_PATH_NODE_RLOC16, OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_RLOC_ADDED},
+    {OT_REST_RESOURCE_PATH_NODE_EXTPANID, OT_CHANGED_THREAD_EXT_PANID},
+    {OT_REST_RESOURCE_PATH_NODE_RLOC,
+     OT_CHANGED_THREAD_ROLE | OT_CHANGED_THREAD_RLOC_ADDED | OT_CHANGED_THREAD_RLOC_REMOVED |
+         OT_CHANGED_THREAD_ML_ADDR},
+};
+
+/**
+ * This structure represents a resource whose GET response is saved, to be served right after a restart.
+ *
+ */
+struct SnapshotResource
+{
+    const char *mPath;
+    uint8_t     mBit;
+};
+
+enum : uint8_t
+{
+    kSnapshotNode        = 1 << 0,
+    kSnapshotDiagnostics = 1 << 1,
+    kSnapshotTopology    = 1 << 2,
+};
+
+static const SnapshotResource kSnapshotResources[] = {
+    {OT_REST_RESOURCE_PATH_NODE, kSnapshotNode},
+    {OT_REST_RESOURCE_PATH_DIAGNOETIC, kSnapshotDiagnostics},
+    {OT_REST_RESOURCE_PATH_TOPOLOGY, kSnapshotTopology},
+};
+
+static uint64_t GetUnixTime(void)
+{
+    return static_cast<uint64_t>(duration_cast<std::chrono::seconds>(system_clock::now().time_since_epoch()).count());
+}
+
 static std::string GetHttpStatus(HttpStatusCode aErrorCode)
 {
     std::string httpStatus;
@@ -85,6 +370,9 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
     case HttpStatusCode::kStatusOk:
         httpStatus = OT_REST_HTTP_STATUS_200;
         break;
+    case HttpStatusCode::kStatusBadRequest:
+        httpStatus = OT_REST_HTTP_STATUS_400;
+        break;
     case HttpStatusCode::kStatusResourceNotFound:
         httpStatus = OT_REST_HTTP_STATUS_404;
         break;
@@ -97,6 +385,9 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
     case HttpStatusCode::kStatusInternalServerError:
         httpStatus = OT_REST_HTTP_STATUS_500;
         break;
+    case HttpStatusCode::kStatusServiceUnavailable:
+        httpStatus = OT_REST_HTTP_STATUS_503;
+        break;
     }
 
     return httpStatus;
@@ -104,206 +395,638 @@ static std::string GetHttpStatus(HttpStatusCode aErrorCode)
 
 Resource::Resource(ControllerOpenThread *aNcp)
     : mNcp(aNcp)
+    , mDiagStore(microseconds(kDiagResetTimeout))
+    , mLazyEncoding(false)
+    , mDiagCollecting(false)
+    , mDiagTlvMask(0)
+    , mCrawlRouterId(0)
+    , mCrawlInterval(steady_clock::duration::zero())
+    , mCrawlCount(0)
+    , mSnapshotStale(0)
 {
     mInstance = mNcp->GetThreadHelper()->GetInstance();
 
     // Resource Handler
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOETIC, &Resource::Diagnostic);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE, &Resource::NodeInfo);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_STATE, &Resource::State);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_EXTADDRESS, &Resource::ExtendedAddr);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_NETWORKNAME, &Resource::NetworkName);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_RLOC16, &Resource::Rloc16);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_LEADERDATA, &Resource::LeaderData);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER, &Resource::NumOfRoute);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_EXTPANID, &Resource::ExtendedPanId);
-    mResourceMap.emplace(OT_REST_RESOURCE_PATH_NODE_RLOC, &Resource::Rloc);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_DIAGNOETIC, &Resource::Diagnostic);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_NODE, &Resource::NodeInfo);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_NODE_STATE, &Resource::State);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_NODE_EXTADDRESS, &Resource::ExtendedAddr);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_NODE_NETWORKNAME, &Resource::NetworkName);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_NODE_RLOC16, &Resource::Rloc16);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_NODE_LEADERDATA, &Resource::LeaderData);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_NODE_NUMOFROUTER, &Resource::NumOfRoute);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_NODE_EXTPANID, &Resource::ExtendedPanId);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_NODE_RLOC, &Resource::Rloc);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_MAINLOOP_STATS, &Resource::MainloopStatistics);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_TOPOLOGY, &Resource::NetworkTopology);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_DIAGNOSTICS_HISTORY, &Resource::DiagHistory);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_DIAGNOSTICS_NODE, &Resource::DiagNode);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_METRICS, &Resource::ExportMetrics);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_TRACE, &Resource::ExportTrace);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_NODE_NEIGHBORS, &Resource::Neighbors);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_NODE_CHURN, &Resource::Churn);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_NETWORK_SCAN, &Resource::ActiveScan);
+    mRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_NETWORK_ENERGY_SCAN, &Resource::EnergyScan);
+
+    mDiagStore.SetRemovedHandler([this](uint16_t aRloc16) {
+        mTopology.Remove(aRloc16);
+        mDiagSampler.Remove(aRloc16);
+    });
 
     // Resource callback handler
-    mResourceCallbackMap.emplace(OT_REST_RESOURCE_PATH_DIAGNOETIC, &Resource::HandleDiagnosticCallback);
+    mCallbackRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_DIAGNOETIC, &Resource::HandleDiagnosticCallback);
+    mCallbackRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_NODE_NEIGHBORS, &Resource::HandleNeighborsCallback);
+    mCallbackRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_NETWORK_SCAN, &Resource::HandleActiveScanCallback);
+    mCallbackRouter.Add(HttpMethod::kGet, OT_REST_RESOURCE_PATH_NETWORK_ENERGY_SCAN,
+                        &Resource::HandleEnergyScanCallback);
 }
 
 void Resource::Init(void)
 {
-    otThreadSetReceiveDiagnosticGetCallback(mInstance, &Resource::DiagnosticResponseHandler, this);
-}
+    otChangedFlags cachedFlags = 0;
 
-void Resource::Handle(Request &aRequest, Response &aResponse) const
-{
-    std::string url = aRequest.GetUrl();
-    auto        it  = mResourceMap.find(url);
+    otThreadSetReceiveDiagnosticGetCallback(mInstance, &Resource::DiagnosticResponseHandler, this);
+    mDiagHistory.Init(InstanceParams::Get().GetRestDiagHistorySize() * 1024);
+    mDiagStore.SetTtl(GetDiagTtl());
 
-    if (it != mResourceMap.end())
-    {
-        ResourceHandler resourceHandler = it->second;
-        (this->*resourceHandler)(aRequest, aResponse);
-    }
-    else
+    for (const CachedResource &resource : kCachedResources)
     {
-        ErrorHandler(aResponse, HttpStatusCode::kStatusResourceNotFound);
+        cachedFlags |= resource.mFlags;
     }
+
+    mNcp->RegisterStateChangedHandler(cachedFlags, [this](otChangedFlags aFlags) { InvalidateCache(aFlags); });
+    mNcp->RegisterNeighborTableHandler(std::bind(&Resource::HandleNeighborTableEvent, this, _1, _2));
+    mNcp->RegisterSoftResetHandler([this]() {
+        mInstance = mNcp->GetInstance();
+        otThreadSetReceiveDiagnosticGetCallback(mInstance, &Resource::DiagnosticResponseHandler, this);
+        // The neighbor table is emptied without a change, the streams send it again.
+        mNeighborLog.Clear();
+    });
+    mNcp->RegisterResetHandler([this]() { mResponseCache.clear(); });
+
+    LoadSnapshot();
 }
 
-void Resource::HandleCallback(Request &aRequest, Response &aResponse)
+void Resource::LoadSnapshot(void)
 {
-    std::string url = aRequest.GetUrl();
-    auto        it  = mResourceCallbackMap.find(url);
+    const char *path = InstanceParams::Get().GetRestSnapshotFile();
+
+    VerifyOrExit(path != nullptr && path[0] != '\0');
+    SuccessOrExit(mSnapshot.Load(path, GetUnixTime(), kSnapshotMaxAge));
 
-    if (it != mResourceCallbackMap.end())
+    for (const SnapshotResource &resource : kSnapshotResources)
     {
-        ResourceCallbackHandler resourceHandler = it->second;
-        (this->*resourceHandler)(aRequest, aResponse);
+        if (mSnapshot.Find(resource.mPath) != nullptr)
+        {
+            mSnapshotStale |= resource.mBit;
+        }
     }
+
+    mSnapshotDeadline = steady_clock::now() + std::chrono::seconds(kSnapshotServeTimeout);
+    otbrLog(OTBR_LOG_INFO, "loaded the snapshot of %zu resources from %s", mSnapshot.GetEntries().size(), path);
+
+exit:
+    return;
 }
 
-void Resource::HandleDiagnosticCallback(const Request &aRequest, Response &aResponse)
+void Resource::SaveSnapshot(void)
 {
-    OT_UNUSED_VARIABLE(aRequest);
+    const char *                               path = InstanceParams::Get().GetRestSnapshotFile();
+    uint64_t                                   now  = GetUnixTime();
     std::vector<std::vector<otNetworkDiagTlv>> diagContentSet;
-    std::string                                body;
-    std::string                                errorCode;
+    Response                                   json;
+    Response                                   cbor;
+
+    VerifyOrExit(path != nullptr && path[0] != '\0');
 
-    auto duration = duration_cast<microseconds>(steady_clock::now() - aResponse.GetStartTime()).count();
-    if (duration >= kDiagCollectTimeout)
+    // A resource still served from the snapshot keeps its saved bodies, the others are taken from the live data.
+    if (!(mSnapshotStale & kSnapshotNode) && otThreadGetDeviceRole(mInstance) > OT_DEVICE_ROLE_DETACHED)
     {
-        DeleteOutDatedDiagnostic();
+        cbor.SetCbor(true);
+        GetNodeInfo(json);
+        GetNodeInfo(cbor);
 
-        for (auto it = mDiagSet.begin(); it != mDiagSet.end(); ++it)
+        if (json.GetResponseCode() == OT_REST_HTTP_STATUS_200 && cbor.GetResponseCode() == OT_REST_HTTP_STATUS_200)
         {
-            diagContentSet.push_back(it->second.mDiagContent);
+            mSnapshot.Set(OT_REST_RESOURCE_PATH_NODE, ResponseSnapshot::Entry{now, json.GetBody(), cbor.GetBody()});
         }
+    }
 
-        body      = Json::Diag2JsonString(diagContentSet);
-        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
-        aResponse.SetResponsCode(errorCode);
-        aResponse.SetBody(body);
-        aResponse.SetComplete();
+    if (!mDiagStore.GetEntries().empty())
+    {
+        if (!(mSnapshotStale & kSnapshotDiagnostics))
+        {
+            GetDiagPage(0, SIZE_MAX, diagContentSet);
+            mSnapshot.Set(OT_REST_RESOURCE_PATH_DIAGNOETIC,
+                          ResponseSnapshot::Entry{now, Json::Diag2JsonString(diagContentSet, kDiagTlvMaskAll),
+                                                  Cbor::Diag2CborString(diagContentSet, kDiagTlvMaskAll)});
+        }
+
+        if (!(mSnapshotStale & kSnapshotTopology))
+        {
+            mSnapshot.Set(OT_REST_RESOURCE_PATH_TOPOLOGY,
+                          ResponseSnapshot::Entry{now, Json::Topology2JsonString(mTopology, 0),
+                                                  Cbor::Topology2CborString(mTopology, 0)});
+        }
     }
-}
 
-void Resource::ErrorHandler(Response &aResponse, HttpStatusCode aErrorCode) const
-{
-    std::string errorMessage = GetHttpStatus(aErrorCode);
-    std::string body         = Json::Error2JsonString(aErrorCode, errorMessage);
+    mSnapshot.Save(path);
 
-    aResponse.SetResponsCode(errorMessage);
-    aResponse.SetBody(body);
-    aResponse.SetComplete();
+exit:
+    return;
 }
 
-void Resource::GetNodeInfo(Response &aResponse) const
+bool Resource::GetSnapshotResponse(const Request &aRequest, Response &aResponse) const
 {
-    otbrError       error = OTBR_ERROR_NONE;
-    struct NodeInfo node;
-    otRouterInfo    routerInfo;
-    uint8_t         maxRouterId;
-    std::string     body;
-    std::string     errorCode;
+    const ResponseSnapshot::Entry *entry  = nullptr;
+    bool                           served = false;
+    std::string                    url    = aRequest.GetUrl();
+    std::string                    body;
+    std::string                    errorCode;
+    uint64_t                       now;
 
-    VerifyOrExit(otThreadGetLeaderData(mInstance, &node.mLeaderData) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
+    VerifyOrExit(mSnapshotStale != 0);
 
-    node.mNumOfRouter = 0;
-    maxRouterId       = otThreadGetMaxRouterId(mInstance);
-    for (uint8_t i = 0; i <= maxRouterId; ++i)
+    if (steady_clock::now() >= mSnapshotDeadline)
     {
-        if (otThreadGetRouterInfo(mInstance, i, &routerInfo) != OT_ERROR_NONE)
+        otbrLog(OTBR_LOG_INFO, "stopped serving the snapshot before the live data converged");
+        mSnapshotStale = 0;
+        ExitNow();
+    }
+
+    if (otThreadGetDeviceRole(mInstance) > OT_DEVICE_ROLE_DETACHED)
+    {
+        mSnapshotStale &= ~kSnapshotNode;
+    }
+
+    // Only the whole resource is saved, a request with query parameters is always answered live.
+    VerifyOrExit(aRequest.GetRawUrl().find('?') == std::string::npos);
+
+    for (const SnapshotResource &resource : kSnapshotResources)
+    {
+        if (url == resource.mPath && (mSnapshotStale & resource.mBit))
         {
-            continue;
+            entry = mSnapshot.Find(url);
+            break;
         }
-        ++node.mNumOfRouter;
     }
 
-    node.mRole        = otThreadGetDeviceRole(mInstance);
-    node.mExtAddress  = reinterpret_cast<const uint8_t *>(otLinkGetExtendedAddress(mInstance));
-    node.mNetworkName = otThreadGetNetworkName(mInstance);
-    node.mRloc16      = otThreadGetRloc16(mInstance);
-    node.mExtPanId    = reinterpret_cast<const uint8_t *>(otThreadGetExtendedPanId(mInstance));
-    node.mRlocAddress = *otThreadGetRloc(mInstance);
+    VerifyOrExit(entry != nullptr);
 
-    body = Json::Node2JsonString(node);
+    body = aResponse.IsCbor() ? entry->mCbor : entry->mJson;
+    VerifyOrExit(!body.empty());
+
+    now       = GetUnixTime();
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
     aResponse.SetBody(body);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetStale(now > entry->mTime ? now - entry->mTime : 0);
+    served = true;
 
 exit:
-    if (error == OTBR_ERROR_NONE)
-    {
-        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
-        aResponse.SetResponsCode(errorCode);
-    }
-    else
-    {
-        ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError);
-    }
+    return served;
 }
 
-void Resource::NodeInfo(const Request &aRequest, Response &aResponse) const
+void Resource::Handle(Request &aRequest, Response &aResponse) const
 {
-    std::string errorCode;
-    if (aRequest.GetMethod() == HttpMethod::kGet)
-    {
-        GetNodeInfo(aResponse);
-    }
-    else
+    ResourceHandler resourceHandler = nullptr;
+    PathParams      params;
+    std::string     url;
+
+    switch (mRouter.Match(aRequest.GetMethod(), aRequest.GetRawUrl(), resourceHandler, params))
     {
+    case RouteResult::kNotFound:
+        ErrorHandler(aResponse, HttpStatusCode::kStatusResourceNotFound);
+        break;
+    case RouteResult::kMethodNotAllowed:
         ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
-    }
-}
+        break;
+    case RouteResult::kMatched:
+        aRequest.SetPathParams(std::move(params));
 
-void Resource::GetDataExtendedAddr(Response &aResponse) const
-{
-    const uint8_t *extAddress = reinterpret_cast<const uint8_t *>(otLinkGetExtendedAddress(mInstance));
-    std::string    errorCode;
-    std::string    body = Json::Bytes2HexJsonString(extAddress, OT_EXT_ADDRESS_SIZE);
+        if (aRequest.GetMethod() != HttpMethod::kGet)
+        {
+            (this->*resourceHandler)(aRequest, aResponse);
+            break;
+        }
 
-    aResponse.SetBody(body);
-    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
-    aResponse.SetResponsCode(errorCode);
+        url = aRequest.GetUrl();
+
+        if (GetSnapshotResponse(aRequest, aResponse))
+        {
+            if (url == OT_REST_RESOURCE_PATH_DIAGNOETIC)
+            {
+                // Start the collection the live diagnostics converge with, nobody waits for its answer.
+                Response live;
+
+                (this->*resourceHandler)(aRequest, live);
+            }
+        }
+        else if (!GetCachedResponse(url, aResponse))
+        {
+            (this->*resourceHandler)(aRequest, aResponse);
+            CacheResponse(url, aResponse);
+        }
+        break;
+    }
 }
 
-void Resource::ExtendedAddr(const Request &aRequest, Response &aResponse) const
+bool Resource::GetCachedResponse(const std::string &aUrl, Response &aResponse) const
 {
+    auto        it     = mResponseCache.find(aUrl);
+    bool        cached = false;
     std::string errorCode;
 
-    if (aRequest.GetMethod() == HttpMethod::kGet)
+    VerifyOrExit(it != mResponseCache.end());
+
     {
-        GetDataExtendedAddr(aResponse);
+        CachedBody &body = aResponse.IsCbor() ? it->second.mCbor : it->second.mJson;
+
+        VerifyOrExit(!body.mETag.empty());
+
+        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+        aResponse.SetBody(body.mBody);
+        aResponse.SetETag(body.mETag);
+        aResponse.SetResponsCode(errorCode);
+        cached = true;
     }
-    else
+
+exit:
+    return cached;
+}
+
+void Resource::CacheResponse(const std::string &aUrl, Response &aResponse) const
+{
+    VerifyOrExit(aResponse.GetResponseCode() == OT_REST_HTTP_STATUS_200);
+
+    for (const CachedResource &resource : kCachedResources)
     {
-        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+        if (aUrl == resource.mPath)
+        {
+            CachedResponse &cached = mResponseCache[aUrl];
+            CachedBody &    body   = aResponse.IsCbor() ? cached.mCbor : cached.mJson;
+
+            // The entity tag is computed once per cached body.
+            aResponse.UpdateETag();
+            body.mBody = aResponse.GetBody();
+            body.mETag = aResponse.GetETag();
+            break;
+        }
     }
+
+exit:
+    return;
 }
 
-void Resource::GetDataState(Response &aResponse) const
+void Resource::InvalidateCache(otChangedFlags aFlags)
 {
-    std::string state;
-    std::string errorCode;
-    uint8_t     role;
-    // 0 : disabled
-    // 1 : detached
-    // 2 : child
-    // 3 : router
-    // 4 : leader
-
-    role  = otThreadGetDeviceRole(mInstance);
-    state = Json::Number2JsonString(role);
-    aResponse.SetBody(state);
-    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
-    aResponse.SetResponsCode(errorCode);
+    for (const CachedResource &resource : kCachedResources)
+    {
+        if (aFlags & resource.mFlags)
+        {
+            mResponseCache.erase(resource.mPath);
+        }
+    }
 }
 
-void Resource::State(const Request &aRequest, Response &aResponse) const
+void Resource::HandleNeighborTableEvent(otNeighborTableEvent aEvent, const otNeighborTableEntryInfo &aEntryInfo)
 {
-    std::string errorCode;
+    const otChildInfo &child = aEntryInfo.mInfo.mChild;
+    otNeighborInfo     neighbor;
 
-    if (aRequest.GetMethod() == HttpMethod::kGet)
+    switch (aEvent)
     {
-        GetDataState(aResponse);
+    case OT_NEIGHBOR_TABLE_EVENT_CHILD_ADDED:
+    case OT_NEIGHBOR_TABLE_EVENT_CHILD_REMOVED:
+        // The neighbor table entry of a child, the child information carries no frame counters.
+        memset(&neighbor, 0, sizeof(neighbor));
+        neighbor.mExtAddress       = child.mExtAddress;
+        neighbor.mAge              = child.mAge;
+        neighbor.mRloc16           = child.mRloc16;
+        neighbor.mLinkQualityIn    = child.mLinkQualityIn;
+        neighbor.mAverageRssi      = child.mAverageRssi;
+        neighbor.mLastRssi         = child.mLastRssi;
+        neighbor.mFrameErrorRate   = child.mFrameErrorRate;
+        neighbor.mMessageErrorRate = child.mMessageErrorRate;
+        neighbor.mRxOnWhenIdle     = child.mRxOnWhenIdle;
+        neighbor.mFullThreadDevice = child.mFullThreadDevice;
+        neighbor.mFullNetworkData  = child.mFullNetworkData;
+        neighbor.mIsChild          = true;
+        break;
+    case OT_NEIGHBOR_TABLE_EVENT_ROUTER_ADDED:
+    case OT_NEIGHBOR_TABLE_EVENT_ROUTER_REMOVED:
+        neighbor = aEntryInfo.mInfo.mRouter;
+        break;
+    default:
+        ExitNow();
     }
-    else
+
+    mNeighborLog.Add(aEvent == OT_NEIGHBOR_TABLE_EVENT_CHILD_ADDED || aEvent == OT_NEIGHBOR_TABLE_EVENT_ROUTER_ADDED,
+                     neighbor);
+
+    if (mUpdateHandler)
     {
-        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+        mUpdateHandler();
     }
-}
+
+exit:
+    return;
+}
+
+void Resource::HandleCallback(Request &aRequest, Response &aResponse)
+{
+    ResourceCallbackHandler resourceHandler = nullptr;
+    PathParams              params;
+
+    if (mCallbackRouter.Match(aRequest.GetMethod(), aRequest.GetRawUrl(), resourceHandler, params) ==
+        RouteResult::kMatched)
+    {
+        (this->*resourceHandler)(aRequest, aResponse);
+    }
+}
+
+void Resource::HandleDiagnosticCallback(const Request &aRequest, Response &aResponse)
+{
+    std::vector<std::vector<otNetworkDiagTlv>> diagContentSet;
+    std::string                                body;
+    std::string                                errorCode;
+    DiagTlvMask                                tlvMask;
+    size_t                                     offset;
+    size_t                                     limit;
+
+    if (ParseDiagTlvMask(aRequest, tlvMask) != OTBR_ERROR_NONE)
+    {
+        // Not reached, the request has been validated when the query was sent.
+        tlvMask = kDiagTlvMaskAll;
+    }
+
+    if (ParsePage(aRequest, offset, limit) != OTBR_ERROR_NONE)
+    {
+        // Not reached, as above.
+        offset = 0;
+        limit  = SIZE_MAX;
+    }
+
+    auto now = steady_clock::now();
+
+    if (aResponse.IsStream())
+    {
+        // Push each node's diagnostics received since the last update in its own event.
+        for (const auto &entry : mDiagStore.GetEntries())
+        {
+            if (entry.second.mUpdateTime >= aResponse.GetStreamTime())
+            {
+                diagContentSet.assign(1, entry.second.mTlvs);
+                aResponse.AppendStreamEvent(Json::Diag2JsonString(diagContentSet, tlvMask));
+            }
+        }
+        aResponse.SetStreamTime(now);
+
+        if (IsDiagAnswered(aResponse.GetStartTime(), now))
+        {
+            aResponse.EndStream();
+        }
+    }
+    else if (IsDiagAnswered(aResponse.GetStartTime(), now))
+    {
+        mDiagStore.Expire(now);
+        GetDiagPage(offset, limit, diagContentSet);
+
+        if (mLazyEncoding || diagContentSet.size() > kDiagChunkedThreshold)
+        {
+            // Encode the body as it is written, so it is never held as a whole.
+            aResponse.SetChunked(aResponse.IsCbor() ? Cbor::Diag2CborChunks(diagContentSet, tlvMask)
+                                                    : Json::Diag2JsonChunks(diagContentSet, tlvMask));
+        }
+        else
+        {
+            body = aResponse.IsCbor() ? Cbor::Diag2CborString(diagContentSet, tlvMask)
+                                      : Json::Diag2JsonString(diagContentSet, tlvMask);
+            aResponse.SetBody(body);
+        }
+
+        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+        aResponse.SetResponsCode(errorCode);
+        aResponse.SetComplete();
+    }
+}
+
+void Resource::HandleNeighborsCallback(const Request &aRequest, Response &aResponse)
+{
+    OTBR_UNUSED_VARIABLE(aRequest);
+
+    AppendNeighborChanges(aResponse);
+
+    if (steady_clock::now() - aResponse.GetStartTime() >= microseconds(kNeighborStreamTimeout))
+    {
+        // End the stream before the connection would time out, the client reconnects with the last event ID.
+        aResponse.EndStream();
+    }
+}
+
+void Resource::AppendNeighborChanges(Response &aResponse) const
+{
+    std::vector<const NeighborLog::Change *> changes;
+    std::vector<otNeighborInfo>              neighbors;
+
+    if (!mNeighborLog.HasChangesSince(aResponse.GetStreamSequence()))
+    {
+        // The client has no table or missed changes, send the whole table first.
+        GetNeighborTable(neighbors);
+        aResponse.AppendStreamEvent(Json::NeighborTable2JsonString(mNeighborLog.GetSequence(), neighbors),
+                                    mNeighborLog.GetSequence());
+        aResponse.SetStreamSequence(mNeighborLog.GetSequence());
+    }
+
+    mNeighborLog.GetChanges(aResponse.GetStreamSequence(), changes);
+    for (const NeighborLog::Change *change : changes)
+    {
+        aResponse.AppendStreamEvent(Json::NeighborChange2JsonString(*change), change->mSequence);
+    }
+    aResponse.SetStreamSequence(mNeighborLog.GetSequence());
+}
+
+void Resource::HandleActiveScanCallback(const Request &aRequest, Response &aResponse)
+{
+    OTBR_UNUSED_VARIABLE(aRequest);
+
+    HandleScanCallback(mActiveScan, aResponse);
+}
+
+void Resource::HandleEnergyScanCallback(const Request &aRequest, Response &aResponse)
+{
+    OTBR_UNUSED_VARIABLE(aRequest);
+
+    HandleScanCallback(mEnergyScan, aResponse);
+}
+
+template <typename ResultType>
+void Resource::HandleScanCallback(const ScanState<ResultType> &aScan, Response &aResponse) const
+{
+    std::string body;
+    std::string errorCode;
+
+    if (aResponse.IsStream())
+    {
+        AppendScanResults(aScan, aResponse);
+    }
+    else if (!aScan.mRunning)
+    {
+        body = aResponse.IsCbor() ? Cbor::ScanResults2CborString(aScan.mResults)
+                                  : Json::ScanResults2JsonString(aScan.mResults);
+        aResponse.SetBody(body);
+        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+        aResponse.SetResponsCode(errorCode);
+        aResponse.SetComplete();
+    }
+}
+
+template <typename ResultType>
+void Resource::AppendScanResults(const ScanState<ResultType> &aScan, Response &aResponse) const
+{
+    // The sequence of a stream is the number of results it has been sent.
+    VerifyOrExit(aResponse.GetStreamTime() == aScan.mStartTime, aResponse.EndStream());
+
+    for (size_t i = aResponse.GetStreamSequence(); i < aScan.mResults.size(); ++i)
+    {
+        aResponse.AppendStreamEvent(Json::ScanResult2JsonString(aScan.mResults[i]));
+    }
+    aResponse.SetStreamSequence(aScan.mResults.size());
+
+    if (!aScan.mRunning)
+    {
+        aResponse.EndStream();
+    }
+
+exit:
+    return;
+}
+
+void Resource::ErrorHandler(Response &aResponse, HttpStatusCode aErrorCode) const
+{
+    std::string errorMessage = GetHttpStatus(aErrorCode);
+    std::string body         = aResponse.IsCbor() ? Cbor::Error2CborString(aErrorCode, errorMessage)
+                                                  : Json::Error2JsonString(aErrorCode, errorMessage);
+
+    aResponse.SetResponsCode(errorMessage);
+    aResponse.SetBody(body);
+    aResponse.SetComplete();
+}
+
+void Resource::GetNodeInfo(Response &aResponse) const
+{
+    otbrError       error = OTBR_ERROR_NONE;
+    struct NodeInfo node;
+    otRouterInfo    routerInfo;
+    uint8_t         maxRouterId;
+    std::string     body;
+    std::string     errorCode;
+
+    VerifyOrExit(otThreadGetLeaderData(mInstance, &node.mLeaderData) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
+
+    node.mNumOfRouter = 0;
+    maxRouterId       = otThreadGetMaxRouterId(mInstance);
+    for (uint8_t i = 0; i <= maxRouterId; ++i)
+    {
+        if (otThreadGetRouterInfo(mInstance, i, &routerInfo) != OT_ERROR_NONE)
+        {
+            continue;
+        }
+        ++node.mNumOfRouter;
+    }
+
+    node.mRole        = otThreadGetDeviceRole(mInstance);
+    node.mExtAddress  = reinterpret_cast<const uint8_t *>(otLinkGetExtendedAddress(mInstance));
+    node.mNetworkName = otThreadGetNetworkName(mInstance);
+    node.mRloc16      = otThreadGetRloc16(mInstance);
+    node.mExtPanId    = reinterpret_cast<const uint8_t *>(otThreadGetExtendedPanId(mInstance));
+    node.mRlocAddress = *otThreadGetRloc(mInstance);
+
+    body = aResponse.IsCbor() ? Cbor::Node2CborString(node) : Json::Node2JsonString(node);
+    aResponse.SetBody(body);
+
+exit:
+    if (error == OTBR_ERROR_NONE)
+    {
+        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+        aResponse.SetResponsCode(errorCode);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError);
+    }
+}
+
+void Resource::NodeInfo(const Request &aRequest, Response &aResponse) const
+{
+    std::string errorCode;
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetNodeInfo(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+
+void Resource::GetDataExtendedAddr(Response &aResponse) const
+{
+    const uint8_t *extAddress = reinterpret_cast<const uint8_t *>(otLinkGetExtendedAddress(mInstance));
+    std::string    errorCode;
+    std::string    body = aResponse.IsCbor() ? Cbor::Bytes2CborString(extAddress, OT_EXT_ADDRESS_SIZE)
+                                             : Json::Bytes2HexJsonString(extAddress, OT_EXT_ADDRESS_SIZE);
+
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+}
+
+void Resource::ExtendedAddr(const Request &aRequest, Response &aResponse) const
+{
+    std::string errorCode;
+
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetDataExtendedAddr(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
+
+void Resource::GetDataState(Response &aResponse) const
+{
+    std::string state;
+    std::string errorCode;
+    uint8_t     role;
+    // 0 : disabled
+    // 1 : detached
+    // 2 : child
+    // 3 : router
+    // 4 : leader
+
+    role  = otThreadGetDeviceRole(mInstance);
+    state = aResponse.IsCbor() ? Cbor::Number2CborString(role) : Json::Number2JsonString(role);
+    aResponse.SetBody(state);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+}
+
+void Resource::State(const Request &aRequest, Response &aResponse) const
+{
+    std::string errorCode;
+
+    if (aRequest.GetMethod() == HttpMethod::kGet)
+    {
+        GetDataState(aResponse);
+    }
+    else
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
+    }
+}
 
 void Resource::GetDataNetworkName(Response &aResponse) const
 {
@@ -311,7 +1034,7 @@ void Resource::GetDataNetworkName(Response &aResponse) const
     std::string errorCode;
 
     networkName = otThreadGetNetworkName(mInstance);
-    networkName = Json::String2JsonString(networkName);
+    networkName = aResponse.IsCbor() ? Cbor::String2CborString(networkName) : Json::String2JsonString(networkName);
 
     aResponse.SetBody(networkName);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
@@ -341,7 +1064,7 @@ void Resource::GetDataLeaderData(Response &aResponse) const
 
     VerifyOrExit(otThreadGetLeaderData(mInstance, &leaderData) == OT_ERROR_NONE, error = OTBR_ERROR_REST);
 
-    body = Json::LeaderData2JsonString(leaderData);
+    body = aResponse.IsCbor() ? Cbor::LeaderData2CborString(leaderData) : Json::LeaderData2JsonString(leaderData);
 
     aResponse.SetBody(body);
 
@@ -388,7 +1111,7 @@ void Resource::GetDataNumOfRoute(Response &aResponse) const
         ++count;
     }
 
-    body = Json::Number2JsonString(count);
+    body = aResponse.IsCbor() ? Cbor::Number2CborString(count) : Json::Number2JsonString(count);
 
     aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
@@ -415,7 +1138,7 @@ void Resource::GetDataRloc16(Response &aResponse) const
     std::string body;
     std::string errorCode;
 
-    body = Json::Number2JsonString(rloc16);
+    body = aResponse.IsCbor() ? Cbor::Number2CborString(rloc16) : Json::Number2JsonString(rloc16);
 
     aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
@@ -439,7 +1162,8 @@ void Resource::Rloc16(const Request &aRequest, Response &aResponse) const
 void Resource::GetDataExtendedPanId(Response &aResponse) const
 {
     const uint8_t *extPanId = reinterpret_cast<const uint8_t *>(otThreadGetExtendedPanId(mInstance));
-    std::string    body     = Json::Bytes2HexJsonString(extPanId, OT_EXT_PAN_ID_SIZE);
+    std::string    body     = aResponse.IsCbor() ? Cbor::Bytes2CborString(extPanId, OT_EXT_PAN_ID_SIZE)
+                                                 : Json::Bytes2HexJsonString(extPanId, OT_EXT_PAN_ID_SIZE);
     std::string    errorCode;
 
     aResponse.SetBody(body);
@@ -467,7 +1191,7 @@ void Resource::GetDataRloc(Response &aResponse) const
     std::string  body;
     std::string  errorCode;
 
-    body = Json::IpAddr2JsonString(rlocAddress);
+    body = aResponse.IsCbor() ? Cbor::IpAddr2CborString(rlocAddress) : Json::IpAddr2JsonString(rlocAddress);
 
     aResponse.SetBody(body);
     errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
@@ -488,94 +1212,943 @@ void Resource::Rloc(const Request &aRequest, Response &aResponse) const
     }
 }
 
-void Resource::DeleteOutDatedDiagnostic(void)
+void Resource::GetDataMainloopStatistics(Response &aResponse) const
 {
-    auto eraseIt = mDiagSet.begin();
-    for (eraseIt = mDiagSet.begin(); eraseIt != mDiagSet.end();)
-    {
-        auto diagInfo = eraseIt->second;
-        auto duration = duration_cast<microseconds>(steady_clock::now() - diagInfo.mStartTime).count();
-
-        if (duration >= kDiagResetTimeout)
-        {
-            eraseIt = mDiagSet.erase(eraseIt);
-        }
-        else
-        {
-            eraseIt++;
-        }
-    }
-}
+    std::string body;
+    std::string errorCode;
 
-void Resource::UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag)
-{
-    DiagInfo value;
+    body = aResponse.IsCbor() ? Cbor::MainloopStats2CborString(MainloopStats::Get())
+                              : Json::MainloopStats2JsonString(MainloopStats::Get());
 
-    value.mStartTime = steady_clock::now();
-    value.mDiagContent.assign(aDiag.begin(), aDiag.end());
-    mDiagSet[aKey] = value;
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
 }
 
-void Resource::Diagnostic(const Request &aRequest, Response &aResponse) const
+void Resource::MainloopStatistics(const Request &aRequest, Response &aResponse) const
 {
-    otbrError error = OTBR_ERROR_NONE;
-    OT_UNUSED_VARIABLE(aRequest);
-    struct otIp6Address rloc16address = *otThreadGetRloc(mInstance);
-    struct otIp6Address multicastAddress;
-
-    VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &rloc16address, kAllTlvTypes, sizeof(kAllTlvTypes)) ==
-                     OT_ERROR_NONE,
-                 error = OTBR_ERROR_REST);
-    VerifyOrExit(otIp6AddressFromString(kMulticastAddrAllRouters, &multicastAddress) == OT_ERROR_NONE,
-                 error = OTBR_ERROR_REST);
-    VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &multicastAddress, kAllTlvTypes, sizeof(kAllTlvTypes)) ==
-                     OT_ERROR_NONE,
-                 error = OTBR_ERROR_REST);
-
-exit:
-
-    if (error == OTBR_ERROR_NONE)
+    if (aRequest.GetMethod() == HttpMethod::kGet)
     {
-        aResponse.SetStartTime(steady_clock::now());
-        aResponse.SetCallback();
+        GetDataMainloopStatistics(aResponse);
     }
     else
     {
-        ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError);
+        ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed);
     }
 }
 
-void Resource::DiagnosticResponseHandler(otError              aError,
-                                         otMessage *          aMessage,
-                                         const otMessageInfo *aMessageInfo,
-                                         void *               aContext)
+void Resource::ExportMetrics(const Request &aRequest, Response &aResponse) const
 {
-    static_cast<Resource *>(aContext)->DiagnosticResponseHandler(aError, aMessage, aMessageInfo);
-}
+    struct MacCounter
+    {
+        const char *             mLabels;
+        uint32_t otMacCounters::*mValue;
+    };
+
+    static const MacCounter kMacCounters[] = {
+        {"counter=\"tx_total\"", &otMacCounters::mTxTotal},
+        {"counter=\"tx_unicast\"", &otMacCounters::mTxUnicast},
+        {"counter=\"tx_broadcast\"", &otMacCounters::mTxBroadcast},
+        {"counter=\"tx_ack_requested\"", &otMacCounters::mTxAckRequested},
+        {"counter=\"tx_acked\"", &otMacCounters::mTxAcked},
+        {"counter=\"tx_no_ack_requested\"", &otMacCounters::mTxNoAckRequested},
+        {"counter=\"tx_data\"", &otMacCounters::mTxData},
+        {"counter=\"tx_data_poll\"", &otMacCounters::mTxDataPoll},
+        {"counter=\"tx_beacon\"", &otMacCounters::mTxBeacon},
+        {"counter=\"tx_beacon_request\"", &otMacCounters::mTxBeaconRequest},
+        {"counter=\"tx_other\"", &otMacCounters::mTxOther},
+        {"counter=\"tx_retry\"", &otMacCounters::mTxRetry},
+        {"counter=\"tx_err_cca\"", &otMacCounters::mTxErrCca},
+        {"counter=\"tx_err_abort\"", &otMacCounters::mTxErrAbort},
+        {"counter=\"tx_err_busy_channel\"", &otMacCounters::mTxErrBusyChannel},
+        {"counter=\"rx_total\"", &otMacCounters::mRxTotal},
+        {"counter=\"rx_unicast\"", &otMacCounters::mRxUnicast},
+        {"counter=\"rx_broadcast\"", &otMacCounters::mRxBroadcast},
+        {"counter=\"rx_data\"", &otMacCounters::mRxData},
+        {"counter=\"rx_data_poll\"", &otMacCounters::mRxDataPoll},
+        {"counter=\"rx_beacon\"", &otMacCounters::mRxBeacon},
+        {"counter=\"rx_beacon_request\"", &otMacCounters::mRxBeaconRequest},
+        {"counter=\"rx_other\"", &otMacCounters::mRxOther},
+        {"counter=\"rx_address_filtered\"", &otMacCounters::mRxAddressFiltered},
+        {"counter=\"rx_dest_addr_filtered\"", &otMacCounters::mRxDestAddrFiltered},
+        {"counter=\"rx_duplicated\"", &otMacCounters::mRxDuplicated},
+        {"counter=\"rx_err_no_frame\"", &otMacCounters::mRxErrNoFrame},
+        {"counter=\"rx_err_unknown_neighbor\"", &otMacCounters::mRxErrUnknownNeighbor},
+        {"counter=\"rx_err_invalid_src_addr\"", &otMacCounters::mRxErrInvalidSrcAddr},
+        {"counter=\"rx_err_sec\"", &otMacCounters::mRxErrSec},
+        {"counter=\"rx_err_fcs\"", &otMacCounters::mRxErrFcs},
+        {"counter=\"rx_err_other\"", &otMacCounters::mRxErrOther},
+    };
+
+    // Large enough for the whole output, so that the body is built without reallocations.
+    static const size_t kMetricsReserveSize = 16 * 1024;
+
+    const otMacCounters *          macCounters = otLinkGetCounters(mInstance);
+    const otIpCounters *           ipCounters  = otThreadGetIp6Counters(mInstance);
+    const Ncp::RcpStats &          rcpStats    = mNcp->GetRcpStats();
+    const Ncp::RcpStats::Counters &rcpCounters = rcpStats.GetCounters();
+    std::string                    body;
+    std::string                    errorCode;
+
+    OTBR_UNUSED_VARIABLE(aRequest);
+
+    body.reserve(kMetricsReserveSize);
+    Metrics::Get().Write(body);
+
+    Metrics::WriteFamily(body, "otbr_thread_mac_frames_total", "counter", "OpenThread MAC counters.");
+
+    for (const MacCounter &counter : kMacCounters)
+    {
+        Metrics::WriteSample(body, "otbr_thread_mac_frames_total", counter.mLabels, macCounters->*counter.mValue);
+    }
 
-void Resource::DiagnosticResponseHandler(otError aError, const otMessage *aMessage, const otMessageInfo *aMessageInfo)
-{
-    std::vector<otNetworkDiagTlv> diagSet;
-    otNetworkDiagTlv              diagTlv;
-    otNetworkDiagIterator         iterator = OT_NETWORK_DIAGNOSTIC_ITERATOR_INIT;
-    otError                       error;
-    char                          rloc[7];
-    std::string                   keyRloc = "0xffee";
+    Metrics::WriteFamily(body, "otbr_thread_ip6_packets_total", "counter", "OpenThread IPv6 counters.");
+    Metrics::WriteSample(body, "otbr_thread_ip6_packets_total", "direction=\"tx\",result=\"success\"",
+                         ipCounters->mTxSuccess);
+    Metrics::WriteSample(body, "otbr_thread_ip6_packets_total", "direction=\"tx\",result=\"failure\"",
+                         ipCounters->mTxFailure);
+    Metrics::WriteSample(body, "otbr_thread_ip6_packets_total", "direction=\"rx\",result=\"success\"",
+                         ipCounters->mRxSuccess);
+    Metrics::WriteSample(body, "otbr_thread_ip6_packets_total", "direction=\"rx\",result=\"failure\"",
+                         ipCounters->mRxFailure);
 
-    SuccessOrExit(aError);
+    Metrics::WriteFamily(body, "otbr_rcp_frames_total", "counter", "802.15.4 frames exchanged with the RCP.");
+    Metrics::WriteSample(body, "otbr_rcp_frames_total", "direction=\"tx\"", rcpCounters.mTxFrames);
+    Metrics::WriteSample(body, "otbr_rcp_frames_total", "direction=\"rx\"", rcpCounters.mRxFrames);
 
-    (void)aMessageInfo;
+    Metrics::WriteFamily(body, "otbr_rcp_tx_retries_total", "counter", "MAC retransmissions done by the RCP.");
+    Metrics::WriteSample(body, "otbr_rcp_tx_retries_total", nullptr, rcpCounters.mTxRetries);
 
-    while ((error = otThreadGetNextDiagnosticTlv(aMessage, &iterator, &diagTlv)) == OT_ERROR_NONE)
+    Metrics::WriteFamily(body, "otbr_rcp_timeouts_total", "counter",
+                         "Spinel property gets the RCP did not answer in time.");
+    Metrics::WriteSample(body, "otbr_rcp_timeouts_total", nullptr, rcpCounters.mTimeouts);
+
+    Metrics::WriteFamily(body, "otbr_rcp_latency_microseconds", "histogram",
+                         "Round-trip time of a spinel property get.");
+    Metrics::WriteHistogram(body, "otbr_rcp_latency_microseconds", nullptr, rcpStats.GetLatency());
+
+    if (rcpStats.HasUartCounters())
+    {
+        Metrics::WriteFamily(body, "otbr_rcp_uart_bytes_total", "counter", "Bytes exchanged with the RCP UART.");
+        Metrics::WriteSample(body, "otbr_rcp_uart_bytes_total", "direction=\"tx\"", rcpCounters.mTxBytes);
+        Metrics::WriteSample(body, "otbr_rcp_uart_bytes_total", "direction=\"rx\"", rcpCounters.mRxBytes);
+
+        Metrics::WriteFamily(body, "otbr_rcp_uart_errors_total", "counter", "Errors of the RCP UART.");
+        Metrics::WriteSample(body, "otbr_rcp_uart_errors_total", "type=\"overrun\"", rcpCounters.mUartOverruns);
+        Metrics::WriteSample(body, "otbr_rcp_uart_errors_total", "type=\"frame\"", rcpCounters.mUartFrameErrors);
+    }
+
+    aResponse.SetMetricsText();
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+}
+
+void Resource::ExportTrace(const Request &aRequest, Response &aResponse) const
+{
+    std::string body;
+    std::string errorCode;
+
+    OTBR_UNUSED_VARIABLE(aRequest);
+
+    // Decoded by `trace-decode`.
+    Trace::Get().Write(body);
+
+    aResponse.SetBinary();
+    aResponse.SetBody(body);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+}
+
+void Resource::NetworkTopology(const Request &aRequest, Response &aResponse) const
+{
+    std::string since   = aRequest.GetQueryValue("since");
+    uint64_t    version = 0;
+    char *      end;
+    std::string body;
+    std::string errorCode;
+
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet,
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed));
+
+    if (!since.empty())
+    {
+        version = strtoull(since.c_str(), &end, 10);
+        VerifyOrExit(*end == '\0', ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest));
+    }
+
+    body      = aResponse.IsCbor() ? Cbor::Topology2CborString(mTopology, version)
+                                   : Json::Topology2JsonString(mTopology, version);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+
+exit:
+    return;
+}
+
+void Resource::DiagNode(const Request &aRequest, Response &aResponse) const
+{
+    std::string                                rloc16 = aRequest.GetPathParam("rloc16");
+    char *                                     end;
+    unsigned long                              value = strtoul(rloc16.c_str(), &end, 0);
+    DiagTlvMask                                tlvMask;
+    const DiagnosticStore::Entry *             entry;
+    std::vector<std::vector<otNetworkDiagTlv>> diagContentSet;
+    std::string                                body;
+    std::string                                errorCode;
+
+    VerifyOrExit(*end == '\0' && value <= UINT16_MAX, ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest));
+    VerifyOrExit(ParseDiagTlvMask(aRequest, tlvMask) == OTBR_ERROR_NONE,
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest));
+    tlvMask |= GetDiagTlvBit(OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS);
+
+    // The node is answered from the diagnostics last received from it, it is not queried.
+    entry = mDiagStore.Find(static_cast<uint16_t>(value));
+    VerifyOrExit(entry != nullptr, ErrorHandler(aResponse, HttpStatusCode::kStatusResourceNotFound));
+    diagContentSet.push_back(entry->mTlvs);
+
+    body      = aResponse.IsCbor() ? Cbor::Diag2CborString(diagContentSet, tlvMask)
+                                   : Json::Diag2JsonString(diagContentSet, tlvMask);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+
+exit:
+    return;
+}
+
+void Resource::DiagHistory(const Request &aRequest, Response &aResponse) const
+{
+    std::string                                    node      = aRequest.GetQueryValue("node");
+    std::string                                    since     = aRequest.GetQueryValue("since");
+    uint64_t                                       timestamp = 0;
+    char *                                         end;
+    size_t                                         offset;
+    size_t                                         limit;
+    std::vector<const DiagnosticHistory::Series *> series;
+    std::string                                    body;
+    std::string                                    errorCode;
+
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet,
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed));
+
+    if (!since.empty())
+    {
+        timestamp = strtoull(since.c_str(), &end, 10);
+        VerifyOrExit(*end == '\0', ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest));
+    }
+
+    VerifyOrExit(ParsePage(aRequest, offset, limit) == OTBR_ERROR_NONE,
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest));
+
+    if (node.empty())
+    {
+        mDiagHistory.GetSeries(series);
+        series.erase(series.begin(), series.begin() + std::min(offset, series.size()));
+        series.resize(std::min(limit, series.size()));
+    }
+    else
+    {
+        const DiagnosticHistory::Series *found;
+
+        // A node is either named by its extended address in hex, or by its current RLOC16.
+        if (node.size() == 2 * OT_EXT_ADDRESS_SIZE)
+        {
+            otExtAddress extAddress;
+
+            for (size_t i = 0; i < OT_EXT_ADDRESS_SIZE; ++i)
+            {
+                std::string byte = node.substr(2 * i, 2);
+
+                extAddress.m8[i] = static_cast<uint8_t>(strtoul(byte.c_str(), &end, 16));
+                VerifyOrExit(*end == '\0' && isxdigit(byte[0]),
+                             ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest));
+            }
+
+            found = mDiagHistory.Find(extAddress);
+        }
+        else
+        {
+            unsigned long rloc16 = strtoul(node.c_str(), &end, 0);
+
+            VerifyOrExit(*end == '\0' && rloc16 <= UINT16_MAX,
+                         ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest));
+            found = mDiagHistory.Find(static_cast<uint16_t>(rloc16));
+        }
+
+        VerifyOrExit(found != nullptr, ErrorHandler(aResponse, HttpStatusCode::kStatusResourceNotFound));
+        series.push_back(found);
+    }
+
+    body      = aResponse.IsCbor() ? Cbor::DiagHistory2CborString(mDiagHistory, series, timestamp)
+                                   : Json::DiagHistory2JsonString(mDiagHistory, series, timestamp);
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+
+exit:
+    return;
+}
+
+void Resource::UpdateDiagExpected(void) const
+{
+    otRouterInfo routerInfo;
+    uint8_t      maxRouterId = otThreadGetMaxRouterId(mInstance);
+
+    // The node itself answers the unicast query, and the routers it has a link with answer the link-local multicast
+    // query. Other nodes may answer as well, but they are not waited for.
+    mDiagExpected.clear();
+    mDiagExpected.insert(otThreadGetRloc16(mInstance));
+
+    for (uint8_t i = 0; i <= maxRouterId; ++i)
     {
-        if (diagTlv.mType == OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS)
+        if (otThreadGetRouterInfo(mInstance, i, &routerInfo) == OT_ERROR_NONE && routerInfo.mLinkEstablished)
         {
-            sprintf(rloc, "0x%04x", diagTlv.mData.mAddr16);
-            keyRloc = Json::CString2JsonString(rloc);
+            mDiagExpected.insert(routerInfo.mRloc16);
         }
+    }
+}
+
+bool Resource::IsDiagnosticComplete(steady_clock::time_point aStartTime) const
+{
+    bool complete = true;
+
+    for (uint16_t rloc16 : mDiagExpected)
+    {
+        const DiagnosticStore::Entry *entry = mDiagStore.Find(rloc16);
+
+        if (entry == nullptr || entry->mUpdateTime < aStartTime)
+        {
+            complete = false;
+            break;
+        }
+    }
+
+    return complete;
+}
+
+bool Resource::IsDiagCollecting(steady_clock::time_point aNow) const
+{
+    auto timeout = mDiagQueryTime + microseconds(kDiagCollectTimeout);
+
+    // A sweep collects until every router answered or was given up, see `ContinueDiagSweep()`.
+    if (mDiagCollecting && !IsDiagSweeping() && aNow >= timeout)
+    {
+        mDiagCollecting   = false;
+        mDiagCompleteTime = timeout;
+        mSnapshotStale &= ~(kSnapshotDiagnostics | kSnapshotTopology);
+    }
+    else if (mDiagCollecting && IsDiagnosticComplete(mDiagQueryTime))
+    {
+        mDiagCollecting   = false;
+        mDiagCompleteTime = aNow;
+        mSnapshotStale &= ~(kSnapshotDiagnostics | kSnapshotTopology);
+    }
+
+    return mDiagCollecting;
+}
+
+bool Resource::IsDiagAnswered(steady_clock::time_point aStartTime, steady_clock::time_point aNow) const
+{
+    bool timedOut;
+
+    if (InstanceParams::Get().GetRestDiagSweepWindow() > 0)
+    {
+        // The routers are queried one by one, wait until each of them answered or was given up.
+        timedOut = !IsDiagSweeping() || aNow - aStartTime >= microseconds(kDiagSweepCollectTimeout);
+    }
+    else
+    {
+        timedOut = aNow - aStartTime >= microseconds(kDiagCollectTimeout);
+    }
+
+    return timedOut || IsDiagnosticComplete(aStartTime);
+}
+
+void Resource::StartDiagSweep(const std::vector<uint8_t> &aTlvTypes, steady_clock::time_point aNow) const
+{
+    otRouterInfo routerInfo;
+    uint8_t      maxRouterId = otThreadGetMaxRouterId(mInstance);
+
+    // Every known router is queried and waited for, not only those the node has a link with.
+    mDiagExpected.clear();
+    mDiagExpected.insert(otThreadGetRloc16(mInstance));
+
+    for (uint8_t i = 0; i <= maxRouterId; ++i)
+    {
+        if (otThreadGetRouterInfo(mInstance, i, &routerInfo) == OT_ERROR_NONE)
+        {
+            mDiagExpected.insert(routerInfo.mRloc16);
+        }
+    }
+
+    // A sweep in progress is restarted. Answers to its queries in flight still count for the new one.
+    mDiagSweepPending.clear();
+    mDiagSweepInFlight.clear();
+    mDiagSweepTlvTypes = aTlvTypes;
+
+    for (uint16_t rloc16 : mDiagExpected)
+    {
+        mDiagSweepPending.push_back({rloc16, 0, aNow});
+    }
+
+    ContinueDiagSweep(aNow);
+}
+
+void Resource::ContinueDiagSweep(steady_clock::time_point aNow) const
+{
+    uint32_t window   = InstanceParams::Get().GetRestDiagSweepWindow();
+    uint32_t retries  = InstanceParams::Get().GetRestDiagSweepRetries();
+    auto     deadline = steady_clock::time_point::max();
+
+    // Query the routers which did not answer in time again, before those not queried yet.
+    for (auto it = mDiagSweepInFlight.begin(); it != mDiagSweepInFlight.end();)
+    {
+        if (it->mDeadline > aNow)
+        {
+            ++it;
+            continue;
+        }
+
+        if (it->mAttempts <= retries)
+        {
+            mDiagSweepPending.push_front(*it);
+        }
+        else
+        {
+            otbrLog(OTBR_LOG_INFO, "gave up diagnostics of 0x%04x after %u queries", it->mRloc16, it->mAttempts);
+        }
+
+        it = mDiagSweepInFlight.erase(it);
+    }
+
+    while (mDiagSweepInFlight.size() < window && !mDiagSweepPending.empty())
+    {
+        DiagSweepNode node    = mDiagSweepPending.front();
+        otIp6Address  address = *otThreadGetRloc(mInstance);
+        otError       error;
+
+        mDiagSweepPending.pop_front();
+
+        address.mFields.m8[14] = static_cast<uint8_t>(node.mRloc16 >> 8);
+        address.mFields.m8[15] = static_cast<uint8_t>(node.mRloc16 & 0xff);
+
+        // A query which failed to be sent is retried like one which was not answered.
+        error = otThreadSendDiagnosticGet(mInstance, &address, mDiagSweepTlvTypes.data(),
+                                          static_cast<uint8_t>(mDiagSweepTlvTypes.size()));
+        if (error != OT_ERROR_NONE)
+        {
+            otbrLog(OTBR_LOG_WARNING, "failed to query diagnostics of 0x%04x: %s", node.mRloc16,
+                    otThreadErrorToString(error));
+        }
+
+        node.mAttempts++;
+        node.mDeadline = aNow + microseconds(kDiagSweepNodeTimeout);
+        mDiagSweepInFlight.push_back(node);
+    }
+
+    for (const DiagSweepNode &node : mDiagSweepInFlight)
+    {
+        deadline = std::min(deadline, node.mDeadline);
+    }
+
+    if (mDiagSweepInFlight.empty())
+    {
+        // Each router answered or was given up, the collection is complete.
+        mDiagSweepTimer.Cancel();
+
+        if (mDiagCollecting)
+        {
+            mDiagCollecting   = false;
+            mDiagCompleteTime = aNow;
+        }
+    }
+    else if (!mDiagSweepTimer.Reschedule(deadline))
+    {
+        mDiagSweepTimer = mNcp->PostTimerTask(deadline, [this]() { HandleDiagSweepTimer(); });
+    }
+}
+
+void Resource::HandleDiagSweepAnswer(uint16_t aRloc16, steady_clock::time_point aNow) const
+{
+    auto isAnswered = [aRloc16](const DiagSweepNode &aNode) { return aNode.mRloc16 == aRloc16; };
+
+    VerifyOrExit(IsDiagSweeping());
+
+    // The router may also answer another query, e.g. of the crawler, before it is queried by the sweep.
+    mDiagSweepInFlight.erase(std::remove_if(mDiagSweepInFlight.begin(), mDiagSweepInFlight.end(), isAnswered),
+                             mDiagSweepInFlight.end());
+    mDiagSweepPending.erase(std::remove_if(mDiagSweepPending.begin(), mDiagSweepPending.end(), isAnswered),
+                            mDiagSweepPending.end());
+
+    ContinueDiagSweep(aNow);
+
+exit:
+    return;
+}
+
+void Resource::HandleDiagSweepTimer(void) const
+{
+    ContinueDiagSweep(steady_clock::now());
+
+    // Connections waiting for the collection are answered once the last router is given up.
+    if (!IsDiagSweeping() && mUpdateHandler)
+    {
+        mUpdateHandler();
+    }
+}
+
+void Resource::GetDiagPage(size_t aOffset, size_t aLimit, std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet) const
+{
+    std::vector<const DiagnosticStore::Entry *> entries;
+
+    // Order the nodes by RLOC16 so consecutive pages do not overlap, only the TLVs of the page are copied.
+    for (const auto &entry : mDiagStore.GetEntries())
+    {
+        entries.push_back(&entry.second);
+    }
+
+    std::sort(entries.begin(), entries.end(),
+              [](const DiagnosticStore::Entry *aLeft, const DiagnosticStore::Entry *aRight) {
+                  return aLeft->mRloc16 < aRight->mRloc16;
+              });
+
+    aDiagSet.clear();
+
+    for (size_t i = aOffset; i < entries.size() && aDiagSet.size() < aLimit; ++i)
+    {
+        aDiagSet.push_back(entries[i]->mTlvs);
+    }
+}
+
+bool Resource::GetDiagSnapshot(DiagTlvMask aTlvMask, size_t aOffset, size_t aLimit, Response &aResponse) const
+{
+    std::vector<std::vector<otNetworkDiagTlv>> diagContentSet;
+    std::string                                body;
+    std::string                                errorCode;
+
+    // The crawler queries every TLV type, so the snapshot answers any request.
+    VerifyOrExit(InstanceParams::Get().GetRestDiagCrawlInterval() > 0 && !mDiagStore.GetEntries().empty());
+
+    GetDiagPage(aOffset, aLimit, diagContentSet);
+
+    if (mLazyEncoding)
+    {
+        aResponse.SetChunked(aResponse.IsCbor() ? Cbor::Diag2CborChunks(diagContentSet, aTlvMask)
+                                                : Json::Diag2JsonChunks(diagContentSet, aTlvMask));
+    }
+    else
+    {
+        body = aResponse.IsCbor() ? Cbor::Diag2CborString(diagContentSet, aTlvMask)
+                                  : Json::Diag2JsonString(diagContentSet, aTlvMask);
+        aResponse.SetBody(body);
+    }
+
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetComplete();
+
+exit:
+    return aResponse.IsComplete();
+}
+
+steady_clock::time_point Resource::Crawl(steady_clock::time_point aNow)
+{
+    auto                 interval    = milliseconds(InstanceParams::Get().GetRestDiagCrawlInterval());
+    uint8_t              maxRouterId = otThreadGetMaxRouterId(mInstance);
+    otIp6Address         address     = *otThreadGetRloc(mInstance);
+    uint16_t             rloc16      = otThreadGetRloc16(mInstance);
+    uint32_t             numRouters  = 0;
+    otRouterInfo         routerInfo;
+    otError              error;
+    std::vector<uint8_t> tlvTypes;
+
+    if (otLinkGetCcaFailureRate(mInstance) > kCrawlCcaFailureRateBusy)
+    {
+        mCrawlInterval = std::min(mCrawlInterval * 2, steady_clock::duration(interval * kCrawlMaxBackoff));
+    }
+    else
+    {
+        mCrawlInterval = std::max(mCrawlInterval / 2, steady_clock::duration(interval));
+    }
+
+    VerifyOrExit(otThreadGetDeviceRole(mInstance) > OT_DEVICE_ROLE_DETACHED);
+
+    // Query the router after the last queried one, or the node itself if it does not know the routers.
+    for (uint16_t i = 1; i <= maxRouterId + 1; ++i)
+    {
+        uint8_t routerId = static_cast<uint8_t>((mCrawlRouterId + i) % (maxRouterId + 1));
+
+        if (otThreadGetRouterInfo(mInstance, routerId, &routerInfo) == OT_ERROR_NONE)
+        {
+            if (numRouters++ == 0)
+            {
+                mCrawlRouterId = routerId;
+                rloc16         = routerInfo.mRloc16;
+            }
+        }
+    }
+
+    address.mFields.m8[14] = static_cast<uint8_t>(rloc16 >> 8);
+    address.mFields.m8[15] = static_cast<uint8_t>(rloc16 & 0xff);
+
+    mDiagSampler.StartRound(rloc16, kAllTlvTypes, sizeof(kAllTlvTypes), tlvTypes);
+    otbrLog(OTBR_LOG_DEBUG, "crawl 0x%04x for %zu of %zu TLVs", rloc16, tlvTypes.size(), sizeof(kAllTlvTypes));
+
+    error = otThreadSendDiagnosticGet(mInstance, &address, tlvTypes.data(), static_cast<uint8_t>(tlvTypes.size()));
+    if (error != OT_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "failed to query diagnostics of 0x%04x: %s", rloc16, otThreadErrorToString(error));
+    }
+
+    // The routers have all been queried once the crawler went past the first round.
+    if (++mCrawlCount > numRouters)
+    {
+        mSnapshotStale &= ~(kSnapshotDiagnostics | kSnapshotTopology);
+    }
+
+    // A round takes an interval per router, keep the nodes which answered in the last rounds.
+    mDiagStore.SetTtl(std::max(GetDiagTtl(), mCrawlInterval * numRouters * kCrawlTtlRounds));
+    mDiagStore.Expire(aNow);
+
+exit:
+    return aNow + mCrawlInterval;
+}
+
+void Resource::GetNeighborTable(std::vector<otNeighborInfo> &aNeighbors) const
+{
+    otNeighborInfoIterator iter = OT_NEIGHBOR_INFO_ITERATOR_INIT;
+    otNeighborInfo         neighbor;
+
+    aNeighbors.clear();
+
+    while (otThreadGetNextNeighborInfo(mInstance, &iter, &neighbor) == OT_ERROR_NONE)
+    {
+        aNeighbors.push_back(neighbor);
+    }
+}
+
+void Resource::Neighbors(const Request &aRequest, Response &aResponse) const
+{
+    std::vector<otNeighborInfo> neighbors;
+    std::string                 since    = aRequest.GetQueryValue("since");
+    uint64_t                    sequence = kNeighborSequenceNone;
+    char *                      end;
+    std::string                 body;
+    std::string                 errorCode;
+
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet,
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed));
+
+    if (aRequest.GetQueryValue("stream") != kStreamEnabled)
+    {
+        GetNeighborTable(neighbors);
+        body = aResponse.IsCbor() ? Cbor::NeighborTable2CborString(mNeighborLog.GetSequence(), neighbors)
+                                  : Json::NeighborTable2JsonString(mNeighborLog.GetSequence(), neighbors);
+        aResponse.SetBody(body);
+        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+        aResponse.SetResponsCode(errorCode);
+        ExitNow();
+    }
+
+    // A reconnecting client resumes after the last event it received.
+    if (since.empty())
+    {
+        since = aRequest.GetHeaderValue("Last-Event-ID").c_str();
+    }
+
+    if (!since.empty())
+    {
+        VerifyOrExit(isdigit(since[0]), ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest));
+        sequence = strtoull(since.c_str(), &end, 10);
+        VerifyOrExit(*end == '\0', ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest));
+    }
+
+    // The later changes are sent by the callback handler.
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetStartTime(steady_clock::now());
+    aResponse.SetCallback();
+    aResponse.SetStream();
+    aResponse.SetStreamSequence(sequence);
+    AppendNeighborChanges(aResponse);
+
+exit:
+    return;
+}
+
+void Resource::Churn(const Request &aRequest, Response &aResponse) const
+{
+    std::string                       since     = aRequest.GetQueryValue("since");
+    std::string                       until     = aRequest.GetQueryValue("until");
+    uint64_t                          sinceTime = 0;
+    uint64_t                          untilTime = UINT64_MAX;
+    char *                            end;
+    std::vector<Ncp::ChurnLog::Event> events;
+    std::string                       body;
+    std::string                       errorCode;
+
+    VerifyOrExit(aRequest.GetMethod() == HttpMethod::kGet,
+                 ErrorHandler(aResponse, HttpStatusCode::kStatusMethodNotAllowed));
+
+    if (!since.empty())
+    {
+        sinceTime = strtoull(since.c_str(), &end, 10);
+        VerifyOrExit(*end == '\0', ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest));
+    }
+
+    if (!until.empty())
+    {
+        untilTime = strtoull(until.c_str(), &end, 10);
+        VerifyOrExit(*end == '\0', ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest));
+    }
+
+    mNcp->GetChurnLog().GetEvents(sinceTime, untilTime, events);
+
+    body      = aResponse.IsCbor() ? Cbor::ChurnEvents2CborString(events, mNcp->GetChurnLog().GetDroppedCount())
+                                   : Json::ChurnEvents2JsonString(events, mNcp->GetChurnLog().GetDroppedCount());
+    errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+    aResponse.SetResponsCode(errorCode);
+    aResponse.SetBody(body);
+
+exit:
+    return;
+}
+
+void Resource::ActiveScan(const Request &aRequest, Response &aResponse) const
+{
+    otError error = OT_ERROR_NONE;
+
+    if (!mActiveScan.mRunning)
+    {
+        error = mNcp->GetThreadHelper()->StreamScan(
+            [this](const otActiveScanResult *aResult) { HandleScanResult(mActiveScan, aResult); });
+        SuccessOrExit(error);
+        mActiveScan.Start();
+    }
+
+exit:
+    StartScanResponse(aRequest, error, mActiveScan, aResponse);
+}
+
+void Resource::EnergyScan(const Request &aRequest, Response &aResponse) const
+{
+    otError error = OT_ERROR_NONE;
+
+    if (!mEnergyScan.mRunning)
+    {
+        // All supported channels, each for the default duration.
+        error = mNcp->GetThreadHelper()->StreamEnergyScan(
+            /* aScanChannels */ 0, /* aScanDuration */ 0,
+            [this](const otEnergyScanResult *aResult) { HandleScanResult(mEnergyScan, aResult); });
+        SuccessOrExit(error);
+        mEnergyScan.Start();
+    }
+
+exit:
+    StartScanResponse(aRequest, error, mEnergyScan, aResponse);
+}
+
+template <typename ResultType>
+void Resource::HandleScanResult(ScanState<ResultType> &aScan, const ResultType *aResult) const
+{
+    if (aResult != nullptr)
+    {
+        aScan.mResults.push_back(*aResult);
+    }
+    else
+    {
+        aScan.mRunning = false;
+    }
+
+    // The waiting connections are processed right away, so they all see the scan finish before another starts.
+    if (mUpdateHandler)
+    {
+        mUpdateHandler();
+    }
+}
+
+template <typename ResultType>
+void Resource::StartScanResponse(const Request &              aRequest,
+                                 otError                      aError,
+                                 const ScanState<ResultType> &aScan,
+                                 Response &                   aResponse) const
+{
+    std::string errorCode;
+
+    // Another scan is in progress, started through another interface.
+    VerifyOrExit(aError != OT_ERROR_BUSY, ErrorHandler(aResponse, HttpStatusCode::kStatusServiceUnavailable));
+    VerifyOrExit(aError == OT_ERROR_NONE, ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError));
+
+    // Requests arriving during a scan join it, the results are sent by the callback handler.
+    aResponse.SetStartTime(steady_clock::now());
+    aResponse.SetStreamTime(aScan.mStartTime);
+    aResponse.SetCallback();
+
+    if (aRequest.GetQueryValue("stream") == kStreamEnabled)
+    {
+        errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+        aResponse.SetResponsCode(errorCode);
+        aResponse.SetStream();
+        aResponse.SetStreamSequence(0);
+        AppendScanResults(aScan, aResponse);
+    }
+
+exit:
+    return;
+}
+
+void Resource::Diagnostic(const Request &aRequest, Response &aResponse) const
+{
+    otbrError            error         = OTBR_ERROR_NONE;
+    struct otIp6Address  rloc16address = *otThreadGetRloc(mInstance);
+    struct otIp6Address  multicastAddress;
+    auto                 now       = steady_clock::now();
+    auto                 freshness = milliseconds(InstanceParams::Get().GetRestDiagFreshness());
+    DiagTlvMask          tlvMask;
+    size_t               offset;
+    size_t               limit;
+    bool                 collecting;
+    std::vector<uint8_t> tlvTypes;
+
+    SuccessOrExit(error = ParseDiagTlvMask(aRequest, tlvMask));
+    SuccessOrExit(error = ParsePage(aRequest, offset, limit));
+
+    // The answers are matched to nodes by their RLOC16.
+    tlvMask |= GetDiagTlvBit(OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS);
+
+    if (aRequest.GetQueryValue("stream") != kStreamEnabled && GetDiagSnapshot(tlvMask, offset, limit, aResponse))
+    {
+        ExitNow();
+    }
+
+    collecting = IsDiagCollecting(now);
+
+    // Attach to the collection in progress, or answer with the last one while it is fresh, instead of querying the
+    // mesh again, unless it lacks some of the requested TLVs.
+    VerifyOrExit((tlvMask & ~mDiagTlvMask) != 0 || (!collecting && now - mDiagCompleteTime >= freshness));
+
+    if (collecting)
+    {
+        // The new query also answers the requests attached to the collection in progress.
+        tlvMask |= mDiagTlvMask;
+    }
+
+    for (uint8_t type : kAllTlvTypes)
+    {
+        if (tlvMask & GetDiagTlvBit(type))
+        {
+            tlvTypes.push_back(type);
+        }
+    }
+
+    if (InstanceParams::Get().GetRestDiagSweepWindow() > 0)
+    {
+        // Multicast answers of many routers collide, query them one by one instead.
+        StartDiagSweep(tlvTypes, now);
+    }
+    else
+    {
+        VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &rloc16address, tlvTypes.data(),
+                                               static_cast<uint8_t>(tlvTypes.size())) == OT_ERROR_NONE,
+                     error = OTBR_ERROR_REST);
+        VerifyOrExit(otIp6AddressFromString(kMulticastAddrAllRouters, &multicastAddress) == OT_ERROR_NONE,
+                     error = OTBR_ERROR_REST);
+        VerifyOrExit(otThreadSendDiagnosticGet(mInstance, &multicastAddress, tlvTypes.data(),
+                                               static_cast<uint8_t>(tlvTypes.size())) == OT_ERROR_NONE,
+                     error = OTBR_ERROR_REST);
+
+        UpdateDiagExpected();
+    }
+
+    mDiagQueryTime  = now;
+    mDiagCollecting = true;
+    mDiagTlvMask    = tlvMask;
+
+exit:
+
+    if (error == OTBR_ERROR_INVALID_ARGS)
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusBadRequest);
+    }
+    else if (error != OTBR_ERROR_NONE)
+    {
+        ErrorHandler(aResponse, HttpStatusCode::kStatusInternalServerError);
+    }
+    else if (!aResponse.IsComplete())
+    {
+        aResponse.SetStartTime(mDiagQueryTime);
+        aResponse.SetCallback();
+
+        if (aRequest.GetQueryValue("stream") == kStreamEnabled)
+        {
+            // Only diagnostics answering the collection are streamed.
+            std::string errorCode = GetHttpStatus(HttpStatusCode::kStatusOk);
+
+            aResponse.SetResponsCode(errorCode);
+            aResponse.SetStream();
+            aResponse.SetStreamTime(aResponse.GetStartTime());
+        }
+    }
+}
+
+void Resource::DiagnosticResponseHandler(otError              aError,
+                                         otMessage *          aMessage,
+                                         const otMessageInfo *aMessageInfo,
+                                         void *               aContext)
+{
+    static_cast<Resource *>(aContext)->DiagnosticResponseHandler(aError, aMessage, aMessageInfo);
+}
+
+void Resource::DiagnosticResponseHandler(otError aError, const otMessage *aMessage, const otMessageInfo *aMessageInfo)
+{
+    std::vector<otNetworkDiagTlv> diagSet;
+    otNetworkDiagTlv              diagTlv;
+    otNetworkDiagIterator         iterator = OT_NETWORK_DIAGNOSTIC_ITERATOR_INIT;
+    otError                       error;
+    auto                          now      = steady_clock::now();
+    const DiagnosticStore::Entry *entry;
+    std::vector<uint8_t>          changedTypes;
+
+    SuccessOrExit(aError);
+
+    (void)aMessageInfo;
+
+    // Clear the TLV before reading each one, so that the store compares the TLVs of successive responses correctly.
+    memset(&diagTlv, 0, sizeof(diagTlv));
+    while ((error = otThreadGetNextDiagnosticTlv(aMessage, &iterator, &diagTlv)) == OT_ERROR_NONE)
+    {
         diagSet.push_back(diagTlv);
+        memset(&diagTlv, 0, sizeof(diagTlv));
+    }
+
+    mDiagStore.Expire(now);
+    entry = mDiagStore.Update(diagSet.data(), diagSet.size(), now, &changedTypes);
+
+    if (entry != nullptr)
+    {
+        mTopology.Update(entry->mRloc16, diagSet);
+        mDiagSampler.Record(entry->mRloc16, diagSet.data(), diagSet.size(), changedTypes);
+
+        if (entry->mHasExtAddress)
+        {
+            uint64_t timestamp = static_cast<uint64_t>(
+                duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count());
+
+            mDiagHistory.Record(entry->mExtAddress, entry->mRloc16, diagSet.data(), diagSet.size(), timestamp);
+        }
+
+        HandleDiagSweepAnswer(entry->mRloc16, now);
+    }
+
+    // Note the time the last expected node answered, which the freshness window starts with.
+    IsDiagCollecting(now);
+
+    if (mUpdateHandler)
+    {
+        mUpdateHandler();
     }
-    UpdateDiag(keyRloc, diagSet);
 
 exit:
     if (aError != OT_ERROR_NONE)
@@ -34,15 +34,24 @@
 #ifndef OTBR_REST_RESOURCE_HPP_
 #define OTBR_REST_RESOURCE_HPP_
 
+#include <deque>
+#include <functional>
+#include <set>
 #include <unordered_map>
 
 #include <openthread/border_router.h>
 
 #include "agent/ncp_openthread.hpp"
 #include "agent/thread_helper.hpp"
+#include "rest/diagnostic_history.hpp"
+#include "rest/diagnostic_sampler.hpp"
+#include "rest/diagnostic_store.hpp"
 #include "rest/json.hpp"
+#include "rest/neighbor_log.hpp"
 #include "rest/request.hpp"
 #include "rest/response.hpp"
+#include "rest/response_snapshot.hpp"
+#include "rest/router.hpp"
 
 using otbr::Ncp::ControllerOpenThread;
 using std::chrono::steady_clock;
@@ -91,6 +100,49 @@ public:
      */
     void HandleCallback(Request &aRequest, Response &aResponse);
 
+    /**
+     * This method sets the handler called when the data connections wait for is updated, e.g. a diagnostic response
+     * is received or the neighbor table changed, so they could be processed without waiting for their next check.
+     *
+     * @param[in]   aHandler  The handler.
+     *
+     */
+    void SetUpdateHandler(std::function<void(void)> aHandler) { mUpdateHandler = std::move(aHandler); }
+
+    /**
+     * This method sets whether diagnostics are always encoded as the response is written.
+     *
+     * The handlers then only copy the diagnostics, which moves their encoding to the thread writing the response.
+     *
+     * @param[in]   aLazy   Whether diagnostics are always encoded as the response is written.
+     *
+     */
+    void SetLazyEncoding(bool aLazy) { mLazyEncoding = aLazy; }
+
+    /**
+     * This method queries the diagnostics of the next router in the background, to keep a snapshot of the mesh.
+     *
+     * The routers are queried round-robin, one per crawl interval. The interval is doubled while the CCA failure
+     * rate shows the channel is busy, and brought back to the configured one once the channel is clear again.
+     * A router is only queried for the TLVs due in this round, TLVs which did not change are queried less often,
+     * see `DiagnosticSampler`.
+     *
+     * @param[in]   aNow    The current time.
+     *
+     * @returns The time to crawl next.
+     *
+     */
+    steady_clock::time_point Crawl(steady_clock::time_point aNow);
+
+    /**
+     * This method saves the node, diagnostics and topology resources, to serve them right after a restart.
+     *
+     * After a restart, the saved resources are answered with their age and a stale warning until the live data
+     * converged: the node is attached, a diagnostic collection completed or the crawler queried every router.
+     *
+     */
+    void SaveSnapshot(void);
+
     /**
      * This method provides a quick handler, which could directly set response code of a response and set error code and
      * error message to the request body.
@@ -114,7 +166,20 @@ private:
     void ExtendedPanId(const Request &aRequest, Response &aResponse) const;
     void Rloc(const Request &aRequest, Response &aResponse) const;
     void Diagnostic(const Request &aRequest, Response &aResponse) const;
+    void MainloopStatistics(const Request &aRequest, Response &aResponse) const;
+    void NetworkTopology(const Request &aRequest, Response &aResponse) const;
+    void DiagHistory(const Request &aRequest, Response &aResponse) const;
+    void DiagNode(const Request &aRequest, Response &aResponse) const;
+    void ExportMetrics(const Request &aRequest, Response &aResponse) const;
+    void ExportTrace(const Request &aRequest, Response &aResponse) const;
+    void Neighbors(const Request &aRequest, Response &aResponse) const;
+    void Churn(const Request &aRequest, Response &aResponse) const;
+    void ActiveScan(const Request &aRequest, Response &aResponse) const;
+    void EnergyScan(const Request &aRequest, Response &aResponse) const;
     void HandleDiagnosticCallback(const Request &aRequest, Response &aResponse);
+    void HandleNeighborsCallback(const Request &aRequest, Response &aResponse);
+    void HandleActiveScanCallback(const Request &aRequest, Response &aResponse);
+    void HandleEnergyScanCallback(const Request &aRequest, Response &aResponse);
 
     void GetNodeInfo(Response &aResponse) const;
     void GetDataExtendedAddr(Response &aResponse) const;
@@ -125,9 +190,60 @@ private:
     void GetDataRloc16(Response &aResponse) const;
     void GetDataExtendedPanId(Response &aResponse) const;
     void GetDataRloc(Response &aResponse) const;
+    void GetDataMainloopStatistics(Response &aResponse) const;
+    void GetNeighborTable(std::vector<otNeighborInfo> &aNeighbors) const;
+    void AppendNeighborChanges(Response &aResponse) const;
+
+    // The scan shared by the requests of a scan resource
+    template <typename ResultType> struct ScanState
+    {
+        ScanState(void)
+            : mRunning(false)
+        {
+        }
+
+        void Start(void)
+        {
+            mResults.clear();
+            mStartTime = steady_clock::now();
+            mRunning   = true;
+        }
 
-    void DeleteOutDatedDiagnostic(void);
-    void UpdateDiag(std::string aKey, std::vector<otNetworkDiagTlv> &aDiag);
+        std::vector<ResultType>  mResults;
+        steady_clock::time_point mStartTime;
+        bool                     mRunning;
+    };
+
+    template <typename ResultType>
+    void HandleScanResult(ScanState<ResultType> &aScan, const ResultType *aResult) const;
+    template <typename ResultType>
+    void StartScanResponse(const Request &              aRequest,
+                           otError                      aError,
+                           const ScanState<ResultType> &aScan,
+                           Response &                   aResponse) const;
+    template <typename ResultType>
+    void HandleScanCallback(const ScanState<ResultType> &aScan, Response &aResponse) const;
+    template <typename ResultType>
+    void AppendScanResults(const ScanState<ResultType> &aScan, Response &aResponse) const;
+
+    void LoadSnapshot(void);
+    bool GetSnapshotResponse(const Request &aRequest, Response &aResponse) const;
+    bool GetCachedResponse(const std::string &aUrl, Response &aResponse) const;
+    void CacheResponse(const std::string &aUrl, Response &aResponse) const;
+    void InvalidateCache(otChangedFlags aFlags);
+    void HandleNeighborTableEvent(otNeighborTableEvent aEvent, const otNeighborTableEntryInfo &aEntryInfo);
+
+    void UpdateDiagExpected(void) const;
+    bool IsDiagnosticComplete(steady_clock::time_point aStartTime) const;
+    bool IsDiagCollecting(steady_clock::time_point aNow) const;
+    bool IsDiagAnswered(steady_clock::time_point aStartTime, steady_clock::time_point aNow) const;
+    void StartDiagSweep(const std::vector<uint8_t> &aTlvTypes, steady_clock::time_point aNow) const;
+    void ContinueDiagSweep(steady_clock::time_point aNow) const;
+    void HandleDiagSweepAnswer(uint16_t aRloc16, steady_clock::time_point aNow) const;
+    void HandleDiagSweepTimer(void) const;
+    bool IsDiagSweeping(void) const { return !mDiagSweepPending.empty() || !mDiagSweepInFlight.empty(); }
+    void GetDiagPage(size_t aOffset, size_t aLimit, std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet) const;
+    bool GetDiagSnapshot(DiagTlvMask aTlvMask, size_t aOffset, size_t aLimit, Response &aResponse) const;
 
     static void DiagnosticResponseHandler(otError              aError,
                                           otMessage *          aMessage,
@@ -138,10 +254,70 @@ private:
     otInstance *          mInstance;
     ControllerOpenThread *mNcp;
 
-    std::unordered_map<std::string, ResourceHandler>         mResourceMap;
-    std::unordered_map<std::string, ResourceCallbackHandler> mResourceCallbackMap;
+    Router<ResourceHandler>         mRouter;
+    Router<ResourceCallbackHandler> mCallbackRouter;
+
+    DiagnosticStore           mDiagStore;
+    Topology                  mTopology;
+    DiagnosticHistory         mDiagHistory;
+    std::function<void(void)> mUpdateHandler;
+    bool                      mLazyEncoding;
+
+    // RLOC16s of the nodes expected to answer the last diagnostic query
+    mutable std::set<uint16_t> mDiagExpected;
+
+    // The diagnostic collection shared by concurrent requests
+    mutable bool                     mDiagCollecting;
+    mutable steady_clock::time_point mDiagQueryTime;
+    mutable steady_clock::time_point mDiagCompleteTime;
+    mutable DiagTlvMask              mDiagTlvMask;
+
+    // The unicast query of each router, see `StartDiagSweep()`
+    struct DiagSweepNode
+    {
+        uint16_t                 mRloc16;
+        uint32_t                 mAttempts;
+        steady_clock::time_point mDeadline;
+    };
+
+    mutable std::deque<DiagSweepNode>  mDiagSweepPending;
+    mutable std::vector<DiagSweepNode> mDiagSweepInFlight;
+    mutable std::vector<uint8_t>       mDiagSweepTlvTypes;
+    mutable TimerWheel::Handle         mDiagSweepTimer;
+
+    // The background crawler, see `Crawl()`
+    uint8_t                mCrawlRouterId;
+    steady_clock::duration mCrawlInterval;
+    uint32_t               mCrawlCount;
+    DiagnosticSampler      mDiagSampler;
+
+    // The responses saved before the restart, served until the live data converged, see `SaveSnapshot()`
+    ResponseSnapshot         mSnapshot;
+    mutable uint8_t          mSnapshotStale;
+    steady_clock::time_point mSnapshotDeadline;
+
+    struct CachedBody
+    {
+        std::string mBody;
+        std::string mETag;
+    };
+
+    // A resource is cached separately in each representation.
+    struct CachedResponse
+    {
+        CachedBody mJson;
+        CachedBody mCbor;
+    };
+
+    // Serialized GET responses, until an OpenThread state change they depend on
+    mutable std::unordered_map<std::string, CachedResponse> mResponseCache;
+
+    // The recent changes of the neighbor table, for the streams following it
+    NeighborLog mNeighborLog;
 
-    std::unordered_map<std::string, DiagInfo> mDiagSet;
+    // The last active and energy scans
+    mutable ScanState<otActiveScanResult> mActiveScan;
+    mutable ScanState<otEnergyScanResult> mEnergyScan;
 };
 
 } // namespace rest
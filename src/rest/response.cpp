@@ -28,14 +28,29 @@
 
 #include "rest/response.hpp"
 
+#include <utility>
+
+#include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
+
+#if OTBR_ENABLE_REST_COMPRESSION
+#include <zlib.h>
+#endif
+
+#include "common/code_utils.hpp"
 
 #define OT_REST_RESPONSE_CONTENT_TYPE_JSON "application/json"
+#define OT_REST_RESPONSE_CONTENT_TYPE_CBOR "application/cbor"
+#define OT_REST_RESPONSE_CONTENT_TYPE_EVENT_STREAM "text/event-stream"
+#define OT_REST_RESPONSE_CONTENT_TYPE_METRICS "text/plain; version=0.0.4; charset=utf-8"
+#define OT_REST_RESPONSE_CONTENT_TYPE_BINARY "application/octet-stream"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_ORIGIN "*"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_HEADERS                                                              \
     "Access-Control-Allow-Headers, Origin,Accept, X-Requested-With, Content-Type, Access-Control-Request-Method, " \
     "Access-Control-Request-Headers"
 #define OT_REST_RESPONSE_ACCESS_CONTROL_ALLOW_METHOD "GET"
+#define OT_REST_RESPONSE_STATUS_NOT_MODIFIED "304 Not Modified"
 
 namespace otbr {
 namespace rest {
@@ -43,6 +58,17 @@ namespace rest {
 Response::Response(void)
     : mCallback(false)
     , mComplete(false)
+    , mKeepAlive(false)
+    , mNotModified(false)
+    , mStream(false)
+    , mCbor(false)
+    , mMetricsText(false)
+    , mBinary(false)
+    , mGzip(false)
+    , mChunked(false)
+    , mStale(false)
+    , mAge(0)
+    , mStreamSequence(0)
 {
     // HTTP protocol
     mProtocol = "HTTP/1.1 ";
@@ -86,6 +112,11 @@ void Response::SetResponsCode(std::string &aCode)
     mCode = aCode;
 }
 
+const std::string &Response::GetResponseCode(void) const
+{
+    return mCode;
+}
+
 void Response::SetCallback(void)
 {
     mCallback = true;
@@ -96,7 +127,7 @@ void Response::SetBody(std::string &aBody)
     mBody = aBody;
 }
 
-std::string Response::GetBody(void) const
+const std::string &Response::GetBody(void) const
 {
     return mBody;
 }
@@ -106,7 +137,280 @@ bool Response::NeedCallback(void)
     return mCallback;
 }
 
-std::string Response::Serialize(void) const
+void Response::SetKeepAlive(bool aKeepAlive)
+{
+    mKeepAlive = aKeepAlive;
+}
+
+bool Response::IsKeepAlive(void) const
+{
+    return mKeepAlive;
+}
+
+void Response::SetCbor(bool aCbor)
+{
+    mCbor = aCbor;
+
+    if (!mStream)
+    {
+        SetContentType(mCbor ? OT_REST_RESPONSE_CONTENT_TYPE_CBOR : OT_REST_RESPONSE_CONTENT_TYPE_JSON);
+    }
+}
+
+bool Response::IsCbor(void) const
+{
+    return mCbor;
+}
+
+void Response::SetMetricsText(void)
+{
+    // The exposition format has no CBOR variant, whatever the client accepts.
+    mCbor        = false;
+    mMetricsText = true;
+    SetContentType(OT_REST_RESPONSE_CONTENT_TYPE_METRICS);
+}
+
+void Response::SetBinary(void)
+{
+    mCbor   = false;
+    mBinary = true;
+    SetContentType(OT_REST_RESPONSE_CONTENT_TYPE_BINARY);
+}
+
+bool Response::Compress(void)
+{
+#if OTBR_ENABLE_REST_COMPRESSION
+    // The sliding window and hash chains of deflate take about 256 KiB, independent of the body size.
+    static const int    kWindowBits = 15 + 16; // 16 selects the gzip wrapper.
+    static const int    kMemLevel   = 8;
+    static const size_t kChunkSize  = 4096;
+
+    z_stream    stream;
+    std::string compressed;
+    char        chunk[kChunkSize];
+    int         ret;
+
+    VerifyOrExit(!mGzip && !mStream && !mNotModified && mBody.size() >= kCompressThreshold);
+
+    memset(&stream, 0, sizeof(stream));
+    VerifyOrExit(deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, kWindowBits, kMemLevel,
+                              Z_DEFAULT_STRATEGY) == Z_OK);
+
+    stream.next_in  = reinterpret_cast<Bytef *>(&mBody[0]);
+    stream.avail_in = static_cast<uInt>(mBody.size());
+
+    // Deflate into a fixed chunk and only keep the compressed output, which is all held at once.
+    do
+    {
+        stream.next_out  = reinterpret_cast<Bytef *>(chunk);
+        stream.avail_out = sizeof(chunk);
+        ret              = deflate(&stream, Z_FINISH);
+        compressed.append(chunk, sizeof(chunk) - stream.avail_out);
+    } while (ret == Z_OK);
+
+    deflateEnd(&stream);
+    VerifyOrExit(ret == Z_STREAM_END && compressed.size() < mBody.size());
+
+    mBody.swap(compressed);
+    mGzip = true;
+
+    if (!mETag.empty() && mETag.compare(0, 2, "W/") != 0)
+    {
+        mETag.insert(0, "W/");
+    }
+
+exit:
+    return mGzip;
+#else
+    return false;
+#endif
+}
+
+void Response::SetETag(const std::string &aETag)
+{
+    mETag = aETag;
+}
+
+void Response::UpdateETag(void)
+{
+    // 64-bit FNV-1a, identical bodies always get the same strong entity tag.
+    uint64_t hash = 0xcbf29ce484222325ull;
+    char     etag[sizeof("\"0123456789abcdef\"")];
+
+    VerifyOrExit(mETag.empty());
+
+    for (unsigned char c : mBody)
+    {
+        hash = (hash ^ c) * 0x100000001b3ull;
+    }
+
+    snprintf(etag, sizeof(etag), "\"%016" PRIx64 "\"", hash);
+    mETag = etag;
+
+exit:
+    return;
+}
+
+const std::string &Response::GetETag(void) const
+{
+    return mETag;
+}
+
+void Response::SetStale(uint64_t aAge)
+{
+    mStale = true;
+    mAge   = aAge;
+}
+
+void Response::SetNotModified(void)
+{
+    mNotModified = true;
+    mCode        = OT_REST_RESPONSE_STATUS_NOT_MODIFIED;
+    mBody.clear();
+}
+
+void Response::SetStream(void)
+{
+    mStream = true;
+    SetContentType(OT_REST_RESPONSE_CONTENT_TYPE_EVENT_STREAM);
+}
+
+bool Response::IsStream(void) const
+{
+    return mStream;
+}
+
+void Response::AppendStreamEvent(const std::string &aData)
+{
+    AppendEvent(std::string(), aData);
+}
+
+void Response::AppendStreamEvent(const std::string &aData, uint64_t aId)
+{
+    AppendEvent("id: " + std::to_string(aId) + "\n", aData);
+}
+
+void Response::AppendEvent(const std::string &aFields, const std::string &aData)
+{
+    std::string event = aFields + "data: ";
+    char        chunkSize[sizeof("ffffffffffffffff\r\n")];
+
+    // Every line of the data is sent in its own data field, the client joins them with line feeds.
+    for (char c : aData)
+    {
+        event += c;
+
+        if (c == '\n')
+        {
+            event += "data: ";
+        }
+    }
+    event += "\n\n";
+
+    snprintf(chunkSize, sizeof(chunkSize), "%zx\r\n", event.size());
+    mBody += chunkSize + event + "\r\n";
+}
+
+void Response::SetChunked(ChunkProducer aProducer)
+{
+    mChunked       = true;
+    mChunkProducer = std::move(aProducer);
+}
+
+bool Response::IsChunked(void) const
+{
+    return mChunked;
+}
+
+bool Response::HasMoreChunks(void) const
+{
+    return mChunkProducer != nullptr;
+}
+
+void Response::NextChunk(void)
+{
+    char chunkSize[sizeof("ffffffffffffffff\r\n")];
+    bool last;
+
+    // An empty chunk would end the body, ask for more until there is data or the producer is done.
+    do
+    {
+        mChunk.clear();
+        last = mChunkProducer(mChunk);
+    } while (mChunk.empty() && !last);
+
+    mBody.clear();
+
+    if (!mChunk.empty())
+    {
+        snprintf(chunkSize, sizeof(chunkSize), "%zx\r\n", mChunk.size());
+        mBody += chunkSize;
+        mBody += mChunk;
+        mBody += "\r\n";
+    }
+
+    if (last)
+    {
+        // The last chunk of chunked transfer coding.
+        mBody += "0\r\n\r\n";
+        mChunkProducer = nullptr;
+    }
+}
+
+void Response::EndStream(void)
+{
+    // The last chunk of chunked transfer coding.
+    mBody += "0\r\n\r\n";
+    mComplete = true;
+}
+
+void Response::SetStreamTime(steady_clock::time_point aStreamTime)
+{
+    mStreamTime = aStreamTime;
+}
+
+steady_clock::time_point Response::GetStreamTime(void) const
+{
+    return mStreamTime;
+}
+
+void Response::SetContentType(const char *aContentType)
+{
+    for (size_t index = 0; index < mHeaderField.size(); index++)
+    {
+        if (mHeaderField[index] == "Content-Type")
+        {
+            mHeaderValue[index] = aContentType;
+        }
+    }
+}
+
+void Response::Reset(void)
+{
+    if (mStream || mCbor || mMetricsText || mBinary)
+    {
+        SetContentType(OT_REST_RESPONSE_CONTENT_TYPE_JSON);
+    }
+
+    mCallback    = false;
+    mComplete    = false;
+    mKeepAlive   = false;
+    mNotModified = false;
+    mStream      = false;
+    mCbor        = false;
+    mMetricsText = false;
+    mBinary      = false;
+    mGzip        = false;
+    mChunked     = false;
+    mStale       = false;
+    mCode.clear();
+    mBody.clear();
+    mETag.clear();
+    mChunkProducer  = nullptr;
+    mStreamSequence = 0;
+}
+
+std::string Response::SerializeHeader(void) const
 {
     size_t      index;
     std::string spacer = "\r\n";
@@ -116,8 +420,45 @@ std::string Response::Serialize(void) const
     {
         ret += (spacer + mHeaderField[index] + ": " + mHeaderValue[index]);
     }
-    ret += spacer + "Content-Length: " + std::to_string(mBody.size());
-    ret += (spacer + spacer + mBody);
+    ret += spacer + "Connection: " + (mKeepAlive ? "keep-alive" : "close");
+
+    // The body depends on these header fields, caches must not return it for other values.
+    ret += spacer + "Vary: Accept, Accept-Encoding";
+
+    if (mGzip)
+    {
+        ret += spacer + "Content-Encoding: gzip";
+    }
+
+    if (!mETag.empty())
+    {
+        ret += spacer + "ETag: " + mETag;
+    }
+
+    if (mStale)
+    {
+        // RFC 7234, 5.5.1: the response is stale, it is served while the current one is not available.
+        ret += spacer + "Age: " + std::to_string(mAge);
+        ret += spacer + "Warning: 110 - \"Response is Stale\"";
+    }
+
+    if (mStream)
+    {
+        // Events are sent as they come, so the length of the body is unknown.
+        ret += spacer + "Cache-Control: no-cache";
+        ret += spacer + "Transfer-Encoding: chunked";
+    }
+    else if (mChunked)
+    {
+        ret += spacer + "Transfer-Encoding: chunked";
+    }
+    // A 304 response has no body, and its Content-Length would describe the representation it refers to.
+    else if (!mNotModified)
+    {
+        ret += spacer + "Content-Length: " + std::to_string(mBody.size());
+    }
+
+    ret += (spacer + spacer);
 
     return ret;
 }
@@ -56,6 +56,8 @@ namespace rest {
 class Response
 {
 public:
+    static const size_t kCompressThreshold = 1400; ///< The minimum body size which gets compressed, in bytes.
+
     /**
      * The constructor to initialize a response instance.
      *
@@ -76,7 +78,7 @@ public:
      *
      * @returns A string containing the body field.
      */
-    std::string GetBody(void) const;
+    const std::string &GetBody(void) const;
 
     /**
      * This method set the response code.
@@ -86,6 +88,13 @@ public:
      */
     void SetResponsCode(std::string &aCode);
 
+    /**
+     * This method returns the response code.
+     *
+     * @returns A string representing response code such as "404 not found".
+     */
+    const std::string &GetResponseCode(void) const;
+
     /**
      * This method labels the response as need callback.
      *
@@ -129,13 +138,211 @@ public:
     steady_clock::time_point GetStartTime() const;
 
     /**
-     * This method serialize a response to a string that could be sent by socket later.
+     * This method sets whether the connection is kept open after this response.
+     *
+     * @param[in] aKeepAlive Whether to keep the connection open.
+     */
+    void SetKeepAlive(bool aKeepAlive);
+
+    /**
+     * This method checks whether the connection is kept open after this response.
+     *
+     * @returns  A bool value indicates whether the connection is kept open after this response.
+     */
+    bool IsKeepAlive(void) const;
+
+    /**
+     * This method sets whether the body of this response is CBOR instead of JSON.
+     *
+     * @param[in] aCbor Whether the body is CBOR.
+     */
+    void SetCbor(bool aCbor);
+
+    /**
+     * This method checks whether the body of this response is CBOR instead of JSON.
+     *
+     * @returns  A bool value indicates whether the body is CBOR.
+     */
+    bool IsCbor(void) const;
+
+    /**
+     * This method sets the body of this response to be metrics in the Prometheus text exposition format.
+     *
+     */
+    void SetMetricsText(void);
+
+    /**
+     * This method sets the body of this response to be opaque binary data.
+     *
+     */
+    void SetBinary(void);
+
+    /**
+     * This method compresses the body with gzip if it is large enough to benefit from it.
+     *
+     * Streams, bodies smaller than `kCompressThreshold` and bodies which do not get smaller are not compressed. The
+     * entity tag, if any, becomes a weak one, since it was computed for the uncompressed representation.
+     *
+     * @returns  A bool value indicates whether the body has been compressed.
+     */
+    bool Compress(void);
+
+    /**
+     * This method sets the entity tag of the response body.
+     *
+     * @param[in] aETag A strong entity tag including the quotes.
+     */
+    void SetETag(const std::string &aETag);
+
+    /**
+     * This method computes the entity tag from the response body, unless it is already set.
+     *
+     */
+    void UpdateETag(void);
+
+    /**
+     * This method returns the entity tag of the response body.
+     *
+     * @returns  A string contains the entity tag, or an empty string if it is not set.
+     */
+    const std::string &GetETag(void) const;
+
+    /**
+     * This method turns the response into a "304 Not Modified" response without body.
+     *
+     */
+    void SetNotModified(void);
+
+    /**
+     * This method marks the body as taken before the agent restarted, with the Age and Warning header fields.
+     *
+     * @param[in] aAge  The age of the body in seconds.
+     */
+    void SetStale(uint64_t aAge);
+
+    /**
+     * This method turns the response into a stream of Server-Sent Events, sent with chunked transfer coding.
+     *
+     * The body of a stream response grows with every event appended, and the events already in it may be
+     * written before the response is complete.
+     *
+     */
+    void SetStream(void);
+
+    /**
+     * This method sends the body of this response with chunked transfer coding, as it is produced.
+     *
+     * The connection asks the producer for the next part of the body each time the previous one has been
+     * written, so only one part of the body is held at once. A chunked response has no entity tag and is not
+     * compressed.
+     *
+     * @param[in] aProducer A function producing the body part by part.
+     *
+     */
+    void SetChunked(ChunkProducer aProducer);
+
+    /**
+     * This method checks whether the body of this response is sent with chunked transfer coding.
+     *
+     * @returns  A bool value indicates whether the body is chunked.
+     */
+    bool IsChunked(void) const;
+
+    /**
+     * This method checks whether the producer of a chunked response has more of the body to produce.
+     *
+     * @returns  A bool value indicates whether more chunks will follow the current one.
+     */
+    bool HasMoreChunks(void) const;
+
+    /**
+     * This method replaces the body with the next chunk of a chunked response.
+     *
+     * The chunk is framed with chunked transfer coding, the last chunk is followed by the chunk ending the body.
+     * The body is never left empty.
+     *
+     */
+    void NextChunk(void);
+
+    /**
+     * This method checks whether this response is a stream of Server-Sent Events.
+     *
+     * @returns  A bool value indicates whether this response is a stream.
+     */
+    bool IsStream(void) const;
+
+    /**
+     * This method appends an event to a stream response.
+     *
+     * @param[in] aData A string to be sent as the data of the event.
+     *
+     */
+    void AppendStreamEvent(const std::string &aData);
+
+    /**
+     * This method appends an event with an identifier to a stream response.
+     *
+     * A client reconnecting to the stream sends the identifier of the last event it received in the
+     * `Last-Event-ID` header.
+     *
+     * @param[in] aData A string to be sent as the data of the event.
+     * @param[in] aId   The identifier of the event.
      *
-     * @returns  A string contains status line, headers and body of a response.
      */
-    std::string Serialize(void) const;
+    void AppendStreamEvent(const std::string &aData, uint64_t aId);
+
+    /**
+     * This method ends a stream response and labels it as complete.
+     *
+     */
+    void EndStream(void);
+
+    /**
+     * This method sets a timestamp telling the callback handler which data has already been sent in the stream.
+     *
+     * @param[in] aStreamTime A timestamp indicates when the stream was last updated.
+     */
+    void SetStreamTime(steady_clock::time_point aStreamTime);
+
+    /**
+     * This method returns the timestamp of the last stream update.
+     *
+     * @returns  A timepoint object indicates when the stream was last updated.
+     */
+    steady_clock::time_point GetStreamTime(void) const;
+
+    /**
+     * This method sets the sequence number of the last change sent in the stream, for streams of numbered changes.
+     *
+     * @param[in] aSequence The sequence number.
+     */
+    void SetStreamSequence(uint64_t aSequence) { mStreamSequence = aSequence; }
+
+    /**
+     * This method returns the sequence number of the last change sent in the stream.
+     *
+     * @returns  The sequence number.
+     */
+    uint64_t GetStreamSequence(void) const { return mStreamSequence; }
+
+    /**
+     * This method clears the response in place, so it could be reused for the next request on a persistent
+     * connection.
+     *
+     */
+    void Reset(void);
+
+    /**
+     * This method serializes the status line and headers of a response, which are sent by socket followed by the body.
+     *
+     * @returns  A string contains status line and headers of a response, ending with an empty line.
+     */
+    std::string SerializeHeader(void) const;
 
 private:
+    void SetContentType(const char *aContentType);
+    void AppendEvent(const std::string &aFields, const std::string &aData);
+
     bool                     mCallback;
     std::vector<std::string> mHeaderField;
     std::vector<std::string> mHeaderValue;
@@ -143,7 +350,22 @@ private:
     std::string              mProtocol;
     std::string              mBody;
     bool                     mComplete;
+    bool                     mKeepAlive;
+    bool                     mNotModified;
+    bool                     mStream;
+    bool                     mCbor;
+    bool                     mMetricsText;
+    bool                     mBinary;
+    bool                     mGzip;
+    bool                     mChunked;
+    bool                     mStale;
+    uint64_t                 mAge;
+    ChunkProducer            mChunkProducer;
+    std::string              mChunk;
+    std::string              mETag;
     steady_clock::time_point mStartTime;
+    steady_clock::time_point mStreamTime;
+    uint64_t                 mStreamSequence;
 };
 
 } // namespace rest
@@ -0,0 +1,214 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the implementation of the response snapshot OTBR-REST serves after a restart.
+ */
+
+#include "rest/response_snapshot.hpp"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+namespace rest {
+
+// The file starts with a magic, then each entry is:
+//   path length (1), path, time (8), JSON body length (4), JSON body, CBOR body length (4), CBOR body.
+// Integers are big-endian.
+static const char kMagic[] = "OTBRSNP1";
+
+static void AppendUint(std::string &aData, uint64_t aValue, size_t aLength)
+{
+    for (size_t i = aLength; i > 0; --i)
+    {
+        aData.push_back(static_cast<char>(aValue >> (8 * (i - 1))));
+    }
+}
+
+static otbrError ReadUint(const uint8_t *&aCur, const uint8_t *aEnd, size_t aLength, uint64_t &aValue)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    VerifyOrExit(static_cast<size_t>(aEnd - aCur) >= aLength, error = OTBR_ERROR_PARSE);
+
+    aValue = 0;
+    for (size_t i = 0; i < aLength; ++i)
+    {
+        aValue = (aValue << 8) | *aCur++;
+    }
+
+exit:
+    return error;
+}
+
+static otbrError ReadString(const uint8_t *&aCur, const uint8_t *aEnd, size_t aLengthSize, std::string &aString)
+{
+    otbrError error;
+    uint64_t  length;
+
+    SuccessOrExit(error = ReadUint(aCur, aEnd, aLengthSize, length));
+    VerifyOrExit(static_cast<uint64_t>(aEnd - aCur) >= length, error = OTBR_ERROR_PARSE);
+    aString.assign(reinterpret_cast<const char *>(aCur), length);
+    aCur += length;
+
+exit:
+    return error;
+}
+
+otbrError ResponseSnapshot::Load(const char *aPath, uint64_t aNow, uint64_t aMaxAge)
+{
+    otbrError            error = OTBR_ERROR_NONE;
+    int                  fd    = open(aPath, O_RDONLY | O_CLOEXEC);
+    std::vector<uint8_t> data;
+    uint8_t              buffer[4096];
+    ssize_t              count;
+    const uint8_t *      cur;
+    const uint8_t *      end;
+
+    mEntries.clear();
+
+    if (fd < 0)
+    {
+        VerifyOrExit(errno == ENOENT, error = OTBR_ERROR_ERRNO);
+        ExitNow();
+    }
+
+    while ((count = read(fd, buffer, sizeof(buffer))) > 0)
+    {
+        data.insert(data.end(), buffer, buffer + count);
+    }
+    VerifyOrExit(count == 0, error = OTBR_ERROR_ERRNO);
+
+    cur = data.data();
+    end = data.data() + data.size();
+
+    if (data.size() < sizeof(kMagic) - 1 || memcmp(cur, kMagic, sizeof(kMagic) - 1) != 0)
+    {
+        otbrLog(OTBR_LOG_WARNING, "ignored snapshot %s of an unknown format", aPath);
+        ExitNow();
+    }
+    cur += sizeof(kMagic) - 1;
+
+    while (cur < end)
+    {
+        std::string path;
+        Entry       entry;
+
+        if (ReadString(cur, end, 1, path) != OTBR_ERROR_NONE || ReadUint(cur, end, 8, entry.mTime) != OTBR_ERROR_NONE ||
+            ReadString(cur, end, 4, entry.mJson) != OTBR_ERROR_NONE ||
+            ReadString(cur, end, 4, entry.mCbor) != OTBR_ERROR_NONE)
+        {
+            otbrLog(OTBR_LOG_WARNING, "dropped corrupted snapshot entries at offset %zu of %s",
+                    static_cast<size_t>(cur - data.data()), aPath);
+            break;
+        }
+
+        if (entry.mTime <= aNow && aNow - entry.mTime <= aMaxAge)
+        {
+            mEntries[path] = std::move(entry);
+        }
+    }
+
+exit:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "failed to load snapshot %s: %s", aPath, strerror(errno));
+    }
+
+    return error;
+}
+
+otbrError ResponseSnapshot::Save(const char *aPath) const
+{
+    otbrError   error   = OTBR_ERROR_NONE;
+    std::string tmpPath = std::string(aPath) + ".tmp";
+    int         fd      = open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600);
+    std::string data(kMagic, sizeof(kMagic) - 1);
+
+    VerifyOrExit(fd >= 0, error = OTBR_ERROR_ERRNO);
+
+    for (const auto &entry : mEntries)
+    {
+        if (entry.first.size() > UINT8_MAX || entry.second.mJson.size() > UINT32_MAX ||
+            entry.second.mCbor.size() > UINT32_MAX)
+        {
+            continue;
+        }
+
+        AppendUint(data, entry.first.size(), 1);
+        data += entry.first;
+        AppendUint(data, entry.second.mTime, 8);
+        AppendUint(data, entry.second.mJson.size(), 4);
+        data += entry.second.mJson;
+        AppendUint(data, entry.second.mCbor.size(), 4);
+        data += entry.second.mCbor;
+    }
+
+    // The new snapshot replaces the old one atomically, a crash leaves either of them complete.
+    VerifyOrExit(write(fd, data.data(), data.size()) == static_cast<ssize_t>(data.size()), error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(fsync(fd) == 0, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(rename(tmpPath.c_str(), aPath) == 0, error = OTBR_ERROR_ERRNO);
+
+exit:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "failed to save snapshot %s: %s", aPath, strerror(errno));
+    }
+
+    return error;
+}
+
+const ResponseSnapshot::Entry *ResponseSnapshot::Find(const std::string &aPath) const
+{
+    auto it = mEntries.find(aPath);
+
+    return it != mEntries.end() ? &it->second : nullptr;
+}
+
+} // namespace rest
+} // namespace otbr
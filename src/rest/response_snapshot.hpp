@@ -0,0 +1,129 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the response snapshot OTBR-REST serves after a restart.
+ */
+
+#ifndef OTBR_REST_RESPONSE_SNAPSHOT_HPP_
+#define OTBR_REST_RESPONSE_SNAPSHOT_HPP_
+
+#include <map>
+#include <string>
+
+#include <stdint.h>
+
+#include "common/types.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class keeps the last bodies of some resources in a file, to answer them right after a restart.
+ *
+ * Each resource has its JSON and CBOR bodies and the time they were taken. The file is rewritten as a whole, a
+ * crash while saving leaves the previous snapshot.
+ *
+ */
+class ResponseSnapshot
+{
+public:
+    /**
+     * This structure represents the bodies of a resource.
+     *
+     */
+    struct Entry
+    {
+        uint64_t    mTime; ///< The time the bodies were taken, in seconds since the Unix epoch.
+        std::string mJson; ///< The JSON body.
+        std::string mCbor; ///< The CBOR body.
+    };
+
+    typedef std::map<std::string, Entry> EntryMap;
+
+    /**
+     * This method loads the entries from a file, replacing the current ones.
+     *
+     * A missing file is an empty snapshot. Entries taken more than @p aMaxAge before @p aNow are dropped, as are a
+     * truncated or corrupted entry and anything after it.
+     *
+     * @param[in]   aPath     The path of the snapshot file.
+     * @param[in]   aNow      The current time in seconds since the Unix epoch.
+     * @param[in]   aMaxAge   The age in seconds beyond which an entry is dropped.
+     *
+     * @retval  OTBR_ERROR_NONE   Successfully loaded the snapshot.
+     * @retval  OTBR_ERROR_ERRNO  Failed to read the snapshot file.
+     *
+     */
+    otbrError Load(const char *aPath, uint64_t aNow, uint64_t aMaxAge);
+
+    /**
+     * This method saves the entries to a file.
+     *
+     * @param[in]   aPath     The path of the snapshot file.
+     *
+     * @retval  OTBR_ERROR_NONE   Successfully saved the snapshot.
+     * @retval  OTBR_ERROR_ERRNO  Failed to write the snapshot file.
+     *
+     */
+    otbrError Save(const char *aPath) const;
+
+    /**
+     * This method adds or replaces the bodies of a resource.
+     *
+     * @param[in]   aPath   The path of the resource.
+     * @param[in]   aEntry  The bodies of the resource.
+     *
+     */
+    void Set(const std::string &aPath, Entry aEntry) { mEntries[aPath] = std::move(aEntry); }
+
+    /**
+     * This method finds the bodies of a resource.
+     *
+     * @param[in]   aPath   The path of the resource.
+     *
+     * @returns A pointer to the entry, or nullptr if there is none.
+     *
+     */
+    const Entry *Find(const std::string &aPath) const;
+
+    /**
+     * This method returns the entries.
+     *
+     */
+    const EntryMap &GetEntries(void) const { return mEntries; }
+
+private:
+    EntryMap mEntries;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_RESPONSE_SNAPSHOT_HPP_
@@ -31,6 +31,17 @@
 #include <cerrno>
 
 #include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/un.h>
+
+#include "agent/instance_params.hpp"
+#include "common/mainloop_poller.hpp"
+#include "common/usdt.hpp"
 
 using std::chrono::duration_cast;
 using std::chrono::microseconds;
@@ -39,14 +50,35 @@ using std::chrono::steady_clock;
 namespace otbr {
 namespace rest {
 
-// Maximum number of connection a server support at the same time.
-static const uint32_t kMaxServeNum = 500;
-// Port number used by Rest server.
-static const uint32_t kPortNumber = 8081;
+// Maximum number of connections accepted per mainloop iteration, so a burst of clients can't delay OpenThread.
+static const uint32_t kMaxAcceptBatch = 8;
+
+// Maximum number of completed connections kept for reuse.
+static const size_t kMaxPooledConnections = 16;
+
+// The client address of connections on the Unix domain socket, which is never the address of a TCP client.
+static const uint32_t kUnixClientAddress = INADDR_ANY;
+
+// Poll timeout of the REST thread without timers, tasks wake it up.
+static const struct timeval kThreadPollTimeout = {3600, 0};
+
+// The interval to retry opening the listening sockets, which are otherwise not polled for.
+static const struct timeval kListenRetryInterval = {10, 0};
+
+// The interval to save the resources served right after a restart.
+static const std::chrono::minutes kSnapshotSaveInterval(5);
+
+// The response to a connection beyond the limits, sent without reading the request.
+static const char kServiceUnavailable[] = "HTTP/1.1 503 Service Unavailable\r\n"
+                                          "Retry-After: 1\r\n"
+                                          "Content-Length: 0\r\n"
+                                          "Connection: close\r\n\r\n";
 
 RestWebServer::RestWebServer(ControllerOpenThread *aNcp)
     : mResource(Resource(aNcp))
+    , mThreadRunning(false)
     , mListenFd(-1)
+    , mUnixListenFd(-1)
 {
 }
 
@@ -59,80 +91,372 @@ RestWebServer *RestWebServer::GetRestWebServer(ControllerOpenThread *aNcp)
 
 otbrError RestWebServer::Init(void)
 {
-    otbrError error = OTBR_ERROR_NONE;
+    otbrError   error = OTBR_ERROR_NONE;
+    const char *snapshotFile;
 
     mResource.Init();
 
-    error = InitializeListenFd();
+    if (InstanceParams::Get().GetRestThreadEnabled())
+    {
+        SuccessOrExit(error = mBridge.Enable());
+        // Diagnostics are only copied on the mainloop, and encoded by the REST thread as they are written.
+        mResource.SetLazyEncoding(true);
+    }
+
+    // The update handler is called on the mainloop, and a call completes on the REST thread.
+    mResource.SetUpdateHandler([this]() { mBridge.PostToRestThread([this]() { ProcessCallbackConnections(); }); });
+    mBridge.SetDoneHandler([this]() { ProcessCallbackConnections(); });
+
+    if (InstanceParams::Get().GetRestDiagCrawlInterval() > 0)
+    {
+        mCrawlTimer = TimerWheel::Handle(mTimerWheel, mTimerWheel.Add(steady_clock::now(), [this]() { Crawl(); }));
+    }
+
+    snapshotFile = InstanceParams::Get().GetRestSnapshotFile();
+    if (snapshotFile != nullptr && snapshotFile[0] != '\0')
+    {
+        mSnapshotTimer = TimerWheel::Handle(
+            mTimerWheel, mTimerWheel.Add(steady_clock::now() + kSnapshotSaveInterval, [this]() { SaveSnapshot(); }));
+    }
+
+    if (mBridge.IsEnabled())
+    {
+        error = StartThread();
+    }
+    else
+    {
+        error = InitializeListenFd();
+    }
 
+exit:
     return error;
 }
 
-void RestWebServer::UpdateFdSet(otSysMainloopContext &aMainloop)
+otbrError RestWebServer::StartThread(void)
+{
+    otbrError               error = OTBR_ERROR_NONE;
+    std::promise<otbrError> started;
+    std::future<otbrError>  result = started.get_future();
+    sigset_t                allSignals;
+    sigset_t                oldSignals;
+
+    // Signals are left to the mainloop thread, whose poll they interrupt.
+    sigfillset(&allSignals);
+    pthread_sigmask(SIG_SETMASK, &allSignals, &oldSignals);
+    mThread = std::thread(&RestWebServer::RunThread, this, std::move(started));
+    pthread_sigmask(SIG_SETMASK, &oldSignals, nullptr);
+
+#ifdef __linux__
+    pthread_setname_np(mThread.native_handle(), "otbr-rest");
+#endif
+
+    // A failure to listen is retried by the thread, as by the mainloop.
+    error = result.get();
+
+    if (error == OTBR_ERROR_ERRNO)
+    {
+        mThread.join();
+        otbrLog(OTBR_LOG_ERR, "Failed to start the REST thread");
+    }
+
+    return error;
+}
+
+void RestWebServer::StopThread(void)
+{
+    VerifyOrExit(mThread.joinable());
+
+    mBridge.PostToRestThread([this]() { mThreadRunning = false; });
+    mThread.join();
+
+exit:
+    return;
+}
+
+void RestWebServer::RunThread(std::promise<otbrError> aStarted)
 {
-    if (mListenFd == -1)
+    MainloopPoller poller;
+    otbrError      error;
+
+    MainloopPoller::SetThreadPoller(&poller);
+
+    error          = mBridge.InitRestThread();
+    mThreadRunning = (error == OTBR_ERROR_NONE);
+
+    if (mThreadRunning)
     {
-        VerifyOrExit(InitializeListenFd() == OTBR_ERROR_NONE);
+        error = InitializeListenFd();
     }
-    FD_SET(mListenFd, &aMainloop.mReadFdSet);
-    aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mListenFd);
 
-    for (auto it = mConnectionSet.begin(); it != mConnectionSet.end(); ++it)
+    aStarted.set_value(error);
+
+    while (mThreadRunning)
     {
-        Connection *connection = it->second.get();
-        connection->UpdateFdSet(aMainloop);
+        otSysMainloopContext mainloop;
+
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = kThreadPollTimeout;
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+
+        UpdateTimeout(mainloop);
+
+        if (poller.Poll(mainloop) < 0)
+        {
+            VerifyOrExit(errno == EINTR, otbrLog(OTBR_LOG_ERR, "REST thread poll failed: %s", strerror(errno)));
+            continue;
+        }
+
+        // Completed calls reschedule their connections, which are then processed with the expired timers.
+        mBridge.ProcessRestTasks();
+        ProcessSockets();
     }
+
 exit:
+    MainloopPoller::SetThreadPoller(nullptr);
+}
+
+void RestWebServer::UpdateFdSet(otSysMainloopContext &aMainloop)
+{
+    if (!mBridge.IsEnabled())
+    {
+        UpdateTimeout(aMainloop);
+    }
+}
+
+void RestWebServer::UpdateTimeout(otSysMainloopContext &aMainloop)
+{
+    if (InitializeListenFd() != OTBR_ERROR_NONE)
+    {
+        if (timercmp(&kListenRetryInterval, &aMainloop.mTimeout, <))
+        {
+            aMainloop.mTimeout = kListenRetryInterval;
+        }
+        ExitNow();
+    }
+
+    if (mTimerWheel.GetSize() > 0)
+    {
+        auto           fireTime = mTimerWheel.GetNextFireTime();
+        auto           now      = steady_clock::now();
+        struct timeval timeout  = {0, 0};
+
+        if (fireTime > now)
+        {
+            auto duration = duration_cast<microseconds>(fireTime - now).count();
+
+            timeout.tv_sec  = static_cast<time_t>(duration / 1000000);
+            timeout.tv_usec = static_cast<suseconds_t>(duration % 1000000);
+        }
 
+        if (timercmp(&timeout, &aMainloop.mTimeout, <))
+        {
+            aMainloop.mTimeout = timeout;
+        }
+    }
+
+exit:
     return;
 }
 
 otbrError RestWebServer::Process(otSysMainloopContext &aMainloop)
 {
-    otbrError   error = OTBR_ERROR_NONE;
-    Connection *connection;
+    otbrError error = OTBR_ERROR_NONE;
+
+    OTBR_UNUSED_VARIABLE(aMainloop);
+
+    if (mBridge.IsEnabled())
+    {
+        mBridge.ProcessOtTasks();
+    }
+    else
+    {
+        error = ProcessSockets();
+    }
 
-    error = UpdateConnections(aMainloop.mReadFdSet);
+    return error;
+}
+
+otbrError RestWebServer::ProcessSockets(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    mTimerWheel.Process(steady_clock::now());
+
+    for (int fd : MainloopPoller::Get().GetReadyFds())
+    {
+        if (fd != mListenFd && fd != mUnixListenFd)
+        {
+            ProcessConnection(fd);
+        }
+    }
+
+    error = AcceptConnections(mListenFd);
+
+    if (error == OTBR_ERROR_NONE)
+    {
+        error = AcceptConnections(mUnixListenFd);
+    }
+
+    return error;
+}
+
+otbrError RestWebServer::AcceptConnections(int32_t aListenFd)
+{
+    otbrError error = OTBR_ERROR_NONE;
 
-    for (auto it = mConnectionSet.begin(); it != mConnectionSet.end(); ++it)
+    // Create new connections if listenfd is set, the rest are accepted in the next iteration.
+    VerifyOrExit(aListenFd != -1 && MainloopPoller::Get().IsReadable(aListenFd));
+
+    for (uint32_t i = 0; i < kMaxAcceptBatch; ++i)
     {
-        connection = it->second.get();
-        connection->Process(aMainloop.mReadFdSet, aMainloop.mWriteFdSet);
+        error = Accept(aListenFd);
+
+        if (error != OTBR_ERROR_NONE)
+        {
+            // No more pending connections.
+            error = (error == OTBR_ERROR_NOT_FOUND) ? OTBR_ERROR_NONE : error;
+            break;
+        }
     }
 
+exit:
     return error;
 }
 
-otbrError RestWebServer::UpdateConnections(fd_set &aReadFdSet)
+void RestWebServer::ProcessConnection(int32_t aFd)
 {
-    otbrError error   = OTBR_ERROR_NONE;
-    auto      eraseIt = mConnectionSet.begin();
+    auto             it = mConnectionSet.find(aFd);
+    ConnectionEntry *entry;
+
+    VerifyOrExit(it != mConnectionSet.end());
+    entry = &it->second;
+
+    entry->mConnection->Process();
 
-    // Erase useless connections
-    for (eraseIt = mConnectionSet.begin(); eraseIt != mConnectionSet.end();)
+    if (entry->mConnection->IsWaitingCallback())
     {
-        Connection *connection = eraseIt->second.get();
+        mCallbackConnections.insert(aFd);
+    }
+    else
+    {
+        mCallbackConnections.erase(aFd);
+    }
 
-        if (connection->IsComplete())
+    if (entry->mConnection->IsComplete())
+    {
+        auto client = mClientConnections.find(entry->mClientAddress);
+
+        if (client != mClientConnections.end() && --client->second == 0)
         {
-            eraseIt = mConnectionSet.erase(eraseIt);
+            mClientConnections.erase(client);
         }
-        else
+
+        // Erase useless connections, and keep the connection and its buffers for a next client.
+        entry->mTimeoutTimer.Cancel();
+
+        if (mConnectionPool.size() < kMaxPooledConnections)
         {
-            eraseIt++;
+            mConnectionPool.push_back(std::move(entry->mConnection));
         }
+
+        mConnectionSet.erase(it);
+    }
+    else if (!entry->mTimeoutTimer.Reschedule(entry->mConnection->GetTimeout()))
+    {
+        entry->mTimeoutTimer = TimerWheel::Handle(
+            mTimerWheel, mTimerWheel.Add(entry->mConnection->GetTimeout(), [this, aFd]() { ProcessConnection(aFd); }));
     }
 
-    // Create new connection if listenfd is set
-    if (FD_ISSET(mListenFd, &aReadFdSet) && mConnectionSet.size() < kMaxServeNum)
+exit:
+    return;
+}
+
+void RestWebServer::ProcessCallbackConnections(void)
+{
+    auto now = steady_clock::now();
+
+    // Connections are not processed here, as the handler is called while OpenThread is processing.
+    for (int32_t fd : mCallbackConnections)
     {
-        error = Accept(mListenFd);
+        auto it = mConnectionSet.find(fd);
+
+        if (it != mConnectionSet.end())
+        {
+            it->second.mTimeoutTimer.Reschedule(now);
+        }
     }
+}
 
-    return error;
+void RestWebServer::Crawl(void)
+{
+    auto next = std::make_shared<steady_clock::time_point>();
+
+    mBridge.Call([this, next]() { *next = mResource.Crawl(steady_clock::now()); },
+                 [this, next]() {
+                     mCrawlTimer = TimerWheel::Handle(mTimerWheel, mTimerWheel.Add(*next, [this]() { Crawl(); }));
+                 });
+}
+
+void RestWebServer::SaveSnapshot(void)
+{
+    mBridge.Call([this]() { mResource.SaveSnapshot(); },
+                 [this]() {
+                     mSnapshotTimer = TimerWheel::Handle(
+                         mTimerWheel,
+                         mTimerWheel.Add(steady_clock::now() + kSnapshotSaveInterval, [this]() { SaveSnapshot(); }));
+                 });
+}
+
+void RestWebServer::ReopenListenFds(void)
+{
+    mBridge.PostToRestThread([this]() { CloseListenFds(); });
+}
+
+void RestWebServer::CloseListenFds(void)
+{
+    if (mListenFd != -1)
+    {
+        MainloopPoller::Get().Unregister(mListenFd);
+        close(mListenFd);
+        mListenFd = -1;
+    }
+
+    if (mUnixListenFd != -1)
+    {
+        MainloopPoller::Get().Unregister(mUnixListenFd);
+        close(mUnixListenFd);
+        mUnixListenFd = -1;
+        unlink(mUnixListenPath.c_str());
+        mUnixListenPath.clear();
+    }
+
+    otbrLog(OTBR_LOG_INFO, "REST server listen settings changed, reopening listening sockets");
 }
 
 otbrError RestWebServer::InitializeListenFd(void)
+{
+    otbrError error = OTBR_ERROR_NONE;
+
+    // A port of zero only listens on the Unix domain socket.
+    if (mListenFd == -1 && InstanceParams::Get().GetRestListenPort() != 0)
+    {
+        error = InitializeTcpListenFd();
+    }
+
+    if (mUnixListenFd == -1 && InstanceParams::Get().GetRestListenPath() != nullptr)
+    {
+        otbrError unixError = InitializeUnixListenFd();
+
+        error = (error == OTBR_ERROR_NONE) ? unixError : error;
+    }
+
+    return error;
+}
+
+otbrError RestWebServer::InitializeTcpListenFd(void)
 {
     otbrError   error = OTBR_ERROR_NONE;
     std::string errorMessage;
@@ -142,7 +466,7 @@ otbrError RestWebServer::InitializeListenFd(void)
 
     mAddress.sin_family      = AF_INET;
     mAddress.sin_addr.s_addr = INADDR_ANY;
-    mAddress.sin_port        = htons(kPortNumber);
+    mAddress.sin_port        = htons(InstanceParams::Get().GetRestListenPort());
 
     mListenFd = socket(AF_INET, SOCK_STREAM, 0);
     VerifyOrExit(mListenFd != -1, err = errno, error = OTBR_ERROR_REST, errorMessage = "socket");
@@ -159,6 +483,9 @@ otbrError RestWebServer::InitializeListenFd(void)
     ret = SetFdNonblocking(mListenFd);
     VerifyOrExit(ret, err = errno, error = OTBR_ERROR_REST, errorMessage = " set nonblock");
 
+    VerifyOrExit(MainloopPoller::Get().Register(mListenFd, MainloopPoller::kEventRead) == OTBR_ERROR_NONE,
+                 err = errno, error = OTBR_ERROR_REST, errorMessage = "register");
+
 exit:
     if (error != OTBR_ERROR_NONE)
     {
@@ -173,26 +500,102 @@ exit:
     return error;
 }
 
-otbrError RestWebServer::Accept(int aListenFd)
+otbrError RestWebServer::InitializeUnixListenFd(void)
 {
-    std::string errorMessage;
     otbrError   error = OTBR_ERROR_NONE;
-    int32_t     err;
-    int32_t     fd;
-    sockaddr_in tmp;
-    socklen_t   addrlen = sizeof(tmp);
+    std::string errorMessage;
+    const char *path = InstanceParams::Get().GetRestListenPath();
+    sockaddr_un address;
+    struct stat status;
+    int32_t     ret;
+    int32_t     err = errno;
+
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    VerifyOrExit(strlen(path) < sizeof(address.sun_path), err = ENAMETOOLONG, error = OTBR_ERROR_REST,
+                 errorMessage = "socket path");
+    strcpy(address.sun_path, path);
+
+    // The socket file of a previous agent is removed, any other file is left to fail the bind.
+    if (lstat(path, &status) == 0 && S_ISSOCK(status.st_mode))
+    {
+        unlink(path);
+    }
+
+    mUnixListenFd = socket(AF_UNIX, SOCK_STREAM, 0);
+    VerifyOrExit(mUnixListenFd != -1, err = errno, error = OTBR_ERROR_REST, errorMessage = "unix socket");
+
+    ret = bind(mUnixListenFd, reinterpret_cast<struct sockaddr *>(&address), sizeof(address));
+    VerifyOrExit(ret == 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "unix bind");
+
+    ret = listen(mUnixListenFd, 5);
+    VerifyOrExit(ret >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "unix listen");
+
+    ret = SetFdNonblocking(mUnixListenFd);
+    VerifyOrExit(ret, err = errno, error = OTBR_ERROR_REST, errorMessage = "unix set nonblock");
+
+    VerifyOrExit(MainloopPoller::Get().Register(mUnixListenFd, MainloopPoller::kEventRead) == OTBR_ERROR_NONE,
+                 err = errno, error = OTBR_ERROR_REST, errorMessage = "unix register");
+
+    mUnixListenPath = path;
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        if (mUnixListenFd != -1)
+        {
+            close(mUnixListenFd);
+            mUnixListenFd = -1;
+        }
+        otbrLog(OTBR_LOG_ERR, "otbr rest server init error %s : %s", errorMessage.c_str(), strerror(err));
+    }
+
+    return error;
+}
 
-    fd  = accept(aListenFd, reinterpret_cast<struct sockaddr *>(&mAddress), &addrlen);
+otbrError RestWebServer::Accept(int aListenFd)
+{
+    std::string      errorMessage;
+    otbrError        error = OTBR_ERROR_NONE;
+    int32_t          err;
+    int32_t          fd;
+    sockaddr_storage clientAddr;
+    socklen_t        addrlen       = sizeof(clientAddr);
+    uint32_t         clientAddress = kUnixClientAddress;
+
+#ifdef __linux__
+    fd  = accept4(aListenFd, reinterpret_cast<struct sockaddr *>(&clientAddr), &addrlen, SOCK_NONBLOCK | SOCK_CLOEXEC);
+    err = errno;
+#else
+    fd  = accept(aListenFd, reinterpret_cast<struct sockaddr *>(&clientAddr), &addrlen);
     err = errno;
+#endif
 
+    VerifyOrExit(fd >= 0 || (err != EAGAIN && err != EWOULDBLOCK), error = OTBR_ERROR_NOT_FOUND);
     VerifyOrExit(fd >= 0, err = errno, error = OTBR_ERROR_REST, errorMessage = "accept");
 
+#ifndef __linux__
     VerifyOrExit(SetFdNonblocking(fd), err = errno, error = OTBR_ERROR_REST; errorMessage = "set nonblock");
+#endif
+
+    OTBR_USDT1(rest_accept, fd);
+
+    if (clientAddr.ss_family == AF_INET)
+    {
+        clientAddress = reinterpret_cast<sockaddr_in *>(&clientAddr)->sin_addr.s_addr;
+    }
 
-    CreateNewConnection(fd);
+    if (IsAdmitted(clientAddress))
+    {
+        CreateNewConnection(fd, clientAddress);
+    }
+    else
+    {
+        Reject(fd);
+    }
 
 exit:
-    if (error != OTBR_ERROR_NONE)
+    if (error != OTBR_ERROR_NONE && error != OTBR_ERROR_NOT_FOUND)
     {
         if (fd != -1)
         {
@@ -205,15 +608,61 @@ exit:
     return error;
 }
 
-void RestWebServer::CreateNewConnection(int &aFd)
+bool RestWebServer::IsAdmitted(uint32_t aClientAddress) const
+{
+    uint32_t maxPerClient = InstanceParams::Get().GetRestMaxClientConnections();
+    auto     client       = mClientConnections.find(aClientAddress);
+    bool     admitted     = true;
+
+    VerifyOrExit(mConnectionSet.size() < InstanceParams::Get().GetRestMaxConnections(), admitted = false);
+    // Clients on the Unix domain socket are local, and only limited by the total number of connections.
+    VerifyOrExit(aClientAddress != kUnixClientAddress);
+    VerifyOrExit(maxPerClient == 0 || client == mClientConnections.end() || client->second < maxPerClient,
+                 admitted = false);
+
+exit:
+    return admitted;
+}
+
+void RestWebServer::Reject(int &aFd)
+{
+    // The socket buffer of a new connection has room for the response, a failure only loses the status line.
+    if (send(aFd, kServiceUnavailable, sizeof(kServiceUnavailable) - 1, MSG_NOSIGNAL) < 0)
+    {
+        otbrLog(OTBR_LOG_DEBUG, "rest server reject error: %s", strerror(errno));
+    }
+
+    close(aFd);
+    aFd = -1;
+}
+
+void RestWebServer::CreateNewConnection(int &aFd, uint32_t aClientAddress)
 {
-    auto it =
-        mConnectionSet.emplace(aFd, std::unique_ptr<Connection>(new Connection(steady_clock::now(), &mResource, aFd)));
+    ConnectionEntry entry;
+
+    if (mConnectionPool.empty())
+    {
+        entry.mConnection.reset(new Connection(steady_clock::now(), &mResource, &mBridge, aFd));
+    }
+    else
+    {
+        entry.mConnection = std::move(mConnectionPool.back());
+        mConnectionPool.pop_back();
+        entry.mConnection->Reset(steady_clock::now(), aFd);
+    }
+
+    entry.mClientAddress = aClientAddress;
+
+    auto it = mConnectionSet.emplace(aFd, std::move(entry));
 
     if (it.second == true)
     {
-        Connection *connection = it.first->second.get();
+        Connection *connection = it.first->second.mConnection.get();
         connection->Init();
+        ++mClientConnections[aClientAddress];
+
+        // A new connection reads directly for the first time.
+        ProcessConnection(aFd);
     }
     else
     {
@@ -34,6 +34,11 @@
 #ifndef OTBR_REST_REST_WEB_SERVER_HPP_
 #define OTBR_REST_REST_WEB_SERVER_HPP_
 
+#include <future>
+#include <thread>
+#include <unordered_set>
+
+#include "common/timer_wheel.hpp"
 #include "rest/connection.hpp"
 
 using otbr::Ncp::ControllerOpenThread;
@@ -62,14 +67,30 @@ public:
     /**
      * This method initializes the REST server.
      *
+     * If enabled by `InstanceParams`, the sockets are served by a REST thread, which calls into OpenThread through
+     * the mainloop. Responses are then written, and large diagnostics encoded, off the mainloop.
+     *
      * @retval  OTBR_ERROR_NONE     REST server initialized successfully.
      * @retval  OTBR_ERROR_REST     Failed due to rest error .
+     * @retval  OTBR_ERROR_ERRNO    Failed to start the REST thread.
      *
      */
     otbrError Init(void);
 
     /**
-     * This method updates the file descriptor sets and timeout for mainloop.
+     * This method stops the REST thread, if it runs.
+     *
+     * This method MUST be called from the mainloop thread. Established connections are left unanswered.
+     *
+     */
+    void StopThread(void);
+
+    /**
+     * This method updates the timeout for mainloop.
+     *
+     * The listening socket and connection sockets are registered with `MainloopPoller`, and connection timeouts
+     * are kept in a timer wheel, so this method does not visit the connections. With the REST thread, the mainloop
+     * only waits for the calls into OpenThread, whose queue is registered with `MainloopPoller` as well.
      *
      * @param[inout]    aMainloop   A reference to OpenThread mainloop context.
      *
@@ -79,27 +100,81 @@ public:
     /**
      * This method performs processing.
      *
+     * Only connections whose socket is ready or whose timeout expired are processed. With the REST thread, only
+     * the calls into OpenThread are run.
+     *
      * @param[in]       aMainloop   A reference to OpenThread mainloop context.
      *
      */
     otbrError Process(otSysMainloopContext &aMainloop);
 
+    /**
+     * This method closes the listening sockets so that they are opened again with the current listen settings.
+     *
+     * The sockets are opened again by the next `UpdateFdSet()`, or the next iteration of the REST thread.
+     * Established connections are kept.
+     *
+     */
+    void ReopenListenFds(void);
+
 private:
+    struct ConnectionEntry
+    {
+        std::unique_ptr<Connection> mConnection;
+        TimerWheel::Handle          mTimeoutTimer;
+        uint32_t                    mClientAddress; // The IPv4 address of the client, in network byte order
+    };
+
     RestWebServer(ControllerOpenThread *aNcp);
-    otbrError UpdateConnections(fd_set &aReadFdSet);
-    void      CreateNewConnection(int32_t &aFd);
+    otbrError StartThread(void);
+    void      RunThread(std::promise<otbrError> aStarted);
+    void      UpdateTimeout(otSysMainloopContext &aMainloop);
+    otbrError ProcessSockets(void);
+    void      CloseListenFds(void);
+    void      ProcessConnection(int32_t aFd);
+    void      ProcessCallbackConnections(void);
+    void      Crawl(void);
+    void      SaveSnapshot(void);
+    bool      IsAdmitted(uint32_t aClientAddress) const;
+    void      Reject(int32_t &aFd);
+    void      CreateNewConnection(int32_t &aFd, uint32_t aClientAddress);
+    otbrError AcceptConnections(int32_t aListenFd);
     otbrError Accept(int32_t aListenFd);
     otbrError InitializeListenFd(void);
+    otbrError InitializeTcpListenFd(void);
+    otbrError InitializeUnixListenFd(void);
     bool      SetFdNonblocking(int32_t fd);
 
     // Resource handler
     Resource mResource;
+    // Bridge calling the resource handler on the mainloop from the REST thread
+    OtBridge mBridge;
+    // The REST thread, not joinable if the sockets are served by the mainloop
+    std::thread mThread;
+    // Whether the REST thread keeps running, only accessed by the REST thread
+    bool mThreadRunning;
     // Struct for server configuration
     sockaddr_in mAddress;
     // File descriptor for listening
     int32_t mListenFd;
+    // File descriptor for listening on the Unix domain socket
+    int32_t mUnixListenFd;
+    // Path the Unix domain socket is bound to
+    std::string mUnixListenPath;
     // Connection List
-    std::unordered_map<int32_t, std::unique_ptr<Connection>> mConnectionSet;
+    std::unordered_map<int32_t, ConnectionEntry> mConnectionSet;
+    // Completed connections kept for reuse
+    std::vector<std::unique_ptr<Connection>> mConnectionPool;
+    // Number of connections per client address
+    std::unordered_map<uint32_t, uint32_t> mClientConnections;
+    // Connections waiting for a diagnostic callback
+    std::unordered_set<int32_t> mCallbackConnections;
+    // Timers for connection timeouts
+    TimerWheel mTimerWheel;
+    // Timer for background diagnostic queries
+    TimerWheel::Handle mCrawlTimer;
+    // Timer for saving the resources served after a restart
+    TimerWheel::Handle mSnapshotTimer;
 };
 
 } // namespace rest
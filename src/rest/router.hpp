@@ -0,0 +1,262 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes the request router definition for RESTful HTTP server.
+ */
+
+#ifndef OTBR_REST_ROUTER_HPP_
+#define OTBR_REST_ROUTER_HPP_
+
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+#include <string.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "rest/types.hpp"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * The result of routing a request.
+ *
+ */
+enum class RouteResult : std::uint8_t
+{
+    kMatched          = 0, ///< A handler was found.
+    kNotFound         = 1, ///< No route matches the path.
+    kMethodNotAllowed = 2, ///< A route matches the path, but not the method.
+};
+
+/**
+ * This class implements a router which finds the handler of a request from its path and method.
+ *
+ * The routes are kept in a trie of path segments, built once when the routes are added. A segment of the form
+ * `{name}` matches any segment, and is reported as a path parameter. Literal segments take precedence over
+ * parameters. Empty segments are ignored, so `/node/` and `/node` match the same route.
+ *
+ */
+template <typename Handler> class Router
+{
+public:
+    /**
+     * This method adds a route.
+     *
+     * A route MUST NOT be added twice for the same method, and a parameter MUST have the same name in every
+     * route sharing it.
+     *
+     * @param[in]   aMethod     The HTTP method.
+     * @param[in]   aPattern    The path pattern, e.g. `/diagnostics/{rloc16}`.
+     * @param[in]   aHandler    The handler of the route.
+     *
+     */
+    void Add(HttpMethod aMethod, const char *aPattern, Handler aHandler)
+    {
+        Node *      node = &mRoot;
+        const char *end  = aPattern + strlen(aPattern);
+        uint8_t     bit  = GetMethodBit(aMethod);
+
+        VerifyOrDie(bit != 0, "unsupported HTTP method");
+
+        for (const char *segment = NextSegment(aPattern, end); segment != end;)
+        {
+            const char *segmentEnd = SegmentEnd(segment, end);
+            bool        isParam    = *segment == '{' && *(segmentEnd - 1) == '}';
+            std::string name       = std::string(segment, segmentEnd);
+            Node *      child      = nullptr;
+
+            if (isParam)
+            {
+                name = name.substr(1, name.size() - 2);
+            }
+
+            for (Node &candidate : node->mChildren)
+            {
+                if (candidate.mIsParam == isParam && (isParam || candidate.mSegment == name))
+                {
+                    VerifyOrDie(candidate.mSegment == name, "conflicting path parameter names");
+                    child = &candidate;
+                    break;
+                }
+            }
+
+            if (child == nullptr)
+            {
+                node->mChildren.emplace_back(name, isParam);
+                child = &node->mChildren.back();
+            }
+
+            node    = child;
+            segment = NextSegment(segmentEnd, end);
+        }
+
+        VerifyOrDie(!(node->mMethods & bit), "route added twice");
+        node->mMethods |= bit;
+        node->mHandlers[static_cast<uint8_t>(aMethod)] = aHandler;
+    }
+
+    /**
+     * This method finds the handler of a request.
+     *
+     * The query string of the url, if any, is ignored.
+     *
+     * @param[in]   aMethod     The HTTP method.
+     * @param[in]   aUrl        The request url.
+     * @param[out]  aHandler    The handler, set only if matched.
+     * @param[out]  aParams     The path parameters, set only if matched.
+     *
+     * @returns The routing result.
+     *
+     */
+    RouteResult Match(HttpMethod aMethod, const std::string &aUrl, Handler &aHandler, PathParams &aParams) const
+    {
+        size_t      queryPos = aUrl.find('?');
+        const char *path     = aUrl.c_str();
+        const char *end      = path + (queryPos == std::string::npos ? aUrl.size() : queryPos);
+        uint8_t     bit      = GetMethodBit(aMethod);
+        RouteResult result   = RouteResult::kNotFound;
+        const Node *node;
+        PathParams  params;
+
+        node = Find(mRoot, NextSegment(path, end), end, params);
+        VerifyOrExit(node != nullptr);
+        VerifyOrExit(node->mMethods & bit, result = RouteResult::kMethodNotAllowed);
+
+        aHandler = node->mHandlers[static_cast<uint8_t>(aMethod)];
+        aParams  = std::move(params);
+        result   = RouteResult::kMatched;
+
+    exit:
+        return result;
+    }
+
+private:
+    static constexpr uint8_t kNumMethods = static_cast<uint8_t>(HttpMethod::kOptions) + 1;
+
+    struct Node
+    {
+        Node(void)
+            : mIsParam(false)
+            , mMethods(0)
+            , mHandlers()
+        {
+        }
+
+        Node(const std::string &aSegment, bool aIsParam)
+            : mSegment(aSegment)
+            , mIsParam(aIsParam)
+            , mMethods(0)
+            , mHandlers()
+        {
+        }
+
+        std::string       mSegment; // The literal segment, or the parameter name
+        bool              mIsParam;
+        uint8_t           mMethods; // Bit N is set if there is a handler for method N
+        Handler           mHandlers[kNumMethods];
+        std::vector<Node> mChildren;
+    };
+
+    static uint8_t GetMethodBit(HttpMethod aMethod)
+    {
+        uint8_t method = static_cast<uint8_t>(aMethod);
+
+        return method < kNumMethods ? (1 << method) : 0;
+    }
+
+    static const char *NextSegment(const char *aPath, const char *aEnd)
+    {
+        while (aPath != aEnd && *aPath == '/')
+        {
+            ++aPath;
+        }
+
+        return aPath;
+    }
+
+    static const char *SegmentEnd(const char *aSegment, const char *aEnd)
+    {
+        while (aSegment != aEnd && *aSegment != '/')
+        {
+            ++aSegment;
+        }
+
+        return aSegment;
+    }
+
+    static const Node *Find(const Node &aNode, const char *aSegment, const char *aEnd, PathParams &aParams)
+    {
+        const Node *found = nullptr;
+        const char *segmentEnd;
+        size_t      length;
+
+        if (aSegment == aEnd)
+        {
+            ExitNow(found = (aNode.mMethods != 0) ? &aNode : nullptr);
+        }
+
+        segmentEnd = SegmentEnd(aSegment, aEnd);
+        length     = static_cast<size_t>(segmentEnd - aSegment);
+
+        for (const Node &child : aNode.mChildren)
+        {
+            if (!child.mIsParam && child.mSegment.size() == length &&
+                memcmp(child.mSegment.data(), aSegment, length) == 0)
+            {
+                found = Find(child, NextSegment(segmentEnd, aEnd), aEnd, aParams);
+                VerifyOrExit(found == nullptr);
+            }
+        }
+
+        for (const Node &child : aNode.mChildren)
+        {
+            if (child.mIsParam)
+            {
+                aParams.emplace_back(child.mSegment, std::string(aSegment, length));
+                found = Find(child, NextSegment(segmentEnd, aEnd), aEnd, aParams);
+                VerifyOrExit(found == nullptr);
+                aParams.pop_back();
+            }
+        }
+
+    exit:
+        return found;
+    }
+
+    Node mRoot;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_ROUTER_HPP_
@@ -0,0 +1,355 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the network topology model for OTBR-REST.
+ */
+
+#include "rest/topology.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+namespace rest {
+
+// The RLOC16 bits of the router id
+static const uint16_t kRouterIdMask  = 0xfc00;
+static const uint8_t  kRouterIdShift = 10;
+
+Topology::Topology(size_t aMaxTombstones)
+    : mMaxTombstones(aMaxTombstones)
+    , mNumTombstones(0)
+    , mVersion(0)
+    , mMinVersion(0)
+{
+}
+
+void Topology::SetChanged(bool aIsLink, uint32_t aKey, uint64_t &aVersion, ChangeIterator &aChangeIt)
+{
+    if (aVersion == 0)
+    {
+        aChangeIt = mChanges.insert(mChanges.end(), Change{aIsLink, aKey});
+    }
+    else
+    {
+        mChanges.splice(mChanges.end(), mChanges, aChangeIt);
+    }
+
+    aVersion = ++mVersion;
+}
+
+void Topology::Update(uint16_t aRloc16, const std::vector<otNetworkDiagTlv> &aTlvs)
+{
+    NodeEntry &           entry   = mNodes[aRloc16];
+    Node &                node    = entry.mNode;
+    bool                  changed = false;
+    std::vector<uint16_t> routers;
+    std::vector<uint16_t> children;
+    bool                  hasRoute      = false;
+    bool                  hasChildTable = false;
+
+    if (node.mVersion == 0)
+    {
+        node.mRloc16        = aRloc16;
+        node.mHasExtAddress = false;
+        node.mLeaderCost    = kUnknownLeaderCost;
+        node.mRemoved       = false;
+        changed             = true;
+    }
+    else if (node.mRemoved)
+    {
+        node.mRemoved = false;
+        --mNumTombstones;
+        changed = true;
+    }
+
+    for (const otNetworkDiagTlv &tlv : aTlvs)
+    {
+        switch (tlv.mType)
+        {
+        case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
+            if (!node.mHasExtAddress || memcmp(node.mExtAddress.m8, tlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE))
+            {
+                node.mHasExtAddress = true;
+                node.mExtAddress    = tlv.mData.mExtAddress;
+                changed             = true;
+            }
+            break;
+
+        case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
+            if (node.mLeaderCost != tlv.mData.mConnectivity.mLeaderCost)
+            {
+                node.mLeaderCost = tlv.mData.mConnectivity.mLeaderCost;
+                changed          = true;
+            }
+            break;
+
+        case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
+            hasRoute = true;
+
+            for (uint8_t i = 0; i < tlv.mData.mRoute.mRouteCount; ++i)
+            {
+                const otNetworkDiagRouteData &routeData = tlv.mData.mRoute.mRouteData[i];
+                Link                          link;
+
+                link.mFrom           = aRloc16;
+                link.mTo             = static_cast<uint16_t>(routeData.mRouterId << kRouterIdShift);
+                link.mIsChild        = false;
+                link.mLinkQualityIn  = routeData.mLinkQualityIn;
+                link.mLinkQualityOut = routeData.mLinkQualityOut;
+                link.mChildTimeout   = 0;
+
+                // Routers without a link quality are only reachable through other routers.
+                if (link.mTo != (aRloc16 & kRouterIdMask) && (link.mLinkQualityIn != 0 || link.mLinkQualityOut != 0))
+                {
+                    UpdateLink(entry, link);
+                    routers.push_back(link.mTo);
+                }
+            }
+            break;
+
+        case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
+            hasChildTable = true;
+
+            for (uint8_t i = 0; i < tlv.mData.mChildTable.mCount; ++i)
+            {
+                const otNetworkDiagChildEntry &child = tlv.mData.mChildTable.mTable[i];
+                Link                           link;
+
+                link.mFrom           = aRloc16;
+                link.mTo             = static_cast<uint16_t>((aRloc16 & kRouterIdMask) | child.mChildId);
+                link.mIsChild        = true;
+                link.mLinkQualityIn  = 0;
+                link.mLinkQualityOut = 0;
+                link.mChildTimeout   = child.mTimeout;
+
+                UpdateLink(entry, link);
+                children.push_back(link.mTo);
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    if (hasRoute)
+    {
+        SweepLinks(entry, false, routers);
+    }
+
+    if (hasChildTable)
+    {
+        SweepLinks(entry, true, children);
+    }
+
+    if (changed)
+    {
+        SetChanged(false, aRloc16, node.mVersion, entry.mChangeIt);
+    }
+
+    DropTombstones();
+}
+
+void Topology::UpdateLink(NodeEntry &aNode, const Link &aLink)
+{
+    LinkEntry &entry = mLinks[GetLinkKey(aLink.mFrom, aLink.mTo)];
+    Link &     link  = entry.mLink;
+
+    if (link.mVersion != 0 && link.mRemoved)
+    {
+        --mNumTombstones;
+    }
+    else if (link.mVersion != 0 && link.mIsChild == aLink.mIsChild && link.mLinkQualityIn == aLink.mLinkQualityIn &&
+             link.mLinkQualityOut == aLink.mLinkQualityOut && link.mChildTimeout == aLink.mChildTimeout)
+    {
+        ExitNow();
+    }
+
+    if (link.mVersion == 0 || link.mRemoved)
+    {
+        aNode.mLinks.push_back(aLink.mTo);
+    }
+
+    link.mFrom           = aLink.mFrom;
+    link.mTo             = aLink.mTo;
+    link.mIsChild        = aLink.mIsChild;
+    link.mLinkQualityIn  = aLink.mLinkQualityIn;
+    link.mLinkQualityOut = aLink.mLinkQualityOut;
+    link.mChildTimeout   = aLink.mChildTimeout;
+    link.mRemoved        = false;
+    SetChanged(true, GetLinkKey(aLink.mFrom, aLink.mTo), link.mVersion, entry.mChangeIt);
+
+exit:
+    return;
+}
+
+void Topology::SweepLinks(NodeEntry &aNode, bool aIsChild, const std::vector<uint16_t> &aKeep)
+{
+    for (auto it = aNode.mLinks.begin(); it != aNode.mLinks.end();)
+    {
+        uint32_t   key   = GetLinkKey(aNode.mNode.mRloc16, *it);
+        LinkEntry &entry = mLinks.at(key);
+
+        if (entry.mLink.mIsChild == aIsChild && std::find(aKeep.begin(), aKeep.end(), *it) == aKeep.end())
+        {
+            entry.mLink.mRemoved = true;
+            ++mNumTombstones;
+            SetChanged(true, key, entry.mLink.mVersion, entry.mChangeIt);
+            it = aNode.mLinks.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void Topology::Remove(uint16_t aRloc16)
+{
+    auto                        it = mNodes.find(aRloc16);
+    const std::vector<uint16_t> none;
+
+    VerifyOrExit(it != mNodes.end() && !it->second.mNode.mRemoved);
+
+    SweepLinks(it->second, false, none);
+    SweepLinks(it->second, true, none);
+
+    it->second.mNode.mRemoved = true;
+    ++mNumTombstones;
+    SetChanged(false, aRloc16, it->second.mNode.mVersion, it->second.mChangeIt);
+
+    DropTombstones();
+
+exit:
+    return;
+}
+
+void Topology::DropTombstones(void)
+{
+    for (auto it = mChanges.begin(); it != mChanges.end() && mNumTombstones > mMaxTombstones;)
+    {
+        bool     removed;
+        uint64_t version;
+
+        if (it->mIsLink)
+        {
+            auto link = mLinks.find(it->mKey);
+
+            removed = link->second.mLink.mRemoved;
+            version = link->second.mLink.mVersion;
+
+            if (removed)
+            {
+                mLinks.erase(link);
+            }
+        }
+        else
+        {
+            auto node = mNodes.find(static_cast<uint16_t>(it->mKey));
+
+            removed = node->second.mNode.mRemoved;
+            version = node->second.mNode.mVersion;
+
+            if (removed)
+            {
+                mNodes.erase(node);
+            }
+        }
+
+        if (removed)
+        {
+            // A client which saw an earlier version missed this removal.
+            mMinVersion = version;
+            --mNumTombstones;
+            it = mChanges.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void Topology::GetChanges(uint64_t aSince, std::vector<const Node *> &aNodes, std::vector<const Link *> &aLinks) const
+{
+    bool full = !HasChangesSince(aSince);
+    auto it   = full ? mChanges.begin() : mChanges.end();
+
+    aNodes.clear();
+    aLinks.clear();
+
+    if (!full)
+    {
+        // Find the first change after the version, the changes are in the order of their versions.
+        while (it != mChanges.begin())
+        {
+            auto     prev = std::prev(it);
+            uint64_t version =
+                prev->mIsLink ? mLinks.at(prev->mKey).mLink.mVersion : mNodes.at(prev->mKey).mNode.mVersion;
+
+            if (version <= aSince)
+            {
+                break;
+            }
+
+            it = prev;
+        }
+    }
+
+    for (; it != mChanges.end(); ++it)
+    {
+        if (it->mIsLink)
+        {
+            const Link &link = mLinks.at(it->mKey).mLink;
+
+            if (!full || !link.mRemoved)
+            {
+                aLinks.push_back(&link);
+            }
+        }
+        else
+        {
+            const Node &node = mNodes.at(static_cast<uint16_t>(it->mKey)).mNode;
+
+            if (!full || !node.mRemoved)
+            {
+                aNodes.push_back(&node);
+            }
+        }
+    }
+}
+
+} // namespace rest
+} // namespace otbr
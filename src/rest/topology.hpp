@@ -0,0 +1,197 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of the network topology model for OTBR-REST.
+ */
+
+#ifndef OTBR_REST_TOPOLOGY_HPP_
+#define OTBR_REST_TOPOLOGY_HPP_
+
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "openthread/netdiag.h"
+
+namespace otbr {
+namespace rest {
+
+/**
+ * This class implements a model of the mesh topology built from network diagnostics.
+ *
+ * The nodes are the nodes which reported diagnostics, the links are reported by the node they start from: links to
+ * neighbor routers come from the Route TLV and links to children from the Child Table TLV. Every change of a node or
+ * a link is tagged with a new version of the model, so the changes since a version could be listed without visiting
+ * the unchanged parts. Removed nodes and links are kept as tombstones for delta queries, a limited number of them.
+ *
+ */
+class Topology
+{
+public:
+    /**
+     * This structure represents a node.
+     *
+     */
+    struct Node
+    {
+        uint16_t     mRloc16;        ///< The RLOC16 of the node.
+        bool         mHasExtAddress; ///< Whether the extended address is known.
+        otExtAddress mExtAddress;    ///< The extended address.
+        uint8_t      mLeaderCost;    ///< The cost to the leader, `kUnknownLeaderCost` if not reported.
+        bool         mRemoved;       ///< Whether the node is a tombstone.
+        uint64_t     mVersion;       ///< The version of the last change.
+    };
+
+    /**
+     * This structure represents a link from a node to a neighbor.
+     *
+     */
+    struct Link
+    {
+        uint16_t mFrom;           ///< The RLOC16 of the node which reported the link.
+        uint16_t mTo;             ///< The RLOC16 of the neighbor.
+        bool     mIsChild;        ///< Whether the neighbor is a child of the node.
+        uint8_t  mLinkQualityIn;  ///< The incoming link quality, for a router neighbor.
+        uint8_t  mLinkQualityOut; ///< The outgoing link quality, for a router neighbor.
+        uint32_t mChildTimeout;   ///< The timeout of the child, for a child neighbor.
+        bool     mRemoved;        ///< Whether the link is a tombstone.
+        uint64_t mVersion;        ///< The version of the last change.
+    };
+
+    static const uint8_t kUnknownLeaderCost = 0xff; ///< The leader cost of a node which did not report it.
+
+    /**
+     * The constructor initializes an empty topology at version zero.
+     *
+     * @param[in]   aMaxTombstones  The maximum number of tombstones kept for delta queries.
+     *
+     */
+    explicit Topology(size_t aMaxTombstones = kDefaultMaxTombstones);
+
+    /**
+     * This method updates a node and the links it reports from its diagnostics.
+     *
+     * Links a TLV type reports are only replaced when the diagnostics carry that TLV type.
+     *
+     * @param[in]   aRloc16     The RLOC16 of the node.
+     * @param[in]   aTlvs       The diagnostic TLVs of the node.
+     *
+     */
+    void Update(uint16_t aRloc16, const std::vector<otNetworkDiagTlv> &aTlvs);
+
+    /**
+     * This method removes a node and the links it reported.
+     *
+     * @param[in]   aRloc16     The RLOC16 of the node.
+     *
+     */
+    void Remove(uint16_t aRloc16);
+
+    /**
+     * This method returns the current version of the topology.
+     *
+     */
+    uint64_t GetVersion(void) const { return mVersion; }
+
+    /**
+     * This method indicates whether the changes since a version could be listed.
+     *
+     * @param[in]   aSince  The version, zero for a client which has not seen the topology yet.
+     *
+     * @retval  true    The changes could be listed.
+     * @retval  false   @p aSince is zero, or tombstones of removals after it were dropped, the whole topology is
+     *                  needed.
+     *
+     */
+    bool HasChangesSince(uint64_t aSince) const { return aSince != 0 && aSince >= mMinVersion; }
+
+    /**
+     * This method lists the nodes and links changed since a version, including tombstones.
+     *
+     * When the changes are not available (see `HasChangesSince()`), every node and link but tombstones is listed.
+     * Items are listed from the least recently changed.
+     *
+     * @param[in]   aSince  The version.
+     * @param[out]  aNodes  The nodes.
+     * @param[out]  aLinks  The links.
+     *
+     */
+    void GetChanges(uint64_t aSince, std::vector<const Node *> &aNodes, std::vector<const Link *> &aLinks) const;
+
+private:
+    static const size_t kDefaultMaxTombstones = 1024;
+
+    struct Change
+    {
+        bool     mIsLink;
+        uint32_t mKey;
+    };
+
+    typedef std::list<Change>::iterator ChangeIterator;
+
+    struct NodeEntry
+    {
+        Node                  mNode;
+        ChangeIterator        mChangeIt;
+        std::vector<uint16_t> mLinks; // The neighbors the node reported links to.
+    };
+
+    struct LinkEntry
+    {
+        Link           mLink;
+        ChangeIterator mChangeIt;
+    };
+
+    static uint32_t GetLinkKey(uint16_t aFrom, uint16_t aTo) { return (static_cast<uint32_t>(aFrom) << 16) | aTo; }
+
+    void SetChanged(bool aIsLink, uint32_t aKey, uint64_t &aVersion, ChangeIterator &aChangeIt);
+    void UpdateLink(NodeEntry &aNode, const Link &aLink);
+    void SweepLinks(NodeEntry &aNode, bool aIsChild, const std::vector<uint16_t> &aKeep);
+    void DropTombstones(void);
+
+    size_t   mMaxTombstones;
+    size_t   mNumTombstones;
+    uint64_t mVersion;
+    uint64_t mMinVersion;
+
+    std::unordered_map<uint16_t, NodeEntry> mNodes;
+    std::unordered_map<uint32_t, LinkEntry> mLinks;
+
+    // Nodes and links ordered from the least recently changed
+    std::list<Change> mChanges;
+};
+
+} // namespace rest
+} // namespace otbr
+
+#endif // OTBR_REST_TOPOLOGY_HPP_
@@ -35,7 +35,9 @@
 #define OTBR_REST_TYPES_HPP_
 
 #include <chrono>
+#include <functional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "openthread/netdiag.h"
@@ -59,10 +61,12 @@ enum class HttpMethod : std::uint8_t
 enum class HttpStatusCode : std::uint16_t
 {
     kStatusOk                  = 200,
+    kStatusBadRequest          = 400,
     kStatusResourceNotFound    = 404,
     kStatusMethodNotAllowed    = 405,
     kStatusRequestTimeout      = 408,
     kStatusInternalServerError = 500,
+    kStatusServiceUnavailable  = 503,
 };
 
 enum class PostError : std::uint8_t
@@ -82,6 +86,8 @@ enum class ConnectionState : std::uint8_t
     kWriteTimeout  = 5, ///< Reach write timeout
     kInternalError = 6, ///< Occur internal call error
     kComplete      = 7, ///< No longer need to be processed
+    kIdleWait      = 8, ///< Wait for the next request on a persistent connection
+    kHandleWait    = 9, ///< Wait for the resource handler running on the mainloop
 
 };
 struct NodeInfo
@@ -96,11 +102,35 @@ struct NodeInfo
     std::string    mNetworkName;
 };
 
-struct DiagInfo
-{
-    steady_clock::time_point      mStartTime;
-    std::vector<otNetworkDiagTlv> mDiagContent;
-};
+/**
+ * This type represents a set of network diagnostic TLV types, bit N selects TLV type N.
+ *
+ */
+typedef uint32_t DiagTlvMask;
+
+static const DiagTlvMask kDiagTlvMaskAll = 0xffffffff; ///< Selects every TLV type.
+
+/**
+ * This type represents the parameters extracted from a request path, as name and value pairs.
+ *
+ */
+typedef std::vector<std::pair<std::string, std::string>> PathParams;
+
+/**
+ * This type represents a function producing a response body part by part, see `Response::SetChunked()`.
+ *
+ * @param[inout]    aChunk  An empty string to append the next part of the body to.
+ *
+ * @returns Whether the body is complete.
+ *
+ */
+typedef std::function<bool(std::string &aChunk)> ChunkProducer;
+
+/**
+ * The preferred size of a part of a chunked response body, in bytes.
+ *
+ */
+static const size_t kChunkSize = 16 * 1024;
 
 } // namespace rest
 } // namespace otbr
@@ -0,0 +1,154 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a monotonic arena allocator.
+ */
+
+#include "utils/arena.hpp"
+
+namespace otbr {
+
+namespace Utils {
+
+constexpr size_t Arena::kDefaultBlockSize;
+
+Arena::Arena(size_t aBlockSize)
+    : mBlocks(nullptr)
+    , mCursor(nullptr)
+    , mEnd(nullptr)
+    , mBlockSize(aBlockSize)
+    , mBuffer(nullptr)
+    , mBufferSize(0)
+{
+}
+
+Arena::Arena(void *aBuffer, size_t aSize)
+    : mBlocks(nullptr)
+    , mCursor(static_cast<uint8_t *>(aBuffer))
+    , mEnd(static_cast<uint8_t *>(aBuffer) + aSize)
+    , mBlockSize(aSize * 2)
+    , mBuffer(static_cast<uint8_t *>(aBuffer))
+    , mBufferSize(aSize)
+{
+}
+
+Arena::~Arena(void)
+{
+    while (mBlocks != nullptr)
+    {
+        Block *next = mBlocks->mNext;
+
+        ::operator delete(mBlocks);
+        mBlocks = next;
+    }
+}
+
+void Arena::AddBlock(size_t aSize)
+{
+    Block *block = static_cast<Block *>(::operator new(sizeof(Block) + aSize));
+
+    block->mNext = mBlocks;
+    block->mSize = aSize;
+    mBlocks      = block;
+    mCursor      = reinterpret_cast<uint8_t *>(block + 1);
+    mEnd         = mCursor + aSize;
+}
+
+void *Arena::Allocate(size_t aSize, size_t aAlignment)
+{
+    uintptr_t padding = (aAlignment - reinterpret_cast<uintptr_t>(mCursor) % aAlignment) % aAlignment;
+    void *    memory;
+
+    if (mCursor == nullptr || static_cast<size_t>(mEnd - mCursor) < padding + aSize)
+    {
+        // Later blocks grow geometrically, so a large request does not chain many small blocks.
+        size_t size = (mBlocks == nullptr) ? mBlockSize : mBlocks->mSize * 2;
+
+        if (size < aSize + aAlignment)
+        {
+            size = aSize + aAlignment;
+        }
+
+        AddBlock(size);
+        padding = (aAlignment - reinterpret_cast<uintptr_t>(mCursor) % aAlignment) % aAlignment;
+    }
+
+    memory = mCursor + padding;
+    mCursor += padding + aSize;
+
+    return memory;
+}
+
+void Arena::Reset(void)
+{
+    if (mBlocks != nullptr && (mBlocks->mNext != nullptr || mBuffer != nullptr))
+    {
+        // The buffer counts too, the next allocations of the same size then fit in the new block.
+        size_t total = mBufferSize;
+
+        mBuffer     = nullptr;
+        mBufferSize = 0;
+
+        while (mBlocks != nullptr)
+        {
+            Block *next = mBlocks->mNext;
+
+            total += mBlocks->mSize;
+            ::operator delete(mBlocks);
+            mBlocks = next;
+        }
+
+        AddBlock(total);
+    }
+    else if (mBlocks != nullptr)
+    {
+        mCursor = reinterpret_cast<uint8_t *>(mBlocks + 1);
+    }
+    else if (mBuffer != nullptr)
+    {
+        mCursor = mBuffer;
+    }
+}
+
+size_t Arena::GetBlockCount(void) const
+{
+    size_t count = 0;
+
+    for (const Block *block = mBlocks; block != nullptr; block = block->mNext)
+    {
+        ++count;
+    }
+
+    return count;
+}
+
+} // namespace Utils
+
+} // namespace otbr
@@ -0,0 +1,201 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of a monotonic arena allocator.
+ */
+
+#ifndef OTBR_UTILS_ARENA_HPP_
+#define OTBR_UTILS_ARENA_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <new>
+#include <string>
+
+namespace otbr {
+
+namespace Utils {
+
+/**
+ * This class implements a monotonic arena, which hands out memory by bumping a pointer and releases all of it at
+ * once.
+ *
+ * Memory is taken from the heap in blocks. When a reset finds that more than one block was needed, the blocks are
+ * replaced by one block as large as all of them, so an arena reset between requests of similar sizes stops
+ * allocating from the heap after the first one.
+ *
+ * An arena may also start with a buffer of its owner, which is used before any heap block.
+ *
+ */
+class Arena
+{
+public:
+    /**
+     * The constructor initializes an arena, without allocating memory.
+     *
+     * @param[in]   aBlockSize  The size of the first block in bytes.
+     *
+     */
+    explicit Arena(size_t aBlockSize = kDefaultBlockSize);
+
+    /**
+     * The constructor initializes an arena allocating from a buffer first, without allocating memory.
+     *
+     * Once the arena needed heap blocks, it keeps using them after a reset and the buffer is left unused.
+     *
+     * @param[in]   aBuffer     The buffer, which MUST outlive the arena.
+     * @param[in]   aSize       The size of the buffer in bytes.
+     *
+     */
+    Arena(void *aBuffer, size_t aSize);
+
+    ~Arena(void);
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+
+    /**
+     * This method allocates memory from the arena.
+     *
+     * The memory is valid until the arena is reset or destroyed.
+     *
+     * @param[in]   aSize       The size in bytes.
+     * @param[in]   aAlignment  The alignment, which MUST be a power of two.
+     *
+     * @returns A pointer to the memory.
+     *
+     */
+    void *Allocate(size_t aSize, size_t aAlignment = alignof(max_align_t));
+
+    /**
+     * This method releases all the memory allocated from the arena, keeping a block for the next allocations.
+     *
+     */
+    void Reset(void);
+
+    /**
+     * This method returns the number of blocks the arena takes from the heap.
+     *
+     * @returns The number of blocks.
+     *
+     */
+    size_t GetBlockCount(void) const;
+
+private:
+    static constexpr size_t kDefaultBlockSize = 2048;
+
+    struct Block
+    {
+        Block *mNext;
+        size_t mSize;
+    };
+
+    void AddBlock(size_t aSize);
+
+    Block *  mBlocks;
+    uint8_t *mCursor;
+    uint8_t *mEnd;
+    size_t   mBlockSize;
+    uint8_t *mBuffer;
+    size_t   mBufferSize;
+};
+
+/**
+ * This class implements an allocator for the standard containers, which allocates from an `Arena`.
+ *
+ * Deallocation is a no-op, the memory is released when the arena is reset. A default constructed allocator has no
+ * arena and uses the heap, so containers of it may be default constructed.
+ *
+ */
+template <typename T> class ArenaAllocator
+{
+public:
+    typedef T value_type;
+
+    ArenaAllocator(void)
+        : mArena(nullptr)
+    {
+    }
+
+    explicit ArenaAllocator(Arena &aArena)
+        : mArena(&aArena)
+    {
+    }
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &aOther)
+        : mArena(aOther.GetArena())
+    {
+    }
+
+    T *allocate(size_t aCount)
+    {
+        return static_cast<T *>(mArena != nullptr ? mArena->Allocate(aCount * sizeof(T), alignof(T))
+                                                  : ::operator new(aCount * sizeof(T)));
+    }
+
+    void deallocate(T *aPointer, size_t)
+    {
+        if (mArena == nullptr)
+        {
+            ::operator delete(aPointer);
+        }
+    }
+
+    Arena *GetArena(void) const { return mArena; }
+
+    template <typename U> bool operator==(const ArenaAllocator<U> &aOther) const
+    {
+        return mArena == aOther.GetArena();
+    }
+
+    template <typename U> bool operator!=(const ArenaAllocator<U> &aOther) const
+    {
+        return mArena != aOther.GetArena();
+    }
+
+private:
+    Arena *mArena;
+};
+
+/**
+ * This type represents a string allocated from an `Arena`.
+ *
+ */
+typedef std::basic_string<char, std::char_traits<char>, ArenaAllocator<char>> ArenaString;
+
+} // namespace Utils
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_ARENA_HPP_
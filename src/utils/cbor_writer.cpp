@@ -0,0 +1,111 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a streaming CBOR writer.
+ */
+
+#include "utils/cbor_writer.hpp"
+
+#include <string.h>
+
+namespace otbr {
+
+namespace Utils {
+
+void CborWriter::WriteHead(uint8_t aMajorType, uint64_t aValue)
+{
+    uint8_t initial = static_cast<uint8_t>(aMajorType << 5);
+    int     numBytes;
+
+    // The argument is held in the initial byte when small enough, or follows it in 1, 2, 4 or 8 bytes big-endian.
+    if (aValue < 24)
+    {
+        numBytes = 0;
+        initial |= static_cast<uint8_t>(aValue);
+    }
+    else if (aValue <= UINT8_MAX)
+    {
+        numBytes = 1;
+        initial |= 24;
+    }
+    else if (aValue <= UINT16_MAX)
+    {
+        numBytes = 2;
+        initial |= 25;
+    }
+    else if (aValue <= UINT32_MAX)
+    {
+        numBytes = 4;
+        initial |= 26;
+    }
+    else
+    {
+        numBytes = 8;
+        initial |= 27;
+    }
+
+    mBuffer += static_cast<char>(initial);
+
+    for (int i = numBytes - 1; i >= 0; i--)
+    {
+        mBuffer += static_cast<char>((aValue >> (8 * i)) & 0xff);
+    }
+}
+
+void CborWriter::Int(int64_t aValue)
+{
+    if (aValue >= 0)
+    {
+        WriteHead(kMajorUnsigned, static_cast<uint64_t>(aValue));
+    }
+    else
+    {
+        // A negative integer n is encoded as -1 - n, which is the bitwise complement.
+        WriteHead(kMajorNegative, ~static_cast<uint64_t>(aValue));
+    }
+}
+
+void CborWriter::String(const char *aString)
+{
+    size_t length = strlen(aString);
+
+    WriteHead(kMajorText, length);
+    mBuffer.append(aString, length);
+}
+
+void CborWriter::Bytes(const uint8_t *aBytes, size_t aLength)
+{
+    WriteHead(kMajorBytes, aLength);
+    mBuffer.append(reinterpret_cast<const char *>(aBytes), aLength);
+}
+
+} // namespace Utils
+
+} // namespace otbr
@@ -0,0 +1,194 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of a streaming CBOR writer.
+ */
+
+#ifndef OTBR_UTILS_CBOR_WRITER_HPP_
+#define OTBR_UTILS_CBOR_WRITER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+namespace otbr {
+
+namespace Utils {
+
+/**
+ * This class implements a writer which serializes CBOR (RFC 8949) data items directly into a string buffer.
+ *
+ * The writer has the same interface as `JsonWriter`, so a document could be written in either format by the same
+ * code. Maps and arrays are written with indefinite lengths, which lets them be written without knowing the number
+ * of members in advance. Byte arrays are written as CBOR byte strings.
+ *
+ * The writer does not check the structure of the document, a key MUST be written before each value in a map.
+ *
+ */
+class CborWriter
+{
+public:
+    /**
+     * The constructor initializes a CBOR writer appending to a buffer.
+     *
+     * @param[inout]    aBuffer     The buffer to append the CBOR data to.
+     *
+     */
+    explicit CborWriter(std::string &aBuffer)
+        : mBuffer(aBuffer)
+    {
+    }
+
+    /**
+     * This method begins a CBOR map.
+     *
+     */
+    void BeginObject(void) { mBuffer += static_cast<char>(kIndefiniteMap); }
+
+    /**
+     * This method ends a CBOR map.
+     *
+     */
+    void EndObject(void) { mBuffer += static_cast<char>(kBreak); }
+
+    /**
+     * This method begins a CBOR array.
+     *
+     */
+    void BeginArray(void) { mBuffer += static_cast<char>(kIndefiniteArray); }
+
+    /**
+     * This method ends a CBOR array.
+     *
+     */
+    void EndArray(void) { mBuffer += static_cast<char>(kBreak); }
+
+    /**
+     * This method writes the key of the next member in a map.
+     *
+     * @param[in]   aKey    The key.
+     *
+     */
+    void Key(const char *aKey) { String(aKey); }
+
+    /**
+     * This method writes an unsigned integer.
+     *
+     * @param[in]   aValue  The value.
+     *
+     */
+    void Uint(uint64_t aValue) { WriteHead(kMajorUnsigned, aValue); }
+
+    /**
+     * This method writes a signed integer.
+     *
+     * @param[in]   aValue  The value.
+     *
+     */
+    void Int(int64_t aValue);
+
+    /**
+     * This method writes a boolean.
+     *
+     * @param[in]   aValue  The value.
+     *
+     */
+    void Bool(bool aValue) { mBuffer += static_cast<char>(aValue ? kTrue : kFalse); }
+
+    /**
+     * This method writes a text string.
+     *
+     * @param[in]   aString     A null-terminated UTF-8 string.
+     *
+     */
+    void String(const char *aString);
+
+    /**
+     * This method writes a byte string.
+     *
+     * @param[in]   aBytes      A pointer to the bytes.
+     * @param[in]   aLength     The number of bytes.
+     *
+     */
+    void Bytes(const uint8_t *aBytes, size_t aLength);
+
+    /**
+     * This method writes a map member whose value is an unsigned integer.
+     *
+     * @param[in]   aKey    The key.
+     * @param[in]   aValue  The value.
+     *
+     */
+    void UintMember(const char *aKey, uint64_t aValue)
+    {
+        Key(aKey);
+        Uint(aValue);
+    }
+
+    /**
+     * This method writes a map member whose value is a text string.
+     *
+     * @param[in]   aKey    The key.
+     * @param[in]   aValue  A null-terminated UTF-8 string.
+     *
+     */
+    void StringMember(const char *aKey, const char *aValue)
+    {
+        Key(aKey);
+        String(aValue);
+    }
+
+private:
+    enum : uint8_t
+    {
+        kMajorUnsigned   = 0,
+        kMajorNegative   = 1,
+        kMajorBytes      = 2,
+        kMajorText       = 3,
+        kIndefiniteArray = 0x9f,
+        kIndefiniteMap   = 0xbf,
+        kFalse           = 0xf4,
+        kTrue            = 0xf5,
+        kBreak           = 0xff,
+    };
+
+    void WriteHead(uint8_t aMajorType, uint64_t aValue);
+
+    std::string &mBuffer;
+};
+
+} // namespace Utils
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_CBOR_WRITER_HPP_
@@ -35,30 +35,110 @@
 
 namespace otbr {
 
+namespace {
+
+/**
+ * The slicing-by-8 tables of a polynomial, `mSlices[k][n]` is the CRC of byte `n` followed by `k` zero bytes.
+ *
+ */
+struct Crc16Table
+{
+    uint16_t mSlices[8][256];
+};
+
+template <size_t... kIndices> struct IndexSequence
+{
+};
+
+template <typename aFirst, typename aSecond> struct ConcatIndexSequence;
+
+template <size_t... kFirst, size_t... kSecond>
+struct ConcatIndexSequence<IndexSequence<kFirst...>, IndexSequence<kSecond...>>
+{
+    typedef IndexSequence<kFirst..., (sizeof...(kFirst) + kSecond)...> Type;
+};
+
+// Split in halves so that the template recursion depth is logarithmic in the table size.
+template <size_t kSize> struct MakeIndexSequence
+{
+    typedef typename ConcatIndexSequence<typename MakeIndexSequence<kSize / 2>::Type,
+                                         typename MakeIndexSequence<kSize - kSize / 2>::Type>::Type Type;
+};
+
+template <> struct MakeIndexSequence<0>
+{
+    typedef IndexSequence<> Type;
+};
+
+template <> struct MakeIndexSequence<1>
+{
+    typedef IndexSequence<0> Type;
+};
+
+constexpr uint16_t ShiftBit(uint16_t aCrc, uint16_t aPolynomial)
+{
+    return (aCrc & 0x8000) ? static_cast<uint16_t>(static_cast<uint16_t>(aCrc << 1) ^ aPolynomial)
+                           : static_cast<uint16_t>(aCrc << 1);
+}
+
+constexpr uint16_t ShiftBits(uint16_t aCrc, uint16_t aPolynomial, uint8_t aBits)
+{
+    return aBits == 0 ? aCrc : ShiftBits(ShiftBit(aCrc, aPolynomial), aPolynomial, aBits - 1);
+}
+
+constexpr uint16_t ShiftByte(uint16_t aPolynomial, uint8_t aByte)
+{
+    return ShiftBits(static_cast<uint16_t>(aByte << 8), aPolynomial, 8);
+}
+
+constexpr uint16_t ShiftZeroByte(uint16_t aPolynomial, uint16_t aCrc)
+{
+    return static_cast<uint16_t>(aCrc << 8) ^ ShiftByte(aPolynomial, static_cast<uint8_t>(aCrc >> 8));
+}
+
+constexpr uint16_t Slice(uint16_t aPolynomial, size_t aSlice, uint8_t aByte)
+{
+    return aSlice == 0 ? ShiftByte(aPolynomial, aByte)
+                       : ShiftZeroByte(aPolynomial, Slice(aPolynomial, aSlice - 1, aByte));
+}
+
+template <size_t... kIndices> constexpr Crc16Table MakeTable(uint16_t aPolynomial, IndexSequence<kIndices...>)
+{
+    return Crc16Table{{Slice(aPolynomial, kIndices / 256, static_cast<uint8_t>(kIndices % 256))...}};
+}
+
+constexpr Crc16Table kCcittTable = MakeTable(Crc16::kCcitt, MakeIndexSequence<8 * 256>::Type());
+constexpr Crc16Table kAnsiTable  = MakeTable(Crc16::kAnsi, MakeIndexSequence<8 * 256>::Type());
+
+static_assert(kCcittTable.mSlices[0][1] == Crc16::kCcitt, "CRC16-CCITT table is not generated correctly");
+static_assert(kAnsiTable.mSlices[0][1] == Crc16::kAnsi, "CRC16-ANSI table is not generated correctly");
+
+} // namespace
+
 Crc16::Crc16(Polynomial aPolynomial)
+    : mTable(aPolynomial == kCcitt ? kCcittTable.mSlices : kAnsiTable.mSlices)
 {
-    mPolynomial = static_cast<uint16_t>(aPolynomial);
     Init();
 }
 
-void Crc16::Update(uint8_t aByte)
+void Crc16::Update(const uint8_t *aBuffer, size_t aLength)
 {
-    uint8_t i;
+    uint16_t crc = mCrc;
+
+    for (; aLength >= 8; aBuffer += 8, aLength -= 8)
+    {
+        // The register overlaps the first two bytes, every byte is then looked up by the number of bytes after it.
+        crc = crc ^ static_cast<uint16_t>(aBuffer[0] << 8 | aBuffer[1]);
+        crc = mTable[7][crc >> 8] ^ mTable[6][crc & 0xff] ^ mTable[5][aBuffer[2]] ^ mTable[4][aBuffer[3]] ^
+              mTable[3][aBuffer[4]] ^ mTable[2][aBuffer[5]] ^ mTable[1][aBuffer[6]] ^ mTable[0][aBuffer[7]];
+    }
 
-    mCrc = mCrc ^ static_cast<uint16_t>(aByte << 8);
-    i    = 8;
+    mCrc = crc;
 
-    do
+    for (; aLength > 0; aBuffer++, aLength--)
     {
-        if (mCrc & 0x8000)
-        {
-            mCrc = static_cast<uint16_t>(mCrc << 1) ^ mPolynomial;
-        }
-        else
-        {
-            mCrc = static_cast<uint16_t>(mCrc << 1);
-        }
-    } while (--i);
+        Update(*aBuffer);
+    }
 }
 
 } // namespace otbr
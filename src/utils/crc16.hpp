@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
 #include <stdint.h>
 
 namespace otbr {
@@ -67,13 +68,24 @@ public:
      */
     void Init(void) { mCrc = 0; }
 
-    /*c*
+    /**
      * This method feeds a byte value into the CRC16 computation.
      *
      * @param[in]  aByte  The byte value.
      *
      */
-    void Update(uint8_t aByte);
+    void Update(uint8_t aByte) { mCrc = static_cast<uint16_t>(mCrc << 8) ^ mTable[0][(mCrc >> 8) ^ aByte]; }
+
+    /**
+     * This method feeds a buffer into the CRC16 computation.
+     *
+     * The buffer is processed 8 bytes at a time with the slicing-by-8 tables of the polynomial.
+     *
+     * @param[in]  aBuffer  A pointer to the buffer.
+     * @param[in]  aLength  The length of the buffer in bytes.
+     *
+     */
+    void Update(const uint8_t *aBuffer, size_t aLength);
 
     /**
      * This method gets the current CRC16 value.
@@ -84,7 +96,7 @@ public:
     uint16_t Get(void) const { return mCrc; }
 
 private:
-    uint16_t mPolynomial;
+    const uint16_t (*mTable)[256];
     uint16_t mCrc;
 };
 
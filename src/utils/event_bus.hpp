@@ -0,0 +1,221 @@
+/*
+ *    Copyright (c) 2017, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * This file includes definitions for a typed event bus.
+ */
+
+#ifndef OTBR_UTILS_EVENT_BUS_HPP_
+#define OTBR_UTILS_EVENT_BUS_HPP_
+
+#include "openthread-br/config.h"
+
+#include <tuple>
+#include <utility>
+
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+/**
+ * This class implements a single event with typed arguments.
+ *
+ * Handlers are kept in a fixed array in registration order, so registering and emitting never allocates.
+ *
+ * @tparam  aArgs   The types of the arguments passed to the handlers.
+ *
+ */
+template <typename... aArgs> class Event
+{
+public:
+    /**
+     * This function pointer will be called when the event is emitted.
+     *
+     * @param[in]   aContext    A pointer to application-specific context.
+     * @param[in]   aArguments  The arguments associated with this event.
+     *
+     */
+    typedef void (*Callback)(void *aContext, aArgs... aArguments);
+
+    /**
+     * The maximum number of handlers of an event.
+     *
+     */
+    static const uint8_t kMaxHandlers = 4;
+
+    /**
+     * The constructor of an event without handlers.
+     *
+     */
+    Event(void)
+        : mNumHandlers(0)
+    {
+    }
+
+    /**
+     * This method registers a handler.
+     *
+     * It is a programming error to register more than `kMaxHandlers` handlers.
+     *
+     * @param[in]   aCallback   The function pointer to be called.
+     * @param[in]   aContext    A pointer to application-specific context.
+     *
+     */
+    void On(Callback aCallback, void *aContext)
+    {
+        assert(aCallback != nullptr);
+        VerifyOrDie(mNumHandlers < kMaxHandlers, "Too many event handlers");
+
+        mHandlers[mNumHandlers].mCallback = aCallback;
+        mHandlers[mNumHandlers].mContext  = aContext;
+        mNumHandlers++;
+    }
+
+    /**
+     * This method deregisters the first handler registered with @p aCallback and @p aContext.
+     *
+     * @param[in]   aCallback   The function pointer to be called.
+     * @param[in]   aContext    A pointer to application-specific context.
+     *
+     */
+    void Off(Callback aCallback, void *aContext)
+    {
+        for (uint8_t i = 0; i < mNumHandlers; i++)
+        {
+            if (mHandlers[i].mCallback == aCallback && mHandlers[i].mContext == aContext)
+            {
+                for (mNumHandlers--; i < mNumHandlers; i++)
+                {
+                    mHandlers[i] = mHandlers[i + 1];
+                }
+                break;
+            }
+        }
+    }
+
+    /**
+     * This method calls the handlers in registration order.
+     *
+     * @param[in]   aArguments  The arguments associated with this event.
+     *
+     */
+    void Emit(aArgs... aArguments) const
+    {
+        for (uint8_t i = 0; i < mNumHandlers; i++)
+        {
+            mHandlers[i].mCallback(mHandlers[i].mContext, aArguments...);
+        }
+    }
+
+private:
+    struct Handler
+    {
+        Callback mCallback;
+        void *   mContext;
+    };
+
+    Handler mHandlers[kMaxHandlers];
+    uint8_t mNumHandlers;
+};
+
+/**
+ * This class implements an event bus whose events are identified at compile time.
+ *
+ * The event id is the index of its `Event` in @p aEvents, so dispatching is a direct member access and the handler
+ * and argument types are checked by the compiler.
+ *
+ * @tparam  aEvents     The `Event` types, indexed by event id.
+ *
+ */
+template <typename... aEvents> class EventBus
+{
+public:
+    /**
+     * The number of events.
+     *
+     */
+    static const size_t kNumEvents = sizeof...(aEvents);
+
+    /**
+     * The `Event` type of @p kEvent.
+     *
+     */
+    template <int kEvent> using EventType = typename std::tuple_element<kEvent, std::tuple<aEvents...>>::type;
+
+    /**
+     * This method registers an event handler for @p kEvent.
+     *
+     * @tparam      kEvent      The event id.
+     * @param[in]   aCallback   The function pointer to be called.
+     * @param[in]   aContext    A pointer to application-specific context.
+     *
+     */
+    template <int kEvent> void On(typename EventType<kEvent>::Callback aCallback, void *aContext)
+    {
+        std::get<kEvent>(mEvents).On(aCallback, aContext);
+    }
+
+    /**
+     * This method deregisters an event handler for @p kEvent.
+     *
+     * @tparam      kEvent      The event id.
+     * @param[in]   aCallback   The function pointer to be called.
+     * @param[in]   aContext    A pointer to application-specific context.
+     *
+     */
+    template <int kEvent> void Off(typename EventType<kEvent>::Callback aCallback, void *aContext)
+    {
+        std::get<kEvent>(mEvents).Off(aCallback, aContext);
+    }
+
+    /**
+     * This method emits @p kEvent.
+     *
+     * @tparam      kEvent      The event id.
+     * @param[in]   aArguments  The arguments associated with this event.
+     *
+     */
+    template <int kEvent, typename... aArgs> void Emit(aArgs &&... aArguments) const
+    {
+        std::get<kEvent>(mEvents).Emit(std::forward<aArgs>(aArguments)...);
+    }
+
+private:
+    std::tuple<aEvents...> mEvents;
+};
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_EVENT_BUS_HPP_
@@ -0,0 +1,233 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a filter of IEEE 802.15.4 frames.
+ */
+
+#include "utils/frame_filter.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <sstream>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+namespace Utils {
+
+otbrError FrameFilter::Parse(const char *aExpression)
+{
+    otbrError                error = OTBR_ERROR_NONE;
+    std::vector<Instruction> instructions;
+    std::istringstream       stream(aExpression != nullptr ? aExpression : "");
+    std::string              term;
+
+    while (stream >> term)
+    {
+        Instruction instruction;
+
+        SuccessOrExit(error = ParseTerm(term, instruction));
+        instructions.push_back(instruction);
+    }
+
+    mInstructions.swap(instructions);
+
+exit:
+    return error;
+}
+
+bool FrameFilter::Match(const uint8_t *aPsdu, uint16_t aLength, int8_t aRssi, bool aIsTx) const
+{
+    bool match = true;
+
+    for (const Instruction &instruction : mInstructions)
+    {
+        int32_t value = 0;
+
+        switch (instruction.mField)
+        {
+        case kFieldByte:
+            VerifyOrExit(instruction.mOffset < aLength, match = false);
+            value = aPsdu[instruction.mOffset] & instruction.mMask;
+            break;
+        case kFieldLength:
+            value = aLength;
+            break;
+        case kFieldRssi:
+            value = aRssi;
+            break;
+        case kFieldDirection:
+            value = aIsTx ? 1 : 0;
+            break;
+        }
+
+        switch (instruction.mOperator)
+        {
+        case kOperatorEqual:
+            match = (value == instruction.mValue);
+            break;
+        case kOperatorNotEqual:
+            match = (value != instruction.mValue);
+            break;
+        case kOperatorGreaterOrEqual:
+            match = (value >= instruction.mValue);
+            break;
+        case kOperatorLessOrEqual:
+            match = (value <= instruction.mValue);
+            break;
+        }
+
+        VerifyOrExit(match);
+    }
+
+exit:
+    return match;
+}
+
+otbrError FrameFilter::ParseTerm(const std::string &aTerm, Instruction &aInstruction)
+{
+    static const char *const kFrameTypes[] = {"beacon", "data", "ack", "cmd"};
+
+    otbrError   error = OTBR_ERROR_INVALID_ARGS;
+    size_t      position;
+    size_t      operatorLength;
+    std::string field;
+    std::string operand;
+    long        number;
+
+    aInstruction.mOperator = kOperatorEqual;
+    aInstruction.mMask     = 0xff;
+    aInstruction.mOffset   = 0;
+
+    if (aTerm == "rx" || aTerm == "tx")
+    {
+        aInstruction.mField = kFieldDirection;
+        aInstruction.mValue = (aTerm == "tx") ? 1 : 0;
+        ExitNow(error = OTBR_ERROR_NONE);
+    }
+
+    position = aTerm.find_first_of("!<>=");
+    VerifyOrExit(position != std::string::npos && position > 0);
+
+    if (aTerm.compare(position, 2, "!=") == 0)
+    {
+        aInstruction.mOperator = kOperatorNotEqual;
+        operatorLength         = 2;
+    }
+    else if (aTerm.compare(position, 2, ">=") == 0)
+    {
+        aInstruction.mOperator = kOperatorGreaterOrEqual;
+        operatorLength         = 2;
+    }
+    else if (aTerm.compare(position, 2, "<=") == 0)
+    {
+        aInstruction.mOperator = kOperatorLessOrEqual;
+        operatorLength         = 2;
+    }
+    else
+    {
+        VerifyOrExit(aTerm[position] == '=');
+        operatorLength = 1;
+    }
+
+    field   = aTerm.substr(0, position);
+    operand = aTerm.substr(position + operatorLength);
+
+    if (field == "type")
+    {
+        VerifyOrExit(aInstruction.mOperator == kOperatorEqual || aInstruction.mOperator == kOperatorNotEqual);
+        aInstruction.mField = kFieldByte;
+        aInstruction.mMask  = 0x07; // The frame type bits of the frame control field.
+
+        for (size_t i = 0; i < sizeof(kFrameTypes) / sizeof(kFrameTypes[0]); i++)
+        {
+            if (operand == kFrameTypes[i])
+            {
+                aInstruction.mValue = static_cast<int32_t>(i);
+                ExitNow(error = OTBR_ERROR_NONE);
+            }
+        }
+
+        ExitNow();
+    }
+    else if (field == "len")
+    {
+        aInstruction.mField = kFieldLength;
+        VerifyOrExit(ParseNumber(operand, 0, UINT16_MAX, number));
+    }
+    else if (field == "rssi")
+    {
+        aInstruction.mField = kFieldRssi;
+        VerifyOrExit(ParseNumber(operand, INT8_MIN, INT8_MAX, number));
+    }
+    else
+    {
+        static const char kPrefix[] = "frame[";
+
+        size_t close = field.find(']');
+        long   offset;
+
+        VerifyOrExit(field.compare(0, sizeof(kPrefix) - 1, kPrefix) == 0 && close != std::string::npos);
+        VerifyOrExit(ParseNumber(field.substr(sizeof(kPrefix) - 1, close - sizeof(kPrefix) + 1), 0, 126, offset));
+        aInstruction.mField  = kFieldByte;
+        aInstruction.mOffset = static_cast<uint16_t>(offset);
+
+        if (close + 1 < field.size())
+        {
+            long mask;
+
+            VerifyOrExit(field[close + 1] == '&' && ParseNumber(field.substr(close + 2), 0, UINT8_MAX, mask));
+            aInstruction.mMask = static_cast<uint8_t>(mask);
+        }
+
+        VerifyOrExit(ParseNumber(operand, 0, UINT8_MAX, number));
+    }
+
+    aInstruction.mValue = static_cast<int32_t>(number);
+    error               = OTBR_ERROR_NONE;
+
+exit:
+    return error;
+}
+
+bool FrameFilter::ParseNumber(const std::string &aText, long aMin, long aMax, long &aNumber)
+{
+    char *end;
+
+    aNumber = strtol(aText.c_str(), &end, 0);
+
+    return !aText.empty() && *end == '\0' && aNumber >= aMin && aNumber <= aMax;
+}
+
+} // namespace Utils
+
+} // namespace otbr
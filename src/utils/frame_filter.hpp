@@ -0,0 +1,140 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of a filter of IEEE 802.15.4 frames.
+ */
+
+#ifndef OTBR_UTILS_FRAME_FILTER_HPP_
+#define OTBR_UTILS_FRAME_FILTER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+namespace Utils {
+
+/**
+ * This class implements a filter of IEEE 802.15.4 frames.
+ *
+ * An expression is a list of terms separated by spaces which all have to match:
+ *
+ * - `rx` or `tx` matches the direction of the frame.
+ * - `type=beacon|data|ack|cmd` matches the frame type, `type!=...` excludes it.
+ * - `len`, `rssi` and `frame[N]` compare the PSDU length, the RSSI in dBm and the N-th byte of the PSDU with the
+ *   operators `=`, `!=`, `>=` and `<=`, as in `len>=10` or `rssi>=-70`. `frame[N]&M` masks the byte first.
+ *
+ * The expression is compiled into a list of comparisons once, so matching a frame neither allocates nor parses.
+ *
+ */
+class FrameFilter
+{
+public:
+    /**
+     * The constructor initializes a filter which matches every frame.
+     *
+     */
+    FrameFilter(void) = default;
+
+    /**
+     * This method compiles a filter expression.
+     *
+     * @param[in]   aExpression     The expression, nullptr or an empty expression matches every frame.
+     *
+     * @retval  OTBR_ERROR_NONE             Successfully compiled the expression.
+     * @retval  OTBR_ERROR_INVALID_ARGS     The expression is malformed, the filter is left unchanged.
+     *
+     */
+    otbrError Parse(const char *aExpression);
+
+    /**
+     * This method indicates whether the filter matches every frame.
+     *
+     * @returns Whether the filter has no term.
+     *
+     */
+    bool IsEmpty(void) const { return mInstructions.empty(); }
+
+    /**
+     * This method matches a frame against the filter.
+     *
+     * @param[in]   aPsdu       A pointer to the PSDU.
+     * @param[in]   aLength     The length of the PSDU.
+     * @param[in]   aRssi       The RSSI of the frame in dBm.
+     * @param[in]   aIsTx       Whether the frame was transmitted.
+     *
+     * @returns Whether all the terms of the filter match the frame.
+     *
+     */
+    bool Match(const uint8_t *aPsdu, uint16_t aLength, int8_t aRssi, bool aIsTx) const;
+
+private:
+    enum Field : uint8_t
+    {
+        kFieldByte,
+        kFieldLength,
+        kFieldRssi,
+        kFieldDirection, // Zero for a received frame, one for a transmitted frame.
+    };
+
+    enum Operator : uint8_t
+    {
+        kOperatorEqual,
+        kOperatorNotEqual,
+        kOperatorGreaterOrEqual,
+        kOperatorLessOrEqual,
+    };
+
+    struct Instruction
+    {
+        Field    mField;
+        Operator mOperator;
+        uint8_t  mMask;
+        uint16_t mOffset;
+        int32_t  mValue;
+    };
+
+    static otbrError ParseTerm(const std::string &aTerm, Instruction &aInstruction);
+    static bool      ParseNumber(const std::string &aText, long aMin, long aMax, long &aNumber);
+
+    std::vector<Instruction> mInstructions;
+};
+
+} // namespace Utils
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_FRAME_FILTER_HPP_
@@ -0,0 +1,161 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a single-producer single-consumer ring of records in a memory mapping.
+ */
+
+#include "utils/frame_ring.hpp"
+
+#include <string.h>
+#include <sys/mman.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+namespace Utils {
+
+FrameRing::FrameRing(void)
+    : mBuffer(nullptr)
+    , mSize(0)
+    , mHead(0)
+    , mWritePosition(0)
+    , mWriteLength(0)
+    , mDropCount(0)
+    , mTail(0)
+    , mReadLength(0)
+{
+}
+
+FrameRing::~FrameRing(void)
+{
+    if (mBuffer != nullptr)
+    {
+        munmap(mBuffer, mSize);
+    }
+}
+
+otbrError FrameRing::Init(size_t aSize)
+{
+    otbrError error = OTBR_ERROR_NONE;
+    size_t    size  = 4096;
+    void *    buffer;
+
+    VerifyOrExit(mBuffer == nullptr, error = OTBR_ERROR_INVALID_ARGS);
+
+    while (size < aSize)
+    {
+        size <<= 1;
+    }
+
+    // Populating the mapping up front keeps page faults off the producer.
+    buffer = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE, -1, 0);
+    VerifyOrExit(buffer != MAP_FAILED, error = OTBR_ERROR_ERRNO);
+
+    mBuffer = static_cast<uint8_t *>(buffer);
+    mSize   = size;
+
+exit:
+    return error;
+}
+
+uint8_t *FrameRing::BeginWrite(size_t aLength)
+{
+    uint8_t *record = nullptr;
+    uint64_t head   = mHead.load(std::memory_order_relaxed);
+    size_t   size   = RecordSize(aLength);
+    size_t   offset;
+    size_t   skip;
+
+    VerifyOrExit(mBuffer != nullptr && size <= mSize / 2, mDropCount.fetch_add(1, std::memory_order_relaxed));
+
+    // A record never wraps, the end of the mapping is skipped when it is too short.
+    offset = head & (mSize - 1);
+    skip   = (mSize - offset < size) ? mSize - offset : 0;
+
+    VerifyOrExit(head + skip + size - mTail.load(std::memory_order_acquire) <= mSize,
+                 mDropCount.fetch_add(1, std::memory_order_relaxed));
+
+    if (skip != 0)
+    {
+        uint32_t marker = kWrapMarker;
+
+        memcpy(mBuffer + offset, &marker, sizeof(marker));
+    }
+
+    mWritePosition = head + skip;
+    mWriteLength   = static_cast<uint32_t>(aLength);
+    record         = mBuffer + (mWritePosition & (mSize - 1)) + kHeaderSize;
+
+exit:
+    return record;
+}
+
+void FrameRing::CommitWrite(void)
+{
+    memcpy(mBuffer + (mWritePosition & (mSize - 1)), &mWriteLength, sizeof(mWriteLength));
+    mHead.store(mWritePosition + RecordSize(mWriteLength), std::memory_order_release);
+}
+
+const uint8_t *FrameRing::Peek(size_t &aLength)
+{
+    const uint8_t *record = nullptr;
+    uint64_t       tail   = mTail.load(std::memory_order_relaxed);
+    size_t         offset;
+
+    VerifyOrExit(tail != mHead.load(std::memory_order_acquire));
+
+    offset = tail & (mSize - 1);
+    memcpy(&mReadLength, mBuffer + offset, sizeof(mReadLength));
+
+    if (mReadLength == kWrapMarker)
+    {
+        // The producer only skips to the start of the mapping with the next record, which is committed as well.
+        tail += mSize - offset;
+        mTail.store(tail, std::memory_order_release);
+        offset = 0;
+        memcpy(&mReadLength, mBuffer, sizeof(mReadLength));
+    }
+
+    aLength = mReadLength;
+    record  = mBuffer + offset + kHeaderSize;
+
+exit:
+    return record;
+}
+
+void FrameRing::Consume(void)
+{
+    mTail.store(mTail.load(std::memory_order_relaxed) + RecordSize(mReadLength), std::memory_order_release);
+}
+
+} // namespace Utils
+
+} // namespace otbr
@@ -0,0 +1,159 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of a single-producer single-consumer ring of records in a memory mapping.
+ */
+
+#ifndef OTBR_UTILS_FRAME_RING_HPP_
+#define OTBR_UTILS_FRAME_RING_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <atomic>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+namespace Utils {
+
+/**
+ * This class implements a lock-free ring of variable-sized records shared by one producer and one consumer thread.
+ *
+ * The ring lives in an anonymous memory mapping which is populated up front, so writing a record never faults or
+ * allocates. The producer builds each record in place between `BeginWrite()` and `CommitWrite()`, and the consumer
+ * reads it in place between `Peek()` and `Consume()`. A record which does not fit is dropped and counted, the
+ * producer never waits for the consumer.
+ *
+ */
+class FrameRing
+{
+public:
+    /**
+     * The constructor initializes an empty ring without memory.
+     *
+     */
+    FrameRing(void);
+
+    ~FrameRing(void);
+
+    /**
+     * This method maps the memory of the ring.
+     *
+     * @param[in]   aSize   The size of the ring in bytes, rounded up to a power of two.
+     *
+     * @retval  OTBR_ERROR_NONE   Successfully mapped the ring.
+     * @retval  OTBR_ERROR_ERRNO  Failed to map the ring.
+     *
+     */
+    otbrError Init(size_t aSize);
+
+    /**
+     * This method returns the size of the ring.
+     *
+     * @returns The size of the ring in bytes, zero if the ring is not initialized.
+     *
+     */
+    size_t GetSize(void) const { return mSize; }
+
+    /**
+     * This method reserves a record, it MUST only be called from the producer thread.
+     *
+     * @param[in]   aLength     The length of the record.
+     *
+     * @returns A pointer to @p aLength bytes aligned to 8 bytes to write the record to, or nullptr if the ring is full.
+     *
+     */
+    uint8_t *BeginWrite(size_t aLength);
+
+    /**
+     * This method publishes the record reserved by the last `BeginWrite()` to the consumer.
+     *
+     */
+    void CommitWrite(void);
+
+    /**
+     * This method returns the oldest record, it MUST only be called from the consumer thread.
+     *
+     * @param[out]  aLength     The length of the record.
+     *
+     * @returns A pointer to the record aligned to 8 bytes, or nullptr if the ring is empty.
+     *
+     */
+    const uint8_t *Peek(size_t &aLength);
+
+    /**
+     * This method releases the record returned by the last `Peek()` to the producer.
+     *
+     */
+    void Consume(void);
+
+    /**
+     * This method indicates whether the ring has no record for the consumer.
+     *
+     * @returns Whether the ring is empty.
+     *
+     */
+    bool IsEmpty(void) const { return mHead.load(std::memory_order_acquire) == mTail.load(std::memory_order_relaxed); }
+
+    /**
+     * This method returns the number of records dropped because the ring was full.
+     *
+     * @returns The number of dropped records.
+     *
+     */
+    uint64_t GetDropCount(void) const { return mDropCount.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr size_t   kHeaderSize = 8;          // The record length (4) and padding to keep records aligned.
+    static constexpr uint32_t kWrapMarker = UINT32_MAX; // The rest of the mapping is skipped.
+
+    static size_t RecordSize(size_t aLength) { return (kHeaderSize + aLength + 7) & ~static_cast<size_t>(7); }
+
+    uint8_t *mBuffer;
+    size_t   mSize;
+
+    alignas(64) std::atomic<uint64_t> mHead; // The end of the committed records, advanced by the producer.
+    uint64_t mWritePosition;                 // The start of the reserved record.
+    uint32_t mWriteLength;                   // The length of the reserved record.
+    std::atomic<uint64_t> mDropCount;
+
+    alignas(64) std::atomic<uint64_t> mTail; // The start of the oldest record, advanced by the consumer.
+    uint32_t mReadLength;                    // The length of the peeked record.
+};
+
+} // namespace Utils
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_FRAME_RING_HPP_
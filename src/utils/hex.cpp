@@ -33,98 +33,245 @@
 
 #include "utils/hex.hpp"
 
-#include <string>
-
-#include <stdio.h>
 #include <string.h>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define OTBR_HEX_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define OTBR_HEX_NEON 1
+#endif
+
+#include "common/code_utils.hpp"
+
 namespace otbr {
 
 namespace Utils {
 
-int Hex2Bytes(const char *aHex, uint8_t *aBytes, uint16_t aBytesLength)
+namespace {
+
+const char kUpperHexDigits[] = "0123456789ABCDEF";
+const char kLowerHexDigits[] = "0123456789abcdef";
+
+// The offset from '0' + 10 to 'A' or 'a', added to digits greater than 9.
+const uint8_t kUpperLetterOffset = 'A' - '0' - 10;
+const uint8_t kLowerLetterOffset = 'a' - '0' - 10;
+
+// The number of bytes converted by one vector step, which is twice as many hex digits.
+const size_t kBlockSize = 16;
+
+int DecodeDigit(char aDigit)
+{
+    uint8_t digit  = static_cast<uint8_t>(aDigit - '0');
+    uint8_t letter = static_cast<uint8_t>((aDigit | 0x20) - 'a');
+
+    return digit < 10 ? digit : (letter < 6 ? letter + 10 : -1);
+}
+
+#if OTBR_HEX_SSE2
+
+__m128i EncodeDigits(__m128i aNibbles, __m128i aLetterOffset)
+{
+    __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(aNibbles, _mm_set1_epi8(9)), aLetterOffset);
+
+    return _mm_add_epi8(_mm_add_epi8(aNibbles, _mm_set1_epi8('0')), letters);
+}
+
+void EncodeBlock(const uint8_t *aBytes, char *aHex, bool aLowerCase)
+{
+    __m128i bytes  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(aBytes));
+    __m128i mask   = _mm_set1_epi8(0x0f);
+    __m128i offset = _mm_set1_epi8(static_cast<char>(aLowerCase ? kLowerLetterOffset : kUpperLetterOffset));
+    __m128i high   = EncodeDigits(_mm_and_si128(_mm_srli_epi16(bytes, 4), mask), offset);
+    __m128i low    = EncodeDigits(_mm_and_si128(bytes, mask), offset);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aHex), _mm_unpacklo_epi8(high, low));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aHex + kBlockSize), _mm_unpackhi_epi8(high, low));
+}
+
+// Converts 16 hex digits to nibbles, clearing the lanes of @p aValid which are not hex digits.
+__m128i DecodeDigits(__m128i aDigits, __m128i &aValid)
 {
-    size_t      hexLength = strlen(aHex);
-    const char *hexEnd    = aHex + hexLength;
-    uint8_t *   cur       = aBytes;
-    uint8_t     numChars  = hexLength & 1;
-    uint8_t     byte      = 0;
+    // SSE2 has no unsigned byte comparison, `min(x, n) == x` tells whether x <= n.
+    __m128i digit    = _mm_sub_epi8(aDigits, _mm_set1_epi8('0'));
+    __m128i letter   = _mm_sub_epi8(_mm_or_si128(aDigits, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    __m128i isDigit  = _mm_cmpeq_epi8(_mm_min_epu8(digit, _mm_set1_epi8(9)), digit);
+    __m128i isLetter = _mm_cmpeq_epi8(_mm_min_epu8(letter, _mm_set1_epi8(5)), letter);
+
+    aValid = _mm_and_si128(aValid, _mm_or_si128(isDigit, isLetter));
+
+    return _mm_or_si128(_mm_and_si128(isDigit, digit),
+                        _mm_and_si128(isLetter, _mm_add_epi8(letter, _mm_set1_epi8(10))));
+}
+
+// Combines the pairs of nibbles in each 16-bit lane into a byte, the first nibble being the high one.
+__m128i CombineNibbles(__m128i aNibbles)
+{
+    return _mm_or_si128(_mm_slli_epi16(_mm_and_si128(aNibbles, _mm_set1_epi16(0x00ff)), 4),
+                        _mm_srli_epi16(aNibbles, 8));
+}
+
+bool DecodeBlock(const char *aHex, uint8_t *aBytes)
+{
+    __m128i valid  = _mm_set1_epi8(-1);
+    __m128i first  = DecodeDigits(_mm_loadu_si128(reinterpret_cast<const __m128i *>(aHex)), valid);
+    __m128i second = DecodeDigits(_mm_loadu_si128(reinterpret_cast<const __m128i *>(aHex + kBlockSize)), valid);
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(aBytes),
+                     _mm_packus_epi16(CombineNibbles(first), CombineNibbles(second)));
+
+    return _mm_movemask_epi8(valid) == 0xffff;
+}
+
+#elif OTBR_HEX_NEON
+
+uint8x16_t EncodeDigits(uint8x16_t aNibbles, uint8x16_t aLetterOffset)
+{
+    uint8x16_t letters = vandq_u8(vcgtq_u8(aNibbles, vdupq_n_u8(9)), aLetterOffset);
+
+    return vaddq_u8(vaddq_u8(aNibbles, vdupq_n_u8('0')), letters);
+}
+
+void EncodeBlock(const uint8_t *aBytes, char *aHex, bool aLowerCase)
+{
+    uint8x16_t  bytes  = vld1q_u8(aBytes);
+    uint8x16_t  offset = vdupq_n_u8(aLowerCase ? kLowerLetterOffset : kUpperLetterOffset);
+    uint8x16x2_t digits;
+
+    digits.val[0] = EncodeDigits(vshrq_n_u8(bytes, 4), offset);
+    digits.val[1] = EncodeDigits(vandq_u8(bytes, vdupq_n_u8(0x0f)), offset);
+
+    // The interleaving store writes the high and low digits of each byte next to each other.
+    vst2q_u8(reinterpret_cast<uint8_t *>(aHex), digits);
+}
 
-    if ((hexLength + 1) / 2 > aBytesLength)
+// Converts 16 hex digits to nibbles, clearing the lanes of @p aValid which are not hex digits.
+uint8x16_t DecodeDigits(uint8x16_t aDigits, uint8x16_t &aValid)
+{
+    uint8x16_t digit    = vsubq_u8(aDigits, vdupq_n_u8('0'));
+    uint8x16_t letter   = vsubq_u8(vorrq_u8(aDigits, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+    uint8x16_t isDigit  = vcltq_u8(digit, vdupq_n_u8(10));
+    uint8x16_t isLetter = vcltq_u8(letter, vdupq_n_u8(6));
+
+    aValid = vandq_u8(aValid, vorrq_u8(isDigit, isLetter));
+
+    return vorrq_u8(vandq_u8(isDigit, digit), vandq_u8(isLetter, vaddq_u8(letter, vdupq_n_u8(10))));
+}
+
+bool DecodeBlock(const char *aHex, uint8_t *aBytes)
+{
+    // The deinterleaving load puts the high digits in `val[0]` and the low digits in `val[1]`.
+    uint8x16x2_t digits = vld2q_u8(reinterpret_cast<const uint8_t *>(aHex));
+    uint8x16_t   valid  = vdupq_n_u8(0xff);
+    uint8x16_t   high   = DecodeDigits(digits.val[0], valid);
+    uint8x16_t   low    = DecodeDigits(digits.val[1], valid);
+    uint64x2_t   lanes  = vreinterpretq_u64_u8(valid);
+
+    vst1q_u8(aBytes, vorrq_u8(vshlq_n_u8(high, 4), low));
+
+    return (vgetq_lane_u64(lanes, 0) & vgetq_lane_u64(lanes, 1)) == UINT64_MAX;
+}
+
+#endif // OTBR_HEX_NEON
+
+} // namespace
+
+int DecodeHex(const char *aHex, size_t aHexLength, uint8_t *aBytes, size_t aBytesLength)
+{
+    uint8_t *cur = aBytes;
+    int      ret = -1;
+
+    VerifyOrExit((aHexLength + 1) / 2 <= aBytesLength);
+
+    if (aHexLength & 1)
+    {
+        int digit = DecodeDigit(*aHex++);
+
+        VerifyOrExit(digit >= 0);
+        *cur++ = static_cast<uint8_t>(digit);
+        aHexLength--;
+    }
+
+#if OTBR_HEX_SSE2 || OTBR_HEX_NEON
+    for (; aHexLength >= 2 * kBlockSize; aHexLength -= 2 * kBlockSize)
     {
-        return -1;
+        VerifyOrExit(DecodeBlock(aHex, cur));
+        aHex += 2 * kBlockSize;
+        cur += kBlockSize;
     }
+#endif
 
-    while (aHex < hexEnd)
+    for (; aHexLength >= 2; aHexLength -= 2)
     {
-        if ('A' <= *aHex && *aHex <= 'F')
-        {
-            byte |= 10 + (*aHex - 'A');
-        }
-        else if ('a' <= *aHex && *aHex <= 'f')
-        {
-            byte |= 10 + (*aHex - 'a');
-        }
-        else if ('0' <= *aHex && *aHex <= '9')
-        {
-            byte |= *aHex - '0';
-        }
-        else
-        {
-            return -1;
-        }
-
-        aHex++;
-        numChars++;
-
-        if (numChars >= 2)
-        {
-            numChars = 0;
-            *cur++   = byte;
-            byte     = 0;
-        }
-        else
-        {
-            byte <<= 4;
-        }
+        int high = DecodeDigit(aHex[0]);
+        int low  = DecodeDigit(aHex[1]);
+
+        VerifyOrExit(high >= 0 && low >= 0);
+        *cur++ = static_cast<uint8_t>((high << 4) | low);
+        aHex += 2;
     }
 
-    return static_cast<int>(cur - aBytes);
+    ret = static_cast<int>(cur - aBytes);
+
+exit:
+    return ret;
 }
 
-size_t Bytes2Hex(const uint8_t *aBytes, const uint16_t aBytesLength, char *aHex)
+size_t EncodeHex(const uint8_t *aBytes, size_t aLength, char *aHex, bool aLowerCase)
 {
-    char byteHex[3];
-
-    std::string hexString;
-    uint8_t     cur[aBytesLength];
+    const char *digits = aLowerCase ? kLowerHexDigits : kUpperHexDigits;
+    size_t      i      = 0;
 
-    memcpy(cur, aBytes, aBytesLength);
+#if OTBR_HEX_SSE2 || OTBR_HEX_NEON
+    for (; i + kBlockSize <= aLength; i += kBlockSize)
+    {
+        EncodeBlock(aBytes + i, aHex + 2 * i, aLowerCase);
+    }
+#endif
 
-    for (int i = 0; i < aBytesLength; i++)
+    for (; i < aLength; i++)
     {
-        sprintf(byteHex, "%02X", cur[i]);
-        hexString += byteHex;
+        aHex[2 * i]     = digits[aBytes[i] >> 4];
+        aHex[2 * i + 1] = digits[aBytes[i] & 0x0f];
     }
-    strcpy(aHex, hexString.c_str());
-    return strlen(aHex);
+
+    return 2 * aLength;
+}
+
+void AppendHex(const uint8_t *aBytes, size_t aLength, std::string &aOutput)
+{
+    size_t offset = aOutput.size();
+
+    aOutput.resize(offset + 2 * aLength);
+    EncodeHex(aBytes, aLength, &aOutput[offset]);
+}
+
+int Hex2Bytes(const char *aHex, uint8_t *aBytes, uint16_t aBytesLength)
+{
+    return DecodeHex(aHex, strlen(aHex), aBytes, aBytesLength);
+}
+
+size_t Bytes2Hex(const uint8_t *aBytes, const uint16_t aBytesLength, char *aHex)
+{
+    size_t length = EncodeHex(aBytes, aBytesLength, aHex);
+
+    aHex[length] = '\0';
+
+    return length;
 }
 
 size_t Long2Hex(const uint64_t aLong, char *aHex)
 {
-    std::string hexString;
-    char        byteHex[3];
-    uint64_t    longValue = aLong;
+    uint8_t bytes[sizeof(uint64_t)];
 
+    // The least significant byte comes first.
     for (uint8_t i = 0; i < sizeof(uint64_t); i++)
     {
-        uint8_t byte = longValue & 0xff;
-        sprintf(byteHex, "%02X", byte);
-        hexString += byteHex;
-        longValue = longValue >> 8;
+        bytes[i] = static_cast<uint8_t>(aLong >> (8 * i));
     }
-    strcpy(aHex, hexString.c_str());
-    return strlen(aHex);
+
+    return Bytes2Hex(bytes, sizeof(bytes), aHex);
 }
 
 } // namespace Utils
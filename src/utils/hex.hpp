@@ -39,10 +39,52 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include <string>
+
 namespace otbr {
 
 namespace Utils {
 
+/**
+ * This function converts a hex string to bytes.
+ *
+ * An odd number of digits is allowed, in which case the first byte only takes the first digit.
+ *
+ * @param[in]   aHex            A pointer to the hex digits.
+ * @param[in]   aHexLength      The number of hex digits.
+ * @param[out]  aBytes          A pointer to the output buffer.
+ * @param[in]   aBytesLength    The size of the output buffer.
+ *
+ * @returns The number of bytes written, or -1 if @p aHex has a non-hex character or @p aBytes is too small.
+ *
+ */
+int DecodeHex(const char *aHex, size_t aHexLength, uint8_t *aBytes, size_t aBytesLength);
+
+/**
+ * This function converts bytes to hex digits.
+ *
+ * Exactly 2 * @p aLength characters are written and the output is NOT null-terminated.
+ *
+ * @param[in]   aBytes      A pointer to the bytes.
+ * @param[in]   aLength     The number of bytes.
+ * @param[out]  aHex        A pointer to the output buffer, at least 2 * @p aLength characters long.
+ * @param[in]   aLowerCase  Whether to use lower case digits.
+ *
+ * @returns The number of characters written.
+ *
+ */
+size_t EncodeHex(const uint8_t *aBytes, size_t aLength, char *aHex, bool aLowerCase = false);
+
+/**
+ * This function appends bytes as upper case hex digits to a string.
+ *
+ * @param[in]     aBytes    A pointer to the bytes.
+ * @param[in]     aLength   The number of bytes.
+ * @param[inout]  aOutput   The string to append to.
+ *
+ */
+void AppendHex(const uint8_t *aBytes, size_t aLength, std::string &aOutput);
+
 int Hex2Bytes(const char *aHex, uint8_t *aBytes, uint16_t aBytesLength);
 
 size_t Bytes2Hex(const uint8_t *aBytes, const uint16_t aBytesLength, char *aHex);
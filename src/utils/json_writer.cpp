@@ -0,0 +1,215 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a streaming JSON writer.
+ */
+
+#include "utils/json_writer.hpp"
+
+#include "utils/hex.hpp"
+
+namespace otbr {
+
+namespace Utils {
+
+static const char kHexDigits[] = "0123456789ABCDEF";
+
+static bool NeedsEscape(unsigned char aChar)
+{
+    return aChar < 0x20 || aChar == '"' || aChar == '\\';
+}
+
+void JsonWriter::BeginValue(void)
+{
+    if (mNeedComma)
+    {
+        mBuffer += ',';
+    }
+
+    mNeedComma = true;
+}
+
+void JsonWriter::BeginObject(void)
+{
+    BeginValue();
+    mBuffer += '{';
+    mNeedComma = false;
+}
+
+void JsonWriter::EndObject(void)
+{
+    mBuffer += '}';
+    mNeedComma = true;
+}
+
+void JsonWriter::BeginArray(void)
+{
+    BeginValue();
+    mBuffer += '[';
+    mNeedComma = false;
+}
+
+void JsonWriter::EndArray(void)
+{
+    mBuffer += ']';
+    mNeedComma = true;
+}
+
+void JsonWriter::Key(const char *aKey)
+{
+    String(aKey);
+    mBuffer += ':';
+    mNeedComma = false;
+}
+
+/**
+ * This function formats a number in decimal, ending at the end of a buffer.
+ *
+ * @returns A pointer to the first digit.
+ *
+ */
+static char *FormatDecimal(uint64_t aValue, char *aEnd)
+{
+    char *cur = aEnd;
+
+    // The digits are produced from the last one, without the format parsing and locale of snprintf().
+    do
+    {
+        *--cur = static_cast<char>('0' + aValue % 10);
+        aValue /= 10;
+    } while (aValue != 0);
+
+    return cur;
+}
+
+void JsonWriter::Uint(uint64_t aValue)
+{
+    char  number[sizeof("18446744073709551615")];
+    char *end   = number + sizeof(number);
+    char *begin = FormatDecimal(aValue, end);
+
+    BeginValue();
+    mBuffer.append(begin, static_cast<size_t>(end - begin));
+}
+
+void JsonWriter::Int(int64_t aValue)
+{
+    char     number[sizeof("-9223372036854775808")];
+    char *   end       = number + sizeof(number);
+    uint64_t magnitude = (aValue < 0) ? 0 - static_cast<uint64_t>(aValue) : static_cast<uint64_t>(aValue);
+    char *   begin     = FormatDecimal(magnitude, end);
+
+    if (aValue < 0)
+    {
+        *--begin = '-';
+    }
+
+    BeginValue();
+    mBuffer.append(begin, static_cast<size_t>(end - begin));
+}
+
+void JsonWriter::Bool(bool aValue)
+{
+    BeginValue();
+    mBuffer += aValue ? "true" : "false";
+}
+
+void JsonWriter::String(const char *aString)
+{
+    BeginValue();
+    mBuffer += '"';
+
+    for (const char *cur = aString; *cur != '\0'; cur++)
+    {
+        const char *  run = cur;
+        unsigned char c;
+
+        // Almost no character needs an escape, append the runs between escapes at once.
+        while (*cur != '\0' && !NeedsEscape(static_cast<unsigned char>(*cur)))
+        {
+            cur++;
+        }
+
+        mBuffer.append(run, static_cast<size_t>(cur - run));
+
+        if (*cur == '\0')
+        {
+            break;
+        }
+
+        c = static_cast<unsigned char>(*cur);
+
+        switch (c)
+        {
+        case '"':
+            mBuffer += "\\\"";
+            break;
+        case '\\':
+            mBuffer += "\\\\";
+            break;
+        case '\b':
+            mBuffer += "\\b";
+            break;
+        case '\f':
+            mBuffer += "\\f";
+            break;
+        case '\n':
+            mBuffer += "\\n";
+            break;
+        case '\r':
+            mBuffer += "\\r";
+            break;
+        case '\t':
+            mBuffer += "\\t";
+            break;
+        default:
+            // Other control characters have no short escape sequence.
+            mBuffer += "\\u00";
+            mBuffer += kHexDigits[c >> 4];
+            mBuffer += kHexDigits[c & 0xf];
+            break;
+        }
+    }
+
+    mBuffer += '"';
+}
+
+void JsonWriter::HexString(const uint8_t *aBytes, size_t aLength)
+{
+    BeginValue();
+    mBuffer += '"';
+
+    AppendHex(aBytes, aLength, mBuffer);
+    mBuffer += '"';
+}
+
+} // namespace Utils
+
+} // namespace otbr
@@ -0,0 +1,192 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of a streaming JSON writer.
+ */
+
+#ifndef OTBR_UTILS_JSON_WRITER_HPP_
+#define OTBR_UTILS_JSON_WRITER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+namespace otbr {
+
+namespace Utils {
+
+/**
+ * This class implements a writer which serializes JSON values directly into a string buffer.
+ *
+ * Unlike building a document tree, writing a value does not allocate memory other than growing the buffer, so
+ * the buffer could be reused to serialize large documents without allocation once it has grown. The output is
+ * compact, without white space.
+ *
+ * The writer does not check the structure of the document, a key MUST be written before each value in an object.
+ *
+ */
+class JsonWriter
+{
+public:
+    /**
+     * The constructor initializes a JSON writer appending to a buffer.
+     *
+     * @param[inout]    aBuffer     The buffer to append the JSON text to.
+     *
+     */
+    explicit JsonWriter(std::string &aBuffer)
+        : mBuffer(aBuffer)
+        , mNeedComma(false)
+    {
+    }
+
+    /**
+     * This method begins a JSON object.
+     *
+     */
+    void BeginObject(void);
+
+    /**
+     * This method ends a JSON object.
+     *
+     */
+    void EndObject(void);
+
+    /**
+     * This method begins a JSON array.
+     *
+     */
+    void BeginArray(void);
+
+    /**
+     * This method ends a JSON array.
+     *
+     */
+    void EndArray(void);
+
+    /**
+     * This method writes the key of the next member in an object.
+     *
+     * @param[in]   aKey    The key.
+     *
+     */
+    void Key(const char *aKey);
+
+    /**
+     * This method writes an unsigned integer.
+     *
+     * @param[in]   aValue  The value.
+     *
+     */
+    void Uint(uint64_t aValue);
+
+    /**
+     * This method writes a signed integer.
+     *
+     * @param[in]   aValue  The value.
+     *
+     */
+    void Int(int64_t aValue);
+
+    /**
+     * This method writes a boolean.
+     *
+     * @param[in]   aValue  The value.
+     *
+     */
+    void Bool(bool aValue);
+
+    /**
+     * This method writes a string, escaping it as needed.
+     *
+     * @param[in]   aString     A null-terminated string.
+     *
+     */
+    void String(const char *aString);
+
+    /**
+     * This method writes bytes as a string of upper case hexadecimal digits.
+     *
+     * @param[in]   aBytes      A pointer to the bytes.
+     * @param[in]   aLength     The number of bytes.
+     *
+     */
+    void HexString(const uint8_t *aBytes, size_t aLength);
+
+    /**
+     * This method writes bytes. JSON has no byte strings, so they are written as a hex string.
+     *
+     * @param[in]   aBytes      A pointer to the bytes.
+     * @param[in]   aLength     The number of bytes.
+     *
+     */
+    void Bytes(const uint8_t *aBytes, size_t aLength) { HexString(aBytes, aLength); }
+
+    /**
+     * This method writes an object member whose value is an unsigned integer.
+     *
+     * @param[in]   aKey    The key.
+     * @param[in]   aValue  The value.
+     *
+     */
+    void UintMember(const char *aKey, uint64_t aValue)
+    {
+        Key(aKey);
+        Uint(aValue);
+    }
+
+    /**
+     * This method writes an object member whose value is a string.
+     *
+     * @param[in]   aKey    The key.
+     * @param[in]   aValue  A null-terminated string.
+     *
+     */
+    void StringMember(const char *aKey, const char *aValue)
+    {
+        Key(aKey);
+        String(aValue);
+    }
+
+private:
+    void BeginValue(void);
+
+    std::string &mBuffer;
+    bool         mNeedComma;
+};
+
+} // namespace Utils
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_JSON_WRITER_HPP_
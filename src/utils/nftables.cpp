@@ -0,0 +1,386 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   The file implements programming nftables through netlink.
+ */
+
+#include "utils/nftables.hpp"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <net/if.h>
+#include <netinet/in.h>
+#include <netinet/ip6.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+
+// The Linux headers come last so that they do not clash with the libc definitions.
+#include <linux/netfilter.h>
+#include <linux/netfilter/nf_tables.h>
+#include <linux/netfilter/nfnetlink.h>
+#include <linux/netlink.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
+namespace otbr {
+
+enum
+{
+    kReceiveBufferSize = 8192, ///< Size of the buffer receiving netlink acknowledgements.
+    kReceiveTimeout    = 1,    ///< Seconds to wait for each netlink acknowledgement.
+};
+
+NftablesBatch::NftablesBatch(void)
+    : mMessageOffset(0)
+    , mExpressionsOffset(0)
+    , mSequence(0)
+    , mAckCount(0)
+{
+    mExpressionOffsets[0] = 0;
+    mExpressionOffsets[1] = 0;
+
+    BeginMessage(NFNL_MSG_BATCH_BEGIN, NLM_F_REQUEST, AF_UNSPEC);
+    EndMessage();
+}
+
+void NftablesBatch::AddTable(const char *aTable)
+{
+    BeginMessage(NFT_MSG_NEWTABLE, NLM_F_REQUEST | NLM_F_CREATE | NLM_F_ACK, NFPROTO_IPV6);
+    PutString(NFTA_TABLE_NAME, aTable);
+    EndMessage();
+}
+
+void NftablesBatch::DeleteTable(const char *aTable)
+{
+    BeginMessage(NFT_MSG_DELTABLE, NLM_F_REQUEST | NLM_F_ACK, NFPROTO_IPV6);
+    PutString(NFTA_TABLE_NAME, aTable);
+    EndMessage();
+}
+
+void NftablesBatch::AddChain(const char *aTable, const char *aChain, uint32_t aHook, int32_t aPriority)
+{
+    size_t hook;
+
+    BeginMessage(NFT_MSG_NEWCHAIN, NLM_F_REQUEST | NLM_F_CREATE | NLM_F_ACK, NFPROTO_IPV6);
+    PutString(NFTA_CHAIN_TABLE, aTable);
+    PutString(NFTA_CHAIN_NAME, aChain);
+    hook = BeginNested(NFTA_CHAIN_HOOK);
+    PutU32(NFTA_HOOK_HOOKNUM, aHook);
+    PutU32(NFTA_HOOK_PRIORITY, static_cast<uint32_t>(aPriority));
+    EndNested(hook);
+    PutString(NFTA_CHAIN_TYPE, "filter");
+    PutU32(NFTA_CHAIN_POLICY, NF_ACCEPT);
+    EndMessage();
+}
+
+void NftablesBatch::BeginRule(const char *aTable, const char *aChain)
+{
+    BeginMessage(NFT_MSG_NEWRULE, NLM_F_REQUEST | NLM_F_CREATE | NLM_F_APPEND | NLM_F_ACK, NFPROTO_IPV6);
+    PutString(NFTA_RULE_TABLE, aTable);
+    PutString(NFTA_RULE_CHAIN, aChain);
+    mExpressionsOffset = BeginNested(NFTA_RULE_EXPRESSIONS);
+}
+
+void NftablesBatch::MatchInputInterface(const char *aIfName)
+{
+    // The interface name is compared with its zero padding, which makes it an exact match.
+    char name[IFNAMSIZ];
+
+    memset(name, 0, sizeof(name));
+    strncpy(name, aIfName, sizeof(name) - 1);
+
+    PutMeta(NFT_META_IIFNAME);
+    PutCompare(name, sizeof(name));
+}
+
+void NftablesBatch::MatchDestinationPrefix(const Ip6Prefix &aPrefix)
+{
+    Ip6Address mask;
+    Ip6Address prefix;
+    Ip6Address zero;
+
+    for (uint8_t i = 0; i < sizeof(mask.m8); ++i)
+    {
+        uint8_t bits = aPrefix.mLength > i * 8 ? aPrefix.mLength - i * 8 : 0;
+
+        mask.m8[i]   = bits >= 8 ? 0xff : static_cast<uint8_t>(0xff << (8 - bits));
+        prefix.m8[i] = aPrefix.mPrefix.m8[i] & mask.m8[i];
+    }
+
+    PutPayload(NFT_PAYLOAD_NETWORK_HEADER, offsetof(struct ip6_hdr, ip6_dst), sizeof(Ip6Address));
+
+    if (aPrefix.mLength < 128)
+    {
+        size_t nested;
+
+        BeginExpression("bitwise");
+        PutU32(NFTA_BITWISE_SREG, NFT_REG_1);
+        PutU32(NFTA_BITWISE_DREG, NFT_REG_1);
+        PutU32(NFTA_BITWISE_LEN, sizeof(mask.m8));
+        nested = BeginNested(NFTA_BITWISE_MASK);
+        PutAttribute(NFTA_DATA_VALUE, mask.m8, sizeof(mask.m8));
+        EndNested(nested);
+        nested = BeginNested(NFTA_BITWISE_XOR);
+        PutAttribute(NFTA_DATA_VALUE, zero.m8, sizeof(zero.m8));
+        EndNested(nested);
+        EndExpression();
+    }
+
+    PutCompare(prefix.m8, sizeof(prefix.m8));
+}
+
+void NftablesBatch::MatchIcmp6Type(uint8_t aType)
+{
+    uint8_t proto = IPPROTO_ICMPV6;
+
+    PutMeta(NFT_META_L4PROTO);
+    PutCompare(&proto, sizeof(proto));
+    PutPayload(NFT_PAYLOAD_TRANSPORT_HEADER, 0, sizeof(aType));
+    PutCompare(&aType, sizeof(aType));
+}
+
+void NftablesBatch::Queue(uint16_t aQueueNum, bool aBypass)
+{
+    BeginExpression("queue");
+    PutU16(NFTA_QUEUE_NUM, aQueueNum);
+    PutU16(NFTA_QUEUE_TOTAL, 1);
+    PutU16(NFTA_QUEUE_FLAGS, aBypass ? NFT_QUEUE_FLAG_BYPASS : 0);
+    EndExpression();
+}
+
+void NftablesBatch::EndRule(void)
+{
+    EndNested(mExpressionsOffset);
+    EndMessage();
+}
+
+otbrError NftablesBatch::Commit(void)
+{
+    otbrError          error = OTBR_ERROR_NONE;
+    int                fd    = -1;
+    uint32_t           acks  = 0;
+    struct sockaddr_nl kernel;
+    struct timeval     timeout;
+    uint8_t            buffer[kReceiveBufferSize];
+
+    BeginMessage(NFNL_MSG_BATCH_END, NLM_F_REQUEST, AF_UNSPEC);
+    EndMessage();
+
+    fd = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_NETFILTER);
+    VerifyOrExit(fd >= 0, error = OTBR_ERROR_ERRNO);
+
+    timeout.tv_sec  = kReceiveTimeout;
+    timeout.tv_usec = 0;
+    VerifyOrExit(setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout)) == 0, error = OTBR_ERROR_ERRNO);
+
+    memset(&kernel, 0, sizeof(kernel));
+    kernel.nl_family = AF_NETLINK;
+
+    VerifyOrExit(sendto(fd, mBuffer.data(), mBuffer.size(), 0, reinterpret_cast<struct sockaddr *>(&kernel),
+                        sizeof(kernel)) == static_cast<ssize_t>(mBuffer.size()),
+                 error = OTBR_ERROR_ERRNO);
+
+    // Every change is acknowledged, the first failure aborts the whole batch.
+    while (acks < mAckCount)
+    {
+        ssize_t len = recv(fd, buffer, sizeof(buffer), 0);
+
+        VerifyOrExit(len > 0, error = OTBR_ERROR_ERRNO);
+
+        for (struct nlmsghdr *hdr = reinterpret_cast<struct nlmsghdr *>(buffer); NLMSG_OK(hdr, len);
+             hdr                  = NLMSG_NEXT(hdr, len))
+        {
+            if (hdr->nlmsg_type == NLMSG_ERROR)
+            {
+                const struct nlmsgerr *err = static_cast<const struct nlmsgerr *>(NLMSG_DATA(hdr));
+
+                if (err->error != 0)
+                {
+                    errno = -err->error;
+                    ExitNow(error = OTBR_ERROR_ERRNO);
+                }
+
+                ++acks;
+            }
+        }
+    }
+
+exit:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    otbrLogResult(error, "NftablesBatch: commit %u change(s)", mAckCount);
+    return error;
+}
+
+void NftablesBatch::BeginMessage(uint16_t aType, uint16_t aFlags, uint8_t aFamily)
+{
+    struct nlmsghdr hdr;
+    struct nfgenmsg msg;
+
+    memset(&hdr, 0, sizeof(hdr));
+    hdr.nlmsg_flags = aFlags;
+    hdr.nlmsg_seq   = mSequence++;
+
+    if (aType == NFNL_MSG_BATCH_BEGIN || aType == NFNL_MSG_BATCH_END)
+    {
+        hdr.nlmsg_type = aType;
+    }
+    else
+    {
+        hdr.nlmsg_type = static_cast<uint16_t>(NFNL_SUBSYS_NFTABLES << 8 | aType);
+    }
+
+    if (aFlags & NLM_F_ACK)
+    {
+        ++mAckCount;
+    }
+
+    memset(&msg, 0, sizeof(msg));
+    msg.nfgen_family = aFamily;
+    msg.version      = NFNETLINK_V0;
+    msg.res_id       = htons(NFNL_SUBSYS_NFTABLES);
+
+    mMessageOffset = mBuffer.size();
+    mBuffer.insert(mBuffer.end(), reinterpret_cast<uint8_t *>(&hdr), reinterpret_cast<uint8_t *>(&hdr) + sizeof(hdr));
+    mBuffer.insert(mBuffer.end(), reinterpret_cast<uint8_t *>(&msg), reinterpret_cast<uint8_t *>(&msg) + sizeof(msg));
+    AlignBuffer();
+}
+
+void NftablesBatch::EndMessage(void)
+{
+    uint32_t length = static_cast<uint32_t>(mBuffer.size() - mMessageOffset);
+
+    memcpy(&mBuffer[mMessageOffset + offsetof(struct nlmsghdr, nlmsg_len)], &length, sizeof(length));
+}
+
+void NftablesBatch::PutAttribute(uint16_t aType, const void *aData, size_t aLength)
+{
+    struct nlattr attr;
+
+    attr.nla_len  = static_cast<uint16_t>(NLA_HDRLEN + aLength);
+    attr.nla_type = aType;
+
+    mBuffer.insert(mBuffer.end(), reinterpret_cast<uint8_t *>(&attr),
+                   reinterpret_cast<uint8_t *>(&attr) + sizeof(attr));
+    mBuffer.insert(mBuffer.end(), static_cast<const uint8_t *>(aData), static_cast<const uint8_t *>(aData) + aLength);
+    AlignBuffer();
+}
+
+void NftablesBatch::PutString(uint16_t aType, const char *aValue)
+{
+    PutAttribute(aType, aValue, strlen(aValue) + 1);
+}
+
+void NftablesBatch::PutU16(uint16_t aType, uint16_t aValue)
+{
+    uint16_t value = htons(aValue);
+
+    PutAttribute(aType, &value, sizeof(value));
+}
+
+void NftablesBatch::PutU32(uint16_t aType, uint32_t aValue)
+{
+    uint32_t value = htonl(aValue);
+
+    PutAttribute(aType, &value, sizeof(value));
+}
+
+size_t NftablesBatch::BeginNested(uint16_t aType)
+{
+    size_t offset = mBuffer.size();
+
+    PutAttribute(aType | NLA_F_NESTED, nullptr, 0);
+
+    return offset;
+}
+
+void NftablesBatch::EndNested(size_t aOffset)
+{
+    uint16_t length = static_cast<uint16_t>(mBuffer.size() - aOffset);
+
+    memcpy(&mBuffer[aOffset + offsetof(struct nlattr, nla_len)], &length, sizeof(length));
+}
+
+void NftablesBatch::BeginExpression(const char *aName)
+{
+    mExpressionOffsets[0] = BeginNested(NFTA_LIST_ELEM);
+    PutString(NFTA_EXPR_NAME, aName);
+    mExpressionOffsets[1] = BeginNested(NFTA_EXPR_DATA);
+}
+
+void NftablesBatch::EndExpression(void)
+{
+    EndNested(mExpressionOffsets[1]);
+    EndNested(mExpressionOffsets[0]);
+}
+
+void NftablesBatch::PutCompare(const void *aData, size_t aLength)
+{
+    size_t data;
+
+    BeginExpression("cmp");
+    PutU32(NFTA_CMP_SREG, NFT_REG_1);
+    PutU32(NFTA_CMP_OP, NFT_CMP_EQ);
+    data = BeginNested(NFTA_CMP_DATA);
+    PutAttribute(NFTA_DATA_VALUE, aData, aLength);
+    EndNested(data);
+    EndExpression();
+}
+
+void NftablesBatch::PutPayload(uint32_t aBase, uint32_t aOffset, uint32_t aLength)
+{
+    BeginExpression("payload");
+    PutU32(NFTA_PAYLOAD_DREG, NFT_REG_1);
+    PutU32(NFTA_PAYLOAD_BASE, aBase);
+    PutU32(NFTA_PAYLOAD_OFFSET, aOffset);
+    PutU32(NFTA_PAYLOAD_LEN, aLength);
+    EndExpression();
+}
+
+void NftablesBatch::PutMeta(uint32_t aKey)
+{
+    BeginExpression("meta");
+    PutU32(NFTA_META_KEY, aKey);
+    PutU32(NFTA_META_DREG, NFT_REG_1);
+    EndExpression();
+}
+
+void NftablesBatch::AlignBuffer(void)
+{
+    mBuffer.resize(NLMSG_ALIGN(mBuffer.size()), 0);
+}
+
+} // namespace otbr
@@ -0,0 +1,185 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for programming nftables through netlink.
+ */
+
+#ifndef OTBR_UTILS_NFTABLES_HPP_
+#define OTBR_UTILS_NFTABLES_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "common/types.hpp"
+
+namespace otbr {
+
+/**
+ * This class builds a batch of nftables changes and commits it to the kernel over netlink.
+ *
+ * All tables belong to the `ip6` family. The kernel applies a committed batch atomically: either every change takes
+ * effect or none does. No process is spawned, which makes it much cheaper than running `ip6tables` or `nft`.
+ *
+ */
+class NftablesBatch
+{
+public:
+    /**
+     * This constructor initializes an empty batch.
+     *
+     */
+    NftablesBatch(void);
+
+    /**
+     * This method adds a table. Adding a table which already exists is not an error.
+     *
+     * @param[in]  aTable  The table name.
+     *
+     */
+    void AddTable(const char *aTable);
+
+    /**
+     * This method deletes a table together with its chains and rules.
+     *
+     * @param[in]  aTable  The table name.
+     *
+     */
+    void DeleteTable(const char *aTable);
+
+    /**
+     * This method adds a base chain of type `filter`.
+     *
+     * @param[in]  aTable     The table name.
+     * @param[in]  aChain     The chain name.
+     * @param[in]  aHook      The netfilter hook, for example `NF_INET_PRE_ROUTING`.
+     * @param[in]  aPriority  The chain priority, for example `NF_IP6_PRI_RAW`.
+     *
+     */
+    void AddChain(const char *aTable, const char *aChain, uint32_t aHook, int32_t aPriority);
+
+    /**
+     * This method starts a rule appended to a chain.
+     *
+     * The matches and the verdict of the rule are added by the following calls, up to EndRule().
+     *
+     * @param[in]  aTable  The table name.
+     * @param[in]  aChain  The chain name.
+     *
+     */
+    void BeginRule(const char *aTable, const char *aChain);
+
+    /**
+     * This method matches packets received on a given interface.
+     *
+     * @param[in]  aIfName  The interface name.
+     *
+     */
+    void MatchInputInterface(const char *aIfName);
+
+    /**
+     * This method matches packets whose IPv6 destination is within a prefix.
+     *
+     * @param[in]  aPrefix  The IPv6 prefix.
+     *
+     */
+    void MatchDestinationPrefix(const Ip6Prefix &aPrefix);
+
+    /**
+     * This method matches ICMPv6 messages of a given type.
+     *
+     * @param[in]  aType  The ICMPv6 type.
+     *
+     */
+    void MatchIcmp6Type(uint8_t aType);
+
+    /**
+     * This method sends matching packets to an NFQUEUE.
+     *
+     * @param[in]  aQueueNum  The queue number.
+     * @param[in]  aBypass    Whether packets are accepted when no program listens on the queue.
+     *
+     */
+    void Queue(uint16_t aQueueNum, bool aBypass);
+
+    /**
+     * This method ends the rule started by BeginRule().
+     *
+     */
+    void EndRule(void);
+
+    /**
+     * This method sends the batch to the kernel and waits until it is applied.
+     *
+     * @retval OTBR_ERROR_NONE   The batch was applied.
+     * @retval OTBR_ERROR_ERRNO  The batch could not be sent or was rejected, errno tells why.
+     *
+     */
+    otbrError Commit(void);
+
+    /**
+     * This method returns the netlink messages of the batch, including its begin and end markers.
+     *
+     */
+    const uint8_t *GetData(void) const { return mBuffer.data(); }
+
+    /**
+     * This method returns the length in bytes of the netlink messages of the batch.
+     *
+     */
+    size_t GetLength(void) const { return mBuffer.size(); }
+
+private:
+    void   BeginMessage(uint16_t aType, uint16_t aFlags, uint8_t aFamily);
+    void   EndMessage(void);
+    void   PutAttribute(uint16_t aType, const void *aData, size_t aLength);
+    void   PutString(uint16_t aType, const char *aValue);
+    void   PutU16(uint16_t aType, uint16_t aValue);
+    void   PutU32(uint16_t aType, uint32_t aValue);
+    size_t BeginNested(uint16_t aType);
+    void   EndNested(size_t aOffset);
+    void   BeginExpression(const char *aName);
+    void   EndExpression(void);
+    void   PutCompare(const void *aData, size_t aLength);
+    void   PutPayload(uint32_t aBase, uint32_t aOffset, uint32_t aLength);
+    void   PutMeta(uint32_t aKey);
+    void   AlignBuffer(void);
+
+    std::vector<uint8_t> mBuffer;
+    size_t               mMessageOffset;
+    size_t               mExpressionsOffset;
+    size_t               mExpressionOffsets[2];
+    uint32_t             mSequence;
+    uint32_t             mAckCount;
+};
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_NFTABLES_HPP_
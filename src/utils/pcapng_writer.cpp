@@ -0,0 +1,158 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a pcapng writer for IEEE 802.15.4 frames.
+ */
+
+#include "utils/pcapng_writer.hpp"
+
+#include <string.h>
+
+namespace otbr {
+
+namespace Utils {
+
+static const char kUserApplication[] = "otbr-agent";
+
+void PcapngWriter::WriteHeader(const char *aInterfaceName)
+{
+    BeginBlock(kBlockSectionHeader);
+    Write<uint32_t>(kByteOrderMagic);
+    Write<uint16_t>(1); // Major version.
+    Write<uint16_t>(0); // Minor version.
+    Write<int64_t>(-1); // The section length is not known.
+    WriteOption(kOptionShbUserAppl, kUserApplication, sizeof(kUserApplication) - 1);
+    WriteOption(kOptionEndOfOptions, nullptr, 0);
+    EndBlock();
+
+    BeginBlock(kBlockInterfaceDescription);
+    Write<uint16_t>(kLinkTypeIeee802154Tap);
+    Write<uint16_t>(0); // Reserved.
+    Write<uint32_t>(0); // No snapshot length limit.
+    WriteOption(kOptionIfName, aInterfaceName, static_cast<uint16_t>(strlen(aInterfaceName)));
+    WriteOption(kOptionEndOfOptions, nullptr, 0);
+    EndBlock();
+}
+
+void PcapngWriter::WriteFrame(const FrameInfo &aInfo, const uint8_t *aPsdu, uint16_t aLength)
+{
+    // The TAP header (4) and the TLVs of 4-byte values, the RSS and the LQI are only known for received frames.
+    uint16_t tapLength = 4 + 8 + 8 + (aInfo.mIsTx ? 0 : 16);
+    uint32_t flags     = aInfo.mIsTx ? 2 : 1; // The direction is outbound or inbound.
+    uint8_t  fcsType   = 1;                   // The 16-bit CRC.
+    uint8_t  channel[] = {aInfo.mChannel, 0, 0};
+
+    BeginBlock(kBlockEnhancedPacket);
+    Write<uint32_t>(0); // The interface id.
+    Write<uint32_t>(static_cast<uint32_t>(aInfo.mTimestamp >> 32));
+    Write<uint32_t>(static_cast<uint32_t>(aInfo.mTimestamp));
+    Write<uint32_t>(tapLength + aLength); // The captured length.
+    Write<uint32_t>(tapLength + aLength); // The original length.
+
+    // The TAP header is little-endian whatever the byte order of the section.
+    mBuffer.push_back(0); // Version.
+    mBuffer.push_back(0); // Reserved.
+    WriteLe16(tapLength);
+    WriteTapTlv(kTapFcsType, &fcsType, sizeof(fcsType));
+    WriteTapTlv(kTapChannelAssignment, channel, sizeof(channel));
+
+    if (!aInfo.mIsTx)
+    {
+        float    rss = aInfo.mRssi;
+        uint32_t bits;
+        uint8_t  rssLe[4];
+
+        memcpy(&bits, &rss, sizeof(bits));
+        for (uint8_t &byte : rssLe)
+        {
+            byte = static_cast<uint8_t>(bits);
+            bits >>= 8;
+        }
+
+        WriteTapTlv(kTapRss, rssLe, sizeof(rssLe));
+        WriteTapTlv(kTapLqi, &aInfo.mLqi, sizeof(aInfo.mLqi));
+    }
+
+    mBuffer.append(reinterpret_cast<const char *>(aPsdu), aLength);
+    Pad();
+
+    WriteOption(kOptionEpbFlags, &flags, sizeof(flags));
+    WriteOption(kOptionEndOfOptions, nullptr, 0);
+    EndBlock();
+}
+
+void PcapngWriter::WriteLe16(uint16_t aValue)
+{
+    mBuffer.push_back(static_cast<char>(aValue & 0xff));
+    mBuffer.push_back(static_cast<char>(aValue >> 8));
+}
+
+void PcapngWriter::WriteOption(uint16_t aCode, const void *aValue, uint16_t aLength)
+{
+    Write<uint16_t>(aCode);
+    Write<uint16_t>(aLength);
+    mBuffer.append(static_cast<const char *>(aValue), aLength);
+    Pad();
+}
+
+void PcapngWriter::WriteTapTlv(uint16_t aType, const void *aValue, uint16_t aLength)
+{
+    WriteLe16(aType);
+    WriteLe16(aLength);
+    mBuffer.append(static_cast<const char *>(aValue), aLength);
+    Pad();
+}
+
+void PcapngWriter::Pad(void)
+{
+    while ((mBuffer.size() - mBlockStart) % 4 != 0)
+    {
+        mBuffer.push_back(0);
+    }
+}
+
+void PcapngWriter::BeginBlock(uint32_t aType)
+{
+    mBlockStart = mBuffer.size();
+    Write<uint32_t>(aType);
+    Write<uint32_t>(0); // The block length, written by `EndBlock()`.
+}
+
+void PcapngWriter::EndBlock(void)
+{
+    uint32_t length = static_cast<uint32_t>(mBuffer.size() - mBlockStart + sizeof(uint32_t));
+
+    Write<uint32_t>(length);
+    memcpy(&mBuffer[mBlockStart + sizeof(uint32_t)], &length, sizeof(length));
+}
+
+} // namespace Utils
+
+} // namespace otbr
@@ -0,0 +1,149 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions of a pcapng writer for IEEE 802.15.4 frames.
+ */
+
+#ifndef OTBR_UTILS_PCAPNG_WRITER_HPP_
+#define OTBR_UTILS_PCAPNG_WRITER_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+namespace otbr {
+
+namespace Utils {
+
+/**
+ * This class implements a writer of pcapng blocks for IEEE 802.15.4 frames.
+ *
+ * The blocks are written in host byte order, which the section header tells readers. Each frame is prefixed with an
+ * IEEE 802.15.4 TAP header (link type 283) carrying the channel, RSSI and LQI, and includes the FCS.
+ *
+ */
+class PcapngWriter
+{
+public:
+    static constexpr uint16_t kLinkTypeIeee802154Tap = 283; ///< LINKTYPE_IEEE802_15_4_TAP.
+
+    /**
+     * This structure represents the metadata of a captured frame.
+     *
+     */
+    struct FrameInfo
+    {
+        uint64_t mTimestamp; ///< The capture time in microseconds since the Unix epoch.
+        uint8_t  mChannel;   ///< The channel the frame was sent or received on.
+        int8_t   mRssi;      ///< The RSSI in dBm, `kInvalidRssi` if unknown.
+        uint8_t  mLqi;       ///< The LQI, zero if unknown.
+        bool     mIsTx;      ///< Whether the frame was sent by this device.
+    };
+
+    static constexpr int8_t kInvalidRssi = 127; ///< The RSSI of a frame sent by this device.
+
+    /**
+     * The constructor initializes a writer appending to a buffer.
+     *
+     * @param[inout]    aBuffer     The buffer to append the blocks to.
+     *
+     */
+    explicit PcapngWriter(std::string &aBuffer)
+        : mBuffer(aBuffer)
+    {
+    }
+
+    /**
+     * This method writes the section header block and the interface description block which start a capture.
+     *
+     * @param[in]   aInterfaceName  The name of the capture interface.
+     *
+     */
+    void WriteHeader(const char *aInterfaceName);
+
+    /**
+     * This method writes an enhanced packet block with a frame.
+     *
+     * @param[in]   aInfo       The metadata of the frame.
+     * @param[in]   aPsdu       The frame including the FCS.
+     * @param[in]   aLength     The length of the frame.
+     *
+     */
+    void WriteFrame(const FrameInfo &aInfo, const uint8_t *aPsdu, uint16_t aLength);
+
+private:
+    enum : uint32_t
+    {
+        kBlockSectionHeader        = 0x0a0d0d0a,
+        kBlockInterfaceDescription = 0x00000001,
+        kBlockEnhancedPacket       = 0x00000006,
+        kByteOrderMagic            = 0x1a2b3c4d,
+    };
+
+    enum : uint16_t
+    {
+        kOptionEndOfOptions = 0,
+        kOptionShbUserAppl  = 4,
+        kOptionIfName       = 2,
+        kOptionEpbFlags     = 2,
+    };
+
+    enum : uint16_t
+    {
+        kTapFcsType           = 0,  // The FCS type, 1 for the 16-bit CRC.
+        kTapRss               = 1,  // The received signal strength in dBm, a float.
+        kTapChannelAssignment = 3,  // The channel (2) and the channel page (1).
+        kTapLqi               = 10, // The link quality indicator.
+    };
+
+    template <typename Type> void Write(Type aValue)
+    {
+        mBuffer.append(reinterpret_cast<const char *>(&aValue), sizeof(aValue));
+    }
+
+    void WriteLe16(uint16_t aValue);
+    void WriteOption(uint16_t aCode, const void *aValue, uint16_t aLength);
+    void WriteTapTlv(uint16_t aType, const void *aValue, uint16_t aLength);
+    void Pad(void);
+    void BeginBlock(uint32_t aType);
+    void EndBlock(void);
+
+    std::string &mBuffer;
+    size_t       mBlockStart;
+};
+
+} // namespace Utils
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_PCAPNG_WRITER_HPP_
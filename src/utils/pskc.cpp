@@ -33,12 +33,19 @@
 
 #include "utils/pskc.hpp"
 
+#include <mbedtls/aes.h>
+#include <mbedtls/sha256.h>
+
 #include "common/code_utils.hpp"
 #include "common/logging.hpp"
 
 namespace otbr {
 namespace Psk {
 
+Pskc::CacheEntry Pskc::sCache[Pskc::kCacheSize];
+uint8_t          Pskc::sCacheNext = 0;
+std::mutex       Pskc::sCacheMutex;
+
 void Pskc::SetSalt(const uint8_t *aExtPanId, const char *aNetworkName)
 {
     const char *saltPrefix = "Thread";
@@ -68,16 +75,80 @@ exit:
 
 const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase)
 {
-    uint32_t blockCounter = 0;
-    uint16_t useLen       = 0;
-    uint16_t prfBlockLen  = MBEDTLS_CIPHER_BLKSIZE_MAX;
-    uint8_t  prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
-    uint8_t  prfOutput[MBEDTLS_CIPHER_BLKSIZE_MAX];
-    uint8_t  keyBlock[MBEDTLS_CIPHER_BLKSIZE_MAX];
-    uint16_t keyLen = OT_PSKC_LENGTH;
-    uint8_t *pskc   = mPskc;
+    CacheEntry                  entry;
+    std::lock_guard<std::mutex> lock(sCacheMutex);
+
+    memcpy(entry.mExtPanId, aExtPanId, sizeof(entry.mExtPanId));
+    entry.mNetworkName = aNetworkName;
+    HashPassphrase(aPassphrase, entry.mPassphraseHash);
+
+    for (const CacheEntry &cached : sCache)
+    {
+        if (cached.Matches(entry))
+        {
+            memcpy(mPskc, cached.mPskc, sizeof(mPskc));
+            ExitNow();
+        }
+    }
 
     SetSalt(aExtPanId, aNetworkName);
+    DerivePskc(aPassphrase);
+
+    memcpy(entry.mPskc, mPskc, sizeof(entry.mPskc));
+    sCache[sCacheNext] = entry;
+    sCacheNext         = (sCacheNext + 1) % kCacheSize;
+
+exit:
+    return mPskc;
+}
+
+void Pskc::HashPassphrase(const char *aPassphrase, uint8_t *aHash)
+{
+    mbedtls_sha256_context sha256;
+
+    mbedtls_sha256_init(&sha256);
+    mbedtls_sha256_starts(&sha256, 0);
+    mbedtls_sha256_update(&sha256, reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase));
+    mbedtls_sha256_finish(&sha256, aHash);
+    mbedtls_sha256_free(&sha256);
+}
+
+void Pskc::DerivePskc(const char *aPassphrase)
+{
+    const mbedtls_cipher_info_t *cipherInfo   = mbedtls_cipher_info_from_type(MBEDTLS_CIPHER_AES_128_ECB);
+    const uint8_t *              passphrase   = reinterpret_cast<const uint8_t *>(aPassphrase);
+    size_t                       passLen      = strlen(aPassphrase);
+    uint32_t                     blockCounter = 0;
+    uint16_t                     useLen       = 0;
+    uint16_t                     keyLen       = OT_PSKC_LENGTH;
+    uint8_t *                    pskc         = mPskc;
+    uint8_t                      subkey[kBlockSize] = {0};
+    uint8_t                      prfKey[kBlockSize];
+    uint8_t                      prfInput[OT_PBKDF2_SALT_MAX_LENGTH + 4];
+    uint8_t                      prfOutput[kBlockSize];
+    uint8_t                      keyBlock[kBlockSize];
+    mbedtls_aes_context          aes;
+
+    // AES-CMAC-PRF-128 (RFC 4615) keys AES-CMAC with the passphrase itself when it is 16 bytes long, and with
+    // the AES-CMAC of the passphrase under the all-zero key otherwise. It is derived once rather than per iteration.
+    if (passLen == kBlockSize)
+    {
+        memcpy(prfKey, passphrase, kBlockSize);
+    }
+    else
+    {
+        uint8_t zeroKey[kBlockSize] = {0};
+
+        mbedtls_cipher_cmac(cipherInfo, zeroKey, kBlockSize * 8, passphrase, passLen, prfKey);
+    }
+
+    // The AES key schedule is expanded once. mbedtls uses the AES instructions of the CPU when they are available.
+    mbedtls_aes_init(&aes);
+    mbedtls_aes_setkey_enc(&aes, prfKey, kBlockSize * 8);
+
+    // K1 = double(AES(K, 0^128)) is the subkey AES-CMAC applies to a message of exactly one complete block.
+    mbedtls_aes_crypt_ecb(&aes, MBEDTLS_AES_ENCRYPT, subkey, subkey);
+    DoubleSubkey(subkey);
 
     while (keyLen)
     {
@@ -89,31 +160,53 @@ const uint8_t *Pskc::ComputePskc(const uint8_t *aExtPanId, const char *aNetworkN
         prfInput[mSaltLen + 2] = (uint8_t)(blockCounter >> 8);
         prfInput[mSaltLen + 3] = (uint8_t)(blockCounter);
         // Calculate U_1
-        mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
-                                 mSaltLen + 4, prfOutput);
-        memcpy(keyBlock, prfOutput, prfBlockLen);
+        mbedtls_cipher_cmac(cipherInfo, prfKey, kBlockSize * 8, prfInput, mSaltLen + 4, prfOutput);
+        memcpy(keyBlock, prfOutput, kBlockSize);
 
         for (uint32_t i = 1; i < OT_ITERATION_COUNTS; i++)
         {
-            memcpy(prfInput, prfOutput, prfBlockLen);
+            // Calculate U_i, the AES-CMAC of the single block U_(i-1) is AES(K, U_(i-1) xor K1).
+            for (uint32_t j = 0; j < kBlockSize; j++)
+            {
+                prfInput[j] = prfOutput[j] ^ subkey[j];
+            }
 
-            // Calculate U_i
-            mbedtls_aes_cmac_prf_128(reinterpret_cast<const uint8_t *>(aPassphrase), strlen(aPassphrase), prfInput,
-                                     prfBlockLen, prfOutput);
+            mbedtls_aes_crypt_ecb(&aes, MBEDTLS_AES_ENCRYPT, prfInput, prfOutput);
 
             // xor
-            for (uint32_t j = 0; j < prfBlockLen; j++)
+            for (uint32_t j = 0; j < kBlockSize; j++)
             {
                 keyBlock[j] ^= prfOutput[j];
             }
         }
 
-        useLen = (keyLen < prfBlockLen) ? keyLen : prfBlockLen;
+        useLen = (keyLen < kBlockSize) ? keyLen : static_cast<uint16_t>(kBlockSize);
         memcpy(pskc, keyBlock, useLen);
         pskc += useLen;
         keyLen -= useLen;
     }
-    return mPskc;
+
+    mbedtls_aes_free(&aes);
+    memset(prfKey, 0, sizeof(prfKey));
+}
+
+void Pskc::DoubleSubkey(uint8_t *aSubkey)
+{
+    const uint8_t kRb   = 0x87; // The constant of GF(2^128) used by AES-CMAC subkey generation.
+    uint8_t       carry = aSubkey[0] >> 7;
+
+    for (uint8_t i = 0; i < kBlockSize - 1; i++)
+    {
+        aSubkey[i] = static_cast<uint8_t>((aSubkey[i] << 1) | (aSubkey[i + 1] >> 7));
+    }
+
+    aSubkey[kBlockSize - 1] = static_cast<uint8_t>((aSubkey[kBlockSize - 1] << 1) ^ (carry ? kRb : 0));
+}
+
+bool Pskc::CacheEntry::Matches(const CacheEntry &aOther) const
+{
+    return mNetworkName == aOther.mNetworkName && !memcmp(mExtPanId, aOther.mExtPanId, sizeof(mExtPanId)) &&
+           !memcmp(mPassphraseHash, aOther.mPassphraseHash, sizeof(mPassphraseHash));
 }
 
 } // namespace Psk
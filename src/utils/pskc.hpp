@@ -45,6 +45,9 @@
 #include <stdint.h>
 #include <string.h>
 
+#include <mutex>
+#include <string>
+
 #include <mbedtls/cmac.h>
 
 namespace otbr {
@@ -62,6 +65,9 @@ public:
     /**
      * This method computes the PSKc.
      *
+     * The most recently computed PSKc values are cached, keyed on the extended PAN ID, the network name and the
+     * SHA-256 hash of the passphrase, so computing the PSKc of the same network again costs no PBKDF2 iterations.
+     *
      * @param[in]  aExtPanId      a pointer to extended PAN ID.
      * @param[in]  aNetworkName   a pointer to network name.
      * @param[in]  aPassphrase    a pointer to passphrase.
@@ -72,7 +78,31 @@ public:
     const uint8_t *ComputePskc(const uint8_t *aExtPanId, const char *aNetworkName, const char *aPassphrase);
 
 private:
-    void SetSalt(const uint8_t *aExtPanId, const char *aNetworkName);
+    enum
+    {
+        kBlockSize          = 16, ///< The AES block size.
+        kPassphraseHashSize = 32, ///< The SHA-256 hash size.
+        kCacheSize          = 8,  ///< The number of cached PSKc values.
+    };
+
+    struct CacheEntry
+    {
+        bool Matches(const CacheEntry &aOther) const;
+
+        uint8_t     mExtPanId[OT_EXTENDED_PAN_ID_LENGTH];
+        std::string mNetworkName;
+        uint8_t     mPassphraseHash[kPassphraseHashSize];
+        uint8_t     mPskc[OT_PSKC_LENGTH];
+    };
+
+    void        SetSalt(const uint8_t *aExtPanId, const char *aNetworkName);
+    void        DerivePskc(const char *aPassphrase);
+    static void HashPassphrase(const char *aPassphrase, uint8_t *aHash);
+    static void DoubleSubkey(uint8_t *aSubkey);
+
+    static CacheEntry sCache[kCacheSize];
+    static uint8_t    sCacheNext;
+    static std::mutex sCacheMutex;
 
     char     mSalt[OT_PBKDF2_SALT_MAX_LENGTH];
     uint16_t mSaltLen;
@@ -0,0 +1,164 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements SHA-1 computations.
+ */
+
+#include "utils/sha1.hpp"
+
+#include <string.h>
+
+#include "common/code_utils.hpp"
+
+namespace otbr {
+
+static uint32_t RotateLeft(uint32_t aValue, unsigned aBits)
+{
+    return (aValue << aBits) | (aValue >> (32 - aBits));
+}
+
+Sha1::Sha1(void)
+    : mState{0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0}
+    , mLength(0)
+{
+}
+
+void Sha1::Update(const uint8_t *aBuffer, size_t aLength)
+{
+    size_t used = mLength % kBlockSize;
+
+    mLength += aLength;
+
+    if (used != 0)
+    {
+        size_t length = kBlockSize - used < aLength ? kBlockSize - used : aLength;
+
+        memcpy(mBlock + used, aBuffer, length);
+        aBuffer += length;
+        aLength -= length;
+
+        VerifyOrExit(used + length == kBlockSize);
+        ProcessBlock(mBlock);
+    }
+
+    for (; aLength >= kBlockSize; aBuffer += kBlockSize, aLength -= kBlockSize)
+    {
+        ProcessBlock(aBuffer);
+    }
+
+    memcpy(mBlock, aBuffer, aLength);
+
+exit:
+    return;
+}
+
+void Sha1::Finish(uint8_t (&aHash)[kHashSize])
+{
+    uint64_t bits = mLength * 8;
+    uint8_t  padding[kBlockSize + 8] = {0x80};
+    size_t   used                    = mLength % kBlockSize;
+    size_t   paddingLength           = (used < kBlockSize - 8 ? kBlockSize - 8 : 2 * kBlockSize - 8) - used;
+
+    for (size_t i = 0; i < 8; i++)
+    {
+        padding[paddingLength + i] = static_cast<uint8_t>(bits >> (56 - 8 * i));
+    }
+
+    Update(padding, paddingLength + 8);
+
+    for (size_t i = 0; i < kHashSize; i++)
+    {
+        aHash[i] = static_cast<uint8_t>(mState[i / 4] >> (24 - 8 * (i % 4)));
+    }
+}
+
+void Sha1::ProcessBlock(const uint8_t *aBlock)
+{
+    uint32_t words[80];
+    uint32_t a = mState[0];
+    uint32_t b = mState[1];
+    uint32_t c = mState[2];
+    uint32_t d = mState[3];
+    uint32_t e = mState[4];
+
+    for (size_t i = 0; i < 16; i++)
+    {
+        words[i] = static_cast<uint32_t>(aBlock[4 * i]) << 24 | static_cast<uint32_t>(aBlock[4 * i + 1]) << 16 |
+                   static_cast<uint32_t>(aBlock[4 * i + 2]) << 8 | aBlock[4 * i + 3];
+    }
+
+    for (size_t i = 16; i < 80; i++)
+    {
+        words[i] = RotateLeft(words[i - 3] ^ words[i - 8] ^ words[i - 14] ^ words[i - 16], 1);
+    }
+
+    for (size_t i = 0; i < 80; i++)
+    {
+        uint32_t f;
+        uint32_t k;
+        uint32_t temp;
+
+        if (i < 20)
+        {
+            f = (b & c) | (~b & d);
+            k = 0x5a827999;
+        }
+        else if (i < 40)
+        {
+            f = b ^ c ^ d;
+            k = 0x6ed9eba1;
+        }
+        else if (i < 60)
+        {
+            f = (b & c) | (b & d) | (c & d);
+            k = 0x8f1bbcdc;
+        }
+        else
+        {
+            f = b ^ c ^ d;
+            k = 0xca62c1d6;
+        }
+
+        temp = RotateLeft(a, 5) + f + e + k + words[i];
+        e    = d;
+        d    = c;
+        c    = RotateLeft(b, 30);
+        b    = a;
+        a    = temp;
+    }
+
+    mState[0] += a;
+    mState[1] += b;
+    mState[2] += c;
+    mState[3] += d;
+    mState[4] += e;
+}
+
+} // namespace otbr
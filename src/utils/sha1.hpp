@@ -0,0 +1,98 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for SHA-1 computations.
+ */
+
+#ifndef OTBR_UTILS_SHA1_HPP_
+#define OTBR_UTILS_SHA1_HPP_
+
+#include "openthread-br/config.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace otbr {
+
+/**
+ * This class implements SHA-1 computations.
+ *
+ * SHA-1 is broken as a cryptographic hash, this is only for protocols which mandate it, like the WebSocket handshake.
+ *
+ */
+class Sha1
+{
+public:
+    enum
+    {
+        kHashSize = 20, ///< The size of a SHA-1 hash in bytes.
+    };
+
+    /**
+     * This constructor initializes the object.
+     *
+     */
+    Sha1(void);
+
+    /**
+     * This method feeds a buffer into the SHA-1 computation.
+     *
+     * @param[in]  aBuffer  A pointer to the buffer.
+     * @param[in]  aLength  The length of the buffer in bytes.
+     *
+     */
+    void Update(const uint8_t *aBuffer, size_t aLength);
+
+    /**
+     * This method finishes the SHA-1 computation.
+     *
+     * No more data may be fed afterwards.
+     *
+     * @param[out]  aHash  The SHA-1 hash.
+     *
+     */
+    void Finish(uint8_t (&aHash)[kHashSize]);
+
+private:
+    enum
+    {
+        kBlockSize = 64,
+    };
+
+    void ProcessBlock(const uint8_t *aBlock);
+
+    uint32_t mState[5];
+    uint64_t mLength;
+    uint8_t  mBlock[kBlockSize];
+};
+
+} // namespace otbr
+
+#endif // OTBR_UTILS_SHA1_HPP_
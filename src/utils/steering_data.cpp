@@ -35,6 +35,26 @@
 
 namespace otbr {
 
+static const uint32_t kSha256K[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+static const uint32_t kSha256InitialHash[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+};
+
+static inline uint32_t RotateRight(uint32_t aValue, uint8_t aBits)
+{
+    return (aValue >> aBits) | (aValue << (32 - aBits));
+}
+
 void SteeringData::Init(uint8_t aLength)
 {
     assert(aLength <= kMaxSizeOfBloomFilter);
@@ -47,7 +67,6 @@ void SteeringData::Init(uint8_t aLength)
 void SteeringData::ComputeJoinerId(const uint8_t *aEui64, uint8_t *aJoinerId)
 {
     const size_t           kSizeHashSha256Output = 32;
-    const size_t           kSizeEui64            = 8;
     uint8_t                hash[kSizeHashSha256Output];
     mbedtls_sha256_context sha256;
 
@@ -60,18 +79,118 @@ void SteeringData::ComputeJoinerId(const uint8_t *aEui64, uint8_t *aJoinerId)
     aJoinerId[0] |= 2;
 }
 
+void SteeringData::ComputeJoinerIds(const uint8_t *aEui64s, size_t aCount, uint8_t *aJoinerIds)
+{
+    for (size_t i = 0; i < aCount; i += kHashLanes)
+    {
+        size_t count = (aCount - i < kHashLanes) ? aCount - i : static_cast<size_t>(kHashLanes);
+
+        HashEui64s(aEui64s + i * kSizeEui64, count, aJoinerIds + i * kSizeJoinerId);
+    }
+}
+
+void SteeringData::HashEui64s(const uint8_t *aEui64s, size_t aCount, uint8_t *aJoinerIds)
+{
+    // An EUI64 fits in a single SHA-256 block: the 8 message bytes, the 0x80 terminator, zeros and the 64-bit
+    // message length in bits. The lanes are stored as structures of arrays so that every step below is the same
+    // operation on `kHashLanes` independent words.
+    uint32_t w[64][kHashLanes];
+    uint32_t work[8][kHashLanes];
+
+    memset(w, 0, sizeof(w));
+
+    for (size_t lane = 0; lane < aCount; lane++)
+    {
+        const uint8_t *eui64 = aEui64s + lane * kSizeEui64;
+
+        w[0][lane] = static_cast<uint32_t>(eui64[0] << 24 | eui64[1] << 16 | eui64[2] << 8 | eui64[3]);
+        w[1][lane] = static_cast<uint32_t>(eui64[4] << 24 | eui64[5] << 16 | eui64[6] << 8 | eui64[7]);
+    }
+
+    for (size_t lane = 0; lane < kHashLanes; lane++)
+    {
+        w[2][lane]  = 0x80000000;
+        w[15][lane] = kSizeEui64 * 8;
+    }
+
+    for (uint8_t t = 16; t < 64; t++)
+    {
+        for (size_t lane = 0; lane < kHashLanes; lane++)
+        {
+            uint32_t s0 = RotateRight(w[t - 15][lane], 7) ^ RotateRight(w[t - 15][lane], 18) ^ (w[t - 15][lane] >> 3);
+            uint32_t s1 = RotateRight(w[t - 2][lane], 17) ^ RotateRight(w[t - 2][lane], 19) ^ (w[t - 2][lane] >> 10);
+
+            w[t][lane] = w[t - 16][lane] + s0 + w[t - 7][lane] + s1;
+        }
+    }
+
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        for (size_t lane = 0; lane < kHashLanes; lane++)
+        {
+            work[i][lane] = kSha256InitialHash[i];
+        }
+    }
+
+    for (uint8_t t = 0; t < 64; t++)
+    {
+        for (size_t lane = 0; lane < kHashLanes; lane++)
+        {
+            uint32_t a = work[0][lane], b = work[1][lane], c = work[2][lane], d = work[3][lane];
+            uint32_t e = work[4][lane], f = work[5][lane], g = work[6][lane], h = work[7][lane];
+            uint32_t s1    = RotateRight(e, 6) ^ RotateRight(e, 11) ^ RotateRight(e, 25);
+            uint32_t ch    = (e & f) ^ (~e & g);
+            uint32_t temp1 = h + s1 + ch + kSha256K[t] + w[t][lane];
+            uint32_t s0    = RotateRight(a, 2) ^ RotateRight(a, 13) ^ RotateRight(a, 22);
+            uint32_t maj   = (a & b) ^ (a & c) ^ (b & c);
+            uint32_t temp2 = s0 + maj;
+
+            work[7][lane] = g;
+            work[6][lane] = f;
+            work[5][lane] = e;
+            work[4][lane] = d + temp1;
+            work[3][lane] = c;
+            work[2][lane] = b;
+            work[1][lane] = a;
+            work[0][lane] = temp1 + temp2;
+        }
+    }
+
+    // The joiner id is the first 8 bytes of the hash, i.e. the first two state words.
+    for (size_t lane = 0; lane < aCount; lane++)
+    {
+        uint8_t *joinerId = aJoinerIds + lane * kSizeJoinerId;
+
+        for (uint8_t i = 0; i < 2; i++)
+        {
+            uint32_t word = kSha256InitialHash[i] + work[i][lane];
+
+            joinerId[i * 4 + 0] = static_cast<uint8_t>(word >> 24);
+            joinerId[i * 4 + 1] = static_cast<uint8_t>(word >> 16);
+            joinerId[i * 4 + 2] = static_cast<uint8_t>(word >> 8);
+            joinerId[i * 4 + 3] = static_cast<uint8_t>(word);
+        }
+
+        joinerId[0] |= 2;
+    }
+}
+
+void SteeringData::ComputeBloomFilter(const uint8_t *aJoinerIds, size_t aCount)
+{
+    for (size_t i = 0; i < aCount; i++)
+    {
+        ComputeBloomFilter(aJoinerIds + i * kSizeJoinerId);
+    }
+}
+
 void SteeringData::ComputeBloomFilter(const uint8_t *aJoinerId)
 {
     Crc16          ccitt(Crc16::kCcitt);
     Crc16          ansi(Crc16::kAnsi);
     const uint16_t numBits = mLength * 8;
 
-    for (size_t i = 0; i < kSizeJoinerId; i++)
-    {
-        uint8_t byte = aJoinerId[i];
-        ccitt.Update(byte);
-        ansi.Update(byte);
-    }
+    ccitt.Update(aJoinerId, kSizeJoinerId);
+    ansi.Update(aJoinerId, kSizeJoinerId);
 
     SetBit(static_cast<uint8_t>(ccitt.Get() % numBits));
     SetBit(static_cast<uint8_t>(ansi.Get() % numBits));
@@ -36,6 +36,7 @@
 
 #include "openthread-br/config.h"
 
+#include <stddef.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -52,6 +53,8 @@ public:
     {
         kMaxSizeOfBloomFilter = 16, ///< Max length of bloom filter in bytes.
         kSizeJoinerId         = 8,  ///< Size of Extended Joiner ID.
+        kSizeEui64            = 8,  ///< Size of EUI64.
+        kHashLanes            = 8,  ///< Number of EUI64s hashed side by side by `ComputeJoinerIds()`.
     };
 
     /**
@@ -90,6 +93,15 @@ public:
      */
     void ComputeBloomFilter(const uint8_t *aJoinerId);
 
+    /**
+     * This method adds a list of joiners to the Bloom Filter.
+     *
+     * @param[in]  aJoinerIds  A pointer to @p aCount Joiner IDs of `kSizeJoinerId` bytes each, stored back-to-back.
+     * @param[in]  aCount      The number of Joiner IDs.
+     *
+     */
+    void ComputeBloomFilter(const uint8_t *aJoinerIds, size_t aCount);
+
     /**
      * This method computes joiner id from EUI64.
      *
@@ -99,6 +111,19 @@ public:
      */
     static void ComputeJoinerId(const uint8_t *aEui64, uint8_t *aJoinerId);
 
+    /**
+     * This method computes the joiner ids of a list of EUI64s.
+     *
+     * The SHA-256 hashes of up to `kHashLanes` EUI64s are computed side by side, which lets the compiler vectorize
+     * them.
+     *
+     * @param[in]   aEui64s     A pointer to @p aCount EUI64s of 8 bytes each, stored back-to-back.
+     * @param[in]   aCount      The number of EUI64s.
+     * @param[out]  aJoinerIds  A pointer to receive @p aCount joiner ids. This pointer can be the same as @p aEui64s.
+     *
+     */
+    static void ComputeJoinerIds(const uint8_t *aEui64s, size_t aCount, uint8_t *aJoinerIds);
+
     /**
      * This method returns a pointer to the bloom filter.
      *
@@ -114,6 +139,8 @@ public:
     uint8_t GetLength(void) const { return mLength; }
 
 private:
+    static void HashEui64s(const uint8_t *aEui64s, size_t aCount, uint8_t *aJoinerIds);
+
     uint8_t mBloomFilter[kMaxSizeOfBloomFilter];
     uint8_t mLength;
 };
@@ -33,11 +33,22 @@
 
 #include "system_utils.hpp"
 
+#include <errno.h>
+#include <signal.h>
+#include <spawn.h>
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <sys/wait.h>
 
+#include "common/code_utils.hpp"
 #include "common/logging.hpp"
+#include "common/mainloop_poller.hpp"
+
+extern char **environ;
 
 namespace otbr {
 namespace SystemUtils {
@@ -63,5 +74,185 @@ int ExecuteCommand(const char *aFormat, ...)
     return exitCode;
 }
 
+static int OpenPidFd(pid_t aPid)
+{
+#ifdef SYS_pidfd_open
+    return static_cast<int>(syscall(SYS_pidfd_open, aPid, 0));
+#else
+    OTBR_UNUSED_VARIABLE(aPid);
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+static int ConvertWaitStatus(int aStatus)
+{
+    return WIFEXITED(aStatus) ? WEXITSTATUS(aStatus) : 128 + WTERMSIG(aStatus);
+}
+
+CommandRunner &CommandRunner::Get(void)
+{
+    static CommandRunner sCommandRunner;
+
+    return sCommandRunner;
+}
+
+otbrError CommandRunner::Spawn(const std::vector<std::string> &aArgv, CompletionHandler aHandler)
+{
+    otbrError                 error = OTBR_ERROR_NONE;
+    std::vector<const char *> argv;
+    std::string               command;
+
+    VerifyOrExit(!aArgv.empty(), error = OTBR_ERROR_INVALID_ARGS);
+
+    for (const std::string &arg : aArgv)
+    {
+        argv.push_back(arg.c_str());
+        command += (command.empty() ? "" : " ") + arg;
+    }
+    argv.push_back(nullptr);
+
+    error = SpawnChild(argv.data(), std::move(command), std::move(aHandler));
+
+exit:
+    return error;
+}
+
+otbrError CommandRunner::Execute(const std::string &aCommand, CompletionHandler aHandler)
+{
+    const char *argv[] = {"/bin/sh", "-c", aCommand.c_str(), nullptr};
+
+    return SpawnChild(argv, aCommand, std::move(aHandler));
+}
+
+otbrError CommandRunner::ExecuteBatch(const std::vector<std::string> &aCommands, CompletionHandler aHandler)
+{
+    otbrError   error = OTBR_ERROR_NONE;
+    std::string batch;
+
+    VerifyOrExit(!aCommands.empty(), error = OTBR_ERROR_INVALID_ARGS);
+
+    // Each command is grouped, so that a list inside a command does not change where the batch stops.
+    for (const std::string &command : aCommands)
+    {
+        batch += (batch.empty() ? "{ " : " && { ") + command + "; }";
+    }
+
+    error = Execute(batch, std::move(aHandler));
+
+exit:
+    return error;
+}
+
+otbrError CommandRunner::SpawnChild(const char *const *aArgv, std::string aCommand, CompletionHandler aHandler)
+{
+    otbrError         error = OTBR_ERROR_NONE;
+    posix_spawnattr_t attr;
+    sigset_t          signals;
+    Child             child;
+    int               rval;
+
+    // The mainloop blocks or ignores some signals, the child starts with the defaults.
+    posix_spawnattr_init(&attr);
+    sigemptyset(&signals);
+    posix_spawnattr_setsigmask(&attr, &signals);
+    sigaddset(&signals, SIGPIPE);
+    sigaddset(&signals, SIGHUP);
+    sigaddset(&signals, SIGTERM);
+    posix_spawnattr_setsigdefault(&attr, &signals);
+    posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETSIGMASK | POSIX_SPAWN_SETSIGDEF);
+
+    rval = posix_spawnp(&child.mPid, aArgv[0], nullptr, &attr, const_cast<char *const *>(aArgv), environ);
+    posix_spawnattr_destroy(&attr);
+    VerifyOrExit(rval == 0, errno = rval, error = OTBR_ERROR_ERRNO);
+
+    child.mPidFd   = OpenPidFd(child.mPid);
+    child.mCommand = std::move(aCommand);
+    child.mHandler = std::move(aHandler);
+
+    if (child.mPidFd >= 0 &&
+        MainloopPoller::Get().Register(child.mPidFd, MainloopPoller::kEventRead) != OTBR_ERROR_NONE)
+    {
+        close(child.mPidFd);
+        child.mPidFd = -1;
+    }
+
+    otbrLog(OTBR_LOG_DEBUG, "Spawned %d: %s", static_cast<int>(child.mPid), child.mCommand.c_str());
+    mChildren.emplace_back(std::move(child));
+
+exit:
+    if (error != OTBR_ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Failed to spawn %s: %s", aCommand.c_str(), strerror(errno));
+    }
+    return error;
+}
+
+void CommandRunner::UpdateFdSet(otSysMainloopContext &aMainloop) const
+{
+    for (const Child &child : mChildren)
+    {
+        if (child.mPidFd < 0 && (aMainloop.mTimeout.tv_sec > 0 || aMainloop.mTimeout.tv_usec > kReapIntervalUs))
+        {
+            aMainloop.mTimeout.tv_sec  = 0;
+            aMainloop.mTimeout.tv_usec = kReapIntervalUs;
+            break;
+        }
+    }
+}
+
+void CommandRunner::Process(const otSysMainloopContext &aMainloop)
+{
+    std::vector<std::pair<CompletionHandler, int>> exited;
+
+    OTBR_UNUSED_VARIABLE(aMainloop);
+
+    for (auto it = mChildren.begin(); it != mChildren.end();)
+    {
+        int status;
+
+        if ((it->mPidFd >= 0 && !MainloopPoller::Get().IsReadable(it->mPidFd)) ||
+            waitpid(it->mPid, &status, WNOHANG) <= 0)
+        {
+            ++it;
+            continue;
+        }
+
+        if (it->mPidFd >= 0)
+        {
+            MainloopPoller::Get().Unregister(it->mPidFd);
+            close(it->mPidFd);
+        }
+
+        status = ConvertWaitStatus(status);
+        otbrLog(status == 0 ? OTBR_LOG_INFO : OTBR_LOG_WARNING, "$?=%-3d: %s", status, it->mCommand.c_str());
+
+        exited.emplace_back(std::move(it->mHandler), status);
+        it = mChildren.erase(it);
+    }
+
+    // The handlers are called last, they may run further commands.
+    for (auto &child : exited)
+    {
+        if (child.first)
+        {
+            child.first(child.second);
+        }
+    }
+}
+
+CommandRunner::~CommandRunner(void)
+{
+    // The children which are still running are left to finish on their own.
+    for (const Child &child : mChildren)
+    {
+        if (child.mPidFd >= 0)
+        {
+            MainloopPoller::Get().Unregister(child.mPidFd);
+            close(child.mPidFd);
+        }
+    }
+}
+
 } // namespace SystemUtils
 } // namespace otbr
@@ -34,6 +34,17 @@
 #ifndef OTBR_UTILS_SYSTEM_UTILS_HPP_
 #define OTBR_UTILS_SYSTEM_UTILS_HPP_
 
+#include "openthread-br/config.h"
+
+#include <sys/types.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "common/mainloop.h"
+#include "common/types.hpp"
+
 namespace otbr {
 namespace SystemUtils {
 
@@ -44,6 +55,8 @@ extern "C" {
 /**
  * This method formats a system command to execute.
  *
+ * The command runs synchronously, blocking the calling thread until it exits. Use `CommandRunner` on the mainloop.
+ *
  * @param[in] aFormat  A pointer to the format string.
  * @param[in] ...      Arguments for the format specification.
  *
@@ -56,6 +69,116 @@ int ExecuteCommand(const char *aFormat, ...);
 }
 #endif
 
+/**
+ * This class runs commands as child processes without blocking the mainloop.
+ *
+ * Commands are spawned with posix_spawn(), and the exit of each child is picked up by the mainloop through a pidfd
+ * registered with the `MainloopPoller`. On kernels without pidfd, the children are reaped by polling on a short
+ * timeout instead. Several commands can be batched into one shell invocation, to pay for a single process start.
+ *
+ */
+class CommandRunner
+{
+public:
+    /**
+     * This function is called when a command exits.
+     *
+     * @param[in]   aExitCode   The exit status of the command, or 128 plus the signal number if it was killed.
+     *
+     */
+    using CompletionHandler = std::function<void(int aExitCode)>;
+
+    /**
+     * This method returns the single `CommandRunner` instance of the mainloop.
+     *
+     * @returns  The single `CommandRunner` instance.
+     *
+     */
+    static CommandRunner &Get(void);
+
+    /**
+     * This method spawns a program without a shell.
+     *
+     * @param[in]   aArgv       The program and its arguments, the program is searched in PATH.
+     * @param[in]   aHandler    The handler called from the mainloop when the program exits, may be nullptr.
+     *
+     * @retval  OTBR_ERROR_NONE         Successfully spawned the program.
+     * @retval  OTBR_ERROR_INVALID_ARGS @p aArgv is empty.
+     * @retval  OTBR_ERROR_ERRNO        Failed to spawn the program.
+     *
+     */
+    otbrError Spawn(const std::vector<std::string> &aArgv, CompletionHandler aHandler);
+
+    /**
+     * This method runs a shell command.
+     *
+     * @param[in]   aCommand    The shell command.
+     * @param[in]   aHandler    The handler called from the mainloop when the command exits, may be nullptr.
+     *
+     * @retval  OTBR_ERROR_NONE     Successfully started the command.
+     * @retval  OTBR_ERROR_ERRNO    Failed to spawn the shell.
+     *
+     */
+    otbrError Execute(const std::string &aCommand, CompletionHandler aHandler);
+
+    /**
+     * This method runs several shell commands in one shell invocation.
+     *
+     * The commands run in order and the batch stops at the first command which fails.
+     *
+     * @param[in]   aCommands   The shell commands.
+     * @param[in]   aHandler    The handler called with the exit status of the last command run, may be nullptr.
+     *
+     * @retval  OTBR_ERROR_NONE         Successfully started the commands.
+     * @retval  OTBR_ERROR_INVALID_ARGS @p aCommands is empty.
+     * @retval  OTBR_ERROR_ERRNO        Failed to spawn the shell.
+     *
+     */
+    otbrError ExecuteBatch(const std::vector<std::string> &aCommands, CompletionHandler aHandler);
+
+    /**
+     * This method returns the number of commands which have not exited yet.
+     *
+     */
+    size_t GetPendingCount(void) const { return mChildren.size(); }
+
+    /**
+     * This method updates the mainloop context.
+     *
+     * @param[inout]    aMainloop   A reference to the mainloop to be updated.
+     *
+     */
+    void UpdateFdSet(otSysMainloopContext &aMainloop) const;
+
+    /**
+     * This method reaps the children which have exited and calls their handlers.
+     *
+     * @param[in]   aMainloop   A reference to the mainloop context.
+     *
+     */
+    void Process(const otSysMainloopContext &aMainloop);
+
+    ~CommandRunner(void);
+
+private:
+    // The interval to reap the children which have no pidfd.
+    static constexpr int kReapIntervalUs = 100000;
+
+    struct Child
+    {
+        pid_t             mPid;
+        int               mPidFd;
+        std::string       mCommand;
+        CompletionHandler mHandler;
+    };
+
+    CommandRunner(void) = default;
+
+    otbrError SpawnChild(const char *const *aArgv, std::string aCommand, CompletionHandler aHandler);
+
+    std::vector<Child> mChildren;
+};
+
 } // namespace SystemUtils
 } // namespace otbr
 
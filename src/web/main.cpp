@@ -73,12 +73,14 @@ int main(int argc, char **argv)
     const char *interfaceName  = nullptr;
     const char *httpListenAddr = nullptr;
     const char *httpPort       = nullptr;
+    const char *scanCacheAge   = nullptr;
+    const char *threads        = nullptr;
     int         logLevel       = OTBR_LOG_INFO;
     int         ret            = 0;
     int         opt;
     uint16_t    port = OT_HTTP_PORT;
 
-    while ((opt = getopt(argc, argv, "d:I:p:va:")) != -1)
+    while ((opt = getopt(argc, argv, "d:I:p:s:t:va:")) != -1)
     {
         switch (opt)
         {
@@ -98,13 +100,23 @@ int main(int argc, char **argv)
             port = atoi(httpPort);
             break;
 
+        case 's':
+            scanCacheAge = optarg;
+            break;
+
+        case 't':
+            threads = optarg;
+            break;
+
         case 'v':
             PrintVersion();
             ExitNow();
             break;
 
         default:
-            fprintf(stderr, "Usage: %s [-d DEBUG_LEVEL] [-I interfaceName] [-p port] [-a listenAddress] [-v]\n",
+            fprintf(stderr,
+                    "Usage: %s [-d DEBUG_LEVEL] [-I interfaceName] [-p port] [-a listenAddress] [-s scanCacheSeconds] "
+                    "[-t threads] [-v]\n",
                     argv[0]);
             ExitNow(ret = -1);
             break;
@@ -138,6 +150,18 @@ int main(int argc, char **argv)
     signal(SIGINT, HandleSignal);
 
     sServer.reset(new otbr::Web::WebServer());
+
+    if (scanCacheAge != nullptr)
+    {
+        sServer->SetScanCacheMaxAge(static_cast<uint32_t>(atoi(scanCacheAge)));
+    }
+
+    if (threads != nullptr)
+    {
+        VerifyOrExit(atoi(threads) > 0, fprintf(stderr, "Invalid number of threads: %s\n", threads), ret = -1);
+        sServer->SetThreadPoolSize(static_cast<size_t>(atoi(threads)));
+    }
+
     sServer->StartWebServer(interfaceName, httpListenAddr, port);
 
     otbrLogDeinit();
@@ -122,12 +122,30 @@
                 .ok('Okay')
             );
         };
+        $scope.statusSocket = null;
+        $scope.showStatus = function(data) {
+            if (data.error == 0) {
+                var statusJson = data.result;
+                $scope.status = [];
+                for (var i = 0; i < Object.keys(statusJson).length; i++) {
+                    $scope.status.push({
+                        name: Object.keys(statusJson)[i],
+                        value: statusJson[Object.keys(statusJson)[i]],
+                        icon: 'res/img/icon-info.png',
+                    });
+                }
+            }
+        };
         $scope.showPanels = function(index) {
             $scope.headerTitle = $scope.menu[index].title;
             for (var i = 0; i < 7; i++) {
                 $scope.menu[i].show = false;
             }
             $scope.menu[index].show = true;
+            if (index != 3 && $scope.statusSocket) {
+                $scope.statusSocket.close();
+                $scope.statusSocket = null;
+            }
             if (index == 1) {
                 $scope.isLoading = true;
                 $http.get('/available_network').then(function(response) {
@@ -139,21 +157,20 @@
                     }
                 });
             }
-            if (index == 3) {
-                $http.get('/get_properties').then(function(response) {
-                    console.log(response);
-                    if (response.data.error == 0) {
-                        var statusJson = response.data.result;
-                        $scope.status = [];
-                        for (var i = 0; i < Object.keys(statusJson).length; i++) {
-                            $scope.status.push({
-                                name: Object.keys(statusJson)[i],
-                                value: statusJson[Object.keys(statusJson)[i]],
-                                icon: 'res/img/icon-info.png',
-                            });
-                        }
-                    }
-                });
+            if (index == 3 && !$scope.statusSocket) {
+                // The server pushes the status on connection and whenever it changes.
+                var protocol = window.location.protocol == 'https:' ? 'wss://' : 'ws://';
+                $scope.statusSocket = new WebSocket(protocol + window.location.host + '/status_events');
+                $scope.statusSocket.onmessage = function(event) {
+                    $scope.$apply(function() {
+                        $scope.showStatus(JSON.parse(event.data));
+                    });
+                };
+                $scope.statusSocket.onerror = function() {
+                    $http.get('/get_properties').then(function(response) {
+                        $scope.showStatus(response.data);
+                    });
+                };
             }
             if (index == 6) {
                 $scope.dataInit();
@@ -30,8 +30,11 @@
 
 #include <openthread/platform/toolchain.h>
 
+#include <chrono>
+
 #include <errno.h>
 #include <inttypes.h>
+#include <poll.h>
 #include <signal.h>
 #include <stdarg.h>
 #include <stdio.h>
@@ -53,9 +56,13 @@
 namespace otbr {
 namespace Web {
 
-OpenThreadClient::OpenThreadClient(void)
+constexpr OpenThreadClient::CommandId OpenThreadClient::kInvalidCommandId;
+
+OpenThreadClient::OpenThreadClient(const char *aSocketPath)
     : mTimeout(kDefaultTimeout)
     , mSocket(-1)
+    , mSocketPath(aSocketPath != nullptr ? aSocketPath : OPENTHREAD_POSIX_APP_SOCKET_NAME)
+    , mNextCommandId(kInvalidCommandId + 1)
 {
 }
 
@@ -71,105 +78,250 @@ void OpenThreadClient::Disconnect(void)
         close(mSocket);
         mSocket = -1;
     }
+
+    // The responses of the pending commands are lost with the connection.
+    for (Command &command : mCommands)
+    {
+        if (command.mState == kCommandPending)
+        {
+            command.mState = kCommandFailed;
+        }
+    }
+
+    mReceived.clear();
 }
 
 bool OpenThreadClient::Connect(void)
 {
     struct sockaddr_un sockname;
-    int                ret;
+    int                ret = 0;
+
+    VerifyOrExit(mSocket == -1);
 
-    mSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+    mSocket = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
     VerifyOrExit(mSocket != -1, perror("socket"); ret = EXIT_FAILURE);
 
     memset(&sockname, 0, sizeof(struct sockaddr_un));
     sockname.sun_family = AF_UNIX;
-    strcpy_safe(sockname.sun_path, sizeof(sockname.sun_path), OPENTHREAD_POSIX_APP_SOCKET_NAME);
+    strcpy_safe(sockname.sun_path, sizeof(sockname.sun_path), mSocketPath.c_str());
 
     ret = connect(mSocket, reinterpret_cast<const struct sockaddr *>(&sockname), sizeof(struct sockaddr_un));
 
     if (ret == -1)
     {
         otbrLog(OTBR_LOG_ERR, "OpenThread daemon is not running.");
+        Disconnect();
     }
 
 exit:
     return ret == 0;
 }
 
-char *OpenThreadClient::Execute(const char *aFormat, ...)
+OpenThreadClient::CommandId OpenThreadClient::Send(const char *aFormat, ...)
 {
-    va_list args;
-    int     ret;
-    char *  rval = nullptr;
-    ssize_t count;
-    size_t  rxLength = 0;
+    va_list   args;
+    CommandId id;
 
     va_start(args, aFormat);
-    ret = vsnprintf(&mBuffer[1], sizeof(mBuffer) - 1, aFormat, args);
+    id = SendV(aFormat, args);
     va_end(args);
 
-    if (ret < 0)
+    return id;
+}
+
+OpenThreadClient::CommandId OpenThreadClient::SendV(const char *aFormat, va_list aArgs)
+{
+    CommandId id = kInvalidCommandId;
+    int       length;
+    int       sent = 0;
+
+    VerifyOrExit(mSocket != -1, otbrLog(OTBR_LOG_ERR, "Not connected to OpenThread daemon"));
+
+    length = vsnprintf(mBuffer, sizeof(mBuffer) - 1, aFormat, aArgs);
+    VerifyOrExit(length >= 0, otbrLog(OTBR_LOG_ERR, "Failed to generate command: %s", strerror(errno)));
+    VerifyOrExit(length < static_cast<int>(sizeof(mBuffer)) - 1,
+                 otbrLog(OTBR_LOG_ERR, "Command exceeds maximum limit: %d", kBufferSize));
+    mBuffer[length++] = '\n';
+
+    while (sent < length)
+    {
+        ssize_t count = send(mSocket, mBuffer + sent, static_cast<size_t>(length - sent), MSG_NOSIGNAL);
+
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+
+        VerifyOrExit(count > 0, otbrLog(OTBR_LOG_ERR, "Failed to send command: %s", strerror(errno)); Disconnect());
+        sent += static_cast<int>(count);
+    }
+
+    // Outputs of completed commands are only valid until the next command.
+    while (!mCommands.empty() && mCommands.front().mState != kCommandPending)
     {
-        otbrLog(OTBR_LOG_ERR, "Failed to generate command: %s", strerror(errno));
+        mCommands.pop_front();
     }
 
-    mBuffer[0] = '\n';
-    ret++;
+    id = mNextCommandId++;
 
-    if (ret == sizeof(mBuffer))
+    if (mNextCommandId == kInvalidCommandId)
     {
-        otbrLog(OTBR_LOG_ERR, "Command exceeds maximum limit: %d", kBufferSize);
+        mNextCommandId++;
     }
 
-    mBuffer[ret] = '\n';
-    ret++;
+    mCommands.push_back({id, kCommandPending, std::string()});
+
+exit:
+    return id;
+}
+
+char *OpenThreadClient::Wait(CommandId aId)
+{
+    char *   rval     = nullptr;
+    Command *command  = FindCommand(aId);
+    auto     deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(mTimeout);
 
-    count = write(mSocket, mBuffer, ret);
+    VerifyOrExit(command != nullptr);
 
-    if (count < ret)
+    while (command->mState == kCommandPending)
     {
-        mBuffer[ret] = '\0';
-        otbrLog(OTBR_LOG_ERR, "Failed to send command: %s", mBuffer);
+        struct pollfd pollFd;
+        int           timeout;
+        int           ret;
+
+        timeout = static_cast<int>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count());
+
+        // The response may still arrive later, which would be taken for the response of the next command.
+        VerifyOrExit(timeout > 0, otbrLog(OTBR_LOG_ERR, "Timeout waiting for OpenThread daemon"); Disconnect());
+
+        pollFd.fd     = mSocket;
+        pollFd.events = POLLIN;
+
+        ret = poll(&pollFd, 1, timeout);
+        VerifyOrExit(ret != -1 || errno == EINTR, Disconnect());
+
+        if (ret > 0)
+        {
+            VerifyOrExit(Receive(), Disconnect());
+        }
     }
 
-    for (int i = 0; i < mTimeout; ++i)
+    VerifyOrExit(command->mState == kCommandDone);
+    rval = &command->mOutput[0];
+
+exit:
+    return rval;
+}
+
+char *OpenThreadClient::Execute(const char *aFormat, ...)
+{
+    va_list   args;
+    CommandId id;
+
+    va_start(args, aFormat);
+    id = SendV(aFormat, args);
+    va_end(args);
+
+    return Wait(id);
+}
+
+bool OpenThreadClient::Receive(void)
+{
+    bool    rval = false;
+    ssize_t count;
+    size_t  begin = 0;
+    size_t  end;
+
+    count = recv(mSocket, mBuffer, sizeof(mBuffer), MSG_DONTWAIT);
+    VerifyOrExit(count > 0 || (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR)),
+                 otbrLog(OTBR_LOG_WARNING, "OpenThread daemon disconnected"));
+    rval = true;
+    VerifyOrExit(count > 0);
+
+    mReceived.append(mBuffer, static_cast<size_t>(count));
+
+    while ((end = mReceived.find('\n', begin)) != std::string::npos)
+    {
+        std::string line = mReceived.substr(begin, end - begin);
+
+        HandleLine(line);
+        begin = end + 1;
+    }
+
+    mReceived.erase(0, begin);
+
+exit:
+    return rval;
+}
+
+void OpenThreadClient::HandleLine(std::string &aLine)
+{
+    static const char kCliPrompt[] = "> ";
+    static const char kError[]     = "Error ";
+
+    Command *command = nullptr;
+
+    if (!aLine.empty() && aLine.back() == '\r')
+    {
+        aLine.pop_back();
+    }
+
+    while (aLine.compare(0, sizeof(kCliPrompt) - 1, kCliPrompt) == 0)
     {
-        fd_set  readFdSet;
-        timeval timeout = {0, 1000};
-        char *  done;
+        aLine.erase(0, sizeof(kCliPrompt) - 1);
+    }
 
-        FD_ZERO(&readFdSet);
-        FD_SET(mSocket, &readFdSet);
+    VerifyOrExit(!aLine.empty());
 
-        ret = select(mSocket + 1, &readFdSet, nullptr, nullptr, &timeout);
-        VerifyOrExit(ret != -1 || errno == EINTR);
-        if (ret <= 0)
+    for (Command &pending : mCommands)
+    {
+        if (pending.mState == kCommandPending)
         {
-            continue;
+            command = &pending;
+            break;
         }
+    }
 
-        count = read(mSocket, &mBuffer[rxLength], sizeof(mBuffer) - rxLength);
-        VerifyOrExit(count > 0);
-        rxLength += count;
-
-        mBuffer[rxLength] = '\0';
-        done              = strstr(mBuffer, "Done\r\n");
+    VerifyOrExit(command != nullptr, otbrLog(OTBR_LOG_DEBUG, "Unexpected output: %s", aLine.c_str()));
 
-        if (done != nullptr)
+    if (aLine == "Done")
+    {
+        command->mState = kCommandDone;
+    }
+    else if (aLine.compare(0, sizeof(kError) - 1, kError) == 0)
+    {
+        otbrLog(OTBR_LOG_WARNING, "OpenThread CLI command failed: %s", aLine.c_str());
+        command->mState = kCommandFailed;
+    }
+    else
+    {
+        if (!command->mOutput.empty())
         {
-            // remove trailing \r\n
-            if (done - rval > 2)
-            {
-                done[-2] = '\0';
-            }
+            command->mOutput += "\r\n";
+        }
 
-            rval = mBuffer;
+        command->mOutput += aLine;
+    }
+
+exit:
+    return;
+}
+
+OpenThreadClient::Command *OpenThreadClient::FindCommand(CommandId aId)
+{
+    Command *command = nullptr;
+
+    for (Command &sent : mCommands)
+    {
+        if (sent.mId == aId)
+        {
+            command = &sent;
             break;
         }
     }
 
-exit:
-    return rval;
+    return command;
 }
 
 int OpenThreadClient::Scan(WpanNetworkInfo *aNetworks, int aLength)
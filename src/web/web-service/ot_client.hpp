@@ -36,6 +36,10 @@
 
 #include "openthread-br/config.h"
 
+#include <deque>
+#include <string>
+
+#include <stdarg.h>
 #include <stdint.h>
 
 namespace otbr {
@@ -63,15 +67,26 @@ struct WpanNetworkInfo
 /**
  * This class implements functionality of OpenThread client.
  *
+ * The client keeps its connection to the OpenThread daemon open across commands. Responses are parsed line by line
+ * as they arrive, and several commands may be sent before waiting for the first one. The daemon executes commands in
+ * order, so they complete in the order they were sent.
+ *
  */
 class OpenThreadClient
 {
 public:
+    typedef uint32_t CommandId; ///< Identifies a command sent to the daemon.
+
+    static constexpr CommandId kInvalidCommandId = 0; ///< No command.
+
     /**
      * This constructor creates an OpenThread client.
      *
+     * @param[in]   aSocketPath     The path of the daemon socket, nullptr for the default one.
+     *
      */
-    OpenThreadClient(void);
+    explicit OpenThreadClient(const char *aSocketPath = nullptr);
+
     /**
      * This destructor destories an OpenThread client.
      *
@@ -79,7 +94,7 @@ public:
     ~OpenThreadClient(void);
 
     /**
-     * This method connects to OpenThread daemon.
+     * This method connects to OpenThread daemon, unless already connected.
      *
      * @retval  true    Successfully connected to the daemon.
      * @retval  false   Failed to connected to the daemon.
@@ -87,6 +102,30 @@ public:
      */
     bool Connect(void);
 
+    /**
+     * This method sends an OpenThread CLI command without waiting for its response.
+     *
+     * The outputs of the commands completed before are released.
+     *
+     * @param[in]   aFormat     C style format string.
+     * @param[in]   ...         C style format arguments.
+     *
+     * @returns The id of the command if sent, otherwise kInvalidCommandId.
+     *
+     */
+    CommandId Send(const char *aFormat, ...);
+
+    /**
+     * This method waits for a command to complete, after the commands sent before it.
+     *
+     * @param[in]   aId     The id of the command.
+     *
+     * @returns A pointer to the output if succeeded, otherwise nullptr. The output stays valid until the next command
+     *          is sent.
+     *
+     */
+    char *Wait(CommandId aId);
+
     /**
      * This method executes OpenThread CLI.
      *
@@ -116,7 +155,25 @@ public:
     bool FactoryReset(void);
 
 private:
-    void Disconnect(void);
+    enum CommandState : uint8_t
+    {
+        kCommandPending,
+        kCommandDone,
+        kCommandFailed,
+    };
+
+    struct Command
+    {
+        CommandId    mId;
+        CommandState mState;
+        std::string  mOutput; // Lines of the response, separated by "\r\n".
+    };
+
+    void      Disconnect(void);
+    CommandId SendV(const char *aFormat, va_list aArgs);
+    bool      Receive(void);
+    void      HandleLine(std::string &aLine);
+    Command * FindCommand(CommandId aId);
 
     enum
     {
@@ -124,9 +181,13 @@ private:
         kDefaultTimeout = 800,  ///< Default timeout(ms) waiting for a command finish.
     };
 
-    char mBuffer[kBufferSize];
-    int  mTimeout; /// Timeout in milliseconds
-    int  mSocket;
+    char                mBuffer[kBufferSize];
+    int                 mTimeout; /// Timeout in milliseconds
+    int                 mSocket;
+    std::string         mSocketPath;
+    std::string         mReceived; // Received bytes not forming a whole line yet.
+    std::deque<Command> mCommands; // Commands in the order they were sent.
+    CommandId           mNextCommandId;
 };
 
 } // namespace Web
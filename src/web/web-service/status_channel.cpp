@@ -0,0 +1,327 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the WebSocket channel pushing the status to the Web GUI.
+ */
+
+#include "web/web-service/status_channel.hpp"
+
+#include <algorithm>
+
+#include <boost/asio/write.hpp>
+
+#include "common/code_utils.hpp"
+#include "utils/sha1.hpp"
+
+namespace otbr {
+namespace Web {
+
+static const char kWebSocketGuid[] = "258EAFA5-E914-47DA-95CA-C5AB0DC85B11";
+
+static std::string EncodeBase64(const uint8_t *aBytes, size_t aLength)
+{
+    static const char kAlphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    std::string encoded;
+
+    for (size_t i = 0; i < aLength; i += 3)
+    {
+        uint32_t group = static_cast<uint32_t>(aBytes[i]) << 16;
+
+        group |= (i + 1 < aLength ? static_cast<uint32_t>(aBytes[i + 1]) << 8 : 0);
+        group |= (i + 2 < aLength ? aBytes[i + 2] : 0);
+
+        encoded += kAlphabet[(group >> 18) & 0x3f];
+        encoded += kAlphabet[(group >> 12) & 0x3f];
+        encoded += (i + 1 < aLength ? kAlphabet[(group >> 6) & 0x3f] : '=');
+        encoded += (i + 2 < aLength ? kAlphabet[group & 0x3f] : '=');
+    }
+
+    return encoded;
+}
+
+StatusChannel::StatusChannel(const std::shared_ptr<boost::asio::io_service> &aIoService,
+                             StatusGetter                                     aGetStatus,
+                             std::chrono::milliseconds                        aInterval)
+    : mIoService(aIoService)
+    , mStrand(*aIoService)
+    , mTimer(*aIoService)
+    , mGetStatus(std::move(aGetStatus))
+    , mInterval(aInterval)
+    , mPolling(false)
+{
+}
+
+std::string StatusChannel::ComputeAccept(const std::string &aKey)
+{
+    Sha1    sha1;
+    uint8_t hash[Sha1::kHashSize];
+
+    sha1.Update(reinterpret_cast<const uint8_t *>(aKey.data()), aKey.size());
+    sha1.Update(reinterpret_cast<const uint8_t *>(kWebSocketGuid), sizeof(kWebSocketGuid) - 1);
+    sha1.Finish(hash);
+
+    return EncodeBase64(hash, sizeof(hash));
+}
+
+std::string StatusChannel::MakeFrame(uint8_t aOpcode, const std::string &aPayload)
+{
+    std::string frame(1, static_cast<char>(0x80 | aOpcode));
+    uint64_t    length = aPayload.size();
+
+    if (length < 126)
+    {
+        frame += static_cast<char>(length);
+    }
+    else if (length <= 0xffff)
+    {
+        frame += static_cast<char>(126);
+        frame += static_cast<char>(length >> 8);
+        frame += static_cast<char>(length);
+    }
+    else
+    {
+        frame += static_cast<char>(127);
+
+        for (int shift = 56; shift >= 0; shift -= 8)
+        {
+            frame += static_cast<char>(length >> shift);
+        }
+    }
+
+    return frame + aPayload;
+}
+
+void StatusChannel::Accept(const std::shared_ptr<boost::asio::ip::tcp::socket> &aSocket, const std::string &aKey)
+{
+    std::shared_ptr<Client> client = std::make_shared<Client>(aSocket);
+    std::string             handshake =
+        "HTTP/1.1 101 Switching Protocols\r\nUpgrade: websocket\r\nConnection: Upgrade\r\nSec-WebSocket-Accept: " +
+        ComputeAccept(aKey) + "\r\n\r\n";
+
+    mStrand.dispatch([this, client, handshake]() {
+        mClients.push_back(client);
+        Send(client, handshake);
+        Read(client);
+
+        // A new browser gets the current status right away, polling sends it to everyone as it has changed.
+        if (mPolling)
+        {
+            Send(client, MakeFrame(kOpcodeText, mStatus));
+        }
+        else
+        {
+            Poll();
+        }
+    });
+}
+
+void StatusChannel::Send(const std::shared_ptr<Client> &aClient, std::string aFrame)
+{
+    bool idle = aClient->mFrames.empty();
+
+    aClient->mFrames.push_back(std::move(aFrame));
+
+    // Writes of a socket must not overlap, so frames are written one after the other.
+    if (idle)
+    {
+        Write(aClient);
+    }
+}
+
+void StatusChannel::Write(const std::shared_ptr<Client> &aClient)
+{
+    boost::asio::async_write(*aClient->mSocket, boost::asio::buffer(aClient->mFrames.front()),
+                             mStrand.wrap([this, aClient](const boost::system::error_code &aError, size_t) {
+                                 if (aError)
+                                 {
+                                     Remove(aClient);
+                                     ExitNow();
+                                 }
+
+                                 aClient->mFrames.pop_front();
+
+                                 if (!aClient->mFrames.empty())
+                                 {
+                                     Write(aClient);
+                                 }
+                                 else if (aClient->mClosing)
+                                 {
+                                     // The close frame answering the browser has been sent.
+                                     Remove(aClient);
+                                 }
+
+                             exit:
+                                 return;
+                             }));
+}
+
+void StatusChannel::Read(const std::shared_ptr<Client> &aClient)
+{
+    aClient->mSocket->async_read_some(
+        boost::asio::buffer(aClient->mReadBuffer),
+        mStrand.wrap([this, aClient](const boost::system::error_code &aError, size_t aLength) {
+            if (aError)
+            {
+                Remove(aClient);
+                ExitNow();
+            }
+
+            aClient->mInput.insert(aClient->mInput.end(), aClient->mReadBuffer, aClient->mReadBuffer + aLength);
+            ProcessInput(aClient);
+
+            if (!aClient->mClosing)
+            {
+                Read(aClient);
+            }
+
+        exit:
+            return;
+        }));
+}
+
+void StatusChannel::ProcessInput(const std::shared_ptr<Client> &aClient)
+{
+    std::vector<uint8_t> &input = aClient->mInput;
+
+    while (!aClient->mClosing && input.size() >= 2)
+    {
+        uint8_t     opcode = input[0] & 0x0f;
+        bool        masked = (input[1] & 0x80) != 0;
+        uint64_t    length = input[1] & 0x7f;
+        size_t      headerLength;
+        std::string payload;
+
+        if (length == 126)
+        {
+            VerifyOrExit(input.size() >= 4);
+            length       = static_cast<uint64_t>(input[2]) << 8 | input[3];
+            headerLength = 4;
+        }
+        else if (length == 127)
+        {
+            VerifyOrExit(input.size() >= 10);
+            length = 0;
+
+            for (size_t i = 2; i < 10; i++)
+            {
+                length = length << 8 | input[i];
+            }
+
+            headerLength = 10;
+        }
+        else
+        {
+            headerLength = 2;
+        }
+
+        headerLength += (masked ? 4 : 0);
+        VerifyOrExit(length <= kMaxInputSize, Remove(aClient));
+        VerifyOrExit(input.size() >= headerLength + length);
+
+        payload.assign(input.begin() + headerLength, input.begin() + headerLength + length);
+
+        for (size_t i = 0; masked && i < payload.size(); i++)
+        {
+            payload[i] ^= input[headerLength - 4 + i % 4];
+        }
+
+        input.erase(input.begin(), input.begin() + headerLength + length);
+
+        // Messages of browsers are ignored, only the control frames are answered.
+        if (opcode == kOpcodeClose)
+        {
+            aClient->mClosing = true;
+            Send(aClient, MakeFrame(kOpcodeClose, payload.substr(0, 2)));
+        }
+        else if (opcode == kOpcodePing)
+        {
+            Send(aClient, MakeFrame(kOpcodePong, payload));
+        }
+    }
+
+exit:
+    if (input.size() > kMaxInputSize)
+    {
+        Remove(aClient);
+    }
+}
+
+void StatusChannel::Remove(const std::shared_ptr<Client> &aClient)
+{
+    boost::system::error_code error;
+
+    mClients.erase(std::remove(mClients.begin(), mClients.end(), aClient), mClients.end());
+    aClient->mClosing = true;
+    aClient->mSocket->shutdown(boost::asio::ip::tcp::socket::shutdown_both, error);
+    aClient->mSocket->close(error);
+}
+
+void StatusChannel::Poll(void)
+{
+    std::string status;
+
+    mPolling = false;
+
+    // The status is not checked while nobody is connected, and is stale once somebody connects again.
+    VerifyOrExit(!mClients.empty(), mStatus.clear());
+
+    status = mGetStatus();
+
+    if (status != mStatus)
+    {
+        std::string frame = MakeFrame(kOpcodeText, status);
+
+        mStatus = std::move(status);
+
+        for (const std::shared_ptr<Client> &client : mClients)
+        {
+            if (!client->mClosing)
+            {
+                Send(client, frame);
+            }
+        }
+    }
+
+    mPolling = true;
+    mTimer.expires_from_now(mInterval);
+    mTimer.async_wait(mStrand.wrap([this](const boost::system::error_code &aError) {
+        if (aError != boost::asio::error::operation_aborted)
+        {
+            Poll();
+        }
+    }));
+
+exit:
+    return;
+}
+
+} // namespace Web
+} // namespace otbr
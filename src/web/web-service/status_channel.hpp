@@ -0,0 +1,163 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the WebSocket channel pushing the status to the Web GUI.
+ */
+
+#ifndef OTBR_WEB_WEB_SERVICE_STATUS_CHANNEL_HPP_
+#define OTBR_WEB_WEB_SERVICE_STATUS_CHANNEL_HPP_
+
+#include "openthread-br/config.h"
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <stdint.h>
+
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/asio/steady_timer.hpp>
+#include <boost/asio/strand.hpp>
+
+namespace otbr {
+namespace Web {
+
+/**
+ * This class implements a WebSocket (RFC 6455) channel pushing the status to connected browsers.
+ *
+ * While any browser is connected, the status is checked periodically and pushed as a text message when it changed,
+ * so browsers share one source instead of each polling it. The status getter is expected to be cheap when nothing
+ * changed, like WpanService::HandleStatusRequest() with its cache.
+ *
+ * All operations run on a strand, so the channel works with any number of server threads.
+ *
+ */
+class StatusChannel
+{
+public:
+    typedef std::function<std::string(void)> StatusGetter; ///< Returns the status message.
+
+    /**
+     * This constructor initializes the channel.
+     *
+     * @param[in]  aIoService  The I/O service of the web server.
+     * @param[in]  aGetStatus  The function returning the status message.
+     * @param[in]  aInterval   The interval of status checks.
+     *
+     */
+    StatusChannel(const std::shared_ptr<boost::asio::io_service> &aIoService,
+                  StatusGetter                                     aGetStatus,
+                  std::chrono::milliseconds                        aInterval);
+
+    /**
+     * This method completes the WebSocket handshake of a connection and adds it to the channel.
+     *
+     * @param[in]  aSocket  The socket of the connection, whose upgrade request has been read.
+     * @param[in]  aKey     The value of the Sec-WebSocket-Key header of the upgrade request.
+     *
+     */
+    void Accept(const std::shared_ptr<boost::asio::ip::tcp::socket> &aSocket, const std::string &aKey);
+
+    /**
+     * This method computes the Sec-WebSocket-Accept value answering a Sec-WebSocket-Key.
+     *
+     * @param[in]  aKey  The value of the Sec-WebSocket-Key header.
+     *
+     * @returns The value of the Sec-WebSocket-Accept header.
+     *
+     */
+    static std::string ComputeAccept(const std::string &aKey);
+
+    /**
+     * This method builds an unmasked frame sent by a server.
+     *
+     * @param[in]  aOpcode   The opcode of the frame.
+     * @param[in]  aPayload  The payload.
+     *
+     * @returns The frame.
+     *
+     */
+    static std::string MakeFrame(uint8_t aOpcode, const std::string &aPayload);
+
+    enum : uint8_t
+    {
+        kOpcodeText  = 0x1, ///< A text frame.
+        kOpcodeClose = 0x8, ///< A close frame.
+        kOpcodePing  = 0x9, ///< A ping frame.
+        kOpcodePong  = 0xa, ///< A pong frame.
+    };
+
+private:
+    enum
+    {
+        kReadBufferSize = 256,
+        kMaxInputSize   = 1024, ///< Browsers only send control frames, which are at most 131 bytes.
+    };
+
+    struct Client
+    {
+        explicit Client(const std::shared_ptr<boost::asio::ip::tcp::socket> &aSocket)
+            : mSocket(aSocket)
+            , mClosing(false)
+        {
+        }
+
+        std::shared_ptr<boost::asio::ip::tcp::socket> mSocket;
+        std::deque<std::string>                       mFrames; ///< The frame being written, then the queued ones.
+        std::vector<uint8_t>                          mInput;
+        uint8_t                                       mReadBuffer[kReadBufferSize];
+        bool                                          mClosing;
+    };
+
+    void Send(const std::shared_ptr<Client> &aClient, std::string aFrame);
+    void Write(const std::shared_ptr<Client> &aClient);
+    void Read(const std::shared_ptr<Client> &aClient);
+    void ProcessInput(const std::shared_ptr<Client> &aClient);
+    void Remove(const std::shared_ptr<Client> &aClient);
+    void Poll(void);
+
+    std::shared_ptr<boost::asio::io_service> mIoService; ///< Kept alive for the timer and the strand.
+    boost::asio::io_service::strand          mStrand;
+    boost::asio::steady_timer                mTimer;
+    StatusGetter                             mGetStatus;
+    std::chrono::milliseconds                mInterval;
+    std::vector<std::shared_ptr<Client>>     mClients;
+    std::string                              mStatus; ///< The last pushed status.
+    bool                                     mPolling;
+};
+
+} // namespace Web
+} // namespace otbr
+
+#endif // OTBR_WEB_WEB_SERVICE_STATUS_CHANNEL_HPP_
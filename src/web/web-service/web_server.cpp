@@ -33,33 +33,54 @@
 
 #include "web/web-service/web_server.hpp"
 
+#include <functional>
+#include <iterator>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include <zlib.h>
+
 #define BOOST_NO_CXX11_SCOPED_ENUMS
 #include <boost/filesystem.hpp>
 #undef BOOST_NO_CXX11_SCOPED_ENUMS
 
 #include <server_http.hpp>
 
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+
 #define OT_ADD_PREFIX_PATH "^/add_prefix"
 #define OT_AVAILABLE_NETWORK_PATH "^/available_network$"
 #define OT_DELETE_PREFIX_PATH "^/delete_prefix"
+#define OT_UPDATE_PREFIXES_PATH "^/update_prefixes"
 #define OT_FORM_NETWORK_PATH "^/form_network$"
 #define OT_GET_NETWORK_PATH "^/get_properties$"
 #define OT_JOIN_NETWORK_PATH "^/join_network$"
 #define OT_SET_NETWORK_PATH "^/settings$"
 #define OT_COMMISSIONER_START_PATH "^/commission$"
+#define OT_STATUS_EVENTS_PATH "/status_events" // Upgrades to WebSocket bypass the resources, so this is not a regex.
 #define OT_REQUEST_METHOD_GET "GET"
 #define OT_REQUEST_METHOD_POST "POST"
 #define OT_RESPONSE_SUCCESS_STATUS "HTTP/1.1 200 OK\r\n"
 #define OT_RESPONSE_HEADER_LENGTH "Content-Length: "
-#define OT_RESPONSE_HEADER_CSS_TYPE "\r\nContent-Type: text/css"
+#define OT_RESPONSE_HEADER_CACHE_CONTROL "Cache-Control: no-cache\r\n"
+#define OT_RESPONSE_HEADER_CONTENT_ENCODING "Content-Encoding: "
+#define OT_RESPONSE_HEADER_CONTENT_TYPE "Content-Type: "
+#define OT_RESPONSE_HEADER_ETAG "ETag: "
+#define OT_RESPONSE_HEADER_VARY "Vary: Accept-Encoding\r\n"
 #define OT_RESPONSE_HEADER_TYPE "Content-Type: application/json\r\n charset=utf-8"
 #define OT_RESPONSE_PLACEHOLD "\r\n\r\n"
+#define OT_RESPONSE_LINE_END "\r\n"
 #define OT_RESPONSE_FAILURE_STATUS "HTTP/1.1 400 Bad Request\r\n"
-#define OT_BUFFER_SIZE 1024
+#define OT_RESPONSE_NOT_MODIFIED_STATUS "HTTP/1.1 304 Not Modified\r\n"
 
 namespace otbr {
 namespace Web {
 
+static const std::chrono::milliseconds kStatusEventsInterval(1000);
+
 static void EscapeHtml(std::string &content)
 {
     std::string output;
@@ -93,6 +114,137 @@ static void EscapeHtml(std::string &content)
     output.swap(content);
 }
 
+// Returns whether an Accept-Encoding header field allows an encoding, only "q=0" refuses a listed encoding.
+static bool AcceptsEncoding(const std::string &aAcceptEncoding, const char *aEncoding)
+{
+    bool   accepts = false;
+    size_t start   = 0;
+
+    while (start < aAcceptEncoding.size())
+    {
+        size_t      end    = aAcceptEncoding.find(',', start);
+        std::string coding = aAcceptEncoding.substr(start, end == std::string::npos ? std::string::npos : end - start);
+        size_t      param  = coding.find(';');
+        std::string name   = coding.substr(0, param);
+
+        name.erase(0, name.find_first_not_of(" \t"));
+        name.erase(name.find_last_not_of(" \t") + 1);
+
+        if (strcasecmp(name.c_str(), aEncoding) == 0)
+        {
+            size_t quality = coding.find("q=", param == std::string::npos ? coding.size() : param);
+
+            accepts = (quality == std::string::npos || strtod(coding.c_str() + quality + 2, nullptr) > 0);
+            break;
+        }
+
+        start = (end == std::string::npos) ? aAcceptEncoding.size() : end + 1;
+    }
+
+    return accepts;
+}
+
+// Returns whether the If-None-Match header field of a request matches a weak entity tag.
+static bool IsNotModified(const HttpServer::Request &aRequest, const std::string &aETag)
+{
+    auto ifNoneMatch = aRequest.header.find("If-None-Match");
+
+    // Weak comparison ignores the W/ prefix.
+    return ifNoneMatch != aRequest.header.end() &&
+           (ifNoneMatch->second == "*" || ifNoneMatch->second.find(aETag.substr(2)) != std::string::npos);
+}
+
+static bool ReadFile(const std::string &aPath, std::string &aContent)
+{
+    std::ifstream ifs(aPath, std::ios::in | std::ios::binary);
+
+    aContent.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+
+    return !ifs.bad();
+}
+
+static const char *GetContentType(const std::string &aExtension)
+{
+    static const struct
+    {
+        const char *mExtension;
+        const char *mContentType;
+    } kContentTypes[] = {
+        {".css", "text/css"},
+        {".html", "text/html; charset=utf-8"},
+        {".ico", "image/x-icon"},
+        {".jpg", "image/jpeg"},
+        {".js", "application/javascript"},
+        {".json", "application/json"},
+        {".png", "image/png"},
+        {".svg", "image/svg+xml"},
+        {".txt", "text/plain; charset=utf-8"},
+        {".woff", "font/woff"},
+        {".woff2", "font/woff2"},
+    };
+    const char *contentType = "application/octet-stream";
+
+    for (const auto &entry : kContentTypes)
+    {
+        if (aExtension == entry.mExtension)
+        {
+            contentType = entry.mContentType;
+            break;
+        }
+    }
+
+    return contentType;
+}
+
+static bool IsCompressible(const std::string &aExtension)
+{
+    return aExtension == ".css" || aExtension == ".html" || aExtension == ".js" || aExtension == ".json" ||
+           aExtension == ".svg" || aExtension == ".txt";
+}
+
+static std::string GetETag(const std::string &aContent)
+{
+    char etag[sizeof("W/\"\"") + sizeof(size_t) * 2];
+
+    snprintf(etag, sizeof(etag), "W/\"%zx\"", std::hash<std::string>()(aContent));
+
+    return etag;
+}
+
+// Leaves aCompressed empty if the content does not get smaller.
+static void GzipCompress(const std::string &aContent, std::string &aCompressed)
+{
+    static const int kWindowBits = 15 + 16; // 16 selects the gzip wrapper.
+    static const int kMemLevel   = 8;
+
+    z_stream stream;
+    int      ret;
+
+    aCompressed.clear();
+
+    memset(&stream, 0, sizeof(stream));
+    VerifyOrExit(deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, kWindowBits, kMemLevel, Z_DEFAULT_STRATEGY) ==
+                 Z_OK);
+
+    aCompressed.resize(deflateBound(&stream, static_cast<uLong>(aContent.size())));
+    stream.next_in   = reinterpret_cast<Bytef *>(const_cast<char *>(aContent.data()));
+    stream.avail_in  = static_cast<uInt>(aContent.size());
+    stream.next_out  = reinterpret_cast<Bytef *>(&aCompressed[0]);
+    stream.avail_out = static_cast<uInt>(aCompressed.size());
+
+    ret = deflate(&stream, Z_FINISH);
+    aCompressed.resize(stream.total_out);
+    deflateEnd(&stream);
+
+    if (ret != Z_STREAM_END || aCompressed.size() >= aContent.size())
+    {
+        aCompressed.clear();
+    }
+
+exit:
+    return;
+}
+
 WebServer::WebServer(void)
     : mServer(new HttpServer())
 {
@@ -100,6 +252,8 @@ WebServer::WebServer(void)
 
 WebServer::~WebServer(void)
 {
+    // The channel has handlers pending on the I/O service of the server.
+    mStatusChannel.reset();
     delete mServer;
 }
 
@@ -122,17 +276,25 @@ void WebServer::StartWebServer(const char *aIfName, const char *aListenAddr, uin
     mServer->config.port = aPort;
     mWpanService.SetInterfaceName(aIfName);
     Init();
+    LoadStaticFiles();
     ResponseJoinNetwork();
     ResponseFormNetwork();
     ResponseAddOnMeshPrefix();
     ResponseDeleteOnMeshPrefix();
+    ResponseUpdateOnMeshPrefixes();
     ResponseGetStatus();
     ResponseGetAvailableNetwork();
     ResponseCommission();
+    ResponseStatusEvents();
     DefaultHttpResponse();
     mServer->start();
 }
 
+void WebServer::SetThreadPoolSize(size_t aThreads)
+{
+    mServer->config.thread_pool_size = aThreads;
+}
+
 void WebServer::StopWebServer(void)
 {
     mServer->stop();
@@ -162,90 +324,149 @@ void WebServer::HandleHttpRequest(const char *aUrl, const char *aMethod, HttpReq
     };
 }
 
-void DefaultResourceSend(const HttpServer &                           aServer,
-                         const std::shared_ptr<HttpServer::Response> &aResponse,
-                         const std::shared_ptr<std::ifstream> &       aIfStream)
+void WebServer::ResponseStatusEvents(void)
 {
-    static std::vector<char> buffer(OT_BUFFER_SIZE); // Safe when server is running on one thread
+    // The channel needs the I/O service, which the server would only create once started.
+    mServer->io_service = std::make_shared<boost::asio::io_service>();
+    mStatusChannel.reset(new StatusChannel(
+        mServer->io_service, [this]() { return mWpanService.HandleStatusRequest(); }, kStatusEventsInterval));
+
+    mServer->on_upgrade = [this](std::shared_ptr<SimpleWeb::HTTP>     socket,
+                                 std::shared_ptr<HttpServer::Request> request) {
+        auto upgrade = request->header.find("Upgrade");
+        auto key     = request->header.find("Sec-WebSocket-Key");
+
+        if (request->method == OT_REQUEST_METHOD_GET &&
+            request->path.substr(0, request->path.find('?')) == OT_STATUS_EVENTS_PATH &&
+            strcasecmp(upgrade->second.c_str(), "websocket") == 0 && key != request->header.end())
+        {
+            mStatusChannel->Accept(socket, key->second);
+        }
+        else
+        {
+            auto response = std::make_shared<std::string>(OT_RESPONSE_FAILURE_STATUS "Connection: close\r\n"
+                                                          OT_RESPONSE_HEADER_LENGTH "0" OT_RESPONSE_PLACEHOLD);
 
-    std::streamsize readLength;
+            boost::asio::async_write(*socket, boost::asio::buffer(*response),
+                                     [socket, response](const boost::system::error_code &, size_t) {
+                                         boost::system::error_code error;
 
-    if ((readLength = aIfStream->read(&buffer[0], buffer.size()).gcount()) > 0)
-    {
-        aResponse->write(&buffer[0], readLength);
-        if (readLength == static_cast<std::streamsize>(buffer.size()))
-        {
-            aServer.send(aResponse, [&aServer, aResponse, aIfStream](const boost::system::error_code &ec) {
-                if (!ec)
-                {
-                    DefaultResourceSend(aServer, aResponse, aIfStream);
-                }
-                else
-                {
-                    std::cerr << "Connection interrupted" << std::endl;
-                }
-            });
+                                         socket->close(error);
+                                     });
         }
-    }
+    };
 }
 
 void WebServer::DefaultHttpResponse(void)
 {
     mServer->default_resource[OT_REQUEST_METHOD_GET] = [this](std::shared_ptr<HttpServer::Response> response,
                                                               std::shared_ptr<HttpServer::Request>  request) {
-        try
+        std::string path = request->path.substr(0, request->path.find('?'));
+        auto        file = mStaticFiles.find(path.empty() || path.back() == '/' ? path + "index.html" : path);
+
+        if (file == mStaticFiles.end())
         {
-            auto webRootPath = boost::filesystem::canonical(WEB_FILE_PATH);
-            auto path        = boost::filesystem::canonical(webRootPath / request->path);
-            // Check if path is within webRootPath
-            if (std::distance(webRootPath.begin(), webRootPath.end()) > std::distance(path.begin(), path.end()) ||
-                !std::equal(webRootPath.begin(), webRootPath.end(), path.begin()))
-            {
-                throw std::invalid_argument("path must be within root path");
-            }
-            if (boost::filesystem::is_directory(path))
+            file = mStaticFiles.find(path + "/index.html");
+        }
+
+        if (file == mStaticFiles.end())
+        {
+            std::string content = "Could not open path `" + request->path + "`: file does not exist";
+            EscapeHtml(content);
+            *response << OT_RESPONSE_FAILURE_STATUS << OT_RESPONSE_HEADER_LENGTH << content.length()
+                      << OT_RESPONSE_PLACEHOLD << content;
+        }
+        else if (IsNotModified(*request, file->second.mETag))
+        {
+            *response << OT_RESPONSE_NOT_MODIFIED_STATUS << OT_RESPONSE_HEADER_CACHE_CONTROL << OT_RESPONSE_HEADER_ETAG
+                      << file->second.mETag << OT_RESPONSE_PLACEHOLD;
+        }
+        else
+        {
+            const StaticFile & staticFile     = file->second;
+            const std::string *content        = &staticFile.mContent;
+            const char *       encoding       = nullptr;
+            auto               acceptEncoding = request->header.find("Accept-Encoding");
+
+            if (acceptEncoding != request->header.end())
             {
-                path /= "index.html";
+                if (!staticFile.mBrotliContent.empty() && AcceptsEncoding(acceptEncoding->second, "br"))
+                {
+                    content  = &staticFile.mBrotliContent;
+                    encoding = "br";
+                }
+                else if (!staticFile.mGzipContent.empty() && AcceptsEncoding(acceptEncoding->second, "gzip"))
+                {
+                    content  = &staticFile.mGzipContent;
+                    encoding = "gzip";
+                }
             }
-            if (!(boost::filesystem::exists(path) && boost::filesystem::is_regular_file(path)))
+
+            *response << OT_RESPONSE_SUCCESS_STATUS << OT_RESPONSE_HEADER_CACHE_CONTROL << OT_RESPONSE_HEADER_ETAG
+                      << staticFile.mETag << OT_RESPONSE_LINE_END << OT_RESPONSE_HEADER_VARY
+                      << OT_RESPONSE_HEADER_CONTENT_TYPE << staticFile.mContentType << OT_RESPONSE_LINE_END;
+
+            if (encoding != nullptr)
             {
-                throw std::invalid_argument("file does not exist");
+                *response << OT_RESPONSE_HEADER_CONTENT_ENCODING << encoding << OT_RESPONSE_LINE_END;
             }
 
-            std::string cacheControl, etag;
+            *response << OT_RESPONSE_HEADER_LENGTH << content->size() << OT_RESPONSE_PLACEHOLD;
+            response->write(content->data(), static_cast<std::streamsize>(content->size()));
+        }
+    };
+}
+
+void WebServer::LoadStaticFiles(void)
+{
+    size_t total = 0;
+
+    try
+    {
+        auto webRootPath = boost::filesystem::canonical(WEB_FILE_PATH);
+
+        for (boost::filesystem::recursive_directory_iterator it(webRootPath), end; it != end; ++it)
+        {
+            const boost::filesystem::path &path = it->path();
+            std::string                    extension;
+            StaticFile                     file;
 
-            auto ifs = std::make_shared<std::ifstream>();
-            ifs->open(path.string(), std::ifstream::in | std::ios::binary | std::ios::ate);
-            std::string extension = boost::filesystem::extension(path.string());
-            std::string style     = "";
-            if (extension == ".css")
+            if (!boost::filesystem::is_regular_file(path) || path.extension() == ".br")
             {
-                style = OT_RESPONSE_HEADER_CSS_TYPE;
+                continue;
             }
 
-            if (*ifs)
+            extension = path.extension().string();
+
+            if (!ReadFile(path.string(), file.mContent))
             {
-                auto length = ifs->tellg();
-                ifs->seekg(0, std::ios::beg);
+                otbrLog(OTBR_LOG_ERR, "Failed to read %s", path.string().c_str());
+                continue;
+            }
 
-                *response << OT_RESPONSE_SUCCESS_STATUS << cacheControl << etag << OT_RESPONSE_HEADER_LENGTH << length
-                          << style << OT_RESPONSE_PLACEHOLD;
+            file.mContentType = GetContentType(extension);
+            file.mETag        = GetETag(file.mContent);
 
-                DefaultResourceSend(*mServer, response, ifs);
-            }
-            else
+            if (IsCompressible(extension))
             {
-                throw std::invalid_argument("could not read file");
+                GzipCompress(file.mContent, file.mGzipContent);
+
+                // Brotli compresses better than gzip but is too slow to do here, so it is only served if installed.
+                if (boost::filesystem::is_regular_file(path.string() + ".br"))
+                {
+                    ReadFile(path.string() + ".br", file.mBrotliContent);
+                }
             }
 
-        } catch (const std::exception &e)
-        {
-            std::string content = "Could not open path `" + request->path + "`: " + e.what();
-            EscapeHtml(content);
-            *response << OT_RESPONSE_FAILURE_STATUS << OT_RESPONSE_HEADER_LENGTH << content.length()
-                      << OT_RESPONSE_PLACEHOLD << content;
+            total += file.mContent.size() + file.mGzipContent.size() + file.mBrotliContent.size();
+            mStaticFiles[path.generic_string().substr(webRootPath.generic_string().size())] = std::move(file);
         }
-    };
+    } catch (const std::exception &e)
+    {
+        otbrLog(OTBR_LOG_ERR, "Failed to load the frontend from %s: %s", WEB_FILE_PATH, e.what());
+    }
+
+    otbrLog(OTBR_LOG_INFO, "Loaded %zu frontend files, %zu bytes", mStaticFiles.size(), total);
 }
 
 std::string WebServer::HandleJoinNetworkRequest(const std::string &aJoinRequest, void *aUserData)
@@ -276,6 +497,13 @@ std::string WebServer::HandleDeletePrefixRequest(const std::string &aDeletePrefi
     return webServer->HandleDeletePrefixRequest(aDeletePrefixRequest);
 }
 
+std::string WebServer::HandleUpdatePrefixesRequest(const std::string &aUpdatePrefixesRequest, void *aUserData)
+{
+    WebServer *webServer = static_cast<WebServer *>(aUserData);
+
+    return webServer->HandleUpdatePrefixesRequest(aUpdatePrefixesRequest);
+}
+
 std::string WebServer::HandleGetStatusRequest(const std::string &aGetStatusRequest, void *aUserData)
 {
     WebServer *webServer = static_cast<WebServer *>(aUserData);
@@ -318,6 +546,11 @@ void WebServer::ResponseDeleteOnMeshPrefix(void)
     HandleHttpRequest(OT_DELETE_PREFIX_PATH, OT_REQUEST_METHOD_POST, HandleDeletePrefixRequest);
 }
 
+void WebServer::ResponseUpdateOnMeshPrefixes(void)
+{
+    HandleHttpRequest(OT_UPDATE_PREFIXES_PATH, OT_REQUEST_METHOD_POST, HandleUpdatePrefixesRequest);
+}
+
 void WebServer::ResponseGetStatus(void)
 {
     HandleHttpRequest(OT_GET_NETWORK_PATH, OT_REQUEST_METHOD_GET, HandleGetStatusRequest);
@@ -326,6 +559,8 @@ void WebServer::ResponseGetStatus(void)
 void WebServer::ResponseGetAvailableNetwork(void)
 {
     HandleHttpRequest(OT_AVAILABLE_NETWORK_PATH, OT_REQUEST_METHOD_GET, HandleGetAvailableNetworkResponse);
+    // A POST with {"rescan": true} bypasses the cached scan results.
+    HandleHttpRequest(OT_AVAILABLE_NETWORK_PATH, OT_REQUEST_METHOD_POST, HandleGetAvailableNetworkResponse);
 }
 
 void WebServer::ResponseCommission(void)
@@ -353,6 +588,11 @@ std::string WebServer::HandleDeletePrefixRequest(const std::string &aDeletePrefi
     return mWpanService.HandleDeletePrefixRequest(aDeletePrefixRequest);
 }
 
+std::string WebServer::HandleUpdatePrefixesRequest(const std::string &aUpdatePrefixesRequest)
+{
+    return mWpanService.HandleUpdatePrefixesRequest(aUpdatePrefixesRequest);
+}
+
 std::string WebServer::HandleGetStatusRequest(const std::string &aGetStatusRequest)
 {
     (void)aGetStatusRequest;
@@ -361,8 +601,7 @@ std::string WebServer::HandleGetStatusRequest(const std::string &aGetStatusReque
 
 std::string WebServer::HandleGetAvailableNetworkResponse(const std::string &aGetAvailableNetworkRequest)
 {
-    (void)aGetAvailableNetworkRequest;
-    return mWpanService.HandleAvailableNetworkRequest();
+    return mWpanService.HandleAvailableNetworkRequest(aGetAvailableNetworkRequest);
 }
 
 std::string WebServer::HandleCommission(const std::string &aCommissionRequest)
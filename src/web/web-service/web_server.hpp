@@ -39,6 +39,8 @@
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -47,6 +49,7 @@
 
 #include <boost/asio/ip/tcp.hpp>
 
+#include "web/web-service/status_channel.hpp"
 #include "web/web-service/wpan_service.hpp"
 
 namespace SimpleWeb {
@@ -94,12 +97,31 @@ public:
      */
     void StopWebServer(void);
 
+    /**
+     * This method sets how long scan results are served before being refreshed.
+     *
+     * @param[in]  aSeconds  The maximum age of scan results in seconds, 0 to scan for every request.
+     *
+     */
+    void SetScanCacheMaxAge(uint32_t aSeconds) { mWpanService.SetScanCacheMaxAge(aSeconds); }
+
+    /**
+     * This method sets the number of threads serving http requests.
+     *
+     * It must be called before StartWebServer().
+     *
+     * @param[in]  aThreads  The number of threads.
+     *
+     */
+    void SetThreadPoolSize(size_t aThreads);
+
 private:
     typedef std::string (*HttpRequestCallback)(const std::string &aRequest, void *aUserData);
     static std::string HandleJoinNetworkRequest(const std::string &aJoinRequest, void *aUserData);
     static std::string HandleFormNetworkRequest(const std::string &aFormRequest, void *aUserData);
     static std::string HandleAddPrefixRequest(const std::string &aAddPrefixRequest, void *aUserData);
     static std::string HandleDeletePrefixRequest(const std::string &aDeletePrefixRequest, void *aUserData);
+    static std::string HandleUpdatePrefixesRequest(const std::string &aUpdatePrefixesRequest, void *aUserData);
     static std::string HandleGetStatusRequest(const std::string &aGetStatusRequest, void *aUserData);
     static std::string HandleGetAvailableNetworkResponse(const std::string &aGetAvailableNetworkRequest,
                                                          void *             aUserData);
@@ -109,6 +131,7 @@ private:
     std::string HandleFormNetworkRequest(const std::string &aFormRequest);
     std::string HandleAddPrefixRequest(const std::string &aAddPrefixRequest);
     std::string HandleDeletePrefixRequest(const std::string &aDeletePrefixRequest);
+    std::string HandleUpdatePrefixesRequest(const std::string &aUpdatePrefixesRequest);
     std::string HandleGetStatusRequest(const std::string &aGetStatusRequest);
     std::string HandleGetAvailableNetworkResponse(const std::string &aGetAvailableNetworkRequest);
     std::string HandleCommission(const std::string &aCommissionRequest);
@@ -118,15 +141,33 @@ private:
     void ResponseFormNetwork(void);
     void ResponseAddOnMeshPrefix(void);
     void ResponseDeleteOnMeshPrefix(void);
+    void ResponseUpdateOnMeshPrefixes(void);
     void ResponseGetStatus(void);
     void ResponseGetAvailableNetwork(void);
     void DefaultHttpResponse(void);
     void ResponseCommission(void);
+    void ResponseStatusEvents(void);
 
     void Init(void);
+    void LoadStaticFiles(void);
 
-    HttpServer *           mServer;
-    otbr::Web::WpanService mWpanService;
+    /**
+     * This structure represents a frontend file, held in memory with its compressed variants.
+     *
+     */
+    struct StaticFile
+    {
+        std::string mContent;
+        std::string mGzipContent;   ///< Empty if gzip does not make the content smaller.
+        std::string mBrotliContent; ///< Empty unless a precompressed `.br` file is installed next to the file.
+        std::string mETag;
+        const char *mContentType;
+    };
+
+    HttpServer *                      mServer;
+    otbr::Web::WpanService            mWpanService;
+    std::map<std::string, StaticFile> mStaticFiles; ///< Keyed by the request path, only read once the server starts.
+    std::unique_ptr<StatusChannel>    mStatusChannel;
 };
 
 } // namespace Web
@@ -33,6 +33,7 @@
 
 #include "web/web-service/wpan_service.hpp"
 
+#include <algorithm>
 #include <inttypes.h>
 #include <sstream>
 #include <stdio.h>
@@ -49,20 +50,43 @@ const char *WpanService::kBorderAgentPort = "49191";
 #define WPAN_RESPONSE_SUCCESS "successful"
 #define WPAN_RESPONSE_FAILURE "failed"
 
+// Bounds how stale the status gets when the backend does not report state changes.
+static const std::chrono::seconds kStatusCacheMaxAge(5);
+static const std::chrono::seconds kDefaultScanCacheMaxAge(30);
+
+WpanService::WpanService(void)
+    : mScanning(false)
+    , mScanStatus(kWpanStatus_Ok)
+    , mScanCacheMaxAge(kDefaultScanCacheMaxAge)
+    , mNetworksCount(0)
+{
+    mIfName[0] = '\0';
+}
+
+WpanService::~WpanService(void)
+{
+    if (mScanThread.joinable())
+    {
+        mScanThread.join();
+    }
+}
+
 std::string WpanService::HandleJoinNetworkRequest(const std::string &aJoinRequest)
 {
-    Json::Value                 root;
-    Json::Reader                reader;
-    Json::FastWriter            jsonWriter;
-    std::string                 response;
-    int                         index;
-    std::string                 masterKey;
-    std::string                 prefix;
-    bool                        defaultRoute;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client;
-
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    Json::Value      root;
+    Json::Reader     reader;
+    Json::FastWriter jsonWriter;
+    std::string      response;
+    int              index;
+    WpanNetworkInfo  network;
+    std::string      masterKey;
+    std::string      prefix;
+    bool             defaultRoute;
+    int              ret = kWpanStatus_Ok;
+
+    std::lock_guard<std::mutex> lock(mBackendMutex);
+
+    mStatusResponse.clear();
 
     VerifyOrExit(reader.parse(aJoinRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
     index        = root["index"].asUInt();
@@ -75,12 +99,33 @@ std::string WpanService::HandleJoinNetworkRequest(const std::string &aJoinReques
         prefix += "/64";
     }
 
-    VerifyOrExit(client.FactoryReset(), ret = kWpanStatus_LeaveFailed);
-    VerifyOrExit((ret = commitActiveDataset(client, masterKey, mNetworks[index].mNetworkName, mNetworks[index].mChannel,
-                                            mNetworks[index].mExtPanId, mNetworks[index].mPanId)) == kWpanStatus_Ok);
-    VerifyOrExit(client.Execute("ifconfig up") != nullptr, ret = kWpanStatus_JoinFailed);
-    VerifyOrExit(client.Execute("thread start") != nullptr, ret = kWpanStatus_JoinFailed);
-    VerifyOrExit(client.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
+    {
+        // The index refers to the results of the last response, which a background scan may have refreshed since.
+        std::lock_guard<std::mutex> scanLock(mScanMutex);
+
+        VerifyOrExit(index >= 0 && index < mNetworksCount, ret = kWpanStatus_NetworkNotFound);
+        network = mNetworks[index];
+    }
+
+#if OTBR_ENABLE_WEB_DBUS
+    if (ConnectThreadApi())
+    {
+        VerifyOrExit(mThreadApi->FactoryReset(nullptr) == DBus::ClientError::ERROR_NONE, ret = kWpanStatus_LeaveFailed);
+        VerifyOrExit(AttachDBus(masterKey, network.mNetworkName, network.mChannel, network.mExtPanId, network.mPanId,
+                                std::vector<uint8_t>()),
+                     ret = kWpanStatus_JoinFailed);
+        VerifyOrExit(AddOnMeshPrefixDBus(prefix, defaultRoute) == kWpanStatus_Ok, ret = kWpanStatus_SetFailed);
+        ExitNow();
+    }
+#endif
+
+    VerifyOrExit(mClient.Connect(), ret = kWpanStatus_SetFailed);
+    VerifyOrExit(mClient.FactoryReset(), ret = kWpanStatus_LeaveFailed);
+    VerifyOrExit((ret = commitActiveDataset(mClient, masterKey, network.mNetworkName, network.mChannel,
+                                            network.mExtPanId, network.mPanId)) == kWpanStatus_Ok);
+    VerifyOrExit(mClient.Execute("ifconfig up") != nullptr, ret = kWpanStatus_JoinFailed);
+    VerifyOrExit(mClient.Execute("thread start") != nullptr, ret = kWpanStatus_JoinFailed);
+    VerifyOrExit(mClient.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
                  ret = kWpanStatus_SetFailed);
 exit:
 
@@ -99,25 +144,27 @@ exit:
 
 std::string WpanService::HandleFormNetworkRequest(const std::string &aFormRequest)
 {
-    Json::Value                 root;
-    Json::FastWriter            jsonWriter;
-    Json::Reader                reader;
-    std::string                 response;
-    otbr::Psk::Pskc             psk;
-    char                        pskcStr[OT_PSKC_MAX_LENGTH * 2 + 1];
-    uint8_t                     extPanIdBytes[OT_EXTENDED_PANID_LENGTH];
-    std::string                 masterKey;
-    std::string                 prefix;
-    uint16_t                    channel;
-    std::string                 networkName;
-    std::string                 passphrase;
-    uint16_t                    panId;
-    uint64_t                    extPanId;
-    bool                        defaultRoute;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client;
-
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    Json::Value      root;
+    Json::FastWriter jsonWriter;
+    Json::Reader     reader;
+    std::string      response;
+    otbr::Psk::Pskc  psk;
+    char             pskcStr[OT_PSKC_MAX_LENGTH * 2 + 1];
+    uint8_t          extPanIdBytes[OT_EXTENDED_PANID_LENGTH];
+    std::string      masterKey;
+    std::string      prefix;
+    uint16_t         channel;
+    std::string      networkName;
+    std::string      passphrase;
+    uint16_t         panId;
+    uint64_t         extPanId;
+    bool             defaultRoute;
+    const uint8_t *  pskc;
+    int              ret = kWpanStatus_Ok;
+
+    std::lock_guard<std::mutex> lock(mBackendMutex);
+
+    mStatusResponse.clear();
 
     pskcStr[OT_PSKC_MAX_LENGTH * 2] = '\0'; // for manipulating with strlen
     VerifyOrExit(reader.parse(aFormRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
@@ -132,21 +179,34 @@ std::string WpanService::HandleFormNetworkRequest(const std::string &aFormReques
     defaultRoute = root["defaultRoute"].asBool();
 
     otbr::Utils::Hex2Bytes(root["extPanId"].asString().c_str(), extPanIdBytes, OT_EXTENDED_PANID_LENGTH);
-    otbr::Utils::Bytes2Hex(psk.ComputePskc(extPanIdBytes, networkName.c_str(), passphrase.c_str()), OT_PSKC_MAX_LENGTH,
-                           pskcStr);
+    pskc = psk.ComputePskc(extPanIdBytes, networkName.c_str(), passphrase.c_str());
+    otbr::Utils::Bytes2Hex(pskc, OT_PSKC_MAX_LENGTH, pskcStr);
 
     if (prefix.find('/') == std::string::npos)
     {
         prefix += "/64";
     }
 
-    VerifyOrExit(client.FactoryReset(), ret = kWpanStatus_LeaveFailed);
-    VerifyOrExit((ret = commitActiveDataset(client, masterKey, networkName, channel, extPanId, panId)) ==
+#if OTBR_ENABLE_WEB_DBUS
+    if (ConnectThreadApi())
+    {
+        VerifyOrExit(mThreadApi->FactoryReset(nullptr) == DBus::ClientError::ERROR_NONE, ret = kWpanStatus_LeaveFailed);
+        VerifyOrExit(AttachDBus(masterKey, networkName, channel, extPanId, panId,
+                                std::vector<uint8_t>(pskc, pskc + OT_PSKC_MAX_LENGTH)),
+                     ret = kWpanStatus_FormFailed);
+        VerifyOrExit(AddOnMeshPrefixDBus(prefix, defaultRoute) == kWpanStatus_Ok, ret = kWpanStatus_SetFailed);
+        ExitNow();
+    }
+#endif
+
+    VerifyOrExit(mClient.Connect(), ret = kWpanStatus_SetFailed);
+    VerifyOrExit(mClient.FactoryReset(), ret = kWpanStatus_LeaveFailed);
+    VerifyOrExit((ret = commitActiveDataset(mClient, masterKey, networkName, channel, extPanId, panId)) ==
                  kWpanStatus_Ok);
-    VerifyOrExit(client.Execute("pskc %s", pskcStr) != nullptr, ret = kWpanStatus_SetFailed);
-    VerifyOrExit(client.Execute("ifconfig up") != nullptr, ret = kWpanStatus_FormFailed);
-    VerifyOrExit(client.Execute("thread start") != nullptr, ret = kWpanStatus_FormFailed);
-    VerifyOrExit(client.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
+    VerifyOrExit(mClient.Execute("pskc %s", pskcStr) != nullptr, ret = kWpanStatus_SetFailed);
+    VerifyOrExit(mClient.Execute("ifconfig up") != nullptr, ret = kWpanStatus_FormFailed);
+    VerifyOrExit(mClient.Execute("thread start") != nullptr, ret = kWpanStatus_FormFailed);
+    VerifyOrExit(mClient.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
                  ret = kWpanStatus_SetFailed);
 exit:
 
@@ -165,22 +225,32 @@ exit:
 
 std::string WpanService::HandleAddPrefixRequest(const std::string &aAddPrefixRequest)
 {
-    Json::Value                 root;
-    Json::FastWriter            jsonWriter;
-    Json::Reader                reader;
-    std::string                 response;
-    std::string                 prefix;
-    bool                        defaultRoute;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client;
+    Json::Value      root;
+    Json::FastWriter jsonWriter;
+    Json::Reader     reader;
+    std::string      response;
+    std::string      prefix;
+    bool             defaultRoute;
+    int              ret = kWpanStatus_Ok;
+
+    std::lock_guard<std::mutex> lock(mBackendMutex);
 
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    mStatusResponse.clear();
 
     VerifyOrExit(reader.parse(aAddPrefixRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
     prefix       = root["prefix"].asString();
     defaultRoute = root["defaultRoute"].asBool();
 
-    VerifyOrExit(client.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
+#if OTBR_ENABLE_WEB_DBUS
+    if (ConnectThreadApi())
+    {
+        ret = AddOnMeshPrefixDBus(prefix, defaultRoute);
+        ExitNow();
+    }
+#endif
+
+    VerifyOrExit(mClient.Connect(), ret = kWpanStatus_SetFailed);
+    VerifyOrExit(mClient.Execute("prefix add %s paso%s", prefix.c_str(), (defaultRoute ? "r" : "")) != nullptr,
                  ret = kWpanStatus_SetGatewayFailed);
 exit:
 
@@ -199,20 +269,30 @@ exit:
 
 std::string WpanService::HandleDeletePrefixRequest(const std::string &aDeleteRequest)
 {
-    Json::Value                 root;
-    Json::FastWriter            jsonWriter;
-    Json::Reader                reader;
-    std::string                 response;
-    std::string                 prefix;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client;
+    Json::Value      root;
+    Json::FastWriter jsonWriter;
+    Json::Reader     reader;
+    std::string      response;
+    std::string      prefix;
+    int              ret = kWpanStatus_Ok;
+
+    std::lock_guard<std::mutex> lock(mBackendMutex);
 
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    mStatusResponse.clear();
 
     VerifyOrExit(reader.parse(aDeleteRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
     prefix = root["prefix"].asString();
 
-    VerifyOrExit(client.Execute("prefix remove %s", prefix.c_str()) != nullptr, ret = kWpanStatus_SetGatewayFailed);
+#if OTBR_ENABLE_WEB_DBUS
+    if (ConnectThreadApi())
+    {
+        ret = RemoveOnMeshPrefixDBus(prefix);
+        ExitNow();
+    }
+#endif
+
+    VerifyOrExit(mClient.Connect(), ret = kWpanStatus_SetFailed);
+    VerifyOrExit(mClient.Execute("prefix remove %s", prefix.c_str()) != nullptr, ret = kWpanStatus_SetGatewayFailed);
 exit:
 
     root.clear();
@@ -228,73 +308,189 @@ exit:
     return response;
 }
 
+std::string WpanService::HandleUpdatePrefixesRequest(const std::string &aUpdateRequest)
+{
+    Json::Value      root;
+    Json::Value      added;
+    Json::Value      removed;
+    Json::FastWriter jsonWriter;
+    Json::Reader     reader;
+    std::string      response;
+    int              ret = kWpanStatus_Ok;
+
+    std::lock_guard<std::mutex> lock(mBackendMutex);
+
+    mStatusResponse.clear();
+
+    VerifyOrExit(reader.parse(aUpdateRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
+    added   = root["add"];
+    removed = root["remove"];
+    VerifyOrExit((added.isNull() || added.isArray()) && (removed.isNull() || removed.isArray()),
+                 ret = kWpanStatus_ParseRequestFailed);
+
+#if OTBR_ENABLE_WEB_DBUS
+    if (ConnectThreadApi())
+    {
+        ret = UpdatePrefixesDBus(added, removed);
+        ExitNow();
+    }
+#endif
+
+    // The CLI registers the network data on each command, there is no way to batch them.
+    VerifyOrExit(mClient.Connect(), ret = kWpanStatus_SetFailed);
+    for (const Json::Value &prefix : removed)
+    {
+        VerifyOrExit(mClient.Execute("prefix remove %s", prefix.asString().c_str()) != nullptr,
+                     ret = kWpanStatus_SetGatewayFailed);
+    }
+    for (const Json::Value &prefix : added)
+    {
+        VerifyOrExit(mClient.Execute("prefix add %s paso%s", prefix["prefix"].asString().c_str(),
+                                     (prefix["defaultRoute"].asBool() ? "r" : "")) != nullptr,
+                     ret = kWpanStatus_SetGatewayFailed);
+    }
+exit:
+
+    root.clear();
+
+    root["result"] = WPAN_RESPONSE_SUCCESS;
+    root["error"]  = ret;
+    if (ret != kWpanStatus_Ok)
+    {
+        otbrLog(OTBR_LOG_ERR, "wpan service error: %d", ret);
+        root["result"] = WPAN_RESPONSE_FAILURE;
+    }
+    response = jsonWriter.write(root);
+    return response;
+}
+
 std::string WpanService::HandleStatusRequest()
 {
-    Json::Value                 root, networkInfo;
-    Json::FastWriter            jsonWriter;
-    std::string                 response, networkName, extPanId, propertyValue;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client;
-    char *                      rval;
+    Json::Value      root, networkInfo;
+    Json::FastWriter jsonWriter;
+    std::string      response;
+    int              ret;
 
-    networkInfo["WPAN service"] = "uninitialized";
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_SetFailed);
+    std::lock_guard<std::mutex> lock(mBackendMutex);
 
-    VerifyOrExit((rval = client.Execute("state")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["NCP:State"] = rval;
+#if OTBR_ENABLE_WEB_DBUS
+    // Connecting dispatches the pending role change signals, which invalidate the cached status.
+    ConnectThreadApi();
+#endif
 
-    if (!strcmp(rval, "disabled"))
+    VerifyOrExit(mStatusResponse.empty() || std::chrono::steady_clock::now() - mStatusTime >= kStatusCacheMaxAge,
+                 response = mStatusResponse);
+
+    networkInfo["WPAN service"] = "uninitialized";
+    ret                         = GetStatus(networkInfo);
+    root["result"]              = networkInfo;
+
+    if (ret != kWpanStatus_Ok)
     {
-        networkInfo["WPAN service"] = "offline";
-        ExitNow();
+        root["result"] = WPAN_RESPONSE_FAILURE;
+        otbrLog(OTBR_LOG_ERR, "wpan service error: %d", ret);
     }
-    else if (!strcmp(rval, "detached"))
+    root["error"] = ret;
+    response      = jsonWriter.write(root);
+
+    // Failures are not cached, so the next request retries.
+    if (ret == kWpanStatus_Ok)
     {
-        networkInfo["WPAN service"] = "associating";
-        ExitNow();
+        mStatusResponse = response;
+        mStatusTime     = std::chrono::steady_clock::now();
     }
     else
     {
-        networkInfo["WPAN service"] = "associated";
+        mStatusResponse.clear();
     }
 
-    VerifyOrExit((rval = client.Execute("version")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["NCP:Version"] = rval;
-
-    VerifyOrExit((rval = client.Execute("eui64")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["NCP:HardwareAddress"] = rval;
+exit:
+    return response;
+}
 
-    VerifyOrExit((rval = client.Execute("channel")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["NCP:Channel"] = rval;
+int WpanService::GetStatus(Json::Value &aNetworkInfo)
+{
+    int   ret = kWpanStatus_Ok;
+    char *rval;
 
-    VerifyOrExit((rval = client.Execute("state")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:NodeType"] = rval;
+#if OTBR_ENABLE_WEB_DBUS
+    if (mThreadApi != nullptr)
+    {
+        ret = GetStatusDBus(aNetworkInfo);
+        ExitNow();
+    }
+#endif
 
-    VerifyOrExit((rval = client.Execute("networkname")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:Name"] = rval;
+    VerifyOrExit(mClient.Connect(), ret = kWpanStatus_SetFailed);
 
-    VerifyOrExit((rval = client.Execute("extpanid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:XPANID"] = rval;
+    VerifyOrExit((rval = mClient.Execute("state")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+    aNetworkInfo["NCP:State"] = rval;
 
-    VerifyOrExit((rval = client.Execute("panid")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
-    networkInfo["Network:PANID"] = rval;
+    if (!strcmp(rval, "disabled"))
+    {
+        aNetworkInfo["WPAN service"] = "offline";
+        ExitNow();
+    }
+    else if (!strcmp(rval, "detached"))
+    {
+        aNetworkInfo["WPAN service"] = "associating";
+        ExitNow();
+    }
+    else
+    {
+        aNetworkInfo["WPAN service"] = "associated";
+    }
 
     {
+        struct Property
+        {
+            const char *mCommand;
+            const char *mName;
+        };
+
+        static const Property kProperties[] = {
+            {"version", "NCP:Version"},
+            {"eui64", "NCP:HardwareAddress"},
+            {"channel", "NCP:Channel"},
+            {"state", "Network:NodeType"},
+            {"networkname", "Network:Name"},
+            {"extpanid", "Network:XPANID"},
+            {"panid", "Network:PANID"},
+        };
         static const char kMeshLocalPrefixLocator[]       = "Mesh Local Prefix: ";
         static const char kMeshLocalAddressTokenLocator[] = "0:ff:fe00:";
-        std::string       meshLocalPrefix;
 
-        VerifyOrExit((rval = client.Execute("dataset active")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+        OpenThreadClient::CommandId commands[sizeof(kProperties) / sizeof(kProperties[0])];
+        OpenThreadClient::CommandId datasetCommand;
+        OpenThreadClient::CommandId addressCommand;
+        std::string                 meshLocalPrefix;
+
+        // All commands are sent before waiting for the first response, so they take a single round trip.
+        for (size_t i = 0; i < sizeof(kProperties) / sizeof(kProperties[0]); i++)
+        {
+            commands[i] = mClient.Send(kProperties[i].mCommand);
+        }
+
+        datasetCommand = mClient.Send("dataset active");
+        addressCommand = mClient.Send("ipaddr");
+
+        for (size_t i = 0; i < sizeof(kProperties) / sizeof(kProperties[0]); i++)
+        {
+            VerifyOrExit((rval = mClient.Wait(commands[i])) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+            aNetworkInfo[kProperties[i].mName] = rval;
+        }
+
+        VerifyOrExit((rval = mClient.Wait(datasetCommand)) != nullptr, ret = kWpanStatus_GetPropertyFailed);
         rval = strstr(rval, kMeshLocalPrefixLocator);
         rval += sizeof(kMeshLocalPrefixLocator) - 1;
         *strstr(rval, "\r\n") = '\0';
 
-        networkInfo["IPv6:MeshLocalPrefix"] = rval;
+        aNetworkInfo["IPv6:MeshLocalPrefix"] = rval;
 
         meshLocalPrefix = rval;
         meshLocalPrefix.resize(meshLocalPrefix.find(":/"));
 
-        VerifyOrExit((rval = client.Execute("ipaddr")) != nullptr, ret = kWpanStatus_GetPropertyFailed);
+        VerifyOrExit((rval = mClient.Wait(addressCommand)) != nullptr, ret = kWpanStatus_GetPropertyFailed);
 
         for (rval = strtok(rval, "\r\n"); rval != nullptr; rval = strtok(nullptr, "\r\n"))
         {
@@ -319,69 +515,158 @@ std::string WpanService::HandleStatusRequest()
             }
         }
 
-        networkInfo["IPv6:MeshLocalAddress"] = rval;
+        aNetworkInfo["IPv6:MeshLocalAddress"] = rval;
     }
 
 exit:
+    return ret;
+}
+
+std::string WpanService::HandleAvailableNetworkRequest(const std::string &aRequest)
+{
+    Json::Value      root, networks, networkInfo;
+    Json::Reader     reader;
+    Json::FastWriter jsonWriter;
+    std::string      response;
+    bool             rescan = false;
+    int              ret    = kWpanStatus_Ok;
+
+    if (!aRequest.empty())
+    {
+        VerifyOrExit(reader.parse(aRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
+        rescan = root["rescan"].asBool();
+        root.clear();
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mScanMutex);
+
+        if (rescan || mNetworksCount == 0 || mScanCacheMaxAge.count() == 0)
+        {
+            // Requests arriving meanwhile wait for the same scan instead of starting their own.
+            StartScan();
+            mScanCondition.wait(lock, [this]() { return !mScanning; });
+            VerifyOrExit(mScanStatus == kWpanStatus_Ok, ret = mScanStatus);
+        }
+        else if (std::chrono::steady_clock::now() - mScanTime >= mScanCacheMaxAge)
+        {
+            // The stale results are still served, the next request gets the refreshed ones.
+            StartScan();
+        }
+
+        VerifyOrExit(mNetworksCount > 0, ret = kWpanStatus_NetworkNotFound);
+
+        for (int i = 0; i < mNetworksCount; i++)
+        {
+            char extPanId[OT_EXTENDED_PANID_LENGTH * 2 + 1], panId[OT_PANID_LENGTH * 2 + 3],
+                hardwareAddress[OT_HARDWARE_ADDRESS_LENGTH * 2 + 1];
+            otbr::Utils::Long2Hex(bswap_64(mNetworks[i].mExtPanId), extPanId);
+            otbr::Utils::Bytes2Hex(mNetworks[i].mHardwareAddress, OT_HARDWARE_ADDRESS_LENGTH, hardwareAddress);
+            sprintf(panId, "0x%X", mNetworks[i].mPanId);
+            networkInfo[i]["nn"] = mNetworks[i].mNetworkName;
+            networkInfo[i]["xp"] = extPanId;
+            networkInfo[i]["pi"] = panId;
+            networkInfo[i]["ch"] = mNetworks[i].mChannel;
+            networkInfo[i]["ha"] = hardwareAddress;
+        }
+    }
+
     root["result"] = networkInfo;
 
+exit:
     if (ret != kWpanStatus_Ok)
     {
         root["result"] = WPAN_RESPONSE_FAILURE;
-        otbrLog(OTBR_LOG_ERR, "wpan service error: %d", ret);
+        otbrLog(OTBR_LOG_ERR, "Error is %d", ret);
     }
     root["error"] = ret;
     response      = jsonWriter.write(root);
     return response;
 }
 
-std::string WpanService::HandleAvailableNetworkRequest()
+int WpanService::Scan(WpanNetworkInfo *aNetworks, int aLength)
 {
-    Json::Value                 root, networks, networkInfo;
-    Json::FastWriter            jsonWriter;
-    std::string                 response;
-    int                         ret = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client;
-
-    VerifyOrExit(client.Connect(), ret = kWpanStatus_ScanFailed);
-    VerifyOrExit((mNetworksCount = client.Scan(mNetworks, sizeof(mNetworks) / sizeof(mNetworks[0]))) > 0,
-                 ret = kWpanStatus_NetworkNotFound);
-
-    for (int i = 0; i < mNetworksCount; i++)
-    {
-        char extPanId[OT_EXTENDED_PANID_LENGTH * 2 + 1], panId[OT_PANID_LENGTH * 2 + 3],
-            hardwareAddress[OT_HARDWARE_ADDRESS_LENGTH * 2 + 1];
-        otbr::Utils::Long2Hex(bswap_64(mNetworks[i].mExtPanId), extPanId);
-        otbr::Utils::Bytes2Hex(mNetworks[i].mHardwareAddress, OT_HARDWARE_ADDRESS_LENGTH, hardwareAddress);
-        sprintf(panId, "0x%X", mNetworks[i].mPanId);
-        networkInfo[i]["nn"] = mNetworks[i].mNetworkName;
-        networkInfo[i]["xp"] = extPanId;
-        networkInfo[i]["pi"] = panId;
-        networkInfo[i]["ch"] = mNetworks[i].mChannel;
-        networkInfo[i]["ha"] = hardwareAddress;
+    int count = -1;
+
+    std::lock_guard<std::mutex> lock(mBackendMutex);
+
+#if OTBR_ENABLE_WEB_DBUS
+    if (ConnectThreadApi())
+    {
+        ExitNow(count = ScanDBus(aNetworks, aLength));
     }
+#endif
 
-    root["result"] = networkInfo;
+    VerifyOrExit(mClient.Connect());
+    count = mClient.Scan(aNetworks, aLength);
 
 exit:
-    if (ret != kWpanStatus_Ok)
+    return count;
+}
+
+void WpanService::StartScan(void)
+{
+    VerifyOrExit(!mScanning);
+
+    // The previous scan thread has finished, it is only left to be joined.
+    if (mScanThread.joinable())
     {
-        root["result"] = WPAN_RESPONSE_FAILURE;
-        otbrLog(OTBR_LOG_ERR, "Error is %d", ret);
+        mScanThread.join();
     }
-    root["error"] = ret;
-    response      = jsonWriter.write(root);
-    return response;
+
+    mScanning   = true;
+    mScanThread = std::thread(&WpanService::RunScan, this);
+
+exit:
+    return;
+}
+
+void WpanService::RunScan(void)
+{
+    WpanNetworkInfo networks[OT_SCANNED_NET_BUFFER_SIZE];
+    int             count;
+
+    // Scanning takes seconds, so it is done without holding the results, which requests keep serving meanwhile.
+    count = Scan(networks, sizeof(networks) / sizeof(networks[0]));
+
+    {
+        std::lock_guard<std::mutex> lock(mScanMutex);
+
+        if (count < 0)
+        {
+            mScanStatus = kWpanStatus_ScanFailed;
+        }
+        else
+        {
+            std::copy(networks, networks + count, mNetworks);
+            mNetworksCount = count;
+            mScanStatus    = (count > 0 ? kWpanStatus_Ok : kWpanStatus_NetworkNotFound);
+            mScanTime      = std::chrono::steady_clock::now();
+        }
+
+        mScanning = false;
+    }
+
+    mScanCondition.notify_all();
 }
 
-int WpanService::GetWpanServiceStatus(std::string &aNetworkName, std::string &aExtPanId) const
+int WpanService::GetWpanServiceStatus(std::string &aNetworkName, std::string &aExtPanId)
 {
-    int                         status = kWpanStatus_Ok;
-    otbr::Web::OpenThreadClient client;
-    const char *                rval;
+    int          status = kWpanStatus_Ok;
+    const char * rval;
+
+    std::lock_guard<std::mutex> lock(mBackendMutex);
+
+#if OTBR_ENABLE_WEB_DBUS
+    if (ConnectThreadApi())
+    {
+        status = GetWpanServiceStatusDBus(aNetworkName, aExtPanId);
+        ExitNow();
+    }
+#endif
 
-    VerifyOrExit(client.Connect(), status = kWpanStatus_Uninitialized);
-    rval = client.Execute("state");
+    VerifyOrExit(mClient.Connect(), status = kWpanStatus_Uninitialized);
+    rval = mClient.Execute("state");
     VerifyOrExit(rval != nullptr, status = kWpanStatus_Down);
     if (!strcmp(rval, "disabled"))
     {
@@ -393,11 +678,11 @@ int WpanService::GetWpanServiceStatus(std::string &aNetworkName, std::string &aE
     }
     else
     {
-        rval = client.Execute("networkname");
+        rval = mClient.Execute("networkname");
         VerifyOrExit(rval != nullptr, status = kWpanStatus_Down);
         aNetworkName = rval;
 
-        rval = client.Execute("extpanid");
+        rval = mClient.Execute("extpanid");
         VerifyOrExit(rval != nullptr, status = kWpanStatus_Down);
         aExtPanId = rval;
     }
@@ -415,16 +700,19 @@ std::string WpanService::HandleCommission(const std::string &aCommissionRequest)
     std::string  pskd;
     std::string  response;
 
+    std::lock_guard<std::mutex> lock(mBackendMutex);
+
+    mStatusResponse.clear();
+
     VerifyOrExit(reader.parse(aCommissionRequest.c_str(), root) == true, ret = kWpanStatus_ParseRequestFailed);
     pskd = root["pskd"].asString();
     {
-        otbr::Web::OpenThreadClient client;
-        const char *                rval;
+        const char *rval;
 
-        VerifyOrExit(client.Connect(), ret = kWpanStatus_Uninitialized);
-        rval = client.Execute("commissioner start");
+        VerifyOrExit(mClient.Connect(), ret = kWpanStatus_Uninitialized);
+        rval = mClient.Execute("commissioner start");
         VerifyOrExit(rval != nullptr, ret = kWpanStatus_Down);
-        rval = client.Execute("commissioner joiner add * %s", pskd.c_str());
+        rval = mClient.Execute("commissioner joiner add * %s", pskd.c_str());
         VerifyOrExit(rval != nullptr, ret = kWpanStatus_Down);
         root["error"] = ret;
     }
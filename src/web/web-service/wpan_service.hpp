@@ -42,14 +42,30 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
 #include <json/json.h>
 #include <json/writer.h>
 
+#if OTBR_ENABLE_WEB_DBUS
+#include <memory>
+#include <vector>
+
+#include <dbus/dbus.h>
+#endif
+
 #include "common/logging.hpp"
 #include "utils/hex.hpp"
 #include "utils/pskc.hpp"
 #include "web/web-service/ot_client.hpp"
 
+#if OTBR_ENABLE_WEB_DBUS
+#include "dbus/client/thread_api_dbus.hpp"
+#endif
+
 /**
  * WPAN parameter constants
  *
@@ -69,10 +85,28 @@ namespace Web {
 /**
  * This class provides web service to manage WPAN.
  *
+ * When built with OTBR_ENABLE_WEB_DBUS, requests are served through the D-Bus API of otbr-agent, and the OpenThread
+ * CLI is only used when the D-Bus API is unavailable or lacks the operation.
+ *
+ * The status is cached until the Thread state changes or it ages out. Scan results are cached for a configurable age
+ * and refreshed by a background scan, which concurrent requests share.
+ *
  */
 class WpanService
 {
 public:
+    /**
+     * This constructor initializes the WPAN service.
+     *
+     */
+    WpanService(void);
+
+    /**
+     * This destructor waits for a pending background scan.
+     *
+     */
+    ~WpanService(void);
+
     /**
      * This method handles the http request to join network.
      *
@@ -113,6 +147,19 @@ public:
      */
     std::string HandleDeletePrefixRequest(const std::string &aDeleteRequest);
 
+    /**
+     * This method handles the http request to add and delete several on-mesh prefixes at once.
+     *
+     * The request is `{"add": [{"prefix": ..., "defaultRoute": ...}, ...], "remove": [prefix, ...]}`, the prefixes
+     * are removed before the others are added.
+     *
+     * @param[in]  aUpdateRequest  A reference to the http request of updating on-mesh prefixes.
+     *
+     * @returns The string to the http response of updating on-mesh prefixes.
+     *
+     */
+    std::string HandleUpdatePrefixesRequest(const std::string &aUpdateRequest);
+
     /**
      * This method handles http request to get netowrk status.
      *
@@ -124,10 +171,28 @@ public:
     /**
      * This method handles http request to get available networks.
      *
+     * Cached results are returned if available, and refreshed in the background once older than the scan cache age.
+     * A scan is done before responding if there is no result yet, or if the request is `{"rescan": true}`.
+     *
+     * @param[in]  aRequest  A reference to the http request, may be empty.
+     *
      * @returns The string to the http response of getting available networks.
      *
      */
-    std::string HandleAvailableNetworkRequest(void);
+    std::string HandleAvailableNetworkRequest(const std::string &aRequest);
+
+    /**
+     * This method sets how long scan results are served before being refreshed.
+     *
+     * @param[in]  aSeconds  The maximum age of scan results in seconds, 0 to scan for every request.
+     *
+     */
+    void SetScanCacheMaxAge(uint32_t aSeconds)
+    {
+        std::lock_guard<std::mutex> lock(mScanMutex);
+
+        mScanCacheMaxAge = std::chrono::seconds(aSeconds);
+    }
 
     /**
      * This method handles http request to commission device
@@ -160,7 +225,7 @@ public:
      * @retval kWpanStatus_Down      The Thread service was down.
      *
      */
-    int GetWpanServiceStatus(std::string &aNetworkName, std::string &aExtPanId) const;
+    int GetWpanServiceStatus(std::string &aNetworkName, std::string &aExtPanId);
 
     /**
      * This method starts commissioner and wait for a device to join
@@ -182,11 +247,61 @@ private:
                                            uint16_t                     aPanId);
     static std::string escapeOtCliEscapable(const std::string &aArg);
 
-    WpanNetworkInfo mNetworks[OT_SCANNED_NET_BUFFER_SIZE];
-    int             mNetworksCount;
-    char            mIfName[IFNAMSIZ];
-    std::string     mNetworkName;
-    std::string     mExtPanId;
+    int  GetStatus(Json::Value &aNetworkInfo);
+    int  Scan(WpanNetworkInfo *aNetworks, int aLength);
+    void StartScan(void);
+    void RunScan(void);
+
+#if OTBR_ENABLE_WEB_DBUS
+    struct DBusConnectionDeleter
+    {
+        void operator()(DBusConnection *aConnection) const;
+    };
+
+    bool ConnectThreadApi(void);
+    void DisconnectThreadApi(void);
+    bool AttachDBus(const std::string &         aMasterKey,
+                    const std::string &         aNetworkName,
+                    uint16_t                    aChannel,
+                    uint64_t                    aExtPanId,
+                    uint16_t                    aPanId,
+                    const std::vector<uint8_t> &aPskc);
+    int  AddOnMeshPrefixDBus(const std::string &aPrefix, bool aDefaultRoute);
+    int  RemoveOnMeshPrefixDBus(const std::string &aPrefix);
+    int  UpdatePrefixesDBus(const Json::Value &aAdded, const Json::Value &aRemoved);
+    int  GetStatusDBus(Json::Value &aNetworkInfo);
+    int  ScanDBus(WpanNetworkInfo *aNetworks, int aLength);
+    int  GetWpanServiceStatusDBus(std::string &aNetworkName, std::string &aExtPanId);
+#endif
+
+    char        mIfName[IFNAMSIZ];
+    std::string mNetworkName;
+    std::string mExtPanId;
+
+    // Serializes the use of the backends between the request handlers and the scan thread.
+    std::mutex       mBackendMutex;
+    OpenThreadClient mClient;
+
+#if OTBR_ENABLE_WEB_DBUS
+    // The connection must outlive the API object using it.
+    std::unique_ptr<DBusConnection, DBusConnectionDeleter> mDBusConnection;
+    std::unique_ptr<DBus::ThreadApiDBus>                   mThreadApi;
+#endif
+
+    // The last successful status response, guarded by mBackendMutex and empty when invalidated.
+    std::string                           mStatusResponse;
+    std::chrono::steady_clock::time_point mStatusTime;
+
+    // The scan results and the state of the scan thread, guarded by mScanMutex.
+    std::mutex                            mScanMutex;
+    std::condition_variable               mScanCondition;
+    std::thread                           mScanThread;
+    bool                                  mScanning;
+    int                                   mScanStatus;
+    std::chrono::steady_clock::time_point mScanTime;
+    std::chrono::seconds                  mScanCacheMaxAge;
+    WpanNetworkInfo                       mNetworks[OT_SCANNED_NET_BUFFER_SIZE];
+    int                                   mNetworksCount;
 
     enum
     {
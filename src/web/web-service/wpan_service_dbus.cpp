@@ -0,0 +1,396 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the wpan controller service on top of the otbr-agent D-Bus API.
+ */
+
+#include "web/web-service/wpan_service.hpp"
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "common/code_utils.hpp"
+#include "common/types.hpp"
+#include "dbus/common/constants.hpp"
+#include "utils/strcpy_utils.hpp"
+
+namespace otbr {
+namespace Web {
+
+using DBus::ActiveScanResult;
+using DBus::ClientError;
+using DBus::DeviceRole;
+using DBus::Ip6Prefix;
+using DBus::OnMeshPrefix;
+
+static bool ParsePrefix(const std::string &aPrefix, Ip6Prefix &aIp6Prefix)
+{
+    bool          rval   = false;
+    size_t        slash  = aPrefix.find('/');
+    unsigned long length = OTBR_IP6_PREFIX_SIZE * 8;
+    Ip6Address    address;
+
+    if (slash != std::string::npos)
+    {
+        char *end;
+
+        length = strtoul(aPrefix.c_str() + slash + 1, &end, 10);
+        VerifyOrExit(*end == '\0' && length <= OTBR_IP6_PREFIX_SIZE * 8);
+    }
+
+    VerifyOrExit(Ip6Address::FromString(aPrefix.substr(0, slash).c_str(), address) == OTBR_ERROR_NONE);
+
+    aIp6Prefix.mPrefix.assign(address.m8, address.m8 + (length + 7) / 8);
+    aIp6Prefix.mLength = static_cast<uint8_t>(length);
+    rval               = true;
+
+exit:
+    if (!rval)
+    {
+        otbrLog(OTBR_LOG_WARNING, "Invalid prefix: %s", aPrefix.c_str());
+    }
+
+    return rval;
+}
+
+void WpanService::DBusConnectionDeleter::operator()(DBusConnection *aConnection) const
+{
+    dbus_connection_close(aConnection);
+    dbus_connection_unref(aConnection);
+}
+
+bool WpanService::ConnectThreadApi(void)
+{
+    DBusError error;
+
+    dbus_error_init(&error);
+
+    if (mDBusConnection != nullptr && !dbus_connection_get_is_connected(mDBusConnection.get()))
+    {
+        otbrLog(OTBR_LOG_WARNING, "Lost connection to D-Bus");
+        DisconnectThreadApi();
+    }
+
+    VerifyOrExit(mThreadApi == nullptr);
+
+    mDBusConnection.reset(dbus_bus_get_private(DBUS_BUS_SYSTEM, &error));
+    VerifyOrExit(mDBusConnection != nullptr,
+                 otbrLog(OTBR_LOG_WARNING, "Failed to connect to D-Bus, using the CLI: %s", error.message));
+    dbus_connection_set_exit_on_disconnect(mDBusConnection.get(), false);
+    mThreadApi.reset(new DBus::ThreadApiDBus(mDBusConnection.get(), mIfName));
+    mThreadApi->AddDeviceRoleHandler([this](DeviceRole) { mStatusResponse.clear(); });
+
+exit:
+    dbus_error_free(&error);
+
+    if (mThreadApi != nullptr)
+    {
+        // Nothing drives the connection between requests, so dispatch the replies and signals received meanwhile.
+        dbus_connection_read_write(mDBusConnection.get(), 0);
+
+        while (dbus_connection_dispatch(mDBusConnection.get()) == DBUS_DISPATCH_DATA_REMAINS)
+        {
+        }
+    }
+
+    return mThreadApi != nullptr;
+}
+
+void WpanService::DisconnectThreadApi(void)
+{
+    mThreadApi.reset();
+    mDBusConnection.reset();
+}
+
+bool WpanService::AttachDBus(const std::string &         aMasterKey,
+                             const std::string &         aNetworkName,
+                             uint16_t                    aChannel,
+                             uint64_t                    aExtPanId,
+                             uint16_t                    aPanId,
+                             const std::vector<uint8_t> &aPskc)
+{
+    std::vector<uint8_t> masterKey(OTBR_MASTER_KEY_SIZE);
+    ClientError          error = ClientError::ERROR_NONE;
+
+    VerifyOrExit(Utils::Hex2Bytes(aMasterKey.c_str(), masterKey.data(), OTBR_MASTER_KEY_SIZE) == OTBR_MASTER_KEY_SIZE,
+                 error = ClientError::OT_ERROR_INVALID_ARGS);
+
+    // Like "thread start" of the CLI, the request completes without waiting for the device to attach.
+    error = mThreadApi->Attach(aNetworkName, aPanId, aExtPanId, masterKey, aPskc, 1u << aChannel,
+                               [](ClientError aError) {
+                                   if (aError != ClientError::ERROR_NONE)
+                                   {
+                                       otbrLog(OTBR_LOG_WARNING, "Failed to attach: %d", static_cast<int>(aError));
+                                   }
+                               });
+
+exit:
+    if (error != ClientError::ERROR_NONE)
+    {
+        otbrLog(OTBR_LOG_ERR, "Failed to start attaching: %d", static_cast<int>(error));
+    }
+
+    return error == ClientError::ERROR_NONE;
+}
+
+int WpanService::AddOnMeshPrefixDBus(const std::string &aPrefix, bool aDefaultRoute)
+{
+    OnMeshPrefix prefix;
+    int          ret = kWpanStatus_Ok;
+
+    VerifyOrExit(ParsePrefix(aPrefix, prefix.mPrefix), ret = kWpanStatus_ParseRequestFailed);
+
+    // The flags of "prefix add <prefix> paso[r]".
+    prefix.mPreference   = 0;
+    prefix.mPreferred    = true;
+    prefix.mSlaac        = true;
+    prefix.mDhcp         = false;
+    prefix.mConfigure    = false;
+    prefix.mDefaultRoute = aDefaultRoute;
+    prefix.mOnMesh       = true;
+    prefix.mStable       = true;
+
+    VerifyOrExit(mThreadApi->AddOnMeshPrefix(prefix) == ClientError::ERROR_NONE, ret = kWpanStatus_SetGatewayFailed);
+
+exit:
+    return ret;
+}
+
+int WpanService::RemoveOnMeshPrefixDBus(const std::string &aPrefix)
+{
+    Ip6Prefix prefix;
+    int       ret = kWpanStatus_Ok;
+
+    VerifyOrExit(ParsePrefix(aPrefix, prefix), ret = kWpanStatus_ParseRequestFailed);
+    VerifyOrExit(mThreadApi->RemoveOnMeshPrefix(prefix) == ClientError::ERROR_NONE, ret = kWpanStatus_SetGatewayFailed);
+
+exit:
+    return ret;
+}
+
+int WpanService::UpdatePrefixesDBus(const Json::Value &aAdded, const Json::Value &aRemoved)
+{
+    std::vector<OnMeshPrefix> added;
+    std::vector<Ip6Prefix>    removed(aRemoved.size());
+    std::vector<uint8_t>      errors;
+    int                       ret = kWpanStatus_Ok;
+
+    for (const Json::Value &value : aAdded)
+    {
+        OnMeshPrefix prefix;
+
+        VerifyOrExit(ParsePrefix(value["prefix"].asString(), prefix.mPrefix), ret = kWpanStatus_ParseRequestFailed);
+
+        // The flags of "prefix add <prefix> paso[r]".
+        prefix.mPreference   = 0;
+        prefix.mPreferred    = true;
+        prefix.mSlaac        = true;
+        prefix.mDhcp         = false;
+        prefix.mConfigure    = false;
+        prefix.mDefaultRoute = value["defaultRoute"].asBool();
+        prefix.mOnMesh       = true;
+        prefix.mStable       = true;
+
+        added.push_back(std::move(prefix));
+    }
+
+    for (Json::ArrayIndex i = 0; i < aRemoved.size(); i++)
+    {
+        VerifyOrExit(ParsePrefix(aRemoved[i].asString(), removed[i]), ret = kWpanStatus_ParseRequestFailed);
+    }
+
+    // All the prefixes are registered with the leader once.
+    VerifyOrExit(mThreadApi->UpdateNetworkData(added, removed, {}, {}, errors) == ClientError::ERROR_NONE,
+                 ret = kWpanStatus_SetGatewayFailed);
+    for (uint8_t error : errors)
+    {
+        VerifyOrExit(static_cast<ClientError>(error) == ClientError::ERROR_NONE, ret = kWpanStatus_SetGatewayFailed);
+    }
+
+exit:
+    return ret;
+}
+
+int WpanService::GetStatusDBus(Json::Value &aNetworkInfo)
+{
+    std::string                               role;
+    std::string                               version;
+    std::string                               networkName;
+    uint64_t                                  eui64;
+    uint64_t                                  extPanId;
+    uint16_t                                  channel;
+    uint16_t                                  panId;
+    uint16_t                                  rloc16;
+    std::array<uint8_t, OTBR_IP6_PREFIX_SIZE> meshLocalPrefix;
+    uint16_t                                  groups[OTBR_IP6_PREFIX_SIZE / 2];
+    char                                      buffer[sizeof("ffff:ffff:ffff:ffff:0:ff:fe00:ffff")];
+    int                                       ret = kWpanStatus_Ok;
+
+    // A single call fetches all of them.
+    VerifyOrExit(mThreadApi->GetProperties({OTBR_DBUS_PROPERTY_DEVICE_ROLE, OTBR_DBUS_PROPERTY_VERSION,
+                                            OTBR_DBUS_PROPERTY_EUI64, OTBR_DBUS_PROPERTY_CHANNEL,
+                                            OTBR_DBUS_PROPERTY_NETWORK_NAME, OTBR_DBUS_PROPERTY_EXTPANID,
+                                            OTBR_DBUS_PROPERTY_PANID, OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX,
+                                            OTBR_DBUS_PROPERTY_RLOC16},
+                                           role, version, eui64, channel, networkName, extPanId, panId,
+                                           meshLocalPrefix, rloc16) == ClientError::ERROR_NONE,
+                 ret = kWpanStatus_GetPropertyFailed);
+
+    aNetworkInfo["NCP:State"] = role;
+
+    if (role == OTBR_ROLE_NAME_DISABLED)
+    {
+        aNetworkInfo["WPAN service"] = "offline";
+        ExitNow();
+    }
+    else if (role == OTBR_ROLE_NAME_DETACHED)
+    {
+        aNetworkInfo["WPAN service"] = "associating";
+        ExitNow();
+    }
+
+    aNetworkInfo["WPAN service"] = "associated";
+
+    // The values are formatted the way the CLI prints them.
+    aNetworkInfo["NCP:Version"] = version;
+    snprintf(buffer, sizeof(buffer), "%016" PRIx64, eui64);
+    aNetworkInfo["NCP:HardwareAddress"] = buffer;
+    aNetworkInfo["NCP:Channel"]         = std::to_string(channel);
+    aNetworkInfo["Network:NodeType"]    = role;
+    aNetworkInfo["Network:Name"]        = networkName;
+    snprintf(buffer, sizeof(buffer), "%016" PRIx64, extPanId);
+    aNetworkInfo["Network:XPANID"] = buffer;
+    snprintf(buffer, sizeof(buffer), "0x%04x", panId);
+    aNetworkInfo["Network:PANID"] = buffer;
+
+    for (size_t i = 0; i < sizeof(groups) / sizeof(groups[0]); i++)
+    {
+        groups[i] = static_cast<uint16_t>((meshLocalPrefix[2 * i] << 8) | meshLocalPrefix[2 * i + 1]);
+    }
+
+    snprintf(buffer, sizeof(buffer), "%x:%x:%x:%x::/64", groups[0], groups[1], groups[2], groups[3]);
+    aNetworkInfo["IPv6:MeshLocalPrefix"] = buffer;
+    snprintf(buffer, sizeof(buffer), "%x:%x:%x:%x:0:ff:fe00:%x", groups[0], groups[1], groups[2], groups[3], rloc16);
+    aNetworkInfo["IPv6:MeshLocalAddress"] = buffer;
+
+exit:
+    return ret;
+}
+
+int WpanService::ScanDBus(WpanNetworkInfo *aNetworks, int aLength)
+{
+    bool        done  = false;
+    int         count = 0;
+    ClientError error;
+
+    error = mThreadApi->Scan([aNetworks, aLength, &done, &count](const std::vector<ActiveScanResult> &aResults) {
+        for (const ActiveScanResult &result : aResults)
+        {
+            if (count == aLength)
+            {
+                break;
+            }
+
+            WpanNetworkInfo &network = aNetworks[count];
+
+            if (strcpy_safe(network.mNetworkName, sizeof(network.mNetworkName), result.mNetworkName.c_str()) != 0)
+            {
+                continue;
+            }
+
+            network.mAllowingJoin = result.mIsJoinable;
+            network.mPanId        = result.mPanId;
+            network.mChannel      = result.mChannel;
+            network.mExtPanId     = result.mExtendedPanId;
+            network.mRssi         = result.mRssi;
+
+            for (size_t i = 0; i < sizeof(network.mHardwareAddress); i++)
+            {
+                network.mHardwareAddress[i] = static_cast<uint8_t>(result.mExtAddress >> (56 - 8 * i));
+            }
+
+            ++count;
+        }
+
+        done = true;
+    });
+    VerifyOrExit(error == ClientError::ERROR_NONE,
+                 otbrLog(OTBR_LOG_ERR, "Failed to scan: %d", static_cast<int>(error)));
+
+    // The handler is called once the scan completes, or with no result when the D-Bus call times out.
+    while (!done)
+    {
+        if (!dbus_connection_read_write_dispatch(mDBusConnection.get(), -1))
+        {
+            // The handler refers to the locals, it goes away with the API object.
+            DisconnectThreadApi();
+            ExitNow();
+        }
+    }
+
+exit:
+    return count;
+}
+
+int WpanService::GetWpanServiceStatusDBus(std::string &aNetworkName, std::string &aExtPanId)
+{
+    std::string role;
+    std::string networkName;
+    uint64_t    extPanId;
+    char        buffer[sizeof("0011223344556677")];
+    int         status = kWpanStatus_Ok;
+
+    VerifyOrExit(mThreadApi->GetProperties({OTBR_DBUS_PROPERTY_DEVICE_ROLE, OTBR_DBUS_PROPERTY_NETWORK_NAME,
+                                            OTBR_DBUS_PROPERTY_EXTPANID},
+                                           role, networkName, extPanId) == ClientError::ERROR_NONE,
+                 status = kWpanStatus_Down);
+
+    if (role == OTBR_ROLE_NAME_DISABLED)
+    {
+        status = kWpanStatus_Offline;
+    }
+    else if (role == OTBR_ROLE_NAME_DETACHED)
+    {
+        status = kWpanStatus_Associating;
+    }
+    else
+    {
+        snprintf(buffer, sizeof(buffer), "%016" PRIx64, extPanId);
+        aNetworkName = networkName;
+        aExtPanId    = buffer;
+    }
+
+exit:
+    return status;
+}
+
+} // namespace Web
+} // namespace otbr
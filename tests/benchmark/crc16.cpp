@@ -0,0 +1,202 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a microbenchmark of the CRC16 computation.
+ *
+ *   It computes the CRC16 of a buffer with both polynomials bit by bit, the way `Crc16::Update` did before, byte by
+ *   byte with the lookup table, and with the slicing-by-8 bulk update. The throughput of each is reported and the
+ *   results are checked to be the same.
+ */
+
+#include <openthread-br/config.h>
+
+#include <chrono>
+#include <vector>
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sysexits.h>
+
+#include "common/code_utils.hpp"
+#include "utils/crc16.hpp"
+
+using otbr::Crc16;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+enum
+{
+    OTBR_OPT_HELP       = 'h',
+    OTBR_OPT_ITERATIONS = 'i',
+    OTBR_OPT_SIZE       = 's',
+};
+
+static const struct option kOptions[] = {{"help", no_argument, nullptr, OTBR_OPT_HELP},
+                                         {"iterations", required_argument, nullptr, OTBR_OPT_ITERATIONS},
+                                         {"size", required_argument, nullptr, OTBR_OPT_SIZE},
+                                         {0, 0, 0, 0}};
+
+static const unsigned long kDefaultIterations = 1000;
+static const unsigned long kDefaultSize       = 4096;
+
+typedef uint16_t (*ComputeFunction)(Crc16::Polynomial aPolynomial, const std::vector<uint8_t> &aBuffer);
+
+static void PrintUsage(const char *aProgramName, FILE *aStream)
+{
+    fprintf(aStream,
+            "Syntax:\n"
+            "    %s [-s size] [-i iterations]\n"
+            "Defaults: %lu bytes, %lu iterations.\n",
+            aProgramName, kDefaultSize, kDefaultIterations);
+}
+
+static bool ParseNumber(const char *aString, unsigned long &aNumber)
+{
+    char *end;
+
+    aNumber = strtoul(aString, &end, 0);
+
+    return *aString != '\0' && *end == '\0';
+}
+
+static uint16_t ComputeBitwise(Crc16::Polynomial aPolynomial, const std::vector<uint8_t> &aBuffer)
+{
+    uint16_t crc = 0;
+
+    for (uint8_t byte : aBuffer)
+    {
+        crc = crc ^ static_cast<uint16_t>(byte << 8);
+
+        for (uint8_t i = 0; i < 8; i++)
+        {
+            crc = (crc & 0x8000) ? static_cast<uint16_t>(static_cast<uint16_t>(crc << 1) ^ aPolynomial)
+                                 : static_cast<uint16_t>(crc << 1);
+        }
+    }
+
+    return crc;
+}
+
+static uint16_t ComputeBytes(Crc16::Polynomial aPolynomial, const std::vector<uint8_t> &aBuffer)
+{
+    Crc16 crc(aPolynomial);
+
+    for (uint8_t byte : aBuffer)
+    {
+        crc.Update(byte);
+    }
+
+    return crc.Get();
+}
+
+static uint16_t ComputeBulk(Crc16::Polynomial aPolynomial, const std::vector<uint8_t> &aBuffer)
+{
+    Crc16 crc(aPolynomial);
+
+    crc.Update(aBuffer.data(), aBuffer.size());
+
+    return crc.Get();
+}
+
+static uint16_t Run(const char *                aName,
+                    ComputeFunction             aCompute,
+                    Crc16::Polynomial           aPolynomial,
+                    const std::vector<uint8_t> &aBuffer,
+                    unsigned long               aIterations)
+{
+    steady_clock::time_point start = steady_clock::now();
+    uint16_t                 crc   = 0;
+    uint64_t                 elapsedNs;
+
+    for (unsigned long i = 0; i < aIterations; i++)
+    {
+        crc ^= aCompute(aPolynomial, aBuffer);
+    }
+
+    elapsedNs = static_cast<uint64_t>(duration_cast<nanoseconds>(steady_clock::now() - start).count());
+    printf("%-6s %-8s throughput (MB/s): %8.1f\n", aPolynomial == Crc16::kCcitt ? "ccitt" : "ansi", aName,
+           static_cast<double>(aBuffer.size()) * aIterations * 1000 / elapsedNs);
+
+    return crc;
+}
+
+int main(int argc, char *argv[])
+{
+    int                  ret        = EXIT_FAILURE;
+    unsigned long        size       = kDefaultSize;
+    unsigned long        iterations = kDefaultIterations;
+    std::vector<uint8_t> buffer;
+    int                  opt;
+
+    while ((opt = getopt_long(argc, argv, "hi:s:", kOptions, nullptr)) != -1)
+    {
+        bool valid = true;
+
+        switch (opt)
+        {
+        case OTBR_OPT_ITERATIONS:
+            valid = ParseNumber(optarg, iterations) && iterations > 0;
+            break;
+        case OTBR_OPT_SIZE:
+            valid = ParseNumber(optarg, size) && size > 0;
+            break;
+        case OTBR_OPT_HELP:
+            PrintUsage(argv[0], stdout);
+            ExitNow(ret = EXIT_SUCCESS);
+            break;
+        default:
+            valid = false;
+            break;
+        }
+
+        VerifyOrExit(valid, PrintUsage(argv[0], stderr), ret = EX_USAGE);
+    }
+
+    for (unsigned long i = 0; i < size; i++)
+    {
+        buffer.push_back(static_cast<uint8_t>(rand()));
+    }
+
+    for (Crc16::Polynomial polynomial : {Crc16::kCcitt, Crc16::kAnsi})
+    {
+        uint16_t bitwise = Run("bitwise", ComputeBitwise, polynomial, buffer, iterations);
+        uint16_t bytes   = Run("bytes", ComputeBytes, polynomial, buffer, iterations);
+        uint16_t bulk    = Run("bulk", ComputeBulk, polynomial, buffer, iterations);
+
+        VerifyOrExit(bitwise == bytes && bitwise == bulk, fprintf(stderr, "Results differ\n"));
+    }
+
+    ret = EXIT_SUCCESS;
+
+exit:
+    return ret;
+}
@@ -0,0 +1,157 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the synthetic Thread network diagnostics used by the benchmarks.
+ */
+
+#include "diag_set.hpp"
+
+#include <string.h>
+
+namespace otbr {
+namespace Benchmark {
+
+// Sizes of the tables in the diagnostics of each synthetic node.
+static const uint8_t kRouteCount     = 16;
+static const uint8_t kChildCount     = 10;
+static const uint8_t kAddressCount   = 4;
+static const uint8_t kNetworkDataLen = 64;
+
+static std::vector<otNetworkDiagTlv> MakeNodeDiag(uint16_t aIndex)
+{
+    std::vector<otNetworkDiagTlv> diag;
+    otNetworkDiagTlv              tlv;
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType = OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS;
+    for (uint8_t i = 0; i < OT_EXT_ADDRESS_SIZE; i++)
+    {
+        tlv.mData.mExtAddress.m8[i] = static_cast<uint8_t>(aIndex * 31 + i);
+    }
+    diag.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType         = OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS;
+    tlv.mData.mAddr16 = static_cast<uint16_t>(aIndex << 10);
+    diag.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                     = OT_NETWORK_DIAGNOSTIC_TLV_MODE;
+    tlv.mData.mMode.mRxOnWhenIdle = true;
+    tlv.mData.mMode.mDeviceType   = true;
+    tlv.mData.mMode.mNetworkData  = true;
+    diag.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                                = OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY;
+    tlv.mData.mConnectivity.mParentPriority  = -1;
+    tlv.mData.mConnectivity.mLinkQuality3    = 4;
+    tlv.mData.mConnectivity.mActiveRouters   = kRouteCount;
+    tlv.mData.mConnectivity.mSedBufferSize   = 1280;
+    tlv.mData.mConnectivity.mSedDatagramCount = 1;
+    diag.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                    = OT_NETWORK_DIAGNOSTIC_TLV_ROUTE;
+    tlv.mData.mRoute.mIdSequence = 42;
+    tlv.mData.mRoute.mRouteCount = kRouteCount;
+    for (uint8_t i = 0; i < kRouteCount; i++)
+    {
+        tlv.mData.mRoute.mRouteData[i].mRouterId       = i;
+        tlv.mData.mRoute.mRouteData[i].mLinkQualityOut = 3;
+        tlv.mData.mRoute.mRouteData[i].mLinkQualityIn  = 3;
+        tlv.mData.mRoute.mRouteData[i].mRouteCost      = 1;
+    }
+    diag.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                          = OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA;
+    tlv.mData.mLeaderData.mPartitionId = 0x12345678;
+    tlv.mData.mLeaderData.mWeighting   = 64;
+    diag.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                      = OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA;
+    tlv.mData.mNetworkData.mCount = kNetworkDataLen;
+    for (uint8_t i = 0; i < kNetworkDataLen; i++)
+    {
+        tlv.mData.mNetworkData.m8[i] = i;
+    }
+    diag.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                     = OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST;
+    tlv.mData.mIp6AddrList.mCount = kAddressCount;
+    for (uint8_t i = 0; i < kAddressCount; i++)
+    {
+        tlv.mData.mIp6AddrList.mList[i].mFields.m8[0]  = 0xfd;
+        tlv.mData.mIp6AddrList.mList[i].mFields.m8[14] = static_cast<uint8_t>(aIndex);
+        tlv.mData.mIp6AddrList.mList[i].mFields.m8[15] = i;
+    }
+    diag.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                             = OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS;
+    tlv.mData.mMacCounters.mIfInUcastPkts = 100000u + aIndex;
+    tlv.mData.mMacCounters.mIfOutUcastPkts = 200000u + aIndex;
+    diag.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                    = OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE;
+    tlv.mData.mChildTable.mCount = kChildCount;
+    for (uint8_t i = 0; i < kChildCount; i++)
+    {
+        tlv.mData.mChildTable.mTable[i].mChildId = i + 1;
+        tlv.mData.mChildTable.mTable[i].mTimeout = 10;
+    }
+    diag.push_back(tlv);
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                       = OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES;
+    tlv.mData.mChannelPages.mCount = 1;
+    diag.push_back(tlv);
+
+    return diag;
+}
+
+std::vector<std::vector<otNetworkDiagTlv>> MakeDiagSet(size_t aNodes)
+{
+    std::vector<std::vector<otNetworkDiagTlv>> diagSet;
+
+    for (size_t i = 0; i < aNodes; i++)
+    {
+        diagSet.push_back(MakeNodeDiag(static_cast<uint16_t>(i)));
+    }
+
+    return diagSet;
+}
+
+} // namespace Benchmark
+} // namespace otbr
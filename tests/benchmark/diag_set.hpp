@@ -0,0 +1,64 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file includes definitions for the synthetic Thread network diagnostics used by the benchmarks.
+ */
+
+#ifndef OTBR_TESTS_BENCHMARK_DIAG_SET_HPP_
+#define OTBR_TESTS_BENCHMARK_DIAG_SET_HPP_
+
+#include <openthread-br/config.h>
+
+#include <vector>
+
+#include <stddef.h>
+
+#include <openthread/netdiag.h>
+
+namespace otbr {
+namespace Benchmark {
+
+/**
+ * This function makes the diagnostics of a synthetic mesh.
+ *
+ * Each node reports its addresses, mode, connectivity, a 16-entry route table, leader data, 64 bytes of network data,
+ * 4 IPv6 addresses, MAC counters and a 10-entry child table.
+ *
+ * @param[in]   aNodes  The number of nodes.
+ *
+ * @returns The diagnostics of each node.
+ *
+ */
+std::vector<std::vector<otNetworkDiagTlv>> MakeDiagSet(size_t aNodes);
+
+} // namespace Benchmark
+} // namespace otbr
+
+#endif // OTBR_TESTS_BENCHMARK_DIAG_SET_HPP_
@@ -0,0 +1,246 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a microbenchmark of the hex conversions.
+ *
+ *   It encodes a buffer with `sprintf`, the way `Bytes2Hex` did before, and with `EncodeHex`, and decodes it back one
+ *   digit at a time and with `DecodeHex`. The throughput of each is reported and the results are checked to be the
+ *   same.
+ */
+
+#include <openthread-br/config.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+
+#include "common/code_utils.hpp"
+#include "utils/hex.hpp"
+
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+enum
+{
+    OTBR_OPT_HELP       = 'h',
+    OTBR_OPT_ITERATIONS = 'i',
+    OTBR_OPT_SIZE       = 's',
+};
+
+static const struct option kOptions[] = {{"help", no_argument, nullptr, OTBR_OPT_HELP},
+                                         {"iterations", required_argument, nullptr, OTBR_OPT_ITERATIONS},
+                                         {"size", required_argument, nullptr, OTBR_OPT_SIZE},
+                                         {0, 0, 0, 0}};
+
+static const unsigned long kDefaultIterations = 1000;
+static const unsigned long kDefaultSize       = 4096;
+
+static void PrintUsage(const char *aProgramName, FILE *aStream)
+{
+    fprintf(aStream,
+            "Syntax:\n"
+            "    %s [-s size] [-i iterations]\n"
+            "Defaults: %lu bytes, %lu iterations.\n",
+            aProgramName, kDefaultSize, kDefaultIterations);
+}
+
+static bool ParseNumber(const char *aString, unsigned long &aNumber)
+{
+    char *end;
+
+    aNumber = strtoul(aString, &end, 0);
+
+    return *aString != '\0' && *end == '\0';
+}
+
+static void EncodeSprintf(const std::vector<uint8_t> &aBytes, std::string &aHex)
+{
+    char byteHex[3];
+
+    aHex.clear();
+
+    for (uint8_t byte : aBytes)
+    {
+        sprintf(byteHex, "%02X", byte);
+        aHex += byteHex;
+    }
+}
+
+static void EncodeVector(const std::vector<uint8_t> &aBytes, std::string &aHex)
+{
+    aHex.clear();
+    otbr::Utils::AppendHex(aBytes.data(), aBytes.size(), aHex);
+}
+
+static bool DecodeDigits(const std::string &aHex, std::vector<uint8_t> &aBytes)
+{
+    bool ret = false;
+
+    aBytes.clear();
+
+    for (size_t i = 0; i + 1 < aHex.size(); i += 2)
+    {
+        uint8_t byte = 0;
+
+        for (size_t j = i; j < i + 2; j++)
+        {
+            char c = aHex[j];
+
+            byte <<= 4;
+
+            if ('0' <= c && c <= '9')
+            {
+                byte |= c - '0';
+            }
+            else if ('A' <= c && c <= 'F')
+            {
+                byte |= 10 + (c - 'A');
+            }
+            else if ('a' <= c && c <= 'f')
+            {
+                byte |= 10 + (c - 'a');
+            }
+            else
+            {
+                ExitNow();
+            }
+        }
+
+        aBytes.push_back(byte);
+    }
+
+    ret = true;
+
+exit:
+    return ret;
+}
+
+static bool DecodeVector(const std::string &aHex, std::vector<uint8_t> &aBytes)
+{
+    aBytes.resize(aHex.size() / 2);
+
+    return otbr::Utils::DecodeHex(aHex.data(), aHex.size(), aBytes.data(), aBytes.size()) ==
+           static_cast<int>(aBytes.size());
+}
+
+static void Report(const char *aName, size_t aSize, unsigned long aIterations, steady_clock::time_point aStart)
+{
+    uint64_t elapsedNs = static_cast<uint64_t>(duration_cast<nanoseconds>(steady_clock::now() - aStart).count());
+
+    printf("%-14s throughput (MB/s): %8.1f\n", aName, static_cast<double>(aSize) * aIterations * 1000 / elapsedNs);
+}
+
+int main(int argc, char *argv[])
+{
+    int                      ret        = EXIT_FAILURE;
+    unsigned long            size       = kDefaultSize;
+    unsigned long            iterations = kDefaultIterations;
+    std::vector<uint8_t>     bytes;
+    std::vector<uint8_t>     decoded;
+    std::string              expected;
+    std::string              hex;
+    steady_clock::time_point start;
+    int                      opt;
+
+    while ((opt = getopt_long(argc, argv, "hi:s:", kOptions, nullptr)) != -1)
+    {
+        bool valid = true;
+
+        switch (opt)
+        {
+        case OTBR_OPT_ITERATIONS:
+            valid = ParseNumber(optarg, iterations) && iterations > 0;
+            break;
+        case OTBR_OPT_SIZE:
+            valid = ParseNumber(optarg, size) && size > 0;
+            break;
+        case OTBR_OPT_HELP:
+            PrintUsage(argv[0], stdout);
+            ExitNow(ret = EXIT_SUCCESS);
+            break;
+        default:
+            valid = false;
+            break;
+        }
+
+        VerifyOrExit(valid, PrintUsage(argv[0], stderr), ret = EX_USAGE);
+    }
+
+    for (unsigned long i = 0; i < size; i++)
+    {
+        bytes.push_back(static_cast<uint8_t>(rand()));
+    }
+
+    start = steady_clock::now();
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+        EncodeSprintf(bytes, expected);
+    }
+    Report("encode sprintf", size, iterations, start);
+
+    start = steady_clock::now();
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+        EncodeVector(bytes, hex);
+    }
+    Report("encode vector", size, iterations, start);
+
+    VerifyOrExit(hex == expected, fprintf(stderr, "Encoded results differ\n"));
+
+    start = steady_clock::now();
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+        VerifyOrExit(DecodeDigits(hex, decoded), fprintf(stderr, "Failed to decode\n"));
+    }
+    Report("decode digits", size, iterations, start);
+
+    VerifyOrExit(decoded == bytes, fprintf(stderr, "Decoded results differ\n"));
+
+    start = steady_clock::now();
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+        VerifyOrExit(DecodeVector(hex, decoded), fprintf(stderr, "Failed to decode\n"));
+    }
+    Report("decode vector", size, iterations, start);
+
+    VerifyOrExit(decoded == bytes, fprintf(stderr, "Decoded results differ\n"));
+
+    ret = EXIT_SUCCESS;
+
+exit:
+    return ret;
+}
@@ -0,0 +1,409 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a microbenchmark of the REST JSON serialization.
+ *
+ *   It serializes the diagnostics of a synthetic mesh both with `Json::Diag2JsonString`, which streams into a
+ *   string with `Utils::JsonWriter`, and with a cJSON document tree, the way `rest::Json` did before. Both the time
+ *   and the number of heap allocations per serialization are reported, and the outputs are checked to be the same.
+ */
+
+#include <openthread-br/config.h>
+
+#include <chrono>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+
+extern "C" {
+#include <cJSON.h>
+}
+
+#include "diag_set.hpp"
+
+#include "common/code_utils.hpp"
+#include "common/types.hpp"
+#include "rest/json.hpp"
+#include "utils/hex.hpp"
+
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+enum
+{
+    OTBR_OPT_HELP       = 'h',
+    OTBR_OPT_ITERATIONS = 'i',
+    OTBR_OPT_NODES      = 'n',
+};
+
+static const struct option kOptions[] = {{"help", no_argument, nullptr, OTBR_OPT_HELP},
+                                         {"iterations", required_argument, nullptr, OTBR_OPT_ITERATIONS},
+                                         {"nodes", required_argument, nullptr, OTBR_OPT_NODES},
+                                         {0, 0, 0, 0}};
+
+static const unsigned long kDefaultIterations = 100;
+static const unsigned long kDefaultNodes      = 200;
+
+static size_t sAllocations = 0;
+
+void *operator new(size_t aSize)
+{
+    void *ptr = malloc(aSize);
+
+    if (ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+
+    ++sAllocations;
+
+    return ptr;
+}
+
+void operator delete(void *aPtr) noexcept
+{
+    free(aPtr);
+}
+
+void operator delete(void *aPtr, size_t) noexcept
+{
+    free(aPtr);
+}
+
+static void *CountingMalloc(size_t aSize)
+{
+    ++sAllocations;
+
+    return malloc(aSize);
+}
+
+static cJSON *Bytes2HexJson(const uint8_t *aBytes, uint8_t aLength)
+{
+    char hex[2 * aLength + 1];
+
+    otbr::Utils::Bytes2Hex(aBytes, aLength, hex);
+    hex[2 * aLength] = '\0';
+
+    return cJSON_CreateString(hex);
+}
+
+static cJSON *Mode2Json(const otLinkModeConfig &aMode)
+{
+    cJSON *mode = cJSON_CreateObject();
+
+    cJSON_AddItemToObject(mode, "RxOnWhenIdle", cJSON_CreateNumber(aMode.mRxOnWhenIdle));
+    cJSON_AddItemToObject(mode, "DeviceType", cJSON_CreateNumber(aMode.mDeviceType));
+    cJSON_AddItemToObject(mode, "NetworkData", cJSON_CreateNumber(aMode.mNetworkData));
+
+    return mode;
+}
+
+static cJSON *IpAddr2Json(const otIp6Address &aAddress)
+{
+    otbr::Ip6Address addr(aAddress.mFields.m8);
+
+    return cJSON_CreateString(addr.ToString().c_str());
+}
+
+static cJSON *ChildTableEntry2Json(const otNetworkDiagChildEntry &aChildEntry)
+{
+    cJSON *childEntry = cJSON_CreateObject();
+
+    cJSON_AddItemToObject(childEntry, "ChildId", cJSON_CreateNumber(aChildEntry.mChildId));
+    cJSON_AddItemToObject(childEntry, "Timeout", cJSON_CreateNumber(aChildEntry.mTimeout));
+    cJSON_AddItemToObject(childEntry, "Mode", Mode2Json(aChildEntry.mMode));
+
+    return childEntry;
+}
+
+static cJSON *MacCounters2Json(const otNetworkDiagMacCounters &aMacCounters)
+{
+    cJSON *macCounters = cJSON_CreateObject();
+
+    cJSON_AddItemToObject(macCounters, "IfInUnknownProtos", cJSON_CreateNumber(aMacCounters.mIfInUnknownProtos));
+    cJSON_AddItemToObject(macCounters, "IfInErrors", cJSON_CreateNumber(aMacCounters.mIfInErrors));
+    cJSON_AddItemToObject(macCounters, "IfOutErrors", cJSON_CreateNumber(aMacCounters.mIfOutErrors));
+    cJSON_AddItemToObject(macCounters, "IfInUcastPkts", cJSON_CreateNumber(aMacCounters.mIfInUcastPkts));
+    cJSON_AddItemToObject(macCounters, "IfInBroadcastPkts", cJSON_CreateNumber(aMacCounters.mIfInBroadcastPkts));
+    cJSON_AddItemToObject(macCounters, "IfInDiscards", cJSON_CreateNumber(aMacCounters.mIfInDiscards));
+    cJSON_AddItemToObject(macCounters, "IfOutUcastPkts", cJSON_CreateNumber(aMacCounters.mIfOutUcastPkts));
+    cJSON_AddItemToObject(macCounters, "IfOutBroadcastPkts", cJSON_CreateNumber(aMacCounters.mIfOutBroadcastPkts));
+    cJSON_AddItemToObject(macCounters, "IfOutDiscards", cJSON_CreateNumber(aMacCounters.mIfOutDiscards));
+
+    return macCounters;
+}
+
+static cJSON *Connectivity2Json(const otNetworkDiagConnectivity &aConnectivity)
+{
+    cJSON *connectivity = cJSON_CreateObject();
+
+    cJSON_AddItemToObject(connectivity, "ParentPriority", cJSON_CreateNumber(aConnectivity.mParentPriority));
+    cJSON_AddItemToObject(connectivity, "LinkQuality3", cJSON_CreateNumber(aConnectivity.mLinkQuality3));
+    cJSON_AddItemToObject(connectivity, "LinkQuality2", cJSON_CreateNumber(aConnectivity.mLinkQuality2));
+    cJSON_AddItemToObject(connectivity, "LinkQuality1", cJSON_CreateNumber(aConnectivity.mLinkQuality1));
+    cJSON_AddItemToObject(connectivity, "LeaderCost", cJSON_CreateNumber(aConnectivity.mLeaderCost));
+    cJSON_AddItemToObject(connectivity, "IdSequence", cJSON_CreateNumber(aConnectivity.mIdSequence));
+    cJSON_AddItemToObject(connectivity, "ActiveRouters", cJSON_CreateNumber(aConnectivity.mActiveRouters));
+    cJSON_AddItemToObject(connectivity, "SedBufferSize", cJSON_CreateNumber(aConnectivity.mSedBufferSize));
+    cJSON_AddItemToObject(connectivity, "SedDatagramCount", cJSON_CreateNumber(aConnectivity.mSedDatagramCount));
+
+    return connectivity;
+}
+
+static cJSON *Route2Json(const otNetworkDiagRoute &aRoute)
+{
+    cJSON *route     = cJSON_CreateObject();
+    cJSON *routeData = cJSON_CreateArray();
+
+    for (uint16_t i = 0; i < aRoute.mRouteCount; ++i)
+    {
+        cJSON *entry = cJSON_CreateObject();
+
+        cJSON_AddItemToObject(entry, "RouteId", cJSON_CreateNumber(aRoute.mRouteData[i].mRouterId));
+        cJSON_AddItemToObject(entry, "LinkQualityOut", cJSON_CreateNumber(aRoute.mRouteData[i].mLinkQualityOut));
+        cJSON_AddItemToObject(entry, "LinkQualityIn", cJSON_CreateNumber(aRoute.mRouteData[i].mLinkQualityIn));
+        cJSON_AddItemToObject(entry, "RouteCost", cJSON_CreateNumber(aRoute.mRouteData[i].mRouteCost));
+        cJSON_AddItemToArray(routeData, entry);
+    }
+
+    cJSON_AddItemToObject(route, "IdSequence", cJSON_CreateNumber(aRoute.mIdSequence));
+    cJSON_AddItemToObject(route, "RouteData", routeData);
+
+    return route;
+}
+
+static cJSON *LeaderData2Json(const otLeaderData &aLeaderData)
+{
+    cJSON *leaderData = cJSON_CreateObject();
+
+    cJSON_AddItemToObject(leaderData, "PartitionId", cJSON_CreateNumber(aLeaderData.mPartitionId));
+    cJSON_AddItemToObject(leaderData, "Weighting", cJSON_CreateNumber(aLeaderData.mWeighting));
+    cJSON_AddItemToObject(leaderData, "DataVersion", cJSON_CreateNumber(aLeaderData.mDataVersion));
+    cJSON_AddItemToObject(leaderData, "StableDataVersion", cJSON_CreateNumber(aLeaderData.mStableDataVersion));
+    cJSON_AddItemToObject(leaderData, "LeaderRouterId", cJSON_CreateNumber(aLeaderData.mLeaderRouterId));
+
+    return leaderData;
+}
+
+/**
+ * This function builds the cJSON document of diagnostics, like `rest::Json` did before `Utils::JsonWriter`.
+ *
+ */
+static cJSON *Diag2Json(const std::vector<std::vector<otNetworkDiagTlv>> &aDiagSet)
+{
+    cJSON *diagInfo = cJSON_CreateArray();
+
+    for (const auto &diagItem : aDiagSet)
+    {
+        cJSON *node = cJSON_CreateObject();
+
+        for (const auto &diagTlv : diagItem)
+        {
+            cJSON *list;
+
+            switch (diagTlv.mType)
+            {
+            case OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS:
+                cJSON_AddItemToObject(node, "ExtAddress",
+                                      Bytes2HexJson(diagTlv.mData.mExtAddress.m8, OT_EXT_ADDRESS_SIZE));
+                break;
+            case OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS:
+                cJSON_AddItemToObject(node, "Rloc16", cJSON_CreateNumber(diagTlv.mData.mAddr16));
+                break;
+            case OT_NETWORK_DIAGNOSTIC_TLV_MODE:
+                cJSON_AddItemToObject(node, "Mode", Mode2Json(diagTlv.mData.mMode));
+                break;
+            case OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT:
+                cJSON_AddItemToObject(node, "Timeout", cJSON_CreateNumber(diagTlv.mData.mTimeout));
+                break;
+            case OT_NETWORK_DIAGNOSTIC_TLV_CONNECTIVITY:
+                cJSON_AddItemToObject(node, "Connectivity", Connectivity2Json(diagTlv.mData.mConnectivity));
+                break;
+            case OT_NETWORK_DIAGNOSTIC_TLV_ROUTE:
+                cJSON_AddItemToObject(node, "Route", Route2Json(diagTlv.mData.mRoute));
+                break;
+            case OT_NETWORK_DIAGNOSTIC_TLV_LEADER_DATA:
+                cJSON_AddItemToObject(node, "LeaderData", LeaderData2Json(diagTlv.mData.mLeaderData));
+                break;
+            case OT_NETWORK_DIAGNOSTIC_TLV_NETWORK_DATA:
+                cJSON_AddItemToObject(node, "NetworkData",
+                                      Bytes2HexJson(diagTlv.mData.mNetworkData.m8, diagTlv.mData.mNetworkData.mCount));
+                break;
+            case OT_NETWORK_DIAGNOSTIC_TLV_IP6_ADDR_LIST:
+                list = cJSON_CreateArray();
+                for (uint16_t i = 0; i < diagTlv.mData.mIp6AddrList.mCount; ++i)
+                {
+                    cJSON_AddItemToArray(list, IpAddr2Json(diagTlv.mData.mIp6AddrList.mList[i]));
+                }
+                cJSON_AddItemToObject(node, "IP6AddressList", list);
+                break;
+            case OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS:
+                cJSON_AddItemToObject(node, "MACCounters", MacCounters2Json(diagTlv.mData.mMacCounters));
+                break;
+            case OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE:
+                list = cJSON_CreateArray();
+                for (uint16_t i = 0; i < diagTlv.mData.mChildTable.mCount; ++i)
+                {
+                    cJSON_AddItemToArray(list, ChildTableEntry2Json(diagTlv.mData.mChildTable.mTable[i]));
+                }
+                cJSON_AddItemToObject(node, "ChildTable", list);
+                break;
+            case OT_NETWORK_DIAGNOSTIC_TLV_CHANNEL_PAGES:
+                cJSON_AddItemToObject(
+                    node, "ChannelPages",
+                    Bytes2HexJson(diagTlv.mData.mChannelPages.m8, diagTlv.mData.mChannelPages.mCount));
+                break;
+            case OT_NETWORK_DIAGNOSTIC_TLV_MAX_CHILD_TIMEOUT:
+                cJSON_AddItemToObject(node, "MaxChildTimeout", cJSON_CreateNumber(diagTlv.mData.mMaxChildTimeout));
+                break;
+            default:
+                break;
+            }
+        }
+
+        cJSON_AddItemToArray(diagInfo, node);
+    }
+
+    return diagInfo;
+}
+
+static void PrintUsage(const char *aProgramName, FILE *aStream)
+{
+    fprintf(aStream,
+            "Syntax:\n"
+            "    %s [-n nodes] [-i iterations]\n"
+            "Defaults: %lu nodes, %lu iterations.\n",
+            aProgramName, kDefaultNodes, kDefaultIterations);
+}
+
+static bool ParseNumber(const char *aString, unsigned long &aNumber)
+{
+    char *end;
+
+    aNumber = strtoul(aString, &end, 0);
+
+    return *aString != '\0' && *end == '\0';
+}
+
+static void Report(const char *aName, uint64_t aNs, size_t aAllocations, size_t aSize, unsigned long aIterations)
+{
+    printf("%-8s time/op (us): %10.1f, allocations/op: %8.1f, output (bytes): %zu\n", aName,
+           aNs / 1000.0 / aIterations, static_cast<double>(aAllocations) / aIterations, aSize);
+}
+
+int main(int argc, char *argv[])
+{
+    int                                        ret        = EXIT_FAILURE;
+    unsigned long                              nodes      = kDefaultNodes;
+    unsigned long                              iterations = kDefaultIterations;
+    std::vector<std::vector<otNetworkDiagTlv>> diagSet;
+    cJSON_Hooks                                hooks      = {CountingMalloc, free};
+    std::string                                writerOut;
+    std::string                                cjsonOut;
+    size_t                                     allocations;
+    steady_clock::time_point                   start;
+    uint64_t                                   elapsedNs;
+    int                                        opt;
+
+    while ((opt = getopt_long(argc, argv, "hi:n:", kOptions, nullptr)) != -1)
+    {
+        bool valid = true;
+
+        switch (opt)
+        {
+        case OTBR_OPT_ITERATIONS:
+            valid = ParseNumber(optarg, iterations) && iterations > 0;
+            break;
+        case OTBR_OPT_NODES:
+            valid = ParseNumber(optarg, nodes) && nodes > 0 && nodes <= UINT16_MAX;
+            break;
+        case OTBR_OPT_HELP:
+            PrintUsage(argv[0], stdout);
+            ExitNow(ret = EXIT_SUCCESS);
+            break;
+        default:
+            valid = false;
+            break;
+        }
+
+        VerifyOrExit(valid, PrintUsage(argv[0], stderr), ret = EX_USAGE);
+    }
+
+    cJSON_InitHooks(&hooks);
+
+    diagSet = otbr::Benchmark::MakeDiagSet(nodes);
+
+    // Both paths must produce the same document, the writer path without white space.
+    {
+        cJSON *json = Diag2Json(diagSet);
+        char * out  = cJSON_PrintUnformatted(json);
+
+        writerOut = otbr::rest::Json::Diag2JsonString(diagSet);
+        VerifyOrExit(out != nullptr && writerOut == out,
+                     fprintf(stderr, "Outputs differ:\n%s\n%s\n", out ? out : "", writerOut.c_str()));
+        cJSON_free(out);
+        cJSON_Delete(json);
+    }
+
+    allocations = sAllocations;
+    start       = steady_clock::now();
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+        writerOut = otbr::rest::Json::Diag2JsonString(diagSet);
+    }
+    elapsedNs = static_cast<uint64_t>(duration_cast<nanoseconds>(steady_clock::now() - start).count());
+    Report("writer", elapsedNs, sAllocations - allocations, writerOut.size(), iterations);
+
+    allocations = sAllocations;
+    start       = steady_clock::now();
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+        cJSON *json = Diag2Json(diagSet);
+        char * out  = cJSON_Print(json);
+
+        cjsonOut = out;
+        cJSON_free(out);
+        cJSON_Delete(json);
+    }
+    elapsedNs = static_cast<uint64_t>(duration_cast<nanoseconds>(steady_clock::now() - start).count());
+    Report("cjson", elapsedNs, sAllocations - allocations, cjsonOut.size(), iterations);
+
+    ret = EXIT_SUCCESS;
+
+exit:
+    return ret;
+}
@@ -0,0 +1,577 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a synthetic throughput benchmark of the agent mainloop.
+ *
+ *   The benchmark drives the same `otSysMainloopContext` loop as otbr-agent with a mock NCP controller, fake REST
+ *   connections registered with the `MainloopPoller` and idle fake D-Bus watches which are added to the fd sets in
+ *   every iteration, like `DBusAgent` does. A feeder thread generates NCP and REST traffic at a fixed rate. Every
+ *   event carries the time it was sent, so the latency from wakeup to dispatch can be measured.
+ */
+
+#include <openthread-br/config.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <getopt.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sysexits.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "agent/ncp.hpp"
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/mainloop_poller.hpp"
+
+using otbr::MainloopPoller;
+
+enum
+{
+    OTBR_OPT_CONNECTIONS = 'c',
+    OTBR_OPT_DURATION    = 'd',
+    OTBR_OPT_HELP        = 'h',
+    OTBR_OPT_RATE        = 'r',
+    OTBR_OPT_WATCHES     = 'w',
+};
+
+static const struct option kOptions[] = {{"connections", required_argument, nullptr, OTBR_OPT_CONNECTIONS},
+                                         {"duration", required_argument, nullptr, OTBR_OPT_DURATION},
+                                         {"help", no_argument, nullptr, OTBR_OPT_HELP},
+                                         {"rate", required_argument, nullptr, OTBR_OPT_RATE},
+                                         {"watches", required_argument, nullptr, OTBR_OPT_WATCHES},
+                                         {0, 0, 0, 0}};
+
+// Default poll timeout, the same as otbr-agent.
+static const struct timeval kPollTimeout = {10, 0};
+
+static const unsigned long kDefaultConnections = 16;
+static const unsigned long kDefaultWatches     = 8;
+static const unsigned long kDefaultDurationSec = 5;
+static const unsigned long kDefaultRate        = 1000;
+
+static uint64_t NowNs(void)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+static uint64_t ThreadCpuNs(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+static otbrError SetNonBlocking(int aFd)
+{
+    return fcntl(aFd, F_SETFL, fcntl(aFd, F_GETFL) | O_NONBLOCK) == 0 ? OTBR_ERROR_NONE : OTBR_ERROR_ERRNO;
+}
+
+/**
+ * This class records wakeup-to-dispatch latencies.
+ *
+ */
+class LatencyStats
+{
+public:
+    void Add(uint64_t aSentNs, uint64_t aDispatchedNs)
+    {
+        mSamples.push_back(aDispatchedNs > aSentNs ? aDispatchedNs - aSentNs : 0);
+    }
+
+    size_t GetCount(void) const { return mSamples.size(); }
+
+    void Report(const char *aName);
+
+private:
+    double GetPercentileUs(unsigned aPercentile) const
+    {
+        return mSamples[(mSamples.size() - 1) * aPercentile / 100] / 1000.0;
+    }
+
+    std::vector<uint64_t> mSamples;
+};
+
+void LatencyStats::Report(const char *aName)
+{
+    uint64_t sum = 0;
+
+    VerifyOrExit(!mSamples.empty(), printf("%-4s latency: no samples\n", aName));
+
+    std::sort(mSamples.begin(), mSamples.end());
+
+    for (uint64_t sample : mSamples)
+    {
+        sum += sample;
+    }
+
+    printf("%-4s latency (us): samples %zu, min %.1f, avg %.1f, p50 %.1f, p99 %.1f, max %.1f\n", aName,
+           mSamples.size(), GetPercentileUs(0), sum / 1000.0 / mSamples.size(), GetPercentileUs(50),
+           GetPercentileUs(99), GetPercentileUs(100));
+
+exit:
+    return;
+}
+
+/**
+ * This function reads all pending timestamps from a non-blocking file descriptor and records their latency.
+ *
+ * @param[in]   aFd     The file descriptor to read from.
+ * @param[in]   aStats  The latency statistics to record to.
+ * @param[in]   aEcho   Whether to write the timestamps back as a response.
+ *
+ */
+static void DispatchTimestamps(int aFd, LatencyStats &aStats, bool aEcho)
+{
+    uint64_t timestamps[16];
+    ssize_t  rval;
+
+    while ((rval = read(aFd, timestamps, sizeof(timestamps))) > 0)
+    {
+        uint64_t now   = NowNs();
+        size_t   count = static_cast<size_t>(rval) / sizeof(timestamps[0]);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            aStats.Add(timestamps[i], now);
+        }
+
+        if (aEcho && write(aFd, timestamps, static_cast<size_t>(rval)) < 0)
+        {
+            otbrLog(OTBR_LOG_WARNING, "Failed to write response: %s", strerror(errno));
+        }
+    }
+}
+
+/**
+ * This class implements a mock NCP controller which polls a pipe through the fd sets, like the OpenThread platform.
+ *
+ */
+class MockNcp : public otbr::Ncp::Controller
+{
+public:
+    explicit MockNcp(LatencyStats &aStats)
+        : mStats(aStats)
+    {
+        mPipe[0] = mPipe[1] = -1;
+    }
+
+    ~MockNcp(void) override
+    {
+        for (int fd : mPipe)
+        {
+            if (fd >= 0)
+            {
+                close(fd);
+            }
+        }
+    }
+
+    otbrError Init(void) override
+    {
+        otbrError error = OTBR_ERROR_NONE;
+
+        VerifyOrExit(pipe(mPipe) == 0, error = OTBR_ERROR_ERRNO);
+        SuccessOrExit(error = SetNonBlocking(mPipe[0]));
+
+    exit:
+        return error;
+    }
+
+    void UpdateFdSet(otSysMainloopContext &aMainloop) override
+    {
+        FD_SET(mPipe[0], &aMainloop.mReadFdSet);
+        aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mPipe[0]);
+    }
+
+    void Process(const otSysMainloopContext &aMainloop) override
+    {
+        if (FD_ISSET(mPipe[0], &aMainloop.mReadFdSet))
+        {
+            DispatchTimestamps(mPipe[0], mStats, /* aEcho */ false);
+        }
+    }
+
+    void Reset(void) override {}
+
+    bool IsResetRequested(void) override { return false; }
+
+    otbrError RequestEvent(int aEvent) override
+    {
+        OTBR_UNUSED_VARIABLE(aEvent);
+
+        return OTBR_ERROR_NONE;
+    }
+
+    /**
+     * This method returns the file descriptor the feeder writes NCP events to.
+     *
+     */
+    int GetFeedFd(void) const { return mPipe[1]; }
+
+private:
+    LatencyStats &mStats;
+    int           mPipe[2];
+};
+
+/**
+ * This class implements fake REST connections which are registered with the `MainloopPoller`.
+ *
+ * The server side reads requests only from the ready file descriptors and echoes them back as responses.
+ *
+ */
+class FakeRestConnections
+{
+public:
+    explicit FakeRestConnections(LatencyStats &aStats)
+        : mStats(aStats)
+        , mNextClient(0)
+    {
+    }
+
+    ~FakeRestConnections(void)
+    {
+        for (const Connection &connection : mConnections)
+        {
+            MainloopPoller::Get().Unregister(connection.mServerFd);
+            close(connection.mServerFd);
+            close(connection.mClientFd);
+        }
+    }
+
+    otbrError Init(unsigned long aCount)
+    {
+        otbrError error = OTBR_ERROR_NONE;
+
+        for (unsigned long i = 0; i < aCount; ++i)
+        {
+            int fds[2];
+
+            VerifyOrExit(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0, error = OTBR_ERROR_ERRNO);
+            mConnections.push_back({fds[0], fds[1]});
+            SuccessOrExit(error = SetNonBlocking(fds[0]));
+            SuccessOrExit(error = SetNonBlocking(fds[1]));
+            SuccessOrExit(error = MainloopPoller::Get().Register(fds[0], MainloopPoller::kEventRead));
+        }
+
+    exit:
+        return error;
+    }
+
+    void Process(void)
+    {
+        for (int fd : MainloopPoller::Get().GetReadyFds())
+        {
+            if (MainloopPoller::Get().IsReadable(fd))
+            {
+                DispatchTimestamps(fd, mStats, /* aEcho */ true);
+            }
+        }
+    }
+
+    /**
+     * This method sends a request on the next connection in turn and drains its responses.
+     *
+     * This method is called from the feeder thread.
+     *
+     */
+    void Feed(uint64_t aTimestamp)
+    {
+        uint64_t responses[16];
+        int      fd;
+
+        VerifyOrExit(!mConnections.empty());
+
+        fd          = mConnections[mNextClient].mClientFd;
+        mNextClient = (mNextClient + 1) % mConnections.size();
+
+        while (read(fd, responses, sizeof(responses)) > 0)
+        {
+        }
+
+        if (write(fd, &aTimestamp, sizeof(aTimestamp)) < 0)
+        {
+            otbrLog(OTBR_LOG_WARNING, "Failed to write request: %s", strerror(errno));
+        }
+
+    exit:
+        return;
+    }
+
+private:
+    struct Connection
+    {
+        int mServerFd;
+        int mClientFd;
+    };
+
+    LatencyStats &          mStats;
+    std::vector<Connection> mConnections;
+    size_t                  mNextClient;
+};
+
+/**
+ * This class implements idle fake D-Bus watches, which are merged into the fd sets in every iteration.
+ *
+ */
+class FakeDBusWatches
+{
+public:
+    ~FakeDBusWatches(void)
+    {
+        for (int fd : mFds)
+        {
+            close(fd);
+        }
+    }
+
+    otbrError Init(unsigned long aCount)
+    {
+        otbrError error = OTBR_ERROR_NONE;
+
+        for (unsigned long i = 0; i < aCount; ++i)
+        {
+            int fds[2];
+
+            VerifyOrExit(pipe(fds) == 0, error = OTBR_ERROR_ERRNO);
+            mFds.push_back(fds[0]);
+            mFds.push_back(fds[1]);
+            VerifyOrExit(fds[0] < FD_SETSIZE, error = OTBR_ERROR_INVALID_ARGS);
+        }
+
+    exit:
+        return error;
+    }
+
+    void UpdateFdSet(otSysMainloopContext &aMainloop)
+    {
+        // Only the read ends are watched, the write ends stay idle.
+        for (size_t i = 0; i < mFds.size(); i += 2)
+        {
+            FD_SET(mFds[i], &aMainloop.mReadFdSet);
+            FD_SET(mFds[i], &aMainloop.mErrorFdSet);
+            aMainloop.mMaxFd = std::max(aMainloop.mMaxFd, mFds[i]);
+        }
+    }
+
+    size_t Process(const otSysMainloopContext &aMainloop)
+    {
+        size_t count = 0;
+
+        for (size_t i = 0; i < mFds.size(); i += 2)
+        {
+            if (FD_ISSET(mFds[i], &aMainloop.mReadFdSet) || FD_ISSET(mFds[i], &aMainloop.mErrorFdSet))
+            {
+                ++count;
+            }
+        }
+
+        return count;
+    }
+
+private:
+    std::vector<int> mFds;
+};
+
+static void PrintUsage(const char *aProgramName, FILE *aStream)
+{
+    fprintf(aStream,
+            "Syntax:\n"
+            "    %s [-c connections] [-w watches] [-d seconds] [-r events-per-second]\n"
+            "Defaults: %lu connections, %lu watches, %lu seconds, %lu events per second.\n"
+            "Configure with -DOTBR_EPOLL=OFF to measure the select() backend.\n",
+            aProgramName, kDefaultConnections, kDefaultWatches, kDefaultDurationSec, kDefaultRate);
+}
+
+static bool ParseNumber(const char *aString, unsigned long &aNumber)
+{
+    char *end;
+
+    aNumber = strtoul(aString, &end, 0);
+
+    return *aString != '\0' && *end == '\0';
+}
+
+int main(int argc, char *argv[])
+{
+    int                 ret         = EXIT_FAILURE;
+    unsigned long       connections = kDefaultConnections;
+    unsigned long       watches     = kDefaultWatches;
+    unsigned long       durationSec = kDefaultDurationSec;
+    unsigned long       rate        = kDefaultRate;
+    LatencyStats        ncpStats;
+    LatencyStats        restStats;
+    MockNcp             ncp(ncpStats);
+    FakeRestConnections rest(restStats);
+    FakeDBusWatches     dbus;
+    std::atomic<bool>   running(true);
+    std::thread         feeder;
+    uint64_t            iterations = 0;
+    uint64_t            startNs;
+    uint64_t            endNs;
+    uint64_t            startCpuNs;
+    uint64_t            elapsedNs;
+    uint64_t            cpuNs;
+    int                 opt;
+
+    while ((opt = getopt_long(argc, argv, "c:d:hr:w:", kOptions, nullptr)) != -1)
+    {
+        bool valid = true;
+
+        switch (opt)
+        {
+        case OTBR_OPT_CONNECTIONS:
+            valid = ParseNumber(optarg, connections);
+            break;
+        case OTBR_OPT_DURATION:
+            valid = ParseNumber(optarg, durationSec) && durationSec > 0;
+            break;
+        case OTBR_OPT_RATE:
+            valid = ParseNumber(optarg, rate) && rate > 0;
+            break;
+        case OTBR_OPT_WATCHES:
+            valid = ParseNumber(optarg, watches);
+            break;
+        case OTBR_OPT_HELP:
+            PrintUsage(argv[0], stdout);
+            ExitNow(ret = EXIT_SUCCESS);
+            break;
+        default:
+            valid = false;
+            break;
+        }
+
+        VerifyOrExit(valid, PrintUsage(argv[0], stderr), ret = EX_USAGE);
+    }
+
+    otbrLogInit("otbr-bench-mainloop", OTBR_LOG_WARNING, true);
+
+    VerifyOrExit(ncp.Init() == OTBR_ERROR_NONE, fprintf(stderr, "Failed to create NCP pipe: %s\n", strerror(errno)));
+    VerifyOrExit(rest.Init(connections) == OTBR_ERROR_NONE,
+                 fprintf(stderr, "Failed to create %lu connections: %s\n", connections, strerror(errno)));
+    VerifyOrExit(dbus.Init(watches) == OTBR_ERROR_NONE,
+                 fprintf(stderr, "Failed to create %lu watches: %s\n", watches, strerror(errno)));
+
+    feeder = std::thread([&ncp, &rest, &running, rate]() {
+        const std::chrono::nanoseconds        interval(1000000000ull / rate);
+        std::chrono::steady_clock::time_point next = std::chrono::steady_clock::now();
+
+        while (running)
+        {
+            uint64_t now = NowNs();
+
+            if (write(ncp.GetFeedFd(), &now, sizeof(now)) < 0)
+            {
+                otbrLog(OTBR_LOG_WARNING, "Failed to write NCP event: %s", strerror(errno));
+            }
+
+            rest.Feed(now);
+
+            next += interval;
+            std::this_thread::sleep_until(next);
+        }
+    });
+
+    startNs    = NowNs();
+    endNs      = startNs + durationSec * 1000000000ull;
+    startCpuNs = ThreadCpuNs();
+
+    for (uint64_t now = startNs; now < endNs; now = NowNs())
+    {
+        otSysMainloopContext mainloop;
+        uint64_t             remainingUs = (endNs - now + 999) / 1000;
+        int                  rval;
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = kPollTimeout;
+
+        if (remainingUs < static_cast<uint64_t>(kPollTimeout.tv_sec) * 1000000)
+        {
+            mainloop.mTimeout.tv_sec  = static_cast<time_t>(remainingUs / 1000000);
+            mainloop.mTimeout.tv_usec = static_cast<suseconds_t>(remainingUs % 1000000);
+        }
+
+        ncp.UpdateFdSet(mainloop);
+        dbus.UpdateFdSet(mainloop);
+
+        rval = MainloopPoller::Get().Poll(mainloop);
+
+        if (rval >= 0)
+        {
+            rest.Process();
+            ncp.Process(mainloop);
+            dbus.Process(mainloop);
+        }
+        else if (errno != EINTR)
+        {
+            fprintf(stderr, "Mainloop poll failed: %s\n", strerror(errno));
+            break;
+        }
+
+        ++iterations;
+    }
+
+    cpuNs     = ThreadCpuNs() - startCpuNs;
+    elapsedNs = NowNs() - startNs;
+
+    running = false;
+    feeder.join();
+
+    printf("backend: %s, connections: %lu, watches: %lu, rate: %lu/s, duration: %lus\n",
+           MainloopPoller::Get().IsEpollEnabled() ? "epoll" : "select", connections, watches, rate, durationSec);
+    printf("iterations: %" PRIu64 ", iterations/sec: %.1f, events/iteration: %.2f, cpu/iteration (us): %.2f\n",
+           iterations, iterations * 1e9 / elapsedNs,
+           iterations ? static_cast<double>(ncpStats.GetCount() + restStats.GetCount()) / iterations : 0.0,
+           iterations ? cpuNs / 1000.0 / iterations : 0.0);
+    ncpStats.Report("ncp");
+    restStats.Report("rest");
+
+    ret = EXIT_SUCCESS;
+
+exit:
+    otbrLogDeinit();
+    return ret;
+}
@@ -0,0 +1,773 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a packet benchmark of the backbone router ND proxy.
+ *
+ *   The benchmark runs next to an otbr-agent acting as the primary backbone router, on the other end of a veth pair
+ *   whose agent end is the backbone interface. It sends multicast and unicast Neighbor Solicitations for DUAs at a
+ *   fixed rate as raw Ethernet frames, either generated for N DUAs of a prefix or replayed from a pcap file, and
+ *   matches the Neighbor Advertisements it receives with the solicitations. It reports the packet rates, the NA
+ *   response latency and, given the agent pid, the CPU time used by the agent. It needs CAP_NET_RAW.
+ */
+
+#include <openthread-br/config.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <getopt.h>
+#include <ifaddrs.h>
+#include <inttypes.h>
+#include <net/ethernet.h>
+#include <net/if.h>
+#include <netinet/icmp6.h>
+#include <netinet/ip6.h>
+#include <netpacket/packet.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <sysexits.h>
+#include <unistd.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/types.hpp"
+
+using otbr::Ip6Address;
+using otbr::Ip6Prefix;
+
+enum
+{
+    OTBR_OPT_AGENT_MAC = 'm',
+    OTBR_OPT_AGENT_PID = 'p',
+    OTBR_OPT_COUNT     = 'n',
+    OTBR_OPT_DURATION  = 'd',
+    OTBR_OPT_HELP      = 'h',
+    OTBR_OPT_INTERFACE = 'i',
+    OTBR_OPT_PCAP      = 'f',
+    OTBR_OPT_PREFIX    = 'x',
+    OTBR_OPT_RATE      = 'r',
+    OTBR_OPT_UNICAST   = 'u',
+};
+
+static const struct option kOptions[] = {{"agent-mac", required_argument, nullptr, OTBR_OPT_AGENT_MAC},
+                                         {"agent-pid", required_argument, nullptr, OTBR_OPT_AGENT_PID},
+                                         {"count", required_argument, nullptr, OTBR_OPT_COUNT},
+                                         {"duration", required_argument, nullptr, OTBR_OPT_DURATION},
+                                         {"help", no_argument, nullptr, OTBR_OPT_HELP},
+                                         {"interface", required_argument, nullptr, OTBR_OPT_INTERFACE},
+                                         {"pcap", required_argument, nullptr, OTBR_OPT_PCAP},
+                                         {"prefix", required_argument, nullptr, OTBR_OPT_PREFIX},
+                                         {"rate", required_argument, nullptr, OTBR_OPT_RATE},
+                                         {"unicast", required_argument, nullptr, OTBR_OPT_UNICAST},
+                                         {0, 0, 0, 0}};
+
+static const unsigned long kDefaultCount       = 100;
+static const unsigned long kDefaultDurationSec = 5;
+static const unsigned long kDefaultRate        = 1000;
+static const unsigned long kDefaultUnicast     = 50;
+
+// The time to wait for the last Neighbor Advertisements after sending stops.
+static const int kDrainTimeoutMs = 500;
+
+static const uint32_t kPcapMagic      = 0xa1b2c3d4;
+static const uint32_t kPcapMagicNanos = 0xa1b23c4d;
+static const uint32_t kPcapEthernet   = 1;
+
+/**
+ * This structure represents a Neighbor Solicitation with a Source Link-Layer Address option.
+ *
+ */
+struct NsMessage
+{
+    struct nd_neighbor_solicit mNs;
+    uint8_t                    mOptionType;
+    uint8_t                    mOptionLength;
+    uint8_t                    mSourceMac[ETH_ALEN];
+};
+
+/**
+ * This structure represents a frame to send and the target it solicits.
+ *
+ */
+struct Frame
+{
+    std::vector<uint8_t> mData;
+    Ip6Address           mTarget;
+    bool                 mIsUnicast;
+};
+
+static uint64_t NowNs(void)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/**
+ * This class records solicitation-to-advertisement latencies.
+ *
+ */
+class LatencyStats
+{
+public:
+    void Add(uint64_t aLatencyNs) { mSamples.push_back(aLatencyNs); }
+
+    size_t GetCount(void) const { return mSamples.size(); }
+
+    void Report(void);
+
+private:
+    double GetPercentileUs(unsigned aPercentile) const
+    {
+        return mSamples[(mSamples.size() - 1) * aPercentile / 100] / 1000.0;
+    }
+
+    std::vector<uint64_t> mSamples;
+};
+
+void LatencyStats::Report(void)
+{
+    uint64_t sum = 0;
+
+    VerifyOrExit(!mSamples.empty(), printf("NA latency: no samples\n"));
+
+    std::sort(mSamples.begin(), mSamples.end());
+
+    for (uint64_t sample : mSamples)
+    {
+        sum += sample;
+    }
+
+    printf("NA latency (us): samples %zu, min %.1f, avg %.1f, p50 %.1f, p99 %.1f, max %.1f\n", mSamples.size(),
+           GetPercentileUs(0), sum / 1000.0 / mSamples.size(), GetPercentileUs(50), GetPercentileUs(99),
+           GetPercentileUs(100));
+
+exit:
+    return;
+}
+
+/**
+ * This class records the send time of each outstanding solicitation, keyed by target.
+ *
+ * A target solicited again before it is answered keeps its first send time, so the latency is never understated.
+ *
+ */
+class PendingSolicitations
+{
+public:
+    void Add(const Ip6Address &aTarget, uint64_t aSentNs)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        mPending.insert(std::make_pair(aTarget, aSentNs));
+    }
+
+    bool Take(const Ip6Address &aTarget, uint64_t &aSentNs)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        auto                        it    = mPending.find(aTarget);
+        bool                        found = it != mPending.end();
+
+        if (found)
+        {
+            aSentNs = it->second;
+            mPending.erase(it);
+        }
+
+        return found;
+    }
+
+private:
+    std::mutex                     mMutex;
+    std::map<Ip6Address, uint64_t> mPending;
+};
+
+static uint16_t Checksum(const void *aData, size_t aLength, uint32_t aSum)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(aData);
+
+    for (size_t i = 0; i + 1 < aLength; i += 2)
+    {
+        aSum += static_cast<uint32_t>(bytes[i] << 8 | bytes[i + 1]);
+    }
+
+    if (aLength & 1)
+    {
+        aSum += static_cast<uint32_t>(bytes[aLength - 1] << 8);
+    }
+
+    while (aSum >> 16)
+    {
+        aSum = (aSum & 0xffff) + (aSum >> 16);
+    }
+
+    return static_cast<uint16_t>(aSum);
+}
+
+static void SetIcmp6Checksum(struct ip6_hdr &aIp6, struct icmp6_hdr &aIcmp6, size_t aLength)
+{
+    uint32_t sum = 0;
+
+    aIcmp6.icmp6_cksum = 0;
+
+    // The pseudo header: addresses, upper-layer length and next header.
+    sum = Checksum(&aIp6.ip6_src, sizeof(aIp6.ip6_src) + sizeof(aIp6.ip6_dst), sum);
+    sum += static_cast<uint32_t>(aLength);
+    sum += IPPROTO_ICMPV6;
+    sum = Checksum(&aIcmp6, aLength, sum);
+
+    aIcmp6.icmp6_cksum = htons(static_cast<uint16_t>(~sum));
+}
+
+static Frame MakeNsFrame(const Ip6Address &aTarget,
+                         bool              aIsUnicast,
+                         const uint8_t *   aSourceMac,
+                         const Ip6Address &aSource,
+                         const uint8_t *   aAgentMac)
+{
+    Frame               frame;
+    struct ether_header ethernet;
+    struct ip6_hdr      ip6;
+    NsMessage           ns;
+    Ip6Address          destination = aIsUnicast ? aTarget : aTarget.ToSolicitedNodeMulticastAddress();
+
+    if (aIsUnicast)
+    {
+        memcpy(ethernet.ether_dhost, aAgentMac, ETH_ALEN);
+    }
+    else
+    {
+        // 33:33 followed by the last 32 bits of the multicast address.
+        ethernet.ether_dhost[0] = 0x33;
+        ethernet.ether_dhost[1] = 0x33;
+        memcpy(&ethernet.ether_dhost[2], &destination.m8[12], 4);
+    }
+
+    memcpy(ethernet.ether_shost, aSourceMac, ETH_ALEN);
+    ethernet.ether_type = htons(ETHERTYPE_IPV6);
+
+    memset(&ip6, 0, sizeof(ip6));
+    ip6.ip6_flow = htonl(6 << 28);
+    ip6.ip6_plen = htons(sizeof(ns));
+    ip6.ip6_nxt  = IPPROTO_ICMPV6;
+    ip6.ip6_hlim = 255;
+    aSource.CopyTo(ip6.ip6_src);
+    destination.CopyTo(ip6.ip6_dst);
+
+    memset(&ns, 0, sizeof(ns));
+    ns.mNs.nd_ns_type = ND_NEIGHBOR_SOLICIT;
+    aTarget.CopyTo(ns.mNs.nd_ns_target);
+    ns.mOptionType   = ND_OPT_SOURCE_LINKADDR;
+    ns.mOptionLength = 1;
+    memcpy(ns.mSourceMac, aSourceMac, ETH_ALEN);
+
+    SetIcmp6Checksum(ip6, ns.mNs.nd_ns_hdr, sizeof(ns));
+
+    frame.mData.insert(frame.mData.end(), reinterpret_cast<uint8_t *>(&ethernet),
+                       reinterpret_cast<uint8_t *>(&ethernet) + sizeof(ethernet));
+    frame.mData.insert(frame.mData.end(), reinterpret_cast<uint8_t *>(&ip6),
+                       reinterpret_cast<uint8_t *>(&ip6) + sizeof(ip6));
+    frame.mData.insert(frame.mData.end(), reinterpret_cast<uint8_t *>(&ns),
+                       reinterpret_cast<uint8_t *>(&ns) + sizeof(ns));
+    frame.mTarget    = aTarget;
+    frame.mIsUnicast = aIsUnicast;
+
+    return frame;
+}
+
+/**
+ * This function parses an ICMPv6 message of a given type out of an Ethernet frame.
+ *
+ * @returns A pointer to the ICMPv6 header, or nullptr if the frame does not carry such a message.
+ *
+ */
+static const struct icmp6_hdr *ParseIcmp6(const uint8_t *aData, size_t aLength, uint8_t aType, size_t aMinLength)
+{
+    const struct icmp6_hdr *icmp6 = nullptr;
+    const struct ip6_hdr *  ip6   = reinterpret_cast<const struct ip6_hdr *>(aData + sizeof(struct ether_header));
+
+    VerifyOrExit(aLength >= sizeof(struct ether_header) + sizeof(struct ip6_hdr) + aMinLength);
+    VerifyOrExit(reinterpret_cast<const struct ether_header *>(aData)->ether_type == htons(ETHERTYPE_IPV6));
+    VerifyOrExit(ip6->ip6_nxt == IPPROTO_ICMPV6);
+
+    icmp6 = reinterpret_cast<const struct icmp6_hdr *>(ip6 + 1);
+    if (icmp6->icmp6_type != aType)
+    {
+        icmp6 = nullptr;
+    }
+
+exit:
+    return icmp6;
+}
+
+/**
+ * This function loads the Neighbor Solicitations of a pcap file with Ethernet link type.
+ *
+ */
+static otbrError LoadPcap(const char *aPath, std::vector<Frame> &aFrames)
+{
+    otbrError error = OTBR_ERROR_PARSE;
+    FILE *    file  = fopen(aPath, "rb");
+    uint32_t  header[6];
+    bool      swapped;
+
+    VerifyOrExit(file != nullptr, error = OTBR_ERROR_ERRNO);
+    VerifyOrExit(fread(header, sizeof(header), 1, file) == 1);
+
+    swapped = header[0] == __builtin_bswap32(kPcapMagic) || header[0] == __builtin_bswap32(kPcapMagicNanos);
+    VerifyOrExit(swapped || header[0] == kPcapMagic || header[0] == kPcapMagicNanos);
+    VerifyOrExit((swapped ? __builtin_bswap32(header[5]) : header[5]) == kPcapEthernet,
+                 error = OTBR_ERROR_NOT_IMPLEMENTED);
+
+    while (true)
+    {
+        uint32_t             record[4];
+        uint32_t             length;
+        std::vector<uint8_t> data;
+        const icmp6_hdr *    icmp6;
+
+        if (fread(record, sizeof(record), 1, file) != 1)
+        {
+            break;
+        }
+
+        length = swapped ? __builtin_bswap32(record[2]) : record[2];
+        VerifyOrExit(length <= 0xffff);
+        data.resize(length);
+        VerifyOrExit(fread(data.data(), 1, length, file) == length);
+
+        icmp6 = ParseIcmp6(data.data(), data.size(), ND_NEIGHBOR_SOLICIT, sizeof(struct nd_neighbor_solicit));
+
+        if (icmp6 != nullptr)
+        {
+            const struct nd_neighbor_solicit *ns  = reinterpret_cast<const struct nd_neighbor_solicit *>(icmp6);
+            Frame                             frame;
+
+            frame.mTarget    = Ip6Address(ns->nd_ns_target.s6_addr);
+            frame.mIsUnicast = !(data[0] & 0x01);
+            frame.mData      = std::move(data);
+            aFrames.push_back(std::move(frame));
+        }
+    }
+
+    error = aFrames.empty() ? OTBR_ERROR_NOT_FOUND : OTBR_ERROR_NONE;
+
+exit:
+    if (file != nullptr)
+    {
+        fclose(file);
+    }
+
+    return error;
+}
+
+static otbrError GetInterfaceAddresses(const char *aIfName, uint8_t *aMac, Ip6Address &aLinkLocal)
+{
+    otbrError       error = OTBR_ERROR_NOT_FOUND;
+    struct ifreq    ifr;
+    struct ifaddrs *addrs = nullptr;
+    int             fd    = socket(AF_INET6, SOCK_DGRAM, 0);
+
+    VerifyOrExit(fd >= 0, error = OTBR_ERROR_ERRNO);
+
+    memset(&ifr, 0, sizeof(ifr));
+    strncpy(ifr.ifr_name, aIfName, sizeof(ifr.ifr_name) - 1);
+    VerifyOrExit(ioctl(fd, SIOCGIFHWADDR, &ifr) == 0, error = OTBR_ERROR_ERRNO);
+    memcpy(aMac, ifr.ifr_hwaddr.sa_data, ETH_ALEN);
+
+    VerifyOrExit(getifaddrs(&addrs) == 0, error = OTBR_ERROR_ERRNO);
+
+    for (struct ifaddrs *addr = addrs; addr != nullptr; addr = addr->ifa_next)
+    {
+        if (addr->ifa_addr == nullptr || addr->ifa_addr->sa_family != AF_INET6 || strcmp(addr->ifa_name, aIfName))
+        {
+            continue;
+        }
+
+        aLinkLocal = Ip6Address(reinterpret_cast<struct sockaddr_in6 *>(addr->ifa_addr)->sin6_addr.s6_addr);
+
+        if (aLinkLocal.IsLinkLocal())
+        {
+            ExitNow(error = OTBR_ERROR_NONE);
+        }
+    }
+
+exit:
+    if (addrs != nullptr)
+    {
+        freeifaddrs(addrs);
+    }
+
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    return error;
+}
+
+/**
+ * This function returns the CPU time used by a process, in clock ticks, or -1 if it cannot be read.
+ *
+ */
+static long long GetProcessCpuTicks(unsigned long aPid)
+{
+    long long          ticks = -1;
+    char               path[64];
+    char               stat[1024];
+    unsigned long long utime;
+    unsigned long long stime;
+    const char *       fields;
+    FILE *             file;
+    size_t             length;
+
+    snprintf(path, sizeof(path), "/proc/%lu/stat", aPid);
+    VerifyOrExit((file = fopen(path, "r")) != nullptr);
+    length = fread(stat, 1, sizeof(stat) - 1, file);
+    fclose(file);
+    stat[length] = '\0';
+
+    // The command name may contain spaces, the fields are counted from its closing parenthesis.
+    VerifyOrExit((fields = strrchr(stat, ')')) != nullptr);
+    VerifyOrExit(sscanf(fields + 1, " %*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %llu %llu", &utime, &stime) == 2);
+
+    ticks = static_cast<long long>(utime + stime);
+
+exit:
+    return ticks;
+}
+
+static bool ParseNumber(const char *aString, unsigned long &aNumber)
+{
+    char *end;
+
+    aNumber = strtoul(aString, &end, 0);
+
+    return *aString != '\0' && *end == '\0';
+}
+
+static bool ParseMac(const char *aString, uint8_t *aMac)
+{
+    unsigned int bytes[ETH_ALEN];
+    bool         valid = sscanf(aString, "%x:%x:%x:%x:%x:%x", &bytes[0], &bytes[1], &bytes[2], &bytes[3], &bytes[4],
+                        &bytes[5]) == ETH_ALEN;
+
+    for (int i = 0; valid && i < ETH_ALEN; ++i)
+    {
+        valid   = bytes[i] <= 0xff;
+        aMac[i] = static_cast<uint8_t>(bytes[i]);
+    }
+
+    return valid;
+}
+
+static bool ParsePrefix(const char *aString, Ip6Prefix &aPrefix)
+{
+    char          address[INET6_ADDRSTRLEN];
+    const char *  slash  = strchr(aString, '/');
+    unsigned long length = 64;
+    bool          valid  = true;
+
+    if (slash == nullptr)
+    {
+        slash = aString + strlen(aString);
+    }
+    else
+    {
+        valid = ParseNumber(slash + 1, length) && length <= 120;
+    }
+
+    valid = valid && static_cast<size_t>(slash - aString) < sizeof(address);
+    VerifyOrExit(valid);
+
+    memcpy(address, aString, static_cast<size_t>(slash - aString));
+    address[slash - aString] = '\0';
+
+    valid           = Ip6Address::FromString(address, aPrefix.mPrefix) == OTBR_ERROR_NONE;
+    aPrefix.mLength = static_cast<uint8_t>(length);
+
+exit:
+    return valid;
+}
+
+static void PrintUsage(const char *aProgramName, FILE *aStream)
+{
+    fprintf(aStream,
+            "Syntax:\n"
+            "    %s -i interface (-x prefix [-n duas] | -f pcap) [-m agent-mac] [-p agent-pid] [-u unicast-percent]\n"
+            "        [-d seconds] [-r solicitations-per-second]\n"
+            "Defaults: %lu DUAs, %lu%% unicast, %lu seconds, %lu solicitations per second.\n"
+            "The interface is the peer of the agent backbone interface. Unicast solicitations need the agent MAC.\n",
+            aProgramName, kDefaultCount, kDefaultUnicast, kDefaultDurationSec, kDefaultRate);
+}
+
+int main(int argc, char *argv[])
+{
+    int                   ret         = EXIT_FAILURE;
+    const char *          ifName      = nullptr;
+    const char *          pcapPath    = nullptr;
+    unsigned long         count       = kDefaultCount;
+    unsigned long         durationSec = kDefaultDurationSec;
+    unsigned long         rate        = kDefaultRate;
+    unsigned long         unicast     = kDefaultUnicast;
+    unsigned long         agentPid    = 0;
+    bool                  hasPrefix   = false;
+    bool                  hasAgentMac = false;
+    uint8_t               agentMac[ETH_ALEN];
+    uint8_t               sourceMac[ETH_ALEN];
+    Ip6Address            source;
+    Ip6Prefix             prefix;
+    std::vector<Frame>    frames;
+    PendingSolicitations  pending;
+    LatencyStats          stats;
+    std::atomic<bool>     sending(true);
+    std::atomic<uint64_t> sent(0);
+    std::atomic<uint64_t> sendFailures(0);
+    std::thread           sender;
+    uint64_t              received   = 0;
+    uint64_t              unmatched  = 0;
+    long long             startTicks = -1;
+    long long             endTicks   = -1;
+    struct sockaddr_ll    link;
+    uint64_t              startNs;
+    uint64_t              endNs;
+    uint64_t              elapsedNs;
+    int                   fd = -1;
+    int                   opt;
+
+    while ((opt = getopt_long(argc, argv, "d:f:hi:m:n:p:r:u:x:", kOptions, nullptr)) != -1)
+    {
+        bool valid = true;
+
+        switch (opt)
+        {
+        case OTBR_OPT_AGENT_MAC:
+            valid = hasAgentMac = ParseMac(optarg, agentMac);
+            break;
+        case OTBR_OPT_AGENT_PID:
+            valid = ParseNumber(optarg, agentPid) && agentPid > 0;
+            break;
+        case OTBR_OPT_COUNT:
+            valid = ParseNumber(optarg, count) && count > 0;
+            break;
+        case OTBR_OPT_DURATION:
+            valid = ParseNumber(optarg, durationSec) && durationSec > 0;
+            break;
+        case OTBR_OPT_INTERFACE:
+            ifName = optarg;
+            break;
+        case OTBR_OPT_PCAP:
+            pcapPath = optarg;
+            break;
+        case OTBR_OPT_PREFIX:
+            valid = hasPrefix = ParsePrefix(optarg, prefix);
+            break;
+        case OTBR_OPT_RATE:
+            valid = ParseNumber(optarg, rate) && rate > 0;
+            break;
+        case OTBR_OPT_UNICAST:
+            valid = ParseNumber(optarg, unicast) && unicast <= 100;
+            break;
+        case OTBR_OPT_HELP:
+            PrintUsage(argv[0], stdout);
+            ExitNow(ret = EXIT_SUCCESS);
+            break;
+        default:
+            valid = false;
+            break;
+        }
+
+        VerifyOrExit(valid, PrintUsage(argv[0], stderr), ret = EX_USAGE);
+    }
+
+    VerifyOrExit(ifName != nullptr && (hasPrefix != (pcapPath != nullptr)), PrintUsage(argv[0], stderr),
+                 ret = EX_USAGE);
+    VerifyOrExit(pcapPath != nullptr || unicast == 0 || hasAgentMac, PrintUsage(argv[0], stderr), ret = EX_USAGE);
+
+    otbrLogInit("otbr-bench-nd-proxy", OTBR_LOG_WARNING, true);
+
+    VerifyOrExit(GetInterfaceAddresses(ifName, sourceMac, source) == OTBR_ERROR_NONE,
+                 fprintf(stderr, "Failed to get the MAC and link-local address of %s\n", ifName));
+
+    if (pcapPath != nullptr)
+    {
+        VerifyOrExit(LoadPcap(pcapPath, frames) == OTBR_ERROR_NONE,
+                     fprintf(stderr, "Failed to load Neighbor Solicitations from %s\n", pcapPath));
+    }
+    else
+    {
+        // DUAs get the prefix followed by sequential interface identifiers, every (100 / unicast)th one is unicast.
+        for (unsigned long i = 0; i < count; ++i)
+        {
+            Ip6Address target    = prefix.mPrefix;
+            bool       isUnicast = (i * unicast) % 100 + unicast >= 100;
+
+            target.m8[12] = static_cast<uint8_t>((i + 1) >> 24);
+            target.m8[13] = static_cast<uint8_t>((i + 1) >> 16);
+            target.m8[14] = static_cast<uint8_t>((i + 1) >> 8);
+            target.m8[15] = static_cast<uint8_t>(i + 1);
+
+            frames.push_back(MakeNsFrame(target, isUnicast, sourceMac, source, agentMac));
+        }
+    }
+
+    fd = socket(AF_PACKET, SOCK_RAW, htons(ETH_P_IPV6));
+    VerifyOrExit(fd >= 0, fprintf(stderr, "Failed to open a packet socket: %s\n", strerror(errno)));
+
+    memset(&link, 0, sizeof(link));
+    link.sll_family   = AF_PACKET;
+    link.sll_protocol = htons(ETH_P_IPV6);
+    link.sll_ifindex  = static_cast<int>(if_nametoindex(ifName));
+    VerifyOrExit(bind(fd, reinterpret_cast<struct sockaddr *>(&link), sizeof(link)) == 0,
+                 fprintf(stderr, "Failed to bind to %s: %s\n", ifName, strerror(errno)));
+
+    if (agentPid != 0)
+    {
+        startTicks = GetProcessCpuTicks(agentPid);
+    }
+
+    startNs = NowNs();
+    endNs   = startNs + durationSec * 1000000000ull;
+
+    sender = std::thread([&]() {
+        const std::chrono::nanoseconds        interval(1000000000ull / rate);
+        std::chrono::steady_clock::time_point next = std::chrono::steady_clock::now();
+        size_t                                index = 0;
+
+        while (sending && NowNs() < endNs)
+        {
+            const Frame &frame = frames[index];
+
+            index = (index + 1) % frames.size();
+            pending.Add(frame.mTarget, NowNs());
+
+            if (send(fd, frame.mData.data(), frame.mData.size(), 0) < 0)
+            {
+                sendFailures++;
+            }
+            else
+            {
+                sent++;
+            }
+
+            next += interval;
+            std::this_thread::sleep_until(next);
+        }
+    });
+
+    // Receive until sending is over and the last advertisements had time to arrive.
+    while (true)
+    {
+        struct pollfd pfd     = {fd, POLLIN, 0};
+        uint64_t      now     = NowNs();
+        uint8_t       buffer[1514];
+        ssize_t       length;
+
+        if (now >= endNs + kDrainTimeoutMs * 1000000ull)
+        {
+            break;
+        }
+
+        if (poll(&pfd, 1, 100) <= 0)
+        {
+            continue;
+        }
+
+        while ((length = recv(fd, buffer, sizeof(buffer), MSG_DONTWAIT)) > 0)
+        {
+            const struct icmp6_hdr *icmp6 = ParseIcmp6(buffer, static_cast<size_t>(length), ND_NEIGHBOR_ADVERT,
+                                                       sizeof(struct nd_neighbor_advert));
+            Ip6Address              target;
+            uint64_t                sentNs;
+
+            if (icmp6 == nullptr)
+            {
+                continue;
+            }
+
+            received++;
+            target = Ip6Address(reinterpret_cast<const struct nd_neighbor_advert *>(icmp6)->nd_na_target.s6_addr);
+
+            if (pending.Take(target, sentNs))
+            {
+                stats.Add(NowNs() - sentNs);
+            }
+            else
+            {
+                unmatched++;
+            }
+        }
+    }
+
+    sending = false;
+    sender.join();
+
+    elapsedNs = NowNs() - startNs;
+
+    if (agentPid != 0)
+    {
+        endTicks = GetProcessCpuTicks(agentPid);
+    }
+
+    printf("interface: %s, targets: %zu, unicast: %lu%%, rate: %lu/s, duration: %lus\n", ifName, frames.size(),
+           pcapPath != nullptr ? 0 : unicast, rate, durationSec);
+    printf("NS sent: %" PRIu64 " (%.1f/s), send failures: %" PRIu64 "\n", sent.load(),
+           static_cast<double>(sent.load()) / durationSec, sendFailures.load());
+    printf("NA received: %" PRIu64 " (%.1f/s), answered: %.1f%%, unsolicited or late: %" PRIu64 "\n", received,
+           static_cast<double>(received) / durationSec, sent.load() ? stats.GetCount() * 100.0 / sent.load() : 0.0,
+           unmatched);
+    stats.Report();
+
+    if (startTicks >= 0 && endTicks >= 0)
+    {
+        printf("agent CPU: %.1f%%\n", (endTicks - startTicks) * 100.0 / sysconf(_SC_CLK_TCK) / (elapsedNs / 1e9));
+    }
+
+    ret = EXIT_SUCCESS;
+
+exit:
+    if (fd >= 0)
+    {
+        close(fd);
+    }
+
+    otbrLogDeinit();
+    return ret;
+}
@@ -0,0 +1,196 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a microbenchmark of the steering data computation.
+ *
+ *   It computes the joiner ids and the bloom filter of a list of synthetic EUI64s one joiner at a time, the way
+ *   `tools/steering_data.cpp` did before, and with the batch API of `SteeringData`. The time per joiner is reported
+ *   and the bloom filters are checked to be the same.
+ */
+
+#include <openthread-br/config.h>
+
+#include <chrono>
+#include <vector>
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+
+#include "common/code_utils.hpp"
+#include "utils/steering_data.hpp"
+
+using otbr::SteeringData;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+enum
+{
+    OTBR_OPT_HELP       = 'h',
+    OTBR_OPT_ITERATIONS = 'i',
+    OTBR_OPT_JOINERS    = 'j',
+};
+
+static const struct option kOptions[] = {{"help", no_argument, nullptr, OTBR_OPT_HELP},
+                                         {"iterations", required_argument, nullptr, OTBR_OPT_ITERATIONS},
+                                         {"joiners", required_argument, nullptr, OTBR_OPT_JOINERS},
+                                         {0, 0, 0, 0}};
+
+static const unsigned long kDefaultIterations = 20;
+static const unsigned long kDefaultJoiners    = 10000;
+static const uint8_t       kBloomFilterLength = SteeringData::kMaxSizeOfBloomFilter;
+
+static void PrintUsage(const char *aProgramName, FILE *aStream)
+{
+    fprintf(aStream,
+            "Syntax:\n"
+            "    %s [-j joiners] [-i iterations]\n"
+            "Defaults: %lu joiners, %lu iterations.\n",
+            aProgramName, kDefaultJoiners, kDefaultIterations);
+}
+
+static bool ParseNumber(const char *aString, unsigned long &aNumber)
+{
+    char *end;
+
+    aNumber = strtoul(aString, &end, 0);
+
+    return *aString != '\0' && *end == '\0';
+}
+
+static void Report(const char *aName, uint64_t aNs, unsigned long aJoiners, unsigned long aIterations)
+{
+    printf("%-8s time/joiner (ns): %8.1f\n", aName, static_cast<double>(aNs) / aJoiners / aIterations);
+}
+
+static void ComputeSingle(const std::vector<uint8_t> &aEui64s, SteeringData &aSteeringData)
+{
+    aSteeringData.Init(kBloomFilterLength);
+
+    for (size_t i = 0; i < aEui64s.size(); i += SteeringData::kSizeEui64)
+    {
+        uint8_t joinerId[SteeringData::kSizeJoinerId];
+
+        SteeringData::ComputeJoinerId(&aEui64s[i], joinerId);
+        aSteeringData.ComputeBloomFilter(joinerId);
+    }
+}
+
+static void ComputeBatch(const std::vector<uint8_t> &aEui64s,
+                         std::vector<uint8_t> &      aJoinerIds,
+                         SteeringData &              aSteeringData)
+{
+    size_t count = aEui64s.size() / SteeringData::kSizeEui64;
+
+    aSteeringData.Init(kBloomFilterLength);
+    SteeringData::ComputeJoinerIds(aEui64s.data(), count, aJoinerIds.data());
+    aSteeringData.ComputeBloomFilter(aJoinerIds.data(), count);
+}
+
+int main(int argc, char *argv[])
+{
+    int                      ret        = EXIT_FAILURE;
+    unsigned long            joiners    = kDefaultJoiners;
+    unsigned long            iterations = kDefaultIterations;
+    std::vector<uint8_t>     eui64s;
+    std::vector<uint8_t>     joinerIds;
+    SteeringData             single;
+    SteeringData             batch;
+    steady_clock::time_point start;
+    uint64_t                 elapsedNs;
+    int                      opt;
+
+    while ((opt = getopt_long(argc, argv, "hi:j:", kOptions, nullptr)) != -1)
+    {
+        bool valid = true;
+
+        switch (opt)
+        {
+        case OTBR_OPT_ITERATIONS:
+            valid = ParseNumber(optarg, iterations) && iterations > 0;
+            break;
+        case OTBR_OPT_JOINERS:
+            valid = ParseNumber(optarg, joiners) && joiners > 0;
+            break;
+        case OTBR_OPT_HELP:
+            PrintUsage(argv[0], stdout);
+            ExitNow(ret = EXIT_SUCCESS);
+            break;
+        default:
+            valid = false;
+            break;
+        }
+
+        VerifyOrExit(valid, PrintUsage(argv[0], stderr), ret = EX_USAGE);
+    }
+
+    // Sequential EUI64s under one OUI, like a batch of devices off a production line.
+    for (unsigned long i = 0; i < joiners; i++)
+    {
+        uint8_t eui64[SteeringData::kSizeEui64] = {0x18, 0xb4, 0x30, 0x00};
+
+        eui64[4] = static_cast<uint8_t>(i >> 24);
+        eui64[5] = static_cast<uint8_t>(i >> 16);
+        eui64[6] = static_cast<uint8_t>(i >> 8);
+        eui64[7] = static_cast<uint8_t>(i);
+        eui64s.insert(eui64s.end(), eui64, eui64 + sizeof(eui64));
+    }
+
+    joinerIds.resize(eui64s.size());
+
+    ComputeSingle(eui64s, single);
+    ComputeBatch(eui64s, joinerIds, batch);
+    VerifyOrExit(memcmp(single.GetBloomFilter(), batch.GetBloomFilter(), kBloomFilterLength) == 0,
+                 fprintf(stderr, "Bloom filters differ\n"));
+
+    start = steady_clock::now();
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+        ComputeSingle(eui64s, single);
+    }
+    elapsedNs = static_cast<uint64_t>(duration_cast<nanoseconds>(steady_clock::now() - start).count());
+    Report("single", elapsedNs, joiners, iterations);
+
+    start = steady_clock::now();
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+        ComputeBatch(eui64s, joinerIds, batch);
+    }
+    elapsedNs = static_cast<uint64_t>(duration_cast<nanoseconds>(steady_clock::now() - start).count());
+    Report("batch", elapsedNs, joiners, iterations);
+
+    ret = EXIT_SUCCESS;
+
+exit:
+    return ret;
+}
@@ -0,0 +1,498 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements `otbr-bench`, the microbenchmark suite of the core utilities.
+ *
+ *   Each benchmark runs its body in batches of doubling size until a batch lasts at least the minimum time, and the
+ *   time per operation of that batch is reported. With `--json` the results are written as a single JSON document,
+ *   so CI can store them and track trends:
+ *
+ *       {"benchmarks":[{"name":"crc16/ccitt/4096","iterations":65536,"ns_per_op":812.3,"bytes_per_second":...}]}
+ *
+ *   The other `otbr-bench-*` programs compare an implementation against the one it replaced, this suite only tracks
+ *   the current implementations.
+ */
+
+#include <openthread-br/config.h>
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/tlv.hpp"
+#include "utils/crc16.hpp"
+#include "utils/event_emitter.hpp"
+#include "utils/hex.hpp"
+#include "utils/pskc.hpp"
+#include "utils/steering_data.hpp"
+
+#if OTBR_ENABLE_DBUS_SERVER
+#include "dbus/common/dbus_message_helper.hpp"
+#endif
+
+#if OTBR_ENABLE_REST_SERVER
+#include "diag_set.hpp"
+#include "rest/json.hpp"
+#endif
+
+using otbr::Crc16;
+using otbr::EventEmitter;
+using otbr::SteeringData;
+using std::chrono::duration_cast;
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+enum
+{
+    OTBR_OPT_FILTER   = 'f',
+    OTBR_OPT_HELP     = 'h',
+    OTBR_OPT_JSON     = 'j',
+    OTBR_OPT_MIN_TIME = 't',
+};
+
+static const struct option kOptions[] = {{"filter", required_argument, nullptr, OTBR_OPT_FILTER},
+                                         {"help", no_argument, nullptr, OTBR_OPT_HELP},
+                                         {"json", no_argument, nullptr, OTBR_OPT_JSON},
+                                         {"min-time", required_argument, nullptr, OTBR_OPT_MIN_TIME},
+                                         {0, 0, 0, 0}};
+
+static const unsigned long kDefaultMinTimeMs = 200;
+static const uint64_t      kMaxIterations    = 1ull << 30;
+
+/**
+ * This class runs the benchmarks and collects their results.
+ *
+ */
+class Suite
+{
+public:
+    Suite(const char *aFilter, unsigned long aMinTimeMs)
+        : mFilter(aFilter)
+        , mMinTimeNs(static_cast<uint64_t>(aMinTimeMs) * 1000000)
+    {
+    }
+
+    /**
+     * This method runs a benchmark, unless it is filtered out.
+     *
+     * @param[in]   aName           The benchmark name, "<subject>/<case>/<size>".
+     * @param[in]   aBytesPerOp     The number of bytes processed by one operation, zero if not a throughput.
+     * @param[in]   aBody           The operation, called with the index of the iteration.
+     *
+     */
+    template <typename Body> void Run(const std::string &aName, size_t aBytesPerOp, Body &&aBody)
+    {
+        uint64_t iterations = 1;
+        uint64_t elapsedNs;
+
+        if (mFilter != nullptr && aName.find(mFilter) == std::string::npos)
+        {
+            return;
+        }
+
+        while (true)
+        {
+            steady_clock::time_point start = steady_clock::now();
+
+            for (uint64_t i = 0; i < iterations; i++)
+            {
+                aBody(i);
+            }
+
+            elapsedNs = static_cast<uint64_t>(duration_cast<nanoseconds>(steady_clock::now() - start).count());
+
+            if (elapsedNs >= mMinTimeNs || iterations >= kMaxIterations)
+            {
+                break;
+            }
+
+            iterations *= 2;
+        }
+
+        mResults.push_back({aName, iterations, static_cast<double>(elapsedNs) / iterations,
+                            aBytesPerOp == 0 ? 0 : static_cast<double>(aBytesPerOp) * iterations * 1e9 / elapsedNs});
+    }
+
+    /**
+     * This method writes the results.
+     *
+     * @param[in]   aJson   Whether to write JSON, or a text table otherwise.
+     *
+     */
+    void Print(bool aJson) const
+    {
+        if (aJson)
+        {
+            printf("{\"benchmarks\":[");
+
+            for (size_t i = 0; i < mResults.size(); i++)
+            {
+                const Result &result = mResults[i];
+
+                printf("%s{\"name\":\"%s\",\"iterations\":%llu,\"ns_per_op\":%.1f,\"bytes_per_second\":%.0f}",
+                       i == 0 ? "" : ",", result.mName.c_str(), static_cast<unsigned long long>(result.mIterations),
+                       result.mNsPerOp, result.mBytesPerSecond);
+            }
+
+            printf("]}\n");
+        }
+        else
+        {
+            for (const Result &result : mResults)
+            {
+                printf("%-36s %12llu iterations %14.1f ns/op", result.mName.c_str(),
+                       static_cast<unsigned long long>(result.mIterations), result.mNsPerOp);
+
+                if (result.mBytesPerSecond > 0)
+                {
+                    printf(" %10.1f MB/s", result.mBytesPerSecond / 1e6);
+                }
+
+                printf("\n");
+            }
+        }
+    }
+
+private:
+    struct Result
+    {
+        std::string mName;
+        uint64_t    mIterations;
+        double      mNsPerOp;
+        double      mBytesPerSecond;
+    };
+
+    const char *        mFilter;
+    uint64_t            mMinTimeNs;
+    std::vector<Result> mResults;
+};
+
+/**
+ * This function keeps the compiler from optimizing away the computation of a value.
+ *
+ */
+template <typename T> static void KeepResult(const T &aValue)
+{
+    asm volatile("" : : "r"(&aValue) : "memory");
+}
+
+static std::vector<uint8_t> MakeBuffer(size_t aSize)
+{
+    std::vector<uint8_t> buffer;
+
+    for (size_t i = 0; i < aSize; i++)
+    {
+        buffer.push_back(static_cast<uint8_t>(rand()));
+    }
+
+    return buffer;
+}
+
+static void BenchCrc16(Suite &aSuite)
+{
+    for (size_t size : {64, 4096})
+    {
+        std::vector<uint8_t> buffer = MakeBuffer(size);
+
+        aSuite.Run("crc16/ccitt/" + std::to_string(size), size, [&](uint64_t) {
+            Crc16 crc(Crc16::kCcitt);
+
+            crc.Update(buffer.data(), buffer.size());
+            KeepResult(crc.Get());
+        });
+    }
+}
+
+static void BenchHex(Suite &aSuite)
+{
+    for (size_t size : {16, 1024})
+    {
+        std::vector<uint8_t> bytes = MakeBuffer(size);
+        std::vector<char>    hex(2 * size + 1);
+
+        aSuite.Run("hex/bytes2hex/" + std::to_string(size), size, [&](uint64_t) {
+            otbr::Utils::Bytes2Hex(bytes.data(), static_cast<uint16_t>(bytes.size()), hex.data());
+            KeepResult(hex[0]);
+        });
+
+        aSuite.Run("hex/hex2bytes/" + std::to_string(size), size, [&](uint64_t) {
+            KeepResult(otbr::Utils::Hex2Bytes(hex.data(), bytes.data(), static_cast<uint16_t>(bytes.size())));
+        });
+    }
+}
+
+static void BenchPskc(Suite &aSuite)
+{
+    const uint8_t  extPanId[] = {0xde, 0xad, 0x00, 0xbe, 0xef, 0x00, 0xca, 0xfe};
+    otbr::Psk::Pskc pskc;
+
+    aSuite.Run("pskc/compute/1", 0, [&](uint64_t aIteration) {
+        char passphrase[sizeof("passphrase-18446744073709551615")];
+
+        // A new passphrase every time, so the result is never found in the cache.
+        snprintf(passphrase, sizeof(passphrase), "passphrase-%llu", static_cast<unsigned long long>(aIteration));
+        KeepResult(pskc.ComputePskc(extPanId, "OpenThread", passphrase)[0]);
+    });
+
+    aSuite.Run("pskc/cached/1", 0,
+               [&](uint64_t) { KeepResult(pskc.ComputePskc(extPanId, "OpenThread", "passphrase")[0]); });
+}
+
+static void BenchSteeringData(Suite &aSuite)
+{
+    for (size_t joiners : {1, 1000})
+    {
+        std::vector<uint8_t> joinerIds = MakeBuffer(joiners * SteeringData::kSizeJoinerId);
+        SteeringData         steeringData;
+
+        aSuite.Run("steering_data/bloom_filter/" + std::to_string(joiners), 0, [&](uint64_t) {
+            steeringData.Init(SteeringData::kMaxSizeOfBloomFilter);
+            steeringData.ComputeBloomFilter(joinerIds.data(), joiners);
+            KeepResult(steeringData);
+        });
+    }
+}
+
+static void HandleEvent(void *aContext, int aEvent, va_list aArguments)
+{
+    OTBR_UNUSED_VARIABLE(aEvent);
+
+    *static_cast<uint64_t *>(aContext) += va_arg(aArguments, unsigned int);
+}
+
+static void BenchEventEmitter(Suite &aSuite)
+{
+    for (size_t handlers : {1, 8})
+    {
+        EventEmitter emitter;
+        uint64_t     sum = 0;
+
+        for (size_t i = 0; i < handlers; i++)
+        {
+            emitter.On(1, HandleEvent, &sum);
+        }
+
+        aSuite.Run("event_emitter/emit/" + std::to_string(handlers), 0, [&](uint64_t aIteration) {
+            emitter.Emit(1, static_cast<unsigned int>(aIteration));
+        });
+
+        KeepResult(sum);
+    }
+}
+
+static std::vector<uint8_t> MakeActiveDataset(void)
+{
+    // An active operational dataset as returned by `otDatasetGetActiveTlvs()`.
+    static const uint8_t kDataset[] = {
+        0x0e, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x0f, 0x35, 0x06, 0x00,
+        0x04, 0x00, 0x1f, 0xff, 0xe0, 0x02, 0x08, 0xde, 0xad, 0x00, 0xbe, 0xef, 0x00, 0xca, 0xfe, 0x07, 0x08, 0xfd,
+        0x00, 0x0d, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x05, 0x10, 0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88,
+        0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff, 0x03, 0x0a, 0x4f, 0x70, 0x65, 0x6e, 0x54, 0x68, 0x72, 0x65, 0x61,
+        0x64, 0x01, 0x02, 0xfa, 0xce, 0x04, 0x10, 0x3c, 0xa6, 0x7c, 0x96, 0x9e, 0xfb, 0x0d, 0x0c, 0x74, 0xa4, 0xd8,
+        0xee, 0x92, 0x3b, 0x57, 0x6c, 0x0c, 0x04, 0x02, 0xa0, 0xf7, 0xf8,
+    };
+
+    return std::vector<uint8_t>(kDataset, kDataset + sizeof(kDataset));
+}
+
+static void BenchTlv(Suite &aSuite)
+{
+    std::vector<uint8_t> dataset = MakeActiveDataset();
+    otbr::TlvView        view(dataset.data(), dataset.size());
+
+    if (!view.IsValid())
+    {
+        fprintf(stderr, "Invalid dataset\n");
+        exit(EXIT_FAILURE);
+    }
+
+    aSuite.Run("tlv/validate/" + std::to_string(dataset.size()), dataset.size(), [&](uint64_t) {
+        otbr::TlvView datasetView(dataset.data(), dataset.size());
+
+        KeepResult(datasetView.IsValid());
+    });
+
+    aSuite.Run("tlv/types/" + std::to_string(dataset.size()), dataset.size(),
+               [&](uint64_t) { KeepResult(otbr::Meshcop::GetTlvTypes(view)); });
+
+    aSuite.Run("tlv/find/" + std::to_string(dataset.size()), dataset.size(),
+               [&](uint64_t) { KeepResult(view.Find(otbr::Meshcop::kChannelMask)); });
+}
+
+#if OTBR_ENABLE_DBUS_SERVER
+static std::vector<otbr::DBus::ChildInfo> MakeChildTable(size_t aCount)
+{
+    std::vector<otbr::DBus::ChildInfo> children;
+
+    for (size_t i = 0; i < aCount; i++)
+    {
+        otbr::DBus::ChildInfo child = {};
+
+        child.mExtAddress   = 0x1122334455660000ull + i;
+        child.mTimeout      = 240;
+        child.mRloc16       = static_cast<uint16_t>(0x0400 + i + 1);
+        child.mChildId      = static_cast<uint16_t>(i + 1);
+        child.mAverageRssi  = -60;
+        child.mLastRssi     = -58;
+        child.mRxOnWhenIdle = (i % 2) == 0;
+
+        children.push_back(child);
+    }
+
+    return children;
+}
+
+static void BenchDBusMessage(Suite &aSuite)
+{
+    for (size_t count : {10, 64})
+    {
+        std::tuple<std::vector<otbr::DBus::ChildInfo>> children(MakeChildTable(count));
+        DBusMessage *                                  encoded = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+
+        VerifyOrDie(encoded != nullptr && TupleToDBusMessage(*encoded, children) == OTBR_ERROR_NONE,
+                    "Failed to encode the child table");
+
+        aSuite.Run("dbus/child_table_encode/" + std::to_string(count), 0, [&](uint64_t) {
+            DBusMessage *message = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+
+            KeepResult(TupleToDBusMessage(*message, children));
+            dbus_message_unref(message);
+        });
+
+        aSuite.Run("dbus/child_table_extract/" + std::to_string(count), 0, [&](uint64_t) {
+            std::tuple<std::vector<otbr::DBus::ChildInfo>> extracted;
+
+            KeepResult(DBusMessageToTuple(*encoded, extracted));
+        });
+
+        dbus_message_unref(encoded);
+    }
+}
+#endif // OTBR_ENABLE_DBUS_SERVER
+
+#if OTBR_ENABLE_REST_SERVER
+static void BenchJson(Suite &aSuite)
+{
+    for (size_t nodes : {50, 200, 500})
+    {
+        std::vector<std::vector<otNetworkDiagTlv>> diagSet = otbr::Benchmark::MakeDiagSet(nodes);
+
+        aSuite.Run("json/diag2json/" + std::to_string(nodes), 0,
+                   [&](uint64_t) { KeepResult(otbr::rest::Json::Diag2JsonString(diagSet)); });
+    }
+}
+#endif // OTBR_ENABLE_REST_SERVER
+
+static void PrintUsage(const char *aProgramName, FILE *aStream)
+{
+    fprintf(aStream,
+            "Syntax:\n"
+            "    %s [-f filter] [-t min-time-ms] [-j]\n"
+            "Runs the benchmarks whose name contains the filter, each for at least %lu ms by default.\n"
+            "With -j, the results are written as JSON.\n",
+            aProgramName, kDefaultMinTimeMs);
+}
+
+static bool ParseNumber(const char *aString, unsigned long &aNumber)
+{
+    char *end;
+
+    aNumber = strtoul(aString, &end, 0);
+
+    return *aString != '\0' && *end == '\0';
+}
+
+int main(int argc, char *argv[])
+{
+    int           ret       = EXIT_FAILURE;
+    const char *  filter    = nullptr;
+    unsigned long minTimeMs = kDefaultMinTimeMs;
+    bool          json      = false;
+    int           opt;
+
+    while ((opt = getopt_long(argc, argv, "f:hjt:", kOptions, nullptr)) != -1)
+    {
+        bool valid = true;
+
+        switch (opt)
+        {
+        case OTBR_OPT_FILTER:
+            filter = optarg;
+            break;
+        case OTBR_OPT_JSON:
+            json = true;
+            break;
+        case OTBR_OPT_MIN_TIME:
+            valid = ParseNumber(optarg, minTimeMs);
+            break;
+        case OTBR_OPT_HELP:
+            PrintUsage(argv[0], stdout);
+            ExitNow(ret = EXIT_SUCCESS);
+            break;
+        default:
+            valid = false;
+            break;
+        }
+
+        VerifyOrExit(valid, PrintUsage(argv[0], stderr), ret = EX_USAGE);
+    }
+
+    {
+        Suite suite(filter, minTimeMs);
+
+        BenchCrc16(suite);
+        BenchHex(suite);
+        BenchPskc(suite);
+        BenchSteeringData(suite);
+        BenchEventEmitter(suite);
+        BenchTlv(suite);
+#if OTBR_ENABLE_DBUS_SERVER
+        BenchDBusMessage(suite);
+#endif
+#if OTBR_ENABLE_REST_SERVER
+        BenchJson(suite);
+#endif
+
+        suite.Print(json);
+    }
+
+    ret = EXIT_SUCCESS;
+
+exit:
+    return ret;
+}
@@ -0,0 +1,471 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the client side of the d-bus benchmarks.
+ *
+ * It measures the calls per second and the latency of typical d-bus requests against `otbr-bench-dbus-server`,
+ * both through `ThreadApiDBus` and with raw libdbus calls, and the fan-out of signals to up to 50 subscribers.
+ */
+
+#include <inttypes.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <dbus/dbus.h>
+
+#include "common/code_utils.hpp"
+#include "dbus/client/thread_api_dbus.hpp"
+#include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+
+using otbr::DBus::ChildInfo;
+using otbr::DBus::ClientError;
+using otbr::DBus::DBusMessageExtractFromVariant;
+using otbr::DBus::DBusMessageToTuple;
+using otbr::DBus::TableEvent;
+using otbr::DBus::ThreadApiDBus;
+using otbr::DBus::TupleToDBusMessage;
+using otbr::DBus::UniqueDBusMessage;
+using Clock = std::chrono::steady_clock;
+
+#define OTBR_BENCH_INTERFACE_NAME "bench"
+#define OTBR_BENCH_INTERFACE "io.openthread.Bench"
+#define OTBR_BENCH_PROPERTY_UNCACHED_CHILD_TABLE "UncachedChildTable"
+
+#define TEST_ASSERT(x)                                              \
+    do                                                              \
+    {                                                               \
+        if (!(x))                                                   \
+        {                                                           \
+            printf("Assert failed at %s:%d\n", __FILE__, __LINE__); \
+            exit(EXIT_FAILURE);                                     \
+        }                                                           \
+    } while (false)
+
+static const uint32_t kDefaultIterations  = 2000;
+static const uint32_t kWarmUpIterations   = 20;
+static const uint32_t kAsyncWindow        = 16;
+static const uint32_t kSignalsPerRun      = 200;
+static const int      kReplyTimeoutMs     = 5000;
+static const int      kSignalTimeoutMs    = 10000;
+static const uint32_t kSubscriberCounts[] = {1, 8, 32, 50};
+static const char *   kBenchServerName    = OTBR_DBUS_SERVER_PREFIX OTBR_BENCH_INTERFACE_NAME;
+static const char *   kBenchObjectPath    = OTBR_DBUS_OBJECT_PREFIX OTBR_BENCH_INTERFACE_NAME;
+static const char *   kSmallProperties[]  = {OTBR_DBUS_PROPERTY_DEVICE_ROLE, OTBR_DBUS_PROPERTY_CHANNEL,
+                                         OTBR_DBUS_PROPERTY_PANID, OTBR_DBUS_PROPERTY_RLOC16};
+
+struct DBusConnectionDeleter
+{
+    void operator()(DBusConnection *aConnection)
+    {
+        // All connections of the benchmark are private.
+        dbus_connection_close(aConnection);
+        dbus_connection_unref(aConnection);
+    }
+};
+
+using UniqueDBusConnection = std::unique_ptr<DBusConnection, DBusConnectionDeleter>;
+
+static uint64_t ElapsedUs(Clock::time_point aStart)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - aStart).count();
+}
+
+static void PrintResult(const char *aName, std::vector<uint64_t> &aLatencies, uint64_t aTotalUs)
+{
+    uint64_t sum = 0;
+
+    std::sort(aLatencies.begin(), aLatencies.end());
+
+    for (uint64_t latency : aLatencies)
+    {
+        sum += latency;
+    }
+
+    printf("%-32s %7zu calls %9.0f calls/s   avg %8.1f us   p50 %6" PRIu64 " us   p99 %6" PRIu64 " us   max %6" PRIu64
+           " us\n",
+           aName, aLatencies.size(), aLatencies.size() * 1e6 / std::max<uint64_t>(aTotalUs, 1),
+           static_cast<double>(sum) / aLatencies.size(), aLatencies[aLatencies.size() / 2],
+           aLatencies[aLatencies.size() * 99 / 100], aLatencies.back());
+}
+
+/**
+ * This function runs a blocking call repeatedly and prints its throughput and latency.
+ *
+ */
+template <typename Call> static void RunBenchmark(const char *aName, uint32_t aIterations, Call aCall)
+{
+    std::vector<uint64_t> latencies;
+    Clock::time_point     start;
+
+    for (uint32_t i = 0; i < kWarmUpIterations; i++)
+    {
+        TEST_ASSERT(aCall());
+    }
+
+    latencies.reserve(aIterations);
+    start = Clock::now();
+
+    for (uint32_t i = 0; i < aIterations; i++)
+    {
+        Clock::time_point callStart = Clock::now();
+
+        TEST_ASSERT(aCall());
+        latencies.push_back(ElapsedUs(callStart));
+    }
+
+    PrintResult(aName, latencies, ElapsedUs(start));
+}
+
+static UniqueDBusConnection NewConnection(void)
+{
+    DBusError       error;
+    DBusConnection *connection;
+
+    dbus_error_init(&error);
+    connection = dbus_bus_get_private(DBUS_BUS_SYSTEM, &error);
+    if (connection == nullptr)
+    {
+        printf("Failed to connect to the system bus: %s\n", error.message);
+        exit(EXIT_FAILURE);
+    }
+    dbus_connection_set_exit_on_disconnect(connection, false);
+    dbus_error_free(&error);
+
+    return UniqueDBusConnection(connection);
+}
+
+template <typename... ArgTypes>
+static UniqueDBusMessage CallMethod(DBusConnection *               aConnection,
+                                    const char *                   aInterfaceName,
+                                    const char *                   aMethodName,
+                                    const std::tuple<ArgTypes...> &aArgs)
+{
+    UniqueDBusMessage message(
+        dbus_message_new_method_call(kBenchServerName, kBenchObjectPath, aInterfaceName, aMethodName));
+    UniqueDBusMessage reply;
+
+    VerifyOrExit(message != nullptr);
+    VerifyOrExit(TupleToDBusMessage(*message, aArgs) == OTBR_ERROR_NONE);
+    reply = UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(aConnection, message.get(), kReplyTimeoutMs, nullptr));
+    if (reply != nullptr && dbus_message_get_type(reply.get()) == DBUS_MESSAGE_TYPE_ERROR)
+    {
+        reply = nullptr;
+    }
+
+exit:
+    return reply;
+}
+
+static void QuitServer(DBusConnection *aConnection)
+{
+    UniqueDBusMessage message(
+        dbus_message_new_method_call(kBenchServerName, kBenchObjectPath, OTBR_BENCH_INTERFACE, "Quit"));
+    UniqueDBusMessage reply;
+
+    TEST_ASSERT(message != nullptr);
+    reply = UniqueDBusMessage(
+        dbus_connection_send_with_reply_and_block(aConnection, message.get(), kReplyTimeoutMs, nullptr));
+}
+
+static bool GetChildTable(DBusConnection *aConnection, const char *aPropertyName)
+{
+    UniqueDBusMessage      reply = CallMethod(aConnection, DBUS_INTERFACE_PROPERTIES, "Get",
+                                         std::make_tuple(std::string(OTBR_DBUS_THREAD_INTERFACE),
+                                                         std::string(aPropertyName)));
+    std::vector<ChildInfo> childTable;
+    DBusMessageIter        iter;
+
+    return reply != nullptr && dbus_message_iter_init(reply.get(), &iter) &&
+           DBusMessageExtractFromVariant(&iter, childTable) == OTBR_ERROR_NONE;
+}
+
+static void BenchmarkRawCalls(DBusConnection *aConnection, uint32_t aIterations)
+{
+    uint32_t id = 0;
+
+    RunBenchmark("method Ping", aIterations, [aConnection, &id]() {
+        UniqueDBusMessage reply =
+            CallMethod(aConnection, OTBR_BENCH_INTERFACE, "Ping", std::make_tuple(++id, std::string("Ping")));
+        uint32_t    replyId;
+        std::string replyMessage;
+        auto        args = std::tie(replyId, replyMessage);
+
+        return reply != nullptr && DBusMessageToTuple(*reply, args) == OTBR_ERROR_NONE && replyId == id;
+    });
+
+    RunBenchmark("Get ChildTable (cached)", aIterations,
+                 [aConnection]() { return GetChildTable(aConnection, OTBR_DBUS_PROPERTY_CHILD_TABLE); });
+
+    RunBenchmark("Get ChildTable (uncached)", aIterations,
+                 [aConnection]() { return GetChildTable(aConnection, OTBR_BENCH_PROPERTY_UNCACHED_CHILD_TABLE); });
+
+    RunBenchmark("GetAll", aIterations, [aConnection]() {
+        UniqueDBusMessage reply = CallMethod(aConnection, DBUS_INTERFACE_PROPERTIES, "GetAll",
+                                             std::make_tuple(std::string(OTBR_DBUS_THREAD_INTERFACE)));
+        DBusMessageIter   iter;
+
+        return reply != nullptr && dbus_message_iter_init(reply.get(), &iter) &&
+               dbus_message_iter_get_arg_type(&iter) == DBUS_TYPE_ARRAY;
+    });
+}
+
+static void BenchmarkThreadApi(DBusConnection *aConnection, uint32_t aIterations)
+{
+    ThreadApiDBus          api(aConnection, OTBR_BENCH_INTERFACE_NAME);
+    std::vector<ChildInfo> childTable;
+
+    RunBenchmark("ThreadApiDBus GetChannel", aIterations, [&api]() {
+        uint16_t channel;
+
+        return api.GetChannel(channel) == ClientError::ERROR_NONE && channel == 15;
+    });
+
+    RunBenchmark("ThreadApiDBus GetChildTable", aIterations, [&api, &childTable]() {
+        return api.GetChildTable(childTable) == ClientError::ERROR_NONE && !childTable.empty();
+    });
+
+    RunBenchmark("ThreadApiDBus ExportProperties", aIterations, [&api, &childTable]() {
+        return api.ExportProperties({OTBR_DBUS_PROPERTY_CHILD_TABLE}, childTable) == ClientError::ERROR_NONE &&
+               !childTable.empty();
+    });
+
+    RunBenchmark("ThreadApiDBus 4 x Get", aIterations, [&api]() {
+        otbr::DBus::DeviceRole role;
+        uint16_t               channel;
+        uint16_t               panId;
+        uint16_t               rloc16;
+
+        return api.GetDeviceRole(role) == ClientError::ERROR_NONE &&
+               api.GetChannel(channel) == ClientError::ERROR_NONE && api.GetPanId(panId) == ClientError::ERROR_NONE &&
+               api.GetRloc16(rloc16) == ClientError::ERROR_NONE;
+    });
+
+    RunBenchmark("ThreadApiDBus GetProperties x4", aIterations, [&api]() {
+        std::string role;
+        uint16_t    channel;
+        uint16_t    panId;
+        uint16_t    rloc16;
+
+        return api.GetProperties(std::vector<std::string>(std::begin(kSmallProperties), std::end(kSmallProperties)),
+                                 role, channel, panId, rloc16) == ClientError::ERROR_NONE;
+    });
+}
+
+/**
+ * This function keeps `kAsyncWindow` asynchronous property reads outstanding, driving the connection with select().
+ *
+ */
+static void BenchmarkAsyncGets(uint32_t aIterations)
+{
+    UniqueDBusConnection  connection = NewConnection();
+    ThreadApiDBus         api(connection.get(), OTBR_BENCH_INTERFACE_NAME);
+    std::vector<uint64_t> latencies;
+    uint32_t              sent      = 0;
+    uint32_t              completed = 0;
+    Clock::time_point     start;
+
+    TEST_ASSERT(api.AttachToEventLoop() == ClientError::ERROR_NONE);
+    latencies.reserve(aIterations);
+    start = Clock::now();
+
+    while (completed < aIterations)
+    {
+        fd_set         readFdSet;
+        fd_set         writeFdSet;
+        fd_set         errorFdSet;
+        int            maxFd   = -1;
+        struct timeval timeout = {kReplyTimeoutMs / 1000, 0};
+
+        for (; sent < aIterations && sent - completed < kAsyncWindow; sent++)
+        {
+            Clock::time_point callStart = Clock::now();
+
+            TEST_ASSERT(api.GetPropertyAsync<uint16_t>(OTBR_DBUS_PROPERTY_CHANNEL,
+                                                       [&latencies, &completed, callStart](ClientError     aError,
+                                                                                          const uint16_t &aChannel) {
+                                                           TEST_ASSERT(aError == ClientError::ERROR_NONE &&
+                                                                       aChannel == 15);
+                                                           latencies.push_back(ElapsedUs(callStart));
+                                                           completed++;
+                                                       }) == ClientError::ERROR_NONE);
+        }
+
+        FD_ZERO(&readFdSet);
+        FD_ZERO(&writeFdSet);
+        FD_ZERO(&errorFdSet);
+        api.UpdateFdSet(readFdSet, writeFdSet, errorFdSet, maxFd, timeout);
+        TEST_ASSERT(select(maxFd + 1, &readFdSet, &writeFdSet, &errorFdSet, &timeout) >= 0);
+        api.Process(readFdSet, writeFdSet, errorFdSet);
+    }
+
+    PrintResult("ThreadApiDBus async Get x16", latencies, ElapsedUs(start));
+}
+
+/**
+ * This function measures the time the server takes to emit a burst of signals nobody subscribes to.
+ *
+ * The server skips such signals when it tracks the subscribers, see `SignalSubscribers`.
+ *
+ */
+static void BenchmarkSignalsWithoutSubscribers(DBusConnection *aConnection)
+{
+    Clock::time_point start = Clock::now();
+
+    TEST_ASSERT(CallMethod(aConnection, OTBR_BENCH_INTERFACE, "EmitSignals", std::make_tuple(kSignalsPerRun)) !=
+                nullptr);
+
+    // The server handles the ping after the burst.
+    TEST_ASSERT(CallMethod(aConnection, OTBR_BENCH_INTERFACE, "Ping", std::make_tuple(0U, std::string("Ping"))) !=
+                nullptr);
+
+    printf("%-32s burst of %" PRIu32 " done in %" PRIu64 " us\n", "signals without subscribers", kSignalsPerRun,
+           ElapsedUs(start));
+}
+
+/**
+ * This function measures the time until every subscriber received all the signals of a burst, and the latency of
+ * each delivery since the burst was requested.
+ *
+ */
+static void BenchmarkSignalFanOut(DBusConnection *aConnection, uint32_t aSubscribers)
+{
+    std::vector<UniqueDBusConnection>           connections;
+    std::vector<std::unique_ptr<ThreadApiDBus>> apis;
+    std::vector<struct pollfd>                  fds;
+    std::vector<uint64_t>                       latencies;
+    uint64_t                                    received = 0;
+    uint64_t                                    expected = static_cast<uint64_t>(aSubscribers) * kSignalsPerRun;
+    uint64_t                                    elapsedUs;
+    Clock::time_point                           start;
+    char                                        name[32];
+
+    latencies.reserve(expected);
+
+    for (uint32_t i = 0; i < aSubscribers; i++)
+    {
+        struct pollfd fd;
+
+        connections.push_back(NewConnection());
+        apis.emplace_back(new ThreadApiDBus(connections.back().get(), OTBR_BENCH_INTERFACE_NAME));
+        apis.back()->AddChildTableChangedHandler(
+            [&received, &latencies, &start](uint32_t, TableEvent, const ChildInfo &) {
+                latencies.push_back(ElapsedUs(start));
+                received++;
+            });
+
+        TEST_ASSERT(dbus_connection_get_unix_fd(connections.back().get(), &fd.fd));
+        fd.events = POLLIN;
+        fds.push_back(fd);
+    }
+
+    start = Clock::now();
+    TEST_ASSERT(CallMethod(aConnection, OTBR_BENCH_INTERFACE, "EmitSignals", std::make_tuple(kSignalsPerRun)) !=
+                nullptr);
+
+    while (received < expected)
+    {
+        TEST_ASSERT(ElapsedUs(start) < kSignalTimeoutMs * 1000ULL);
+        TEST_ASSERT(poll(fds.data(), fds.size(), kSignalTimeoutMs) >= 0);
+
+        for (size_t i = 0; i < fds.size(); i++)
+        {
+            DBusConnection *connection = connections[i].get();
+
+            if (fds[i].revents == 0)
+            {
+                continue;
+            }
+
+            dbus_connection_read_write(connection, 0);
+
+            while (dbus_connection_dispatch(connection) == DBUS_DISPATCH_DATA_REMAINS)
+            {
+            }
+        }
+    }
+
+    elapsedUs = ElapsedUs(start);
+    std::sort(latencies.begin(), latencies.end());
+    snprintf(name, sizeof(name), "signal fan-out x%" PRIu32, aSubscribers);
+    printf("%-32s %7" PRIu64 " deliveries %9.0f deliveries/s   burst of %" PRIu32 " done in %" PRIu64
+           " us   delivery p50 %6" PRIu64 " us   p99 %6" PRIu64 " us\n",
+           name, received, received * 1e6 / std::max<uint64_t>(elapsedUs, 1), kSignalsPerRun, elapsedUs,
+           latencies[latencies.size() / 2], latencies[latencies.size() * 99 / 100]);
+
+    // The handlers capture `received`, drop them before the connections.
+    apis.clear();
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t             iterations = kDefaultIterations;
+    UniqueDBusConnection connection;
+    int                  opt;
+
+    while ((opt = getopt(argc, argv, "n:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'n':
+            iterations = static_cast<uint32_t>(atoi(optarg));
+            break;
+        default:
+            fprintf(stderr, "Usage: %s [-n iterations]\n", argv[0]);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    TEST_ASSERT(iterations > 0);
+    connection = NewConnection();
+
+    BenchmarkRawCalls(connection.get(), iterations);
+    BenchmarkThreadApi(connection.get(), iterations);
+    BenchmarkAsyncGets(iterations);
+
+    BenchmarkSignalsWithoutSubscribers(connection.get());
+
+    for (uint32_t subscribers : kSubscriberCounts)
+    {
+        BenchmarkSignalFanOut(connection.get(), subscribers);
+    }
+
+    QuitServer(connection.get());
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,277 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements the server side of the d-bus benchmarks.
+ *
+ * The server poses as the Thread object of otbr-agent for the interface `bench`, so that `ThreadApiDBus` can be
+ * benchmarked against it without a radio, and serves a child table of the given size.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <vector>
+
+#include "dbus/common/constants.hpp"
+#include "dbus/common/dbus_message_helper.hpp"
+#include "dbus/server/dbus_object.hpp"
+#include "dbus/server/dbus_signal_subscribers.hpp"
+
+using otbr::DBus::ChildInfo;
+using otbr::DBus::DBusMessageEncodeToVariant;
+using otbr::DBus::DBusMessageToTuple;
+using otbr::DBus::DBusObject;
+using otbr::DBus::DBusRequest;
+using otbr::DBus::SignalSubscribers;
+using std::placeholders::_1;
+
+#define OTBR_BENCH_INTERFACE_NAME "bench"
+#define OTBR_BENCH_INTERFACE "io.openthread.Bench"
+#define OTBR_BENCH_PROPERTY_UNCACHED_CHILD_TABLE "UncachedChildTable"
+
+static const uint16_t kDefaultChildCount = 256;
+
+class BenchObject : public DBusObject
+{
+public:
+    BenchObject(DBusConnection *aConnection, uint16_t aChildCount)
+        : DBusObject(aConnection, OTBR_DBUS_OBJECT_PREFIX OTBR_BENCH_INTERFACE_NAME)
+        , mEnded(false)
+        , mChildTableSequence(0)
+    {
+        for (uint16_t i = 0; i < aChildCount; i++)
+        {
+            mChildTable.push_back(MakeChild(i));
+        }
+    }
+
+    otbrError Init(void) override
+    {
+        otbrError error = DBusObject::Init();
+
+        RegisterMethod(OTBR_BENCH_INTERFACE, "Ping", std::bind(&BenchObject::PingHandler, this, _1));
+        RegisterMethod(OTBR_BENCH_INTERFACE, "EmitSignals", std::bind(&BenchObject::EmitSignalsHandler, this, _1));
+        RegisterMethod(OTBR_BENCH_INTERFACE, "Quit", std::bind(&BenchObject::QuitHandler, this, _1));
+
+        RegisterGetPropertiesMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_GET_PROPERTIES_METHOD);
+        RegisterExportPropertiesMethod(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_EXPORT_PROPERTIES_METHOD);
+        RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_DEVICE_ROLE,
+                                   std::bind(&BenchObject::GetDeviceRoleHandler, this, _1));
+        RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHANNEL,
+                                   std::bind(&BenchObject::GetChannelHandler, this, _1));
+        RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_PANID,
+                                   std::bind(&BenchObject::GetPanIdHandler, this, _1));
+        RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_RLOC16,
+                                   std::bind(&BenchObject::GetRloc16Handler, this, _1));
+        RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHILD_TABLE,
+                                   std::bind(&BenchObject::GetChildTableHandler, this, _1));
+        RegisterGetPropertyHandler(OTBR_DBUS_THREAD_INTERFACE, OTBR_BENCH_PROPERTY_UNCACHED_CHILD_TABLE,
+                                   std::bind(&BenchObject::GetChildTableHandler, this, _1));
+
+        // Same as the agent, see `DBusThreadObject::Init()`. The uncached copy measures the cost of encoding.
+        SetPropertyReplyCached(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_PROPERTY_CHILD_TABLE, std::chrono::seconds(1));
+
+        return error;
+    }
+
+    bool IsEnded(void) const { return mEnded; }
+
+private:
+    static ChildInfo MakeChild(uint16_t aIndex)
+    {
+        ChildInfo child;
+
+        child.mExtAddress         = 0x1122334455660000ULL | aIndex;
+        child.mTimeout            = 240;
+        child.mAge                = aIndex % 240;
+        child.mRloc16             = 0x0400 | (aIndex & 0x1ff);
+        child.mChildId            = aIndex & 0x1ff;
+        child.mNetworkDataVersion = 1;
+        child.mLinkQualityIn      = 3;
+        child.mAverageRssi        = -40 - (aIndex % 50);
+        child.mLastRssi           = -40 - (aIndex % 50);
+        child.mFrameErrorRate     = 0;
+        child.mMessageErrorRate   = 0;
+        child.mRxOnWhenIdle       = (aIndex % 2) == 0;
+        child.mFullThreadDevice   = false;
+        child.mFullNetworkData    = true;
+        child.mIsStateRestoring   = false;
+
+        return child;
+    }
+
+    otError GetDeviceRoleHandler(DBusMessageIter &aIter)
+    {
+        return DBusMessageEncodeToVariant(&aIter, std::string("leader")) == OTBR_ERROR_NONE ? OT_ERROR_NONE
+                                                                                           : OT_ERROR_INVALID_ARGS;
+    }
+
+    otError GetChannelHandler(DBusMessageIter &aIter)
+    {
+        return DBusMessageEncodeToVariant(&aIter, static_cast<uint16_t>(15)) == OTBR_ERROR_NONE ? OT_ERROR_NONE
+                                                                                              : OT_ERROR_INVALID_ARGS;
+    }
+
+    otError GetPanIdHandler(DBusMessageIter &aIter)
+    {
+        return DBusMessageEncodeToVariant(&aIter, static_cast<uint16_t>(0x1234)) == OTBR_ERROR_NONE
+                   ? OT_ERROR_NONE
+                   : OT_ERROR_INVALID_ARGS;
+    }
+
+    otError GetRloc16Handler(DBusMessageIter &aIter)
+    {
+        return DBusMessageEncodeToVariant(&aIter, static_cast<uint16_t>(0xfc00)) == OTBR_ERROR_NONE
+                   ? OT_ERROR_NONE
+                   : OT_ERROR_INVALID_ARGS;
+    }
+
+    otError GetChildTableHandler(DBusMessageIter &aIter)
+    {
+        return DBusMessageEncodeToVariant(&aIter, mChildTable) == OTBR_ERROR_NONE ? OT_ERROR_NONE
+                                                                                 : OT_ERROR_INVALID_ARGS;
+    }
+
+    void PingHandler(DBusRequest &aRequest)
+    {
+        uint32_t    id;
+        std::string pingMessage;
+        auto        args = std::tie(id, pingMessage);
+
+        if (DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE)
+        {
+            aRequest.Reply(std::make_tuple(id, pingMessage));
+        }
+        else
+        {
+            aRequest.ReplyOtResult(OT_ERROR_INVALID_ARGS);
+        }
+    }
+
+    void EmitSignalsHandler(DBusRequest &aRequest)
+    {
+        uint32_t count;
+        auto     args  = std::tie(count);
+        otError  error = OT_ERROR_NONE;
+
+        VerifyOrExit(DBusMessageToTuple(*aRequest.GetMessage(), args) == OTBR_ERROR_NONE,
+                     error = OT_ERROR_INVALID_ARGS);
+        VerifyOrExit(!mChildTable.empty(), error = OT_ERROR_INVALID_STATE);
+
+        // Reply first, the client measures the time until the last signal is received by every subscriber.
+        aRequest.ReplyOtResult(OT_ERROR_NONE);
+
+        for (uint32_t i = 0; i < count; i++)
+        {
+            Signal(OTBR_DBUS_THREAD_INTERFACE, OTBR_DBUS_CHILD_TABLE_CHANGED_SIGNAL,
+                   std::make_tuple(++mChildTableSequence, std::string(OTBR_TABLE_EVENT_NAME_ADDED),
+                                   mChildTable[i % mChildTable.size()]));
+        }
+
+    exit:
+        if (error != OT_ERROR_NONE)
+        {
+            aRequest.ReplyOtResult(error);
+        }
+    }
+
+    void QuitHandler(DBusRequest &aRequest)
+    {
+        aRequest.ReplyOtResult(OT_ERROR_NONE);
+        mEnded = true;
+    }
+
+    bool                   mEnded;
+    uint32_t               mChildTableSequence;
+    std::vector<ChildInfo> mChildTable;
+};
+
+int main(int argc, char *argv[])
+{
+    int             ret        = EXIT_SUCCESS;
+    uint16_t        childCount = kDefaultChildCount;
+    DBusConnection *connection = nullptr;
+    int             requestReply;
+    int             opt;
+    DBusError       dbusErr;
+
+    dbus_error_init(&dbusErr);
+
+    while ((opt = getopt(argc, argv, "c:")) != -1)
+    {
+        switch (opt)
+        {
+        case 'c':
+            childCount = static_cast<uint16_t>(atoi(optarg));
+            break;
+        default:
+            fprintf(stderr, "Usage: %s [-c child-count]\n", argv[0]);
+            ExitNow(ret = EXIT_FAILURE);
+        }
+    }
+
+    connection = dbus_bus_get(DBUS_BUS_SYSTEM, &dbusErr);
+    VerifyOrExit(connection != nullptr, ret = EXIT_FAILURE);
+    dbus_bus_register(connection, &dbusErr);
+
+    requestReply = dbus_bus_request_name(connection, OTBR_DBUS_SERVER_PREFIX OTBR_BENCH_INTERFACE_NAME,
+                                         DBUS_NAME_FLAG_REPLACE_EXISTING, &dbusErr);
+    VerifyOrExit(requestReply == DBUS_REQUEST_NAME_REPLY_PRIMARY_OWNER ||
+                     requestReply == DBUS_REQUEST_NAME_REPLY_ALREADY_OWNER,
+                 ret = EXIT_FAILURE);
+
+    {
+        SignalSubscribers subscribers;
+        BenchObject       s(connection, childCount);
+
+        // Same as the agent, it needs root to monitor the bus and sends every signal otherwise. The monitor is
+        // read whenever a signal seems to have no subscriber, so the loop below does not need to poll it.
+        subscribers.Start(*connection, OTBR_DBUS_SERVER_PREFIX OTBR_BENCH_INTERFACE_NAME);
+        s.SetSignalSubscribers(&subscribers);
+        VerifyOrExit(s.Init() == OTBR_ERROR_NONE, ret = EXIT_FAILURE);
+
+        while (!s.IsEnded())
+        {
+            dbus_connection_read_write_dispatch(connection, -1);
+        }
+
+        dbus_connection_flush(connection);
+    }
+
+exit:
+    dbus_error_free(&dbusErr);
+    if (connection != nullptr)
+    {
+        dbus_connection_unref(connection);
+    }
+    return ret;
+}
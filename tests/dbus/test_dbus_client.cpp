@@ -170,10 +170,83 @@ int main()
                             printf("childTable size %zu\n", childTable.size());
                             TEST_ASSERT(neighborTable.size() == 1);
                             TEST_ASSERT(childTable.size() == 1);
+                            {
+                                uint32_t childTableSequence;
+                                uint32_t neighborTableSequence;
+
+                                // The child has been added to both tables.
+                                TEST_ASSERT(api->GetChildTableSequence(childTableSequence) == OTBR_ERROR_NONE);
+                                TEST_ASSERT(api->GetNeighborTableSequence(neighborTableSequence) == OTBR_ERROR_NONE);
+                                TEST_ASSERT(childTableSequence >= 1);
+                                TEST_ASSERT(neighborTableSequence >= 1);
+                            }
                             TEST_ASSERT(api->GetPartitionId(partitionId) == OTBR_ERROR_NONE);
                             TEST_ASSERT(api->GetInstantRssi(rssi) == OTBR_ERROR_NONE);
                             TEST_ASSERT(api->GetRadioTxPower(txPower) == OTBR_ERROR_NONE);
                             TEST_ASSERT(api->GetActiveDatasetTlvs(activeDataset) == OTBR_ERROR_NONE);
+                            {
+                                std::vector<std::string>           names = {OTBR_DBUS_PROPERTY_CHANNEL,
+                                                                  OTBR_DBUS_PROPERTY_NETWORK_NAME,
+                                                                  OTBR_DBUS_PROPERTY_RLOC16,
+                                                                  OTBR_DBUS_PROPERTY_CHILD_TABLE};
+                                uint16_t                           batchChannel;
+                                std::string                        batchName;
+                                uint16_t                           batchRloc16;
+                                std::vector<otbr::DBus::ChildInfo> batchChildTable;
+
+                                TEST_ASSERT(api->GetProperties(names, batchChannel, batchName, batchRloc16,
+                                                               batchChildTable) == OTBR_ERROR_NONE);
+                                TEST_ASSERT(batchChannel == channelResult);
+                                TEST_ASSERT(batchName == name);
+                                TEST_ASSERT(batchRloc16 == rloc16);
+                                TEST_ASSERT(batchChildTable.size() == childTable.size());
+                                TEST_ASSERT(api->GetProperties({OTBR_DBUS_PROPERTY_CHANNEL, "NoSuchProperty"},
+                                                               batchChannel, batchName) != OTBR_ERROR_NONE);
+                            }
+                            {
+                                std::string                               version;
+                                uint64_t                                  eui64;
+                                std::array<uint8_t, OTBR_IP6_PREFIX_SIZE> meshLocalPrefix;
+
+                                TEST_ASSERT(api->GetProperties({OTBR_DBUS_PROPERTY_VERSION, OTBR_DBUS_PROPERTY_EUI64,
+                                                                OTBR_DBUS_PROPERTY_MESH_LOCAL_PREFIX},
+                                                               version, eui64, meshLocalPrefix) == OTBR_ERROR_NONE);
+                                TEST_ASSERT(!version.empty());
+                            }
+                            {
+                                std::vector<std::string>              names = {OTBR_DBUS_PROPERTY_CHILD_TABLE,
+                                                                  OTBR_DBUS_PROPERTY_NEIGHBOR_TABLE_PROEPRTY};
+                                std::vector<otbr::DBus::ChildInfo>    exportedChildTable;
+                                std::vector<otbr::DBus::NeighborInfo> exportedNeighborTable;
+
+                                TEST_ASSERT(api->ExportProperties(names, exportedChildTable, exportedNeighborTable) ==
+                                            OTBR_ERROR_NONE);
+                                TEST_ASSERT(exportedChildTable.size() == childTable.size());
+                                TEST_ASSERT(exportedNeighborTable.size() == neighborTable.size());
+                            }
+                            {
+                                uint16_t    cachedChannel;
+                                std::string cachedName;
+
+                                TEST_ASSERT(api->SetPropertyCacheEnabled(true) == OTBR_ERROR_NONE);
+                                TEST_ASSERT(api->GetChannel(cachedChannel) == OTBR_ERROR_NONE);
+                                TEST_ASSERT(api->GetNetworkName(cachedName) == OTBR_ERROR_NONE);
+                                TEST_ASSERT(cachedChannel == channelResult);
+                                TEST_ASSERT(cachedName == name);
+                                TEST_ASSERT(api->SetPropertyCacheEnabled(false) == OTBR_ERROR_NONE);
+                            }
+                            TEST_ASSERT(api->GetPropertyAsync<uint16_t>(
+                                            OTBR_DBUS_PROPERTY_CHANNEL,
+                                            [channelResult](ClientError aErr, const uint16_t &aChannel) {
+                                                TEST_ASSERT(aErr == ClientError::ERROR_NONE);
+                                                TEST_ASSERT(aChannel == channelResult);
+                                            }) == OTBR_ERROR_NONE);
+                            TEST_ASSERT(api->GetPropertyAsync<std::string>(
+                                            OTBR_DBUS_PROPERTY_NETWORK_NAME,
+                                            [name](ClientError aErr, const std::string &aName) {
+                                                TEST_ASSERT(aErr == ClientError::ERROR_NONE);
+                                                TEST_ASSERT(aName == name);
+                                            }) == OTBR_ERROR_NONE);
                             api->FactoryReset(nullptr);
                             TEST_ASSERT(api->GetNetworkName(name) == OTBR_ERROR_NONE);
                             TEST_ASSERT(rloc16 != 0xffff);
@@ -0,0 +1,270 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a scale benchmark of the mDNS publisher.
+ *
+ *   The benchmark publishes N hosts with M services each, then restarts the publisher the way a daemon restart
+ *   does, and reports the time until everything is published, the time until everything is published again, and
+ *   the growth of the resident memory. It exits with a non-zero status if not everything is published in time.
+ */
+
+#include <chrono>
+#include <string>
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <netinet/in.h>
+
+#include "common/code_utils.hpp"
+#include "common/logging.hpp"
+#include "common/metrics.hpp"
+#include "mdns/mdns.hpp"
+
+using namespace otbr;
+
+typedef std::chrono::steady_clock Clock;
+
+static const char kServiceType[] = "_scale._udp.";
+static const int  kMaxHosts      = 2000;
+
+static struct Context
+{
+    Mdns::Publisher *mPublisher;
+    int              mHosts;
+    int              mServices;
+    bool             mCustomHosts;
+} sContext;
+
+static long GetRssKib(void)
+{
+    long  rss  = -1;
+    FILE *file = fopen("/proc/self/status", "r");
+    char  line[128];
+
+    VerifyOrExit(file != nullptr);
+
+    while (fgets(line, sizeof(line), file) != nullptr)
+    {
+        if (sscanf(line, "VmRSS: %ld kB", &rss) == 1)
+        {
+            break;
+        }
+    }
+
+    fclose(file);
+
+exit:
+    return rss;
+}
+
+static uint64_t GetPublishedCount(void)
+{
+    return Metrics::Get().GetCounter(Metrics::kCounterMdnsPublishSuccess);
+}
+
+static uint64_t GetFailedCount(void)
+{
+    return Metrics::Get().GetCounter(Metrics::kCounterMdnsPublishFailure);
+}
+
+static void PublishAll(void *aContext, Mdns::Publisher::State aState)
+{
+    Mdns::Publisher &publisher = *sContext.mPublisher;
+
+    VerifyOrDie(aContext == &sContext, "unexpected context");
+    VerifyOrExit(aState == Mdns::Publisher::State::kReady);
+
+    publisher.BeginBatch();
+
+    for (int host = 0; host < sContext.mHosts; host++)
+    {
+        std::string hostName        = "scale-host-" + std::to_string(host);
+        uint8_t     hostAddress[16] = {0x20, 0x01, 0x0d, 0xb8};
+
+        hostAddress[14] = static_cast<uint8_t>(host >> 8);
+        hostAddress[15] = static_cast<uint8_t>(host);
+
+        if (sContext.mCustomHosts)
+        {
+            SuccessOrDie(publisher.PublishHost(hostName.c_str(), hostAddress, sizeof(hostAddress)),
+                         "cannot publish the host");
+        }
+
+        for (int service = 0; service < sContext.mServices; service++)
+        {
+            std::string serviceName = "scale-service-" + std::to_string(host) + "-" + std::to_string(service);
+            Mdns::Publisher::TxtList txtList{{"id", serviceName.c_str()}};
+
+            SuccessOrDie(publisher.PublishService(sContext.mCustomHosts ? hostName.c_str() : nullptr,
+                                                  static_cast<uint16_t>(10000 + service), serviceName.c_str(),
+                                                  kServiceType, txtList),
+                         "cannot publish the service");
+        }
+    }
+
+    SuccessOrDie(publisher.CommitBatch(), "cannot commit the services");
+
+exit:
+    return;
+}
+
+// Runs the mainloop until @p aExpected records are published since @p aBase, or until @p aDeadline.
+static bool WaitPublished(uint64_t aBase, uint64_t aExpected, Clock::time_point aDeadline)
+{
+    Mdns::Publisher &publisher = *sContext.mPublisher;
+
+    while (GetPublishedCount() - aBase < aExpected)
+    {
+        fd_set            readFdSet;
+        fd_set            writeFdSet;
+        fd_set            errorFdSet;
+        int               maxFd   = -1;
+        struct timeval    timeout = {INT_MAX, INT_MAX};
+        Clock::time_point now     = Clock::now();
+        long              remainingUs;
+        int               rval;
+
+        VerifyOrExit(now < aDeadline);
+        remainingUs = std::chrono::duration_cast<std::chrono::microseconds>(aDeadline - now).count();
+
+        FD_ZERO(&readFdSet);
+        FD_ZERO(&writeFdSet);
+        FD_ZERO(&errorFdSet);
+
+        publisher.UpdateFdSet(readFdSet, writeFdSet, errorFdSet, maxFd, timeout);
+
+        if (timeout.tv_sec == INT_MAX || timeout.tv_sec * 1000000L + timeout.tv_usec > remainingUs)
+        {
+            timeout.tv_sec  = remainingUs / 1000000L;
+            timeout.tv_usec = remainingUs % 1000000L;
+        }
+
+        rval = select(maxFd + 1, &readFdSet, &writeFdSet, &errorFdSet, &timeout);
+
+        if (rval < 0)
+        {
+            perror("select");
+            ExitNow();
+        }
+
+        publisher.Process(readFdSet, writeFdSet, errorFdSet);
+    }
+
+exit:
+    return GetPublishedCount() - aBase >= aExpected;
+}
+
+static long ToMilliseconds(Clock::duration aDuration)
+{
+    return static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(aDuration).count());
+}
+
+int main(int argc, char *argv[])
+{
+    int               ret      = EXIT_FAILURE;
+    Mdns::Publisher * pub      = nullptr;
+    int               timeoutS = 120;
+    uint64_t          expected;
+    uint64_t          base;
+    long              rssBefore;
+    long              rssAfter;
+    Clock::time_point start;
+    long              publishMs;
+    long              republishMs;
+
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: %s <hosts> <services-per-host> [timeout-seconds]\n", argv[0]);
+        ExitNow();
+    }
+
+    sContext.mHosts    = atoi(argv[1]);
+    sContext.mServices = atoi(argv[2]);
+    timeoutS           = (argc > 3) ? atoi(argv[3]) : timeoutS;
+    VerifyOrExit(sContext.mHosts > 0 && sContext.mHosts <= kMaxHosts && sContext.mServices >= 0 && timeoutS > 0,
+                 fprintf(stderr, "invalid arguments, at most %d hosts are supported\n", kMaxHosts));
+
+#if OTBR_ENABLE_MDNS_AVAHI
+    // The avahi publisher does not support custom hosts, all services are published on the local host.
+    sContext.mCustomHosts = false;
+#else
+    sContext.mCustomHosts = true;
+#endif
+
+    otbrLogInit("otbr-mdns-scale", OTBR_LOG_WARNING, true);
+
+    expected  = static_cast<uint64_t>(sContext.mHosts) * static_cast<uint64_t>(sContext.mServices);
+    expected += sContext.mCustomHosts ? static_cast<uint64_t>(sContext.mHosts) : 0;
+    rssBefore = GetRssKib();
+
+    pub                 = Mdns::Publisher::Create(AF_UNSPEC, /* aDomain */ nullptr, PublishAll, &sContext);
+    sContext.mPublisher = pub;
+
+    start = Clock::now();
+    base  = GetPublishedCount();
+    SuccessOrExit(pub->Start());
+    VerifyOrExit(WaitPublished(base, expected, start + std::chrono::seconds(timeoutS)),
+                 fprintf(stderr, "published %llu of %llu records in time\n",
+                         static_cast<unsigned long long>(GetPublishedCount() - base),
+                         static_cast<unsigned long long>(expected)));
+    publishMs = ToMilliseconds(Clock::now() - start);
+    rssAfter  = GetRssKib();
+
+    // Simulate a daemon restart, everything is published again once the publisher is ready.
+    pub->Stop();
+    start = Clock::now();
+    base  = GetPublishedCount();
+    SuccessOrExit(pub->Start());
+    VerifyOrExit(WaitPublished(base, expected, start + std::chrono::seconds(timeoutS)),
+                 fprintf(stderr, "republished %llu of %llu records in time\n",
+                         static_cast<unsigned long long>(GetPublishedCount() - base),
+                         static_cast<unsigned long long>(expected)));
+    republishMs = ToMilliseconds(Clock::now() - start);
+
+    VerifyOrExit(GetFailedCount() == 0, fprintf(stderr, "%llu records failed to publish\n",
+                                                 static_cast<unsigned long long>(GetFailedCount())));
+
+    printf("hosts=%d services_per_host=%d records=%llu publish_ms=%ld republish_ms=%ld rss_growth_kib=%ld\n",
+           sContext.mHosts, sContext.mServices, static_cast<unsigned long long>(expected), publishMs, republishMs,
+           (rssBefore >= 0 && rssAfter >= 0) ? rssAfter - rssBefore : -1);
+
+    ret = EXIT_SUCCESS;
+
+exit:
+    if (pub != nullptr)
+    {
+        Mdns::Publisher::Destroy(pub);
+    }
+
+    return ret;
+}
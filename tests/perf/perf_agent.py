@@ -0,0 +1,483 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2021, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+"""End-to-end performance test of otbr-agent with a simulated RCP.
+
+otbr-agent is started on a simulated RCP and forms a network, which simulated FTD nodes then join. The test drives
+the REST API, the D-Bus API and SRP registrations of the nodes while the REST API is kept busy, and reports:
+
+    startup_ms              from starting otbr-agent to the REST server answering
+    attach_ms               from `thread start` to otbr-agent becoming leader
+    join_ms                 from the nodes starting Thread to all of them being attached
+    rest_<endpoint>_p50_ms  latency percentiles of REST requests, also _p99_ms
+    dbus_p50_ms             latency percentiles of D-Bus property reads, also dbus_p99_ms
+    srp_p50_ms              from a node starting its SRP client to the advertising proxy reporting the host
+                            published, also srp_p99_ms
+    mdns_publish_mean_ms    mean mDNS publication time reported by otbr-agent
+    peak_rss_kb             peak resident set size of otbr-agent
+
+All values are lower-is-better. When a baseline is given, the run fails if a value exceeds its baseline by more than
+the allowed ratio. A baseline is a JSON object mapping each value to its baseline, as written by --save-baseline.
+
+The D-Bus latency includes starting dbus-send, the SRP latency includes the client finding the server in the network
+data and the mDNS latency depends on the mDNS daemon, so their baselines are only meant to catch large regressions.
+"""
+
+import argparse
+import http.client
+import json
+import math
+import os
+import pty
+import select
+import shutil
+import subprocess
+import tempfile
+import threading
+import time
+
+rest_api_host = "127.0.0.1"
+rest_api_port = 8081
+
+rest_endpoints = [
+    "/node",
+    "/node/state",
+    "/node/rloc16",
+    "/diagnostics",
+]
+
+dbus_conf_path = "/etc/dbus-1/system.d/otbr-perf-agent.conf"
+
+dbus_get_role = [
+    "dbus-send",
+    "--system",
+    "--print-reply",
+    "--dest=io.openthread.BorderRouter.wpan0",
+    "/io/openthread/BorderRouter/wpan0",
+    "org.freedesktop.DBus.Properties.Get",
+    "string:io.openthread.BorderRouter",
+    "string:DeviceRole",
+]
+
+
+def percentile(samples, ratio):
+    return samples[min(len(samples) - 1, int(math.ceil(len(samples) * ratio)) - 1)]
+
+
+def milliseconds(seconds):
+    return round(seconds * 1000, 2)
+
+
+def wait_for(predicate, timeout, what):
+    deadline = time.monotonic() + timeout
+
+    while not predicate():
+        if time.monotonic() > deadline:
+            raise TimeoutError("timed out waiting for {}".format(what))
+
+        time.sleep(0.05)
+
+
+def http_get(connection, path):
+    connection.request("GET", path)
+    response = connection.getresponse()
+    body = response.read()
+
+    return response.status, body
+
+
+class Agent:
+    """An otbr-agent process on a simulated RCP, driven with ot-ctl."""
+
+    def __init__(self, agent, ot_ctl, workdir):
+        self.ot_ctl_path = ot_ctl
+        radio_url = "spinel+hdlc+forkpty://{}?forkpty-arg=1".format(shutil.which("ot-rcp"))
+        self.process = subprocess.Popen([
+            agent, "-d", "6", "-I", "wpan0", "--rest-snapshot-file",
+            os.path.join(workdir, "rest-snapshot"), "--srp-state-file",
+            os.path.join(workdir, "srp-state"), radio_url
+        ],
+                                        cwd=workdir)
+        self.started = time.monotonic()
+
+    def ot_ctl(self, *args):
+        output = subprocess.run([self.ot_ctl_path] + list(args),
+                                check=True,
+                                stdout=subprocess.PIPE,
+                                universal_newlines=True,
+                                timeout=10).stdout
+        lines = [line.strip() for line in output.splitlines() if line.strip()]
+
+        if not lines or lines[-1] != "Done":
+            raise RuntimeError("ot-ctl {}: {}".format(" ".join(args), output))
+
+        return lines[:-1]
+
+    def state(self):
+        try:
+            return self.ot_ctl("state")[0]
+        except (subprocess.SubprocessError, RuntimeError, IndexError):
+            return None
+
+    def peak_rss_kb(self):
+        with open("/proc/{}/status".format(self.process.pid)) as f:
+            for line in f:
+                if line.startswith("VmHWM:"):
+                    return int(line.split()[1])
+
+        return None
+
+    def stop(self):
+        self.process.terminate()
+
+        try:
+            self.process.wait(10)
+        except subprocess.TimeoutExpired:
+            self.process.kill()
+            self.process.wait()
+
+
+class Node:
+    """A simulated FTD driven through its CLI on a pty."""
+
+    def __init__(self, node_id, workdir):
+        self.master, slave = pty.openpty()
+        self.buffer = b""
+        self.process = subprocess.Popen(["ot-cli-ftd", str(node_id)],
+                                        stdin=slave,
+                                        stdout=slave,
+                                        stderr=subprocess.DEVNULL,
+                                        cwd=workdir)
+        os.close(slave)
+
+    def read_line(self, deadline):
+        while b"\n" not in self.buffer:
+            remaining = deadline - time.monotonic()
+
+            if remaining <= 0:
+                raise TimeoutError()
+
+            readable, _, _ = select.select([self.master], [], [], remaining)
+
+            if readable:
+                self.buffer += os.read(self.master, 4096)
+
+        line, self.buffer = self.buffer.split(b"\n", 1)
+
+        return line.decode(errors="replace").strip().lstrip(">").strip()
+
+    def command(self, command, timeout=10):
+        os.write(self.master, (command + "\r\n").encode())
+        deadline = time.monotonic() + timeout
+        output = []
+
+        while True:
+            try:
+                line = self.read_line(deadline)
+            except TimeoutError:
+                raise TimeoutError("{}: no answer".format(command))
+
+            if line == "Done":
+                return output
+
+            if line.startswith("Error"):
+                raise RuntimeError("{}: {}".format(command, line))
+
+            # Skip the echo of the command.
+            if line and line != command:
+                output.append(line)
+
+    def state(self):
+        return self.command("state")[0]
+
+    def stop(self):
+        self.process.terminate()
+        self.process.wait()
+        os.close(self.master)
+
+
+class RestLoad(threading.Thread):
+    """Keeps the REST server of otbr-agent busy until stopped."""
+
+    def __init__(self):
+        super().__init__(daemon=True)
+        self.stopped = threading.Event()
+
+    def run(self):
+        connection = http.client.HTTPConnection(rest_api_host, rest_api_port, timeout=30)
+
+        while not self.stopped.is_set():
+            for endpoint in rest_endpoints:
+                try:
+                    http_get(connection, endpoint)
+                except (OSError, http.client.HTTPException):
+                    connection.close()
+
+        connection.close()
+
+    def stop(self):
+        self.stopped.set()
+        self.join()
+
+
+def read_metric(connection, name, labels=None):
+    _, body = http_get(connection, "/metrics")
+    series = name + ("{" + labels + "}" if labels else "")
+
+    for line in body.decode().splitlines():
+        if line.startswith(series + " "):
+            return float(line.split()[-1])
+
+    return 0
+
+
+def measure_startup(agent):
+    connection = http.client.HTTPConnection(rest_api_host, rest_api_port, timeout=1)
+
+    def answered():
+        try:
+            return http_get(connection, "/node/state")[0] == 200
+        except (OSError, http.client.HTTPException):
+            connection.close()
+            return False
+
+    wait_for(answered, 30, "the REST server")
+    connection.close()
+
+    return time.monotonic() - agent.started
+
+
+def measure_attach(agent):
+    agent.ot_ctl("dataset", "init", "new")
+    agent.ot_ctl("dataset", "commit", "active")
+    agent.ot_ctl("ifconfig", "up")
+
+    start = time.monotonic()
+    agent.ot_ctl("thread", "start")
+    wait_for(lambda: agent.state() == "leader", 30, "otbr-agent to become leader")
+
+    return time.monotonic() - start
+
+
+def measure_join(agent, nodes):
+    dataset = agent.ot_ctl("dataset", "active", "-x")[0]
+
+    for node in nodes:
+        node.command("dataset set active " + dataset)
+        node.command("ifconfig up")
+
+    start = time.monotonic()
+
+    for node in nodes:
+        node.command("thread start")
+
+    wait_for(lambda: all(node.state() in ("child", "router") for node in nodes), 120, "the nodes to attach")
+
+    return time.monotonic() - start
+
+
+def measure_rest(count):
+    connection = http.client.HTTPConnection(rest_api_host, rest_api_port, timeout=30)
+    latencies = {}
+
+    for endpoint in rest_endpoints:
+        samples = []
+
+        for _ in range(count):
+            start = time.monotonic()
+            status, _ = http_get(connection, endpoint)
+
+            if status != 200:
+                raise RuntimeError("{}: status {}".format(endpoint, status))
+
+            samples.append(time.monotonic() - start)
+
+        latencies[endpoint] = sorted(samples)
+
+    connection.close()
+
+    return latencies
+
+
+def measure_dbus(count):
+    samples = []
+
+    for _ in range(count):
+        start = time.monotonic()
+        subprocess.run(dbus_get_role, check=True, stdout=subprocess.DEVNULL, timeout=10)
+        samples.append(time.monotonic() - start)
+
+    return sorted(samples)
+
+
+def measure_srp(nodes):
+    connection = http.client.HTTPConnection(rest_api_host, rest_api_port, timeout=30)
+    samples = []
+
+    # Nodes register one after the other so that each new success is the node being measured.
+    for index, node in enumerate(nodes):
+        name = "perf-node-{}".format(index)
+        node.command("srp client host name " + name)
+        node.command("srp client host address " + node.command("ipaddr mleid")[0])
+        node.command("srp client service add {} _perf._udp 12345".format(name))
+
+        published = read_metric(connection, "otbr_srp_update_results_total", 'result="success"')
+        start = time.monotonic()
+        node.command("srp client autostart enable")
+        wait_for(lambda: read_metric(connection, "otbr_srp_update_results_total", 'result="success"') > published,
+                 30, "{} to be published".format(name))
+        samples.append(time.monotonic() - start)
+
+    connection.close()
+
+    return sorted(samples)
+
+
+def read_mdns_publish_mean():
+    connection = http.client.HTTPConnection(rest_api_host, rest_api_port, timeout=30)
+    total = read_metric(connection, "otbr_mdns_publish_duration_milliseconds_sum")
+    count = read_metric(connection, "otbr_mdns_publish_duration_milliseconds_count")
+    connection.close()
+
+    return total / count if count > 0 else None
+
+
+def add_percentiles(results, prefix, samples):
+    results[prefix + "_p50_ms"] = milliseconds(percentile(samples, 0.5))
+    results[prefix + "_p99_ms"] = milliseconds(percentile(samples, 0.99))
+
+
+def run(args, workdir):
+    results = {}
+    agent = Agent(args.agent, args.ot_ctl, workdir)
+    nodes = []
+
+    try:
+        results["startup_ms"] = milliseconds(measure_startup(agent))
+        results["attach_ms"] = milliseconds(measure_attach(agent))
+
+        nodes = [Node(node_id, workdir) for node_id in range(2, 2 + args.nodes)]
+        results["join_ms"] = milliseconds(measure_join(agent, nodes))
+
+        for endpoint, samples in measure_rest(args.requests).items():
+            add_percentiles(results, "rest_" + endpoint.strip("/").replace("/", "_").replace("-", "_"), samples)
+
+        load = RestLoad()
+        load.start()
+
+        try:
+            if args.dbus:
+                add_percentiles(results, "dbus", measure_dbus(args.requests))
+
+            if args.srp:
+                add_percentiles(results, "srp", measure_srp(nodes))
+        finally:
+            load.stop()
+
+        if args.srp:
+            mean = read_mdns_publish_mean()
+
+            if mean is not None:
+                results["mdns_publish_mean_ms"] = round(mean, 2)
+
+        results["peak_rss_kb"] = agent.peak_rss_kb()
+    finally:
+        for node in nodes:
+            node.stop()
+
+        agent.stop()
+
+    return results
+
+
+def check_regressions(results, baseline, max_regression):
+    regressed = False
+
+    for name, value in sorted(results.items()):
+        if name not in baseline:
+            continue
+
+        limit = baseline[name] * (1 + max_regression)
+
+        if value > limit:
+            print("{}: {} is above {:.2f} ({} in baseline, {:.0%} allowed regression)".format(
+                name, value, limit, baseline[name], max_regression))
+            regressed = True
+
+    return not regressed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--agent", required=True, help="path of otbr-agent")
+    parser.add_argument("--ot-ctl", required=True, help="path of ot-ctl")
+    parser.add_argument("--dbus-conf", help="D-Bus policy of otbr-agent, installed for the run when --dbus is given")
+    parser.add_argument("--nodes", type=int, default=8, help="number of simulated nodes joining the network")
+    parser.add_argument("--requests", type=int, default=200, help="number of requests per REST endpoint and D-Bus")
+    parser.add_argument("--dbus", action="store_true", help="measure the D-Bus API")
+    parser.add_argument("--srp", action="store_true", help="measure SRP registrations through the advertising proxy")
+    parser.add_argument("--baseline", help="baseline file to compare the results with")
+    parser.add_argument("--max-regression",
+                        type=float,
+                        default=0.5,
+                        help="allowed regression against the baseline, as a ratio (default: 0.5)")
+    parser.add_argument("--save-baseline", help="write the results to this file")
+    args = parser.parse_args()
+
+    if args.dbus and args.dbus_conf:
+        shutil.copy(args.dbus_conf, dbus_conf_path)
+        subprocess.run(["service", "dbus", "reload"], check=True)
+
+    workdir = tempfile.mkdtemp(prefix="otbr-perf-")
+
+    try:
+        results = run(args, workdir)
+    finally:
+        shutil.rmtree(workdir, ignore_errors=True)
+
+        if args.dbus and args.dbus_conf:
+            os.remove(dbus_conf_path)
+
+    for name, value in sorted(results.items()):
+        print("{:<32} {:>12}".format(name, value))
+
+    if args.save_baseline:
+        with open(args.save_baseline, "w") as f:
+            json.dump(results, f, indent=4, sort_keys=True)
+            f.write("\n")
+
+    if args.baseline:
+        with open(args.baseline) as f:
+            if not check_regressions(results, json.load(f), args.max_regression):
+                return 1
+
+    return 0
+
+
+if __name__ == '__main__':
+    exit(main())
@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+#
+#  Copyright (c) 2020, The OpenThread Authors.
+#  All rights reserved.
+#
+#  Redistribution and use in source and binary forms, with or without
+#  modification, are permitted provided that the following conditions are met:
+#  1. Redistributions of source code must retain the above copyright
+#     notice, this list of conditions and the following disclaimer.
+#  2. Redistributions in binary form must reproduce the above copyright
+#     notice, this list of conditions and the following disclaimer in the
+#     documentation and/or other materials provided with the distribution.
+#  3. Neither the name of the copyright holder nor the
+#     names of its contributors may be used to endorse or promote products
+#     derived from this software without specific prior written permission.
+#
+#  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+#  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+#  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+#  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+#  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+#  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+#  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+#  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+#  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+#  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+#  POSSIBILITY OF SUCH DAMAGE.
+#
+"""Load test and latency benchmark of the otbr REST server.
+
+The endpoints are measured one after the other. For each endpoint, every worker process keeps its own connection
+and sends requests back to back for the given duration. The requests/sec and latency percentiles of each endpoint
+are reported and, when a baseline is given, the run fails if the throughput of an endpoint regressed by more than
+the allowed ratio.
+
+A baseline is a JSON object mapping each endpoint to its requests/sec, as written by --save-baseline.
+"""
+
+import argparse
+import http.client
+import json
+import math
+import multiprocessing
+import os
+import sys
+import time
+
+rest_api_host = "0.0.0.0"
+rest_api_port = 8081
+
+default_endpoints = [
+    "/node",
+    "/node/state",
+    "/node/rloc16",
+    "/node/leader-data",
+    "/node/network-name",
+    "/diagnostics",
+]
+
+
+def run_worker(args):
+    endpoint, duration, keep_alive = args
+    latencies = []
+    errors = 0
+    connection = http.client.HTTPConnection(rest_api_host, rest_api_port, timeout=30)
+    headers = {} if keep_alive else {"Connection": "close"}
+    deadline = time.monotonic() + duration
+
+    while time.monotonic() < deadline:
+        start = time.monotonic()
+
+        try:
+            connection.request("GET", endpoint, headers=headers)
+            response = connection.getresponse()
+            response.read()
+
+            if response.status != 200:
+                errors += 1
+                continue
+
+        except (OSError, http.client.HTTPException):
+            errors += 1
+            connection.close()
+            continue
+
+        latencies.append(time.monotonic() - start)
+
+        if not keep_alive:
+            connection.close()
+
+    connection.close()
+
+    return latencies, errors
+
+
+def percentile(samples, ratio):
+    return samples[min(len(samples) - 1, int(math.ceil(len(samples) * ratio)) - 1)]
+
+
+def report(endpoint, samples, errors, elapsed):
+    samples.sort()
+    rps = len(samples) / elapsed
+
+    if samples:
+        print("{:<24} requests {:>8} errors {:>5} rps {:>9.1f} p50 {:>8.2f} ms p99 {:>8.2f} ms p999 {:>8.2f} ms".format(
+            endpoint, len(samples), errors, rps,
+            percentile(samples, 0.5) * 1000,
+            percentile(samples, 0.99) * 1000,
+            percentile(samples, 0.999) * 1000))
+    else:
+        print("{:<24} requests {:>8} errors {:>5}".format(endpoint, 0, errors))
+
+    return rps
+
+
+def check_regressions(results, baseline, max_regression):
+    regressed = False
+
+    for endpoint, rps in results.items():
+        if endpoint not in baseline:
+            continue
+
+        limit = baseline[endpoint] * (1 - max_regression)
+
+        if rps < limit:
+            print("{}: {:.1f} rps is below {:.1f} rps ({:.1f} rps in baseline, {:.0%} allowed regression)".format(
+                endpoint, rps, limit, baseline[endpoint], max_regression))
+            regressed = True
+
+    return not regressed
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--concurrency",
+                        type=int,
+                        default=int(os.environ.get("REST_BENCH_CONCURRENCY", "8")),
+                        help="number of concurrent clients")
+    parser.add_argument("--duration", type=float, default=5, help="duration of the run of each endpoint in seconds")
+    parser.add_argument("--endpoint",
+                        action="append",
+                        dest="endpoints",
+                        help="endpoint to request, may be repeated (default: /node/* and /diagnostics)")
+    parser.add_argument("--no-keep-alive", action="store_true", help="open a new connection for every request")
+    parser.add_argument("--baseline", help="baseline file to compare the throughput with")
+    parser.add_argument("--max-regression",
+                        type=float,
+                        default=0.2,
+                        help="allowed throughput regression against the baseline, as a ratio (default: 0.2)")
+    parser.add_argument("--save-baseline", help="write the measured throughput to this file")
+    args = parser.parse_args()
+
+    endpoints = args.endpoints or default_endpoints
+    keep_alive = not args.no_keep_alive
+
+    print("{} clients, {:.0f} seconds per endpoint, keep-alive {}".format(args.concurrency, args.duration,
+                                                                              "on" if keep_alive else "off"))
+
+    results = {}
+    total_errors = 0
+
+    with multiprocessing.Pool(args.concurrency) as pool:
+        for endpoint in endpoints:
+            start = time.monotonic()
+            outputs = pool.map(run_worker, [(endpoint, args.duration, keep_alive)] * args.concurrency)
+            elapsed = time.monotonic() - start
+
+            samples = [sample for latencies, _ in outputs for sample in latencies]
+            errors = sum(errors for _, errors in outputs)
+
+            results[endpoint] = report(endpoint, samples, errors, elapsed)
+            total_errors += errors
+
+    if args.save_baseline:
+        with open(args.save_baseline, "w") as f:
+            json.dump({endpoint: round(rps, 1) for endpoint, rps in results.items()}, f, indent=4, sort_keys=True)
+            f.write("\n")
+
+    if args.baseline:
+        with open(args.baseline) as f:
+            if not check_regressions(results, json.load(f), args.max_regression):
+                return 1
+
+    if total_errors > 0:
+        print("{} requests failed".format(total_errors))
+        return 1
+
+    return 0
+
+
+if __name__ == '__main__':
+    exit(main())
@@ -29,12 +29,18 @@
 
 import urllib.request
 import urllib.error
+import gzip
+import http.client
 import ipaddress
 import json
 import re
+import socket
 from threading import Thread
 
-rest_api_addr = "http://0.0.0.0:8081"
+rest_api_host = "0.0.0.0"
+rest_api_port = 8081
+rest_api_addr = "http://{}:{}".format(rest_api_host, rest_api_port)
+rest_api_path = "/tmp/otbr-rest.sock"
 
 
 def assert_is_ipv6_address(string):
@@ -296,6 +302,24 @@ def node_ext_panid_check(data):
     return True
 
 
+def mainloop_stats_check(data):
+    assert data is not None
+
+    assert (type(data) == dict)
+    assert (type(data["StallThresholdUs"]) == int)
+    assert (type(data["BucketUpperBoundsUs"]) == list)
+
+    for component in data["Components"]:
+        assert (type(component["Component"]) == str)
+        assert (component["Phase"] in ("UpdateFdSet", "Process"))
+        assert (component["MaxUs"] <= component["TotalUs"])
+        assert (component["StallCount"] <= component["Count"])
+        assert (len(component["Histogram"]) == len(data["BucketUpperBoundsUs"]) + 1)
+        assert (sum(component["Histogram"]) == component["Count"])
+
+    return True
+
+
 def node_test(thread_num):
     url = rest_api_addr + "/node"
 
@@ -428,6 +452,333 @@ def diagnostics_test(thread_num):
         thread_num, has_content, valid))
 
 
+def diagnostics_tlvs_test(thread_num):
+    url = rest_api_addr + "/diagnostics?tlvs=ExtAddress,1"
+
+    response_data = [None] * thread_num
+
+    create_multi_thread(get_data_from_url, url, thread_num, response_data)
+
+    valid = 0
+    for data in response_data:
+        if all(sorted(diag.keys()) == ["ExtAddress", "Rloc16"] for diag in data):
+            valid += 1
+
+    error_data = [None] * 1
+    get_error_from_url(rest_api_addr + "/diagnostics?tlvs=Unknown", error_data, 0)
+    assert (error_data[0].code == 400)
+
+    print(" /diagnostics?tlvs=ExtAddress,1 : all {}, valid {} ".format(thread_num, valid))
+
+
+def diagnostics_page_test(thread_num):
+    url = rest_api_addr + "/diagnostics?offset=0&limit=1&fields=ExtAddress,Rloc16"
+
+    response_data = [None] * thread_num
+
+    create_multi_thread(get_data_from_url, url, thread_num, response_data)
+
+    valid = 0
+    for data in response_data:
+        if len(data) <= 1 and all(sorted(diag.keys()) == ["ExtAddress", "Rloc16"] for diag in data):
+            valid += 1
+
+    error_data = [None] * 3
+    get_error_from_url(rest_api_addr + "/diagnostics?limit=0", error_data, 0)
+    get_error_from_url(rest_api_addr + "/diagnostics?offset=-1", error_data, 1)
+    get_error_from_url(rest_api_addr + "/diagnostics?tlvs=ExtAddress&fields=Rloc16", error_data, 2)
+    assert (error_data[0].code == 400)
+    assert (error_data[1].code == 400)
+    assert (error_data[2].code == 400)
+
+    print(" /diagnostics?offset=0&limit=1 : all {}, valid {} ".format(thread_num, valid))
+
+
+def diagnostics_node_test(request_num):
+    data = [None] * 1
+    get_data_from_url(rest_api_addr + "/diagnostics", data, 0)
+    rloc16s = [diag["Rloc16"] for diag in data[0]]
+
+    valid = 0
+    for i in range(request_num):
+        for rloc16 in rloc16s:
+            node_data = [None] * 1
+            get_data_from_url(rest_api_addr + "/diagnostics/{}".format(rloc16), node_data, 0)
+
+            if len(node_data[0]) == 1 and node_data[0][0]["Rloc16"] == rloc16:
+                valid += 1
+
+    error_data = [None] * 3
+    get_error_from_url(rest_api_addr + "/diagnostics/router", error_data, 0)
+    get_error_from_url(rest_api_addr + "/diagnostics/0x10000", error_data, 1)
+    get_error_from_url(rest_api_addr + "/diagnostics/0xfffe", error_data, 2)
+    assert (error_data[0].code == 400)
+    assert (error_data[1].code == 400)
+    assert (error_data[2].code == 404)
+
+    print(" /diagnostics/{{rloc16}} : all {}, valid {} ".format(request_num * len(rloc16s), valid))
+
+
+def topology_check(data, full):
+    assert (type(data["Version"]) == int)
+    assert (data["Full"] == full)
+
+    for node in data["Nodes"]:
+        assert (type(node["Rloc16"]) == int)
+        assert (node.get("Removed", False) or re.match(r'^[A-F0-9]{16}$', node["ExtAddress"]) is not None)
+
+    for link in data["Links"]:
+        assert (type(link["From"]) == int)
+        assert (type(link["To"]) == int)
+        assert (link.get("Removed", False) or link["Type"] in ["Router", "Child"])
+
+    return True
+
+
+def topology_test(request_num):
+    # The topology is built from the diagnostics received.
+    get_data_from_url(rest_api_addr + "/diagnostics", [None], 0)
+
+    valid = 0
+    for i in range(request_num):
+        data = [None] * 2
+        get_data_from_url(rest_api_addr + "/topology", data, 0)
+        get_data_from_url(rest_api_addr + "/topology?since={}".format(data[0]["Version"]), data, 1)
+
+        if topology_check(data[0], True) and topology_check(data[1], data[0]["Version"] == 0):
+            valid += 1
+
+    error_data = [None] * 1
+    get_error_from_url(rest_api_addr + "/topology?since=latest", error_data, 0)
+    assert (error_data[0].code == 400)
+
+    print(" /topology : all {}, valid {} ".format(request_num, valid))
+
+
+def diagnostics_history_check(data):
+    assert (type(data) == list)
+
+    for series in data:
+        assert (len(series["ExtAddress"]) == 16)
+        timestamp = 0
+        for sample in series["Samples"]:
+            assert (sample["Timestamp"] >= timestamp)
+            timestamp = sample["Timestamp"]
+
+    return True
+
+
+def diagnostics_history_test(request_num):
+    # Samples are recorded from the diagnostics received.
+    get_data_from_url(rest_api_addr + "/diagnostics", [None], 0)
+
+    valid = 0
+    for i in range(request_num):
+        data = [None] * 1
+        get_data_from_url(rest_api_addr + "/diagnostics/history", data, 0)
+
+        if diagnostics_history_check(data[0]):
+            valid += 1
+
+    error_data = [None] * 2
+    get_error_from_url(rest_api_addr + "/diagnostics/history?since=now", error_data, 0)
+    get_error_from_url(rest_api_addr + "/diagnostics/history?node=0x10000", error_data, 1)
+    assert (error_data[0].code == 400)
+    assert (error_data[1].code == 400)
+
+    print(" /diagnostics/history : all {}, valid {} ".format(request_num, valid))
+
+
+def diagnostics_stream_test(request_num):
+    connection = http.client.HTTPConnection(rest_api_host, rest_api_port)
+    valid = 0
+
+    for i in range(request_num):
+        connection.request("GET", "/diagnostics?stream=1")
+        response = connection.getresponse()
+        assert (response.getheader("Content-Type") == "text/event-stream")
+
+        # Each event carries the diagnostics of one node, its data lines joined with line feeds.
+        events = response.read().decode().split("\n\n")
+        data = []
+        for event in events:
+            lines = [line[len("data: "):] for line in event.split("\n") if line.startswith("data: ")]
+            if lines:
+                data += json.loads("\n".join(lines))
+
+        if diagnostics_check(data) != 0:
+            valid += 1
+
+    connection.close()
+
+    print(" /diagnostics?stream=1 : all {}, valid {} ".format(request_num, valid))
+
+
+def neighbor_check(data):
+    assert (re.match(r'^[A-F0-9]{16}$', data["ExtAddress"]) is not None)
+    assert (type(data["Rloc16"]) == int)
+    assert (data["IsChild"] in [0, 1])
+
+    return True
+
+
+def neighbors_check(data):
+    assert (type(data["Sequence"]) == int)
+
+    for neighbor in data["Neighbors"]:
+        neighbor_check(neighbor)
+
+    return True
+
+
+def neighbors_test(request_num):
+    valid = 0
+    for i in range(request_num):
+        data = [None] * 1
+        get_data_from_url(rest_api_addr + "/node/neighbors", data, 0)
+
+        if neighbors_check(data[0]):
+            valid += 1
+
+    print(" /node/neighbors : all {}, valid {} ".format(request_num, valid))
+
+
+def read_events(response):
+    events = []
+    for event in response.read().decode().split("\n\n"):
+        lines = event.split("\n")
+        ids = [line[len("id: "):] for line in lines if line.startswith("id: ")]
+        data = [line[len("data: "):] for line in lines if line.startswith("data: ")]
+        if data:
+            events.append((int(ids[0]), json.loads("\n".join(data))))
+
+    return events
+
+
+def neighbors_stream_test(request_num):
+    connection = http.client.HTTPConnection(rest_api_host, rest_api_port)
+    valid = 0
+    last_id = None
+
+    for i in range(request_num):
+        headers = {} if last_id is None else {"Last-Event-ID": str(last_id)}
+        connection.request("GET", "/node/neighbors?stream=1", headers=headers)
+        response = connection.getresponse()
+        assert (response.getheader("Content-Type") == "text/event-stream")
+
+        # The stream starts with the whole table, unless it resumes after the last event received.
+        events = read_events(response)
+        if last_id is None:
+            assert (len(events) > 0 and neighbors_check(events[0][1]))
+            events = events[1:]
+
+        for event_id, data in events:
+            assert (event_id == data["Sequence"])
+            if "Neighbors" in data:
+                neighbors_check(data)
+            else:
+                assert (data["Event"] in ["Added", "Removed"])
+                neighbor_check(data["Neighbor"])
+            last_id = event_id
+
+        if last_id is None:
+            last_id = 0
+        valid += 1
+
+    connection.close()
+
+    error_data = [None] * 1
+    get_error_from_url(rest_api_addr + "/node/neighbors?stream=1&since=last", error_data, 0)
+    assert (error_data[0].code == 400)
+
+    print(" /node/neighbors?stream=1 : all {}, valid {} ".format(request_num, valid))
+
+
+def churn_check(data, since, until):
+    assert (type(data["Dropped"]) == int)
+
+    for event in data["Events"]:
+        assert (since <= event["Timestamp"] < until)
+        assert (event["Event"] in ["ChildAdded", "ChildRemoved", "ParentChanged", "RoleChanged", "PartitionChanged"])
+        assert (type(event["Rloc16"]) == int)
+        if event["Event"] == "RoleChanged":
+            assert (event["Role"] in range(5))
+        elif event["Event"] == "PartitionChanged":
+            assert (type(event["PartitionId"]) == int)
+        else:
+            assert (re.match(r'^[A-F0-9]{16}$', event["ExtAddress"]) is not None)
+
+    return True
+
+
+def churn_test(request_num):
+    valid = 0
+    for i in range(request_num):
+        data = [None] * 2
+        get_data_from_url(rest_api_addr + "/node/churn", data, 0)
+        get_data_from_url(rest_api_addr + "/node/churn?since=1&until=2", data, 1)
+
+        if churn_check(data[0], 0, 2**64) and churn_check(data[1], 1, 2) and len(data[1]["Events"]) == 0:
+            valid += 1
+
+    error_data = [None] * 2
+    get_error_from_url(rest_api_addr + "/node/churn?since=now", error_data, 0)
+    get_error_from_url(rest_api_addr + "/node/churn?until=-", error_data, 1)
+    assert (error_data[0].code == 400)
+    assert (error_data[1].code == 400)
+
+    print(" /node/churn : all {}, valid {} ".format(request_num, valid))
+
+
+def mainloop_stats_test(thread_num):
+    url = rest_api_addr + "/mainloop/stats"
+
+    response_data = [None] * thread_num
+
+    create_multi_thread(get_data_from_url, url, thread_num, response_data)
+
+    valid = [mainloop_stats_check(data) for data in response_data].count(True)
+
+    print(" /mainloop/stats : all {}, valid {} ".format(thread_num, valid))
+
+
+def metrics_check(response, body):
+    assert (response.status == 200)
+    assert (response.getheader("Content-Type").startswith("text/plain; version=0.0.4"))
+
+    text = body.decode("utf-8")
+    families = [line.split()[2] for line in text.splitlines() if line.startswith("# TYPE ")]
+
+    # Every family is described once and followed by its samples.
+    assert (len(families) == len(set(families)))
+
+    for family in ["otbr_rest_responses_total", "otbr_rest_request_duration_microseconds",
+                   "otbr_mainloop_duration_microseconds", "otbr_thread_mac_frames_total"]:
+        assert (family in families)
+
+    assert ('otbr_rest_responses_total{class="2xx"} ' in text)
+    assert ('otbr_mainloop_duration_microseconds_bucket{component="rest",phase="Process",le="+Inf"} ' in text)
+
+    return True
+
+
+def metrics_test(request_num):
+    connection = http.client.HTTPConnection(rest_api_host, rest_api_port)
+    valid = 0
+
+    for i in range(request_num):
+        # CBOR is not an exposition format, the metrics are always text.
+        connection.request("GET", "/metrics", headers={"Accept": "application/cbor"})
+        response = connection.getresponse()
+
+        if metrics_check(response, response.read()):
+            valid += 1
+
+    connection.close()
+
+    print(" /metrics : all {}, valid {} ".format(request_num, valid))
+
+
 def error_test(thread_num):
     url = rest_api_addr + "/hello"
 
@@ -440,6 +791,193 @@ def error_test(thread_num):
     print(" /v1/hello : all {}, valid {} ".format(thread_num, valid))
 
 
+def keep_alive_test(request_num):
+    connection = http.client.HTTPConnection(rest_api_host, rest_api_port)
+    sock = None
+    valid = 0
+
+    for i in range(request_num):
+        connection.request("GET", "/node/state")
+        response = connection.getresponse()
+        data = json.loads(response.read())
+
+        if sock is None:
+            sock = connection.sock
+
+        # All requests are served on the same socket until the server closes it.
+        if node_state_check(data) and connection.sock is sock:
+            valid += 1
+
+        assert (response.getheader("Connection") == "keep-alive")
+
+    connection.close()
+
+    print(" keep-alive /node/state : all {}, valid {} ".format(request_num, valid))
+
+
+def conditional_get_test(request_num):
+    connection = http.client.HTTPConnection(rest_api_host, rest_api_port)
+    valid = 0
+
+    for i in range(request_num):
+        connection.request("GET", "/node/network-name")
+        response = connection.getresponse()
+        response.read()
+        etag = response.getheader("ETag")
+        assert (etag is not None)
+
+        connection.request("GET", "/node/network-name", headers={"If-None-Match": etag})
+        response = connection.getresponse()
+
+        if response.status == 304 and response.read() == b"" and response.getheader("ETag") == etag:
+            valid += 1
+
+    connection.close()
+
+    print(" conditional /node/network-name : all {}, valid {} ".format(request_num, valid))
+
+
+def cbor_test(request_num):
+    connection = http.client.HTTPConnection(rest_api_host, rest_api_port)
+    valid = 0
+
+    for i in range(request_num):
+        connection.request("GET", "/node/ext-address")
+        json_response = connection.getresponse()
+        ext_address = json.loads(json_response.read())
+
+        connection.request("GET", "/node/ext-address", headers={"Accept": "application/cbor"})
+        response = connection.getresponse()
+        body = response.read()
+
+        # An 8-byte CBOR byte string.
+        if response.getheader("Content-Type") == "application/cbor" and body[0] == 0x48 and body[1:].hex().upper(
+        ) == ext_address and response.getheader("ETag") != json_response.getheader("ETag"):
+            valid += 1
+
+    connection.request("GET", "/diagnostics", headers={"Accept": "application/json, application/cbor;q=0.5"})
+    response = connection.getresponse()
+    assert (response.getheader("Content-Type") == "application/json")
+    json.loads(response.read())
+
+    connection.request("GET", "/diagnostics", headers={"Accept": "application/cbor"})
+    response = connection.getresponse()
+    assert (response.getheader("Content-Type") == "application/cbor")
+    # An indefinite-length array.
+    assert (response.read()[0] == 0x9f)
+
+    connection.close()
+
+    print(" cbor /node/ext-address : all {}, valid {} ".format(request_num, valid))
+
+
+def gzip_test(request_num):
+    connection = http.client.HTTPConnection(rest_api_host, rest_api_port)
+    valid = 0
+
+    for i in range(request_num):
+        # The mainloop statistics are larger than the compression threshold.
+        connection.request("GET", "/mainloop/stats", headers={"Accept-Encoding": "gzip"})
+        response = connection.getresponse()
+        body = response.read()
+
+        if response.getheader("Content-Encoding") == "gzip" and mainloop_stats_check(json.loads(gzip.decompress(body))):
+            valid += 1
+
+    connection.request("GET", "/mainloop/stats", headers={"Accept-Encoding": "gzip;q=0"})
+    response = connection.getresponse()
+    assert (response.getheader("Content-Encoding") is None)
+    mainloop_stats_check(json.loads(response.read()))
+
+    connection.close()
+
+    print(" gzip /mainloop/stats : all {}, valid {} ".format(request_num, valid))
+
+
+def read_pipelined_response(stream):
+    headers = {}
+
+    assert (stream.readline().startswith(b"HTTP/1.1"))
+
+    while True:
+        line = stream.readline().strip()
+
+        if not line:
+            break
+
+        field, value = line.decode().split(":", 1)
+        headers[field.strip().lower()] = value.strip()
+
+    return json.loads(stream.read(int(headers["content-length"])))
+
+
+def pipelining_test(request_num):
+    paths = ["/node/rloc16", "/node/state", "/node/leader-data"]
+    checks = [node_rloc16_check, node_state_check, node_leader_data_check]
+    request = "".join("GET {} HTTP/1.1\r\nHost: {}\r\n\r\n".format(path, rest_api_host) for path in paths)
+    valid = 0
+
+    for i in range(request_num):
+        sock = socket.create_connection((rest_api_host, rest_api_port))
+        # Send all requests in one segment, the responses must come back in the same order.
+        sock.sendall(request.encode())
+        stream = sock.makefile("rb")
+
+        for check in checks:
+            check(read_pipelined_response(stream))
+
+        valid += 1
+        sock.close()
+
+    print(" pipelining {} : all {}, valid {} ".format(paths, request_num, valid))
+
+
+def admission_test(connection_num):
+    # More connections than a single client is admitted by default, the others are rejected without a request.
+    socks = [socket.create_connection((rest_api_host, rest_api_port)) for i in range(connection_num)]
+    rejected = 0
+
+    for sock in socks:
+        sock.settimeout(0.2)
+
+        try:
+            data = sock.recv(1024)
+            assert (data.startswith(b"HTTP/1.1 503 Service Unavailable\r\n"))
+            rejected += 1
+        except socket.timeout:
+            pass
+
+    for sock in socks:
+        sock.close()
+
+    assert (rejected >= connection_num - 32)
+
+    print(" admission : all {}, rejected {} ".format(connection_num, rejected))
+
+
+def unix_socket_test(request_num):
+    valid = 0
+
+    for i in range(request_num):
+        sock = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        sock.connect(rest_api_path)
+        sock.sendall(b"GET /node/state HTTP/1.1\r\nHost: localhost\r\nConnection: close\r\n\r\n")
+
+        response = b""
+        while True:
+            data = sock.recv(4096)
+            if not data:
+                break
+            response += data
+        sock.close()
+
+        header, body = response.split(b"\r\n\r\n", 1)
+        if header.startswith(b"HTTP/1.1 200 OK\r\n") and node_state_check(json.loads(body)):
+            valid += 1
+
+    print(" unix {} /node/state : all {}, valid {} ".format(rest_api_path, request_num, valid))
+
+
 def main():
     node_test(200)
     node_rloc_test(200)
@@ -451,7 +989,25 @@ def main():
     node_num_of_router_test(200)
     node_ext_panid_test(200)
     diagnostics_test(20)
+    diagnostics_stream_test(5)
+    diagnostics_tlvs_test(5)
+    diagnostics_page_test(5)
+    diagnostics_node_test(5)
+    topology_test(5)
+    diagnostics_history_test(5)
+    neighbors_test(5)
+    neighbors_stream_test(2)
+    churn_test(5)
+    cbor_test(5)
+    gzip_test(5)
+    mainloop_stats_test(20)
+    metrics_test(10)
     error_test(10)
+    keep_alive_test(20)
+    pipelining_test(10)
+    conditional_get_test(10)
+    admission_test(40)
+    unix_socket_test(10)
 
     return 0
 
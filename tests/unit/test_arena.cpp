@@ -0,0 +1,133 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <stdint.h>
+
+#include <vector>
+
+#include "utils/arena.hpp"
+
+using otbr::Utils::Arena;
+using otbr::Utils::ArenaAllocator;
+using otbr::Utils::ArenaString;
+
+TEST_GROUP(Arena){};
+
+TEST(Arena, TestAllocate)
+{
+    Arena arena(64);
+
+    LONGS_EQUAL(0, arena.GetBlockCount());
+
+    for (size_t alignment = 1; alignment <= 16; alignment *= 2)
+    {
+        void *memory = arena.Allocate(3, alignment);
+
+        LONGS_EQUAL(0, reinterpret_cast<uintptr_t>(memory) % alignment);
+    }
+
+    LONGS_EQUAL(1, arena.GetBlockCount());
+    CHECK(arena.Allocate(100) != nullptr);
+    LONGS_EQUAL(2, arena.GetBlockCount());
+}
+
+TEST(Arena, TestResetCoalescesBlocks)
+{
+    Arena arena(64);
+    void *first;
+
+    for (int i = 0; i < 10; ++i)
+    {
+        arena.Allocate(48);
+    }
+
+    CHECK(arena.GetBlockCount() > 1);
+
+    arena.Reset();
+    LONGS_EQUAL(1, arena.GetBlockCount());
+
+    first = arena.Allocate(48);
+    for (int i = 1; i < 10; ++i)
+    {
+        arena.Allocate(48);
+    }
+    LONGS_EQUAL(1, arena.GetBlockCount());
+
+    arena.Reset();
+    POINTERS_EQUAL(first, arena.Allocate(48));
+}
+
+TEST(Arena, TestBuffer)
+{
+    uint8_t buffer[128];
+    Arena   arena(buffer, sizeof(buffer));
+    void *  first;
+
+    // The buffer is used before any heap block.
+    first = arena.Allocate(48);
+    CHECK(static_cast<uint8_t *>(first) >= buffer && static_cast<uint8_t *>(first) < buffer + sizeof(buffer));
+    arena.Allocate(48);
+    LONGS_EQUAL(0, arena.GetBlockCount());
+
+    arena.Reset();
+    POINTERS_EQUAL(first, arena.Allocate(48));
+
+    // Once it overflows, one heap block as large as both is kept instead.
+    arena.Allocate(48);
+    arena.Allocate(48);
+    LONGS_EQUAL(1, arena.GetBlockCount());
+    arena.Reset();
+    for (int i = 0; i < 3; ++i)
+    {
+        uint8_t *memory = static_cast<uint8_t *>(arena.Allocate(48));
+
+        CHECK(memory < buffer || memory >= buffer + sizeof(buffer));
+    }
+    LONGS_EQUAL(1, arena.GetBlockCount());
+}
+
+TEST(Arena, TestContainers)
+{
+    Arena                                 arena;
+    ArenaString                           string{ArenaAllocator<char>(arena)};
+    std::vector<int, ArenaAllocator<int>> numbers{ArenaAllocator<int>(arena)};
+    ArenaString                           heapString("not in an arena");
+
+    string.append("a string long enough not to fit in the small string buffer");
+    for (int i = 0; i < 100; ++i)
+    {
+        numbers.push_back(i);
+    }
+
+    STRCMP_EQUAL("a string long enough not to fit in the small string buffer", string.c_str());
+    LONGS_EQUAL(99, numbers.back());
+    LONGS_EQUAL(1, arena.GetBlockCount());
+    STRCMP_EQUAL("not in an arena", heapString.c_str());
+}
@@ -0,0 +1,92 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "utils/cbor_writer.hpp"
+
+using otbr::Utils::CborWriter;
+
+TEST_GROUP(CborWriter){};
+
+TEST(CborWriter, NestedContainers)
+{
+    std::string buffer;
+    CborWriter  writer(buffer);
+
+    writer.BeginObject();
+    writer.UintMember("a", 1);
+    writer.Key("b");
+    writer.BeginArray();
+    writer.BeginObject();
+    writer.EndObject();
+    writer.Bool(true);
+    writer.EndArray();
+    writer.EndObject();
+
+    MEMCMP_EQUAL("\xbf\x61" "a" "\x01\x61" "b" "\x9f\xbf\xff\xf5\xff\xff", buffer.data(), buffer.size());
+    LONGS_EQUAL(12, buffer.size());
+}
+
+TEST(CborWriter, Integers)
+{
+    std::string buffer;
+    CborWriter  writer(buffer);
+
+    writer.Uint(23);
+    writer.Uint(24);
+    writer.Uint(0x1234);
+    writer.Uint(0x12345678);
+    writer.Uint(0x123456789aull);
+    writer.Int(-1);
+    writer.Int(-25);
+
+    MEMCMP_EQUAL("\x17"
+                 "\x18\x18"
+                 "\x19\x12\x34"
+                 "\x1a\x12\x34\x56\x78"
+                 "\x1b\x00\x00\x00\x12\x34\x56\x78\x9a"
+                 "\x20"
+                 "\x38\x18",
+                 buffer.data(), buffer.size());
+    LONGS_EQUAL(23, buffer.size());
+}
+
+TEST(CborWriter, Strings)
+{
+    std::string   buffer;
+    CborWriter    writer(buffer);
+    const uint8_t bytes[] = {0xde, 0xad, 0x00};
+
+    writer.String("");
+    writer.String("ot");
+    writer.Bytes(bytes, sizeof(bytes));
+
+    MEMCMP_EQUAL("\x60\x62ot\x43\xde\xad\x00", buffer.data(), buffer.size());
+    LONGS_EQUAL(8, buffer.size());
+}
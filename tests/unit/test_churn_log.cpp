@@ -0,0 +1,111 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <string.h>
+
+#include "agent/churn_log.cpp"
+
+using otbr::Ncp::ChurnLog;
+
+static otExtAddress MakeExtAddress(uint8_t aLastByte)
+{
+    otExtAddress extAddress;
+
+    memset(&extAddress, 0, sizeof(extAddress));
+    extAddress.m8[OT_EXT_ADDRESS_SIZE - 1] = aLastByte;
+
+    return extAddress;
+}
+
+TEST_GROUP(ChurnLog){};
+
+TEST(ChurnLog, RecordsEvents)
+{
+    ChurnLog                     log;
+    otExtAddress                 child = MakeExtAddress(1);
+    std::vector<ChurnLog::Event> events;
+
+    log.Add(ChurnLog::kTypeRoleChanged, 100, nullptr, 0x0400, OT_DEVICE_ROLE_LEADER);
+    log.Add(ChurnLog::kTypeChildAdded, 200, &child, 0x0401, 0);
+
+    log.GetEvents(0, UINT64_MAX, events);
+    LONGS_EQUAL(2, events.size());
+    LONGS_EQUAL(ChurnLog::kTypeRoleChanged, events[0].mType);
+    LONGS_EQUAL(OT_DEVICE_ROLE_LEADER, events[0].mValue);
+    LONGS_EQUAL(0, events[0].mExtAddress.m8[OT_EXT_ADDRESS_SIZE - 1]);
+    LONGS_EQUAL(ChurnLog::kTypeChildAdded, events[1].mType);
+    LONGS_EQUAL(0x0401, events[1].mRloc16);
+    MEMCMP_EQUAL(child.m8, events[1].mExtAddress.m8, OT_EXT_ADDRESS_SIZE);
+    LONGS_EQUAL(0, log.GetDroppedCount());
+}
+
+TEST(ChurnLog, FiltersByTime)
+{
+    ChurnLog                     log;
+    std::vector<ChurnLog::Event> events;
+
+    for (uint32_t i = 1; i <= 5; ++i)
+    {
+        log.Add(ChurnLog::kTypePartitionChanged, i * 100, nullptr, 0x0400, i);
+    }
+
+    log.GetEvents(200, 400, events);
+    LONGS_EQUAL(2, events.size());
+    LONGS_EQUAL(2, events[0].mValue);
+    LONGS_EQUAL(3, events[1].mValue);
+
+    log.GetEvents(600, UINT64_MAX, events);
+    LONGS_EQUAL(0, events.size());
+}
+
+TEST(ChurnLog, DropsOldestWhenFull)
+{
+    ChurnLog                     log;
+    otExtAddress                 child = MakeExtAddress(2);
+    std::vector<ChurnLog::Event> events;
+
+    for (uint32_t i = 0; i < ChurnLog::kCapacity + 3; ++i)
+    {
+        log.Add(i % 2 ? ChurnLog::kTypeChildRemoved : ChurnLog::kTypeChildAdded, i, &child, 0x0402, 0);
+    }
+
+    log.GetEvents(0, UINT64_MAX, events);
+    LONGS_EQUAL(ChurnLog::kCapacity, events.size());
+    LONGS_EQUAL(3, events.front().mTimestamp);
+    LONGS_EQUAL(ChurnLog::kCapacity + 2, events.back().mTimestamp);
+    LONGS_EQUAL(3, log.GetDroppedCount());
+}
+
+TEST(ChurnLog, TypeToString)
+{
+    STRCMP_EQUAL("ChildAdded", ChurnLog::TypeToString(ChurnLog::kTypeChildAdded));
+    STRCMP_EQUAL("PartitionChanged", ChurnLog::TypeToString(ChurnLog::kTypePartitionChanged));
+    STRCMP_EQUAL("Unknown", ChurnLog::TypeToString(0xff));
+}
@@ -0,0 +1,75 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/config_file.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::ConfigFile;
+
+TEST_GROUP(ConfigFile){};
+
+TEST(ConfigFile, TestParse)
+{
+    ConfigFile config;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, config.Parse("# Agent settings\n"
+                                              "\n"
+                                              "debug-level = 7\n"
+                                              "  rest-listen-path=/run/otbr.sock  \n"
+                                              "backbone-ifname =\n"
+                                              "debug-level = 6\r\n"));
+
+    CHECK_EQUAL(3, config.GetEntries().size());
+    STRCMP_EQUAL("6", config.Get("debug-level"));
+    STRCMP_EQUAL("/run/otbr.sock", config.Get("rest-listen-path"));
+    STRCMP_EQUAL("", config.Get("backbone-ifname"));
+    CHECK(config.Get("thread-ifname") == nullptr);
+}
+
+TEST(ConfigFile, TestParseError)
+{
+    ConfigFile config;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, config.Parse("debug-level = 7\n"));
+
+    CHECK_EQUAL(OTBR_ERROR_PARSE, config.Parse("debug-level = 7\n"
+                                               "rest-listen-port\n"));
+    CHECK_EQUAL(2, config.GetErrorLine());
+    CHECK(config.GetEntries().empty());
+
+    CHECK_EQUAL(OTBR_ERROR_PARSE, config.Parse(" = 7\n"));
+    CHECK_EQUAL(1, config.GetErrorLine());
+}
+
+TEST(ConfigFile, TestLoadMissingFile)
+{
+    ConfigFile config;
+
+    CHECK_EQUAL(OTBR_ERROR_ERRNO, config.Load("/nonexistent/otbr-agent.conf"));
+}
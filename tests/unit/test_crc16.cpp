@@ -0,0 +1,80 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "utils/crc16.hpp"
+
+using otbr::Crc16;
+
+static const uint8_t kCheckInput[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+TEST_GROUP(Crc16){};
+
+TEST(Crc16, TestCheckValues)
+{
+    Crc16 ccitt(Crc16::kCcitt);
+    Crc16 ansi(Crc16::kAnsi);
+
+    // The check values of CRC-16/XMODEM and CRC-16/UMTS, which use these polynomials with a zero initial value.
+    ccitt.Update(kCheckInput, sizeof(kCheckInput));
+    ansi.Update(kCheckInput, sizeof(kCheckInput));
+
+    CHECK(ccitt.Get() == 0x31c3);
+    CHECK(ansi.Get() == 0xfee8);
+}
+
+TEST(Crc16, TestBulkMatchesBytes)
+{
+    uint8_t buffer[67];
+
+    for (size_t i = 0; i < sizeof(buffer); i++)
+    {
+        buffer[i] = static_cast<uint8_t>(i * 151 + 7);
+    }
+
+    for (Crc16::Polynomial polynomial : {Crc16::kCcitt, Crc16::kAnsi})
+    {
+        for (size_t length = 0; length <= sizeof(buffer); length++)
+        {
+            Crc16 bytes(polynomial);
+            Crc16 bulk(polynomial);
+
+            for (size_t i = 0; i < length; i++)
+            {
+                bytes.Update(buffer[i]);
+            }
+
+            // Split the buffer so that the bulk update also starts from a non-zero CRC.
+            bulk.Update(buffer, length / 3);
+            bulk.Update(buffer + length / 3, length - length / 3);
+
+            CHECK(bytes.Get() == bulk.Get());
+        }
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dbus/server/dbus_member_table.hpp"
+
+#include <memory>
+#include <string>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::DBus::MemberTable;
+
+TEST_GROUP(DBusMemberTable){};
+
+TEST(DBusMemberTable, TestFindByNames)
+{
+    MemberTable<int> table;
+    std::string      interfaceName = "io.openthread.BorderRouter";
+    std::string      memberName    = "Scan";
+
+    CHECK(table.Add(interfaceName, memberName, 1));
+    CHECK(table.Add(interfaceName, "Attach", 2));
+    CHECK(table.Add("org.freedesktop.DBus.Properties", "Get", 3));
+    LONGS_EQUAL(3, table.GetSize());
+
+    // Lookups are by content, not by the registered pointers.
+    LONGS_EQUAL(1, *table.Find(std::string(interfaceName).c_str(), std::string(memberName).c_str()));
+    LONGS_EQUAL(2, *table.Find("io.openthread.BorderRouter", "Attach"));
+    LONGS_EQUAL(3, *table.Find("org.freedesktop.DBus.Properties", "Get"));
+}
+
+TEST(DBusMemberTable, TestNotFound)
+{
+    MemberTable<int> table;
+
+    CHECK(table.Add("a.b", "c", 1));
+
+    // The same joined name must not match a different split.
+    CHECK(table.Find("a", "b.c") == nullptr);
+    CHECK(table.Find("a.b", "C") == nullptr);
+    CHECK(table.Find("a.b", "") == nullptr);
+    CHECK(table.Find(nullptr, "c") == nullptr);
+    CHECK(table.Find("a.b", nullptr) == nullptr);
+}
+
+TEST(DBusMemberTable, TestDuplicateKeepsFirst)
+{
+    MemberTable<int> table;
+
+    CHECK(table.Add("a.b", "c", 1));
+    CHECK_FALSE(table.Add("a.b", "c", 2));
+    LONGS_EQUAL(1, table.GetSize());
+    LONGS_EQUAL(1, *table.Find("a.b", "c"));
+}
+
+TEST(DBusMemberTable, TestMutableMoveOnlyValue)
+{
+    MemberTable<std::unique_ptr<int>> table;
+    const auto &                      constTable = table;
+
+    CHECK(table.Add("a.b", "c", std::unique_ptr<int>(new int(1))));
+    **table.Find("a.b", "c") = 5;
+    LONGS_EQUAL(5, **constTable.Find("a.b", "c"));
+}
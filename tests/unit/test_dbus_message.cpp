@@ -70,6 +70,63 @@ bool operator==(const otbr::DBus::ChannelQuality &aLhs, const otbr::DBus::Channe
     return aLhs.mChannel == aRhs.mChannel && aLhs.mOccupancy == aRhs.mOccupancy;
 }
 
+bool operator==(const otbr::DBus::EnergyScanResult &aLhs, const otbr::DBus::EnergyScanResult &aRhs)
+{
+    return aLhs.mChannel == aRhs.mChannel && aLhs.mMaxRssi == aRhs.mMaxRssi;
+}
+
+bool operator==(const otbr::DBus::ChannelReport &aLhs, const otbr::DBus::ChannelReport &aRhs)
+{
+    return aLhs.mChannel == aRhs.mChannel && aLhs.mOccupancy == aRhs.mOccupancy && aLhs.mMaxRssi == aRhs.mMaxRssi;
+}
+
+bool operator==(const otbr::DBus::JoinerEntry &aLhs, const otbr::DBus::JoinerEntry &aRhs)
+{
+    return aLhs.mEui64 == aRhs.mEui64 && aLhs.mDiscerner == aRhs.mDiscerner &&
+           aLhs.mDiscernerLength == aRhs.mDiscernerLength && aLhs.mPskd == aRhs.mPskd && aLhs.mTimeout == aRhs.mTimeout;
+}
+
+bool operator==(const otbr::DBus::JoinerEvent &aLhs, const otbr::DBus::JoinerEvent &aRhs)
+{
+    return aLhs.mEvent == aRhs.mEvent && aLhs.mEui64 == aRhs.mEui64 && aLhs.mDiscerner == aRhs.mDiscerner &&
+           aLhs.mDiscernerLength == aRhs.mDiscernerLength && aLhs.mJoinerId == aRhs.mJoinerId;
+}
+
+bool operator==(const otbr::DBus::ChurnEvent &aLhs, const otbr::DBus::ChurnEvent &aRhs)
+{
+    return aLhs.mEvent == aRhs.mEvent && aLhs.mTimestamp == aRhs.mTimestamp && aLhs.mExtAddress == aRhs.mExtAddress &&
+           aLhs.mRloc16 == aRhs.mRloc16 && aLhs.mValue == aRhs.mValue;
+}
+
+bool operator==(const otbr::DBus::MainloopComponentStats &aLhs, const otbr::DBus::MainloopComponentStats &aRhs)
+{
+    return aLhs.mName == aRhs.mName && aLhs.mCount == aRhs.mCount && aLhs.mTotalUs == aRhs.mTotalUs &&
+           aLhs.mMaxUs == aRhs.mMaxUs && aLhs.mStallCount == aRhs.mStallCount && aLhs.mHistogram == aRhs.mHistogram;
+}
+
+bool operator==(const otbr::DBus::RcpLinkStats &aLhs, const otbr::DBus::RcpLinkStats &aRhs)
+{
+    return aLhs.mTxFrames == aRhs.mTxFrames && aLhs.mRxFrames == aRhs.mRxFrames &&
+           aLhs.mTxFrameRate == aRhs.mTxFrameRate && aLhs.mRxFrameRate == aRhs.mRxFrameRate &&
+           aLhs.mTxRetries == aRhs.mTxRetries && aLhs.mTxBytes == aRhs.mTxBytes && aLhs.mRxBytes == aRhs.mRxBytes &&
+           aLhs.mTxByteRate == aRhs.mTxByteRate && aLhs.mRxByteRate == aRhs.mRxByteRate &&
+           aLhs.mUartOverruns == aRhs.mUartOverruns && aLhs.mUartFrameErrors == aRhs.mUartFrameErrors &&
+           aLhs.mTimeouts == aRhs.mTimeouts && aLhs.mLatencyCount == aRhs.mLatencyCount &&
+           aLhs.mLatencyTotalUs == aRhs.mLatencyTotalUs && aLhs.mLatencyMaxUs == aRhs.mLatencyMaxUs &&
+           aLhs.mLatencyHistogram == aRhs.mLatencyHistogram;
+}
+
+bool operator==(const otbr::DBus::MemoryUsage &aLhs, const otbr::DBus::MemoryUsage &aRhs)
+{
+    return aLhs.mSubsystem == aRhs.mSubsystem && aLhs.mCurrentBytes == aRhs.mCurrentBytes &&
+           aLhs.mPeakBytes == aRhs.mPeakBytes && aLhs.mAllocations == aRhs.mAllocations;
+}
+
+bool operator==(const otbr::DBus::MetricSample &aLhs, const otbr::DBus::MetricSample &aRhs)
+{
+    return aLhs.mName == aRhs.mName && aLhs.mLabels == aRhs.mLabels && aLhs.mValue == aRhs.mValue;
+}
+
 bool operator==(const otbr::DBus::ChildInfo &aLhs, const otbr::DBus::ChildInfo &aRhs)
 {
     return aLhs.mExtAddress == aRhs.mExtAddress && aLhs.mTimeout == aRhs.mTimeout && aLhs.mAge == aRhs.mAge &&
@@ -178,6 +235,23 @@ TEST(DBusMessage, TestVectorMessage)
     dbus_message_unref(msg);
 }
 
+TEST(DBusMessage, TestVectorMessageOverwritesValues)
+{
+    DBusMessage *                                           msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    tuple<vector<int8_t>, vector<uint16_t>, vector<string>> setVals({-1, 0, 1}, {}, {"a"});
+    tuple<vector<int8_t>, vector<uint16_t>, vector<string>> getVals({2}, {3, 4}, {"b", "c"});
+
+    CHECK(msg != nullptr);
+
+    CHECK(TupleToDBusMessage(*msg, setVals) == OTBR_ERROR_NONE);
+    CHECK(DBusMessageToTuple(*msg, getVals) == OTBR_ERROR_NONE);
+
+    // An empty array must clear the previous value.
+    CHECK(setVals == getVals);
+
+    dbus_message_unref(msg);
+}
+
 TEST(DBusMessage, TestArrayMessage)
 {
     DBusMessage *            msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
@@ -247,6 +321,179 @@ TEST(DBusMessage, TestOtbrChannelQuality)
     dbus_message_unref(msg);
 }
 
+TEST(DBusMessage, TestOtbrEnergyScanResults)
+{
+    DBusMessage *                                    msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    tuple<std::vector<otbr::DBus::EnergyScanResult>> setVals({{11, -90}, {26, 0}});
+    tuple<std::vector<otbr::DBus::EnergyScanResult>> getVals;
+
+    CHECK(msg != nullptr);
+
+    CHECK(TupleToDBusMessage(*msg, setVals) == OTBR_ERROR_NONE);
+    CHECK(DBusMessageToTuple(*msg, getVals) == OTBR_ERROR_NONE);
+
+    CHECK(std::get<0>(getVals).size() == 2);
+    CHECK(std::get<0>(setVals)[0] == std::get<0>(getVals)[0]);
+    CHECK(std::get<0>(setVals)[1] == std::get<0>(getVals)[1]);
+
+    dbus_message_unref(msg);
+}
+
+TEST(DBusMessage, TestOtbrChannelSurvey)
+{
+    DBusMessage *                          msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    tuple<otbr::DBus::ChannelSurvey>       setVals;
+    tuple<otbr::DBus::ChannelSurvey>       getVals;
+    const otbr::DBus::ChannelSurvey &      setSurvey = std::get<0>(setVals);
+    const otbr::DBus::ChannelSurvey &      getSurvey = std::get<0>(getVals);
+    std::vector<otbr::DBus::ChannelReport> channels({{11, 0x1000, -72}, {26, 0, 127}});
+
+    CHECK(msg != nullptr);
+
+    std::get<0>(setVals).mChannels            = channels;
+    std::get<0>(setVals).mSampleCount         = 4096;
+    std::get<0>(setVals).mCcaFailureRate      = 0x0800;
+    std::get<0>(setVals).mTimestamp           = 1602720000123ULL;
+    std::get<0>(setVals).mEnergyScanTimestamp = 1602719990456ULL;
+
+    CHECK(TupleToDBusMessage(*msg, setVals) == OTBR_ERROR_NONE);
+    CHECK(DBusMessageToTuple(*msg, getVals) == OTBR_ERROR_NONE);
+
+    CHECK(getSurvey.mChannels.size() == 2);
+    CHECK(setSurvey.mChannels[0] == getSurvey.mChannels[0]);
+    CHECK(setSurvey.mChannels[1] == getSurvey.mChannels[1]);
+    CHECK(setSurvey.mSampleCount == getSurvey.mSampleCount);
+    CHECK(setSurvey.mCcaFailureRate == getSurvey.mCcaFailureRate);
+    CHECK(setSurvey.mTimestamp == getSurvey.mTimestamp);
+    CHECK(setSurvey.mEnergyScanTimestamp == getSurvey.mEnergyScanTimestamp);
+
+    dbus_message_unref(msg);
+}
+
+TEST(DBusMessage, TestOtbrJoinerEntries)
+{
+    DBusMessage *                               msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    tuple<std::vector<otbr::DBus::JoinerEntry>> setVals(
+        {{0x1122334455667788, 0, 0, "J01NME", 120}, {0, 0xabc, 12, "PSKD02", 0}});
+    tuple<std::vector<otbr::DBus::JoinerEntry>> getVals;
+
+    CHECK(msg != nullptr);
+
+    CHECK(TupleToDBusMessage(*msg, setVals) == OTBR_ERROR_NONE);
+    CHECK(DBusMessageToTuple(*msg, getVals) == OTBR_ERROR_NONE);
+
+    CHECK(std::get<0>(getVals).size() == 2);
+    CHECK(std::get<0>(setVals)[0] == std::get<0>(getVals)[0]);
+    CHECK(std::get<0>(setVals)[1] == std::get<0>(getVals)[1]);
+
+    dbus_message_unref(msg);
+}
+
+TEST(DBusMessage, TestOtbrJoinerEvent)
+{
+    DBusMessage *                  msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    tuple<otbr::DBus::JoinerEvent> setVals({"connected", 0x1122334455667788, 0, 0, 0x0102030405060708});
+    tuple<otbr::DBus::JoinerEvent> getVals;
+
+    CHECK(msg != nullptr);
+
+    CHECK(TupleToDBusMessage(*msg, setVals) == OTBR_ERROR_NONE);
+    CHECK(DBusMessageToTuple(*msg, getVals) == OTBR_ERROR_NONE);
+
+    CHECK(std::get<0>(setVals) == std::get<0>(getVals));
+
+    dbus_message_unref(msg);
+}
+
+TEST(DBusMessage, TestOtbrChurnEvents)
+{
+    DBusMessage *                                        msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    tuple<std::vector<otbr::DBus::ChurnEvent>, uint32_t> setVals(
+        {{"ChildAdded", 1000, 0x1122334455667788, 0x0401, 0}, {"PartitionChanged", 2000, 0, 0x0400, 0x12345678}}, 3);
+    tuple<std::vector<otbr::DBus::ChurnEvent>, uint32_t> getVals;
+
+    CHECK(msg != nullptr);
+
+    CHECK(TupleToDBusMessage(*msg, setVals) == OTBR_ERROR_NONE);
+    CHECK(DBusMessageToTuple(*msg, getVals) == OTBR_ERROR_NONE);
+
+    CHECK(std::get<0>(getVals).size() == 2);
+    CHECK(std::get<0>(setVals)[0] == std::get<0>(getVals)[0]);
+    CHECK(std::get<0>(setVals)[1] == std::get<0>(getVals)[1]);
+    CHECK(std::get<1>(setVals) == std::get<1>(getVals));
+
+    dbus_message_unref(msg);
+}
+
+TEST(DBusMessage, TestOtbrMainloopComponentStats)
+{
+    DBusMessage *                                          msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    tuple<std::vector<otbr::DBus::MainloopComponentStats>> setVals({{"rest.Process", 1, 2, 3, 4, {5, 6, 7}}});
+    tuple<std::vector<otbr::DBus::MainloopComponentStats>> getVals;
+
+    CHECK(msg != nullptr);
+
+    CHECK(TupleToDBusMessage(*msg, setVals) == OTBR_ERROR_NONE);
+    CHECK(DBusMessageToTuple(*msg, getVals) == OTBR_ERROR_NONE);
+
+    CHECK(std::get<0>(setVals)[0] == std::get<0>(getVals)[0]);
+
+    dbus_message_unref(msg);
+}
+
+TEST(DBusMessage, TestOtbrRcpLinkStats)
+{
+    DBusMessage *                   msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    tuple<otbr::DBus::RcpLinkStats> setVals({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, {16, 17}});
+    tuple<otbr::DBus::RcpLinkStats> getVals;
+
+    CHECK(msg != nullptr);
+
+    CHECK(TupleToDBusMessage(*msg, setVals) == OTBR_ERROR_NONE);
+    CHECK(DBusMessageToTuple(*msg, getVals) == OTBR_ERROR_NONE);
+
+    CHECK(std::get<0>(setVals) == std::get<0>(getVals));
+
+    dbus_message_unref(msg);
+}
+
+TEST(DBusMessage, TestOtbrMemoryUsage)
+{
+    DBusMessage *                               msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    tuple<std::vector<otbr::DBus::MemoryUsage>> setVals({{"rest", 1, 2, 3}, {"mdns", 4, 5, 6}});
+    tuple<std::vector<otbr::DBus::MemoryUsage>> getVals;
+
+    CHECK(msg != nullptr);
+
+    CHECK(TupleToDBusMessage(*msg, setVals) == OTBR_ERROR_NONE);
+    CHECK(DBusMessageToTuple(*msg, getVals) == OTBR_ERROR_NONE);
+
+    CHECK(std::get<0>(getVals).size() == 2);
+    CHECK(std::get<0>(setVals)[0] == std::get<0>(getVals)[0]);
+    CHECK(std::get<0>(setVals)[1] == std::get<0>(getVals)[1]);
+
+    dbus_message_unref(msg);
+}
+
+TEST(DBusMessage, TestOtbrMetricSample)
+{
+    DBusMessage *                                msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
+    tuple<std::vector<otbr::DBus::MetricSample>> setVals({{"otbr_srp_updates_total", "", 1},
+                                                          {"otbr_srp_update_results_total", "result=\"success\"", 2}});
+    tuple<std::vector<otbr::DBus::MetricSample>> getVals;
+
+    CHECK(msg != nullptr);
+
+    CHECK(TupleToDBusMessage(*msg, setVals) == OTBR_ERROR_NONE);
+    CHECK(DBusMessageToTuple(*msg, getVals) == OTBR_ERROR_NONE);
+
+    CHECK(std::get<0>(getVals).size() == 2);
+    CHECK(std::get<0>(setVals)[0] == std::get<0>(getVals)[0]);
+    CHECK(std::get<0>(setVals)[1] == std::get<0>(getVals)[1]);
+
+    dbus_message_unref(msg);
+}
+
 TEST(DBusMessage, TestOtbrChildInfo)
 {
     DBusMessage *                             msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_RETURN);
@@ -328,3 +575,57 @@ TEST(DBusMessage, TestOtbrExternalRoute)
 
     dbus_message_unref(msg);
 }
+
+TEST(DBusMessage, TestOtbrNetworkDataUpdate)
+{
+    DBusMessage *            msg = dbus_message_new(DBUS_MESSAGE_TYPE_METHOD_CALL);
+    otbr::DBus::Ip6Prefix    prefix({{0xfd, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06}, 64});
+    otbr::DBus::OnMeshPrefix onMeshPrefix;
+    tuple<std::vector<otbr::DBus::OnMeshPrefix>, std::vector<otbr::DBus::Ip6Prefix>,
+          std::vector<otbr::DBus::ExternalRoute>, std::vector<otbr::DBus::Ip6Prefix>>
+        setVals;
+    tuple<std::vector<otbr::DBus::OnMeshPrefix>, std::vector<otbr::DBus::Ip6Prefix>,
+          std::vector<otbr::DBus::ExternalRoute>, std::vector<otbr::DBus::Ip6Prefix>>
+        getVals;
+
+    onMeshPrefix.mPrefix       = prefix;
+    onMeshPrefix.mPreference   = 1;
+    onMeshPrefix.mPreferred    = true;
+    onMeshPrefix.mSlaac        = true;
+    onMeshPrefix.mDhcp         = false;
+    onMeshPrefix.mConfigure    = false;
+    onMeshPrefix.mDefaultRoute = true;
+    onMeshPrefix.mOnMesh       = true;
+    onMeshPrefix.mStable       = true;
+
+    std::get<0>(setVals).push_back(onMeshPrefix);
+    std::get<1>(setVals).push_back(prefix);
+    std::get<3>(setVals).push_back(prefix);
+    std::get<3>(setVals).push_back(prefix);
+
+    CHECK(msg != nullptr);
+    STRCMP_EQUAL("a((ayy)y(bbbbbbb))",
+                 otbr::DBus::DBusTypeTrait<std::vector<otbr::DBus::OnMeshPrefix>>::TYPE_AS_STRING);
+    STRCMP_EQUAL("a(ayy)", otbr::DBus::DBusTypeTrait<std::vector<otbr::DBus::Ip6Prefix>>::TYPE_AS_STRING);
+
+    CHECK(TupleToDBusMessage(*msg, setVals) == OTBR_ERROR_NONE);
+    CHECK(DBusMessageToTuple(*msg, getVals) == OTBR_ERROR_NONE);
+
+    CHECK_EQUAL(1, std::get<0>(getVals).size());
+    CHECK(std::get<0>(getVals)[0].mPrefix == prefix);
+    CHECK_EQUAL(1, std::get<0>(getVals)[0].mPreference);
+    CHECK(std::get<0>(getVals)[0].mPreferred);
+    CHECK(std::get<0>(getVals)[0].mSlaac);
+    CHECK(!std::get<0>(getVals)[0].mDhcp);
+    CHECK(!std::get<0>(getVals)[0].mConfigure);
+    CHECK(std::get<0>(getVals)[0].mDefaultRoute);
+    CHECK(std::get<0>(getVals)[0].mOnMesh);
+    CHECK(std::get<0>(getVals)[0].mStable);
+    CHECK_EQUAL(1, std::get<1>(getVals).size());
+    CHECK(std::get<1>(getVals)[0] == prefix);
+    CHECK(std::get<2>(getVals).empty());
+    CHECK_EQUAL(2, std::get<3>(getVals).size());
+    CHECK(std::get<3>(getVals)[1] == prefix);
+
+    dbus_message_unref(msg);
+}
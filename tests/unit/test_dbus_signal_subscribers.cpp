@@ -0,0 +1,154 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "dbus/server/dbus_signal_subscribers.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::DBus::SignalSubscribers;
+
+static const char *kPath      = "/io/openthread/BorderRouter/wpan0";
+static const char *kInterface = "io.openthread.BorderRouter";
+
+TEST_GROUP(DBusSignalSubscribers)
+{
+    SignalSubscribers mSubscribers;
+
+    void setup() { mSubscribers.SetOwnNames({"io.openthread.BorderRouter.wpan0", ":1.7"}); }
+};
+
+TEST(DBusSignalSubscribers, TestSubscribedWithoutMonitor)
+{
+    CHECK_FALSE(mSubscribers.IsMonitoring());
+    CHECK_FALSE(mSubscribers.Matches(kPath, kInterface, "ScanResult"));
+
+    // Without knowing the subscribers, every signal is sent.
+    CHECK(mSubscribers.IsSubscribed(kPath, kInterface, "ScanResult"));
+}
+
+TEST(DBusSignalSubscribers, TestMatchInterfaceAndMember)
+{
+    mSubscribers.AddMatch(":1.10", "type='signal',interface='io.openthread.BorderRouter',member='ChildTableChanged'");
+
+    CHECK(mSubscribers.Matches(kPath, kInterface, "ChildTableChanged"));
+    CHECK_FALSE(mSubscribers.Matches(kPath, kInterface, "NeighborTableChanged"));
+    CHECK_FALSE(mSubscribers.Matches(kPath, "org.freedesktop.DBus.Properties", "ChildTableChanged"));
+
+    mSubscribers.AddMatch(":1.11", "type='signal',interface='io.openthread.BorderRouter'");
+    CHECK(mSubscribers.Matches(kPath, kInterface, "NeighborTableChanged"));
+}
+
+TEST(DBusSignalSubscribers, TestMatchTypeAndDestination)
+{
+    mSubscribers.AddMatch(":1.10", "type='method_call',interface='io.openthread.BorderRouter'");
+    mSubscribers.AddMatch(":1.10", "type='signal',destination=':1.10'");
+    CHECK_FALSE(mSubscribers.Matches(kPath, kInterface, "ScanResult"));
+
+    // A rule without a type matches signals too.
+    mSubscribers.AddMatch(":1.10", "interface='io.openthread.BorderRouter'");
+    CHECK(mSubscribers.Matches(kPath, kInterface, "ScanResult"));
+}
+
+TEST(DBusSignalSubscribers, TestMatchSender)
+{
+    mSubscribers.AddMatch(":1.10", "type='signal',sender='org.freedesktop.NetworkManager'");
+    CHECK_FALSE(mSubscribers.Matches(kPath, kInterface, "ScanResult"));
+
+    mSubscribers.AddMatch(":1.10", "type='signal',sender=':1.7'");
+    CHECK(mSubscribers.Matches(kPath, kInterface, "ScanResult"));
+
+    mSubscribers.RemoveMatch(":1.10", "type='signal',sender=':1.7'");
+    mSubscribers.AddMatch(":1.10", "type='signal',sender='io.openthread.BorderRouter.wpan0'");
+    CHECK(mSubscribers.Matches(kPath, kInterface, "ScanResult"));
+}
+
+TEST(DBusSignalSubscribers, TestMatchPath)
+{
+    mSubscribers.AddMatch(":1.10", "type='signal',path='/io/openthread/BorderRouter/wpan1'");
+    mSubscribers.AddMatch(":1.10", "type='signal',path_namespace='/io/openthread/Border'");
+    CHECK_FALSE(mSubscribers.Matches(kPath, kInterface, "ScanResult"));
+
+    mSubscribers.AddMatch(":1.10", "type='signal',path_namespace='/io/openthread'");
+    CHECK(mSubscribers.Matches(kPath, kInterface, "ScanResult"));
+
+    mSubscribers.RemoveMatch(":1.10", "type='signal',path_namespace='/io/openthread'");
+    mSubscribers.AddMatch(":1.10", "type='signal',path='/io/openthread/BorderRouter/wpan0'");
+    CHECK(mSubscribers.Matches(kPath, kInterface, "ScanResult"));
+}
+
+TEST(DBusSignalSubscribers, TestMatchArgumentsIgnored)
+{
+    // The argument keys narrow the rule down, matching more signals only sends more of them.
+    mSubscribers.AddMatch(":1.10", "type='signal',interface='org.freedesktop.DBus.Properties',"
+                                   "member='PropertiesChanged',arg0='io.openthread.BorderRouter'");
+    CHECK(mSubscribers.Matches(kPath, "org.freedesktop.DBus.Properties", "PropertiesChanged"));
+}
+
+TEST(DBusSignalSubscribers, TestEscapedValue)
+{
+    mSubscribers.AddMatch(":1.10", "type='signal',member='it'\\''s',interface='io.openthread.BorderRouter'");
+    CHECK(mSubscribers.Matches(kPath, kInterface, "it's"));
+    CHECK_FALSE(mSubscribers.Matches(kPath, kInterface, "its"));
+}
+
+TEST(DBusSignalSubscribers, TestInvalidRuleMatchesAll)
+{
+    mSubscribers.AddMatch(":1.10", "type='signal");
+    CHECK(mSubscribers.Matches(kPath, kInterface, "ScanResult"));
+}
+
+TEST(DBusSignalSubscribers, TestRemoveMatchAndPeer)
+{
+    const char *rule = "type='signal',interface='io.openthread.BorderRouter'";
+
+    // Each AddMatch must be removed, the bus daemon counts them.
+    mSubscribers.AddMatch(":1.10", rule);
+    mSubscribers.AddMatch(":1.10", rule);
+    mSubscribers.RemoveMatch(":1.10", rule);
+    CHECK(mSubscribers.Matches(kPath, kInterface, "ScanResult"));
+    mSubscribers.RemoveMatch(":1.10", rule);
+    CHECK_FALSE(mSubscribers.Matches(kPath, kInterface, "ScanResult"));
+
+    mSubscribers.AddMatch(":1.11", rule);
+    mSubscribers.RemovePeer(":1.11");
+    CHECK_FALSE(mSubscribers.Matches(kPath, kInterface, "ScanResult"));
+}
+
+TEST(DBusSignalSubscribers, TestUnknownPeer)
+{
+    mSubscribers.AddUnknownPeer(":1.12");
+    CHECK(mSubscribers.Matches(kPath, kInterface, "ScanResult"));
+
+    // Its rules are still unknown after one of them is removed.
+    mSubscribers.AddMatch(":1.12", "type='signal',member='Other'");
+    mSubscribers.RemoveMatch(":1.12", "type='signal',member='Other'");
+    CHECK(mSubscribers.Matches(kPath, kInterface, "ScanResult"));
+
+    mSubscribers.RemovePeer(":1.12");
+    CHECK_FALSE(mSubscribers.Matches(kPath, kInterface, "ScanResult"));
+}
@@ -0,0 +1,137 @@
+/*
+ *    Copyright (c) 2017, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/event_bus.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+#include <string.h>
+
+enum
+{
+    kEventNone,
+    kEventName,
+    kEventPair,
+};
+
+typedef otbr::EventBus<otbr::Event<>, otbr::Event<const char *>, otbr::Event<int, bool>> TestEventBus;
+
+static int sCounter = 0;
+
+static void HandleNone(void *aContext)
+{
+    sCounter++;
+    CHECK(aContext == nullptr);
+}
+
+static void HandleName(void *aContext, const char *aName)
+{
+    sCounter++;
+    STRCMP_EQUAL(static_cast<const char *>(aContext), aName);
+}
+
+static void HandlePair(void *aContext, int aNumber, bool aFlag)
+{
+    // The context is the position this handler is expected to be called in.
+    ++sCounter;
+    CHECK_EQUAL(*static_cast<int *>(aContext), sCounter);
+    CHECK_EQUAL(42, aNumber);
+    CHECK(aFlag);
+}
+
+TEST_GROUP(EventBus){};
+
+TEST(EventBus, TestEmitTypedArguments)
+{
+    TestEventBus bus;
+    char         name[] = "OpenThread";
+
+    sCounter = 0;
+
+    bus.On<kEventNone>(HandleNone, nullptr);
+    bus.On<kEventName>(HandleName, name);
+
+    bus.Emit<kEventNone>();
+    CHECK_EQUAL(1, sCounter);
+
+    bus.Emit<kEventName>(name);
+    CHECK_EQUAL(2, sCounter);
+
+    // Events without handlers are fine.
+    bus.Emit<kEventPair>(42, true);
+    CHECK_EQUAL(2, sCounter);
+}
+
+TEST(EventBus, TestCallSequence)
+{
+    TestEventBus bus;
+    int          context1 = 1;
+    int          context2 = 2;
+    int          context3 = 3;
+
+    sCounter = 0;
+
+    bus.On<kEventPair>(HandlePair, &context1);
+    bus.On<kEventPair>(HandlePair, &context2);
+    bus.On<kEventPair>(HandlePair, &context3);
+
+    bus.Emit<kEventPair>(42, true);
+    CHECK_EQUAL(3, sCounter);
+}
+
+TEST(EventBus, TestRemoveHandler)
+{
+    TestEventBus bus;
+    int          context1 = 1;
+    int          context2 = 2;
+
+    sCounter = 0;
+
+    bus.On<kEventNone>(HandleNone, nullptr);
+    bus.On<kEventNone>(HandleNone, nullptr);
+    bus.Emit<kEventNone>();
+    CHECK_EQUAL(2, sCounter);
+
+    bus.Off<kEventNone>(HandleNone, nullptr);
+    bus.Emit<kEventNone>();
+    CHECK_EQUAL(3, sCounter);
+
+    bus.Off<kEventNone>(HandleNone, nullptr);
+    bus.Emit<kEventNone>();
+    CHECK_EQUAL(3, sCounter);
+
+    // Removing the first handler keeps the order of the others.
+    bus.On<kEventPair>(HandlePair, &context2);
+    bus.On<kEventPair>(HandlePair, &context1);
+    bus.On<kEventPair>(HandlePair, &context2);
+    bus.Off<kEventPair>(HandlePair, &context2);
+
+    sCounter = 0;
+    bus.Emit<kEventPair>(42, true);
+    CHECK_EQUAL(2, sCounter);
+}
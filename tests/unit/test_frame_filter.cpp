@@ -0,0 +1,97 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "utils/frame_filter.hpp"
+
+using otbr::Utils::FrameFilter;
+
+// A data frame with a PAN ID and short addresses.
+static const uint8_t kDataFrame[] = {0x41, 0x88, 0x01, 0xcd, 0xab, 0xff, 0xff, 0x00, 0x04, 0x00, 0x00};
+
+// An acknowledgment.
+static const uint8_t kAckFrame[] = {0x02, 0x00, 0x01, 0x00, 0x00};
+
+TEST_GROUP(FrameFilter){};
+
+TEST(FrameFilter, Empty)
+{
+    FrameFilter filter;
+
+    CHECK(filter.IsEmpty());
+    CHECK(filter.Match(kAckFrame, sizeof(kAckFrame), -50, false));
+    CHECK(filter.Parse(nullptr) == OTBR_ERROR_NONE);
+    CHECK(filter.Parse("  ") == OTBR_ERROR_NONE);
+    CHECK(filter.IsEmpty());
+}
+
+TEST(FrameFilter, Terms)
+{
+    FrameFilter filter;
+
+    CHECK(filter.Parse("rx type=data") == OTBR_ERROR_NONE);
+    CHECK(filter.Match(kDataFrame, sizeof(kDataFrame), -50, false));
+    CHECK(!filter.Match(kDataFrame, sizeof(kDataFrame), -50, true));
+    CHECK(!filter.Match(kAckFrame, sizeof(kAckFrame), -50, false));
+
+    CHECK(filter.Parse("type!=ack rssi>=-70 len<=20") == OTBR_ERROR_NONE);
+    CHECK(filter.Match(kDataFrame, sizeof(kDataFrame), -70, false));
+    CHECK(!filter.Match(kDataFrame, sizeof(kDataFrame), -71, false));
+    CHECK(!filter.Match(kAckFrame, sizeof(kAckFrame), -50, false));
+
+    // The destination PAN ID, with the PAN ID compression bit.
+    CHECK(filter.Parse("frame[0]&0x40=0x40 frame[3]=0xcd frame[4]=0xab") == OTBR_ERROR_NONE);
+    CHECK(filter.Match(kDataFrame, sizeof(kDataFrame), 0, true));
+    CHECK(!filter.Match(kAckFrame, sizeof(kAckFrame), 0, true));
+
+    // A byte past the end of the frame never matches.
+    CHECK(filter.Parse("frame[20]!=0") == OTBR_ERROR_NONE);
+    CHECK(!filter.Match(kDataFrame, sizeof(kDataFrame), 0, false));
+}
+
+TEST(FrameFilter, Invalid)
+{
+    FrameFilter filter;
+
+    CHECK(filter.Parse("tx") == OTBR_ERROR_NONE);
+
+    CHECK(filter.Parse("foo") == OTBR_ERROR_INVALID_ARGS);
+    CHECK(filter.Parse("type=beacons") == OTBR_ERROR_INVALID_ARGS);
+    CHECK(filter.Parse("type>=data") == OTBR_ERROR_INVALID_ARGS);
+    CHECK(filter.Parse("len>=") == OTBR_ERROR_INVALID_ARGS);
+    CHECK(filter.Parse("rssi<=-200") == OTBR_ERROR_INVALID_ARGS);
+    CHECK(filter.Parse("frame[1=2") == OTBR_ERROR_INVALID_ARGS);
+    CHECK(filter.Parse("frame[1]|3=2") == OTBR_ERROR_INVALID_ARGS);
+    CHECK(filter.Parse("frame[200]=2") == OTBR_ERROR_INVALID_ARGS);
+    CHECK(filter.Parse("rx len<5") == OTBR_ERROR_INVALID_ARGS);
+
+    // A malformed expression leaves the filter unchanged.
+    CHECK(!filter.Match(kAckFrame, sizeof(kAckFrame), 0, false));
+    CHECK(filter.Match(kAckFrame, sizeof(kAckFrame), 0, true));
+}
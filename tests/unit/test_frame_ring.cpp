@@ -0,0 +1,190 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <string.h>
+
+#include <atomic>
+#include <thread>
+
+#include "utils/frame_ring.hpp"
+
+using otbr::Utils::FrameRing;
+
+TEST_GROUP(FrameRing){};
+
+TEST(FrameRing, WriteAndRead)
+{
+    FrameRing      ring;
+    uint8_t *      record;
+    const uint8_t *read;
+    size_t         length;
+
+    CHECK(ring.Peek(length) == nullptr);
+    CHECK(ring.BeginWrite(1) == nullptr);
+    LONGS_EQUAL(1, ring.GetDropCount());
+
+    CHECK(ring.Init(1000) == OTBR_ERROR_NONE);
+    LONGS_EQUAL(4096, ring.GetSize());
+    CHECK(ring.IsEmpty());
+
+    record = ring.BeginWrite(5);
+    CHECK(record != nullptr);
+    LONGS_EQUAL(0, reinterpret_cast<uintptr_t>(record) % 8);
+    memcpy(record, "hello", 5);
+    CHECK(ring.IsEmpty());
+    ring.CommitWrite();
+    CHECK(!ring.IsEmpty());
+
+    read = ring.Peek(length);
+    CHECK(read != nullptr);
+    LONGS_EQUAL(5, length);
+    MEMCMP_EQUAL("hello", read, length);
+    ring.Consume();
+    CHECK(ring.IsEmpty());
+}
+
+TEST(FrameRing, DropAndWrap)
+{
+    FrameRing      ring;
+    const uint8_t *read;
+    size_t         length;
+
+    CHECK(ring.Init(4096) == OTBR_ERROR_NONE);
+
+    // A record larger than half of the ring is never accepted.
+    CHECK(ring.BeginWrite(2048) == nullptr);
+    LONGS_EQUAL(1, ring.GetDropCount());
+
+    // Three records of 1504 bytes fill the ring before the third one.
+    for (uint8_t i = 0; i < 2; i++)
+    {
+        uint8_t *record = ring.BeginWrite(1496);
+
+        CHECK(record != nullptr);
+        memset(record, i, 1496);
+        ring.CommitWrite();
+    }
+
+    CHECK(ring.BeginWrite(1496) == nullptr);
+    LONGS_EQUAL(2, ring.GetDropCount());
+
+    read = ring.Peek(length);
+    LONGS_EQUAL(1496, length);
+    LONGS_EQUAL(0, read[0]);
+    ring.Consume();
+
+    // The next record does not fit before the end of the mapping and is written at its start.
+    {
+        uint8_t *record = ring.BeginWrite(1496);
+
+        CHECK(record != nullptr);
+        memset(record, 2, 1496);
+        ring.CommitWrite();
+    }
+
+    for (uint8_t i = 1; i < 3; i++)
+    {
+        read = ring.Peek(length);
+        CHECK(read != nullptr);
+        LONGS_EQUAL(1496, length);
+        LONGS_EQUAL(i, read[length - 1]);
+        ring.Consume();
+    }
+
+    CHECK(ring.IsEmpty());
+    LONGS_EQUAL(2, ring.GetDropCount());
+}
+
+TEST(FrameRing, ProducerAndConsumerThreads)
+{
+    static constexpr uint32_t kRecords = 200000;
+
+    FrameRing         ring;
+    uint32_t          written  = 0;
+    uint32_t          consumed = 0;
+    uint32_t          next     = 0;
+    bool              ordered  = true;
+    std::atomic<bool> done(false);
+    std::thread       producer;
+
+    CHECK(ring.Init(8192) == OTBR_ERROR_NONE);
+
+    producer = std::thread([&ring, &written, &done]() {
+        for (uint32_t i = 0; i < kRecords; i++)
+        {
+            size_t   length = sizeof(i) + 1 + i % 120;
+            uint8_t *record = ring.BeginWrite(length);
+
+            if (record != nullptr)
+            {
+                memcpy(record, &i, sizeof(i));
+                memset(record + sizeof(i), static_cast<uint8_t>(i), length - sizeof(i));
+                ring.CommitWrite();
+                written++;
+            }
+        }
+
+        done.store(true);
+    });
+
+    while (true)
+    {
+        size_t         length;
+        const uint8_t *record;
+        uint32_t       value;
+
+        // The producer is done before the last check that the ring is empty.
+        bool finished = done.load();
+
+        record = ring.Peek(length);
+        if (record == nullptr)
+        {
+            if (finished)
+            {
+                break;
+            }
+
+            continue;
+        }
+
+        memcpy(&value, record, sizeof(value));
+        ordered = ordered && value >= next && length == sizeof(value) + 1 + value % 120 &&
+                  record[length - 1] == static_cast<uint8_t>(value);
+        next = value + 1;
+        consumed++;
+        ring.Consume();
+    }
+
+    producer.join();
+
+    CHECK(ordered);
+    LONGS_EQUAL(written, consumed);
+    LONGS_EQUAL(kRecords, written + ring.GetDropCount());
+}
@@ -0,0 +1,130 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <ctype.h>
+#include <string.h>
+
+#include "utils/hex.hpp"
+
+// Longer than two vector blocks so that both the vector and the scalar paths are covered.
+static const size_t kMaxLength = 40;
+
+TEST_GROUP(Hex){};
+
+TEST(Hex, TestEncode)
+{
+    const uint8_t bytes[] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef};
+    char          hex[2 * sizeof(bytes) + 1];
+    std::string   output = "\"";
+
+    CHECK(otbr::Utils::Bytes2Hex(bytes, sizeof(bytes), hex) == 16);
+    STRCMP_EQUAL("0123456789ABCDEF", hex);
+
+    CHECK(otbr::Utils::EncodeHex(bytes, sizeof(bytes), hex, /* aLowerCase */ true) == 16);
+    STRCMP_EQUAL("0123456789abcdef", hex);
+
+    otbr::Utils::AppendHex(bytes, 2, output);
+    STRCMP_EQUAL("\"0123", output.c_str());
+
+    CHECK(otbr::Utils::Long2Hex(0x0123456789abcdefULL, hex) == 16);
+    STRCMP_EQUAL("EFCDAB8967452301", hex);
+}
+
+TEST(Hex, TestDecode)
+{
+    uint8_t bytes[4];
+
+    CHECK(otbr::Utils::Hex2Bytes("c0FFee", bytes, sizeof(bytes)) == 3);
+    CHECK(bytes[0] == 0xc0 && bytes[1] == 0xff && bytes[2] == 0xee);
+
+    // An odd number of digits leaves the first byte with a single digit.
+    CHECK(otbr::Utils::Hex2Bytes("abcde", bytes, sizeof(bytes)) == 3);
+    CHECK(bytes[0] == 0x0a && bytes[1] == 0xbc && bytes[2] == 0xde);
+
+    CHECK(otbr::Utils::Hex2Bytes("", bytes, sizeof(bytes)) == 0);
+    CHECK(otbr::Utils::Hex2Bytes("0011223344", bytes, sizeof(bytes)) == -1);
+    CHECK(otbr::Utils::Hex2Bytes("0g", bytes, sizeof(bytes)) == -1);
+    CHECK(otbr::Utils::DecodeHex("12zz", 2, bytes, sizeof(bytes)) == 1);
+}
+
+TEST(Hex, TestRoundTrip)
+{
+    uint8_t bytes[kMaxLength];
+    uint8_t decoded[kMaxLength];
+    char    hex[2 * kMaxLength];
+
+    for (size_t i = 0; i < kMaxLength; i++)
+    {
+        bytes[i] = static_cast<uint8_t>(i * 151 + 7);
+    }
+
+    for (size_t length = 0; length <= kMaxLength; length++)
+    {
+        for (bool lowerCase : {false, true})
+        {
+            CHECK(otbr::Utils::EncodeHex(bytes, length, hex, lowerCase) == 2 * length);
+
+            for (size_t i = 0; i < length; i++)
+            {
+                char high = "0123456789ABCDEF"[bytes[i] >> 4];
+                char low  = "0123456789ABCDEF"[bytes[i] & 0xf];
+
+                CHECK(hex[2 * i] == (lowerCase ? tolower(high) : high));
+                CHECK(hex[2 * i + 1] == (lowerCase ? tolower(low) : low));
+            }
+
+            CHECK(otbr::Utils::DecodeHex(hex, 2 * length, decoded, sizeof(decoded)) == static_cast<int>(length));
+            CHECK(memcmp(bytes, decoded, length) == 0);
+        }
+    }
+}
+
+TEST(Hex, TestDecodeRejectsEveryPosition)
+{
+    const char kInvalid[] = {'/', ':', '@', 'G', '`', 'g', ' ', '\x80', '\xff'};
+    char       hex[2 * kMaxLength];
+    uint8_t    bytes[kMaxLength];
+
+    memset(hex, 'a', sizeof(hex));
+
+    for (size_t position = 0; position < sizeof(hex); position++)
+    {
+        for (char invalid : kInvalid)
+        {
+            char saved = hex[position];
+
+            hex[position] = invalid;
+            CHECK(otbr::Utils::DecodeHex(hex, sizeof(hex), bytes, sizeof(bytes)) == -1);
+            hex[position] = saved;
+        }
+    }
+
+    CHECK(otbr::Utils::DecodeHex(hex, sizeof(hex), bytes, sizeof(bytes)) == static_cast<int>(kMaxLength));
+}
@@ -0,0 +1,126 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <assert.h>
+#include <unordered_set>
+
+#include "common/types.hpp"
+
+using otbr::Ip6Address;
+using otbr::Ip6Prefix;
+
+static Ip6Address Addr(const char *aAddress)
+{
+    Ip6Address address;
+    otbrError  error = Ip6Address::FromString(aAddress, address);
+
+    assert(error == OTBR_ERROR_NONE);
+    (void)error;
+
+    return address;
+}
+
+static Ip6Prefix MakePrefix(const char *aPrefix, uint8_t aLength)
+{
+    Ip6Prefix prefix;
+
+    prefix.mPrefix = Addr(aPrefix);
+    prefix.mLength = aLength;
+
+    return prefix;
+}
+
+TEST_GROUP(Ip6Address){};
+
+TEST(Ip6Address, TestMatchesPrefix)
+{
+    Ip6Address address = Addr("fd00:1234:5678:9abc:1:2:3:4");
+
+    CHECK(address.MatchesPrefix(Addr("fd00::"), 8));
+    CHECK(address.MatchesPrefix(Addr("fd00:1234::"), 32));
+    CHECK(address.MatchesPrefix(Addr("fd00:1234:5678:9abc::"), 64));
+    CHECK(address.MatchesPrefix(Addr("fd00:1234:5678:9abc:1::"), 79));
+    CHECK(address.MatchesPrefix(address, 128));
+    CHECK(address.MatchesPrefix(Addr("::"), 0));
+
+    CHECK_FALSE(address.MatchesPrefix(Addr("fd00:1234:5678:9abd::"), 64));
+    CHECK_FALSE(address.MatchesPrefix(Addr("fd00:1234:5678:9abc:1:2:3:5"), 128));
+    CHECK_FALSE(address.MatchesPrefix(Addr("fc00::"), 8));
+    CHECK(address.MatchesPrefix(Addr("fc00::"), 7));
+}
+
+TEST(Ip6Address, TestSolicitedNodeMulticastAddress)
+{
+    Ip6Address address  = Addr("fd00::1:2:abcd:ef12");
+    Ip6Address expected = Addr("ff02::1:ffcd:ef12");
+
+    CHECK(address.ToSolicitedNodeMulticastAddress() == expected);
+    CHECK(expected.IsSolicitedNodeMulticastAddressOf(address));
+    CHECK_FALSE(expected.IsSolicitedNodeMulticastAddressOf(Addr("fd00::1:2:abcd:ef13")));
+}
+
+TEST(Ip6Address, TestHash)
+{
+    std::unordered_set<Ip6Address> set;
+
+    set.insert(Addr("fd00::1"));
+    set.insert(Addr("fd00::2"));
+    set.insert(Addr("fd00::1"));
+
+    CHECK_EQUAL(2, set.size());
+    CHECK(set.count(Addr("fd00::2")) == 1);
+    CHECK(set.count(Addr("fd00::3")) == 0);
+    CHECK(Addr("fd00::1") != Addr("fd00::2"));
+}
+
+TEST_GROUP(Ip6Prefix){};
+
+TEST(Ip6Prefix, TestContains)
+{
+    Ip6Prefix prefix = MakePrefix("fd00:1234:5678:9abc::", 64);
+
+    CHECK(prefix.Contains(Addr("fd00:1234:5678:9abc::1")));
+    CHECK_FALSE(prefix.Contains(Addr("fd00:1234:5678:9abd::1")));
+}
+
+TEST(Ip6Prefix, TestEqualityIgnoresHostBits)
+{
+    std::unordered_set<Ip6Prefix> set;
+
+    CHECK(MakePrefix("fd00:1234::", 32) == MakePrefix("fd00:1234:ffff::", 32));
+    CHECK_FALSE(MakePrefix("fd00:1234::", 32) == MakePrefix("fd00:1234::", 48));
+    CHECK_FALSE(MakePrefix("fd00:1234::", 32) == MakePrefix("fd00:1235::", 32));
+
+    set.insert(MakePrefix("fd00:1234::", 32));
+    set.insert(MakePrefix("fd00:1234:ffff::", 32));
+    set.insert(MakePrefix("fd00:1234::", 48));
+
+    CHECK_EQUAL(2, set.size());
+}
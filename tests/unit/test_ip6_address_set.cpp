@@ -0,0 +1,128 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <set>
+
+#include "common/ip6_address_set.hpp"
+
+using otbr::Ip6Address;
+using otbr::Ip6AddressSet;
+
+static Ip6Address MakeDua(uint32_t aIid)
+{
+    Ip6Address address;
+
+    address.m8[0]  = 0xfd;
+    address.m8[1]  = 0x00;
+    address.m8[7]  = 0xd0;
+    address.m8[12] = static_cast<uint8_t>(aIid >> 24);
+    address.m8[13] = static_cast<uint8_t>(aIid >> 16);
+    address.m8[14] = static_cast<uint8_t>(aIid >> 8);
+    address.m8[15] = static_cast<uint8_t>(aIid);
+
+    return address;
+}
+
+TEST_GROUP(Ip6AddressSet){};
+
+TEST(Ip6AddressSet, TestInsertAndErase)
+{
+    Ip6AddressSet set;
+
+    CHECK(set.IsEmpty());
+    CHECK(set.Insert(MakeDua(1)));
+    CHECK(!set.Insert(MakeDua(1)));
+    CHECK(set.Insert(MakeDua(2)));
+    CHECK(set.GetSize() == 2);
+
+    CHECK(set.Contains(MakeDua(1)));
+    CHECK(!set.Contains(MakeDua(3)));
+
+    CHECK(set.Erase(MakeDua(1)));
+    CHECK(!set.Erase(MakeDua(1)));
+    CHECK(!set.Contains(MakeDua(1)));
+    CHECK(set.Contains(MakeDua(2)));
+    CHECK(set.GetSize() == 1);
+
+    set.Clear();
+    CHECK(set.IsEmpty());
+    CHECK(!set.Contains(MakeDua(2)));
+}
+
+TEST(Ip6AddressSet, TestSamePrefixDifferentIid)
+{
+    Ip6AddressSet set;
+    Ip6Address    other = MakeDua(1);
+
+    // Addresses which only differ in the prefix share a hash but are distinct members.
+    other.m8[1] = 0x01;
+    CHECK(set.Insert(MakeDua(1)));
+    CHECK(set.Insert(other));
+    CHECK(set.Contains(other));
+    CHECK(set.Erase(MakeDua(1)));
+    CHECK(set.Contains(other));
+}
+
+TEST(Ip6AddressSet, TestChurn)
+{
+    Ip6AddressSet        set;
+    std::set<Ip6Address> expected;
+
+    // Renewals and removals of a large domain, compared against an ordered set.
+    for (uint32_t round = 0; round < 20; ++round)
+    {
+        for (uint32_t i = 0; i < 1000; ++i)
+        {
+            Ip6Address dua = MakeDua((i * 7919 + round * 104729) % 3000);
+
+            if ((i + round) % 3 == 0)
+            {
+                CHECK(set.Erase(dua) == (expected.erase(dua) == 1));
+            }
+            else
+            {
+                CHECK(set.Insert(dua) == expected.insert(dua).second);
+            }
+        }
+
+        CHECK(set.GetSize() == expected.size());
+    }
+
+    for (const Ip6Address &dua : expected)
+    {
+        CHECK(set.Contains(dua));
+    }
+
+    {
+        std::set<Ip6Address> iterated(set.begin(), set.end());
+
+        CHECK(iterated == expected);
+    }
+}
@@ -0,0 +1,123 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "utils/json_writer.hpp"
+
+using otbr::Utils::JsonWriter;
+
+TEST_GROUP(JsonWriter){};
+
+TEST(JsonWriter, NestedContainers)
+{
+    std::string buffer;
+    JsonWriter  writer(buffer);
+
+    writer.BeginObject();
+    writer.UintMember("a", 1);
+    writer.Key("b");
+    writer.BeginArray();
+    writer.BeginObject();
+    writer.EndObject();
+    writer.BeginArray();
+    writer.EndArray();
+    writer.Uint(2);
+    writer.EndArray();
+    writer.StringMember("c", "d");
+    writer.EndObject();
+
+    STRCMP_EQUAL("{\"a\":1,\"b\":[{},[],2],\"c\":\"d\"}", buffer.c_str());
+}
+
+TEST(JsonWriter, Integers)
+{
+    std::string buffer;
+    JsonWriter  writer(buffer);
+
+    writer.BeginArray();
+    writer.Uint(0);
+    writer.Uint(UINT64_MAX);
+    writer.Int(-1);
+    writer.Int(INT64_MIN);
+    writer.Int(0);
+    writer.Int(INT64_MAX);
+    writer.Uint(1000);
+    writer.EndArray();
+
+    STRCMP_EQUAL("[0,18446744073709551615,-1,-9223372036854775808,0,9223372036854775807,1000]", buffer.c_str());
+}
+
+TEST(JsonWriter, EscapeString)
+{
+    std::string buffer;
+    JsonWriter  writer(buffer);
+
+    writer.String("\"\\/\b\f\n\r\t\x01 \xe4\xb8\xad");
+
+    STRCMP_EQUAL("\"\\\"\\\\/\\b\\f\\n\\r\\t\\u0001 \xe4\xb8\xad\"", buffer.c_str());
+}
+
+TEST(JsonWriter, EscapeBetweenRuns)
+{
+    std::string buffer;
+    JsonWriter  writer(buffer);
+
+    writer.BeginArray();
+    writer.String("\nleading");
+    writer.String("trailing\n");
+    writer.String("two\"\"quotes");
+    writer.String("");
+    writer.EndArray();
+
+    STRCMP_EQUAL("[\"\\nleading\",\"trailing\\n\",\"two\\\"\\\"quotes\",\"\"]", buffer.c_str());
+}
+
+TEST(JsonWriter, HexString)
+{
+    std::string   buffer;
+    JsonWriter    writer(buffer);
+    const uint8_t bytes[] = {0x00, 0x1f, 0xab, 0xff};
+
+    writer.BeginArray();
+    writer.HexString(bytes, sizeof(bytes));
+    writer.HexString(bytes, 0);
+    writer.EndArray();
+
+    STRCMP_EQUAL("[\"001FABFF\",\"\"]", buffer.c_str());
+}
+
+TEST(JsonWriter, AppendToBuffer)
+{
+    std::string buffer = "data: ";
+    JsonWriter  writer(buffer);
+
+    writer.Uint(7);
+
+    STRCMP_EQUAL("data: 7", buffer.c_str());
+}
@@ -110,3 +110,70 @@ TEST(Logging, TestLoggingDump)
     sprintf(cmd, "grep '%s.*: foobar: 0020: 6f 66 20 74 65 78 74 00' /var/log/syslog", ident);
     CHECK(0 == system(cmd));
 }
+
+TEST(Logging, TestLoggingAsync)
+{
+    char ident[32];
+    char cmd[128];
+
+    sprintf(ident, "otbr-test-%ld", clock());
+    otbrLogInit(ident, OTBR_LOG_INFO, true);
+    otbrLogStartAsync(16);
+    otbrLog(OTBR_LOG_INFO, "cool-async");
+    // Deinitializing writes the queued lines.
+    otbrLogDeinit();
+    sleep(0);
+
+    sprintf(cmd, "grep '%s.*cool-async' /var/log/syslog", ident);
+    CHECK(0 == system(cmd));
+    CHECK(0 == otbrLogGetDroppedCount());
+}
+
+TEST(Logging, TestLoggingLazyArguments)
+{
+    int evaluated = 0;
+
+    otbrLogInit("otbr-test-lazy", OTBR_LOG_INFO, true);
+
+    otbrLog(OTBR_LOG_DEBUG, "cool-lazy %d", ++evaluated);
+    otbrDump(OTBR_LOG_DEBUG, "cool-lazy", &evaluated, ++evaluated);
+    CHECK(0 == evaluated);
+
+    otbrLog(OTBR_LOG_INFO, "cool-lazy %d", ++evaluated);
+    CHECK(1 == evaluated);
+
+    otbrLogDeinit();
+}
+
+TEST(Logging, TestLoggingRateLimit)
+{
+    otbrLogRateLimit rateLimit  = {};
+    uint64_t         suppressed = otbrLogGetSuppressedCount();
+    int              allowed    = 0;
+
+    otbrLogInit("otbr-test-rate-limit", OTBR_LOG_INFO, true);
+    otbrLogSetRateLimit(5);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        allowed += otbrLogRateLimitAllow(&rateLimit, OTBR_LOG_WARNING, __FILE__, __LINE__);
+    }
+
+    CHECK(5 == allowed);
+    CHECK(5 == rateLimit.mSuppressed);
+    CHECK(suppressed + 5 == otbrLogGetSuppressedCount());
+
+    // Debug lines are never suppressed.
+    CHECK(otbrLogRateLimitAllow(&rateLimit, OTBR_LOG_DEBUG, __FILE__, __LINE__));
+
+    // A token is refilled every 200 milliseconds, and the suppressed lines are reported.
+    usleep(250000);
+    CHECK(otbrLogRateLimitAllow(&rateLimit, OTBR_LOG_WARNING, __FILE__, __LINE__));
+    CHECK(0 == rateLimit.mSuppressed);
+    CHECK(!otbrLogRateLimitAllow(&rateLimit, OTBR_LOG_WARNING, __FILE__, __LINE__));
+
+    otbrLogSetRateLimit(0);
+    CHECK(otbrLogRateLimitAllow(&rateLimit, OTBR_LOG_WARNING, __FILE__, __LINE__));
+
+    otbrLogDeinit();
+}
@@ -0,0 +1,165 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/mainloop_poller.hpp"
+
+#include <CppUTest/TestHarness.h>
+#include <unistd.h>
+
+using otbr::MainloopPoller;
+
+static void InitMainloop(otSysMainloopContext &aMainloop)
+{
+    FD_ZERO(&aMainloop.mReadFdSet);
+    FD_ZERO(&aMainloop.mWriteFdSet);
+    FD_ZERO(&aMainloop.mErrorFdSet);
+    aMainloop.mMaxFd   = -1;
+    aMainloop.mTimeout = {0, 100000};
+}
+
+TEST_GROUP(MainloopPoller)
+{
+    int mPipe[2];
+
+    void setup() { CHECK_EQUAL(0, pipe(mPipe)); }
+
+    void teardown()
+    {
+        MainloopPoller::Get().Unregister(mPipe[0]);
+        MainloopPoller::Get().Unregister(mPipe[1]);
+        close(mPipe[0]);
+        close(mPipe[1]);
+    }
+};
+
+TEST(MainloopPoller, TestRegisteredFdReadable)
+{
+    otSysMainloopContext mainloop;
+    char                 data = 0;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, MainloopPoller::Get().Register(mPipe[0], MainloopPoller::kEventRead));
+
+    InitMainloop(mainloop);
+    CHECK_EQUAL(0, MainloopPoller::Get().Poll(mainloop));
+    CHECK_FALSE(MainloopPoller::Get().IsReadable(mPipe[0]));
+    CHECK_TRUE(MainloopPoller::Get().GetReadyFds().empty());
+
+    CHECK_EQUAL(1, write(mPipe[1], &data, sizeof(data)));
+
+    InitMainloop(mainloop);
+    CHECK_EQUAL(1, MainloopPoller::Get().Poll(mainloop));
+    CHECK_TRUE(MainloopPoller::Get().IsReadable(mPipe[0]));
+    CHECK_FALSE(MainloopPoller::Get().IsWritable(mPipe[0]));
+    CHECK_TRUE(MainloopPoller::Get().GetReadyFds().size() == 1);
+    CHECK_EQUAL(mPipe[0], MainloopPoller::Get().GetReadyFds()[0]);
+}
+
+TEST(MainloopPoller, TestRegisteredAndLegacyFds)
+{
+    otSysMainloopContext mainloop;
+    int                  legacy[2];
+    char                 data = 0;
+
+    CHECK_EQUAL(0, pipe(legacy));
+    CHECK_EQUAL(OTBR_ERROR_NONE, MainloopPoller::Get().Register(mPipe[1], MainloopPoller::kEventWrite));
+    CHECK_EQUAL(1, write(legacy[1], &data, sizeof(data)));
+
+    InitMainloop(mainloop);
+    FD_SET(legacy[0], &mainloop.mReadFdSet);
+    mainloop.mMaxFd = legacy[0];
+
+    CHECK_EQUAL(2, MainloopPoller::Get().Poll(mainloop));
+    CHECK_TRUE(MainloopPoller::Get().IsWritable(mPipe[1]));
+    CHECK_TRUE(FD_ISSET(legacy[0], &mainloop.mReadFdSet));
+
+    close(legacy[0]);
+    close(legacy[1]);
+}
+
+TEST(MainloopPoller, TestUnregister)
+{
+    otSysMainloopContext mainloop;
+    char                 data = 0;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, MainloopPoller::Get().Register(mPipe[0], MainloopPoller::kEventRead));
+    CHECK_EQUAL(1, write(mPipe[1], &data, sizeof(data)));
+
+    InitMainloop(mainloop);
+    CHECK_EQUAL(1, MainloopPoller::Get().Poll(mainloop));
+    CHECK_TRUE(MainloopPoller::Get().IsReadable(mPipe[0]));
+
+    MainloopPoller::Get().Unregister(mPipe[0]);
+    CHECK_FALSE(MainloopPoller::Get().IsReadable(mPipe[0]));
+
+    InitMainloop(mainloop);
+    mainloop.mTimeout = {0, 0};
+    CHECK_EQUAL(0, MainloopPoller::Get().Poll(mainloop));
+    CHECK_FALSE(MainloopPoller::Get().IsReadable(mPipe[0]));
+}
+
+TEST(MainloopPoller, TestInvalidFd)
+{
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, MainloopPoller::Get().Register(-1, MainloopPoller::kEventRead));
+}
+
+TEST(MainloopPoller, TestTimerSlack)
+{
+    using std::chrono::milliseconds;
+
+    auto           now = std::chrono::steady_clock::time_point(milliseconds(1001));
+    struct timeval timeout;
+
+    // Timeouts shorter than 16 ms are never extended.
+    timeout = {0, 15000};
+    MainloopPoller::ApplyTimerSlack(timeout, milliseconds(100), now);
+    CHECK_EQUAL(0, timeout.tv_sec);
+    CHECK_EQUAL(15000, timeout.tv_usec);
+
+    // A deadline at 1065 ms is rounded up to the 4 ms grid, 1/16 of the timeout.
+    timeout = {0, 64000};
+    MainloopPoller::ApplyTimerSlack(timeout, milliseconds(100), now);
+    CHECK_EQUAL(0, timeout.tv_sec);
+    CHECK_EQUAL(67000, timeout.tv_usec);
+
+    // A deadline at 11001 ms is rounded up to 11008 ms on the 64 ms grid, limited by the maximum slack.
+    timeout = {10, 0};
+    MainloopPoller::ApplyTimerSlack(timeout, milliseconds(100), now);
+    CHECK_EQUAL(10, timeout.tv_sec);
+    CHECK_EQUAL(7000, timeout.tv_usec);
+
+    // A deadline already on the 2 ms grid is kept.
+    timeout = {0, 63000};
+    MainloopPoller::ApplyTimerSlack(timeout, milliseconds(100), now + milliseconds(2000));
+    CHECK_EQUAL(0, timeout.tv_sec);
+    CHECK_EQUAL(63000, timeout.tv_usec);
+
+    timeout = {10, 0};
+    MainloopPoller::ApplyTimerSlack(timeout, milliseconds(0), now);
+    CHECK_EQUAL(10, timeout.tv_sec);
+    CHECK_EQUAL(0, timeout.tv_usec);
+}
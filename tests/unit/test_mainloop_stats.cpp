@@ -0,0 +1,92 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/mainloop_stats.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::MainloopStats;
+
+TEST_GROUP(MainloopStats)
+{
+    void setup() { MainloopStats::Get().Clear(); }
+
+    void teardown() { MainloopStats::Get().Clear(); }
+};
+
+TEST(MainloopStats, TestBuckets)
+{
+    CHECK(MainloopStats::GetBucket(0) == 0);
+    CHECK(MainloopStats::GetBucket(15) == 0);
+    CHECK(MainloopStats::GetBucket(16) == 1);
+    CHECK(MainloopStats::GetBucket(31) == 1);
+    CHECK(MainloopStats::GetBucket(32) == 2);
+    CHECK(MainloopStats::GetBucket(UINT64_MAX) == MainloopStats::kNumBuckets - 1);
+
+    for (uint8_t i = 0; i < MainloopStats::kNumBuckets - 1; i++)
+    {
+        CHECK(MainloopStats::GetBucket(MainloopStats::GetBucketUpperBound(i) - 1) == i);
+        CHECK(MainloopStats::GetBucket(MainloopStats::GetBucketUpperBound(i)) == i + 1);
+    }
+
+    CHECK(MainloopStats::GetBucketUpperBound(MainloopStats::kNumBuckets - 1) == UINT64_MAX);
+}
+
+TEST(MainloopStats, TestRecord)
+{
+    MainloopStats &                 stats = MainloopStats::Get();
+    const MainloopStats::Histogram &histogram =
+        stats.GetHistogram(MainloopStats::kComponentRest, MainloopStats::kPhaseProcess);
+
+    stats.Record(MainloopStats::kComponentRest, MainloopStats::kPhaseProcess, 10);
+    stats.Record(MainloopStats::kComponentRest, MainloopStats::kPhaseProcess, 20);
+    stats.Record(MainloopStats::kComponentRest, MainloopStats::kPhaseProcess, MainloopStats::kStallThresholdUs);
+
+    CHECK(histogram.mCount == 3);
+    CHECK(histogram.mTotalUs == 30 + MainloopStats::kStallThresholdUs);
+    CHECK(histogram.mMaxUs == MainloopStats::kStallThresholdUs);
+    CHECK(histogram.mStallCount == 1);
+    CHECK(histogram.mBuckets[0] == 1);
+    CHECK(histogram.mBuckets[1] == 1);
+    CHECK(histogram.mBuckets[MainloopStats::GetBucket(MainloopStats::kStallThresholdUs)] == 1);
+
+    CHECK(stats.GetHistogram(MainloopStats::kComponentRest, MainloopStats::kPhaseUpdateFdSet).mCount == 0);
+    CHECK(stats.GetHistogram(MainloopStats::kComponentDBus, MainloopStats::kPhaseProcess).mCount == 0);
+}
+
+TEST(MainloopStats, TestProbe)
+{
+    {
+        MainloopStats::Probe probe(MainloopStats::kComponentAgent, MainloopStats::kPhaseUpdateFdSet);
+    }
+
+    const MainloopStats::Histogram &histogram =
+        MainloopStats::Get().GetHistogram(MainloopStats::kComponentAgent, MainloopStats::kPhaseUpdateFdSet);
+
+    CHECK(histogram.mCount == 1);
+}
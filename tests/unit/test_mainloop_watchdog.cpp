@@ -0,0 +1,85 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/mainloop_watchdog.hpp"
+
+#include <thread>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::MainloopStats;
+using otbr::MainloopWatchdog;
+
+TEST_GROUP(MainloopWatchdog)
+{
+    void teardown() { MainloopWatchdog::Get().Stop(); }
+};
+
+TEST(MainloopWatchdog, TestStart)
+{
+    CHECK(MainloopWatchdog::Get().Start(0) == OTBR_ERROR_INVALID_ARGS);
+    CHECK(!MainloopWatchdog::Get().IsRunning());
+
+    CHECK(MainloopWatchdog::Get().Start(1000) == OTBR_ERROR_NONE);
+    CHECK(MainloopWatchdog::Get().IsRunning());
+    CHECK(MainloopWatchdog::Get().Start(1000) == OTBR_ERROR_DUPLICATED);
+
+    MainloopWatchdog::Get().Stop();
+    CHECK(!MainloopWatchdog::Get().IsRunning());
+}
+
+TEST(MainloopWatchdog, TestStall)
+{
+    CHECK(MainloopWatchdog::Get().Start(20) == OTBR_ERROR_NONE);
+
+    // A short call is not reported.
+    {
+        MainloopStats::Probe probe(MainloopStats::kComponentRest, MainloopStats::kPhaseProcess);
+    }
+
+    // Idle time between calls is not reported.
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    CHECK(MainloopWatchdog::Get().GetStallCount() == 0);
+
+    // A stalled call is reported once, even if it stalls for several budgets.
+    {
+        MainloopStats::Probe probe(MainloopStats::kComponentUbus, MainloopStats::kPhaseProcess);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    CHECK(MainloopWatchdog::Get().GetStallCount() == 1);
+
+    {
+        MainloopStats::Probe probe(MainloopStats::kComponentDBus, MainloopStats::kPhaseProcess);
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+
+    CHECK(MainloopWatchdog::Get().GetStallCount() == 2);
+}
@@ -0,0 +1,161 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "mdns/discovery_cache.cpp"
+
+using otbr::Mdns::DiscoveryCache;
+using otbr::Mdns::Publisher;
+using std::chrono::milliseconds;
+using std::chrono::seconds;
+
+static const uint8_t kAddress[16] = {0xfd, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1};
+
+static Publisher::DiscoveredInstanceInfo MakeInstance(const char *aName, uint32_t aTtl)
+{
+    Publisher::DiscoveredInstanceInfo instance;
+
+    instance.mName     = aName;
+    instance.mHostName = "host.local.";
+    instance.mPort     = 49152;
+    instance.mTtl      = aTtl;
+    instance.mAddresses.push_back(otbr::Ip6Address(kAddress));
+
+    return instance;
+}
+
+static Publisher::DiscoveredHostInfo MakeHost(uint32_t aTtl)
+{
+    Publisher::DiscoveredHostInfo host;
+
+    host.mHostName = "host.local.";
+    host.mTtl      = aTtl;
+    host.mAddresses.push_back(otbr::Ip6Address(kAddress));
+
+    return host;
+}
+
+TEST_GROUP(DiscoveryCache)
+{
+    DiscoveryCache::Clock::time_point mStart;
+
+    void setup() { mStart = DiscoveryCache::Clock::now(); }
+};
+
+TEST(DiscoveryCache, TestFindInstances)
+{
+    DiscoveryCache                                 cache;
+    std::vector<Publisher::DiscoveredInstanceInfo> instances;
+
+    cache.UpdateInstance("_meshcop._udp", MakeInstance("br1", 120), mStart);
+    cache.UpdateInstance("_meshcop._udp", MakeInstance("br2", 10), mStart);
+    cache.UpdateInstance("_test._tcp", MakeInstance("other", 120), mStart);
+    CHECK(cache.GetInstanceCount() == 3);
+
+    CHECK(cache.FindInstances("_meshcop._udp", "", mStart, instances) == 2);
+    CHECK(instances.size() == 2);
+
+    instances.clear();
+    CHECK(cache.FindInstances("_meshcop._udp", "br2", mStart + milliseconds(2500), instances) == 1);
+    CHECK(instances[0].mName == "br2");
+    CHECK(instances[0].mPort == 49152);
+    // The remaining TTL is rounded up.
+    CHECK(instances[0].mTtl == 8);
+
+    instances.clear();
+    CHECK(cache.FindInstances("_unknown._udp", "", mStart, instances) == 0);
+    CHECK(instances.empty());
+}
+
+TEST(DiscoveryCache, TestInstanceExpiry)
+{
+    DiscoveryCache                                 cache;
+    std::vector<Publisher::DiscoveredInstanceInfo> instances;
+
+    cache.UpdateInstance("_meshcop._udp", MakeInstance("br1", 120), mStart);
+    cache.UpdateInstance("_meshcop._udp", MakeInstance("br2", 10), mStart);
+
+    CHECK(cache.FindInstances("_meshcop._udp", "", mStart + seconds(10), instances) == 1);
+    CHECK(instances[0].mName == "br1");
+    CHECK(instances[0].mTtl == 110);
+    CHECK(cache.GetInstanceCount() == 1);
+
+    // Refreshing an instance restarts its TTL.
+    cache.UpdateInstance("_meshcop._udp", MakeInstance("br1", 120), mStart + seconds(100));
+    cache.Expire(mStart + seconds(130));
+    CHECK(cache.GetInstanceCount() == 1);
+
+    cache.Expire(mStart + seconds(220));
+    CHECK(cache.GetInstanceCount() == 0);
+}
+
+TEST(DiscoveryCache, TestRemoveInstance)
+{
+    DiscoveryCache                                 cache;
+    Publisher::DiscoveredInstanceInfo              removed;
+    std::vector<Publisher::DiscoveredInstanceInfo> instances;
+
+    cache.UpdateInstance("_meshcop._udp", MakeInstance("br1", 120), mStart);
+    cache.UpdateInstance("_meshcop._udp", MakeInstance("br2", 120), mStart);
+
+    removed.mRemoved = true;
+    removed.mName    = "br1";
+    cache.UpdateInstance("_meshcop._udp", removed, mStart);
+    CHECK(cache.GetInstanceCount() == 1);
+
+    // A goodbye has a zero TTL.
+    cache.UpdateInstance("_meshcop._udp", MakeInstance("br2", 0), mStart);
+    CHECK(cache.GetInstanceCount() == 0);
+    CHECK(cache.FindInstances("_meshcop._udp", "", mStart, instances) == 0);
+}
+
+TEST(DiscoveryCache, TestFindHost)
+{
+    DiscoveryCache                cache;
+    Publisher::DiscoveredHostInfo host;
+
+    CHECK(!cache.FindHost("host", mStart, host));
+
+    cache.UpdateHost("host", MakeHost(120), mStart);
+    CHECK(cache.FindHost("host", mStart + seconds(20), host));
+    CHECK(host.mHostName == "host.local.");
+    CHECK(host.mAddresses.size() == 1);
+    CHECK(host.mTtl == 100);
+
+    CHECK(!cache.FindHost("host", mStart + seconds(120), host));
+    CHECK(cache.GetHostCount() == 0);
+
+    cache.UpdateHost("host", MakeHost(120), mStart);
+    cache.UpdateHost("host", Publisher::DiscoveredHostInfo(), mStart);
+    CHECK(cache.GetHostCount() == 0);
+
+    cache.UpdateHost("host", MakeHost(120), mStart);
+    cache.Clear();
+    CHECK(cache.GetHostCount() == 0);
+}
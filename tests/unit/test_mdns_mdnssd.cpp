@@ -67,3 +67,29 @@ TEST(MdnsSd, TestDNSErrorToString)
     CHECK(nullptr != otbr::Mdns::DNSErrorToString(kDNSServiceErr_PollingMode));
     CHECK(nullptr != otbr::Mdns::DNSErrorToString(kDNSServiceErr_Timeout));
 }
+
+TEST(MdnsSd, TestDiffAddresses)
+{
+    const otbr::Ip6Address             kAddress1(0x1001);
+    const otbr::Ip6Address             kAddress2(0x1002);
+    const otbr::Ip6Address             kAddress3(0x1003);
+    otbr::Mdns::Publisher::AddressList removed;
+    otbr::Mdns::Publisher::AddressList added;
+
+    // The order and duplicates of the addresses do not matter.
+    otbr::Mdns::Publisher::DiffAddresses({kAddress1, kAddress2}, {kAddress2, kAddress1, kAddress1}, removed, added);
+    CHECK(removed.empty());
+    CHECK(added.empty());
+
+    // A renumbered address is one removal and one addition.
+    otbr::Mdns::Publisher::DiffAddresses({kAddress1, kAddress2}, {kAddress1, kAddress3}, removed, added);
+    CHECK_EQUAL(1, removed.size());
+    CHECK(removed[0] == kAddress2);
+    CHECK_EQUAL(1, added.size());
+    CHECK(added[0] == kAddress3);
+
+    // A new host adds all of its addresses.
+    otbr::Mdns::Publisher::DiffAddresses({}, {kAddress1, kAddress2, kAddress2}, removed, added);
+    CHECK(removed.empty());
+    CHECK_EQUAL(2, added.size());
+}
@@ -0,0 +1,188 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#include "common/metrics.hpp"
+
+#include <string>
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::MainloopStats;
+using otbr::Metrics;
+
+TEST_GROUP(Metrics)
+{
+    void setup() { Metrics::Get().Clear(); }
+
+    void teardown() { Metrics::Get().Clear(); }
+};
+
+TEST(Metrics, TestRecordRestResponse)
+{
+    Metrics &                metrics = Metrics::Get();
+    MainloopStats::Histogram latency;
+
+    metrics.RecordRestResponse(2, 10);
+    metrics.RecordRestResponse(4, 100);
+    metrics.RecordRestResponse(1, 1000);
+
+    latency = metrics.GetHistogram(Metrics::kHistogramRestRequest);
+    CHECK(metrics.GetCounter(Metrics::kCounterRestResponses2xx) == 1);
+    CHECK(metrics.GetCounter(Metrics::kCounterRestResponses3xx) == 0);
+    CHECK(metrics.GetCounter(Metrics::kCounterRestResponses4xx) == 1);
+    CHECK(metrics.GetCounter(Metrics::kCounterRestResponses5xx) == 0);
+    CHECK(latency.mCount == 2);
+    CHECK(latency.mTotalUs == 110);
+    CHECK(latency.mMaxUs == 100);
+    CHECK(latency.mBuckets[MainloopStats::GetBucket(10)] == 1);
+}
+
+TEST(Metrics, TestRecordHistogram)
+{
+    Metrics &                metrics = Metrics::Get();
+    MainloopStats::Histogram latency;
+
+    metrics.Record(Metrics::kHistogramMdnsPublish, 1800);
+    metrics.Record(Metrics::kHistogramMdnsPublish, 20);
+
+    latency = metrics.GetHistogram(Metrics::kHistogramMdnsPublish);
+    CHECK(latency.mCount == 2);
+    CHECK(latency.mTotalUs == 1820);
+    CHECK(latency.mMaxUs == 1800);
+    CHECK(latency.mBuckets[MainloopStats::GetBucket(20)] == 1);
+    CHECK(metrics.GetHistogram(Metrics::kHistogramNdProxyProcess).mCount == 0);
+
+    metrics.Clear();
+    CHECK(metrics.GetHistogram(Metrics::kHistogramMdnsPublish).mCount == 0);
+    CHECK(metrics.GetHistogram(Metrics::kHistogramMdnsPublish).mMaxUs == 0);
+}
+
+TEST(Metrics, TestCounterAndGauge)
+{
+    Metrics &metrics = Metrics::Get();
+
+    metrics.Increment(Metrics::kCounterSrpUpdates);
+    metrics.Add(Metrics::kCounterSrpUpdates, 4);
+    metrics.SetGauge(Metrics::kGaugeMdnsOutstanding, 3);
+    metrics.SetGauge(Metrics::kGaugeMdnsOutstanding, 2);
+
+    CHECK(metrics.GetCounter(Metrics::kCounterSrpUpdates) == 5);
+    CHECK(metrics.GetGauge(Metrics::kGaugeMdnsOutstanding) == 2);
+
+    metrics.Clear();
+    CHECK(metrics.GetCounter(Metrics::kCounterSrpUpdates) == 0);
+    CHECK(metrics.GetGauge(Metrics::kGaugeMdnsOutstanding) == 0);
+}
+
+TEST(Metrics, TestGetSamples)
+{
+    Metrics::Snapshot            snapshot;
+    std::vector<Metrics::Sample> samples;
+    bool                         foundCounter = false;
+    bool                         foundMax     = false;
+
+    Metrics::Get().Increment(Metrics::kCounterRestResponses4xx);
+    Metrics::Get().Record(Metrics::kHistogramNdProxyProcess, 40);
+    Metrics::Get().GetSnapshot(snapshot);
+    Metrics::GetSamples(snapshot, samples);
+
+    CHECK(samples.size() == Metrics::kNumCounters + Metrics::kNumGauges + 3 * Metrics::kNumHistograms);
+    STRCMP_EQUAL("otbr_rest_responses_total", Metrics::GetInfo(Metrics::kCounterRestResponses4xx).mName);
+
+    for (const Metrics::Sample &sample : samples)
+    {
+        if (sample.mName == "otbr_rest_responses_total" && std::string(sample.mLabels) == "class=\"4xx\"")
+        {
+            foundCounter = (sample.mValue == 1);
+        }
+        else if (sample.mName == "otbr_nd_proxy_process_duration_microseconds_max")
+        {
+            foundMax = (sample.mValue == 40);
+        }
+    }
+
+    CHECK(foundCounter);
+    CHECK(foundMax);
+}
+
+TEST(Metrics, TestWriteSample)
+{
+    std::string output;
+
+    Metrics::WriteSample(output, "otbr_test_total", nullptr, 3);
+    Metrics::WriteSample(output, "otbr_test_total", "result=\"failure\"", UINT64_MAX);
+
+    STRCMP_EQUAL("otbr_test_total 3\notbr_test_total{result=\"failure\"} 18446744073709551615\n", output.c_str());
+}
+
+TEST(Metrics, TestWriteHistogram)
+{
+    MainloopStats::Histogram histogram = {};
+    std::string              output;
+
+    histogram.mCount      = 3;
+    histogram.mTotalUs    = 1000030;
+    histogram.mBuckets[0] = 2;
+
+    histogram.mBuckets[MainloopStats::kNumBuckets - 1] = 1;
+
+    Metrics::WriteHistogram(output, "otbr_test_microseconds", "phase=\"Process\"", histogram);
+
+    CHECK(output.find("otbr_test_microseconds_bucket{phase=\"Process\",le=\"15\"} 2\n") == 0);
+    CHECK(output.find("otbr_test_microseconds_bucket{phase=\"Process\",le=\"31\"} 2\n") != std::string::npos);
+    CHECK(output.find("otbr_test_microseconds_bucket{phase=\"Process\",le=\"+Inf\"} 3\n") != std::string::npos);
+    CHECK(output.find("otbr_test_microseconds_sum{phase=\"Process\"} 1000030\n") != std::string::npos);
+    CHECK(output.find("otbr_test_microseconds_count{phase=\"Process\"} 3\n") != std::string::npos);
+}
+
+TEST(Metrics, TestWrite)
+{
+    std::string output;
+
+    Metrics::Get().Increment(Metrics::kCounterSrpUpdateTimeout);
+    Metrics::Get().Increment(Metrics::kCounterNdProxyNsUnicast);
+    Metrics::Get().Write(output);
+
+    CHECK(output.find("# TYPE otbr_rest_responses_total counter\n") != std::string::npos);
+    CHECK(output.find("otbr_srp_update_results_total{result=\"timeout\"} 1\n") != std::string::npos);
+    CHECK(output.find("# TYPE otbr_mdns_publish_duration_milliseconds histogram\n") != std::string::npos);
+    CHECK(output.find("otbr_mdns_outstanding_publications 0\n") != std::string::npos);
+    CHECK(output.find("otbr_mdns_name_conflicts_total 0\n") != std::string::npos);
+    CHECK(output.find("otbr_log_dropped_total 0\n") != std::string::npos);
+    CHECK(output.find("# TYPE otbr_log_suppressed_total counter\n") != std::string::npos);
+    CHECK(output.find("otbr_nd_proxy_ns_received_total{type=\"unicast\"} 1\n") != std::string::npos);
+    CHECK(output.find("# TYPE otbr_nd_proxy_process_duration_microseconds histogram\n") != std::string::npos);
+    CHECK(output.find("# TYPE otbr_mainloop_duration_microseconds histogram\n") != std::string::npos);
+    CHECK(output.find("otbr_mainloop_duration_microseconds_count{component=\"rest\",phase=\"Process\"}") !=
+          std::string::npos);
+
+    // Every family is described once.
+    CHECK(output.find("# TYPE otbr_rest_responses_total") == output.rfind("# TYPE otbr_rest_responses_total"));
+}
@@ -0,0 +1,143 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <net/if.h>
+#include <netinet/icmp6.h>
+#include <netinet/in.h>
+#include <string.h>
+
+#include <vector>
+
+#include <linux/netfilter.h>
+#include <linux/netfilter/nf_tables.h>
+#include <linux/netfilter/nfnetlink.h>
+#include <linux/netlink.h>
+
+#include "utils/nftables.hpp"
+
+using otbr::Ip6Address;
+using otbr::Ip6Prefix;
+using otbr::NftablesBatch;
+
+static std::vector<const struct nlmsghdr *> ParseMessages(const NftablesBatch &aBatch)
+{
+    std::vector<const struct nlmsghdr *> messages;
+    const uint8_t *                      data   = aBatch.GetData();
+    size_t                               offset = 0;
+
+    while (offset < aBatch.GetLength())
+    {
+        const struct nlmsghdr *hdr = reinterpret_cast<const struct nlmsghdr *>(data + offset);
+
+        CHECK(hdr->nlmsg_len >= NLMSG_LENGTH(sizeof(struct nfgenmsg)));
+        messages.push_back(hdr);
+        offset += NLMSG_ALIGN(hdr->nlmsg_len);
+    }
+
+    CHECK(offset == aBatch.GetLength());
+
+    return messages;
+}
+
+static bool Contains(const struct nlmsghdr *aMessage, const void *aData, size_t aLength)
+{
+    const uint8_t *begin = reinterpret_cast<const uint8_t *>(aMessage);
+    const uint8_t *end   = begin + aMessage->nlmsg_len;
+
+    for (const uint8_t *p = begin; p + aLength <= end; ++p)
+    {
+        if (memcmp(p, aData, aLength) == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+TEST_GROUP(NftablesBatch){};
+
+TEST(NftablesBatch, TestMessageLayout)
+{
+    NftablesBatch                        batch;
+    std::vector<const struct nlmsghdr *> messages;
+
+    batch.AddTable("otbr");
+    batch.DeleteTable("otbr");
+    batch.AddChain("otbr", "prerouting", NF_INET_PRE_ROUTING, -300);
+
+    messages = ParseMessages(batch);
+
+    CHECK(messages.size() == 4);
+    CHECK(messages[0]->nlmsg_type == NFNL_MSG_BATCH_BEGIN);
+    CHECK(!(messages[0]->nlmsg_flags & NLM_F_ACK));
+    CHECK(messages[1]->nlmsg_type == (NFNL_SUBSYS_NFTABLES << 8 | NFT_MSG_NEWTABLE));
+    CHECK(messages[2]->nlmsg_type == (NFNL_SUBSYS_NFTABLES << 8 | NFT_MSG_DELTABLE));
+    CHECK(messages[3]->nlmsg_type == (NFNL_SUBSYS_NFTABLES << 8 | NFT_MSG_NEWCHAIN));
+
+    for (size_t i = 1; i < messages.size(); ++i)
+    {
+        const struct nfgenmsg *msg = static_cast<const struct nfgenmsg *>(NLMSG_DATA(messages[i]));
+
+        CHECK(messages[i]->nlmsg_flags & NLM_F_ACK);
+        CHECK(msg->nfgen_family == NFPROTO_IPV6);
+        CHECK(Contains(messages[i], "otbr", sizeof("otbr")));
+    }
+}
+
+TEST(NftablesBatch, TestRuleMatchesMaskedPrefix)
+{
+    NftablesBatch                        batch;
+    Ip6Prefix                            prefix;
+    Ip6Address                           masked;
+    std::vector<const struct nlmsghdr *> messages;
+    const char                           ifName[IFNAMSIZ] = "eth0";
+
+    CHECK(Ip6Address::FromString("fd00:7d03:7d03:7d03::1", prefix.mPrefix) == OTBR_ERROR_NONE);
+    CHECK(Ip6Address::FromString("fd00:7d03:7d03:7d03::", masked) == OTBR_ERROR_NONE);
+    prefix.mLength = 64;
+
+    batch.BeginRule("otbr", "prerouting");
+    batch.MatchInputInterface("eth0");
+    batch.MatchDestinationPrefix(prefix);
+    batch.MatchIcmp6Type(ND_NEIGHBOR_SOLICIT);
+    batch.Queue(88, true);
+    batch.EndRule();
+
+    messages = ParseMessages(batch);
+
+    CHECK(messages.size() == 2);
+    CHECK(messages[1]->nlmsg_type == (NFNL_SUBSYS_NFTABLES << 8 | NFT_MSG_NEWRULE));
+    CHECK(messages[1]->nlmsg_flags & NLM_F_APPEND);
+    CHECK(Contains(messages[1], ifName, sizeof(ifName)));
+    CHECK(Contains(messages[1], masked.m8, sizeof(masked.m8)));
+    CHECK(!Contains(messages[1], prefix.mPrefix.m8, sizeof(prefix.mPrefix.m8)));
+    CHECK(Contains(messages[1], "queue", sizeof("queue")));
+}
@@ -0,0 +1,171 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "web/web-service/ot_client.hpp"
+
+#include <string>
+#include <thread>
+
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Web::OpenThreadClient;
+
+static const char kSocketPath[] = "/tmp/otbr-test-ot-client.sock";
+
+// Answers the commands of a single connection like the daemon CLI, and closes it on "quit".
+static void RunDaemon(int aListener)
+{
+    int         fd = accept(aListener, nullptr, nullptr);
+    std::string received;
+    char        buffer[256];
+    ssize_t     count;
+
+    while ((count = read(fd, buffer, sizeof(buffer))) > 0)
+    {
+        size_t end;
+
+        received.append(buffer, static_cast<size_t>(count));
+
+        while ((end = received.find('\n')) != std::string::npos)
+        {
+            std::string command = received.substr(0, end);
+            std::string response;
+
+            received.erase(0, end + 1);
+
+            if (command == "quit")
+            {
+                close(fd);
+                return;
+            }
+            else if (command == "state")
+            {
+                response = "> leader\r\nDone\r\n";
+            }
+            else if (command == "ipaddr")
+            {
+                response = "fd00::1\r\n> fe80::1\r\nDone\r\n";
+            }
+            else
+            {
+                response = "Error 35: InvalidCommand\r\n";
+            }
+
+            // Responses are written byte by byte to check lines split across reads are joined.
+            for (char c : response)
+            {
+                if (write(fd, &c, 1) != 1)
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    close(fd);
+}
+
+TEST_GROUP(OpenThreadClient)
+{
+    int         mListener;
+    std::thread mDaemon;
+
+    void setup()
+    {
+        struct sockaddr_un addr;
+
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        strcpy(addr.sun_path, kSocketPath);
+        unlink(kSocketPath);
+
+        mListener = socket(AF_UNIX, SOCK_STREAM, 0);
+        CHECK(bind(mListener, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) == 0);
+        CHECK(listen(mListener, 1) == 0);
+        mDaemon = std::thread(RunDaemon, mListener);
+    }
+
+    void teardown()
+    {
+        mDaemon.join();
+        close(mListener);
+        unlink(kSocketPath);
+    }
+};
+
+TEST(OpenThreadClient, TestPipelinedCommands)
+{
+    OpenThreadClient            client(kSocketPath);
+    OpenThreadClient::CommandId state;
+    OpenThreadClient::CommandId invalid;
+    OpenThreadClient::CommandId ipaddr;
+    char *                      output;
+
+    CHECK(client.Connect());
+    CHECK(client.Connect());
+
+    state   = client.Send("state");
+    invalid = client.Send("invalid");
+    ipaddr  = client.Send("ipaddr");
+    CHECK(state != OpenThreadClient::kInvalidCommandId);
+    CHECK(invalid != OpenThreadClient::kInvalidCommandId);
+    CHECK(ipaddr != OpenThreadClient::kInvalidCommandId);
+
+    output = client.Wait(ipaddr);
+    STRCMP_EQUAL("fd00::1\r\nfe80::1", output);
+    STRCMP_EQUAL("leader", client.Wait(state));
+    CHECK(client.Wait(invalid) == nullptr);
+
+    // The connection stays usable after a failed command.
+    STRCMP_EQUAL("leader", client.Execute("state"));
+
+    client.Send("quit");
+}
+
+TEST(OpenThreadClient, TestDisconnected)
+{
+    OpenThreadClient            client(kSocketPath);
+    OpenThreadClient::CommandId quit;
+
+    CHECK(client.Connect());
+    quit = client.Send("quit");
+    CHECK(client.Wait(quit) == nullptr);
+
+    // The client connects again once the daemon is back.
+    CHECK(client.Send("state") == OpenThreadClient::kInvalidCommandId);
+    mDaemon.join();
+    mDaemon = std::thread(RunDaemon, mListener);
+    CHECK(client.Connect());
+    STRCMP_EQUAL("leader", client.Execute("state"));
+    client.Send("quit");
+}
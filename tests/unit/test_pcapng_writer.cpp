@@ -0,0 +1,125 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <string.h>
+
+#include "utils/pcapng_writer.hpp"
+
+using otbr::Utils::PcapngWriter;
+
+static uint32_t ReadUint32(const std::string &aBuffer, size_t aOffset)
+{
+    uint32_t value;
+
+    memcpy(&value, aBuffer.data() + aOffset, sizeof(value));
+    return value;
+}
+
+TEST_GROUP(PcapngWriter){};
+
+TEST(PcapngWriter, Header)
+{
+    std::string  buffer;
+    PcapngWriter writer(buffer);
+    size_t       length;
+
+    writer.WriteHeader("wpan0");
+
+    // The section header block.
+    LONGS_EQUAL(0x0a0d0d0a, ReadUint32(buffer, 0));
+    length = ReadUint32(buffer, 4);
+    LONGS_EQUAL(0, length % 4);
+    LONGS_EQUAL(0x1a2b3c4d, ReadUint32(buffer, 8));
+    LONGS_EQUAL(length, ReadUint32(buffer, length - 4));
+
+    // The interface description block.
+    LONGS_EQUAL(1, ReadUint32(buffer, length));
+    LONGS_EQUAL(PcapngWriter::kLinkTypeIeee802154Tap, ReadUint32(buffer, length + 8) & 0xffff);
+    CHECK(buffer.find("wpan0") != std::string::npos);
+    LONGS_EQUAL(buffer.size() - length, ReadUint32(buffer, length + 4));
+    LONGS_EQUAL(buffer.size() - length, ReadUint32(buffer, buffer.size() - 4));
+}
+
+TEST(PcapngWriter, ReceivedFrame)
+{
+    static const uint8_t kPsdu[] = {0x41, 0xd8, 0x01, 0xcd, 0xab, 0xff, 0xff, 0x12, 0x34};
+
+    std::string             buffer;
+    PcapngWriter            writer(buffer);
+    PcapngWriter::FrameInfo info;
+    size_t                  tapLength;
+
+    info.mTimestamp = 0x0000000100000002ull;
+    info.mChannel   = 15;
+    info.mRssi      = -60;
+    info.mLqi       = 200;
+    info.mIsTx      = false;
+    writer.WriteFrame(info, kPsdu, sizeof(kPsdu));
+
+    LONGS_EQUAL(6, ReadUint32(buffer, 0));
+    LONGS_EQUAL(0, buffer.size() % 4);
+    LONGS_EQUAL(buffer.size(), ReadUint32(buffer, 4));
+    LONGS_EQUAL(buffer.size(), ReadUint32(buffer, buffer.size() - 4));
+    LONGS_EQUAL(1, ReadUint32(buffer, 12));
+    LONGS_EQUAL(2, ReadUint32(buffer, 16));
+
+    // The TAP header, then the frame.
+    tapLength = static_cast<uint8_t>(buffer[30]) | (static_cast<uint8_t>(buffer[31]) << 8);
+    LONGS_EQUAL(36, tapLength);
+    LONGS_EQUAL(tapLength + sizeof(kPsdu), ReadUint32(buffer, 20));
+    LONGS_EQUAL(tapLength + sizeof(kPsdu), ReadUint32(buffer, 24));
+    MEMCMP_EQUAL(kPsdu, buffer.data() + 28 + tapLength, sizeof(kPsdu));
+
+    // The channel assignment TLV follows the FCS type TLV.
+    LONGS_EQUAL(3, buffer[40]);
+    LONGS_EQUAL(3, buffer[42]);
+    LONGS_EQUAL(15, buffer[44]);
+}
+
+TEST(PcapngWriter, SentFrame)
+{
+    static const uint8_t kPsdu[] = {0x02, 0x00, 0x01, 0x00, 0x00};
+
+    std::string             buffer;
+    PcapngWriter            writer(buffer);
+    PcapngWriter::FrameInfo info;
+
+    info.mTimestamp = 0;
+    info.mChannel   = 11;
+    info.mRssi      = PcapngWriter::kInvalidRssi;
+    info.mLqi       = 0;
+    info.mIsTx      = true;
+    writer.WriteFrame(info, kPsdu, sizeof(kPsdu));
+
+    // Without the RSS and LQI TLVs, and flagged outbound.
+    LONGS_EQUAL(20, buffer[30]);
+    LONGS_EQUAL(2, ReadUint32(buffer, buffer.size() - 12));
+    LONGS_EQUAL(buffer.size(), ReadUint32(buffer, buffer.size() - 4));
+}
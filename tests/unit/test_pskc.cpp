@@ -46,3 +46,31 @@ TEST(Pskc, Test123456_0001020304050607_OpenThread)
     pskc = mPSKc.ComputePskc(extpanid, "OpenThread", "123456");
     MEMCMP_EQUAL(expected, pskc, sizeof(expected));
 }
+
+TEST(Pskc, Test0123456789abcdef_0001020304050607_OpenThread)
+{
+    uint8_t extpanid[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+    uint8_t expected[] = {
+        0x04, 0xbd, 0x94, 0xd1, 0xdc, 0x4b, 0xce, 0xa8, 0x0b, 0xae, 0x5e, 0xcc, 0x1f, 0xcb, 0x14, 0xd0,
+    };
+    const uint8_t *pskc = nullptr;
+
+    // A 16-byte passphrase is used as the AES-CMAC key as is.
+    pskc = mPSKc.ComputePskc(extpanid, "OpenThread", "0123456789abcdef");
+    MEMCMP_EQUAL(expected, pskc, sizeof(expected));
+}
+
+TEST(Pskc, TestCachedPskc)
+{
+    uint8_t extpanid[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07};
+    uint8_t expected[] = {
+        0xb7, 0x83, 0x81, 0x27, 0x89, 0x91, 0x1e, 0xb4, 0xea, 0x76, 0x59, 0x6c, 0x9c, 0xed, 0x2a, 0x69,
+    };
+    otbr::Psk::Pskc other;
+
+    mPSKc.ComputePskc(extpanid, "OpenThread", "123456");
+    MEMCMP_EQUAL(expected, other.ComputePskc(extpanid, "OpenThread", "123456"), sizeof(expected));
+
+    // The cache must not match another passphrase of the same network.
+    CHECK(memcmp(expected, other.ComputePskc(extpanid, "OpenThread", "1234567"), sizeof(expected)) != 0);
+}
@@ -0,0 +1,170 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <string.h>
+
+#include "rest/diagnostic_history.hpp"
+
+using otbr::rest::DiagnosticHistory;
+
+static otExtAddress MakeExtAddress(uint8_t aLastByte)
+{
+    otExtAddress extAddress;
+
+    memset(&extAddress, 0, sizeof(extAddress));
+    extAddress.m8[OT_EXT_ADDRESS_SIZE - 1] = aLastByte;
+
+    return extAddress;
+}
+
+static otNetworkDiagTlv MakeMacCountersTlv(uint32_t aIfInErrors)
+{
+    otNetworkDiagTlv tlv;
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                          = OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS;
+    tlv.mData.mMacCounters.mIfInErrors = aIfInErrors;
+
+    return tlv;
+}
+
+static otNetworkDiagTlv MakeChildTableTlv(uint8_t aCount)
+{
+    otNetworkDiagTlv tlv;
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                    = OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE;
+    tlv.mData.mChildTable.mCount = aCount;
+
+    return tlv;
+}
+
+static size_t MemoryFor(size_t aNumNodes)
+{
+    return aNumNodes * (DiagnosticHistory::kSamplesPerNode * sizeof(DiagnosticHistory::Sample) +
+                        sizeof(DiagnosticHistory::Series));
+}
+
+TEST_GROUP(DiagnosticHistory){};
+
+TEST(DiagnosticHistory, Disabled)
+{
+    DiagnosticHistory                              history;
+    otNetworkDiagTlv                               tlv = MakeMacCountersTlv(1);
+    std::vector<const DiagnosticHistory::Series *> series;
+
+    history.Init(0);
+    history.Record(MakeExtAddress(1), 0x0400, &tlv, 1, 1000);
+
+    CHECK(!history.IsEnabled());
+    history.GetSeries(series);
+    CHECK(series.empty());
+}
+
+TEST(DiagnosticHistory, RingKeepsLatestSamples)
+{
+    DiagnosticHistory                              history;
+    const DiagnosticHistory::Series *              series;
+    std::vector<const DiagnosticHistory::Sample *> samples;
+
+    history.Init(MemoryFor(1));
+
+    for (uint32_t i = 0; i < DiagnosticHistory::kSamplesPerNode + 5; ++i)
+    {
+        otNetworkDiagTlv tlv = MakeMacCountersTlv(i);
+
+        history.Record(MakeExtAddress(1), 0x0400, &tlv, 1, 1000 + i);
+    }
+
+    series = history.Find(MakeExtAddress(1));
+    CHECK(series != nullptr);
+    POINTERS_EQUAL(series, history.Find(0x0400));
+
+    history.GetSamples(*series, 0, samples);
+    LONGS_EQUAL(DiagnosticHistory::kSamplesPerNode, samples.size());
+    LONGS_EQUAL(5, samples.front()->mIfInErrors);
+    LONGS_EQUAL(1005, samples.front()->mTimestamp);
+    LONGS_EQUAL(DiagnosticHistory::kSamplesPerNode + 4, samples.back()->mIfInErrors);
+
+    history.GetSamples(*series, 1000 + DiagnosticHistory::kSamplesPerNode + 3, samples);
+    LONGS_EQUAL(2, samples.size());
+}
+
+TEST(DiagnosticHistory, SkipUnsampledResponse)
+{
+    DiagnosticHistory history;
+    otNetworkDiagTlv  tlv;
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType = OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT;
+
+    history.Init(MemoryFor(1));
+    history.Record(MakeExtAddress(1), 0x0400, &tlv, 1, 1000);
+
+    POINTERS_EQUAL(nullptr, history.Find(MakeExtAddress(1)));
+}
+
+TEST(DiagnosticHistory, CountParentChanges)
+{
+    DiagnosticHistory                              history;
+    otNetworkDiagTlv                               tlv = MakeChildTableTlv(0);
+    std::vector<const DiagnosticHistory::Sample *> samples;
+
+    history.Init(MemoryFor(1));
+    history.Record(MakeExtAddress(1), 0x0401, &tlv, 1, 1000);
+    history.Record(MakeExtAddress(1), 0x0402, &tlv, 1, 2000);
+    history.Record(MakeExtAddress(1), 0x0801, &tlv, 1, 3000);
+
+    history.GetSamples(*history.Find(MakeExtAddress(1)), 0, samples);
+    LONGS_EQUAL(3, samples.size());
+    LONGS_EQUAL(0, samples[1]->mParentChanges);
+    LONGS_EQUAL(1, samples[2]->mParentChanges);
+    POINTERS_EQUAL(nullptr, history.Find(0x0401));
+    CHECK(history.Find(0x0801) != nullptr);
+}
+
+TEST(DiagnosticHistory, EvictStalestNode)
+{
+    DiagnosticHistory                              history;
+    otNetworkDiagTlv                               tlv = MakeChildTableTlv(2);
+    std::vector<const DiagnosticHistory::Series *> series;
+
+    history.Init(MemoryFor(2));
+    history.Record(MakeExtAddress(1), 0x0400, &tlv, 1, 1000);
+    history.Record(MakeExtAddress(2), 0x0800, &tlv, 1, 2000);
+    history.Record(MakeExtAddress(1), 0x0400, &tlv, 1, 3000);
+    history.Record(MakeExtAddress(3), 0x0c00, &tlv, 1, 4000);
+
+    history.GetSeries(series);
+    LONGS_EQUAL(2, series.size());
+    CHECK(history.Find(MakeExtAddress(1)) != nullptr);
+    POINTERS_EQUAL(nullptr, history.Find(MakeExtAddress(2)));
+    CHECK(history.Find(MakeExtAddress(3)) != nullptr);
+}
@@ -0,0 +1,122 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <string.h>
+
+#include "rest/diagnostic_sampler.hpp"
+
+using otbr::rest::DiagnosticSampler;
+
+static otNetworkDiagTlv MakeTlv(uint8_t aType, uint32_t aValue)
+{
+    otNetworkDiagTlv tlv;
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType          = aType;
+    tlv.mData.mTimeout = aValue;
+
+    return tlv;
+}
+
+static const uint8_t kTlvTypes[] = {OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS, OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS,
+                                    OT_NETWORK_DIAGNOSTIC_TLV_MODE, OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS};
+
+TEST_GROUP(DiagnosticSampler){};
+
+TEST(DiagnosticSampler, UnknownNodeIsFullyQueried)
+{
+    DiagnosticSampler    sampler;
+    std::vector<uint8_t> due;
+
+    sampler.StartRound(0x0400, kTlvTypes, sizeof(kTlvTypes), due);
+
+    LONGS_EQUAL(sizeof(kTlvTypes), due.size());
+    LONGS_EQUAL(0, sampler.GetBackoff(0x0400, OT_NETWORK_DIAGNOSTIC_TLV_MODE));
+}
+
+TEST(DiagnosticSampler, BackOffUnchangedTlvs)
+{
+    DiagnosticSampler    sampler;
+    otNetworkDiagTlv     tlvs[] = {MakeTlv(OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS, 0),
+                                   MakeTlv(OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS, 0),
+                                   MakeTlv(OT_NETWORK_DIAGNOSTIC_TLV_MODE, 0),
+                                   MakeTlv(OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS, 0)};
+    std::vector<uint8_t> counters = {OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS};
+    std::vector<uint8_t> due;
+
+    sampler.StartRound(0x0400, kTlvTypes, sizeof(kTlvTypes), due);
+    sampler.Record(0x0400, tlvs, 4, {});
+
+    // Each round answers the counters changed and the mode unchanged.
+    for (uint8_t backoff = 2; backoff <= DiagnosticSampler::kMaxBackoff; backoff *= 2)
+    {
+        for (uint8_t round = 1; round < backoff / 2; ++round)
+        {
+            sampler.StartRound(0x0400, kTlvTypes, sizeof(kTlvTypes), due);
+            LONGS_EQUAL(3, due.size());
+            LONGS_EQUAL(OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS, due[2]);
+            sampler.Record(0x0400, &tlvs[3], 1, counters);
+        }
+
+        sampler.StartRound(0x0400, kTlvTypes, sizeof(kTlvTypes), due);
+        LONGS_EQUAL(4, due.size());
+        sampler.Record(0x0400, tlvs, 4, counters);
+
+        LONGS_EQUAL(backoff, sampler.GetBackoff(0x0400, OT_NETWORK_DIAGNOSTIC_TLV_MODE));
+        LONGS_EQUAL(1, sampler.GetBackoff(0x0400, OT_NETWORK_DIAGNOSTIC_TLV_MAC_COUNTERS));
+    }
+
+    // A change brings the TLV back to every round.
+    sampler.Record(0x0400, &tlvs[2], 1, {OT_NETWORK_DIAGNOSTIC_TLV_MODE});
+    LONGS_EQUAL(1, sampler.GetBackoff(0x0400, OT_NETWORK_DIAGNOSTIC_TLV_MODE));
+}
+
+TEST(DiagnosticSampler, LostQueryStaysDue)
+{
+    DiagnosticSampler    sampler;
+    otNetworkDiagTlv     tlvs[] = {MakeTlv(OT_NETWORK_DIAGNOSTIC_TLV_MODE, 0)};
+    std::vector<uint8_t> due;
+
+    sampler.Record(0x0400, tlvs, 1, {});
+    sampler.Record(0x0400, tlvs, 1, {});
+    LONGS_EQUAL(2, sampler.GetBackoff(0x0400, OT_NETWORK_DIAGNOSTIC_TLV_MODE));
+
+    sampler.StartRound(0x0400, kTlvTypes, sizeof(kTlvTypes), due);
+    LONGS_EQUAL(3, due.size());
+
+    // The mode is due in the second round, and stays due until the node answers.
+    sampler.StartRound(0x0400, kTlvTypes, sizeof(kTlvTypes), due);
+    LONGS_EQUAL(4, due.size());
+    sampler.StartRound(0x0400, kTlvTypes, sizeof(kTlvTypes), due);
+    LONGS_EQUAL(4, due.size());
+
+    sampler.Remove(0x0400);
+    LONGS_EQUAL(0, sampler.GetBackoff(0x0400, OT_NETWORK_DIAGNOSTIC_TLV_MODE));
+}
@@ -0,0 +1,168 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <string.h>
+
+#include "rest/diagnostic_store.hpp"
+
+using otbr::rest::DiagnosticStore;
+using std::chrono::seconds;
+
+static otNetworkDiagTlv MakeRloc16Tlv(uint16_t aRloc16)
+{
+    otNetworkDiagTlv tlv;
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType         = OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS;
+    tlv.mData.mAddr16 = aRloc16;
+
+    return tlv;
+}
+
+static otNetworkDiagTlv MakeExtAddressTlv(uint8_t aLastByte)
+{
+    otNetworkDiagTlv tlv;
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                                         = OT_NETWORK_DIAGNOSTIC_TLV_EXT_ADDRESS;
+    tlv.mData.mExtAddress.m8[OT_EXT_ADDRESS_SIZE - 1] = aLastByte;
+
+    return tlv;
+}
+
+static otNetworkDiagTlv MakeTimeoutTlv(uint32_t aTimeout)
+{
+    otNetworkDiagTlv tlv;
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType          = OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT;
+    tlv.mData.mTimeout = aTimeout;
+
+    return tlv;
+}
+
+TEST_GROUP(DiagnosticStore)
+{
+    steady_clock::time_point mNow = steady_clock::now();
+};
+
+TEST(DiagnosticStore, MergePartialResponse)
+{
+    DiagnosticStore               store(seconds(3));
+    otNetworkDiagTlv              full[]    = {MakeRloc16Tlv(0x0400), MakeExtAddressTlv(1), MakeTimeoutTlv(10)};
+    otNetworkDiagTlv              partial[] = {MakeRloc16Tlv(0x0400), MakeTimeoutTlv(20)};
+    const DiagnosticStore::Entry *entry;
+
+    store.Update(full, 3, mNow);
+    entry = store.Update(partial, 2, mNow + seconds(1));
+
+    CHECK(entry != nullptr);
+    POINTERS_EQUAL(entry, store.Find(0x0400));
+    LONGS_EQUAL(1, store.GetEntries().size());
+    LONGS_EQUAL(3, entry->mTlvs.size());
+    LONGS_EQUAL(OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT, entry->mTlvs[2].mType);
+    LONGS_EQUAL(20, entry->mTlvs[2].mData.mTimeout);
+    CHECK(entry->mUpdateTime == mNow + seconds(1));
+}
+
+TEST(DiagnosticStore, IdentifyByExtAddress)
+{
+    DiagnosticStore  store(seconds(3));
+    otNetworkDiagTlv full[]    = {MakeRloc16Tlv(0x0400), MakeExtAddressTlv(1)};
+    otNetworkDiagTlv partial[] = {MakeExtAddressTlv(1), MakeTimeoutTlv(20)};
+    otNetworkDiagTlv unknown[] = {MakeExtAddressTlv(2), MakeTimeoutTlv(20)};
+
+    store.Update(full, 2, mNow);
+
+    POINTERS_EQUAL(store.Find(0x0400), store.Update(partial, 2, mNow));
+    LONGS_EQUAL(3, store.Find(0x0400)->mTlvs.size());
+    POINTERS_EQUAL(nullptr, store.Update(unknown, 2, mNow));
+    LONGS_EQUAL(1, store.GetEntries().size());
+}
+
+TEST(DiagnosticStore, FollowRloc16Change)
+{
+    DiagnosticStore  store(seconds(3));
+    otNetworkDiagTlv before[]   = {MakeRloc16Tlv(0x0401), MakeExtAddressTlv(1), MakeTimeoutTlv(10)};
+    otNetworkDiagTlv after[]    = {MakeRloc16Tlv(0x0800), MakeExtAddressTlv(1)};
+    otNetworkDiagTlv takeover[] = {MakeRloc16Tlv(0x0800), MakeExtAddressTlv(2)};
+
+    store.Update(before, 3, mNow);
+    store.Update(after, 2, mNow);
+
+    POINTERS_EQUAL(nullptr, store.Find(0x0401));
+    LONGS_EQUAL(2, store.Find(0x0800)->mTlvs.size());
+
+    // Another node now uses the RLOC16, nothing reported by the previous one is kept.
+    store.Update(takeover, 2, mNow);
+
+    LONGS_EQUAL(1, store.GetEntries().size());
+    LONGS_EQUAL(2, store.Find(0x0800)->mExtAddress.m8[OT_EXT_ADDRESS_SIZE - 1]);
+}
+
+TEST(DiagnosticStore, ReportChangedTypes)
+{
+    DiagnosticStore      store(seconds(3));
+    otNetworkDiagTlv     first[]  = {MakeRloc16Tlv(0x0400), MakeTimeoutTlv(10)};
+    otNetworkDiagTlv     second[] = {MakeRloc16Tlv(0x0400), MakeTimeoutTlv(20)};
+    std::vector<uint8_t> changed;
+
+    // TLVs seen for the first time are new.
+    store.Update(first, 2, mNow, &changed);
+    LONGS_EQUAL(2, changed.size());
+
+    store.Update(first, 2, mNow, &changed);
+    LONGS_EQUAL(0, changed.size());
+
+    store.Update(second, 2, mNow, &changed);
+    LONGS_EQUAL(1, changed.size());
+    LONGS_EQUAL(OT_NETWORK_DIAGNOSTIC_TLV_TIMEOUT, changed[0]);
+}
+
+TEST(DiagnosticStore, ExpireLeastRecentlyUpdated)
+{
+    DiagnosticStore  store(seconds(3));
+    otNetworkDiagTlv first[]  = {MakeRloc16Tlv(0x0400)};
+    otNetworkDiagTlv second[] = {MakeRloc16Tlv(0x0800)};
+
+    store.Update(first, 1, mNow);
+    store.Update(second, 1, mNow + seconds(1));
+    store.Update(first, 1, mNow + seconds(2));
+
+    store.Expire(mNow + seconds(3));
+    LONGS_EQUAL(2, store.GetEntries().size());
+
+    store.Expire(mNow + seconds(4));
+    POINTERS_EQUAL(nullptr, store.Find(0x0800));
+    CHECK(store.Find(0x0400) != nullptr);
+
+    store.Expire(mNow + seconds(5));
+    LONGS_EQUAL(0, store.GetEntries().size());
+}
@@ -0,0 +1,110 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <string.h>
+
+#include "rest/neighbor_log.hpp"
+
+using otbr::rest::NeighborLog;
+
+static otNeighborInfo MakeNeighbor(uint16_t aRloc16)
+{
+    otNeighborInfo neighbor;
+
+    memset(&neighbor, 0, sizeof(neighbor));
+    neighbor.mRloc16 = aRloc16;
+
+    return neighbor;
+}
+
+TEST_GROUP(RestNeighborLog){};
+
+TEST(RestNeighborLog, ListChangesSinceSequence)
+{
+    NeighborLog                              log;
+    std::vector<const NeighborLog::Change *> changes;
+
+    CHECK(log.HasChangesSince(0));
+    LONGS_EQUAL(1, log.Add(true, MakeNeighbor(0x0401)));
+    LONGS_EQUAL(2, log.Add(true, MakeNeighbor(0x0402)));
+    LONGS_EQUAL(3, log.Add(false, MakeNeighbor(0x0401)));
+    LONGS_EQUAL(3, log.GetSequence());
+
+    log.GetChanges(1, changes);
+    LONGS_EQUAL(2, changes.size());
+    LONGS_EQUAL(2, changes[0]->mSequence);
+    CHECK(changes[0]->mAdded);
+    LONGS_EQUAL(0x0402, changes[0]->mNeighbor.mRloc16);
+    LONGS_EQUAL(3, changes[1]->mSequence);
+    CHECK(!changes[1]->mAdded);
+
+    log.GetChanges(3, changes);
+    CHECK(changes.empty());
+
+    // A client ahead of the log, e.g. from before a restart, needs the whole table.
+    CHECK(!log.HasChangesSince(4));
+}
+
+TEST(RestNeighborLog, DropOldestChanges)
+{
+    NeighborLog                              log(2);
+    std::vector<const NeighborLog::Change *> changes;
+
+    log.Add(true, MakeNeighbor(0x0401));
+    log.Add(true, MakeNeighbor(0x0402));
+    log.Add(true, MakeNeighbor(0x0403));
+
+    CHECK(!log.HasChangesSince(0));
+    log.GetChanges(0, changes);
+    CHECK(changes.empty());
+
+    CHECK(log.HasChangesSince(1));
+    log.GetChanges(1, changes);
+    LONGS_EQUAL(2, changes.size());
+    LONGS_EQUAL(0x0402, changes[0]->mNeighbor.mRloc16);
+}
+
+TEST(RestNeighborLog, ClearKeepsSequence)
+{
+    NeighborLog                              log;
+    std::vector<const NeighborLog::Change *> changes;
+
+    log.Add(true, MakeNeighbor(0x0401));
+    log.Clear();
+
+    LONGS_EQUAL(1, log.GetSequence());
+    CHECK(!log.HasChangesSince(0));
+    CHECK(log.HasChangesSince(1));
+
+    LONGS_EQUAL(2, log.Add(true, MakeNeighbor(0x0402)));
+    log.GetChanges(1, changes);
+    LONGS_EQUAL(1, changes.size());
+    LONGS_EQUAL(2, changes[0]->mSequence);
+}
@@ -0,0 +1,140 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "rest/ot_bridge.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/mainloop_poller.hpp"
+
+using otbr::MainloopPoller;
+using otbr::rest::OtBridge;
+
+static void PollOnce(void)
+{
+    otSysMainloopContext mainloop;
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {0, 100000};
+
+    CHECK(MainloopPoller::Get().Poll(mainloop) >= 0);
+}
+
+TEST_GROUP(OtBridge){};
+
+TEST(OtBridge, TestDisabled)
+{
+    OtBridge         bridge;
+    std::vector<int> results;
+
+    bridge.SetDoneHandler([&results]() { results.push_back(0); });
+
+    // Without the REST thread, calls and tasks run right away, and the done handler is not needed.
+    bridge.Call([&results]() { results.push_back(1); }, [&results]() { results.push_back(2); });
+    bridge.PostToRestThread([&results]() { results.push_back(3); });
+
+    CHECK(!bridge.IsEnabled());
+    CHECK(results == std::vector<int>({1, 2, 3}));
+}
+
+TEST(OtBridge, TestRestThread)
+{
+    OtBridge          bridge;
+    std::thread::id   mainloopId = std::this_thread::get_id();
+    std::thread::id   taskId;
+    std::thread::id   doneId;
+    std::thread::id   restId;
+    otbrError         restError;
+    std::atomic<int>  doneCount(0);
+    std::atomic<bool> stopped(false);
+    int               value = 0;
+
+    CHECK(bridge.Enable() == OTBR_ERROR_NONE);
+    CHECK(bridge.IsEnabled());
+    bridge.SetDoneHandler([&doneCount]() { doneCount++; });
+
+    std::thread restThread([&]() {
+        MainloopPoller poller;
+        bool           running = true;
+
+        MainloopPoller::SetThreadPoller(&poller);
+        restId    = std::this_thread::get_id();
+        restError = bridge.InitRestThread();
+
+        bridge.Call(
+            [&]() {
+                taskId = std::this_thread::get_id();
+                value  = 1;
+            },
+            [&]() {
+                doneId = std::this_thread::get_id();
+                value++;
+            });
+        bridge.PostToRestThread([&running]() { running = false; });
+
+        while (restError == OTBR_ERROR_NONE && (running || doneCount == 0))
+        {
+            otSysMainloopContext mainloop;
+
+            FD_ZERO(&mainloop.mReadFdSet);
+            FD_ZERO(&mainloop.mWriteFdSet);
+            FD_ZERO(&mainloop.mErrorFdSet);
+            mainloop.mMaxFd   = -1;
+            mainloop.mTimeout = {0, 100000};
+
+            // Failures are checked by the test thread.
+            poller.Poll(mainloop);
+            bridge.ProcessRestTasks();
+        }
+
+        MainloopPoller::SetThreadPoller(nullptr);
+        stopped = true;
+    });
+
+    while (!stopped)
+    {
+        PollOnce();
+        bridge.ProcessOtTasks();
+    }
+
+    restThread.join();
+
+    // The task runs on the mainloop, then its completion on the REST thread.
+    CHECK(restError == OTBR_ERROR_NONE);
+    CHECK(taskId == mainloopId);
+    CHECK(doneId == restId);
+    CHECK(value == 2);
+    CHECK(doneCount == 1);
+}
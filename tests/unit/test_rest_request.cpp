@@ -0,0 +1,162 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <string.h>
+
+#include <string>
+
+#include "rest/request.hpp"
+
+using otbr::rest::Request;
+
+static void AddHeader(Request &aRequest, const char *aField, const char *aValue)
+{
+    aRequest.SetHeaderField(aField, strlen(aField));
+    aRequest.SetHeaderValue(aValue, strlen(aValue));
+}
+
+TEST_GROUP(RestRequest){};
+
+TEST(RestRequest, AcceptsCbor)
+{
+    Request request;
+
+    CHECK(!request.AcceptsCbor());
+
+    AddHeader(request, "Accept", "application/cbor");
+    CHECK(request.AcceptsCbor());
+
+    request.Reset();
+    AddHeader(request, "accept", "application/json, application/cbor;q=0.5");
+    CHECK(!request.AcceptsCbor());
+
+    request.Reset();
+    AddHeader(request, "Accept", "*/*;q=0.8, application/CBOR; q=0.9");
+    CHECK(request.AcceptsCbor());
+
+    request.Reset();
+    AddHeader(request, "Accept", "application/cbor;q=0");
+    CHECK(!request.AcceptsCbor());
+}
+
+TEST(RestRequest, AcceptsGzip)
+{
+    Request request;
+
+    CHECK(!request.AcceptsGzip());
+
+    AddHeader(request, "Accept-Encoding", "deflate, gzip");
+    CHECK(request.AcceptsGzip());
+
+    request.Reset();
+    AddHeader(request, "Accept-Encoding", "*");
+    CHECK(request.AcceptsGzip());
+
+    request.Reset();
+    AddHeader(request, "Accept-Encoding", "gzip;q=0, *");
+    CHECK(!request.AcceptsGzip());
+
+    request.Reset();
+    AddHeader(request, "Accept-Encoding", "identity");
+    CHECK(!request.AcceptsGzip());
+}
+
+TEST(RestRequest, GetUrl)
+{
+    Request     request;
+    const char *url = "/node/rloc16/?tlvs=0";
+
+    STRCMP_EQUAL("/", request.GetUrl().c_str());
+
+    // The url may be delivered in several parts.
+    request.SetUrl(url, 6);
+    request.SetUrl(url + 6, strlen(url) - 6);
+    STRCMP_EQUAL("/node/rloc16", request.GetUrl().c_str());
+    STRCMP_EQUAL(url, request.GetRawUrl().c_str());
+
+    request.Reset();
+    request.SetUrl("//?a=1", 6);
+    STRCMP_EQUAL("/", request.GetUrl().c_str());
+}
+
+TEST(RestRequest, GetQueryValue)
+{
+    Request     request;
+    const char *url = "/diagnostics?tlv=1&tlvs=ExtAddress,1&stream&offset=&limit=10";
+
+    request.SetUrl(url, strlen(url));
+    STRCMP_EQUAL("1", request.GetQueryValue("tlv").c_str());
+    STRCMP_EQUAL("ExtAddress,1", request.GetQueryValue("tlvs").c_str());
+    STRCMP_EQUAL("", request.GetQueryValue("stream").c_str());
+    STRCMP_EQUAL("", request.GetQueryValue("offset").c_str());
+    STRCMP_EQUAL("10", request.GetQueryValue("limit").c_str());
+    STRCMP_EQUAL("", request.GetQueryValue("lim").c_str());
+    STRCMP_EQUAL("", request.GetQueryValue("diagnostics").c_str());
+}
+
+TEST(RestRequest, MatchesIfNoneMatch)
+{
+    Request request;
+
+    CHECK(!request.MatchesIfNoneMatch("\"1\""));
+
+    AddHeader(request, "If-None-Match", "\"2\", W/\"1\"");
+    CHECK(request.MatchesIfNoneMatch("\"1\""));
+    CHECK(request.MatchesIfNoneMatch("\"2\""));
+    CHECK(!request.MatchesIfNoneMatch("\"3\""));
+    CHECK(!request.MatchesIfNoneMatch(""));
+
+    request.Reset();
+    AddHeader(request, "If-None-Match", " * ");
+    CHECK(request.MatchesIfNoneMatch("\"3\""));
+}
+
+TEST(RestRequest, HeadersAfterReset)
+{
+    Request     request;
+    std::string value(300, 'x');
+
+    for (int i = 0; i < 3; ++i)
+    {
+        // Headers split across reads are appended in parts.
+        request.SetHeaderField("X-", 2);
+        request.SetHeaderField("Long", 4);
+        request.SetHeaderValue(value.data(), 100);
+        request.SetHeaderValue(value.data() + 100, 200);
+        AddHeader(request, "Accept", "application/cbor");
+
+        STRCMP_EQUAL(value.c_str(), request.GetHeaderValue("x-long").c_str());
+        CHECK(request.AcceptsCbor());
+        STRCMP_EQUAL("", request.GetHeaderValue("Accept-Encoding").c_str());
+
+        request.Reset();
+        STRCMP_EQUAL("", request.GetHeaderValue("X-Long").c_str());
+    }
+}
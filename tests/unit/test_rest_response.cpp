@@ -0,0 +1,192 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <string.h>
+
+#if OTBR_ENABLE_REST_COMPRESSION
+#include <zlib.h>
+#endif
+
+#include "rest/json.hpp"
+#include "rest/response.hpp"
+
+using otbr::rest::Response;
+
+TEST_GROUP(RestResponse){};
+
+TEST(RestResponse, SkipSmallBody)
+{
+    Response    response;
+    std::string body = "{\"Rloc16\":1024}";
+
+    response.SetBody(body);
+    response.SetETag("\"0123\"");
+
+    CHECK(!response.Compress());
+    STRCMP_EQUAL(body.c_str(), response.GetBody().c_str());
+    STRCMP_EQUAL("\"0123\"", response.GetETag().c_str());
+    CHECK(response.SerializeHeader().find("Content-Encoding") == std::string::npos);
+}
+
+TEST(RestResponse, StaleBody)
+{
+    Response    response;
+    std::string body = "{\"Rloc16\":1024}";
+
+    response.SetBody(body);
+    CHECK(response.SerializeHeader().find("Warning") == std::string::npos);
+
+    response.SetStale(42);
+    CHECK(response.SerializeHeader().find("\r\nAge: 42\r\n") != std::string::npos);
+    CHECK(response.SerializeHeader().find("\r\nWarning: 110 - \"Response is Stale\"\r\n") != std::string::npos);
+}
+
+#if OTBR_ENABLE_REST_COMPRESSION
+TEST(RestResponse, CompressLargeBody)
+{
+    Response    response;
+    std::string body;
+    std::string inflated;
+    z_stream    stream;
+
+    while (body.size() < 2 * Response::kCompressThreshold)
+    {
+        body += "{\"ExtAddress\":\"00000000000000AB\",\"Rloc16\":1024},";
+    }
+
+    response.SetBody(body);
+    response.SetETag("\"0123\"");
+    inflated.resize(body.size() + 1);
+
+    CHECK(response.Compress());
+    CHECK(response.GetBody().size() < body.size());
+    STRCMP_EQUAL("W/\"0123\"", response.GetETag().c_str());
+    CHECK(response.SerializeHeader().find("\r\nContent-Encoding: gzip") != std::string::npos);
+
+    // A gzip stream, which inflates back to the original body.
+    memset(&stream, 0, sizeof(stream));
+    LONGS_EQUAL(Z_OK, inflateInit2(&stream, 15 + 16));
+    stream.next_in   = reinterpret_cast<Bytef *>(const_cast<char *>(response.GetBody().data()));
+    stream.avail_in  = static_cast<uInt>(response.GetBody().size());
+    stream.next_out  = reinterpret_cast<Bytef *>(&inflated[0]);
+    stream.avail_out = static_cast<uInt>(inflated.size());
+    LONGS_EQUAL(Z_STREAM_END, inflate(&stream, Z_FINISH));
+    inflateEnd(&stream);
+
+    inflated.resize(stream.total_out);
+    CHECK(inflated == body);
+}
+#endif
+
+TEST(RestResponse, ChunkedBody)
+{
+    static const char *const kParts[] = {"[1,", "", "2]"};
+
+    Response    response;
+    size_t      next = 0;
+    std::string header;
+
+    response.SetChunked([&next](std::string &aChunk) {
+        aChunk += kParts[next++];
+        return next == sizeof(kParts) / sizeof(kParts[0]);
+    });
+
+    CHECK(response.IsChunked());
+    CHECK(response.HasMoreChunks());
+
+    response.NextChunk();
+    STRCMP_EQUAL("3\r\n[1,\r\n", response.GetBody().c_str());
+    CHECK(response.HasMoreChunks());
+
+    // An empty part is skipped, as it would end the body.
+    response.NextChunk();
+    STRCMP_EQUAL("2\r\n2]\r\n0\r\n\r\n", response.GetBody().c_str());
+    CHECK(!response.HasMoreChunks());
+
+    header = response.SerializeHeader();
+    CHECK(header.find("\r\nTransfer-Encoding: chunked") != std::string::npos);
+    CHECK(header.find("Content-Length") == std::string::npos);
+
+    response.Reset();
+    CHECK(!response.IsChunked());
+    CHECK(response.SerializeHeader().find("Transfer-Encoding") == std::string::npos);
+}
+
+TEST(RestResponse, StreamEventWithId)
+{
+    Response response;
+
+    response.SetStream();
+    response.AppendStreamEvent("{}", 7);
+    STRCMP_EQUAL("10\r\nid: 7\ndata: {}\n\n\r\n", response.GetBody().c_str());
+
+    response.SetStreamSequence(7);
+    response.Reset();
+    CHECK(!response.IsStream());
+    LONGS_EQUAL(0, response.GetStreamSequence());
+}
+
+TEST(RestResponse, ChunkedDiagnostics)
+{
+    std::vector<std::vector<otNetworkDiagTlv>> diagSet;
+    std::vector<std::vector<otNetworkDiagTlv>> copy;
+    std::string                                chunked;
+    std::string                                chunk;
+    otbr::rest::ChunkProducer                  producer;
+    size_t                                     chunks = 0;
+    bool                                       last   = false;
+
+    // Enough nodes for several chunks.
+    for (uint16_t i = 0; i < 1000; i++)
+    {
+        otNetworkDiagTlv tlv;
+
+        memset(&tlv, 0, sizeof(tlv));
+        tlv.mType         = OT_NETWORK_DIAGNOSTIC_TLV_SHORT_ADDRESS;
+        tlv.mData.mAddr16 = i;
+        diagSet.push_back({tlv, tlv});
+    }
+
+    copy     = diagSet;
+    producer = otbr::rest::Json::Diag2JsonChunks(copy);
+    CHECK(copy.empty());
+
+    while (!last)
+    {
+        chunk.clear();
+        last = producer(chunk);
+        CHECK(chunk.size() < 2 * otbr::rest::kChunkSize);
+        chunked += chunk;
+        chunks++;
+    }
+
+    CHECK(chunks > 1);
+    STRCMP_EQUAL(otbr::rest::Json::Diag2JsonString(diagSet).c_str(), chunked.c_str());
+}
@@ -0,0 +1,109 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "rest/response_snapshot.hpp"
+
+using otbr::rest::ResponseSnapshot;
+
+TEST_GROUP(RestResponseSnapshot)
+{
+    char mPath[32];
+
+    void setup()
+    {
+        int fd;
+
+        strcpy(mPath, "/tmp/rest-snapshot-XXXXXX");
+        fd = mkstemp(mPath);
+        close(fd);
+        unlink(mPath);
+    }
+
+    void teardown()
+    {
+        unlink(mPath);
+        unlink((std::string(mPath) + ".tmp").c_str());
+    }
+};
+
+TEST(RestResponseSnapshot, TestSaveAndLoad)
+{
+    ResponseSnapshot snapshot;
+    ResponseSnapshot loaded;
+
+    // A missing file is an empty snapshot.
+    CHECK(loaded.Load(mPath, 1000, 100) == OTBR_ERROR_NONE);
+    CHECK(loaded.GetEntries().empty());
+
+    snapshot.Set("/node", ResponseSnapshot::Entry{950, "{\"State\":\"leader\"}", std::string("\xa0", 1)});
+    snapshot.Set("/topology", ResponseSnapshot::Entry{980, "{}", std::string("\0\1", 2)});
+    CHECK(snapshot.Save(mPath) == OTBR_ERROR_NONE);
+
+    CHECK(loaded.Load(mPath, 1000, 100) == OTBR_ERROR_NONE);
+    CHECK(loaded.GetEntries().size() == 2);
+    CHECK(loaded.Find("/node")->mTime == 950);
+    CHECK(loaded.Find("/node")->mJson == "{\"State\":\"leader\"}");
+    CHECK(loaded.Find("/node")->mCbor == std::string("\xa0", 1));
+    CHECK(loaded.Find("/topology")->mCbor == std::string("\0\1", 2));
+    CHECK(loaded.Find("/diagnostics") == nullptr);
+}
+
+TEST(RestResponseSnapshot, TestDropOldEntries)
+{
+    ResponseSnapshot snapshot;
+
+    snapshot.Set("/node", ResponseSnapshot::Entry{100, "{}", ""});
+    snapshot.Set("/topology", ResponseSnapshot::Entry{950, "{}", ""});
+    CHECK(snapshot.Save(mPath) == OTBR_ERROR_NONE);
+
+    CHECK(snapshot.Load(mPath, 1000, 100) == OTBR_ERROR_NONE);
+    CHECK(snapshot.Find("/node") == nullptr);
+    CHECK(snapshot.Find("/topology") != nullptr);
+}
+
+TEST(RestResponseSnapshot, TestDropTruncatedEntry)
+{
+    ResponseSnapshot snapshot;
+
+    snapshot.Set("/node", ResponseSnapshot::Entry{950, "{\"State\":\"leader\"}", ""});
+    snapshot.Set("/topology", ResponseSnapshot::Entry{950, "{}", ""});
+    CHECK(snapshot.Save(mPath) == OTBR_ERROR_NONE);
+
+    // Cut the last entry, the "/topology" one, in the middle of its JSON body.
+    CHECK(truncate(mPath, sizeof("OTBRSNP1") - 1 + 1 + 5 + 8 + 4 + 18 + 4 + 1 + 9 + 8 + 4 + 1) == 0);
+
+    CHECK(snapshot.Load(mPath, 1000, 100) == OTBR_ERROR_NONE);
+    CHECK(snapshot.GetEntries().size() == 1);
+    CHECK(snapshot.Find("/node") != nullptr);
+}
@@ -0,0 +1,132 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "rest/router.hpp"
+
+using otbr::rest::HttpMethod;
+using otbr::rest::PathParams;
+using otbr::rest::RouteResult;
+using otbr::rest::Router;
+
+TEST_GROUP(Router)
+{
+    Router<int> mRouter;
+    int         mHandler;
+    PathParams  mParams;
+
+    void setup()
+    {
+        mRouter.Add(HttpMethod::kGet, "/", 1);
+        mRouter.Add(HttpMethod::kGet, "/node", 2);
+        mRouter.Add(HttpMethod::kGet, "/node/rloc16", 3);
+        mRouter.Add(HttpMethod::kGet, "/diagnostics", 4);
+        mRouter.Add(HttpMethod::kGet, "/diagnostics/history", 5);
+        mRouter.Add(HttpMethod::kGet, "/diagnostics/{rloc16}", 6);
+        mRouter.Add(HttpMethod::kPut, "/diagnostics/{rloc16}", 7);
+        mRouter.Add(HttpMethod::kGet, "/diagnostics/{rloc16}/tlvs/{type}", 8);
+        mHandler = 0;
+    }
+};
+
+TEST(Router, MatchLiteral)
+{
+    CHECK(mRouter.Match(HttpMethod::kGet, "/", mHandler, mParams) == RouteResult::kMatched);
+    LONGS_EQUAL(1, mHandler);
+    CHECK(mRouter.Match(HttpMethod::kGet, "/node", mHandler, mParams) == RouteResult::kMatched);
+    LONGS_EQUAL(2, mHandler);
+    CHECK(mRouter.Match(HttpMethod::kGet, "/node/rloc16", mHandler, mParams) == RouteResult::kMatched);
+    LONGS_EQUAL(3, mHandler);
+    CHECK(mParams.empty());
+}
+
+TEST(Router, IgnoreQueryAndEmptySegments)
+{
+    CHECK(mRouter.Match(HttpMethod::kGet, "/node/", mHandler, mParams) == RouteResult::kMatched);
+    LONGS_EQUAL(2, mHandler);
+    CHECK(mRouter.Match(HttpMethod::kGet, "//node//rloc16", mHandler, mParams) == RouteResult::kMatched);
+    LONGS_EQUAL(3, mHandler);
+    CHECK(mRouter.Match(HttpMethod::kGet, "/diagnostics?tlvs=0&stream=1", mHandler, mParams) ==
+          RouteResult::kMatched);
+    LONGS_EQUAL(4, mHandler);
+    CHECK(mRouter.Match(HttpMethod::kGet, "?offset=1", mHandler, mParams) == RouteResult::kMatched);
+    LONGS_EQUAL(1, mHandler);
+}
+
+TEST(Router, MatchParameters)
+{
+    CHECK(mRouter.Match(HttpMethod::kGet, "/diagnostics/0x0400?tlvs=0", mHandler, mParams) ==
+          RouteResult::kMatched);
+    LONGS_EQUAL(6, mHandler);
+    LONGS_EQUAL(1, mParams.size());
+    STRCMP_EQUAL("rloc16", mParams[0].first.c_str());
+    STRCMP_EQUAL("0x0400", mParams[0].second.c_str());
+
+    CHECK(mRouter.Match(HttpMethod::kGet, "/diagnostics/0x0400/tlvs/5", mHandler, mParams) ==
+          RouteResult::kMatched);
+    LONGS_EQUAL(8, mHandler);
+    LONGS_EQUAL(2, mParams.size());
+    STRCMP_EQUAL("0x0400", mParams[0].second.c_str());
+    STRCMP_EQUAL("type", mParams[1].first.c_str());
+    STRCMP_EQUAL("5", mParams[1].second.c_str());
+}
+
+TEST(Router, PreferLiteral)
+{
+    CHECK(mRouter.Match(HttpMethod::kGet, "/diagnostics/history", mHandler, mParams) == RouteResult::kMatched);
+    LONGS_EQUAL(5, mHandler);
+    CHECK(mParams.empty());
+
+    // A literal segment which does not lead to a route falls back to the parameter.
+    CHECK(mRouter.Match(HttpMethod::kGet, "/diagnostics/history/tlvs/5", mHandler, mParams) ==
+          RouteResult::kMatched);
+    LONGS_EQUAL(8, mHandler);
+    STRCMP_EQUAL("history", mParams[0].second.c_str());
+}
+
+TEST(Router, DispatchByMethod)
+{
+    CHECK(mRouter.Match(HttpMethod::kPut, "/diagnostics/0x0400", mHandler, mParams) == RouteResult::kMatched);
+    LONGS_EQUAL(7, mHandler);
+    CHECK(mRouter.Match(HttpMethod::kPost, "/diagnostics/0x0400", mHandler, mParams) ==
+          RouteResult::kMethodNotAllowed);
+    CHECK(mRouter.Match(HttpMethod::kPut, "/node", mHandler, mParams) == RouteResult::kMethodNotAllowed);
+    CHECK(mRouter.Match(static_cast<HttpMethod>(30), "/node", mHandler, mParams) == RouteResult::kMethodNotAllowed);
+}
+
+TEST(Router, NotFound)
+{
+    mHandler = 0;
+    CHECK(mRouter.Match(HttpMethod::kGet, "/networks", mHandler, mParams) == RouteResult::kNotFound);
+    CHECK(mRouter.Match(HttpMethod::kGet, "/node/rloc", mHandler, mParams) == RouteResult::kNotFound);
+    CHECK(mRouter.Match(HttpMethod::kGet, "/node/rloc16/more", mHandler, mParams) == RouteResult::kNotFound);
+    CHECK(mRouter.Match(HttpMethod::kGet, "/diagnostics/0x0400/tlvs", mHandler, mParams) == RouteResult::kNotFound);
+    LONGS_EQUAL(0, mHandler);
+    CHECK(mParams.empty());
+}
@@ -0,0 +1,165 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <string.h>
+
+#include "rest/topology.hpp"
+
+using otbr::rest::Topology;
+
+static otNetworkDiagTlv MakeRouteTlv(uint8_t aNeighborId, uint8_t aLinkQuality)
+{
+    otNetworkDiagTlv tlv;
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                                      = OT_NETWORK_DIAGNOSTIC_TLV_ROUTE;
+    tlv.mData.mRoute.mRouteCount                   = 2;
+    tlv.mData.mRoute.mRouteData[0].mRouterId       = aNeighborId;
+    tlv.mData.mRoute.mRouteData[0].mLinkQualityIn  = aLinkQuality;
+    tlv.mData.mRoute.mRouteData[0].mLinkQualityOut = aLinkQuality;
+    // A router only reachable through the neighbor.
+    tlv.mData.mRoute.mRouteData[1].mRouterId  = aNeighborId + 1;
+    tlv.mData.mRoute.mRouteData[1].mRouteCost = 2;
+
+    return tlv;
+}
+
+static otNetworkDiagTlv MakeChildTableTlv(uint8_t aCount)
+{
+    otNetworkDiagTlv tlv;
+
+    memset(&tlv, 0, sizeof(tlv));
+    tlv.mType                    = OT_NETWORK_DIAGNOSTIC_TLV_CHILD_TABLE;
+    tlv.mData.mChildTable.mCount = aCount;
+
+    for (uint8_t i = 0; i < aCount; ++i)
+    {
+        tlv.mData.mChildTable.mTable[i].mChildId = i + 1;
+        tlv.mData.mChildTable.mTable[i].mTimeout = 10;
+    }
+
+    return tlv;
+}
+
+TEST_GROUP(Topology)
+{
+    std::vector<const Topology::Node *> mNodes;
+    std::vector<const Topology::Link *> mLinks;
+};
+
+TEST(Topology, BuildFromDiagnostics)
+{
+    Topology topology;
+
+    topology.Update(0x0400, {MakeRouteTlv(2, 3), MakeChildTableTlv(2)});
+    topology.GetChanges(0, mNodes, mLinks);
+
+    CHECK_FALSE(topology.HasChangesSince(0));
+    LONGS_EQUAL(1, mNodes.size());
+    LONGS_EQUAL(0x0400, mNodes[0]->mRloc16);
+    LONGS_EQUAL(3, mLinks.size());
+    LONGS_EQUAL(0x0800, mLinks[0]->mTo);
+    CHECK_FALSE(mLinks[0]->mIsChild);
+    LONGS_EQUAL(3, mLinks[0]->mLinkQualityIn);
+    LONGS_EQUAL(0x0401, mLinks[1]->mTo);
+    CHECK_TRUE(mLinks[1]->mIsChild);
+    LONGS_EQUAL(10, mLinks[1]->mChildTimeout);
+    LONGS_EQUAL(0x0402, mLinks[2]->mTo);
+}
+
+TEST(Topology, ListOnlyChanges)
+{
+    Topology topology;
+    uint64_t version;
+
+    topology.Update(0x0400, {MakeRouteTlv(2, 3), MakeChildTableTlv(2)});
+    topology.Update(0x0800, {MakeRouteTlv(1, 3)});
+    version = topology.GetVersion();
+
+    // Unchanged diagnostics do not change the topology.
+    topology.Update(0x0400, {MakeRouteTlv(2, 3), MakeChildTableTlv(2)});
+    LONGS_EQUAL(version, topology.GetVersion());
+
+    topology.Update(0x0400, {MakeRouteTlv(2, 1)});
+    CHECK_TRUE(topology.HasChangesSince(version));
+    topology.GetChanges(version, mNodes, mLinks);
+
+    LONGS_EQUAL(0, mNodes.size());
+    LONGS_EQUAL(1, mLinks.size());
+    LONGS_EQUAL(0x0400, mLinks[0]->mFrom);
+    LONGS_EQUAL(0x0800, mLinks[0]->mTo);
+    LONGS_EQUAL(1, mLinks[0]->mLinkQualityIn);
+    CHECK(mLinks[0]->mVersion > version);
+}
+
+TEST(Topology, ReportRemovals)
+{
+    Topology topology;
+    uint64_t version;
+
+    topology.Update(0x0400, {MakeRouteTlv(2, 3), MakeChildTableTlv(2)});
+    version = topology.GetVersion();
+
+    topology.Update(0x0400, {MakeChildTableTlv(1)});
+    topology.GetChanges(version, mNodes, mLinks);
+    LONGS_EQUAL(1, mLinks.size());
+    LONGS_EQUAL(0x0402, mLinks[0]->mTo);
+    CHECK_TRUE(mLinks[0]->mRemoved);
+
+    version = topology.GetVersion();
+    topology.Remove(0x0400);
+    topology.GetChanges(version, mNodes, mLinks);
+    LONGS_EQUAL(1, mNodes.size());
+    CHECK_TRUE(mNodes[0]->mRemoved);
+    LONGS_EQUAL(2, mLinks.size());
+
+    // Tombstones are not part of the whole topology.
+    topology.GetChanges(0, mNodes, mLinks);
+    LONGS_EQUAL(0, mNodes.size());
+    LONGS_EQUAL(0, mLinks.size());
+}
+
+TEST(Topology, DropTombstones)
+{
+    Topology topology(1);
+    uint64_t version;
+
+    topology.Update(0x0400, {MakeChildTableTlv(2)});
+    version = topology.GetVersion();
+
+    topology.Update(0x0400, {MakeChildTableTlv(0)});
+
+    // The first removal was dropped, a client which missed it needs the whole topology.
+    CHECK_FALSE(topology.HasChangesSince(version));
+    CHECK_TRUE(topology.HasChangesSince(topology.GetVersion()));
+    topology.GetChanges(version, mNodes, mLinks);
+    LONGS_EQUAL(1, mNodes.size());
+    LONGS_EQUAL(0, mLinks.size());
+}
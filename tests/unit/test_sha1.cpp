@@ -0,0 +1,90 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <string.h>
+
+#include "utils/hex.hpp"
+#include "utils/sha1.hpp"
+
+using otbr::Sha1;
+
+static std::string HashHex(const char *aInput)
+{
+    Sha1    sha1;
+    uint8_t hash[Sha1::kHashSize];
+    char    hex[sizeof(hash) * 2 + 1];
+
+    sha1.Update(reinterpret_cast<const uint8_t *>(aInput), strlen(aInput));
+    sha1.Finish(hash);
+    otbr::Utils::Bytes2Hex(hash, sizeof(hash), hex);
+
+    return hex;
+}
+
+TEST_GROUP(Sha1){};
+
+TEST(Sha1, TestVectors)
+{
+    // The test vectors of FIPS 180-2, the last one ends within the padding of its block.
+    STRCMP_EQUAL("DA39A3EE5E6B4B0D3255BFEF95601890AFD80709", HashHex("").c_str());
+    STRCMP_EQUAL("A9993E364706816ABA3E25717850C26C9CD0D89D", HashHex("abc").c_str());
+    STRCMP_EQUAL("84983E441C3BD26EBAAE4AA1F95129E5E54670F1",
+                 HashHex("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq").c_str());
+}
+
+TEST(Sha1, TestSplitUpdates)
+{
+    uint8_t buffer[200];
+    uint8_t expected[Sha1::kHashSize];
+
+    for (size_t i = 0; i < sizeof(buffer); i++)
+    {
+        buffer[i] = static_cast<uint8_t>(i * 151 + 7);
+    }
+
+    {
+        Sha1 sha1;
+
+        sha1.Update(buffer, sizeof(buffer));
+        sha1.Finish(expected);
+    }
+
+    for (size_t split = 0; split <= sizeof(buffer); split++)
+    {
+        Sha1    sha1;
+        uint8_t hash[Sha1::kHashSize];
+
+        sha1.Update(buffer, split);
+        sha1.Update(buffer + split, sizeof(buffer) - split);
+        sha1.Finish(hash);
+
+        MEMCMP_EQUAL(expected, hash, sizeof(hash));
+    }
+}
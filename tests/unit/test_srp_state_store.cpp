@@ -0,0 +1,168 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "agent/srp_state_store.cpp"
+
+using otbr::SrpStateStore;
+
+static const uint8_t kAddress[16] = {0xfd, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1};
+
+static SrpStateStore::Host MakeHost(uint64_t aExpireTime)
+{
+    SrpStateStore::Host    host;
+    SrpStateStore::Service service;
+
+    host.mAddress    = otbr::Ip6Address(kAddress);
+    host.mExpireTime = aExpireTime;
+
+    service.mName    = "printer";
+    service.mType    = "_ipp._tcp";
+    service.mPort    = 631;
+    service.mTxtData = {4, 'a', '=', '1', '2'};
+    host.mServices.push_back(service);
+
+    return host;
+}
+
+TEST_GROUP(SrpStateStore)
+{
+    char mPath[32];
+
+    void setup()
+    {
+        int fd;
+
+        strcpy(mPath, "/tmp/srp-state-XXXXXX");
+        fd = mkstemp(mPath);
+        close(fd);
+    }
+
+    void teardown()
+    {
+        unlink(mPath);
+        unlink((std::string(mPath) + ".tmp").c_str());
+    }
+};
+
+TEST(SrpStateStore, TestSaveAndLoad)
+{
+    SrpStateStore store;
+
+    CHECK(store.Open(mPath, 100) == OTBR_ERROR_NONE);
+    CHECK(store.GetHosts().empty());
+
+    CHECK(store.SaveHost("host1", MakeHost(1000)) == OTBR_ERROR_NONE);
+    CHECK(store.SaveHost("host2", MakeHost(200)) == OTBR_ERROR_NONE);
+    CHECK(store.SaveHost("host3", MakeHost(1000)) == OTBR_ERROR_NONE);
+    CHECK(store.RemoveHost("host3") == OTBR_ERROR_NONE);
+    store.Close();
+
+    // The expired host2 and the removed host3 are not loaded.
+    CHECK(store.Open(mPath, 500) == OTBR_ERROR_NONE);
+    CHECK(store.GetHosts().size() == 1);
+
+    const SrpStateStore::Host &host = store.GetHosts().at("host1");
+
+    CHECK(host.mAddress == otbr::Ip6Address(kAddress));
+    CHECK(host.mExpireTime == 1000);
+    CHECK(host.mServices.size() == 1);
+    CHECK(host.mServices[0].mName == "printer");
+    CHECK(host.mServices[0].mType == "_ipp._tcp");
+    CHECK(host.mServices[0].mPort == 631);
+    CHECK(host.mServices[0].mTxtData == MakeHost(0).mServices[0].mTxtData);
+}
+
+TEST(SrpStateStore, TestLatestRecordWins)
+{
+    SrpStateStore       store;
+    SrpStateStore::Host host = MakeHost(1000);
+
+    CHECK(store.Open(mPath, 100) == OTBR_ERROR_NONE);
+    CHECK(store.SaveHost("host1", host) == OTBR_ERROR_NONE);
+    host.mServices[0].mPort = 8080;
+    host.mExpireTime        = 2000;
+    CHECK(store.SaveHost("host1", host) == OTBR_ERROR_NONE);
+    store.Close();
+
+    CHECK(store.Open(mPath, 1500) == OTBR_ERROR_NONE);
+    CHECK(store.GetHosts().size() == 1);
+    CHECK(store.GetHosts().at("host1").mServices[0].mPort == 8080);
+}
+
+TEST(SrpStateStore, TestCompaction)
+{
+    SrpStateStore store;
+    struct stat   status;
+
+    CHECK(store.Open(mPath, 100) == OTBR_ERROR_NONE);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        CHECK(store.SaveHost("host1", MakeHost(1000 + i)) == OTBR_ERROR_NONE);
+    }
+
+    // The renewals of a single host are compacted instead of growing the file.
+    CHECK(stat(mPath, &status) == 0);
+    CHECK(status.st_size < 64 * 64);
+
+    store.Close();
+    CHECK(store.Open(mPath, 100) == OTBR_ERROR_NONE);
+    CHECK(store.GetHosts().at("host1").mExpireTime == 1999);
+}
+
+TEST(SrpStateStore, TestTruncatedRecord)
+{
+    SrpStateStore store;
+    struct stat   status;
+
+    CHECK(store.Open(mPath, 100) == OTBR_ERROR_NONE);
+    CHECK(store.SaveHost("host1", MakeHost(1000)) == OTBR_ERROR_NONE);
+    CHECK(store.SaveHost("host2", MakeHost(1000)) == OTBR_ERROR_NONE);
+    store.Close();
+
+    // Cut the last record short, as a crash in the middle of a write would.
+    CHECK(stat(mPath, &status) == 0);
+    CHECK(truncate(mPath, status.st_size - 3) == 0);
+
+    CHECK(store.Open(mPath, 100) == OTBR_ERROR_NONE);
+    CHECK(store.GetHosts().size() == 1);
+    CHECK(store.GetHosts().count("host1") == 1);
+
+    // The store remains writable after dropping the truncated record.
+    CHECK(store.SaveHost("host2", MakeHost(1000)) == OTBR_ERROR_NONE);
+    store.Close();
+    CHECK(store.Open(mPath, 100) == OTBR_ERROR_NONE);
+    CHECK(store.GetHosts().size() == 2);
+}
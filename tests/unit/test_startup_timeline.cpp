@@ -0,0 +1,78 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/startup_timeline.hpp"
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::StartupTimeline;
+
+TEST_GROUP(StartupTimeline)
+{
+    void setup() { StartupTimeline::Get().Start(); }
+};
+
+TEST(StartupTimeline, TestPhases)
+{
+    StartupTimeline::Clock::time_point start = StartupTimeline::Clock::now();
+
+    {
+        StartupTimeline::Phase phase("first");
+    }
+
+    StartupTimeline::Get().Record("second", start + std::chrono::milliseconds(20),
+                                  start + std::chrono::milliseconds(50));
+
+    std::vector<StartupTimeline::PhaseRecord> phases = StartupTimeline::Get().GetPhases();
+
+    CHECK(phases.size() == 2);
+    STRCMP_EQUAL("first", phases[0].mName);
+    STRCMP_EQUAL("second", phases[1].mName);
+    CHECK(phases[1].mStartMs >= 20);
+    CHECK(phases[1].mDurationMs == 30);
+
+    StartupTimeline::Get().Report();
+
+    StartupTimeline::Get().Start();
+    CHECK(StartupTimeline::Get().GetPhases().empty());
+}
+
+TEST(StartupTimeline, TestFirstAttach)
+{
+    int64_t timeToAttach;
+
+    CHECK(StartupTimeline::Get().GetTimeToAttachMs() == -1);
+
+    StartupTimeline::Get().MarkAttached();
+    timeToAttach = StartupTimeline::Get().GetTimeToAttachMs();
+    CHECK(timeToAttach >= 0);
+
+    // Only the first attach is recorded.
+    StartupTimeline::Get().MarkAttached();
+    CHECK(StartupTimeline::Get().GetTimeToAttachMs() == timeToAttach);
+}
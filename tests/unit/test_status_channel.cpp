@@ -0,0 +1,60 @@
+/*
+ *  Copyright (c) 2020, The OpenThread Authors.
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ *  3. Neither the name of the copyright holder nor the
+ *     names of its contributors may be used to endorse or promote products
+ *     derived from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "web/web-service/status_channel.hpp"
+
+using otbr::Web::StatusChannel;
+
+TEST_GROUP(StatusChannel){};
+
+TEST(StatusChannel, TestComputeAccept)
+{
+    // The example of RFC 6455 section 1.3.
+    STRCMP_EQUAL("s3pPLMBiTxaQ9kYGzzhZRbK+xOo=", StatusChannel::ComputeAccept("dGhlIHNhbXBsZSBub25jZQ==").c_str());
+}
+
+TEST(StatusChannel, TestMakeFrame)
+{
+    std::string frame;
+
+    frame = StatusChannel::MakeFrame(StatusChannel::kOpcodeText, "Hello");
+    CHECK(frame == std::string("\x81\x05Hello"));
+
+    frame = StatusChannel::MakeFrame(StatusChannel::kOpcodePong, "");
+    CHECK(frame == std::string("\x8a\x00", 2));
+
+    frame = StatusChannel::MakeFrame(StatusChannel::kOpcodeText, std::string(126, 'a'));
+    CHECK(frame.compare(0, 4, std::string("\x81\x7e\x00\x7e", 4)) == 0);
+    CHECK(frame.size() == 4 + 126);
+
+    frame = StatusChannel::MakeFrame(StatusChannel::kOpcodeText, std::string(0x10000, 'a'));
+    CHECK(frame.compare(0, 10, std::string("\x81\x7f\x00\x00\x00\x00\x00\x01\x00\x00", 10)) == 0);
+    CHECK(frame.size() == 10 + 0x10000);
+}
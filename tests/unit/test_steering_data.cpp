@@ -0,0 +1,80 @@
+/*
+ *    Copyright (c) 2021, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "utils/steering_data.hpp"
+
+using otbr::SteeringData;
+
+TEST_GROUP(SteeringData){};
+
+TEST(SteeringData, TestComputeJoinerIdsMatchesSingle)
+{
+    // Not a multiple of the lanes, so the last group is partial.
+    const size_t kCount = SteeringData::kHashLanes * 3 + 5;
+    uint8_t      eui64s[kCount * SteeringData::kSizeEui64];
+    uint8_t      joinerIds[kCount * SteeringData::kSizeJoinerId];
+
+    for (size_t i = 0; i < sizeof(eui64s); i++)
+    {
+        eui64s[i] = static_cast<uint8_t>(i * 37 + 11);
+    }
+
+    SteeringData::ComputeJoinerIds(eui64s, kCount, joinerIds);
+
+    for (size_t i = 0; i < kCount; i++)
+    {
+        uint8_t expected[SteeringData::kSizeJoinerId];
+
+        SteeringData::ComputeJoinerId(eui64s + i * SteeringData::kSizeEui64, expected);
+        MEMCMP_EQUAL(expected, joinerIds + i * SteeringData::kSizeJoinerId, sizeof(expected));
+    }
+
+    // In place.
+    SteeringData::ComputeJoinerIds(eui64s, kCount, eui64s);
+    MEMCMP_EQUAL(joinerIds, eui64s, sizeof(joinerIds));
+}
+
+TEST(SteeringData, TestComputeBloomFilterBatch)
+{
+    uint8_t      joinerIds[] = {
+        0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0xb4, 0x30, 0x00, 0x00, 0x00, 0x00, 0x02,
+    };
+    SteeringData single;
+    SteeringData batch;
+
+    single.Init(16);
+    single.ComputeBloomFilter(joinerIds);
+    single.ComputeBloomFilter(joinerIds + SteeringData::kSizeJoinerId);
+
+    batch.Init(16);
+    batch.ComputeBloomFilter(joinerIds, 2);
+
+    MEMCMP_EQUAL(single.GetBloomFilter(), batch.GetBloomFilter(), 16);
+}
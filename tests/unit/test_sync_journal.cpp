@@ -0,0 +1,234 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+// The SRP host records come from "agent/srp_state_store.cpp", which test_srp_state_store.cpp builds in.
+#include "agent/sync_journal.cpp"
+
+using otbr::SrpStateStore;
+using otbr::SyncJournal;
+
+static const uint8_t kAddress[16] = {0xfd, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2};
+
+static SrpStateStore::Host MakeSyncedHost(uint16_t aPort)
+{
+    SrpStateStore::Host    host;
+    SrpStateStore::Service service;
+
+    host.mAddress    = otbr::Ip6Address(kAddress);
+    host.mExpireTime = 1000;
+
+    service.mName = "printer";
+    service.mType = "_ipp._tcp";
+    service.mPort = aPort;
+    host.mServices.push_back(service);
+
+    return host;
+}
+
+static otbr::Ip6Address MakeDua(uint8_t aLastByte)
+{
+    uint8_t address[16] = {0xfd, 0xde, 0xad, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, aLastByte};
+
+    return otbr::Ip6Address(address);
+}
+
+// Applies all frames in @p aFrames to @p aStandby and returns the first error.
+static otbrError ApplyFrames(SyncJournal &aStandby, const std::vector<uint8_t> &aFrames)
+{
+    otbrError          error = OTBR_ERROR_NONE;
+    const uint8_t *    cur   = aFrames.data();
+    SyncJournal::Frame frame;
+
+    while (error == OTBR_ERROR_NONE &&
+           SyncJournal::DecodeFrame(cur, aFrames.data() + aFrames.size(), frame) == OTBR_ERROR_NONE)
+    {
+        error = aStandby.Apply(frame);
+    }
+
+    return error;
+}
+
+// Sends what @p aStandby is missing of @p aActive the way a reconnecting standby asks for it.
+static otbrError Sync(const SyncJournal &aActive, SyncJournal &aStandby)
+{
+    std::vector<uint8_t> hello;
+    std::vector<uint8_t> frames;
+    const uint8_t *      cur = nullptr;
+    SyncJournal::Frame   frame;
+    uint64_t             epoch;
+    uint64_t             sequence;
+
+    aStandby.AppendHello(hello);
+    cur = hello.data();
+    CHECK(SyncJournal::DecodeFrame(cur, hello.data() + hello.size(), frame) == OTBR_ERROR_NONE);
+    CHECK(SyncJournal::DecodeHello(frame, epoch, sequence) == OTBR_ERROR_NONE);
+
+    aActive.AppendFramesSince(epoch, sequence, frames);
+
+    return ApplyFrames(aStandby, frames);
+}
+
+static void CheckSameState(const SyncJournal &aActive, const SyncJournal &aStandby)
+{
+    CHECK(aStandby.GetEpoch() == aActive.GetEpoch());
+    CHECK(aStandby.GetSequence() == aActive.GetSequence());
+    CHECK(aStandby.GetState().mDataset == aActive.GetState().mDataset);
+    CHECK(aStandby.GetState().mDuas == aActive.GetState().mDuas);
+    CHECK(aStandby.GetState().mHosts.size() == aActive.GetState().mHosts.size());
+
+    for (const auto &host : aActive.GetState().mHosts)
+    {
+        const SrpStateStore::Host &synced = aStandby.GetState().mHosts.at(host.first);
+
+        CHECK(synced.mAddress == host.second.mAddress);
+        CHECK(synced.mServices.size() == host.second.mServices.size());
+        CHECK(synced.mServices[0].mPort == host.second.mServices[0].mPort);
+    }
+}
+
+TEST_GROUP(SyncJournal){};
+
+TEST(SyncJournal, TestSnapshotThenDeltas)
+{
+    SyncJournal          active(0x1234);
+    SyncJournal          standby;
+    SrpStateStore::Host  host = MakeSyncedHost(631);
+    std::vector<uint8_t> frames;
+
+    active.SetDataset({0x00, 0x02, 0x00, 0x0b});
+    CHECK(active.SetHost("host1", &host) == OTBR_ERROR_NONE);
+    active.AddDua(MakeDua(1));
+    CHECK(active.GetSequence() == 3);
+
+    // A new standby gets a snapshot.
+    CHECK(Sync(active, standby) == OTBR_ERROR_NONE);
+    CheckSameState(active, standby);
+
+    // Later changes are sent as deltas, unchanged values are not recorded.
+    active.SetDataset({0x00, 0x02, 0x00, 0x0b});
+    active.AddDua(MakeDua(1));
+    CHECK(active.GetSequence() == 3);
+
+    host.mServices[0].mPort = 8080;
+    CHECK(active.SetHost("host1", &host) == OTBR_ERROR_NONE);
+    CHECK(active.SetHost("host2", &host) == OTBR_ERROR_NONE);
+    CHECK(active.SetHost("host2", nullptr) == OTBR_ERROR_NONE);
+    active.AddDua(MakeDua(2));
+    active.RemoveDua(MakeDua(1));
+
+    active.AppendFramesSince(standby.GetEpoch(), standby.GetSequence(), frames);
+    CHECK(frames[0] != SyncJournal::kFrameReset);
+    CHECK(ApplyFrames(standby, frames) == OTBR_ERROR_NONE);
+    CheckSameState(active, standby);
+    CHECK(standby.GetState().mHosts.count("host2") == 0);
+
+    // A heartbeat confirms the standby is up to date.
+    frames.clear();
+    active.AppendHeartbeat(frames);
+    CHECK(ApplyFrames(standby, frames) == OTBR_ERROR_NONE);
+}
+
+TEST(SyncJournal, TestGapIsDetected)
+{
+    SyncJournal          active(0x1234);
+    SyncJournal          standby;
+    std::vector<uint8_t> frames;
+    uint64_t             sequence;
+
+    active.AddDua(MakeDua(1));
+    CHECK(Sync(active, standby) == OTBR_ERROR_NONE);
+
+    active.AddDua(MakeDua(2));
+    sequence = active.GetSequence();
+    active.AddDua(MakeDua(3));
+
+    // The standby missed a change.
+    active.AppendFramesSince(active.GetEpoch(), sequence, frames);
+    CHECK(ApplyFrames(standby, frames) == OTBR_ERROR_INVALID_ARGS);
+
+    // A heartbeat reveals lost changes at the tail.
+    frames.clear();
+    active.AppendHeartbeat(frames);
+    CHECK(ApplyFrames(standby, frames) == OTBR_ERROR_INVALID_ARGS);
+
+    // Resynchronizing replays the missed changes.
+    CHECK(Sync(active, standby) == OTBR_ERROR_NONE);
+    CheckSameState(active, standby);
+}
+
+TEST(SyncJournal, TestResetAfterRestartOrEviction)
+{
+    SyncJournal active(0x1234);
+    SyncJournal restarted(0x5678);
+    SyncJournal standby;
+
+    active.AddDua(MakeDua(1));
+    CHECK(Sync(active, standby) == OTBR_ERROR_NONE);
+
+    // A standby of an earlier run of the active agent starts over from a snapshot.
+    restarted.AddDua(MakeDua(9));
+    CHECK(Sync(restarted, standby) == OTBR_ERROR_NONE);
+    CheckSameState(restarted, standby);
+    CHECK(standby.GetState().mDuas.count(MakeDua(1)) == 0);
+
+    // A standby further behind than the kept changes gets a snapshot too.
+    for (int i = 0; i < 3000; ++i)
+    {
+        active.AddDua(MakeDua(2));
+        active.RemoveDua(MakeDua(2));
+    }
+    CHECK(Sync(active, standby) == OTBR_ERROR_NONE);
+    CheckSameState(active, standby);
+}
+
+TEST(SyncJournal, TestDecodeFrame)
+{
+    SyncJournal          active(0x1234);
+    std::vector<uint8_t> frames;
+    const uint8_t *      cur;
+    SyncJournal::Frame   frame;
+
+    active.SetDataset({0x00, 0x02, 0x00, 0x0b});
+    active.AppendFramesSince(0, 0, frames);
+
+    // The reset frame is complete, the partially received dataset frame is left for more data.
+    cur = frames.data();
+    CHECK(SyncJournal::DecodeFrame(cur, frames.data() + frames.size() - 1, frame) == OTBR_ERROR_NONE);
+    CHECK(frame.mType == SyncJournal::kFrameReset);
+    CHECK(SyncJournal::DecodeFrame(cur, frames.data() + frames.size() - 1, frame) == OTBR_ERROR_NOT_FOUND);
+    CHECK(SyncJournal::DecodeFrame(cur, frames.data() + frames.size(), frame) == OTBR_ERROR_NONE);
+    CHECK(frame.mType == SyncJournal::kFrameDataset);
+    CHECK(cur == frames.data() + frames.size());
+
+    // An oversized payload length is rejected.
+    frames = {SyncJournal::kFrameDataset, 0, 0, 0, 0, 0, 0, 0, 1, 0xff, 0xff, 0xff, 0xff};
+    cur    = frames.data();
+    CHECK(SyncJournal::DecodeFrame(cur, frames.data() + frames.size(), frame) == OTBR_ERROR_PARSE);
+}
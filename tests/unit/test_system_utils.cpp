@@ -0,0 +1,132 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "utils/system_utils.hpp"
+
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/mainloop_poller.hpp"
+
+using otbr::MainloopPoller;
+using otbr::SystemUtils::CommandRunner;
+
+// Runs the mainloop until all the commands have exited.
+static void RunUntilIdle(void)
+{
+    for (int i = 0; i < 100 && CommandRunner::Get().GetPendingCount() > 0; i++)
+    {
+        otSysMainloopContext mainloop;
+
+        FD_ZERO(&mainloop.mReadFdSet);
+        FD_ZERO(&mainloop.mWriteFdSet);
+        FD_ZERO(&mainloop.mErrorFdSet);
+        mainloop.mMaxFd   = -1;
+        mainloop.mTimeout = {1, 0};
+
+        CommandRunner::Get().UpdateFdSet(mainloop);
+        CHECK(MainloopPoller::Get().Poll(mainloop) >= 0);
+        CommandRunner::Get().Process(mainloop);
+    }
+}
+
+TEST_GROUP(CommandRunner){};
+
+TEST(CommandRunner, TestExecute)
+{
+    int exitCode = -1;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, CommandRunner::Get().Execute("exit 3", [&exitCode](int aExitCode) {
+        exitCode = aExitCode;
+    }));
+    CHECK_EQUAL(1, CommandRunner::Get().GetPendingCount());
+
+    RunUntilIdle();
+    CHECK_EQUAL(0, CommandRunner::Get().GetPendingCount());
+    CHECK_EQUAL(3, exitCode);
+}
+
+TEST(CommandRunner, TestSpawn)
+{
+    int exitCodes[2] = {-1, -1};
+
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, CommandRunner::Get().Spawn({}, nullptr));
+    CHECK_EQUAL(OTBR_ERROR_NONE,
+                CommandRunner::Get().Spawn({"true"}, [&exitCodes](int aExitCode) { exitCodes[0] = aExitCode; }));
+    CHECK_EQUAL(OTBR_ERROR_NONE,
+                CommandRunner::Get().Spawn({"sh", "-c", "kill -9 $$"},
+                                           [&exitCodes](int aExitCode) { exitCodes[1] = aExitCode; }));
+    CHECK(CommandRunner::Get().Spawn({"/nonexistent/program"}, nullptr) != OTBR_ERROR_NONE);
+
+    RunUntilIdle();
+    CHECK_EQUAL(0, exitCodes[0]);
+    CHECK_EQUAL(128 + 9, exitCodes[1]);
+}
+
+TEST(CommandRunner, TestExecuteBatch)
+{
+    char                     path[]   = "/tmp/otbr-test-command-runner-XXXXXX";
+    int                      exitCode = -1;
+    int                      fd       = mkstemp(path);
+    char                     data[8]  = {};
+    std::string              file(path);
+    std::vector<std::string> commands;
+
+    CHECK(fd >= 0);
+
+    CHECK_EQUAL(OTBR_ERROR_INVALID_ARGS, CommandRunner::Get().ExecuteBatch({}, nullptr));
+
+    // The batch stops at the first command which fails, a list in a command does not change that.
+    commands = {"printf a >" + file, "false || printf b >>" + file, "exit 5", "printf c >>" + file};
+    CHECK_EQUAL(OTBR_ERROR_NONE, CommandRunner::Get().ExecuteBatch(
+                                     commands, [&exitCode](int aExitCode) { exitCode = aExitCode; }));
+
+    RunUntilIdle();
+    CHECK_EQUAL(5, exitCode);
+    CHECK_EQUAL(2, read(fd, data, sizeof(data)));
+    STRCMP_EQUAL("ab", data);
+
+    close(fd);
+    unlink(path);
+}
+
+TEST(CommandRunner, TestHandlerRunsCommand)
+{
+    int exitCode = -1;
+
+    CHECK_EQUAL(OTBR_ERROR_NONE, CommandRunner::Get().Execute("true", [&exitCode](int) {
+        CHECK_EQUAL(OTBR_ERROR_NONE, CommandRunner::Get().Execute("exit 1", [&exitCode](int aExitCode) {
+            exitCode = aExitCode;
+        }));
+    }));
+
+    RunUntilIdle();
+    CHECK_EQUAL(1, exitCode);
+}
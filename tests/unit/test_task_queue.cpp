@@ -0,0 +1,122 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/task_queue.hpp"
+
+#include <thread>
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/mainloop_poller.hpp"
+
+using otbr::MainloopPoller;
+using otbr::TaskQueue;
+
+static const int kNumProducers        = 4;
+static const int kNumTasksPerProducer = 1000;
+
+static void PollOnce(TaskQueue &aQueue)
+{
+    otSysMainloopContext mainloop;
+
+    FD_ZERO(&mainloop.mReadFdSet);
+    FD_ZERO(&mainloop.mWriteFdSet);
+    FD_ZERO(&mainloop.mErrorFdSet);
+    mainloop.mMaxFd   = -1;
+    mainloop.mTimeout = {0, 100000};
+
+    CHECK(MainloopPoller::Get().Poll(mainloop) >= 0);
+    aQueue.Process();
+}
+
+TEST_GROUP(TaskQueue){};
+
+TEST(TaskQueue, TestPostAndProcess)
+{
+    TaskQueue        queue;
+    std::vector<int> results;
+
+    CHECK(queue.Init() == OTBR_ERROR_NONE);
+
+    // Nothing is run before a poll reports the queue readable.
+    queue.Post([&results]() { results.push_back(1); });
+    queue.Post([&results]() { results.push_back(2); });
+    CHECK(results.empty());
+
+    PollOnce(queue);
+    CHECK(results == std::vector<int>({1, 2}));
+
+    // A task posted by a task runs in the next iteration.
+    queue.Post([&queue, &results]() {
+        queue.Post([&results]() { results.push_back(4); });
+        results.push_back(3);
+    });
+    PollOnce(queue);
+    CHECK(results == std::vector<int>({1, 2, 3}));
+    PollOnce(queue);
+    CHECK(results == std::vector<int>({1, 2, 3, 4}));
+}
+
+TEST(TaskQueue, TestMultipleProducers)
+{
+    TaskQueue                queue;
+    std::vector<std::thread> producers;
+    std::vector<int>         lastValues(kNumProducers, -1);
+    int                      count   = 0;
+    bool                     ordered = true;
+
+    CHECK(queue.Init() == OTBR_ERROR_NONE);
+
+    for (int i = 0; i < kNumProducers; i++)
+    {
+        producers.emplace_back([&, i]() {
+            for (int j = 0; j < kNumTasksPerProducer; j++)
+            {
+                queue.Post([&, i, j]() {
+                    ordered       = ordered && (lastValues[i] == j - 1);
+                    lastValues[i] = j;
+                    count++;
+                });
+            }
+        });
+    }
+
+    while (count < kNumProducers * kNumTasksPerProducer)
+    {
+        PollOnce(queue);
+    }
+
+    for (std::thread &producer : producers)
+    {
+        producer.join();
+    }
+
+    CHECK(ordered);
+    CHECK(count == kNumProducers * kNumTasksPerProducer);
+}
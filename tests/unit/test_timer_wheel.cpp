@@ -0,0 +1,251 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/timer_wheel.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::TimerWheel;
+using std::chrono::hours;
+using std::chrono::milliseconds;
+
+TEST_GROUP(TimerWheel)
+{
+    TimerWheel::Clock::time_point mStart;
+
+    void setup() { mStart = TimerWheel::Clock::now(); }
+};
+
+TEST(TimerWheel, TestFireNotEarly)
+{
+    TimerWheel wheel(mStart);
+    int        fired = 0;
+
+    wheel.Add(mStart + milliseconds(25), [&fired]() { fired++; });
+    CHECK(wheel.GetNextFireTime() >= mStart + milliseconds(25));
+
+    wheel.Process(mStart + milliseconds(24));
+    CHECK(fired == 0);
+
+    wheel.Process(wheel.GetNextFireTime());
+    CHECK(fired == 1);
+    CHECK(wheel.GetSize() == 0);
+    CHECK(wheel.GetNextFireTime() == TimerWheel::Clock::time_point::max());
+}
+
+TEST(TimerWheel, TestCoalesce)
+{
+    TimerWheel       wheel(mStart);
+    std::vector<int> fired;
+
+    wheel.Add(mStart + milliseconds(21), [&fired]() { fired.push_back(1); });
+    wheel.Add(mStart + milliseconds(30), [&fired]() { fired.push_back(2); });
+    wheel.Add(mStart + milliseconds(25), [&fired]() { fired.push_back(3); });
+
+    CHECK(wheel.GetNextFireTime() == mStart + milliseconds(30));
+
+    wheel.Process(mStart + milliseconds(30));
+    CHECK(fired.size() == 3);
+}
+
+TEST(TimerWheel, TestCancel)
+{
+    TimerWheel          wheel(mStart);
+    int                 fired = 0;
+    TimerWheel::TimerId id1   = wheel.Add(mStart + milliseconds(10), [&fired]() { fired++; });
+    TimerWheel::TimerId id2   = wheel.Add(mStart + milliseconds(20), [&fired]() { fired++; });
+
+    CHECK(id1 != TimerWheel::kInvalidTimerId);
+    CHECK(id1 != id2);
+
+    CHECK(wheel.Cancel(id1));
+    CHECK(!wheel.Cancel(id1));
+    CHECK(wheel.GetSize() == 1);
+
+    // A task cancels a timer due in the same tick.
+    wheel.Add(mStart + milliseconds(20), [&wheel, &id2]() { wheel.Cancel(id2); });
+    wheel.Process(mStart + milliseconds(20));
+    CHECK(fired == 0);
+    CHECK(wheel.GetSize() == 0);
+
+    // The id of a fired timer is not reused.
+    CHECK(wheel.Add(mStart + milliseconds(30), []() {}) != id1);
+    CHECK(!wheel.Cancel(id2));
+}
+
+TEST(TimerWheel, TestHandle)
+{
+    TimerWheel         wheel(mStart);
+    int                fired = 0;
+    TimerWheel::Handle none;
+    TimerWheel::Handle handle(wheel, wheel.Add(mStart + milliseconds(50), [&fired]() { fired++; }));
+
+    CHECK(!none.IsPending());
+    CHECK(!none.Reschedule(mStart));
+    none.Cancel();
+
+    CHECK(handle.IsPending());
+    CHECK(handle.GetFireTime() == mStart + milliseconds(50));
+
+    // Move the timer earlier and then later again.
+    CHECK(handle.Reschedule(mStart + milliseconds(20)));
+    CHECK(wheel.GetNextFireTime() == mStart + milliseconds(20));
+    CHECK(handle.Reschedule(mStart + hours(1)));
+    wheel.Process(mStart + milliseconds(50));
+    CHECK(fired == 0);
+    CHECK(handle.GetFireTime() == mStart + hours(1));
+
+    wheel.Process(mStart + hours(1));
+    CHECK(fired == 1);
+    CHECK(!handle.IsPending());
+    CHECK(!handle.Reschedule(mStart + hours(2)));
+    CHECK(handle.GetFireTime() == TimerWheel::Clock::time_point::max());
+
+    handle = TimerWheel::Handle(wheel, wheel.Add(mStart + hours(2), [&fired]() { fired++; }));
+    handle.Cancel();
+    CHECK(!handle.IsPending());
+    CHECK(wheel.GetSize() == 0);
+}
+
+namespace {
+struct MoveOnlyTask
+{
+    std::unique_ptr<int> mValue;
+    std::shared_ptr<int> mCounter;
+
+    void operator()(void) { *mCounter += *mValue; }
+};
+} // namespace
+
+TEST(TimerWheel, TestTask)
+{
+    TimerWheel           wheel(mStart);
+    std::shared_ptr<int> counter(new int(0));
+    TimerWheel::Task     task;
+
+    CHECK(!task);
+
+    task = [counter]() { *counter += 1; };
+    CHECK(task);
+    CHECK(counter.use_count() == 2);
+
+    TimerWheel::Task moved(std::move(task));
+
+    CHECK(!task);
+    CHECK(moved);
+    moved = nullptr;
+    CHECK(!moved);
+    CHECK(counter.use_count() == 1);
+
+    // Move-only callables are supported.
+    wheel.Add(mStart, MoveOnlyTask{std::unique_ptr<int>(new int(5)), counter});
+    CHECK(counter.use_count() == 2);
+
+    wheel.Process(mStart + TimerWheel::kTick);
+    CHECK(*counter == 5);
+
+    // The task is destroyed once it ran.
+    CHECK(counter.use_count() == 1);
+}
+
+TEST(TimerWheel, TestPastDue)
+{
+    TimerWheel wheel(mStart);
+    int        fired = 0;
+
+    wheel.Process(mStart + milliseconds(100));
+
+    wheel.Add(mStart, [&]() {
+        fired++;
+        wheel.Add(mStart, [&fired]() { fired++; });
+    });
+
+    CHECK(wheel.GetNextFireTime() <= mStart + milliseconds(110));
+
+    wheel.Process(mStart + milliseconds(110));
+    CHECK(fired == 1);
+
+    wheel.Process(mStart + milliseconds(120));
+    CHECK(fired == 2);
+}
+
+TEST(TimerWheel, TestAllLevels)
+{
+    TimerWheel                                 wheel(mStart);
+    std::mt19937                               random(1);
+    std::vector<TimerWheel::Clock::time_point> dueTimes;
+    std::vector<TimerWheel::Clock::time_point> fireTimes;
+    TimerWheel::Clock::time_point              now = mStart;
+    int                                        lastFired = -1;
+    bool                                       ordered   = true;
+
+    // Delays up to 100 hours reach all levels and the overflow list.
+    for (int i = 0; i < 500; i++)
+    {
+        int64_t maxDelayMs = int64_t{1} << (random() % 29);
+
+        dueTimes.push_back(mStart + TimerWheel::kTick + milliseconds(random() % maxDelayMs));
+    }
+
+    std::sort(dueTimes.begin(), dueTimes.end());
+    fireTimes.resize(dueTimes.size());
+
+    for (size_t i = 0; i < dueTimes.size(); i++)
+    {
+        wheel.Add(dueTimes[i], [&, i]() {
+            // Timers in different ticks fire in order.
+            ordered      = ordered && (lastFired < 0 || dueTimes[lastFired] <= dueTimes[i] + TimerWheel::kTick);
+            lastFired    = static_cast<int>(i);
+            fireTimes[i] = now;
+        });
+    }
+
+    while (wheel.GetSize() > 0)
+    {
+        TimerWheel::Clock::time_point next = wheel.GetNextFireTime();
+
+        CHECK(next >= now);
+        now = next;
+        wheel.Process(now);
+    }
+
+    CHECK(ordered);
+
+    for (size_t i = 0; i < dueTimes.size(); i++)
+    {
+        CHECK(fireTimes[i] >= dueTimes[i]);
+        CHECK(fireTimes[i] < dueTimes[i] + TimerWheel::kTick);
+    }
+
+    CHECK(now < mStart + hours(100));
+}
@@ -0,0 +1,93 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <CppUTest/TestHarness.h>
+
+#include "common/tlv.hpp"
+
+using otbr::Tlv;
+using otbr::TlvView;
+
+TEST_GROUP(Tlv){};
+
+TEST(Tlv, TestIterate)
+{
+    uint8_t buffer[300] = {0x00, 0x03, 0x00, 0x00, 0x0f, 0x01, 0x02, 0x01, 0x00, 0x07, 0xff, 0x01, 0x00};
+    TlvView view(buffer, 13 + 0x100);
+    uint8_t types[3];
+    size_t  count = 0;
+
+    for (const Tlv &tlv : view)
+    {
+        CHECK(count < sizeof(types));
+        types[count++] = tlv.GetType();
+    }
+
+    LONGS_EQUAL(3, count);
+    LONGS_EQUAL(0x00, types[0]);
+    LONGS_EQUAL(0x01, types[1]);
+    LONGS_EQUAL(0x07, types[2]);
+    CHECK(view.IsValid());
+
+    LONGS_EQUAL(3, view.Find(0x00)->GetLength());
+    LONGS_EQUAL(0x0100, view.Find(0x07)->GetLength());
+    LONGS_EQUAL(0x0104, view.Find(0x07)->GetSize());
+    POINTERS_EQUAL(&buffer[9], view.Find(0x07));
+    POINTERS_EQUAL(nullptr, view.Find(0x05));
+}
+
+TEST(Tlv, TestBoundsCheck)
+{
+    const uint8_t truncatedValue[]  = {0x00, 0x01, 0x0f, 0x01, 0x02, 0x01};
+    const uint8_t truncatedHeader[] = {0x00, 0x01, 0x0f, 0x07};
+    const uint8_t truncatedLength[] = {0x00, 0x01, 0x0f, 0x07, 0xff, 0x01};
+    size_t        count             = 0;
+
+    for (const Tlv &tlv : TlvView(truncatedValue, sizeof(truncatedValue)))
+    {
+        LONGS_EQUAL(0x00, tlv.GetType());
+        count++;
+    }
+
+    LONGS_EQUAL(1, count);
+    CHECK_FALSE(TlvView(truncatedValue, sizeof(truncatedValue)).IsValid());
+    POINTERS_EQUAL(nullptr, TlvView(truncatedValue, sizeof(truncatedValue)).Find(0x01));
+    CHECK_FALSE(TlvView(truncatedHeader, sizeof(truncatedHeader)).IsValid());
+    CHECK_FALSE(TlvView(truncatedLength, sizeof(truncatedLength)).IsValid());
+    CHECK(TlvView(truncatedValue, 3).IsValid());
+    CHECK(TlvView(truncatedValue, 0).IsValid());
+}
+
+TEST(Tlv, TestTlvTypes)
+{
+    const uint8_t dataset[] = {0x0e, 0x01, 0x01, 0x00, 0x01, 0x0f, 0x35, 0x01, 0x00};
+
+    LONGS_EQUAL(otbr::Meshcop::TlvTypeBit(otbr::Meshcop::kActiveTimestamp) |
+                    otbr::Meshcop::TlvTypeBit(otbr::Meshcop::kChannel),
+                otbr::Meshcop::GetTlvTypes(TlvView(dataset, sizeof(dataset))));
+}
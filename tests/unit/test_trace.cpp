@@ -0,0 +1,142 @@
+/*
+ *    Copyright (c) 2020, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "common/trace.hpp"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <CppUTest/TestHarness.h>
+
+using otbr::Trace;
+
+TEST_GROUP(Trace)
+{
+    void teardown() { Trace::Get().Stop(); }
+
+    // Rings are never released, so every test records on a new thread and looks for its own marker.
+    std::vector<Trace::Sample> Record(uint32_t aMarker, uint32_t aCount)
+    {
+        std::vector<Trace::Sample> samples;
+        std::vector<Trace::Sample> marked;
+        std::string                output;
+
+        std::thread([aMarker, aCount]() {
+            for (uint32_t i = 0; i < aCount; ++i)
+            {
+                Trace::Get().Log(Trace::kEventRestResponse, i, aMarker);
+            }
+        }).join();
+
+        Trace::Get().Write(output);
+        CHECK(Trace::Parse(reinterpret_cast<const uint8_t *>(output.data()), output.size(), samples) ==
+              OTBR_ERROR_NONE);
+
+        for (const Trace::Sample &sample : samples)
+        {
+            if (sample.mEvent == Trace::kEventRestResponse && sample.mArg1 == aMarker)
+            {
+                marked.push_back(sample);
+            }
+        }
+
+        return marked;
+    }
+};
+
+TEST(Trace, TestDisabled)
+{
+    Trace::Get().Stop();
+
+    CHECK(!Trace::Get().IsEnabled());
+    CHECK(Record(0x1001, 10).empty());
+}
+
+TEST(Trace, TestRecord)
+{
+    std::vector<Trace::Sample> samples;
+
+    Trace::Get().Start(64);
+    samples = Record(0x1002, 10);
+
+    CHECK(samples.size() == 10);
+
+    for (uint32_t i = 0; i < samples.size(); ++i)
+    {
+        CHECK(samples[i].mArg0 == i);
+        CHECK(samples[i].mThreadId == samples[0].mThreadId);
+        CHECK(i == 0 || samples[i].mTimestamp >= samples[i - 1].mTimestamp);
+    }
+}
+
+TEST(Trace, TestRingWraps)
+{
+    std::vector<Trace::Sample> samples;
+
+    // Rounded up to the minimum ring size of 16 entries, the oldest of which is not exported.
+    Trace::Get().Start(10);
+    samples = Record(0x1003, 40);
+
+    CHECK(samples.size() == 15);
+
+    for (uint32_t i = 0; i < samples.size(); ++i)
+    {
+        CHECK(samples[i].mArg0 == 25 + i);
+    }
+}
+
+TEST(Trace, TestParseMalformed)
+{
+    std::vector<Trace::Sample> samples;
+    std::string                output;
+
+    Trace::Get().Start(16);
+    Record(0x1004, 1);
+    Trace::Get().Write(output);
+
+    CHECK(Trace::Parse(nullptr, 0, samples) == OTBR_ERROR_PARSE);
+    CHECK(Trace::Parse(reinterpret_cast<const uint8_t *>(output.data()), output.size() - 1, samples) ==
+          OTBR_ERROR_PARSE);
+    CHECK(samples.empty());
+
+    output += '\0';
+    CHECK(Trace::Parse(reinterpret_cast<const uint8_t *>(output.data()), output.size(), samples) == OTBR_ERROR_PARSE);
+
+    output[0] = 'X';
+    output.resize(output.size() - 1);
+    CHECK(Trace::Parse(reinterpret_cast<const uint8_t *>(output.data()), output.size(), samples) == OTBR_ERROR_PARSE);
+}
+
+TEST(Trace, TestEventNames)
+{
+    STRCMP_EQUAL("rest-response", Trace::GetEventName(Trace::kEventRestResponse));
+    STRCMP_EQUAL("duration-us", Trace::GetArgName(Trace::kEventRestResponse, 1));
+    CHECK(Trace::GetEventName(Trace::kNumEvents) == nullptr);
+    CHECK(Trace::GetArgName(Trace::kEventRestResponse, 2) == nullptr);
+}
@@ -36,6 +36,8 @@
 #include <stdlib.h>
 #include <sysexits.h>
 
+#include <vector>
+
 #include "common/code_utils.hpp"
 #include "utils/hex.hpp"
 #include "utils/steering_data.hpp"
@@ -45,44 +47,66 @@ void help(void)
     printf("steering-data - compute steering data\n"
            "SYNTAX:\n"
            "    steering-data [LENGTH] <JOINER_ID> ...\n"
+           "    steering-data [LENGTH] -\n"
+           "With -, the EUI64s are read from the standard input, one per line.\n"
            "EXAMPLE:\n"
            "    steering-data 18b4300000000001\n"
            "    steering-data 15 18b4300000000001\n"
-           "    steering-data 18b4300000000001 18b4300000000002\n");
+           "    steering-data 18b4300000000001 18b4300000000002\n"
+           "    steering-data 16 - < joiners.txt\n");
 }
 
-int ComputeJoinerId(const char *aEui64, uint8_t *aJoinerId)
+int ParseEui64(const char *aEui64, std::vector<uint8_t> &aEui64s)
 {
-    int ret = -1;
+    int     ret = -1;
+    uint8_t eui64[otbr::SteeringData::kSizeEui64];
 
-    VerifyOrExit(strlen(aEui64) == otbr::SteeringData::kSizeJoinerId * 2);
-    VerifyOrExit(otbr::Utils::Hex2Bytes(aEui64, aJoinerId, otbr::SteeringData::kSizeJoinerId) ==
-                 otbr::SteeringData::kSizeJoinerId);
-    otbr::SteeringData::ComputeJoinerId(aJoinerId, aJoinerId);
+    VerifyOrExit(strlen(aEui64) == otbr::SteeringData::kSizeEui64 * 2);
+    VerifyOrExit(otbr::Utils::Hex2Bytes(aEui64, eui64, otbr::SteeringData::kSizeEui64) ==
+                 otbr::SteeringData::kSizeEui64);
+    aEui64s.insert(aEui64s.end(), eui64, eui64 + sizeof(eui64));
     ret = 0;
 
 exit:
-    if (ret != 0)
+    return ret;
+}
+
+int ReadEui64s(FILE *aStream, std::vector<uint8_t> &aEui64s)
+{
+    int  ret = 0;
+    char line[64];
+
+    while (fgets(line, sizeof(line), aStream) != nullptr)
     {
-        fprintf(stderr, "Invalid EUI64: %s", aEui64);
+        line[strcspn(line, "\r\n")] = '\0';
+
+        if (line[0] == '\0')
+        {
+            continue;
+        }
+
+        VerifyOrExit(ParseEui64(line, aEui64s) == 0, ret = -1, fprintf(stderr, "Invalid EUI64 : %s\n", line));
     }
 
+exit:
     return ret;
 }
 
 int main(int argc, char *argv[])
 {
-    otbr::SteeringData computer;
-    int                ret    = EX_USAGE;
-    int                length = 16;
-    int                i      = 1;
+    otbr::SteeringData   computer;
+    std::vector<uint8_t> eui64s;
+    size_t               count;
+    int                  ret    = EX_USAGE;
+    int                  length = 16;
+    int                  i      = 1;
 
     if (argc < 2)
     {
         ExitNow(help());
     }
 
-    if (strlen(argv[i]) != otbr::SteeringData::kSizeJoinerId * 2)
+    if (strlen(argv[i]) != otbr::SteeringData::kSizeEui64 * 2 && strcmp(argv[i], "-") != 0)
     {
         length = atoi(argv[i]);
         VerifyOrExit(length > 0 && length <= otbr::SteeringData::kMaxSizeOfBloomFilter,
@@ -95,12 +119,20 @@ int main(int argc, char *argv[])
 
     for (; i < argc; ++i)
     {
-        uint8_t joinerId[otbr::SteeringData::kSizeJoinerId];
-
-        VerifyOrExit(ComputeJoinerId(argv[i], joinerId) == 0, fprintf(stderr, "Invalid EUI64 : %s\n", argv[i]));
-        computer.ComputeBloomFilter(joinerId);
+        if (strcmp(argv[i], "-") == 0)
+        {
+            VerifyOrExit(ReadEui64s(stdin, eui64s) == 0);
+        }
+        else
+        {
+            VerifyOrExit(ParseEui64(argv[i], eui64s) == 0, fprintf(stderr, "Invalid EUI64 : %s\n", argv[i]));
+        }
     }
 
+    count = eui64s.size() / otbr::SteeringData::kSizeEui64;
+    otbr::SteeringData::ComputeJoinerIds(eui64s.data(), count, eui64s.data());
+    computer.ComputeBloomFilter(eui64s.data(), count);
+
     for (i = 0; i < length; i++)
     {
         printf("%02x", computer.GetBloomFilter()[i]);
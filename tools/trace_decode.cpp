@@ -0,0 +1,130 @@
+/*
+ *    Copyright (c) 2018, The OpenThread Authors.
+ *    All rights reserved.
+ *
+ *    Redistribution and use in source and binary forms, with or without
+ *    modification, are permitted provided that the following conditions are met:
+ *    1. Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *    2. Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *    3. Neither the name of the copyright holder nor the
+ *       names of its contributors may be used to endorse or promote products
+ *       derived from this software without specific prior written permission.
+ *
+ *    THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *    AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *    IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *    ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ *    LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *    CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *    SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *    INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *    CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *    ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *    POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ *   This file implements a simple tool to decode binary traces.
+ */
+
+#include <inttypes.h>
+#include <stdio.h>
+#include <string.h>
+#include <sysexits.h>
+
+#include <vector>
+
+#include "common/code_utils.hpp"
+#include "common/trace.hpp"
+
+using otbr::Trace;
+
+void help(void)
+{
+    printf("trace-decode - decode binary traces of otbr-agent\n"
+           "SYNTAX:\n"
+           "    trace-decode <TRACE_FILE>\n"
+           "    trace-decode -\n"
+           "With -, the trace is read from the standard input.\n"
+           "Each line is the monotonic time in seconds, the thread id, the event and its arguments.\n"
+           "EXAMPLE:\n"
+           "    curl -s http://localhost:8081/trace | trace-decode -\n");
+}
+
+int ReadAll(FILE *aStream, std::vector<uint8_t> &aData)
+{
+    uint8_t buffer[4096];
+    size_t  length;
+
+    while ((length = fread(buffer, 1, sizeof(buffer), aStream)) > 0)
+    {
+        aData.insert(aData.end(), buffer, buffer + length);
+    }
+
+    return ferror(aStream) ? -1 : 0;
+}
+
+void PrintSample(const Trace::Sample &aSample)
+{
+    const char *name = Trace::GetEventName(aSample.mEvent);
+
+    printf("%" PRIu64 ".%09" PRIu64 " %" PRIu32 " ", aSample.mTimestamp / 1000000000, aSample.mTimestamp % 1000000000,
+           aSample.mThreadId);
+
+    if (name == nullptr)
+    {
+        printf("event-%u arg0=0x%" PRIx64 " arg1=0x%" PRIx32 "\n", aSample.mEvent, aSample.mArg0, aSample.mArg1);
+    }
+    else if (aSample.mEvent == Trace::kEventNdProxyNs)
+    {
+        printf("%s %s=%016" PRIx64 " %s=%" PRIu32 "\n", name, Trace::GetArgName(aSample.mEvent, 0), aSample.mArg0,
+               Trace::GetArgName(aSample.mEvent, 1), aSample.mArg1);
+    }
+    else
+    {
+        printf("%s %s=%" PRIu64 " %s=%" PRIu32 "\n", name, Trace::GetArgName(aSample.mEvent, 0), aSample.mArg0,
+               Trace::GetArgName(aSample.mEvent, 1), aSample.mArg1);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    std::vector<uint8_t>       data;
+    std::vector<Trace::Sample> samples;
+    FILE *                     stream = stdin;
+    int                        ret    = EX_USAGE;
+
+    if (argc != 2)
+    {
+        ExitNow(help());
+    }
+
+    if (strcmp(argv[1], "-") != 0)
+    {
+        stream = fopen(argv[1], "rb");
+        VerifyOrExit(stream != nullptr, ret = EX_NOINPUT, perror(argv[1]));
+    }
+
+    VerifyOrExit(ReadAll(stream, data) == 0, ret = EX_IOERR, perror(argv[1]));
+    VerifyOrExit(Trace::Parse(data.data(), data.size(), samples) == OTBR_ERROR_NONE, ret = EX_DATAERR,
+                 fprintf(stderr, "Invalid trace: %s\n", argv[1]));
+
+    for (const Trace::Sample &sample : samples)
+    {
+        PrintSample(sample);
+    }
+
+    ret = EX_OK;
+
+exit:
+    if (stream != nullptr && stream != stdin)
+    {
+        fclose(stream);
+    }
+
+    return ret;
+}